@@ -27,6 +27,11 @@ namespace COLLADABU
 	/** Converts all lower case ASCII caracters to the corresponding upper case character befor calculating the hash.*/
 	size_t calculateHashUpper(const char* str);
 
+	/** Continues @a hash, the hash calculated for the characters in front of @a str, with the
+	@a length characters of @a str. calculateHash(0, str, length) is equal to calculateHash(str).*/
+	size_t calculateHash(size_t hash, const char* str, size_t length);
+
+	/** Returns the hash of the URI string, that has been calculated when the URI was set.*/
 	size_t calculateHash(const URI& uri);
 	inline size_t calculateHashU(const URI& uri){
 		return calculateHash(uri);
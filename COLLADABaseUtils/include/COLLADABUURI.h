@@ -109,22 +109,39 @@ namespace COLLADABU
 		static const URI INVALID;
 
 	private:
-		/** Resolved version of the URI */
+		/** Value of mOriginalURIOffset, if the original URI is stored in mOriginalURIString.*/
+		static const unsigned int ORIGINAL_URI_STORED = 0xffffffff;
+
+	private:
+		/** Resolved version of the URI. It is the only buffer holding the components. They are
+		assembled as [scheme://][authority][path][?query][#fragment] and located by their lengths.*/
 		String mUriString;
 
-		/** Original URI before resolution */
+		/** Original URI before resolution, if it is not a suffix of mUriString. */
 		String mOriginalURIString;
 
-		/** scheme component */
-		String mScheme;
-		/** authority component */
-		String mAuthority;
-		/** path component */
-		String mPath;
-		/** query component */
-		String mQuery;
-		/** fragment component */
-		String mFragment;
+		/** Position of the original URI in mUriString, if it is a suffix of it (e.g. a fragment
+		only reference or an absolute URI), ORIGINAL_URI_STORED otherwise.*/
+		unsigned int mOriginalURIOffset;
+
+		/** Length of the scheme component */
+		unsigned int mSchemeLength;
+		/** Length of the authority component */
+		unsigned int mAuthorityLength;
+		/** Length of the path component */
+		unsigned int mPathLength;
+		/** Length of the query component */
+		unsigned int mQueryLength;
+		/** Length of the fragment component */
+		unsigned int mFragmentLength;
+
+		/** Hash of mUriString, as calculated by calculateHash(const String&).*/
+		size_t mHash;
+
+		/** Hash of the document part of mUriString, i.e. of all characters in front of the fragment.
+		References to fragments in the same document continue it, without rehashing the document.*/
+		size_t mDocumentHash;
+
 		/** Indicates, if the URi is valid*/
 		bool mIsValid;
 
@@ -161,7 +178,7 @@ namespace COLLADABU
 
 		/**
 		* Constructs a URI object using a <tt><i>baseURI</i></tt> and a <tt><i>mUriString.</i></tt>
-		* Calls set(URIString), and @c validate(baseURI).
+		* Calls set(URIString, &baseURI), which resolves the URI against baseURI.
 		* @param baseURI Base URI to resolve against.
 		* @param URIString String designating this URI.
 		*/
@@ -185,7 +202,7 @@ namespace COLLADABU
 		const String& getURIString() const;
 
 		// Returns the URI as originally set (i.e. not resolved against the base URI)
-		const String& originalStr() const;
+		String originalStr() const;
 
 		// Setter function for setting the full uri.
 		void set(const String& uriStr, const URI* baseURI = 0);
@@ -208,13 +225,13 @@ namespace COLLADABU
 			const URI* baseURI = 0);
 
 
-		// String based component accessors.
-		const String& scheme() const;
-		const String& authority() const;
-		const String& path() const;
-		const String& query() const;
-		const String& fragment() const;
-		const String& id() const; // Alias for fragment()
+		// String based component accessors. The components are copied out of the URI string.
+		String scheme() const;
+		String authority() const;
+		String path() const;
+		String query() const;
+		String fragment() const;
+		String id() const; // Alias for fragment()
 
 		// Component setter functions. If you're going to be calling multiple setters, as in
 		//   uri.path(path);
@@ -238,13 +255,31 @@ namespace COLLADABU
 		String getPathExtension() const;      // URI("/folder/file.dae").getPathExtension() == ".dae"
 		String getPathFile() const;     // URI("/folder/file.dae").getPathFile() == "file.dae"
 
-		const String& getScheme() const { return mScheme;}
-		const String& getProtocol() const { return getScheme();} // Alias for getScheme()
-		const String& getAuthority() const { return mAuthority; }
-		const String& getPath() const { return mPath; }
-		const String& getQuery() const { return mQuery; }
-		const String& getFragment() const { return mFragment; }
-		const String& getID() const { return getFragment(); } // Alias for getFragment()
+		String getScheme() const { return String(mUriString, 0, mSchemeLength);}
+		String getProtocol() const { return getScheme();} // Alias for getScheme()
+		String getAuthority() const { return String(mUriString, getAuthorityPosition(), mAuthorityLength); }
+		String getPath() const { return String(mUriString, getPathPosition(), mPathLength); }
+		String getQuery() const { return String(mUriString, getQueryPosition(), mQueryLength); }
+		String getFragment() const { return String(mUriString, getFragmentPosition(), mFragmentLength); }
+		String getID() const { return getFragment(); } // Alias for getFragment()
+
+		/** Returns true, if the URI has a scheme. Does not copy the scheme.*/
+		bool hasScheme() const { return mSchemeLength != 0; }
+		/** Returns true, if the URI has an authority. Does not copy the authority.*/
+		bool hasAuthority() const { return mAuthorityLength != 0; }
+		/** Returns true, if the URI has a path. Does not copy the path.*/
+		bool hasPath() const { return mPathLength != 0; }
+		/** Returns true, if the URI has a query. Does not copy the query.*/
+		bool hasQuery() const { return mQueryLength != 0; }
+		/** Returns true, if the URI has a fragment. Does not copy the fragment.*/
+		bool hasFragment() const { return mFragmentLength != 0; }
+
+		/** Returns the URI without its fragment, i.e. the URI of the document this URI refers to.
+		The components and the hash are taken from this URI, the URI is not parsed again.*/
+		URI getDocumentURI() const;
+
+		/** Returns the hash of the URI string. It is calculated once, when the URI is set.*/
+		size_t getHash() const { return mHash; }
 
 
 		// Path component setter.
@@ -286,9 +321,9 @@ namespace COLLADABU
 		* Comparison operator.
 		* @return Returns true if URI's are equal.
 		*/
-		inline bool operator==(const URI& other) const 
+		inline bool operator==(const URI& other) const
         {
-			return mUriString == other.mUriString;
+			return mHash == other.mHash && mUriString == other.mUriString;
 		}
 
 		URI& operator=(const URI& other);
@@ -382,11 +417,39 @@ namespace COLLADABU
 			String& fragment);
 
 
-		/** Checks if th eURI is valid.*/
-		void validate(const URI* baseURI);
+		/** Resolves the components of a parsed URI reference against @a baseURI, according to rfc 3986.*/
+		static void resolve(String& scheme,
+			String& authority,
+			String& path,
+			String& query,
+			const URI* baseURI);
+
+		/** Sets the resolved URI @a uriString, assembled from components with the passed lengths,
+		and the original URI @a originalURIString it has been resolved from. Calculates the hash and
+		checks if the URI is valid, i.e. it must have path or fragment.*/
+		void setResolved(String& uriString,
+			size_t schemeLength,
+			size_t authorityLength,
+			size_t pathLength,
+			size_t queryLength,
+			size_t fragmentLength,
+			const String& originalURIString);
+
+		/** Sets this URI to the fragment reference @a fragment, resolved against @a baseURI, without
+		parsing the base URI again.*/
+		void setFragmentReference(const String& fragment, const URI& baseURI);
+
+		/** Returns the position of the authority in mUriString.*/
+		size_t getAuthorityPosition() const { return mSchemeLength ? mSchemeLength + 3 /*"://"*/ : 0; }
 
-		/** Checks if the URI is valid, i.e. it must have path or fragment*/
-		void validate();
+		/** Returns the position of the path in mUriString.*/
+		size_t getPathPosition() const { return getAuthorityPosition() + mAuthorityLength; }
+
+		/** Returns the position of the query in mUriString.*/
+		size_t getQueryPosition() const { return getPathPosition() + mPathLength + (mQueryLength ? 1 /*"?"*/ : 0); }
+
+		/** Returns the position of the fragment in mUriString.*/
+		size_t getFragmentPosition() const { return mUriString.length() - mFragmentLength; }
 
 		static String assembleUri(const String& scheme,
 			const String& authority,
@@ -395,8 +458,6 @@ namespace COLLADABU
 			const String& fragment,
 			bool forceLibxmlCompatible = false);
 
-		void setURI(String _URIString, const URI* baseURI);
-
     };
 
 
@@ -40,6 +40,22 @@ namespace COLLADABU
 		return h;
 	}
 
+	size_t calculateHash( size_t hash, const char* str, size_t length )
+	{
+		unsigned long h = (unsigned long)hash;
+		unsigned long g;
+		const char* pos = str;
+		const char* end = str + length;
+
+		while (pos != end) {
+			h = (h << 4) + *pos++;
+			if ((g = (h & 0xf0000000)) != 0)
+				h ^= g >> 24;
+			h &= ~g;
+		}
+		return h;
+	}
+
 	size_t calculateHashUpper( const char* str )
 	{
 		unsigned long h = 0;
@@ -57,7 +73,7 @@ namespace COLLADABU
 
 	size_t calculateHash( const URI& uri )
 	{
-		return calculateHash(uri.getURIString());
+		return uri.getHash();
 	}
 
 
@@ -222,14 +222,7 @@ namespace COLLADABU
 		}
 		else
 		{
-			mUriString = copyFrom_.mUriString;
-			mOriginalURIString = copyFrom_.mOriginalURIString;
-			mScheme = copyFrom_.mScheme;
-			mAuthority = copyFrom_.mAuthority;
-			mPath = copyFrom_.mPath;
-			mQuery = copyFrom_.mQuery;
-			mFragment = copyFrom_.mFragment;
-			mIsValid = copyFrom_.mIsValid;
+			copyFrom(copyFrom_);
 		}
 	}
 
@@ -238,11 +231,14 @@ namespace COLLADABU
 //		set(copyFrom.originalStr());
 		mUriString = copyFrom.mUriString;
 		mOriginalURIString = copyFrom.mOriginalURIString;
-		mScheme = copyFrom.mScheme;
-		mAuthority = copyFrom.mAuthority;
-		mPath = copyFrom.mPath;
-		mQuery = copyFrom.mQuery;
-		mFragment = copyFrom.mFragment;
+		mOriginalURIOffset = copyFrom.mOriginalURIOffset;
+		mSchemeLength = copyFrom.mSchemeLength;
+		mAuthorityLength = copyFrom.mAuthorityLength;
+		mPathLength = copyFrom.mPathLength;
+		mQueryLength = copyFrom.mQueryLength;
+		mFragmentLength = copyFrom.mFragmentLength;
+		mHash = copyFrom.mHash;
+		mDocumentHash = copyFrom.mDocumentHash;
 		mIsValid = copyFrom.mIsValid;
 	}
 
@@ -261,11 +257,14 @@ namespace COLLADABU
 		// Clear everything 
 		mUriString.clear();
 		mOriginalURIString.clear();
-		mScheme.clear();
-		mAuthority.clear();
-		mPath.clear();
-		mQuery.clear();
-		mFragment.clear();
+		mOriginalURIOffset = 0;
+		mSchemeLength = 0;
+		mAuthorityLength = 0;
+		mPathLength = 0;
+		mQueryLength = 0;
+		mFragmentLength = 0;
+		mHash = 0;
+		mDocumentHash = 0;
 	}
 
 
@@ -273,8 +272,24 @@ namespace COLLADABU
 		return mUriString;
 	}
 
-	const String& URI::originalStr() const {
-		return mOriginalURIString;
+	String URI::originalStr() const {
+		if ( mOriginalURIOffset == ORIGINAL_URI_STORED )
+			return mOriginalURIString;
+		return String(mUriString, mOriginalURIOffset, String::npos);
+	}
+
+	URI URI::getDocumentURI() const
+	{
+		URI documentURI;
+		documentURI.mUriString.assign(mUriString, 0, getFragmentPosition() - (mFragmentLength ? 1 /*"#"*/ : 0));
+		documentURI.mSchemeLength = mSchemeLength;
+		documentURI.mAuthorityLength = mAuthorityLength;
+		documentURI.mPathLength = mPathLength;
+		documentURI.mQueryLength = mQueryLength;
+		documentURI.mHash = mDocumentHash;
+		documentURI.mDocumentHash = mDocumentHash;
+		documentURI.mIsValid = (mPathLength != 0);
+		return documentURI;
 	}
 
 	void URI::parsePath(const String& path,
@@ -344,61 +359,39 @@ namespace COLLADABU
 			}
 	}
 
-	void URI::set(const String& uriStr_, const URI* baseURI) {
-		// We make a copy of the uriStr so that set(mOriginalURIString, ...) works properly.
-		String uriStr = uriStr_;
-		reset();
-		mOriginalURIString = uriStr;
+	void URI::set(const String& uriStr, const URI* baseURI) {
+		// A URI is never resolved against itself, the previous value is discarded
+		if ( baseURI == this )
+			baseURI = 0;
 
-		if (!parseUriRef(uriStr, mScheme, mAuthority, mPath, mQuery, mFragment)) 
+		// References to a fragment in the base document are the most common ones. They are
+		// resolved without parsing the base URI again.
+		if ( baseURI && !uriStr.empty() && uriStr[0] == '#' )
 		{
-			reset();
+			setFragmentReference(uriStr, *baseURI);
 			return;
 		}
-		else
+
+		String scheme, authority, path, query, fragment;
+		if (!parseUriRef(uriStr, scheme, authority, path, query, fragment)) 
 		{
-			mIsValid = true;
+			reset();
+			return;
 		}
 
-		validate(baseURI);
-	}
-
-    void URI::set(const char* uriStr_, const URI* baseURI) {
-        // We make a copy of the uriStr so that set(mOriginalURIString, ...) works properly.
-        String uriStr = uriStr_;
-        reset();
-        mOriginalURIString = uriStr;
+		resolve(scheme, authority, path, query, baseURI);
 
-        if (!parseUriRef(uriStr, mScheme, mAuthority, mPath, mQuery, mFragment)) 
-        {
-            reset();
-            return;
-        }
-        else
-        {
-            mIsValid = true;
-        }
+		// Reassemble all this into a String version of the URI
+		String uriString = assembleUri(scheme, authority, path, query, fragment);
+		setResolved(uriString, scheme.length(), authority.length(), path.length(), query.length(), fragment.length(), uriStr);
+	}
 
-        validate(baseURI);
+    void URI::set(const char* uriStr, const URI* baseURI) {
+        set(String(uriStr), baseURI);
     }
 
-    void URI::set(const char* uriStr_, size_t length, const URI* baseURI) {
-        // We make a copy of the uriStr so that set(mOriginalURIString, ...) works properly.
-        String uriStr(uriStr_, length);
-        reset();
-        mOriginalURIString = uriStr;
-
-        if (!parseUriRef(uriStr, mScheme, mAuthority, mPath, mQuery, mFragment)) 
-        {
-            reset();
-            return;
-        }
-        else
-        {
-            mIsValid = true;
-        }
-
-        validate(baseURI);
+    void URI::set(const char* uriStr, size_t length, const URI* baseURI) {
+        set(String(uriStr, length), baseURI);
     }
 
 	void URI::set(const String& scheme_,
@@ -411,13 +404,96 @@ namespace COLLADABU
 		set(assembleUri(scheme_, authority_, path_, query_, fragment_), baseURI);
 	}
 
+	void URI::setResolved(String& uriString,
+		size_t schemeLength,
+		size_t authorityLength,
+		size_t pathLength,
+		size_t queryLength,
+		size_t fragmentLength,
+		const String& originalURIString)
+	{
+		// The original URI is stored separately only, if the resolved URI does not end with it.
+		size_t uriLength = uriString.length();
+		size_t originalLength = originalURIString.length();
+		if ( originalLength <= uriLength && uriString.compare(uriLength - originalLength, originalLength, originalURIString) == 0 )
+		{
+			mOriginalURIOffset = (unsigned int)(uriLength - originalLength);
+			mOriginalURIString.clear();
+		}
+		else
+		{
+			mOriginalURIOffset = ORIGINAL_URI_STORED;
+			mOriginalURIString = originalURIString;
+		}
+
+		// swap after the original URI has been handled, it might refer to mUriString
+		mUriString.swap(uriString);
 
-	const String& URI::scheme() const { return mScheme; }
-	const String& URI::authority() const { return mAuthority; }
-	const String& URI::path() const { return mPath; }
-	const String& URI::query() const { return mQuery; }
-	const String& URI::fragment() const { return mFragment; }
-	const String& URI::id() const { return fragment(); }
+		mSchemeLength = (unsigned int)schemeLength;
+		mAuthorityLength = (unsigned int)authorityLength;
+		mPathLength = (unsigned int)pathLength;
+		mQueryLength = (unsigned int)queryLength;
+		mFragmentLength = (unsigned int)fragmentLength;
+
+		size_t documentLength = uriLength - fragmentLength - (fragmentLength ? 1 /*"#"*/ : 0);
+		mDocumentHash = calculateHash(0, mUriString.c_str(), documentLength);
+		mHash = calculateHash(mDocumentHash, mUriString.c_str() + documentLength, uriLength - documentLength);
+
+		mIsValid = (pathLength != 0) || (fragmentLength != 0);
+	}
+
+	void URI::setFragmentReference(const String& uriStr, const URI& baseURI)
+	{
+		// This is what resolve() does for an URI reference without scheme, authority and path:
+		// everything but the fragment is taken from the base URI.
+		size_t fragmentLength = uriStr.length() - 1;
+		size_t documentLength = baseURI.getFragmentPosition() - (baseURI.mFragmentLength ? 1 /*"#"*/ : 0);
+
+		String uriString;
+		uriString.reserve(documentLength + uriStr.length());
+		uriString.assign(baseURI.mUriString, 0, documentLength);
+		if ( fragmentLength != 0 )
+			uriString.append(uriStr);
+
+		// baseURI might be this
+		size_t documentHash = baseURI.mDocumentHash;
+		size_t schemeLength = baseURI.mSchemeLength;
+		size_t authorityLength = baseURI.mAuthorityLength;
+		size_t pathLength = baseURI.mPathLength;
+		size_t queryLength = baseURI.mQueryLength;
+
+		if ( fragmentLength != 0 )
+		{
+			mOriginalURIOffset = (unsigned int)documentLength;
+			mOriginalURIString.clear();
+		}
+		else
+		{
+			mOriginalURIOffset = ORIGINAL_URI_STORED;
+			mOriginalURIString = uriStr;
+		}
+
+		mUriString.swap(uriString);
+
+		mSchemeLength = (unsigned int)schemeLength;
+		mAuthorityLength = (unsigned int)authorityLength;
+		mPathLength = (unsigned int)pathLength;
+		mQueryLength = (unsigned int)queryLength;
+		mFragmentLength = (unsigned int)fragmentLength;
+
+		mDocumentHash = documentHash;
+		mHash = calculateHash(documentHash, mUriString.c_str() + documentLength, mUriString.length() - documentLength);
+
+		mIsValid = (pathLength != 0) || (fragmentLength != 0);
+	}
+
+
+	String URI::scheme() const { return getScheme(); }
+	String URI::authority() const { return getAuthority(); }
+	String URI::path() const { return getPath(); }
+	String URI::query() const { return getQuery(); }
+	String URI::fragment() const { return getFragment(); }
+	String URI::id() const { return fragment(); }
 
 
 	namespace {
@@ -427,30 +503,30 @@ namespace COLLADABU
 	}
 
 	void URI::pathComponents(String& dir, String& baseName, String& ext) const {
-		parsePath(mPath, dir, baseName, ext);
+		parsePath(getPath(), dir, baseName, ext);
 	}
 
 	String URI::getPathDir() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(getPath(), dir, base, ext);
 		return dir;
 	}
 
 	String URI::getPathFileBase() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(getPath(), dir, base, ext);
 		return base;
 	}
 
 	String URI::getPathExtension() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(getPath(), dir, base, ext);
 		return ext;
 	}
 
 	String URI::getPathFile() const {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(getPath(), dir, base, ext);
 		String pathFile = base;
 		if ( !ext.empty() )
 			pathFile += "." + ext;
@@ -472,35 +548,35 @@ namespace COLLADABU
 
 	void URI::setPathDir(const String& dir) {
 		String tmp, base, ext;
-		parsePath(mPath, tmp, base, ext);
+		parsePath(getPath(), tmp, base, ext);
 		setPath(addSlashToEnd(dir), base, ext);
 	}
 
 	void URI::setPathFileBase(const String& baseName) {
 		String dir, tmp, ext;
-		parsePath(mPath, dir, tmp, ext);
+		parsePath(getPath(), dir, tmp, ext);
 		setPath(dir, baseName, ext);
 	}
 
 	void URI::setPathExtension(const String& ext) 
 	{
 		String dir, base, tmp;
-		parsePath(mPath, dir, base, tmp);
+		parsePath(getPath(), dir, base, tmp);
 		setPath(dir, base, ext);
 	}
 
 	void URI::setPathFile(const String& file) {
 		String dir, base, ext;
-		parsePath(mPath, dir, base, ext);
+		parsePath(getPath(), dir, base, ext);
 		setPath(dir, file, "");
 	}
 
 
-	void URI::setScheme(const String& scheme_) { set(scheme_, mAuthority, mPath, mQuery, mFragment); };
-	void URI::setAuthority(const String& authority_) { set(mScheme, authority_, mPath, mQuery, mFragment); }
-	void URI::setPath(const String& path_) { set(mScheme, mAuthority, path_, mQuery, mFragment); }
-	void URI::setQuery(const String& query_) { set(mScheme, mAuthority, mPath, query_, mFragment); }
-	void URI::setFragment(const String& fragment_) { set(mScheme, mAuthority, mPath, mQuery, fragment_); }
+	void URI::setScheme(const String& scheme_) { set(scheme_, getAuthority(), getPath(), getQuery(), getFragment()); };
+	void URI::setAuthority(const String& authority_) { set(getScheme(), authority_, getPath(), getQuery(), getFragment()); }
+	void URI::setPath(const String& path_) { set(getScheme(), getAuthority(), path_, getQuery(), getFragment()); }
+	void URI::setQuery(const String& query_) { set(getScheme(), getAuthority(), getPath(), query_, getFragment()); }
+	void URI::setFragment(const String& fragment_) { set(getScheme(), getAuthority(), getPath(), getQuery(), fragment_); }
 	void URI::setId(const String& id) { setFragment(id); }
 
 
@@ -512,12 +588,11 @@ namespace COLLADABU
 		}
 	}
 
-	void URI::validate()
-	{
-		mIsValid = !mPath.empty() || !mFragment.empty();
-	}
-
-	void URI::validate(const URI* baseURI)
+	void URI::resolve(String& scheme,
+		String& authority,
+		String& path,
+		String& query,
+		const URI* baseURI)
 	{
 		// If no base URI was supplied, use the container's document URI. If there's
 		// no container or the container doesn't have a doc URI, use the application
@@ -540,85 +615,80 @@ namespace COLLADABU
 		}
 */
 		// This is rewritten according to the updated rfc 3986
-		if (!mScheme.empty()) // if defined(R.scheme) then
+		if (!scheme.empty()) // if defined(R.scheme) then
 		{
 			// Everything stays the same except path which we normalize
 			// T.scheme    = R.scheme;
 			// T.authority = R.authority;
 			// T.path      = remove_dot_segments(R.path);
 			// T.query     = R.query;
-			normalize(mPath);
+			normalize(path);
 		}
 		else
 		{
-			if (!mAuthority.empty()) // if defined(R.authority) then
+			if (!authority.empty()) // if defined(R.authority) then
 			{
 				// Authority and query stay the same, path is normalized
 				// T.authority = R.authority;
 				// T.path      = remove_dot_segments(R.path);
 				// T.query     = R.query;
-				normalize(mPath);
+				normalize(path);
 			}
 			else
 			{
-				if (mPath.empty())  // if (R.path == "") then
+				if (path.empty())  // if (R.path == "") then
 				{
 					if ( baseURI )
 					{
 						// T.path = Base.path;
-						mPath = baseURI->mPath;
+						path = baseURI->getPath();
 
 						//if defined(R.query) then
 						//   T.query = R.query;
 						//else
 						//   T.query = Base.query;
 						//endif;
-						if (mQuery.empty())
-							mQuery = baseURI->mQuery;
+						if (query.empty())
+							query = baseURI->getQuery();
 					}
 				}
 				else
 				{
-					if (mPath[0] == '/')  // if (R.path starts-with "/") then
+					if (path[0] == '/')  // if (R.path starts-with "/") then
 					{
 						// T.path = remove_dot_segments(R.path);
-						normalize(mPath);
+						normalize(path);
 					}
 					else
 					{
 						// T.path = merge(Base.path, R.path);
 						if ( baseURI )
 						{
-							if (!baseURI->mAuthority.empty() && baseURI->mPath.empty()) // authority defined, path empty
+							if (baseURI->hasAuthority() && !baseURI->hasPath()) // authority defined, path empty
 							{
-								mPath.insert(0, "/");
+								path.insert(0, "/");
 							}
 							else 
 							{
 								String dir, baseName, ext;
-								parsePath(baseURI->mPath, dir, baseName, ext);
-								mPath = dir + mPath;
+								parsePath(baseURI->getPath(), dir, baseName, ext);
+								path = dir + path;
 							}
 							// T.path = remove_dot_segments(T.path);
-							normalize(mPath);
+							normalize(path);
 						}
 					}
 					// T.query = R.query;
 				}
 				// T.authority = Base.authority;
 				if ( baseURI )
-					mAuthority = baseURI->mAuthority;
+					authority = baseURI->getAuthority();
 			}
 			// T.scheme = Base.scheme;
 			if ( baseURI )
-				mScheme = baseURI->mScheme;
+				scheme = baseURI->getScheme();
 		}
 		// T.fragment = R.fragment;
-
-		// Reassemble all this into a String version of the URI
-		mUriString = assembleUri(mScheme, mAuthority, mPath, mQuery, mFragment);
-
-		validate();
 	}
 
 
@@ -808,7 +878,7 @@ namespace COLLADABU
 	bool URI::makeRelativeTo ( const URI& relativeToURI, bool ignoreCase)
 	{
 		// Can only do this function if both URIs have the same scheme and authority
-		if (mScheme != relativeToURI.mScheme  ||  mAuthority != relativeToURI.mAuthority)
+		if (getScheme() != relativeToURI.getScheme()  ||  getAuthority() != relativeToURI.getAuthority())
 			return false;
 
 		// advance till we find a segment that doesn't match
@@ -882,7 +952,7 @@ namespace COLLADABU
 		WideString thisSlashWideString(this_slash);
 		newPath += StringUtils::wideString2utf8String(thisSlashWideString);
 
-		set("", "", newPath, mQuery, mFragment, 0/*relativeToURI*/);
+		set("", "", newPath, getQuery(), getFragment(), 0/*relativeToURI*/);
 		return true;
 	}
 
@@ -1065,15 +1135,16 @@ namespace COLLADABU
 //		parseUriRef(uriRef, scheme, authority, path, query, fragment);
 
 		// Make sure we have a file scheme URI, or that it doesn't have a scheme
-		if (!mScheme.empty()  &&  mScheme != "file")
+		String scheme = getScheme();
+		if (!scheme.empty()  &&  scheme != "file")
 			return "";
 
 		String filePath;
-        String currentPath ( mPath );
+        String currentPath ( getPath() );
 
 		if (type == Utils::WINDOWS) {
-			if (!mAuthority.empty())
-				filePath += String("\\\\") + mAuthority; // UNC path
+			if (hasAuthority())
+				filePath += String("\\\\") + getAuthority(); // UNC path
 
 			// Replace two leading slashes with one leading slash, so that
 			// ///otherComputer/file.dae becomes //otherComputer/file.dae and
@@ -1106,7 +1177,7 @@ namespace COLLADABU
 
 	URI::operator size_t()const
 	{
-		return 	calculateHash( *this );
+		return mHash;
 	}
 }
 
@@ -26,16 +26,19 @@
 #include "COLLADAFWConstants.h"
 #include "COLLADAFWController.h"
 #include "COLLADAFWEdge.h"
+#include "COLLADAFWEdgeBuilder.h"
 #include "COLLADAFWEffect.h"
 #include "COLLADAFWEffectCommon.h"
 #include "COLLADAFWException.h"
 #include "COLLADAFWFileInfo.h"
+#include "COLLADAFWFlatNodeHierarchy.h"
 #include "COLLADAFWFloatOrDoubleArray.h"
 #include "COLLADAFWFloatOrParam.h"
 #include "COLLADAFWFormula.h"
 #include "COLLADAFWFormulaNewParam.h"
 #include "COLLADAFWFormulas.h"
 #include "COLLADAFWGeometry.h"
+#include "COLLADAFWHexBinaryData.h"
 #include "COLLADAFWILoader.h"
 #include "COLLADAFWIWriter.h"
 #include "COLLADAFWImage.h"
@@ -95,6 +98,7 @@
 #include "COLLADAFWUniqueId.h"
 #include "COLLADAFWValidate.h"
 #include "COLLADAFWValueType.h"
+#include "COLLADAFWVertexWelder.h"
 #include "COLLADAFWVisualScene.h"
 
 
@@ -13,6 +13,7 @@
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWUniqueId.h"
+#include "COLLADAFWArena.h"
 
 
 namespace COLLADAFW
@@ -33,6 +34,12 @@ namespace COLLADAFW
         /** Destructor. */
 		virtual ~Animatable(){}
 
+		/** Animatables are allocated from the current Arena of the calling thread, if there is one.*/
+		static void* operator new( size_t size ) { return Arena::allocObject(size); }
+
+		/** Releases animatables allocated from the heap. Animatables of the current Arena are released with the arena.*/
+		static void operator delete( void* object ) { Arena::releaseObject(object); }
+
 		const UniqueId& getAnimationList() const { return mAnimationList; }
 
 		void setAnimationList( const UniqueId& animationList) { mAnimationList = animationList; }
@@ -0,0 +1,149 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADAFramework.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_ARENA_H__
+#define __COLLADAFW_ARENA_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+#include <map>
+#include <cstddef>
+
+
+namespace COLLADAFW
+{
+
+	/** Memory arena the framework objects and the memory of ArrayPrimitiveType can be allocated from.
+	Memory is taken from large blocks by incrementing a pointer and is never released individually. All
+	blocks are released at once, when the arena is deleted.
+	An arena is used by the framework classes only while it is the current arena of the calling thread,
+	see setCurrentArena(). Releasing memory that has been allocated from the current arena does nothing.
+	All objects and arrays using memory of an arena must have been destroyed before the arena is deleted.*/
+	class Arena
+	{
+	public:
+		/** Counters describing the allocations made by an arena.*/
+		struct Statistics
+		{
+			Statistics() : allocationCount(0), reallocationCount(0), allocatedBytes(0), abandonedBytes(0), blockCount(0), reservedBytes(0) {}
+
+			/** Number of allocations made from the arena.*/
+			size_t allocationCount;
+
+			/** Number of allocations that have been resized.*/
+			size_t reallocationCount;
+
+			/** Number of bytes requested by all allocations, including padding for alignment.*/
+			size_t allocatedBytes;
+
+			/** Number of bytes of allocations that have been copied to a new allocation when they have been
+			resized. They are part of allocatedBytes, but are not used any more.*/
+			size_t abandonedBytes;
+
+			/** Number of blocks requested from the heap.*/
+			size_t blockCount;
+
+			/** Number of bytes of all blocks.*/
+			size_t reservedBytes;
+		};
+
+		/** The size of the first block.*/
+		static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+		/** The maximal size of a block, apart from allocations not fitting into such a block.*/
+		static const size_t MAXIMUM_BLOCK_SIZE = 16 * 1024 * 1024;
+
+		/** All allocations are aligned to this number of bytes.*/
+		static const size_t ALIGNMENT = 16;
+
+	private:
+		/** Maps the begin of each block to its end.*/
+		typedef std::map<const char*, const char*> BlockMap;
+
+		/** All blocks allocated by the arena.*/
+		BlockMap mBlocks;
+
+		/** The next free byte in the current block.*/
+		char* mCurrent;
+
+		/** The end of the current block.*/
+		char* mEnd;
+
+		/** The most recent allocation. Only this one can be resized in place.*/
+		char* mLastAllocation;
+
+		/** The size of the next block.*/
+		size_t mNextBlockSize;
+
+		Statistics mStatistics;
+
+	public:
+
+		/** Constructor.
+		@param blockSize The size of the first block. The size doubles for each following block.*/
+		Arena( size_t blockSize = DEFAULT_BLOCK_SIZE );
+
+		/** Destructor. Releases all blocks.*/
+		~Arena();
+
+		/** Allocates @a size bytes.*/
+		void* allocate( size_t size );
+
+		/** Resizes the allocation @a data of @a size bytes to @a newSize bytes. If @a data is the last
+		allocation and the current block is large enough, it grows in place. Otherwise the contents are
+		copied to a new allocation.*/
+		void* reallocate( void* data, size_t size, size_t newSize );
+
+		/** Returns true, if @a data points into one of the blocks of the arena.*/
+		bool contains( const void* data ) const;
+
+		/** Returns the allocation counters of the arena.*/
+		const Statistics& getStatistics() const { return mStatistics; }
+
+		/** Sets the arena, the framework classes allocate their memory from on the calling thread. Set to
+		0 to use the heap.*/
+		static void setCurrentArena( Arena* arena );
+
+		/** Returns the arena of the calling thread or 0, if the heap is used.*/
+		static Arena* getCurrentArena();
+
+		/** Allocates memory for a framework object from the current arena or, if there is no current arena,
+		using the global operator new.*/
+		static void* allocObject( size_t size );
+
+		/** Releases the memory of a framework object allocated by allocObject().*/
+		static void releaseObject( void* object );
+
+		/** Allocates @a size bytes from the current arena or, if there is no current arena, using malloc.*/
+		static void* allocMemory( size_t size );
+
+		/** Resizes memory allocated by allocMemory(). Memory of the current arena is reallocated in the arena,
+		all other memory using realloc.*/
+		static void* reallocMemory( void* data, size_t size, size_t newSize );
+
+		/** Releases memory allocated by allocMemory().*/
+		static void releaseMemory( void* data );
+
+	private:
+
+        /** Disable default copy ctor. */
+		Arena( const Arena& pre );
+
+        /** Disable default assignment operator. */
+		const Arena& operator= ( const Arena& pre );
+
+		/** Allocates a new block that can hold at least @a size bytes and makes it the current one.*/
+		void addBlock( size_t size );
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_ARENA_H__
@@ -13,6 +13,7 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWArray.h"
+#include "COLLADAFWArena.h"
 #include <string.h>
 #include <cassert>
 #include <stdlib.h>
@@ -22,7 +23,8 @@ namespace COLLADAFW
 {
 	/**
 	Array template that simplifies handling of C-arrays.
-	The memory will be allocated with malloc, freed with free and resized with realloc.
+	The memory will be allocated with malloc, freed with free and resized with realloc, or taken from
+	the current Arena of the calling thread, if there is one.
 	Don't take this class for other data types then the primitives data types, because no
 	constructors and destructors will be called!
 	*/
@@ -146,7 +148,7 @@ namespace COLLADAFW
 			if ( capacity == 0 )
 				setData ( 0, 0, 0 );
 			else
-				setData ( ( Type* ) ( malloc ( capacity * sizeof (Type) ) ), 0, capacity );
+				setData ( ( Type* ) ( Arena::allocMemory ( capacity * sizeof (Type) ) ), 0, capacity );
 			mFlags |= flags;
 		}
 
@@ -154,7 +156,7 @@ namespace COLLADAFW
 		Must not be called, if the memory has not been allocated by allocateMemory().*/
 		void releaseMemory ()
 		{
-			free ( mData );
+			Arena::releaseMemory ( mData );
 			setData ( 0, 0, 0 );
 		}
 
@@ -170,11 +172,12 @@ namespace COLLADAFW
 			size_t newCapacity = ( mCapacity * 3 ) / 2 + 1;
 			if (newCapacity < minCapacity)
 				newCapacity = minCapacity;
+			size_t oldCapacity = mCapacity;
 			mCapacity = newCapacity;
 
 			if ( mData )
 			{
-				mData = ( Type* ) realloc ( mData, mCapacity * sizeof ( Type ) );
+				mData = ( Type* ) Arena::reallocMemory ( mData, oldCapacity * sizeof ( Type ), mCapacity * sizeof ( Type ) );
 				if ( mCount > mCapacity )
 					mCount = mCapacity;
 			}
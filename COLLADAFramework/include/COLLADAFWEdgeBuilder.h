@@ -0,0 +1,125 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_EDGEBUILDER_H__
+#define __COLLADAFW_EDGEBUILDER_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWEdge.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+
+	class Mesh;
+	class MeshPrimitive;
+
+	/** Determines the unique edges of a mesh and the edges of its faces. The faces of polygons,
+	polylists and triangles are bounded by the edges between consecutive vertices, trifans and
+	tristrips are split into triangles. Lines, linestrips and points do not have faces.
+	Each edge of a face is called a face edge. The face edges of all primitives are collected,
+	in the order of the primitives, faces and vertices, and the unique edges are numbered in the
+	order of their first face edge. A face edge refers to its edge by the edge index, or by
+	-(edge index + 1), if it runs from the greater to the smaller vertex index.
+	The face edges are collected in parallel for the primitives of a mesh. They are grouped by
+	their smaller vertex index with one counting sort, the edges with the same smaller vertex index
+	are distinguished by marking their greater vertex index. This takes time linear in the number
+	of face edges and vertices, instead of looking up each face edge in a map.*/
+	class EdgeBuilder
+	{
+	private:
+		/** The number of threads used to collect the face edges of the primitives.*/
+		size_t mThreadCount;
+
+		/** The unique edges of the mesh, in the order of their first face edge.*/
+		std::vector<Edge> mEdges;
+
+		/** The signed edge indices of the face edges of all primitives.*/
+		std::vector<int> mFaceEdgeIndices;
+
+		/** The index of the first face edge of each primitive in mFaceEdgeIndices, followed by the
+		number of all face edges.*/
+		std::vector<size_t> mPrimitiveOffsets;
+
+		/** The start and end vertex index of each face edge.*/
+		std::vector<unsigned int> mStartIndices;
+		std::vector<unsigned int> mEndIndices;
+
+		/** Working memory of the counting sort.*/
+		std::vector<size_t> mBucketOffsets;
+		std::vector<unsigned int> mSortedFaceEdges;
+		std::vector<unsigned int> mVertexMarks;
+		std::vector<unsigned int> mVertexEdges;
+		std::vector<unsigned int> mFaceEdgeGroups;
+		std::vector<unsigned int> mGroupEdges;
+
+	public:
+		/** Constructor.*/
+		EdgeBuilder();
+
+		~EdgeBuilder();
+
+		/** Sets the number of threads used to collect the face edges of the primitives. With less
+		than two threads, they are collected in the calling thread.*/
+		void setThreadCount( size_t threadCount ) { mThreadCount = threadCount; }
+
+		/** Returns the number of threads used to collect the face edges of the primitives.*/
+		size_t getThreadCount() const { return mThreadCount; }
+
+		/** Determines the edges of @a mesh. The results of a previous call are replaced.*/
+		void build( const Mesh* mesh );
+
+		/** Returns the unique edges of the mesh, in the order of their first face edge.*/
+		const std::vector<Edge>& getEdges() const { return mEdges; }
+
+		/** Returns the number of face edges of the primitive with index @a primitiveIndex.*/
+		size_t getFaceEdgeCount( size_t primitiveIndex ) const { return mPrimitiveOffsets[primitiveIndex + 1] - mPrimitiveOffsets[primitiveIndex]; }
+
+		/** Returns the signed edge indices of the face edges of the primitive with index
+		@a primitiveIndex, in the order of its faces and vertices. Trifans and tristrips have three
+		face edges per triangle. The face edges of a polygon start at its vertices, the face edge
+		of a vertex has the same index as the vertex in the position indices of the primitive.*/
+		const int* getFaceEdgeIndices( size_t primitiveIndex ) const
+		{
+			return getFaceEdgeCount( primitiveIndex ) > 0 ? &mFaceEdgeIndices[mPrimitiveOffsets[primitiveIndex]] : 0;
+		}
+
+		/** Returns the number of face edges of @a primitive.*/
+		static size_t countFaceEdges( const MeshPrimitive* primitive );
+
+		/** Removes all edges. The memory is kept.*/
+		void clear();
+
+	private:
+        /** Disable default copy ctor. */
+		EdgeBuilder( const EdgeBuilder& pre );
+        /** Disable default assignment operator. */
+		const EdgeBuilder& operator= ( const EdgeBuilder& pre );
+
+		/** Collects the start and end vertex indices of the face edges of every @a step th primitive
+		of @a mesh, starting with the primitive with index @a first. The greatest vertex index is
+		written to @a maxVertexIndex.*/
+		void collectFaceEdges( const Mesh* mesh, size_t first, size_t step, unsigned int* maxVertexIndex );
+
+		/** Collects the start and end vertex indices of the face edges of @a primitive and returns
+		the greatest vertex index.*/
+		static unsigned int collectPrimitiveFaceEdges( const MeshPrimitive* primitive, unsigned int* startIndices, unsigned int* endIndices );
+
+		/** Groups the face edges, that connect the same vertices, numbers the groups in the order
+		of their first face edge and writes the signed edge indices.*/
+		void numberEdges( size_t vertexCount );
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_EDGEBUILDER_H__
@@ -0,0 +1,146 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_FLATNODEHIERARCHY_H__
+#define __COLLADAFW_FLATNODEHIERARCHY_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWNode.h"
+
+#include "Math/COLLADABUMathMatrix4.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+
+	class VisualScene;
+
+	/** The node hierarchy of a visual scene, flattened into arrays, and the local and world matrices of
+	all its nodes. The nodes are stored level by level, i.e. the root nodes first, followed by their
+	children, followed by the children of these and so on. Each node refers to its parent by index, which
+	is always less than the index of the node.
+	The matrices are stored in structure of arrays layout: for each of the twelve elements of the upper
+	three rows of a matrix there is an array, that contains this element of the matrices of all nodes.
+	The local matrices are calculated in one linear pass over the nodes, without creating a matrix per
+	transformation. The world matrices are calculated level by level, all nodes of a level are
+	independent of each other. The loops over the nodes of a level access the element arrays
+	sequentially, the parents of consecutive nodes are consecutive as well.
+	All transformations are assumed to be affine, i.e. the last row of a matrix transformation is
+	ignored. Lookat and skew transformations are ignored, as by Node::getTransformationMatrix. Instance
+	nodes are not followed.*/
+	class FlatNodeHierarchy
+	{
+	public:
+		/** Number of elements of a matrix stored per node.*/
+		static const size_t MATRIX_ELEMENT_COUNT = 12;
+
+		/** Parent index of root nodes.*/
+		static const size_t INVALID_INDEX;
+
+	private:
+		/** The nodes, level by level.*/
+		std::vector<const Node*> mNodes;
+
+		/** The index of the parent of each node in mNodes, INVALID_INDEX for root nodes.*/
+		std::vector<size_t> mParentIndices;
+
+		/** The index of the first node of each level, followed by the number of nodes.*/
+		std::vector<size_t> mLevelOffsets;
+
+		/** The elements of the local matrices. Element (row, column) of the matrix of node i is
+		mLocalMatrices[4*row + column][i].*/
+		std::vector<double> mLocalMatrices[MATRIX_ELEMENT_COUNT];
+
+		/** The elements of the world matrices, in the same layout as mLocalMatrices.*/
+		std::vector<double> mWorldMatrices[MATRIX_ELEMENT_COUNT];
+
+	public:
+		FlatNodeHierarchy();
+
+		~FlatNodeHierarchy();
+
+		/** Flattens the node hierarchy of @a visualScene. The matrices are not calculated.*/
+		void build( const VisualScene& visualScene );
+
+		/** Flattens the hierarchies below @a rootNodes. The matrices are not calculated.*/
+		void build( const NodePointerArray& rootNodes );
+
+		/** Calculates the local matrices of all nodes from their transformations.*/
+		void calculateLocalMatrices();
+
+		/** Calculates the world matrices of all nodes from their local matrices. Must be called after
+		calculateLocalMatrices. If only the local matrices of some nodes have changed, e.g. by an animation,
+		calling this method is sufficient.*/
+		void calculateWorldMatrices();
+
+		/** Calculates the local and the world matrices of all nodes.*/
+		void calculateMatrices() { calculateLocalMatrices(); calculateWorldMatrices(); }
+
+		/** Returns the number of nodes.*/
+		size_t getNodeCount() const { return mNodes.size(); }
+
+		/** Returns the node with index @a nodeIndex.*/
+		const Node* getNode( size_t nodeIndex ) const { return mNodes[nodeIndex]; }
+
+		/** Returns the index of the parent of the node with index @a nodeIndex or INVALID_INDEX, if it is
+		a root node.*/
+		size_t getParentIndex( size_t nodeIndex ) const { return mParentIndices[nodeIndex]; }
+
+		/** Returns the number of levels of the hierarchy.*/
+		size_t getLevelCount() const { return mLevelOffsets.empty() ? 0 : mLevelOffsets.size() - 1; }
+
+		/** Returns the index of the first node of level @a level. The nodes of the level end at the
+		first node of the next level, getLevelOffset( getLevelCount() ) is the number of nodes.*/
+		size_t getLevelOffset( size_t level ) const { return mLevelOffsets[level]; }
+
+		/** Returns the array with the element ( @a row, @a column ) of the local matrices of all nodes.
+		@a row must be less than three.*/
+		const double* getLocalMatrixElements( size_t row, size_t column ) const { return getElements( mLocalMatrices, row, column ); }
+
+		/** Returns the array with the element ( @a row, @a column ) of the world matrices of all nodes.
+		@a row must be less than three.*/
+		const double* getWorldMatrixElements( size_t row, size_t column ) const { return getElements( mWorldMatrices, row, column ); }
+
+		/** Returns the local matrix of the node with index @a nodeIndex in @a matrix.*/
+		void getLocalMatrix( size_t nodeIndex, COLLADABU::Math::Matrix4& matrix ) const { getMatrix( mLocalMatrices, nodeIndex, matrix ); }
+
+		/** Returns the world matrix of the node with index @a nodeIndex in @a matrix.*/
+		void getWorldMatrix( size_t nodeIndex, COLLADABU::Math::Matrix4& matrix ) const { getMatrix( mWorldMatrices, nodeIndex, matrix ); }
+
+		/** Removes all nodes. The memory is kept.*/
+		void clear();
+
+	private:
+        /** Disable default copy ctor. */
+		FlatNodeHierarchy( const FlatNodeHierarchy& pre );
+        /** Disable default assignment operator. */
+		const FlatNodeHierarchy& operator= ( const FlatNodeHierarchy& pre );
+
+		/** Resizes the element arrays of the matrices to the number of nodes.*/
+		void resizeMatrices();
+
+		/** Calculates the local matrix of the node with index @a nodeIndex.*/
+		void calculateLocalMatrix( size_t nodeIndex );
+
+		static const double* getElements( const std::vector<double>* matrices, size_t row, size_t column )
+		{
+			const std::vector<double>& elements = matrices[4*row + column];
+			return elements.empty() ? 0 : &elements[0];
+		}
+
+		static void getMatrix( const std::vector<double>* matrices, size_t nodeIndex, COLLADABU::Math::Matrix4& matrix );
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_FLATNODEHIERARCHY_H__
@@ -0,0 +1,100 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_HEXBINARYDATA_H__
+#define __COLLADAFW_HEXBINARYDATA_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+
+	/** Binary data encoded as a sequence of hexadecimal octets, separated by white space, like the
+	embedded image data of an image. The text is not decoded while the document is loaded, only if
+	decode() is called.
+	If the document is resident in memory, the text is not copied either, but referenced as byte range
+	of the document, see setReferencedText(). The referenced text is only valid until the document has
+	been parsed, i.e. a writer that keeps the data longer than the IWriter call that received it,
+	has to call copyReferencedText() or decode it in that call. Copies of a HexBinaryData refer to the
+	same text.*/
+	class HexBinaryData
+	{
+	private:
+		/** The text in the document, if it is referenced, otherwise 0.*/
+		const char* mReferencedText;
+
+		/** The length of the referenced text.*/
+		size_t mReferencedTextLength;
+
+		/** The offset of the referenced text in the document.*/
+		size_t mOffset;
+
+		/** The copied text, if it is not referenced.*/
+		String mText;
+
+	public:
+		/** Constructor. Creates empty data.*/
+		HexBinaryData();
+
+		~HexBinaryData();
+
+		/** Refers to the @a length bytes at @a text, that start at @a offset in the document, without
+		copying them. Replaces the previous text.*/
+		void setReferencedText( const char* text, size_t length, size_t offset );
+
+		/** Appends a copy of the @a length bytes at @a text. A referenced text is copied first.*/
+		void appendText( const char* text, size_t length );
+
+		/** Copies the referenced text, so it remains valid after the document has been parsed.*/
+		void copyReferencedText();
+
+		/** Removes the text.*/
+		void clear();
+
+		/** Returns true, if the text is referenced as byte range of the document.*/
+		bool isReferenced() const { return mReferencedText != 0; }
+
+		/** Returns the offset of the referenced text in the document. Only valid, if isReferenced()
+		returns true.*/
+		size_t getOffset() const { return mOffset; }
+
+		/** Returns the encoded text. It is not null terminated.*/
+		const char* getText() const { return mReferencedText ? mReferencedText : mText.data(); }
+
+		/** Returns the length of the encoded text.*/
+		size_t getTextLength() const { return mReferencedText ? mReferencedTextLength : mText.length(); }
+
+		/** Returns true, if there is no text.*/
+		bool empty() const { return getTextLength() == 0; }
+
+		/** Returns the greatest number of bytes the text decodes to, i.e. the number of bytes if it
+		does not contain white space.*/
+		size_t getMaxDecodedSize() const { return getTextLength() / 2; }
+
+		/** Decodes the text and replaces the contents of @a bytes with the result.
+		@return False, if the text contains a character that is neither a hexadecimal digit nor white
+		space, or a sequence of hexadecimal digits of odd length. @a bytes holds the octets in front of
+		it in that case.*/
+		bool decode( std::vector<unsigned char>& bytes ) const;
+
+		/** Decodes the @a length characters of hexadecimal octets, separated by white space, at @a text
+		into @a bytes, that must have room for @a length / 2 bytes.
+		@param decodedSize Receives the number of bytes written to @a bytes.
+		@return False, if the text is not valid, see decode().*/
+		static bool decode( const char* text, size_t length, unsigned char* bytes, size_t& decodedSize );
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_HEXBINARYDATA_H__
@@ -0,0 +1,76 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADAFramework.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_ISTREAMINGWRITER_H__
+#define __COLLADAFW_ISTREAMINGWRITER_H__
+
+#include "COLLADAFWPrerequisites.h"
+#include "COLLADAFWIWriter.h"
+
+
+namespace COLLADAFW
+{
+	class Mesh;
+	class MeshPrimitive;
+
+
+	/** Writer that can receive meshes in blocks, while they are loaded. A loader passes a mesh the writer
+	has accepted in startMesh() piece by piece to writeMeshPrimitive() and calls finishMesh() at the end of
+	the mesh, instead of passing the complete mesh to writeGeometry(). Only the indices of the primitives
+	parsed since the previous block are held in memory, which allows to handle meshes with huge primitives.
+
+	The mesh passed to all three methods is the same object. Its vertex data (positions, normals, ...)
+	contains the values of all sources referenced by the primitives passed so far. Sources are appended,
+	when a primitive uses them for the first time. Values are never removed or reordered, i.e. the indices
+	of all blocks refer to the same vertex data. The mesh does not contain any mesh primitives.*/
+	class IStreamingWriter : public IWriter
+	{
+	public:
+
+        /** Constructor. */
+        IStreamingWriter() {};
+
+        /** Destructor. */
+        virtual ~IStreamingWriter() {};
+
+		/** This method is called when the loader starts to load a mesh. @a mesh contains the unique id, the
+		name and the original id of the mesh only.
+		@return True, if the mesh should be passed in blocks to writeMeshPrimitive() and finishMesh(). False,
+		if the mesh should be passed to writeGeometry(), once it has been loaded completely.*/
+		virtual bool startMesh( const Mesh* mesh ) = 0;
+
+		/** When this method is called, the writer must write the next block of a mesh primitive. The block
+		contains complete faces only, i.e. @a meshPrimitive contains the face count, the index lists and,
+		for primitives that group vertices, the vertex counts of the faces in the block. A mesh primitive
+		larger than a block is passed in several blocks, all with the same unique id.
+		Blocks are passed before the end of the mesh primitive has been parsed. If it turns out to be
+		invalid, e.g. a polylist with less indices than required by its vcount, the remaining faces are not
+		passed and the loader reports an error, but the blocks passed before are not withdrawn.
+		@param mesh The mesh started with startMesh().
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool writeMeshPrimitive( const Mesh* mesh, const MeshPrimitive* meshPrimitive ) = 0;
+
+		/** This method is called after the last block of the mesh started with startMesh() has been
+		passed. @a mesh contains the vertex data of all sources used by the mesh primitives.
+		@return The writer should return true, if writing succeeded, false otherwise.*/
+		virtual bool finishMesh( const Mesh* mesh ) = 0;
+
+    private:
+
+        /** Disable default copy ctor. */
+		IStreamingWriter ( const IStreamingWriter& pre );
+
+        /** Disable default assignment operator. */
+		const IStreamingWriter& operator= ( const IStreamingWriter& pre );
+
+	};
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_ISTREAMINGWRITER_H__
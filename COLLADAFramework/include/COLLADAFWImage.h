@@ -13,6 +13,7 @@
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWObject.h"
+#include "COLLADAFWHexBinaryData.h"
 
 #include "COLLADABUURI.h"
 
@@ -84,9 +85,8 @@ namespace COLLADAFW
 		COLLADABU::URI mImageURI;
 
 		/** Contains a sequence of hexadecimal encoded binary octets composing the embedded
-		image data.*/
-		// Disable until we really need it to avoid problems with copy/assignemnet operators
-		//CharacterArray mData;
+		image data. It is decoded on request, see HexBinaryData.*/
+		HexBinaryData mData;
 
 	public:
 
@@ -157,12 +157,12 @@ namespace COLLADAFW
 		void setImageURI( const COLLADABU::URI& imageURI ) { mImageURI = imageURI; }
 
 		/** Returns a sequence of hexadecimal encoded binary octets composing the embedded
-		image data.*/
-//		const CharacterArray& getData() const { return mData; }
+		image data. Its text may refer to the loaded document, see HexBinaryData.*/
+		const HexBinaryData& getData() const { return mData; }
 
 		/** Returns a sequence of hexadecimal encoded binary octets composing the embedded
-		image data.*/
-//		CharacterArray& getData() { return mData; }
+		image data. Its text may refer to the loaded document, see HexBinaryData.*/
+		HexBinaryData& getData() { return mData; }
 
 
 	};
@@ -44,6 +44,12 @@ namespace COLLADAFW
         {}*/
         virtual ~IndexList () {}
 
+		/** Index lists are allocated from the current Arena of the calling thread, if there is one.*/
+		static void* operator new( size_t size ) { return Arena::allocObject(size); }
+
+		/** Releases index lists allocated from the heap. Index lists of the current Arena are released with the arena.*/
+		static void operator delete( void* object ) { Arena::releaseObject(object); }
+
 		UIntValuesArray& getIndices () { return mIndices; }
 		const UIntValuesArray& getIndices () const { return mIndices; }
         unsigned int getIndex ( size_t index ) const { return mIndices [index]; }
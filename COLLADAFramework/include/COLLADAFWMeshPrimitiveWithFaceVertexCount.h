@@ -14,6 +14,8 @@
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWMeshPrimitive.h"
 
+#include <iostream>
+
 namespace COLLADAFW
 {
 
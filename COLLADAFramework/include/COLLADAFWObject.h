@@ -13,6 +13,7 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "COLLADAFWPrerequisites.h"
 #include "COLLADAFWUniqueId.h"
+#include "COLLADAFWArena.h"
 
 
 namespace COLLADAFW
@@ -25,6 +26,12 @@ namespace COLLADAFW
 	public:
 		virtual ~Object(){};
 
+		/** Objects are allocated from the current Arena of the calling thread, if there is one.*/
+		static void* operator new( size_t size ) { return Arena::allocObject(size); }
+
+		/** Releases objects allocated from the heap. Objects of the current Arena are released with the arena.*/
+		static void operator delete( void* object ) { Arena::releaseObject(object); }
+
 		/** Returns the class id of the object.*/
 		virtual ClassId getClassId() const =0;
 
@@ -0,0 +1,100 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADAFW_VERTEXWELDER_H__
+#define __COLLADAFW_VERTEXWELDER_H__
+
+#include "COLLADAFWPrerequisites.h"
+
+#include <vector>
+
+
+namespace COLLADAFW
+{
+
+	/** Merges the face corners of mesh primitives, that use the same combination of indices, into
+	one vertex. A face corner is identified by a fixed number of indices, e.g. its position, normal
+	and uv coordinate indices. Each distinct combination becomes a vertex of a unified vertex buffer,
+	in the order of first occurrence, and each face corner is replaced by the index of its vertex.
+	This is how multi-index COLLADA primitives are converted into single-index vertex and index
+	buffers.
+	The vertices are looked up in an open addressing hash table with linear probing, that stores
+	only vertex indices. Adding a face corner takes expected constant time. The slot of a vertex is
+	derived from its first index, such that face corners with close first indices, as consecutive
+	corners of a mesh mostly have, are looked up in close slots. If this leads to long probe
+	sequences, all indices are mixed into the hash instead.*/
+	class VertexWelder
+	{
+	private:
+		/** Number of indices that identify a vertex.*/
+		size_t mIndicesPerVertex;
+
+		/** The indices of all vertices, mIndicesPerVertex per vertex, in the order of the vertex indices.*/
+		std::vector<unsigned int> mVertices;
+
+		/** The hash table. Each slot holds a vertex index plus one, or zero, if the slot is empty. The
+		number of slots is a power of two and at least twice the number of vertices.*/
+		std::vector<unsigned int> mSlots;
+
+		/** True, if all indices of a vertex are mixed into its hash. False, if the first index
+		determines the position of the vertex in the table.*/
+		bool mMixAllIndices;
+
+	public:
+		/** Constructor.
+		@param indicesPerVertex The number of indices that identify a vertex.
+		@param expectedVertexCount The number of vertices the welder reserves memory for.*/
+		VertexWelder( size_t indicesPerVertex, size_t expectedVertexCount = 0 );
+
+		~VertexWelder();
+
+		/** Returns the number of indices that identify a vertex.*/
+		size_t getIndicesPerVertex() const { return mIndicesPerVertex; }
+
+		/** Reserves memory for @a vertexCount vertices.*/
+		void reserve( size_t vertexCount );
+
+		/** Returns the index of the vertex identified by the getIndicesPerVertex() indices at
+		@a indices. If there is no such vertex yet, it is added.*/
+		unsigned int addVertex( const unsigned int* indices );
+
+		/** Adds @a cornerCount face corners and writes the index of the vertex of each corner to
+		@a vertexIndices.
+		@param indexLists getIndicesPerVertex() lists of @a cornerCount indices each, e.g. the position,
+		normal and uv coordinate indices of a mesh primitive. A list might be 0, all its indices are
+		assumed to be zero then.*/
+		void addVertices( const unsigned int* const* indexLists, size_t cornerCount, unsigned int* vertexIndices );
+
+		/** Returns the number of vertices.*/
+		size_t getVertexCount() const { return mVertices.size() / mIndicesPerVertex; }
+
+		/** Returns the getIndicesPerVertex() indices of the vertex with index @a vertexIndex.*/
+		const unsigned int* getVertexIndices( size_t vertexIndex ) const { return &mVertices[vertexIndex * mIndicesPerVertex]; }
+
+		/** Removes all vertices. The memory is kept, the hash is derived from the first index again.*/
+		void clear();
+
+	private:
+        /** Disable default copy ctor. */
+		VertexWelder( const VertexWelder& pre );
+        /** Disable default assignment operator. */
+		const VertexWelder& operator= ( const VertexWelder& pre );
+
+		/** Returns the hash of the getIndicesPerVertex() indices at @a indices.*/
+		unsigned int calculateHash( const unsigned int* indices ) const;
+
+		/** Resizes the hash table to @a slotCount slots, a power of two, and reinserts all vertices.*/
+		void rehash( size_t slotCount );
+
+	};
+
+} // namespace COLLADAFW
+
+#endif // __COLLADAFW_VERTEXWELDER_H__
@@ -0,0 +1,181 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADAFramework.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWArena.h"
+
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace COLLADAFW
+{
+
+	/** The arena of each thread.*/
+	static thread_local Arena* currentArena = 0;
+
+	//------------------------------
+	static size_t alignSize( size_t size )
+	{
+		return (size + Arena::ALIGNMENT - 1) & ~(Arena::ALIGNMENT - 1);
+	}
+
+	//------------------------------
+	Arena::Arena( size_t blockSize )
+		: mCurrent(0)
+		, mEnd(0)
+		, mLastAllocation(0)
+		, mNextBlockSize(alignSize(blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE))
+	{
+	}
+
+	//------------------------------
+	Arena::~Arena()
+	{
+		if ( currentArena == this )
+			currentArena = 0;
+
+		BlockMap::const_iterator it = mBlocks.begin();
+		for ( ; it != mBlocks.end(); ++it )
+		{
+			free( (void*)it->first );
+		}
+	}
+
+	//------------------------------
+	void Arena::addBlock( size_t size )
+	{
+		size_t blockSize = mNextBlockSize;
+		if ( blockSize < size )
+			blockSize = size;
+		if ( mNextBlockSize < MAXIMUM_BLOCK_SIZE )
+			mNextBlockSize *= 2;
+
+		// malloc returns memory aligned for all fundamental types, which is sufficient for ALIGNMENT
+		char* block = (char*)malloc( blockSize );
+		if ( !block )
+			throw std::bad_alloc();
+
+		mBlocks[block] = block + blockSize;
+		mCurrent = block;
+		mEnd = block + blockSize;
+		mLastAllocation = 0;
+
+		mStatistics.blockCount++;
+		mStatistics.reservedBytes += blockSize;
+	}
+
+	//------------------------------
+	void* Arena::allocate( size_t size )
+	{
+		size = alignSize( size > 0 ? size : 1 );
+		if ( (size_t)(mEnd - mCurrent) < size )
+			addBlock( size );
+
+		mLastAllocation = mCurrent;
+		mCurrent += size;
+
+		mStatistics.allocationCount++;
+		mStatistics.allocatedBytes += size;
+		return mLastAllocation;
+	}
+
+	//------------------------------
+	void* Arena::reallocate( void* data, size_t size, size_t newSize )
+	{
+		if ( !data )
+			return allocate( newSize );
+
+		mStatistics.reallocationCount++;
+
+		size = alignSize( size > 0 ? size : 1 );
+		newSize = alignSize( newSize > 0 ? newSize : 1 );
+		if ( newSize <= size )
+			return data;
+
+		// The last allocation can grow until the end of the current block
+		if ( ((char*)data == mLastAllocation) && ((size_t)(mEnd - mLastAllocation) >= newSize) )
+		{
+			mCurrent = mLastAllocation + newSize;
+			mStatistics.allocatedBytes += newSize - size;
+			return data;
+		}
+
+		void* newData = allocate( newSize );
+		memcpy( newData, data, size );
+		mStatistics.abandonedBytes += size;
+		return newData;
+	}
+
+	//------------------------------
+	bool Arena::contains( const void* data ) const
+	{
+		const char* address = (const char*)data;
+		BlockMap::const_iterator it = mBlocks.upper_bound( address );
+		if ( it == mBlocks.begin() )
+			return false;
+		--it;
+		return address < it->second;
+	}
+
+	//------------------------------
+	void Arena::setCurrentArena( Arena* arena )
+	{
+		currentArena = arena;
+	}
+
+	//------------------------------
+	Arena* Arena::getCurrentArena()
+	{
+		return currentArena;
+	}
+
+	//------------------------------
+	void* Arena::allocObject( size_t size )
+	{
+		if ( currentArena )
+			return currentArena->allocate( size );
+		return ::operator new( size );
+	}
+
+	//------------------------------
+	void Arena::releaseObject( void* object )
+	{
+		if ( !object || (currentArena && currentArena->contains(object)) )
+			return;
+		::operator delete( object );
+	}
+
+	//------------------------------
+	void* Arena::allocMemory( size_t size )
+	{
+		if ( currentArena )
+			return currentArena->allocate( size );
+		return malloc( size );
+	}
+
+	//------------------------------
+	void* Arena::reallocMemory( void* data, size_t size, size_t newSize )
+	{
+		if ( currentArena && (!data || currentArena->contains(data)) )
+			return currentArena->reallocate( data, size, newSize );
+		return realloc( data, newSize );
+	}
+
+	//------------------------------
+	void Arena::releaseMemory( void* data )
+	{
+		if ( !data || (currentArena && currentArena->contains(data)) )
+			return;
+		free( data );
+	}
+
+} // namespace COLLADAFW
@@ -0,0 +1,296 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWEdgeBuilder.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWTrifans.h"
+#include "COLLADAFWTristrips.h"
+
+#include <algorithm>
+#include <thread>
+
+
+namespace COLLADAFW
+{
+
+	/** Marks a vertex, that has not been visited, or a group without edge index.*/
+	static const unsigned int UNASSIGNED = (unsigned int)-1;
+
+	//------------------------------
+	EdgeBuilder::EdgeBuilder()
+		: mThreadCount( 1 )
+	{
+	}
+
+	//------------------------------
+	EdgeBuilder::~EdgeBuilder()
+	{
+	}
+
+	//------------------------------
+	void EdgeBuilder::build( const Mesh* mesh )
+	{
+		clear();
+
+		const MeshPrimitiveArray& primitives = mesh->getMeshPrimitives();
+		size_t primitiveCount = primitives.getCount();
+
+		// the face edges of each primitive are written to their own range, the threads do not share memory
+		mPrimitiveOffsets.resize( primitiveCount + 1 );
+		mPrimitiveOffsets[0] = 0;
+		for ( size_t i = 0; i < primitiveCount; ++i )
+			mPrimitiveOffsets[i + 1] = mPrimitiveOffsets[i] + countFaceEdges( primitives[i] );
+
+		size_t faceEdgeCount = mPrimitiveOffsets[primitiveCount];
+		if ( faceEdgeCount == 0 )
+			return;
+		mStartIndices.resize( faceEdgeCount );
+		mEndIndices.resize( faceEdgeCount );
+
+		size_t threadCount = std::min( mThreadCount, primitiveCount );
+		std::vector<unsigned int> maxVertexIndices( std::max( threadCount, (size_t)1 ), 0 );
+		if ( threadCount < 2 )
+		{
+			collectFaceEdges( mesh, 0, 1, &maxVertexIndices[0] );
+		}
+		else
+		{
+			std::vector<std::thread> threads;
+			threads.reserve( threadCount );
+			for ( size_t i = 0; i < threadCount; ++i )
+			{
+				threads.push_back( std::thread( &EdgeBuilder::collectFaceEdges, this, mesh, i, threadCount, &maxVertexIndices[i] ) );
+			}
+			for ( size_t i = 0; i < threadCount; ++i )
+			{
+				threads[i].join();
+			}
+		}
+
+		unsigned int maxVertexIndex = *std::max_element( maxVertexIndices.begin(), maxVertexIndices.end() );
+		numberEdges( (size_t)maxVertexIndex + 1 );
+	}
+
+	//------------------------------
+	size_t EdgeBuilder::countFaceEdges( const MeshPrimitive* primitive )
+	{
+		size_t faceEdgeCount = 0;
+		switch ( primitive->getPrimitiveType() )
+		{
+		case MeshPrimitive::POLYGONS:
+		case MeshPrimitive::POLYLIST:
+		case MeshPrimitive::TRIANGLES:
+			{
+				size_t faceCount = primitive->getGroupedVertexElementsCount();
+				for ( size_t i = 0; i < faceCount; ++i )
+				{
+					// holes have negative vertex counts
+					int vertexCount = primitive->getGroupedVerticesVertexCount( i );
+					faceEdgeCount += (vertexCount < 0) ? -vertexCount : vertexCount;
+				}
+			}
+			break;
+		case MeshPrimitive::TRIANGLE_FANS:
+		case MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				const MeshPrimitiveWithFaceVertexCount<unsigned int>* triangles = (const MeshPrimitiveWithFaceVertexCount<unsigned int>*) primitive;
+				const MeshPrimitiveWithFaceVertexCount<unsigned int>::VertexCountArray& vertexCountArray = triangles->getGroupedVerticesVertexCountArray();
+				size_t groupCount = vertexCountArray.getCount();
+				for ( size_t i = 0; i < groupCount; ++i )
+				{
+					if ( vertexCountArray[i] >= 3 )
+						faceEdgeCount += 3 * (vertexCountArray[i] - 2);
+				}
+			}
+			break;
+		default:
+			break;
+		}
+		return faceEdgeCount;
+	}
+
+	//------------------------------
+	void EdgeBuilder::clear()
+	{
+		mEdges.clear();
+		mFaceEdgeIndices.clear();
+		mPrimitiveOffsets.assign( 1, 0 );
+		mStartIndices.clear();
+		mEndIndices.clear();
+	}
+
+	//------------------------------
+	void EdgeBuilder::collectFaceEdges( const Mesh* mesh, size_t first, size_t step, unsigned int* maxVertexIndex )
+	{
+		const MeshPrimitiveArray& primitives = mesh->getMeshPrimitives();
+		size_t primitiveCount = primitives.getCount();
+		unsigned int maxIndex = 0;
+		for ( size_t i = first; i < primitiveCount; i += step )
+		{
+			size_t offset = mPrimitiveOffsets[i];
+			if ( offset == mPrimitiveOffsets[i + 1] )
+				continue;
+			maxIndex = std::max( maxIndex, collectPrimitiveFaceEdges( primitives[i], &mStartIndices[offset], &mEndIndices[offset] ) );
+		}
+		*maxVertexIndex = maxIndex;
+	}
+
+	//------------------------------
+	unsigned int EdgeBuilder::collectPrimitiveFaceEdges( const MeshPrimitive* primitive, unsigned int* startIndices, unsigned int* endIndices )
+	{
+		const UIntValuesArray& positionIndices = primitive->getPositionIndices();
+		size_t faceEdgeIndex = 0;
+		size_t positionIndex = 0;
+
+		switch ( primitive->getPrimitiveType() )
+		{
+		case MeshPrimitive::POLYGONS:
+		case MeshPrimitive::POLYLIST:
+		case MeshPrimitive::TRIANGLES:
+			{
+				// the edges between consecutive vertices and the edge back to the first vertex
+				size_t faceCount = primitive->getGroupedVertexElementsCount();
+				for ( size_t i = 0; i < faceCount; ++i )
+				{
+					int vertexCount = primitive->getGroupedVerticesVertexCount( i );
+					if ( vertexCount < 0 )
+						vertexCount = -vertexCount;
+					if ( vertexCount == 0 )
+						continue;
+					const unsigned int* vertices = &positionIndices[positionIndex];
+					for ( int k = 0; k < vertexCount - 1; ++k, ++faceEdgeIndex )
+					{
+						startIndices[faceEdgeIndex] = vertices[k];
+						endIndices[faceEdgeIndex] = vertices[k + 1];
+					}
+					startIndices[faceEdgeIndex] = vertices[vertexCount - 1];
+					endIndices[faceEdgeIndex] = vertices[0];
+					++faceEdgeIndex;
+					positionIndex += vertexCount;
+				}
+			}
+			break;
+		case MeshPrimitive::TRIANGLE_FANS:
+			{
+				// the triangles share the first vertex of the fan
+				const Trifans* trifans = (const Trifans*) primitive;
+				const Trifans::VertexCountArray& vertexCountArray = trifans->getGroupedVerticesVertexCountArray();
+				size_t fanCount = vertexCountArray.getCount();
+				for ( size_t i = 0; i < fanCount; ++i )
+				{
+					unsigned int vertexCount = vertexCountArray[i];
+					const unsigned int* vertices = &positionIndices[positionIndex];
+					for ( unsigned int k = 1; k + 1 < vertexCount; ++k, faceEdgeIndex += 3 )
+					{
+						startIndices[faceEdgeIndex] = vertices[0];
+						endIndices[faceEdgeIndex] = vertices[k];
+						startIndices[faceEdgeIndex + 1] = vertices[k];
+						endIndices[faceEdgeIndex + 1] = vertices[k + 1];
+						startIndices[faceEdgeIndex + 2] = vertices[k + 1];
+						endIndices[faceEdgeIndex + 2] = vertices[0];
+					}
+					positionIndex += vertexCount;
+				}
+			}
+			break;
+		case MeshPrimitive::TRIANGLE_STRIPS:
+			{
+				// each triangle consists of three consecutive vertices of the strip
+				const Tristrips* tristrips = (const Tristrips*) primitive;
+				const Tristrips::VertexCountArray& vertexCountArray = tristrips->getGroupedVerticesVertexCountArray();
+				size_t stripCount = vertexCountArray.getCount();
+				for ( size_t i = 0; i < stripCount; ++i )
+				{
+					unsigned int vertexCount = vertexCountArray[i];
+					const unsigned int* vertices = &positionIndices[positionIndex];
+					for ( unsigned int k = 0; k + 2 < vertexCount; ++k, faceEdgeIndex += 3 )
+					{
+						startIndices[faceEdgeIndex] = vertices[k];
+						endIndices[faceEdgeIndex] = vertices[k + 1];
+						startIndices[faceEdgeIndex + 1] = vertices[k + 1];
+						endIndices[faceEdgeIndex + 1] = vertices[k + 2];
+						startIndices[faceEdgeIndex + 2] = vertices[k + 2];
+						endIndices[faceEdgeIndex + 2] = vertices[k];
+					}
+					positionIndex += vertexCount;
+				}
+			}
+			break;
+		default:
+			break;
+		}
+
+		unsigned int maxVertexIndex = 0;
+		for ( size_t i = 0; i < faceEdgeIndex; ++i )
+			maxVertexIndex = std::max( maxVertexIndex, std::max(startIndices[i], endIndices[i]) );
+		return maxVertexIndex;
+	}
+
+	//------------------------------
+	void EdgeBuilder::numberEdges( size_t vertexCount )
+	{
+		size_t faceEdgeCount = mStartIndices.size();
+
+		// counting sort of the face edges by their smaller vertex index
+		mBucketOffsets.assign( vertexCount + 1, 0 );
+		for ( size_t i = 0; i < faceEdgeCount; ++i )
+			++mBucketOffsets[std::min( mStartIndices[i], mEndIndices[i] ) + 1];
+		for ( size_t v = 0; v < vertexCount; ++v )
+			mBucketOffsets[v + 1] += mBucketOffsets[v];
+
+		mSortedFaceEdges.resize( faceEdgeCount );
+		for ( size_t i = 0; i < faceEdgeCount; ++i )
+			mSortedFaceEdges[mBucketOffsets[std::min( mStartIndices[i], mEndIndices[i] )]++] = (unsigned int)i;
+
+		// the face edges with the same smaller vertex index are adjacent now, those with the same
+		// greater vertex index form a group. The greater vertex is marked with the smaller one.
+		mVertexMarks.assign( vertexCount, UNASSIGNED );
+		mVertexEdges.resize( vertexCount );
+		mFaceEdgeGroups.resize( faceEdgeCount );
+		unsigned int groupCount = 0;
+		size_t begin = 0;
+		for ( size_t v = 0; v < vertexCount; ++v )
+		{
+			size_t end = mBucketOffsets[v];
+			for ( size_t i = begin; i < end; ++i )
+			{
+				unsigned int faceEdge = mSortedFaceEdges[i];
+				unsigned int greaterIndex = std::max( mStartIndices[faceEdge], mEndIndices[faceEdge] );
+				if ( mVertexMarks[greaterIndex] != (unsigned int)v )
+				{
+					mVertexMarks[greaterIndex] = (unsigned int)v;
+					mVertexEdges[greaterIndex] = groupCount++;
+				}
+				mFaceEdgeGroups[faceEdge] = mVertexEdges[greaterIndex];
+			}
+			begin = end;
+		}
+
+		// number the groups in the order of their first face edge
+		mGroupEdges.assign( groupCount, UNASSIGNED );
+		mEdges.reserve( groupCount );
+		mFaceEdgeIndices.resize( faceEdgeCount );
+		for ( size_t i = 0; i < faceEdgeCount; ++i )
+		{
+			int startIndex = (int)mStartIndices[i];
+			int endIndex = (int)mEndIndices[i];
+			unsigned int& edgeIndex = mGroupEdges[mFaceEdgeGroups[i]];
+			if ( edgeIndex == UNASSIGNED )
+			{
+				edgeIndex = (unsigned int)mEdges.size();
+				mEdges.push_back( Edge( startIndex, endIndex ) );
+			}
+			// the same direction as Edge::isReverse()
+			mFaceEdgeIndices[i] = (startIndex < endIndex) ? (int)edgeIndex : -( (int)edgeIndex + 1 );
+		}
+	}
+
+} // namespace COLLADAFW
@@ -0,0 +1,282 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWFlatNodeHierarchy.h"
+#include "COLLADAFWVisualScene.h"
+#include "COLLADAFWRotate.h"
+#include "COLLADAFWTranslate.h"
+#include "COLLADAFWScale.h"
+#include "COLLADAFWMatrix.h"
+
+#include "Math/COLLADABUMathUtils.h"
+
+#include <math.h>
+#include <algorithm>
+
+
+namespace COLLADAFW
+{
+
+	const size_t FlatNodeHierarchy::INVALID_INDEX = (size_t)-1;
+
+	//------------------------------
+	FlatNodeHierarchy::FlatNodeHierarchy()
+	{
+	}
+
+	//------------------------------
+	FlatNodeHierarchy::~FlatNodeHierarchy()
+	{
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::clear()
+	{
+		mNodes.clear();
+		mParentIndices.clear();
+		mLevelOffsets.clear();
+		for ( size_t k = 0; k < MATRIX_ELEMENT_COUNT; ++k )
+		{
+			mLocalMatrices[k].clear();
+			mWorldMatrices[k].clear();
+		}
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::build( const VisualScene& visualScene )
+	{
+		build( visualScene.getRootNodes() );
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::build( const NodePointerArray& rootNodes )
+	{
+		clear();
+
+		size_t rootCount = rootNodes.getCount();
+		for ( size_t i = 0; i < rootCount; ++i )
+		{
+			mNodes.push_back( rootNodes[i] );
+		}
+		mParentIndices.resize( rootCount, INVALID_INDEX );
+
+		// the children of the nodes of a level form the next level
+		size_t levelBegin = 0;
+		mLevelOffsets.push_back( levelBegin );
+		while ( levelBegin < mNodes.size() )
+		{
+			size_t levelEnd = mNodes.size();
+			for ( size_t i = levelBegin; i < levelEnd; ++i )
+			{
+				const NodePointerArray& childNodes = mNodes[i]->getChildNodes();
+				for ( size_t j = 0, count = childNodes.getCount(); j < count; ++j )
+				{
+					mNodes.push_back( childNodes[j] );
+					mParentIndices.push_back( i );
+				}
+			}
+			mLevelOffsets.push_back( levelEnd );
+			levelBegin = levelEnd;
+		}
+		if ( mNodes.empty() )
+		{
+			mLevelOffsets.clear();
+		}
+
+		resizeMatrices();
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::resizeMatrices()
+	{
+		size_t nodeCount = mNodes.size();
+		for ( size_t k = 0; k < MATRIX_ELEMENT_COUNT; ++k )
+		{
+			mLocalMatrices[k].resize( nodeCount );
+			mWorldMatrices[k].resize( nodeCount );
+		}
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::calculateLocalMatrices()
+	{
+		for ( size_t i = 0, count = mNodes.size(); i < count; ++i )
+		{
+			calculateLocalMatrix( i );
+		}
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::calculateLocalMatrix( size_t nodeIndex )
+	{
+		// the upper three rows of the matrix, the transformations are multiplied from the right
+		double m[3][4] = { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 } };
+
+		const TransformationPointerArray& transformations = mNodes[nodeIndex]->getTransformations();
+		for ( size_t t = 0, count = transformations.getCount(); t < count; ++t )
+		{
+			const Transformation* transformation = transformations[t];
+			switch ( transformation->getTransformationType() )
+			{
+			case Transformation::ROTATE:
+				{
+					const Rotate* rotate = (const Rotate*)transformation;
+					COLLADABU::Math::Vector3 axis = rotate->getRotationAxis();
+					axis.normalise();
+
+					// the rotation matrix of the quaternion, as calculated by Quaternion::toRotationMatrix
+					double halfAngle = 0.5 * COLLADABU::Math::Utils::degToRad( rotate->getRotationAngle() );
+					double s = sin( halfAngle );
+					double w = cos( halfAngle );
+					double x = s * axis.x;
+					double y = s * axis.y;
+					double z = s * axis.z;
+					double tx = 2.0 * x;
+					double ty = 2.0 * y;
+					double tz = 2.0 * z;
+					double r[3][3] =
+					{
+						{ 1.0 - ( ty * y + tz * z ), ty * x - tz * w, tz * x + ty * w },
+						{ ty * x + tz * w, 1.0 - ( tx * x + tz * z ), tz * y - tx * w },
+						{ tz * x - ty * w, tz * y + tx * w, 1.0 - ( tx * x + ty * y ) }
+					};
+
+					for ( int row = 0; row < 3; ++row )
+					{
+						double m0 = m[row][0];
+						double m1 = m[row][1];
+						double m2 = m[row][2];
+						m[row][0] = m0 * r[0][0] + m1 * r[1][0] + m2 * r[2][0];
+						m[row][1] = m0 * r[0][1] + m1 * r[1][1] + m2 * r[2][1];
+						m[row][2] = m0 * r[0][2] + m1 * r[1][2] + m2 * r[2][2];
+					}
+					break;
+				}
+			case Transformation::TRANSLATE:
+				{
+					const COLLADABU::Math::Vector3& translation = ((const Translate*)transformation)->getTranslation();
+					for ( int row = 0; row < 3; ++row )
+					{
+						m[row][3] = m[row][0] * translation.x + m[row][1] * translation.y + m[row][2] * translation.z + m[row][3];
+					}
+					break;
+				}
+			case Transformation::SCALE:
+				{
+					const COLLADABU::Math::Vector3& scale = ((const Scale*)transformation)->getScale();
+					for ( int row = 0; row < 3; ++row )
+					{
+						m[row][0] *= scale.x;
+						m[row][1] *= scale.y;
+						m[row][2] *= scale.z;
+					}
+					break;
+				}
+			case Transformation::MATRIX:
+				{
+					const COLLADABU::Math::Matrix4& matrix = ((const Matrix*)transformation)->getMatrix();
+					for ( int row = 0; row < 3; ++row )
+					{
+						double m0 = m[row][0];
+						double m1 = m[row][1];
+						double m2 = m[row][2];
+						double m3 = m[row][3];
+						for ( int column = 0; column < 4; ++column )
+						{
+							m[row][column] = m0 * matrix.getElement(0, column) + m1 * matrix.getElement(1, column) + m2 * matrix.getElement(2, column);
+						}
+						m[row][3] += m3;
+					}
+					break;
+				}
+			case Transformation::LOOKAT:
+				break; /** @TODO unhandled case */
+			case Transformation::SKEW:
+				break; /** @TODO unhandled case */
+			}
+		}
+
+		for ( size_t k = 0; k < MATRIX_ELEMENT_COUNT; ++k )
+		{
+			mLocalMatrices[k][nodeIndex] = m[k / 4][k % 4];
+		}
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::calculateWorldMatrices()
+	{
+		size_t levelCount = getLevelCount();
+		if ( levelCount == 0 )
+		{
+			return;
+		}
+
+		// the world matrices of the root nodes are their local matrices
+		size_t rootCount = mLevelOffsets[1];
+		for ( size_t k = 0; k < MATRIX_ELEMENT_COUNT; ++k )
+		{
+			std::copy( mLocalMatrices[k].begin(), mLocalMatrices[k].begin() + rootCount, mWorldMatrices[k].begin() );
+		}
+
+		const size_t* parents = &mParentIndices[0];
+		const double* l00 = &mLocalMatrices[0][0];
+		const double* l01 = &mLocalMatrices[1][0];
+		const double* l02 = &mLocalMatrices[2][0];
+		const double* l03 = &mLocalMatrices[3][0];
+		const double* l10 = &mLocalMatrices[4][0];
+		const double* l11 = &mLocalMatrices[5][0];
+		const double* l12 = &mLocalMatrices[6][0];
+		const double* l13 = &mLocalMatrices[7][0];
+		const double* l20 = &mLocalMatrices[8][0];
+		const double* l21 = &mLocalMatrices[9][0];
+		const double* l22 = &mLocalMatrices[10][0];
+		const double* l23 = &mLocalMatrices[11][0];
+
+		// the parents of the nodes of a level are in the previous level, such that the nodes of a level
+		// do not depend on each other
+		for ( size_t level = 1; level < levelCount; ++level )
+		{
+			size_t levelBegin = mLevelOffsets[level];
+			size_t levelEnd = mLevelOffsets[level + 1];
+			for ( size_t row = 0; row < 3; ++row )
+			{
+				// one row of the world matrices at a time, to keep the number of streams small
+				double* w0 = &mWorldMatrices[4*row][0];
+				double* w1 = &mWorldMatrices[4*row + 1][0];
+				double* w2 = &mWorldMatrices[4*row + 2][0];
+				double* w3 = &mWorldMatrices[4*row + 3][0];
+				for ( size_t i = levelBegin; i < levelEnd; ++i )
+				{
+					size_t p = parents[i];
+					double p0 = w0[p];
+					double p1 = w1[p];
+					double p2 = w2[p];
+					double p3 = w3[p];
+					w0[i] = p0 * l00[i] + p1 * l10[i] + p2 * l20[i];
+					w1[i] = p0 * l01[i] + p1 * l11[i] + p2 * l21[i];
+					w2[i] = p0 * l02[i] + p1 * l12[i] + p2 * l22[i];
+					w3[i] = p0 * l03[i] + p1 * l13[i] + p2 * l23[i] + p3;
+				}
+			}
+		}
+	}
+
+	//------------------------------
+	void FlatNodeHierarchy::getMatrix( const std::vector<double>* matrices, size_t nodeIndex, COLLADABU::Math::Matrix4& matrix )
+	{
+		matrix.setAllElements(
+			matrices[0][nodeIndex], matrices[1][nodeIndex], matrices[2][nodeIndex], matrices[3][nodeIndex],
+			matrices[4][nodeIndex], matrices[5][nodeIndex], matrices[6][nodeIndex], matrices[7][nodeIndex],
+			matrices[8][nodeIndex], matrices[9][nodeIndex], matrices[10][nodeIndex], matrices[11][nodeIndex],
+			0, 0, 0, 1 );
+	}
+
+} // namespace COLLADAFW
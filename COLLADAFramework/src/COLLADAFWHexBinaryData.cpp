@@ -0,0 +1,189 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWHexBinaryData.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#	define COLLADAFW_SIMD_SSE2
+#	include <emmintrin.h>
+#endif
+
+
+namespace COLLADAFW
+{
+
+	/** Returns true, if @a c is white space in a list of octets.*/
+	static inline bool isWhiteSpace( unsigned char c )
+	{
+		return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+	}
+
+	/** Returns the value of the hexadecimal digit @a c, or -1 if it is not a hexadecimal digit.*/
+	static inline int hexDigitValue( unsigned char c )
+	{
+		unsigned int digit = (unsigned int)c - '0';
+		if ( digit < 10 )
+			return (int)digit;
+		unsigned int letter = (unsigned int)(c | 0x20) - 'a';
+		if ( letter < 6 )
+			return (int)letter + 10;
+		return -1;
+	}
+
+#if defined(COLLADAFW_SIMD_SSE2)
+
+	/** Converts the 16 characters in @a chunk into their digit values. @a valid receives 0xFF for each
+	character that is a hexadecimal digit.*/
+	static inline __m128i hexDigitValuesSSE2( __m128i chunk, __m128i& valid )
+	{
+		// the differences to '0' and 'a' are in range for digits and letters only, upper case letters
+		// become lower case by setting bit 5
+		__m128i digits = _mm_sub_epi8( chunk, _mm_set1_epi8('0') );
+		__m128i letters = _mm_sub_epi8( _mm_or_si128(chunk, _mm_set1_epi8(0x20)), _mm_set1_epi8('a') );
+		__m128i isDigit = _mm_and_si128( _mm_cmpgt_epi8(digits, _mm_set1_epi8(-1)), _mm_cmplt_epi8(digits, _mm_set1_epi8(10)) );
+		__m128i isLetter = _mm_and_si128( _mm_cmpgt_epi8(letters, _mm_set1_epi8(-1)), _mm_cmplt_epi8(letters, _mm_set1_epi8(6)) );
+		valid = _mm_or_si128( isDigit, isLetter );
+		return _mm_or_si128( _mm_and_si128(isDigit, digits), _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))) );
+	}
+
+	/** Combines the digit values of 8 pairs of characters into 8 octets, one in each 16 bit lane.*/
+	static inline __m128i octetsSSE2( __m128i digitValues )
+	{
+		// the first digit of a pair is the low byte of a lane and the high nibble of the octet
+		__m128i highNibbles = _mm_slli_epi16( _mm_and_si128(digitValues, _mm_set1_epi16(0x00FF)), 4 );
+		__m128i lowNibbles = _mm_srli_epi16( digitValues, 8 );
+		return _mm_or_si128( highNibbles, lowNibbles );
+	}
+
+	/** Decodes blocks of 32 hexadecimal digits at @a text into 16 octets each, as long as the blocks
+	do not contain other characters. Returns the position behind the last decoded block.*/
+	static inline const unsigned char* decodeSSE2( const unsigned char* text, const unsigned char* textEnd, unsigned char*& bytes )
+	{
+		while ( textEnd - text >= 32 )
+		{
+			__m128i valid0;
+			__m128i valid1;
+			__m128i digitValues0 = hexDigitValuesSSE2( _mm_loadu_si128((const __m128i*)text), valid0 );
+			__m128i digitValues1 = hexDigitValuesSSE2( _mm_loadu_si128((const __m128i*)(text + 16)), valid1 );
+			if ( _mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF )
+				break;
+			_mm_storeu_si128( (__m128i*)bytes, _mm_packus_epi16(octetsSSE2(digitValues0), octetsSSE2(digitValues1)) );
+			text += 32;
+			bytes += 16;
+		}
+		return text;
+	}
+
+#endif // COLLADAFW_SIMD_SSE2
+
+	//------------------------------
+	HexBinaryData::HexBinaryData()
+		: mReferencedText( 0 )
+		, mReferencedTextLength( 0 )
+		, mOffset( 0 )
+	{
+	}
+
+	//------------------------------
+	HexBinaryData::~HexBinaryData()
+	{
+	}
+
+	//------------------------------
+	void HexBinaryData::setReferencedText( const char* text, size_t length, size_t offset )
+	{
+		mText.clear();
+		mReferencedText = text;
+		mReferencedTextLength = length;
+		mOffset = offset;
+	}
+
+	//------------------------------
+	void HexBinaryData::appendText( const char* text, size_t length )
+	{
+		copyReferencedText();
+		mText.append( text, length );
+	}
+
+	//------------------------------
+	void HexBinaryData::copyReferencedText()
+	{
+		if ( !mReferencedText )
+			return;
+		mText.assign( mReferencedText, mReferencedTextLength );
+		mReferencedText = 0;
+		mReferencedTextLength = 0;
+		mOffset = 0;
+	}
+
+	//------------------------------
+	void HexBinaryData::clear()
+	{
+		mText.clear();
+		mReferencedText = 0;
+		mReferencedTextLength = 0;
+		mOffset = 0;
+	}
+
+	//------------------------------
+	bool HexBinaryData::decode( std::vector<unsigned char>& bytes ) const
+	{
+		// a text shorter than two characters does not contain an octet, nothing is written
+		bytes.resize( getMaxDecodedSize() );
+		size_t decodedSize = 0;
+		bool success = decode( getText(), getTextLength(), bytes.empty() ? 0 : &bytes[0], decodedSize );
+		bytes.resize( decodedSize );
+		return success;
+	}
+
+	//------------------------------
+	bool HexBinaryData::decode( const char* text, size_t length, unsigned char* bytes, size_t& decodedSize )
+	{
+		const unsigned char* position = (const unsigned char*)text;
+		const unsigned char* textEnd = position + length;
+		unsigned char* bytesPosition = bytes;
+		bool success = true;
+
+		while ( position != textEnd )
+		{
+			if ( isWhiteSpace(*position) )
+			{
+				++position;
+				continue;
+			}
+
+#if defined(COLLADAFW_SIMD_SSE2)
+			// the octets start at the beginning of the sequence, the blocks keep the pairs aligned
+			position = decodeSSE2( position, textEnd, bytesPosition );
+#endif
+
+			// the remaining octets of the sequence
+			while ( (position != textEnd) && !isWhiteSpace(*position) )
+			{
+				int high = hexDigitValue( *position );
+				int low = (textEnd - position >= 2) ? hexDigitValue( position[1] ) : -1;
+				if ( (high < 0) || (low < 0) )
+				{
+					success = false;
+					break;
+				}
+				*bytesPosition++ = (unsigned char)((high << 4) | low);
+				position += 2;
+			}
+			if ( !success )
+				break;
+		}
+
+		decodedSize = (size_t)(bytesPosition - bytes);
+		return success;
+	}
+
+} // namespace COLLADAFW
@@ -0,0 +1,157 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADAFramework.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADAFWStableHeaders.h"
+#include "COLLADAFWVertexWelder.h"
+
+#include <algorithm>
+
+
+namespace COLLADAFW
+{
+
+	/** The number of slots of the hash table, when the first vertex is added.*/
+	static const size_t MIN_SLOT_COUNT = 64;
+
+	/** The number of occupied slots probed, before all indices are mixed into the hash.*/
+	static const size_t MAX_PROBE_LENGTH = 32;
+
+	//------------------------------
+	VertexWelder::VertexWelder( size_t indicesPerVertex, size_t expectedVertexCount /*= 0*/ )
+		: mIndicesPerVertex( indicesPerVertex > 0 ? indicesPerVertex : 1 )
+		, mMixAllIndices( false )
+	{
+		reserve( expectedVertexCount );
+	}
+
+	//------------------------------
+	VertexWelder::~VertexWelder()
+	{
+	}
+
+	//------------------------------
+	void VertexWelder::reserve( size_t vertexCount )
+	{
+		if ( vertexCount == 0 )
+			return;
+
+		mVertices.reserve( vertexCount * mIndicesPerVertex );
+
+		size_t slotCount = MIN_SLOT_COUNT;
+		while ( slotCount < 2 * vertexCount )
+			slotCount *= 2;
+		if ( slotCount > mSlots.size() )
+			rehash( slotCount );
+	}
+
+	//------------------------------
+	unsigned int VertexWelder::addVertex( const unsigned int* indices )
+	{
+		size_t vertexCount = getVertexCount();
+
+		// keep the load factor at most one half, such that the probe sequences stay short
+		if ( 2 * (vertexCount + 1) > mSlots.size() )
+			rehash( mSlots.empty() ? MIN_SLOT_COUNT : 2 * mSlots.size() );
+
+		size_t mask = mSlots.size() - 1;
+		size_t slot = calculateHash( indices ) & mask;
+		for ( size_t probeLength = 0; ; ++probeLength )
+		{
+			unsigned int entry = mSlots[slot];
+			if ( entry == 0 )
+			{
+				mSlots[slot] = (unsigned int)vertexCount + 1;
+				mVertices.insert( mVertices.end(), indices, indices + mIndicesPerVertex );
+				return (unsigned int)vertexCount;
+			}
+
+			const unsigned int* vertex = &mVertices[(entry - 1) * mIndicesPerVertex];
+			size_t i = 0;
+			while ( (i < mIndicesPerVertex) && (vertex[i] == indices[i]) )
+				++i;
+			if ( i == mIndicesPerVertex )
+				return entry - 1;
+
+			// many vertices share first indices that are close or map to the same slots
+			if ( (probeLength == MAX_PROBE_LENGTH) && !mMixAllIndices )
+			{
+				mMixAllIndices = true;
+				rehash( mSlots.size() );
+				return addVertex( indices );
+			}
+
+			slot = (slot + 1) & mask;
+		}
+	}
+
+	//------------------------------
+	void VertexWelder::addVertices( const unsigned int* const* indexLists, size_t cornerCount, unsigned int* vertexIndices )
+	{
+		std::vector<unsigned int> indices( mIndicesPerVertex, 0 );
+		for ( size_t corner = 0; corner < cornerCount; ++corner )
+		{
+			for ( size_t i = 0; i < mIndicesPerVertex; ++i )
+			{
+				const unsigned int* indexList = indexLists[i];
+				if ( indexList )
+					indices[i] = indexList[corner];
+			}
+			vertexIndices[corner] = addVertex( &indices[0] );
+		}
+	}
+
+	//------------------------------
+	void VertexWelder::clear()
+	{
+		mVertices.clear();
+		std::fill( mSlots.begin(), mSlots.end(), 0u );
+		mMixAllIndices = false;
+	}
+
+	//------------------------------
+	unsigned int VertexWelder::calculateHash( const unsigned int* indices ) const
+	{
+		unsigned int hash = 2166136261u;
+		for ( size_t i = mMixAllIndices ? 0 : 1; i < mIndicesPerVertex; ++i )
+		{
+			hash = (hash ^ indices[i]) * 16777619u;
+		}
+
+		// the table is indexed by the low bits, mix the high bits into them
+		hash ^= hash >> 16;
+		hash *= 0x85ebca6bu;
+		hash ^= hash >> 13;
+		hash *= 0xc2b2ae35u;
+		hash ^= hash >> 16;
+
+		if ( mMixAllIndices )
+			return hash;
+
+		// two slots per first index, the other indices select one of them
+		return indices[0] * 2 + (hash >> 31);
+	}
+
+	//------------------------------
+	void VertexWelder::rehash( size_t slotCount )
+	{
+		mSlots.assign( slotCount, 0u );
+
+		size_t mask = slotCount - 1;
+		size_t vertexCount = getVertexCount();
+		for ( size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex )
+		{
+			size_t slot = calculateHash( getVertexIndices(vertexIndex) ) & mask;
+			while ( mSlots[slot] != 0 )
+				slot = (slot + 1) & mask;
+			mSlots[slot] = (unsigned int)vertexIndex + 1;
+		}
+	}
+
+} // namespace COLLADAFW
@@ -0,0 +1,88 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADASaxFrameworkLoader.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_ARENASUSPENDINGWRITER_H__
+#define __COLLADASAXFWL_ARENASUSPENDINGWRITER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADAFWIStreamingWriter.h"
+
+
+namespace COLLADAFW
+{
+	class Arena;
+}
+
+namespace COLLADASaxFWL
+{
+
+	/** Passes all calls to another writer, with the current arena of the thread unset during the call.
+	The Loader uses it, when the framework objects are allocated from an arena. Objects the writer creates,
+	e.g. copies of the objects passed to it, are allocated from the heap and stay valid after the arena
+	has been released. Meshes are streamed, if the writer all calls are passed to is a streaming writer.*/
+	class ArenaSuspendingWriter : public COLLADAFW::IStreamingWriter
+	{
+	private:
+		/** The writer all calls are passed to.*/
+		COLLADAFW::IWriter* mWriter;
+
+		/** The writer all calls are passed to, if it is a streaming writer, 0 otherwise.*/
+		COLLADAFW::IStreamingWriter* mStreamingWriter;
+
+		/** The arena that is made current again after each call.*/
+		COLLADAFW::Arena* mArena;
+
+	public:
+
+        /** Constructor. */
+		ArenaSuspendingWriter( COLLADAFW::IWriter* writer, COLLADAFW::Arena* arena );
+
+        /** Destructor. */
+		virtual ~ArenaSuspendingWriter();
+
+		/** Returns the writer all calls are passed to.*/
+		COLLADAFW::IWriter* getWriter() const { return mWriter; }
+
+		virtual void cancel( const COLLADAFW::String& errorMessage );
+		virtual void start();
+		virtual void finish();
+		virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset );
+		virtual bool writeScene( const COLLADAFW::Scene* scene );
+		virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene );
+		virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes );
+		virtual bool writeGeometry( const COLLADAFW::Geometry* geometry );
+		virtual bool writeMaterial( const COLLADAFW::Material* material );
+		virtual bool writeEffect( const COLLADAFW::Effect* effect );
+		virtual bool writeCamera( const COLLADAFW::Camera* camera );
+		virtual bool writeImage( const COLLADAFW::Image* image );
+		virtual bool writeLight( const COLLADAFW::Light* light );
+		virtual bool writeAnimation( const COLLADAFW::Animation* animation );
+		virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList );
+		virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData );
+		virtual bool writeController( const COLLADAFW::Controller* controller );
+		virtual bool writeFormulas( const COLLADAFW::Formulas* formulas );
+		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene );
+		virtual bool startMesh( const COLLADAFW::Mesh* mesh );
+		virtual bool writeMeshPrimitive( const COLLADAFW::Mesh* mesh, const COLLADAFW::MeshPrimitive* meshPrimitive );
+		virtual bool finishMesh( const COLLADAFW::Mesh* mesh );
+
+	private:
+
+        /** Disable default copy ctor. */
+		ArenaSuspendingWriter( const ArenaSuspendingWriter& pre );
+
+        /** Disable default assignment operator. */
+		const ArenaSuspendingWriter& operator= ( const ArenaSuspendingWriter& pre );
+
+	};
+
+} // namespace COLLADASaxFWL
+
+#endif // __COLLADASAXFWL_ARENASUSPENDINGWRITER_H__
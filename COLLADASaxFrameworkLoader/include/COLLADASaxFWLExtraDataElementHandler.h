@@ -52,6 +52,11 @@ namespace COLLADASaxFWL
         virtual bool elementEnd(const ParserChar* elementName);
         virtual bool textData(const ParserChar* text, size_t textLength);
 
+        /** Returns true, if all callback handlers that are called for the current extra data want
+        to receive byte ranges. */
+        virtual bool captureElementRanges();
+        virtual bool elementRange( const ParserChar* elementName, size_t offset, size_t length, const ParserChar* bytes );
+
 	private:
 
         /** Disable default copy ctor. */
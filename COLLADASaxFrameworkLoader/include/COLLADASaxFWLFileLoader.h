@@ -14,6 +14,11 @@
 #include "COLLADASaxFWLPrerequisites.h"
 #include "COLLADASaxFWLDocumentProcessor.h"
 
+namespace GeneratedSaxParser
+{
+    class SaxEventRecorder;
+}
+
 namespace COLLADASaxFWL14
 {
     class ColladaParserAutoGen14Private;
@@ -30,6 +35,7 @@ namespace COLLADASaxFWL
 	class SidAddress;
 	class FilePartLoader;
     class VersionParser;
+	class SectionIndex;
 
 	/** Loader to a COLLADA document. Referenced documents are not loaded.*/
 	class FileLoader : public DocumentProcessor
@@ -90,10 +96,20 @@ namespace COLLADASaxFWL
         /** Sets the parser to @a parserToBeSet.*/
         void setParser( COLLADASaxFWL15::ColladaParserAutoGen15* parserToBeSet );
 
-	        /** Loads the data into the frame work data model.*/
-		bool load();
+	        /** Loads the data into the frame work data model.
+		@param inputMode Determines how the file is passed to the xml parser.
+		@param sectionIndex If not null, the byte ranges of the libraries are recorded in this index.*/
+		bool load( Loader::InputMode inputMode = Loader::STREAMED_INPUT, SectionIndex* sectionIndex = 0 );
 		bool load( const char* buffer, int length );
 
+		/** Loads the data into the frame work data model, by replaying the xml parser events in 
+		@a recording, instead of parsing the file.*/
+		bool load( const GeneratedSaxParser::SaxEventRecorder& recording );
+
+		/** Loads the data into the frame work data model, by passing only those byte ranges of the file
+		recorded in @a sectionIndex to the xml parser, that are required to load the objects in the object flags.*/
+		bool load( const SectionIndex& sectionIndex );
+
 		/** Returns the parsing status of the file loader.*/
 		ParsingStatus getParsingStatus() const { return mParsingStatus; }
 
@@ -0,0 +1,112 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADASaxFrameworkLoader.
+
+Licensed under the MIT Open Source License, 
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_FILEPREFETCHER_H__
+#define __COLLADASAXFWL_FILEPREFETCHER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "COLLADAFWTypes.h"
+
+#include <map>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace GeneratedSaxParser
+{
+	class SaxEventRecorder;
+}
+
+namespace COLLADASaxFWL
+{
+
+	/** Parses files on a pool of worker threads, ahead of the Loader. Each file is parsed by a
+	GeneratedSaxParser::SaxEventRecorder. The recordings are handed to the loader in the order it
+	requests them, where they are replayed into a FileLoader. Only the xml parsing is done by the 
+	worker threads, all framework objects are still created by the thread that requests the recordings.*/
+	class FilePrefetcher
+	{
+	private:
+		/** A file to parse.*/
+		struct Job
+		{
+			/** The native path of the file.*/
+			String fileName;
+
+			/** The recording of the file. Set by the worker thread.*/
+			GeneratedSaxParser::SaxEventRecorder* recording;
+
+			/** True, if the worker thread has finished parsing the file.*/
+			bool finished;
+		};
+
+		typedef std::map<COLLADAFW::FileId, Job*> FileIdJobMap;
+
+	private:
+		/** If true, the files are memory mapped instead of read chunk wise.*/
+		bool mMemoryMapped;
+
+		/** All jobs that have been enqueued but not taken yet.*/
+		FileIdJobMap mJobs;
+
+		/** Jobs not yet started by any worker thread, in the order they have been enqueued.*/
+		std::deque<Job*> mPendingJobs;
+
+		/** True, if the worker threads should terminate.*/
+		bool mStopping;
+
+		/** Guards all the members above.*/
+		std::mutex mMutex;
+
+		/** Notified, when a job has been enqueued or the worker threads should terminate.*/
+		std::condition_variable mJobEnqueued;
+
+		/** Notified, when a worker thread has finished a job.*/
+		std::condition_variable mJobFinished;
+
+		/** The worker threads.*/
+		std::vector<std::thread> mThreads;
+
+	public:
+
+        /** Constructor. Starts @a threadCount worker threads.
+		@param memoryMapped If true, the files are memory mapped instead of read chunk wise.*/
+		FilePrefetcher( size_t threadCount, bool memoryMapped );
+
+        /** Destructor. Discards all jobs not taken yet and waits for the worker threads to terminate.*/
+		virtual ~FilePrefetcher();
+
+		/** Adds the file @a fileName with file id @a fileId to the files to parse.*/
+		void enqueue( COLLADAFW::FileId fileId, const String& fileName );
+
+		/** Waits until the file with file id @a fileId has been parsed and returns its recording. The
+		caller takes ownership of the recording. Returns 0, if the file has not been enqueued.*/
+		GeneratedSaxParser::SaxEventRecorder* take( COLLADAFW::FileId fileId );
+
+	private:
+
+        /** Disable default copy ctor. */
+		FilePrefetcher( const FilePrefetcher& pre );
+
+        /** Disable default assignment operator. */
+		const FilePrefetcher& operator= ( const FilePrefetcher& pre );
+
+		/** Executed by the worker threads. Parses enqueued files until mStopping is set.*/
+		void run();
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_FILEPREFETCHER_H__
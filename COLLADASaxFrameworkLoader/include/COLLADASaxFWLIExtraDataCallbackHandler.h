@@ -35,6 +35,22 @@ namespace COLLADASaxFWL
         virtual bool elementEnd(const ParserChar* elementName ) = 0;
         virtual bool textData(const ParserChar* text, size_t textLength) = 0;
 
+        /** Returns true, if the handler wants to receive the elements of the extra data it parses as
+        byte ranges of the document through elementRange(), instead of the events of all elements inside
+        them. The events are used anyway, if the document is not resident in memory, i.e. if it is
+        streamed or compressed, see Loader::setInputMode(), or if another handler, that parses the same
+        extra data, does not want byte ranges. */
+        virtual bool captureElementRanges() { return false; }
+
+        /** Receives an element of the extra data as byte range of the document, if
+        captureElementRanges() returned true.
+        @param elementName The name of the element, a direct child of the technique element.
+        @param offset The offset of the '<' of its start tag in the document.
+        @param length The number of bytes up to and including its end tag.
+        @param bytes The @a length bytes of the element in the document. They are not copied and only
+        valid during this call, a handler that needs the text has to copy them. */
+        virtual bool elementRange( const ParserChar* elementName, size_t offset, size_t length, const ParserChar* bytes ) { return true; }
+
         /** Method to ask, if the current callback handler want to read the data of the given extra element. */
         virtual bool parseElement ( 
             const ParserChar* profileName, 
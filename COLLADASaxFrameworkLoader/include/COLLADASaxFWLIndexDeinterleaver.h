@@ -0,0 +1,87 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADASaxFrameworkLoader.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_INDEXDEINTERLEAVER_H__
+#define __COLLADASAXFWL_INDEXDEINTERLEAVER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADAFWTypes.h"
+
+#include <vector>
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Distributes the interleaved indices of a COLLADA p element to the index arrays of the inputs.
+	The destination of each offset is set up once per primitive. Each chunk of indices is then written
+	with one strided pass per destination, instead of testing every index against all inputs.*/
+	class IndexDeinterleaver
+	{
+	private:
+		/** An index array receiving the indices at one offset.*/
+		struct Destination
+		{
+			/** The offset of the indices within a vertex.*/
+			size_t offset;
+
+			/** The array the indices are appended to.*/
+			COLLADAFW::UIntValuesArray* indices;
+
+			/** Value added to each index.*/
+			unsigned int indexOffset;
+		};
+
+		typedef std::vector<Destination> DestinationList;
+
+	private:
+		/** All destinations of the current primitive.*/
+		DestinationList mDestinations;
+
+		/** The number of indices per vertex.*/
+		size_t mStride;
+
+	public:
+
+        /** Constructor. */
+		IndexDeinterleaver();
+
+        /** Destructor. */
+		virtual ~IndexDeinterleaver();
+
+		/** Removes all destinations and sets the number of indices per vertex to @a stride.*/
+		void reset( size_t stride );
+
+		/** Appends the indices at offset @a offset, increased by @a indexOffset, to @a indices.*/
+		void addDestination( size_t offset, COLLADAFW::UIntValuesArray& indices, unsigned int indexOffset );
+
+		/** Reserves memory in all destination arrays for @a vertexCount more indices.*/
+		void reserve( size_t vertexCount );
+
+		/** Returns the number of indices per vertex.*/
+		size_t getStride() const { return mStride; }
+
+		/** Appends the @a length indices in @a data to the destinations.
+		@param firstOffset The offset of the first index within its vertex. Must be less than the stride.*/
+		void deinterleave( const unsigned long long* data, size_t length, size_t firstOffset ) const;
+
+	private:
+
+        /** Disable default copy ctor. */
+		IndexDeinterleaver( const IndexDeinterleaver& pre );
+
+        /** Disable default assignment operator. */
+		const IndexDeinterleaver& operator= ( const IndexDeinterleaver& pre );
+
+	};
+
+} // namespace COLLADASaxFWL
+
+#endif // __COLLADASAXFWL_INDEXDEINTERLEAVER_H__
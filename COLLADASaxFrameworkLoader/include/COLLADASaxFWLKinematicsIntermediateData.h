@@ -826,6 +826,10 @@ namespace COLLADASaxFWL
         /** Destructor. */
 		virtual ~KinematicsIntermediateData();
 
+		/** Deletes all joints, instance joints, kinematic models, kinematic controllers and instance 
+		kinematics scenes and empties all lists.*/
+		void clear();
+
 	private:
 
         /** Disable default copy ctor. */
@@ -32,6 +32,13 @@ namespace COLLADASaxFWL
 		/** The current image.*/
 		COLLADAFW::Image* mCurrentImage;
 
+		/** True, if the embedded data of the current image is referenced as byte range of the
+		document, instead of being copied.*/
+		bool mDataReferenced;
+
+		/** The offset of the embedded data of the current image in the document.*/
+		size_t mDataOffset;
+
 	public:
 
         /** Constructor. */
@@ -65,14 +72,16 @@ namespace COLLADASaxFWL
 		virtual bool data__init_from____anyURI( COLLADABU::URI value );
 
 
-		/** Set source type.*/
+		/** Set source type. If the document is resident in memory, the data is referenced as byte
+		range of the document from here on.*/
 		virtual bool begin__data();
 
-		/** We don't need to do anything here.*/
-		virtual bool end__data(){return true;}
+		/** Stores the byte range of the data in the current image, if it is referenced.*/
+		virtual bool end__data();
 
-		/** Store data in current image.*/
-		virtual bool data__data( const uint8* data, size_t length );
+		/** Copies the data into the current image, if it is not referenced. The hexadecimal text is
+		not decoded, see COLLADAFW::HexBinaryData.*/
+		virtual bool data__data( const ParserChar* data, size_t length );
 
 	private:
 
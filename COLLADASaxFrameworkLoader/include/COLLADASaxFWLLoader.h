@@ -23,6 +23,7 @@
 #include "COLLADAFWTypes.h"
 #include "COLLADAFWSkinController.h"
 #include "COLLADAFWInstanceController.h"
+#include "COLLADAFWArena.h"
 
 #include "COLLADABUHashFunctions.h"
 #include "COLLADABUURI.h"
@@ -51,6 +52,8 @@ namespace COLLADASaxFWL
 	class DocumentProcessor;
 	class PostProcessor;
     class FileLoader;
+	class ArenaSuspendingWriter;
+	class SectionIndex;
 
 
 	typedef std::list<String> StringList;
@@ -92,6 +95,13 @@ namespace COLLADASaxFWL
 			ALL_OBJECTS_MASK           = (1<<16) - 1,
 		};
 
+		/** Determines how the files of a document are passed to the xml parser. */
+		enum InputMode
+		{
+			STREAMED_INPUT,            //!< The files are read chunk wise into a buffer passed to the xml parser
+			MEMORY_MAPPED_INPUT        //!< The files are mapped into memory and the mapped pages are passed to the xml parser
+		};
+
 	public:
 		typedef COLLADABU::hash_map<COLLADABU::URI, COLLADAFW::UniqueId> URIUniqueIdMap;
 
@@ -101,7 +111,7 @@ namespace COLLADASaxFWL
 		typedef std::map<COLLADAFW::FileId, COLLADABU::URI> FileIdURIMap;
 
 		/** Maps the id of a collada element to the corresponding sit tree node.*/
-		typedef std::map<String /*id*/, SidTreeNode*> IdStringSidTreeNodeMap;
+		typedef COLLADABU::hash_map<String /*id*/, SidTreeNode*> IdStringSidTreeNodeMap;
 
 		/** Maps unique ids of animation list to the corresponding animation list.*/
 		typedef std::map< COLLADAFW::UniqueId , COLLADAFW::AnimationList* > UniqueIdAnimationListMap;
@@ -234,6 +244,37 @@ namespace COLLADASaxFWL
 		/** A combination of ObjectFlags, indicating which objects have be parsed already.*/
 		int mParsedObjectFlags;
 
+		/** Determines how the files are passed to the xml parser by loadDocument( const String&, COLLADAFW::IWriter* ).*/
+		InputMode mInputMode;
+
+		/** Byte ranges of the libraries of the last root file loaded or 0, if section indexing is disabled.*/
+		SectionIndex* mSectionIndex;
+
+		/** If true, the libraries not required for the objects in the object flags are skipped by scanning 
+		the raw bytes of the files, before they are passed to the xml parser.*/
+		bool mExcludedElementSkipping;
+
+		/** Number of worker threads parsing external files ahead of the file currently loaded. If less 
+		than two, all files are parsed sequentially.*/
+		size_t mParallelLoadingThreadCount;
+
+		/** If true, the framework objects created by the loader are allocated from an arena that is 
+		released after the writer has finished.*/
+		bool mUseArena;
+
+		/** The arena used by the current call of loadDocument() or 0, if the arena is not used.*/
+		COLLADAFW::Arena* mArena;
+
+		/** The writer passed to loadDocument(), with the arena unset during each call. Only used together 
+		with mArena.*/
+		ArenaSuspendingWriter* mArenaSuspendingWriter;
+
+		/** The allocation counters of the arena used by the last call of loadDocument().*/
+		COLLADAFW::Arena::Statistics mArenaStatistics;
+
+		/** The sids of all nodes in the sid tree. The nodes are indexed by the atoms of their sids.*/
+		StringAtomTable mSidAtomTable;
+
 		/** The root node of the sid tree. This tree is used to resolve sids.*/
 		SidTreeNode *mSidTreeRoot;
 
@@ -314,7 +355,8 @@ namespace COLLADASaxFWL
         AnimationSidAddressBindingList & getAnimationSidAddressBindingList() { return mAnimationSidAddressBindings; }
 
         /** Starts loading the model and feeds the writer with data.
-		@param fileName The name of the file that should be loaded.
+		@param fileName The name of the file that should be loaded. The file may be gzip compressed or a zip
+		archive (zae), it is inflated while it is parsed.
 		@param writer The writer that should be fed with data.
 		@return True, if loading succeeded, false otherwise.*/
 		virtual bool loadDocument(const String& fileName, COLLADAFW::IWriter* writer );
@@ -331,6 +373,68 @@ namespace COLLADASaxFWL
 		@param objectFlags The flags indicating which objects should be loaded.*/
 		void setObjectFlags( int objectFlags ) { mObjectFlags = objectFlags; }
 
+		/** Sets how the files are passed to the xml parser. MEMORY_MAPPED_INPUT avoids copying the files
+		into intermediate buffers. Only used when loading files, not when loading from a buffer.
+		@param inputMode The input mode used to read the files.*/
+		void setInputMode( InputMode inputMode ) { mInputMode = inputMode; }
+
+		/** Returns how the files are passed to the xml parser.*/
+		InputMode getInputMode() const { return mInputMode; }
+
+		/** Sets if the byte ranges of the libraries of the root file are recorded while it is loaded. When the
+		same file is loaded again by a following call of loadDocument( const String&, COLLADAFW::IWriter* ),
+		e.g. in a second pass with other object flags, only the libraries required for the objects in the 
+		object flags are passed to the xml parser. The others are skipped without being read. If the size or
+		the modification time of the file changed in between, it is indexed again. External files are not 
+		indexed. Section indexing is disabled by default.
+		@param sectionIndexing True to record and use the byte ranges of the libraries.*/
+		void setSectionIndexing( bool sectionIndexing );
+
+		/** Returns if the byte ranges of the libraries of the root file are recorded and used.*/
+		bool getSectionIndexing() const { return mSectionIndex != 0; }
+
+		/** Sets if the libraries not required for the objects in the object flags are skipped without being
+		passed to the xml parser, when files are loaded by loadDocument( const String&, COLLADAFW::IWriter* ).
+		The raw bytes of a file are scanned for the elements below the COLLADA element, each element is 
+		skipped by searching its matching end tag, and only the required libraries are parsed. This is much 
+		faster than letting the xml parser tokenize and report every element of a library that is ignored 
+		anyway, e.g. a large library_geometries, if only the scene graph is loaded. If section indexing is 
+		enabled, the scanned byte ranges are reused by following calls. Compressed files and external files 
+		parsed ahead by worker threads are parsed completely. Skipping is disabled by default.
+		@param excludedElementSkipping True to skip the libraries not required by scanning the files.*/
+		void setExcludedElementSkipping( bool excludedElementSkipping ) { mExcludedElementSkipping = excludedElementSkipping; }
+
+		/** Returns if the libraries not required are skipped by scanning the files.*/
+		bool getExcludedElementSkipping() const { return mExcludedElementSkipping; }
+
+		/** Sets the number of worker threads used by loadDocument( const String&, COLLADAFW::IWriter* ) to 
+		parse external files ahead of the file currently loaded. The xml parsing of up to @a threadCount 
+		files runs concurrently. Framework objects are still created and passed to the writer by the 
+		calling thread, in the same order and with the same unique ids as in sequential loading. Values 
+		less than two disable parallel loading, which is the default.
+		@param threadCount The number of worker threads.*/
+		void setParallelLoadingThreadCount( size_t threadCount ) { mParallelLoadingThreadCount = threadCount; }
+
+		/** Returns the number of worker threads used to parse external files.*/
+		size_t getParallelLoadingThreadCount() const { return mParallelLoadingThreadCount; }
+
+		/** Sets if the framework objects and the memory of their arrays are allocated from an arena owned by 
+		loadDocument(), instead of allocating each of them from the heap. All objects the loader created are
+		deleted and the arena is released in one go, after IWriter::finish() has been called. The writer 
+		must therefore not keep pointers to the objects passed to it or to their data after finish(). Copies
+		made by the writer are allocated from the heap and stay valid. As all objects are deleted after each
+		load, documents cannot be loaded in several passes with different object flags using the arena.
+		The arena is disabled by default.
+		@param useArena True to allocate the framework objects from an arena.*/
+		void setUseArena( bool useArena ) { mUseArena = useArena; }
+
+		/** Returns if the framework objects are allocated from an arena.*/
+		bool getUseArena() const { return mUseArena; }
+
+		/** Returns the allocation counters of the arena used by the last call of loadDocument(). All counters 
+		are zero, if the arena was not used.*/
+		const COLLADAFW::Arena::Statistics& getArenaStatistics() const { return mArenaStatistics; }
+
         /** Register an extra data callback handler.
         * @param ExtraDataCallbackHandler* extraDataCallbackHandler The callback handler to register.
         * @return bool True, if the handler could be registered successfull. */
@@ -404,6 +508,10 @@ namespace COLLADASaxFWL
 		@a fileId nor @a uri have been passed to that method before.*/
 		void addFileIdUriPair( COLLADAFW::FileId fileId, const COLLADABU::URI& uri );
 
+		/** Returns true, if the file with file id @a fileId should be loaded, i.e. if it is the root file
+		or the registered external reference decider function accepts it.*/
+		bool isFileToBeLoaded( COLLADAFW::FileId fileId );
+
 		/** Returns the GeometryMaterialIdInfo to map symbols to ids*/
 		GeometryMaterialIdInfo& getMeshMaterialIdInfo( );
 
@@ -474,6 +582,18 @@ namespace COLLADASaxFWL
 		/** Returns the writer the data will be written to.*/
 		COLLADAFW::IWriter* writer(){ return mWriter; }
 
+		/** Deletes all framework objects and intermediate data kept by the loader after the files have been 
+		parsed.*/
+		void deleteLoadedObjects();
+
+		/** Sets the writer to @a writer. If the arena is used, it is created and made the current arena 
+		of the calling thread.*/
+		void startLoading( COLLADAFW::IWriter* writer );
+
+		/** If the arena is used, deletes all objects kept by the loader and releases the arena. Must be
+		called after IWriter::finish().*/
+		void finishLoading();
+
 
         /** Disable default copy ctor. */
 		Loader( const Loader& pre );
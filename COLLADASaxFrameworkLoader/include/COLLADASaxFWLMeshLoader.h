@@ -16,10 +16,17 @@
 #include "COLLADASaxFWLSource.h"
 #include "COLLADASaxFWLMeshPrimitiveInputList.h"
 #include "COLLADASaxFWLSourceArrayLoader.h"
+#include "COLLADASaxFWLIndexDeinterleaver.h"
 
 #include "COLLADAFWMesh.h"
 
 
+namespace COLLADAFW
+{
+	class IStreamingWriter;
+}
+
+
 namespace COLLADASaxFWL
 {
 
@@ -50,6 +57,10 @@ namespace COLLADASaxFWL
             size_t mInitialIndex;
         };
 
+		/** The minimal number of vertices passed at once to a streaming writer. Only the last block of a
+		mesh primitive might contain less vertices.*/
+		static const size_t STREAMING_BLOCK_VERTEX_COUNT = 64 * 1024;
+
 	private:
 		enum PrimitiveType
 		{
@@ -155,6 +166,23 @@ namespace COLLADASaxFWL
         /** Multiple texcoordinates. */
         std::vector<PrimitiveInput> mTexCoordList;
 
+		/** Distributes the indices of the p elements to the index arrays of the current MeshPrimitive.*/
+		IndexDeinterleaver mIndexDeinterleaver;
+
+		/** The MeshPrimitive the destinations of mIndexDeinterleaver have been set up for. Zero, if they
+		need to be set up again.*/
+		COLLADAFW::MeshPrimitive* mIndexDeinterleaverMeshPrimitive;
+
+		/** The writer the mesh primitives are passed to in blocks, while they are loaded. Zero, if the
+		mesh primitives are collected in the mesh.*/
+		COLLADAFW::IStreamingWriter* mStreamingWriter;
+
+		/** The number of vertices of the current MeshPrimitive already passed to the streaming writer.*/
+		size_t mStreamedVertexCount;
+
+		/** The number of faces of the current MeshPrimitive already passed to the streaming writer.*/
+		size_t mStreamedFaceCount;
+
         /** The type of the current primitive element. */
 		PrimitiveType mCurrentPrimitiveType;
 
@@ -181,6 +209,13 @@ namespace COLLADASaxFWL
         /** Returns the mesh that has just been loaded.*/
 		COLLADAFW::Mesh* getMesh() { return mMesh; }
 
+		/** Passes the mesh primitives in blocks to @a streamingWriter, instead of collecting them in the
+		mesh. The writer must have accepted the mesh in IStreamingWriter::startMesh().*/
+		void setStreamingWriter( COLLADAFW::IStreamingWriter* streamingWriter ) { mStreamingWriter = streamingWriter; }
+
+		/** Returns the writer the mesh primitives are passed to in blocks or 0, if they are collected in the mesh.*/
+		COLLADAFW::IStreamingWriter* getStreamingWriter() const { return mStreamingWriter; }
+
 		/** Sax callback function for the beginning of a source element.*/
 		virtual bool begin__source(const source__AttributeData& attributes);
 
@@ -374,6 +409,19 @@ namespace COLLADASaxFWL
 		/** Writes all the indices in data into the indices array of the current mesh primitive.*/
 		bool writePrimitiveIndices ( const unsigned long long* data, size_t length );
 
+		/** Sets up the destinations of mIndexDeinterleaver for the current mesh primitive, using the offsets
+		set by initializeOffsets(), and reserves memory for the expected number of vertices.*/
+		void initializeIndexDeinterleaver();
+
+		/** Passes the complete faces of the current mesh primitive, that have not been passed yet, to the
+		streaming writer, if they contain at least @a minimumVertexCount vertices. The indices of incomplete
+		faces are kept for the next block.
+		@return False, if the streaming writer failed, true otherwise.*/
+		bool streamMeshPrimitiveBlock( size_t minimumVertexCount );
+
+		/** Passes the remaining faces of the current mesh primitive to the streaming writer and deletes it.*/
+		bool endStreamedMeshPrimitive();
+
         /**
          * Get the number of all indices in all p elements in the current primitive element.
          */
@@ -0,0 +1,127 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_SECTIONINDEX_H__
+#define __COLLADASAXFWL_SECTIONINDEX_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADASaxFWLXmlTypes.h"
+
+#include "GeneratedSaxParserSaxParser.h"
+
+#include <vector>
+#include <time.h>
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Byte ranges of the elements directly below the COLLADA element of a document, i.e. the asset,
+	the libraries and the scene. The index is recorded by a SectionIndexer, while the document is
+	parsed. Afterwards, the document can be parsed again with only those elements passed to the xml
+	parser, that are required for the objects to load, without tokenizing the others.
+	The byte offsets are only exact for UTF-8 encoded documents.*/
+	class SectionIndex
+	{
+	public:
+		/** An element directly below the COLLADA element.*/
+		struct Section
+		{
+			/** Hash of the element name, without namespace prefix.*/
+			StringHash elementHash;
+
+			/** Offset of the first byte of the section. This is the first byte behind the previous
+			sibling, the start tag of the COLLADA element or the text in front of the element.*/
+			size_t begin;
+
+			/** Offset of the first byte behind the end tag of the element.*/
+			size_t end;
+		};
+
+		typedef std::vector<Section> SectionList;
+
+	private:
+		/** Native path of the indexed file. Empty, if the index is not complete.*/
+		String mFileName;
+
+		/** Size of the indexed file, when it has been indexed. -1, if it could not be determined.*/
+		long long mFileSize;
+
+		/** Last modification time of the indexed file, when it has been indexed.*/
+		time_t mModificationTime;
+
+		/** Offset of the first byte behind the start tag of the COLLADA element.*/
+		size_t mPrologEnd;
+
+		/** Offset of the first byte behind the end tag of the COLLADA element.*/
+		size_t mDocumentEnd;
+
+		/** The sections in document order.*/
+		SectionList mSections;
+
+	public:
+
+        /** Constructor. */
+		SectionIndex();
+
+        /** Destructor. */
+		virtual ~SectionIndex();
+
+		/** Removes all sections from the index.*/
+		void clear();
+
+		/** Returns true, if the file @a fileName has been indexed completely and its size and modification 
+		time did not change since.*/
+		bool isIndexed( const String& fileName ) const;
+
+		/** Indexes the file @a fileName by scanning its raw bytes for the tags of the elements directly
+		below the COLLADA element, without passing it to the xml parser. The sections are skipped by
+		searching their matching end tags, their content is not tokenized.
+		@return True, if the file has been indexed completely. False, if it could not be mapped into memory,
+		is compressed, is not encoded compatible to ASCII or is not well formed. The index is not complete 
+		then and the file needs to be indexed by a SectionIndexer.*/
+		bool scanFile( const String& fileName );
+
+		/** Indexes the @a length bytes of the file @a fileName at @a data, as scanFile does. The size and
+		the modification time of the file are recorded, when scan is called.*/
+		bool scan( const String& fileName, const char* data, size_t length );
+
+		/** Returns the sections in document order.*/
+		const SectionList& getSections() const { return mSections; }
+
+		/** Fills @a ranges with the byte ranges of the indexed file, that form a document that contains only
+		those sections whose element hash is one of the @a elementHashCount hashes in @a elementHashes.
+		The ranges are the xml declaration and the start tag of the COLLADA element, the selected sections
+		and the end tag of the COLLADA element.*/
+		void getFileRanges( const StringHash* elementHashes,
+							size_t elementHashCount,
+							GeneratedSaxParser::SaxParser::FileRangeList& ranges ) const;
+
+	private:
+		friend class SectionIndexer;
+
+		/** Records the size and the modification time of the file @a fileName, that is about to be indexed.*/
+		void recordFileState( const String& fileName );
+
+		/** Determines the size and the modification time of the file @a fileName.
+		@return False, if the file cannot be accessed.*/
+		static bool getFileState( const String& fileName, long long& fileSize, time_t& modificationTime );
+
+        /** Disable default copy ctor. */
+		SectionIndex( const SectionIndex& pre );
+
+        /** Disable default assignment operator. */
+		const SectionIndex& operator= ( const SectionIndex& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_SECTIONINDEX_H__
@@ -0,0 +1,76 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_SECTIONINDEXER_H__
+#define __COLLADASAXFWL_SECTIONINDEXER_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADASaxFWLXmlTypes.h"
+
+#include "GeneratedSaxParserParser.h"
+
+
+namespace COLLADASaxFWL
+{
+	class SectionIndex;
+
+	/** Passes all xml parser events to the parser that loads the document and records the byte
+	ranges of the elements directly below the COLLADA element in a SectionIndex. Must be set as
+	parser of the sax parser, before the start tag of the COLLADA element is passed to it.*/
+	class SectionIndexer : public GeneratedSaxParser::Parser
+	{
+	private:
+		/** The index to record the sections in.*/
+		SectionIndex& mSectionIndex;
+
+		/** Native path of the indexed file.*/
+		String mFileName;
+
+		/** The parser all events are passed to.*/
+		GeneratedSaxParser::Parser* mParser;
+
+		/** Number of currently open elements.*/
+		size_t mDepth;
+
+		/** Offset of the first byte behind the last event directly inside the COLLADA element.*/
+		size_t mLastOffset;
+
+	public:
+
+        /** Constructor. Clears @a sectionIndex.
+		@param sectionIndex The index to record the sections of the file @a fileName in.
+		@param parser The parser all events are passed to.*/
+		SectionIndexer( SectionIndex& sectionIndex,
+						const String& fileName,
+						GeneratedSaxParser::Parser* parser,
+						GeneratedSaxParser::IErrorHandler* errorHandler );
+
+        /** Destructor. */
+		virtual ~SectionIndexer();
+
+		virtual bool elementBegin( const ParserChar* elementName, const ParserAttributes& attributes );
+
+		virtual bool elementEnd( const ParserChar* elementName );
+
+		virtual bool textData( const ParserChar* text, size_t textLength );
+
+	private:
+
+        /** Disable default copy ctor. */
+		SectionIndexer( const SectionIndexer& pre );
+
+        /** Disable default assignment operator. */
+		const SectionIndexer& operator= ( const SectionIndexer& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_SECTIONINDEXER_H__
@@ -12,10 +12,12 @@
 #define __COLLADASAXFWL_SIDTREENODE_H__
 
 #include "COLLADASaxFWLPrerequisites.h"
+#include "COLLADASaxFWLStringAtomTable.h"
 #include "COLLADAFWAnimatable.h"
 #include "COLLADAFWObject.h"
 
-#include <map>
+#include "COLLADABUhash_map.h"
+
 #include <vector>
 
 namespace COLLADASaxFWL
@@ -31,21 +33,20 @@ namespace COLLADASaxFWL
 	class SidTreeNode 	
 	{
 	public:
-		struct SidIdentifier
+		struct SidChild
 		{
-			SidIdentifier( const String& _sid, size_t _hierarchyLevel)
-				: sid(_sid), hierarchyLevel(_hierarchyLevel){}
+			SidChild( SidTreeNode* _node, size_t _hierarchyLevel)
+				: node(_node), hierarchyLevel(_hierarchyLevel){}
 
-			const String& sid;
+			SidTreeNode* node;
 
 			/** Defines how deep in the hierarchy the node is placed. For the determination of the hierarchy level
 			only elements with an sid are considered.*/
 			size_t hierarchyLevel;
-
-			bool operator<(const SidIdentifier& rhs)const;
 		};
 
-		typedef std::map< SidIdentifier, SidTreeNode*> SidIdentifierSidTreeNodeMap;
+		/** Maps the atoms of sids to the child with that sid.*/
+		typedef COLLADABU::hash_map< StringAtomTable::Atom, SidChild> AtomSidChildMap;
 
 		typedef std::vector< SidTreeNode*> SidTreeNodeList;
 
@@ -69,9 +70,11 @@ namespace COLLADASaxFWL
 		/** The parent node.*/
 		SidTreeNode *mParent;
 
-		/** Maps sids to the children. One sid can appear more than once, since COLLADA allows sids to appear more than once
-		in different technique elements of the same parent.*/
-		SidIdentifierSidTreeNodeMap mChildren;
+		/** Maps the atoms of the sids of all children in the entire sub hierarchy to the child with the lowest 
+		hierarchy level. One sid can appear more than once, since COLLADA allows sids to appear more than once
+		in different technique elements of the same parent. Of the children with equal sid and hierarchy level, the
+		one added first is kept.*/
+		AtomSidChildMap mChildren;
 
 		/** List of all direct children. Is used to delete all of them.*/
 		SidTreeNodeList mDirectChildren;
@@ -84,10 +87,13 @@ namespace COLLADASaxFWL
 
 		/** The sid of the node.*/
 		String mSid;
+
+		/** The table the sids of all nodes in the tree are interned in.*/
+		StringAtomTable* mSidAtomTable;
 	public:
 
         /** Constructor. */
-		SidTreeNode( const String& sid, SidTreeNode *mParent);
+		SidTreeNode( const String& sid, SidTreeNode *mParent, StringAtomTable& sidAtomTable);
 
         /** Destructor. */
 		virtual ~SidTreeNode();
@@ -129,6 +135,9 @@ namespace COLLADASaxFWL
 		the one with the lowest hierarchy level is returned. If no child could be found, null is returned.*/
 		SidTreeNode* findChildBySid( const String& sid);
 
+		/** Same as above, for the atom @a sidAtom of the sid in the sid atom table of the tree.*/
+		SidTreeNode* findChildBySid( StringAtomTable::Atom sidAtom);
+
 
 	private:
 
@@ -139,7 +148,11 @@ namespace COLLADASaxFWL
 		const SidTreeNode& operator= ( const SidTreeNode& pre );
 
 		/** Adds @a sidTreeNode to the children map of all the parent nodes. For each level in the hierarchy */
-		void addChildToParents( SidTreeNode *sidTreeNode, const SidIdentifier& sidIdentifier);
+		void addChildToParents( SidTreeNode *sidTreeNode, StringAtomTable::Atom sidAtom, size_t hierarchyLevel);
+
+		/** Adds @a sidTreeNode to mChildren, unless a child with the same sid and a lower or equal hierarchy
+		level is already contained.*/
+		void addChild( SidTreeNode *sidTreeNode, StringAtomTable::Atom sidAtom, size_t hierarchyLevel);
 
 	};
 
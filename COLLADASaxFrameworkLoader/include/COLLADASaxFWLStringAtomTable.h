@@ -0,0 +1,68 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COLLADASAXFWL_STRINGATOMTABLE_H__
+#define __COLLADASAXFWL_STRINGATOMTABLE_H__
+
+#include "COLLADASaxFWLPrerequisites.h"
+
+#include "COLLADABUhash_map.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Assigns a unique number, the atom, to each string added to the table. Equal strings get the same
+	atom, i.e. strings that have been interned can be compared and hashed as integers.*/
+	class StringAtomTable 	
+	{
+	public:
+		typedef size_t Atom;
+
+		/** The atom of strings not contained in the table.*/
+		static const Atom INVALID_ATOM = 0;
+
+	private:
+		typedef COLLADABU::hash_map<String, Atom> StringAtomMap;
+
+	private:
+		/** Maps the strings to their atoms.*/
+		StringAtomMap mAtoms;
+
+	public:
+
+        /** Constructor. */
+		StringAtomTable();
+
+        /** Destructor. */
+		virtual ~StringAtomTable();
+
+		/** Returns the atom of @a str. If @a str is not contained in the table, it is added with a new atom.*/
+		Atom intern( const String& str );
+
+		/** Returns the atom of @a str, or INVALID_ATOM if @a str is not contained in the table.*/
+		Atom find( const String& str ) const;
+
+		/** Returns the number of strings in the table.*/
+		size_t getAtomCount() const { return mAtoms.size(); }
+
+	private:
+
+        /** Disable default copy ctor. */
+		StringAtomTable( const StringAtomTable& pre );
+
+        /** Disable default assignment operator. */
+		const StringAtomTable& operator= ( const StringAtomTable& pre );
+
+	};
+
+} // namespace COLLADASAXFWL
+
+#endif // __COLLADASAXFWL_STRINGATOMTABLE_H__
@@ -18,6 +18,11 @@
 
 #include "GeneratedSaxParserParser.h"
 
+namespace GeneratedSaxParser
+{
+    class SaxEventRecorder;
+}
+
 namespace COLLADASaxFWL14
 {
     class ColladaParserAutoGen14Private;
@@ -30,6 +35,8 @@ namespace COLLADASaxFWL15
 namespace COLLADASaxFWL
 {
     class FileLoader;
+    class SectionIndex;
+    class SectionIndexer;
 
     /**
      * Starts parsing a file to find out which COLLADA version it uses.
@@ -55,6 +62,11 @@ namespace COLLADASaxFWL
         /** Indicates which parts of the file have already been parsed. */
         int& mParsedFlags;
 
+        /** The index to record the sections of the file in or 0, if the file should not be indexed. */
+        SectionIndex* mSectionIndex;
+        /** Records the sections of the file in mSectionIndex. */
+        SectionIndexer* mSectionIndexer;
+
     public:
         VersionParser(GeneratedSaxParser::IErrorHandler* errorHandler, 
             FileLoader* fileLoader,
@@ -75,15 +87,25 @@ namespace COLLADASaxFWL
         /**
         * Creates generated parser objects and starts parsing the input file. 
         * Will determine COLLADA version of input file and use appropriate parser.
+        * @param memoryMapped If true, the input file is memory mapped instead of read chunk wise.
+        * @param sectionIndex If not 0, the sections of the input file are recorded in it.
         */
-        bool createAndLaunchParser();
+        bool createAndLaunchParser( bool memoryMapped = false, SectionIndex* sectionIndex = 0 );
         bool createAndLaunchParser(const char* buffer, int length);
+        /** Replays the xml parser events in @a recording instead of parsing the input file.*/
+        bool createAndLaunchParser(const GeneratedSaxParser::SaxEventRecorder& recording);
+        /** Passes only those sections of the input file indexed in @a sectionIndex to the xml parser, that are 
+        required to parse the objects in the flags.*/
+        bool createAndLaunchParser(const SectionIndex& sectionIndex);
 
     protected:
         void createFunctionMap14();
         void createFunctionMap15();
         bool parse14( const ParserChar* elementName, const ParserAttributes& attributes );
         bool parse15( const ParserChar* elementName, const ParserAttributes& attributes );
+        /** Makes @a privateParser the parser of the sax parser, behind the section indexer if the file is 
+        indexed, and passes the COLLADA element to it.*/
+        bool launchPrivateParser( GeneratedSaxParser::Parser* privateParser, const ParserChar* elementName, const ParserAttributes& attributes );
     };
 }
 
@@ -367,7 +367,7 @@ virtual bool end__image(){return true;}
 
 virtual bool begin__data(){return true;}
 virtual bool end__data(){return true;}
-virtual bool data__data( const uint8* value, size_t length ){return true;}
+virtual bool data__data( const ParserChar* value, size_t length ){return true;}
 
 virtual bool begin__init_from____anyURI(){return true;}
 virtual bool end__init_from____anyURI(){return true;}
@@ -9163,6 +9163,10 @@ const ColladaParserAutoGen14Private& operator= ( const ColladaParserAutoGen14Pri
 void initFunctionMap();
 void initNameMap();
 
+static const ElementFunctionEntry ELEMENT_FUNCTION_ENTRIES[];
+static const unsigned int ELEMENT_FUNCTION_DISPLACEMENTS[];
+static const ElementFunctionTable ELEMENT_FUNCTION_TABLE;
+
 protected:
 virtual bool findElementHash( ElementData& elementData );
 virtual bool isXsAnyAllowed( const StringHash& elementHash );
@@ -52,7 +52,7 @@ virtual bool begin__data();
 
 virtual bool end__data();
 
-virtual bool data__data( const uint8* data, size_t length );
+virtual bool data__data( const ParserChar* data, size_t length );
 
 virtual bool begin__technique( const COLLADASaxFWL14::technique__AttributeData& attributeData );
 
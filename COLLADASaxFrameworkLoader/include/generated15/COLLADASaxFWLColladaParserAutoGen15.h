@@ -1002,7 +1002,7 @@ virtual bool data__ref____anyURI( COLLADABU::URI value ){return true;}
 
 virtual bool begin__binary__hex( const binary__hex__AttributeData& attributeData ){return true;}
 virtual bool end__binary__hex(){return true;}
-virtual bool data__binary__hex( const uint8* value, size_t length ){return true;}
+virtual bool data__binary__hex( const ParserChar* value, size_t length ){return true;}
 
 virtual bool begin__linker( const linker__AttributeData& attributeData ){return true;}
 virtual bool end__linker(){return true;}
@@ -2113,7 +2113,7 @@ virtual bool end__image_type____init_from(){return true;}
 
 virtual bool begin__library_images__image__init_from__hex( const library_images__image__init_from__hex__AttributeData& attributeData ){return true;}
 virtual bool end__library_images__image__init_from__hex(){return true;}
-virtual bool data__library_images__image__init_from__hex( const uint8* value, size_t length ){return true;}
+virtual bool data__library_images__image__init_from__hex( const ParserChar* value, size_t length ){return true;}
 
 virtual bool begin__create_2d(){return true;}
 virtual bool end__create_2d(){return true;}
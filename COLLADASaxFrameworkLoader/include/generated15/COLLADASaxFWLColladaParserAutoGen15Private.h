@@ -12083,6 +12083,10 @@ const ColladaParserAutoGen15Private& operator= ( const ColladaParserAutoGen15Pri
 void initFunctionMap();
 void initNameMap();
 
+static const ElementFunctionEntry ELEMENT_FUNCTION_ENTRIES[];
+static const unsigned int ELEMENT_FUNCTION_DISPLACEMENTS[];
+static const ElementFunctionTable ELEMENT_FUNCTION_TABLE;
+
 protected:
 virtual bool findElementHash( ElementData& elementData );
 virtual bool isXsAnyAllowed( const StringHash& elementHash );
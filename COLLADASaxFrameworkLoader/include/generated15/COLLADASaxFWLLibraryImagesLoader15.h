@@ -52,7 +52,13 @@ virtual bool begin__binary__hex( const COLLADASaxFWL15::binary__hex__AttributeDa
 
 virtual bool end__binary__hex();
 
-virtual bool data__binary__hex( const uint8* data, size_t length );
+virtual bool data__binary__hex( const ParserChar* data, size_t length );
+
+virtual bool begin__library_images__image__init_from__hex( const COLLADASaxFWL15::library_images__image__init_from__hex__AttributeData& attributeData );
+
+virtual bool end__library_images__image__init_from__hex();
+
+virtual bool data__library_images__image__init_from__hex( const ParserChar* data, size_t length );
 
 virtual bool begin__technique____technique_type( const COLLADASaxFWL15::technique____technique_type__AttributeData& attributeData );
 
@@ -0,0 +1,74 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___PERFORMANCETEST_H__
+#define ___PERFORMANCETEST_H__
+
+#include <stddef.h>
+
+/** Distributes the indices of @a triangleCount synthetic triangles with a position, a normal and a 
+texture coordinate input @a repetitions times to the index arrays, index by index as the MeshLoader did 
+before and using the IndexDeinterleaver, and prints the throughput of both.*/
+void indexDeinterleavingPerformanceTest( size_t triangleCount, int repetitions );
+
+/** Builds the sid tree of a rig with @a channelCount animated transformations and resolves the sid address
+of each channel @a repetitions times, with the ordered maps the loader used before and with the hash indexed
+sid tree, and prints the throughput of both.*/
+void sidResolvingPerformanceTest( size_t channelCount, int repetitions );
+
+/** Resolves @a referenceCount references to the ids of @a idCount elements in the same document against the 
+file uri @a repetitions times and looks up their unique ids in a hash map, as the Loader does for each 
+instance or url, and prints the throughput and the size of an URI.*/
+void uriResolvingPerformanceTest( size_t idCount, size_t referenceCount, int repetitions );
+
+
+/** Passes the sax events of a synthetic visual scene with @a nodeCount nodes @a repetitions times to the
+generated 1.4 parser and prints the dispatched tags per second. Looks up the elements of the scene in the
+generated function table and in the ordered map it replaces, and prints the throughput of both.*/
+void elementDispatchPerformanceTest( size_t nodeCount, int repetitions );
+
+/** Converts a synthetic list of @a valueCount floats @a repetitions times on the memory stack of the
+generated parser, with a buffer doubled whenever it is full, as before, and with the buffer reserved
+for all values up front, and prints the throughput of both.*/
+void listConversionPerformanceTest( size_t valueCount, int repetitions );
+
+/** Merges the face corners of a synthetic triangle mesh with @a triangleCount triangles, that have equal
+position, normal and uv coordinate indices, into vertices @a repetitions times, with the ordered map
+dae2ogre used before and with the COLLADAFW::VertexWelder, and prints the throughput of both.*/
+void vertexWeldingPerformanceTest( size_t triangleCount, int repetitions );
+
+/** Calculates the world matrices of the nodes of a synthetic scene with @a nodeCount nodes @a repetitions
+times, recursively with Node::getTransformationMatrix as the converters do and with the 
+COLLADAFW::FlatNodeHierarchy, and prints the throughput of both.*/
+void nodeHierarchyPerformanceTest( size_t nodeCount, int repetitions );
+
+/** Parses a document with @a nodeCount nodes with an extra technique each @a repetitions times with the
+generated parser from memory. The unknown elements of the extras are serialized from their events by the
+RawUnknownElementHandler, copied from their byte ranges by it and only passed as byte ranges. Prints the
+throughput of all three.*/
+void extraCapturePerformanceTest( size_t nodeCount, int repetitions );
+
+/** Numbers the edges of a synthetic grid of @a quadCount quads, split into several polylists, @a repetitions
+times with the hash map dae2ma used before and with the COLLADAFW::EdgeBuilder with one thread and with one
+thread per core, and prints the throughput of all three.*/
+void edgeBuildingPerformanceTest( size_t quadCount, int repetitions );
+
+/** Parses a document with @a imageCount images with @a byteCount bytes of embedded data each, keeping the
+hexadecimal text undecoded, and decodes the data of all images @a repetitions times one character at a
+time and with COLLADAFW::HexBinaryData, and prints the throughput of all three.*/
+void imageDataPerformanceTest( size_t imageCount, size_t byteCount, int repetitions );
+
+/** Loads a document with @a nodeCount nodes, each instantiating its own cube mesh, @a repetitions times
+with the COLLADASaxFWL::Loader, with the framework objects allocated from the heap and from an arena. 
+Prints the throughput and the heap allocations of both and the arena counters.*/
+void arenaPerformanceTest( size_t nodeCount, int repetitions );
+
+
+#endif // ___PERFORMANCETEST_H__
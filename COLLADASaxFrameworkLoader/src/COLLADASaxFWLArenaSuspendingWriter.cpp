@@ -0,0 +1,199 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADASaxFrameworkLoader.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLArenaSuspendingWriter.h"
+
+#include "COLLADAFWArena.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	/** Unsets the current arena for its lifetime.*/
+	class ArenaSuspension
+	{
+	private:
+		COLLADAFW::Arena* mArena;
+	public:
+		ArenaSuspension( COLLADAFW::Arena* arena ) : mArena(arena) { COLLADAFW::Arena::setCurrentArena(0); }
+		~ArenaSuspension() { COLLADAFW::Arena::setCurrentArena(mArena); }
+	};
+
+	//------------------------------
+	ArenaSuspendingWriter::ArenaSuspendingWriter( COLLADAFW::IWriter* writer, COLLADAFW::Arena* arena )
+		: mWriter(writer)
+		, mStreamingWriter(dynamic_cast<COLLADAFW::IStreamingWriter*>(writer))
+		, mArena(arena)
+	{
+	}
+
+	//------------------------------
+	ArenaSuspendingWriter::~ArenaSuspendingWriter()
+	{
+	}
+
+	//------------------------------
+	void ArenaSuspendingWriter::cancel( const COLLADAFW::String& errorMessage )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		mWriter->cancel( errorMessage );
+	}
+
+	//------------------------------
+	void ArenaSuspendingWriter::start()
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		mWriter->start();
+	}
+
+	//------------------------------
+	void ArenaSuspendingWriter::finish()
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		mWriter->finish();
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeGlobalAsset( const COLLADAFW::FileInfo* asset )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeGlobalAsset( asset );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeScene( const COLLADAFW::Scene* scene )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeScene( scene );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeVisualScene( const COLLADAFW::VisualScene* visualScene )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeVisualScene( visualScene );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeLibraryNodes( libraryNodes );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeGeometry( const COLLADAFW::Geometry* geometry )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeGeometry( geometry );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeMaterial( const COLLADAFW::Material* material )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeMaterial( material );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeEffect( const COLLADAFW::Effect* effect )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeEffect( effect );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeCamera( const COLLADAFW::Camera* camera )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeCamera( camera );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeImage( const COLLADAFW::Image* image )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeImage( image );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeLight( const COLLADAFW::Light* light )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeLight( light );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeAnimation( const COLLADAFW::Animation* animation )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeAnimation( animation );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeAnimationList( const COLLADAFW::AnimationList* animationList )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeAnimationList( animationList );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeSkinControllerData( skinControllerData );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeController( const COLLADAFW::Controller* controller )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeController( controller );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeFormulas( const COLLADAFW::Formulas* formulas )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeFormulas( formulas );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mWriter->writeKinematicsScene( kinematicsScene );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::startMesh( const COLLADAFW::Mesh* mesh )
+	{
+		if ( !mStreamingWriter )
+			return false;
+		ArenaSuspension arenaSuspension(mArena);
+		return mStreamingWriter->startMesh( mesh );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::writeMeshPrimitive( const COLLADAFW::Mesh* mesh, const COLLADAFW::MeshPrimitive* meshPrimitive )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mStreamingWriter->writeMeshPrimitive( mesh, meshPrimitive );
+	}
+
+	//------------------------------
+	bool ArenaSuspendingWriter::finishMesh( const COLLADAFW::Mesh* mesh )
+	{
+		ArenaSuspension arenaSuspension(mArena);
+		return mStreamingWriter->finishMesh( mesh );
+	}
+
+} // namespace COLLADASaxFWL
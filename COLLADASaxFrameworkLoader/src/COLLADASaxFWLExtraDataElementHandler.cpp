@@ -108,4 +108,37 @@ namespace COLLADASaxFWL
         return true;
     }
 
+    //------------------------------
+    bool ExtraDataElementHandler::captureElementRanges()
+    {
+        // Ranges are only captured, if no called handler relies on the events.
+        const size_t numHandlers = mExtraDataCallbackHandlerList.size ();
+        if ( numHandlers > 0 && !mCallbackHandlersCallingList ) return false;
+
+        for ( size_t i=0; i<numHandlers; ++i )
+        {
+            if ( mCallbackHandlersCallingList[i] && !mExtraDataCallbackHandlerList[i]->captureElementRanges () )
+                return false;
+        }
+        return true;
+    }
+
+    //------------------------------
+    bool ExtraDataElementHandler::elementRange( const ParserChar* elementName, size_t offset, size_t length, const ParserChar* bytes )
+    {
+        // Go through the list of extra data callback handlers and call the elementRange method.
+        const size_t numHandlers = mExtraDataCallbackHandlerList.size ();
+        if ( numHandlers > 0 && !mCallbackHandlersCallingList ) return false;
+
+        for ( size_t i=0; i<numHandlers; ++i )
+        {
+            if ( mCallbackHandlersCallingList[i] )
+            {
+                IExtraDataCallbackHandler* callbackHandler = mExtraDataCallbackHandlerList [i];
+                callbackHandler->elementRange ( elementName, offset, length, bytes );
+            }
+        }
+        return true;
+    }
+
 } // namespace COLLADASaxFWL
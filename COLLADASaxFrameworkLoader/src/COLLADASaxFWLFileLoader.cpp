@@ -71,12 +71,12 @@ namespace COLLADASaxFWL
 	}
 
 	//-----------------------------
-	bool FileLoader::load()
+	bool FileLoader::load( Loader::InputMode inputMode, SectionIndex* sectionIndex )
 	{
         VersionParser parser( mSaxParserErrorHandler, this, mObjectFlags, mParsedObjectFlags );
 		mVersionParser = &parser;
         mParsingStatus = PARSING_PARSING;
-        bool success = parser.createAndLaunchParser();
+        bool success = parser.createAndLaunchParser( inputMode == Loader::MEMORY_MAPPED_INPUT, sectionIndex );
         mParsingStatus = PARSING_FINISHED;
 		mVersionParser = 0;
         return success;
@@ -94,6 +94,30 @@ namespace COLLADASaxFWL
         return success;
 	}    
 
+	//-----------------------------
+	bool FileLoader::load( const GeneratedSaxParser::SaxEventRecorder& recording )
+	{
+        VersionParser parser( mSaxParserErrorHandler, this, mObjectFlags, mParsedObjectFlags );
+		mVersionParser = &parser;
+        mParsingStatus = PARSING_PARSING;
+        bool success = parser.createAndLaunchParser( recording );
+        mParsingStatus = PARSING_FINISHED;
+		mVersionParser = 0;
+        return success;
+	}
+
+	//-----------------------------
+	bool FileLoader::load( const SectionIndex& sectionIndex )
+	{
+        VersionParser parser( mSaxParserErrorHandler, this, mObjectFlags, mParsedObjectFlags );
+		mVersionParser = &parser;
+        mParsingStatus = PARSING_PARSING;
+        bool success = parser.createAndLaunchParser( sectionIndex );
+        mParsingStatus = PARSING_FINISHED;
+		mVersionParser = 0;
+        return success;
+	}
+
 	//-----------------------------
 	const COLLADABU::URI& FileLoader::getFileUri()
 	{
@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADASaxFrameworkLoader.
+
+Licensed under the MIT Open Source License, 
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLFilePrefetcher.h"
+
+#include "GeneratedSaxParserSaxEventRecorder.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	FilePrefetcher::FilePrefetcher( size_t threadCount, bool memoryMapped )
+		: mMemoryMapped(memoryMapped)
+		, mStopping(false)
+	{
+		GeneratedSaxParser::SaxEventRecorder::initializeConcurrentRecording();
+
+		mThreads.reserve(threadCount);
+		for ( size_t i = 0; i < threadCount; ++i )
+		{
+			mThreads.push_back(std::thread(&FilePrefetcher::run, this));
+		}
+	}
+
+	//------------------------------
+	FilePrefetcher::~FilePrefetcher()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStopping = true;
+			mPendingJobs.clear();
+		}
+		mJobEnqueued.notify_all();
+
+		for ( size_t i = 0, count = mThreads.size(); i < count; ++i )
+		{
+			mThreads[i].join();
+		}
+
+		FileIdJobMap::const_iterator it = mJobs.begin();
+		for ( ; it != mJobs.end(); ++it )
+		{
+			Job* job = it->second;
+			delete job->recording;
+			delete job;
+		}
+	}
+
+	//------------------------------
+	void FilePrefetcher::enqueue( COLLADAFW::FileId fileId, const String& fileName )
+	{
+		Job* job = new Job();
+		job->fileName = fileName;
+		job->recording = 0;
+		job->finished = false;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			COLLADABU_ASSERT(mJobs.find(fileId) == mJobs.end());
+			mJobs[fileId] = job;
+			mPendingJobs.push_back(job);
+		}
+		mJobEnqueued.notify_one();
+	}
+
+	//------------------------------
+	GeneratedSaxParser::SaxEventRecorder* FilePrefetcher::take( COLLADAFW::FileId fileId )
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		FileIdJobMap::iterator it = mJobs.find(fileId);
+		if ( it == mJobs.end() )
+			return 0;
+
+		Job* job = it->second;
+		while ( !job->finished )
+		{
+			mJobFinished.wait(lock);
+		}
+		mJobs.erase(it);
+		lock.unlock();
+
+		GeneratedSaxParser::SaxEventRecorder* recording = job->recording;
+		delete job;
+		return recording;
+	}
+
+	//------------------------------
+	void FilePrefetcher::run()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		while ( true )
+		{
+			while ( !mStopping && mPendingJobs.empty() )
+			{
+				mJobEnqueued.wait(lock);
+			}
+			if ( mStopping )
+				return;
+
+			Job* job = mPendingJobs.front();
+			mPendingJobs.pop_front();
+			lock.unlock();
+
+			GeneratedSaxParser::SaxEventRecorder* recording = new GeneratedSaxParser::SaxEventRecorder();
+			recording->record(job->fileName.c_str(), mMemoryMapped);
+
+			lock.lock();
+			job->recording = recording;
+			job->finished = true;
+			mJobFinished.notify_all();
+		}
+	}
+
+} // namespace COLLADASaxFWL
@@ -14,7 +14,7 @@
 #include "COLLADASaxFWLMeshLoader15.h"
 #include "COLLADASaxFWLGeometryLoader.h"
 
-#include "COLLADAFWIWriter.h"
+#include "COLLADAFWIStreamingWriter.h"
 
 
 namespace COLLADASaxFWL
@@ -64,6 +64,14 @@ namespace COLLADASaxFWL
         default:
             break;
         }
+
+		// A streaming writer might want to receive the mesh in blocks
+		if ( (getObjectFlags() & Loader::GEOMETRY_FLAG) != 0 )
+		{
+			COLLADAFW::IStreamingWriter* streamingWriter = dynamic_cast<COLLADAFW::IStreamingWriter*>( writer() );
+			if ( streamingWriter && streamingWriter->startMesh( mMeshLoader->getMesh() ) )
+				mMeshLoader->setStreamingWriter( streamingWriter );
+		}
 		return true;
 	}
 
@@ -99,7 +107,11 @@ namespace COLLADASaxFWL
 		COLLADAFW::Mesh * mesh = mMeshLoader ? mMeshLoader->getMesh() : 0;
 		if ( ((getObjectFlags() & Loader::GEOMETRY_FLAG) != 0) && mesh )
 		{
-			success |= writer()->writeGeometry(mesh);
+			COLLADAFW::IStreamingWriter* streamingWriter = mMeshLoader->getStreamingWriter();
+			if ( streamingWriter )
+				success = streamingWriter->finishMesh(mesh);
+			else
+				success |= writer()->writeGeometry(mesh);
 		}
 
         COLLADAFW::Spline * spline = mSplineLoader ? mSplineLoader->getSpline() : 0;
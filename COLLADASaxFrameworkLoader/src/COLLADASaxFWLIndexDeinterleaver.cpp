@@ -0,0 +1,87 @@
+/*
+Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+This file is part of COLLADASaxFrameworkLoader.
+
+Licensed under the MIT Open Source License,
+for details please see LICENSE file or the website
+http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLIndexDeinterleaver.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	IndexDeinterleaver::IndexDeinterleaver()
+		: mStride(1)
+	{
+	}
+
+	//------------------------------
+	IndexDeinterleaver::~IndexDeinterleaver()
+	{
+	}
+
+	//------------------------------
+	void IndexDeinterleaver::reset( size_t stride )
+	{
+		mDestinations.clear();
+		mStride = (stride > 0) ? stride : 1;
+	}
+
+	//------------------------------
+	void IndexDeinterleaver::addDestination( size_t offset, COLLADAFW::UIntValuesArray& indices, unsigned int indexOffset )
+	{
+		COLLADABU_ASSERT( offset < mStride );
+		Destination destination;
+		destination.offset = offset;
+		destination.indices = &indices;
+		destination.indexOffset = indexOffset;
+		mDestinations.push_back( destination );
+	}
+
+	//------------------------------
+	void IndexDeinterleaver::reserve( size_t vertexCount )
+	{
+		for ( size_t i = 0, count = mDestinations.size(); i < count; ++i )
+		{
+			COLLADAFW::UIntValuesArray& indices = *mDestinations[i].indices;
+			indices.reallocMemory( indices.getCount() + vertexCount );
+		}
+	}
+
+	//------------------------------
+	void IndexDeinterleaver::deinterleave( const unsigned long long* data, size_t length, size_t firstOffset ) const
+	{
+		const size_t stride = mStride;
+		for ( size_t i = 0, count = mDestinations.size(); i < count; ++i )
+		{
+			const Destination& destination = mDestinations[i];
+
+			// position of the first index in data belonging to this destination
+			size_t first = (destination.offset >= firstOffset)
+				? (destination.offset - firstOffset)
+				: (destination.offset + stride - firstOffset);
+			if ( first >= length )
+				continue;
+			size_t indexCount = (length - first + stride - 1) / stride;
+
+			COLLADAFW::UIntValuesArray& indices = *destination.indices;
+			size_t oldCount = indices.getCount();
+			indices.reallocMemory( oldCount + indexCount );
+
+			unsigned int* target = indices.getData() + oldCount;
+			const unsigned int indexOffset = destination.indexOffset;
+			for ( size_t j = 0, k = first; j < indexCount; ++j, k += stride )
+			{
+				target[j] = (unsigned int)data[k] + indexOffset;
+			}
+			indices.setCount( oldCount + indexCount );
+		}
+	}
+
+} // namespace COLLADASaxFWL
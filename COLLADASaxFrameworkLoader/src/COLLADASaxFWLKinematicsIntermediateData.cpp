@@ -77,21 +77,34 @@ namespace COLLADASaxFWL
 
     //------------------------------
 	KinematicsIntermediateData::~KinematicsIntermediateData()
+	{
+		clear();
+	}
+
+	//------------------------------
+	void KinematicsIntermediateData::clear()
 	{
 		// delete joints
 		deleteVectorFW(mJoints);
+		mJoints.clear();
 
 		// delete joint instances
 		deleteVectorFW(mInstanceJoints);
+		mInstanceJoints.clear();
 
 		// delete kinematic models
 		deleteMap(mKinematicsModels);
+		mKinematicsModels.clear();
 
 		// delete kinematic controllers
 		deleteMap(mKinematicsControllers);
+		mKinematicsControllers.clear();
+
+		mKinematicsScenes.clear();
 
 		// delete  instance kinematics scenes
 		deleteVector(mInstanceKinematicsScenes);
+		mInstanceKinematicsScenes.clear();
 	}
 
 	//------------------------------
@@ -11,10 +11,13 @@
 #include "COLLADASaxFWLStableHeaders.h"
 #include "COLLADASaxFWLLibraryImagesLoader.h"
 #include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLFileLoader.h"
 
 #include "COLLADAFWImage.h"
 #include "COLLADAFWIWriter.h"
 
+#include "GeneratedSaxParserSaxParser.h"
+
 
 namespace COLLADASaxFWL
 {
@@ -23,6 +26,8 @@ namespace COLLADASaxFWL
 	LibraryImagesLoader::LibraryImagesLoader( IFilePartLoader* callingFilePartLoader )
 		: FilePartLoader(callingFilePartLoader)
 		, mCurrentImage(0)
+		, mDataReferenced(false)
+		, mDataOffset(0)
 	{
 
 	}
@@ -108,17 +113,44 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool LibraryImagesLoader::begin__data()
 	{
-		// disabled see COLLADAFW::Image
-		//mCurrentImage->setSourceType( COLLADAFW::Image::SOURCE_TYPE_DATA);
+		mCurrentImage->setSourceType( COLLADAFW::Image::SOURCE_TYPE_DATA );
+		mCurrentImage->getData().clear();
+
+		// the data starts behind the start tag
+		const GeneratedSaxParser::SaxParser* saxParser = getFileLoader()->getSaxParser();
+		mDataReferenced = saxParser && saxParser->isDocumentInMemory();
+		mDataOffset = mDataReferenced ? saxParser->getByteOffset() : 0;
+		return true;
+	}
+
+	//------------------------------
+	bool LibraryImagesLoader::end__data()
+	{
+		if ( !mDataReferenced )
+			return true;
+		mDataReferenced = false;
+
+		// the data ends in front of the end tag. The ranges passed to the sax parser contain whole
+		// libraries, the bytes of the element are contiguous.
+		const GeneratedSaxParser::SaxParser* saxParser = getFileLoader()->getSaxParser();
+		size_t elementEnd = saxParser->getByteOffset();
+		const ParserChar* bytes = saxParser->getDocumentBytes( mDataOffset, elementEnd - mDataOffset );
+		if ( !bytes )
+			return true;
+		size_t length = elementEnd - mDataOffset;
+		while ( (length > 0) && (bytes[length - 1] != '<') )
+			length--;
+		if ( length > 0 )
+			length--;
+		mCurrentImage->getData().setReferencedText( bytes, length, mDataOffset );
 		return true;
 	}
 
 	//------------------------------
-	bool LibraryImagesLoader::data__data( const uint8* data, size_t length )
+	bool LibraryImagesLoader::data__data( const ParserChar* data, size_t length )
 	{
-		// disabled see COLLADAFW::Image
-		//COLLADAFW::Image::CharacterArray& dataArray = mCurrentImage->getData();
-		//dataArray.appendValues( (char *)data, length );
+		if ( !mDataReferenced )
+			mCurrentImage->getData().appendText( data, length );
 		return true;
 	}
 
@@ -11,12 +11,17 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADASaxFWLStableHeaders.h"
 #include "COLLADASaxFWLLoader.h"
 #include "COLLADASaxFWLFileLoader.h"
+#include "COLLADASaxFWLFilePrefetcher.h"
+#include "COLLADASaxFWLArenaSuspendingWriter.h"
 #include "COLLADASaxFWLPostProcessor.h"
 #include "COLLADASaxFWLSaxParserErrorHandler.h"
+#include "COLLADASaxFWLSectionIndex.h"
 #include "COLLADASaxFWLUtils.h"
 
 #include "COLLADABUURI.h"
 
+#include "GeneratedSaxParserSaxEventRecorder.h"
+
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWLibraryNodes.h"
 #include "COLLADAFWIWriter.h"
@@ -24,6 +29,7 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWLight.h"
 #include "COLLADAFWCamera.h"
 #include "COLLADAFWAnimationList.h"
+#include "COLLADAFWMorphController.h"
 #include "COLLADAFWConstants.h"
 
 #include <sys/types.h>
@@ -46,7 +52,14 @@ namespace COLLADASaxFWL
 		, mNextTextureMapId(0)
 		, mObjectFlags( Loader::ALL_OBJECTS_MASK )
 		, mParsedObjectFlags( Loader::NO_FLAG )
-		, mSidTreeRoot( new SidTreeNode("", 0) )
+		, mInputMode( Loader::STREAMED_INPUT )
+		, mSectionIndex( 0 )
+		, mExcludedElementSkipping( false )
+		, mParallelLoadingThreadCount( 0 )
+		, mUseArena( false )
+		, mArena( 0 )
+		, mArenaSuspendingWriter( 0 )
+		, mSidTreeRoot( new SidTreeNode("", 0, mSidAtomTable) )
 		, mSkinControllerSet( compare )
 		, mExternalReferenceDeciderCallbackFunction()
 
@@ -58,23 +71,40 @@ namespace COLLADASaxFWL
 	Loader::~Loader()
 	{
 		delete mSidTreeRoot;
+		delete mSectionIndex;
+
+		deleteLoadedObjects();
+	}
 
+	//---------------------------------
+	void Loader::deleteLoadedObjects()
+	{
 		// delete visual scenes
 		deleteVectorFW(mVisualScenes);
+		mVisualScenes.clear();
 
 		// delete library nodes
 		deleteVectorFW(mLibraryNodes);
+		mLibraryNodes.clear();
 
 		// delete effects
 		deleteVectorFW(mEffects);
+		mEffects.clear();
 
 		// delete lights
 		deleteVectorFW(mLights);
+		mLights.clear();
 
 		// delete cameras
 		deleteVectorFW(mCameras);
+		mCameras.clear();
+
+		// delete morph controllers
+		deleteVectorFW(mMorphControllerList);
+		mMorphControllerList.clear();
 
 		// We do not delete formulas here. They are deleted by the Formulas class
+		mFormulasMap.clear();
 
 		// delete animation lists
 		Loader::UniqueIdAnimationListMap::const_iterator it = mUniqueIdAnimationListMap.begin();
@@ -83,6 +113,49 @@ namespace COLLADASaxFWL
 			COLLADAFW::AnimationList* animationList = it->second;
 			FW_DELETE animationList;
 		}
+		mUniqueIdAnimationListMap.clear();
+
+		// the instance controllers are owned by the nodes
+		mInstanceControllerDataListMap.clear();
+
+		mSkinControllerSet.clear();
+
+		mKinematicsIntermediateData.clear();
+	}
+
+	//---------------------------------
+	void Loader::startLoading( COLLADAFW::IWriter* writer )
+	{
+		mWriter = writer;
+		mArenaStatistics = COLLADAFW::Arena::Statistics();
+
+		if ( mUseArena )
+		{
+			mArena = new COLLADAFW::Arena();
+			mArenaSuspendingWriter = new ArenaSuspendingWriter( writer, mArena );
+			mWriter = mArenaSuspendingWriter;
+			COLLADAFW::Arena::setCurrentArena( mArena );
+		}
+	}
+
+	//---------------------------------
+	void Loader::finishLoading()
+	{
+		if ( !mArena )
+			return;
+
+		// The objects need to be deleted while the arena is still current, to not release their memory 
+		// to the heap
+		deleteLoadedObjects();
+
+		mArenaStatistics = mArena->getStatistics();
+		COLLADAFW::Arena::setCurrentArena( 0 );
+		delete mArena;
+		mArena = 0;
+
+		mWriter = mArenaSuspendingWriter->getWriter();
+		delete mArenaSuspendingWriter;
+		mArenaSuspendingWriter = 0;
 	}
 
     //---------------------------------
@@ -128,10 +201,10 @@ namespace COLLADASaxFWL
 	COLLADAFW::FileId Loader::getFileId( const COLLADABU::URI& uri )
 	{
 		// check if the uri is relative
-		bool isRelative = uri.getScheme().empty() && 
-			              uri.getAuthority().empty() && 
-						  uri.getPath().empty() && 
-						  uri.getQuery().empty();
+		bool isRelative = !uri.hasScheme() && 
+			              !uri.hasAuthority() && 
+						  !uri.hasPath() && 
+						  !uri.hasQuery();
 		if ( isRelative )
 		{
 			// its a relative uri. The file id is that of the current file
@@ -143,7 +216,7 @@ namespace COLLADASaxFWL
 
 		COLLADABU::URI uriWithoutFragment;
 		
-		if ( uri.getFragment().empty() )
+		if ( !uri.hasFragment() )
 		{
 			// the passed uri has no fragment, we can use it without modification
 			usedUri = &uri;
@@ -151,7 +224,7 @@ namespace COLLADASaxFWL
 		else
 		{
 			// the passed uri has a fragment, we need to make a copy without fragment
-			uriWithoutFragment.set( uri.getScheme(), uri.getAuthority(), uri.getPath(), uri.getQuery(), COLLADAFW::Constants::EMPTY_STRING);
+			uriWithoutFragment = uri.getDocumentURI();
 			usedUri = &uriWithoutFragment;
 		}
 
@@ -191,12 +264,34 @@ namespace COLLADASaxFWL
 		mFileIdURIMap[fileId] = uri;
 	}
 
+	//---------------------------------
+	bool Loader::isFileToBeLoaded( COLLADAFW::FileId fileId )
+	{
+		return (fileId == 0) 
+			|| !mExternalReferenceDeciderCallbackFunction 
+			|| mExternalReferenceDeciderCallbackFunction(getFileUri(fileId), fileId);
+	}
+
+	//---------------------------------
+	void Loader::setSectionIndexing( bool sectionIndexing )
+	{
+		if ( sectionIndexing && !mSectionIndex )
+		{
+			mSectionIndex = new SectionIndex();
+		}
+		else if ( !sectionIndexing )
+		{
+			delete mSectionIndex;
+			mSectionIndex = 0;
+		}
+	}
+
 	//---------------------------------
 	bool Loader::loadDocument( const String& fileName, COLLADAFW::IWriter* writer )
 	{
 		if ( !writer )
 			return false;
-		mWriter = writer;
+		startLoading( writer );
 
 		mWriter->start();
 
@@ -204,18 +299,48 @@ namespace COLLADASaxFWL
 
 		COLLADABU::URI rootFileUri(COLLADABU::URI::nativePathToUri(fileName));
 		
-		// the root file has always file id 0
+		// the root file has file id 0 in the first call, following calls assign a new one
+		COLLADAFW::FileId rootFileId = mNextFileId;
 		addFileIdUriPair( mNextFileId++, rootFileUri );
 
 		bool abortLoading = false;
 
+		// The external files are parsed by the prefetcher, the root file is parsed directly
+		FilePrefetcher* filePrefetcher = 0;
+		if ( mParallelLoadingThreadCount > 1 )
+		{
+			filePrefetcher = new FilePrefetcher( mParallelLoadingThreadCount, mInputMode == MEMORY_MAPPED_INPUT );
+		}
+		COLLADAFW::FileId nextPrefetchedFileId = rootFileId + 1;
+
 		while ( (mCurrentFileId < mNextFileId) && !abortLoading )
 		{
 			const COLLADABU::URI& fileUri = getFileUri( mCurrentFileId );
 
-			if ( (mCurrentFileId == 0) 
-				|| !mExternalReferenceDeciderCallbackFunction 
-				|| mExternalReferenceDeciderCallbackFunction(fileUri, mCurrentFileId) )
+			bool loadFile = false;
+			GeneratedSaxParser::SaxEventRecorder* recording = 0;
+			if ( filePrefetcher && (mCurrentFileId != rootFileId) )
+			{
+				// Keep the worker threads busy with the files following the current one. Files not
+				// enqueued have been rejected by the decider function
+				while ( (nextPrefetchedFileId < mNextFileId) 
+					&& (nextPrefetchedFileId <= mCurrentFileId + mParallelLoadingThreadCount) )
+				{
+					if ( isFileToBeLoaded(nextPrefetchedFileId) )
+					{
+						filePrefetcher->enqueue( nextPrefetchedFileId, getFileUri(nextPrefetchedFileId).toNativePath() );
+					}
+					nextPrefetchedFileId++;
+				}
+				recording = filePrefetcher->take( mCurrentFileId );
+				loadFile = (recording != 0);
+			}
+			else
+			{
+				loadFile = isFileToBeLoaded( mCurrentFileId );
+			}
+
+			if ( loadFile )
 			{
 				mFileLoader = new FileLoader(this, 
 					fileUri,
@@ -223,14 +348,47 @@ namespace COLLADASaxFWL
 					mObjectFlags,
 					mParsedObjectFlags, 
 					mExtraDataCallbackHandlerList );
-				bool success = mFileLoader->load();
+				// Libraries are only skipped, if some objects are not loaded
+				bool skipExcludedElements = mExcludedElementSkipping 
+					&& ((mObjectFlags & ALL_OBJECTS_MASK) != ALL_OBJECTS_MASK);
+				bool success = false;
+				if ( recording )
+				{
+					success = mFileLoader->load( *recording );
+				}
+				else if ( mSectionIndex && (mCurrentFileId == rootFileId) )
+				{
+					// Skip the libraries not required, if the root file has been indexed by a previous call
+					// or can be indexed by scanning it
+					String nativePath = fileUri.toNativePath();
+					if ( mSectionIndex->isIndexed(nativePath) 
+						|| (skipExcludedElements && mSectionIndex->scanFile(nativePath)) )
+						success = mFileLoader->load( *mSectionIndex );
+					else
+						success = mFileLoader->load( mInputMode, mSectionIndex );
+				}
+				else if ( skipExcludedElements )
+				{
+					SectionIndex sectionIndex;
+					if ( sectionIndex.scanFile(fileUri.toNativePath()) )
+						success = mFileLoader->load( sectionIndex );
+					else
+						success = mFileLoader->load( mInputMode );
+				}
+				else
+				{
+					success = mFileLoader->load( mInputMode );
+				}
 				delete mFileLoader;
+				delete recording;
 				abortLoading = !success;
 			}
 
 			mCurrentFileId++;
 		}
 
+		delete filePrefetcher;
+
 		if ( !abortLoading )
 		{
 			PostProcessor postProcessor(this, 
@@ -246,6 +404,8 @@ namespace COLLADASaxFWL
 
 		mWriter->finish();
 
+		finishLoading();
+
 		mParsedObjectFlags |= mObjectFlags;
 
 		return !abortLoading;
@@ -256,7 +416,7 @@ namespace COLLADASaxFWL
 	{
 		if ( !writer )
 			return false;
-		mWriter = writer;
+		startLoading( writer );
         
 		SaxParserErrorHandler saxParserErrorHandler(mErrorHandler);
         
@@ -303,6 +463,8 @@ namespace COLLADASaxFWL
         
 		mWriter->finish();
 
+		finishLoading();
+
 		mParsedObjectFlags |= mObjectFlags;
         
 		return !abortLoading;
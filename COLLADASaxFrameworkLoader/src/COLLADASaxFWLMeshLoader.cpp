@@ -21,9 +21,10 @@
 #include "COLLADAFWPolygons.h"
 #include "COLLADAFWPolylist.h"
 #include "COLLADAFWLinestrips.h"
-#include "COLLADAFWIWriter.h"
+#include "COLLADAFWIStreamingWriter.h"
 
 #include <fstream>
+#include <string.h>
 
 
 namespace COLLADASaxFWL
@@ -46,6 +47,7 @@ namespace COLLADASaxFWL
         , mCurrentPhHasEmptyP(true)
         , mCurrentExpectedVertexCount(0)
         , mCurrentFaceOrLineCount(0)
+        , mCurrentCOLLADAPrimitiveCount(0)
 		, mPositionsOffset (0)
 		, mPositionsIndexOffset(0)
 		, mUsePositions ( true )
@@ -56,6 +58,10 @@ namespace COLLADASaxFWL
         , mUseBinormals ( false )
         , mColorList (0)
         , mTexCoordList (0)
+		, mIndexDeinterleaverMeshPrimitive(0)
+		, mStreamingWriter(0)
+		, mStreamedVertexCount(0)
+		, mStreamedFaceCount(0)
 		, mCurrentPrimitiveType(NONE)
 		, mPOrPhElementCountOfCurrentPrimitive(0)
         , mInMesh (true)
@@ -589,120 +595,292 @@ namespace COLLADASaxFWL
 		if ( !mCurrentMeshPrimitive )
 			return true;
 
+		if ( length == 0 )
+			return true;
+
+		if ( mIndexDeinterleaverMeshPrimitive != mCurrentMeshPrimitive )
+			initializeIndexDeinterleaver();
+
 		// Write the index values in the index lists.
-		for ( size_t i=0; i<length; ++i )
+		mIndexDeinterleaver.deinterleave ( data, length, mCurrentOffset );
+
+		// Advance the current offset and count the vertices completed by these indices
+		size_t stride = mCurrentMaxOffset + 1;
+		size_t offsetEnd = mCurrentOffset + length;
+		mCurrentVertexCount += offsetEnd / stride;
+		mCurrentOffset = offsetEnd % stride;
+
+		// Pass the completed faces to a streaming writer. The primitives grouping their vertices by p
+		// elements are passed in end__p
+		switch ( mCurrentPrimitiveType )
 		{
-			// Get the current index value.
-			unsigned int index = (unsigned int)data [i];
+		case TRIANGLES:
+		case LINES:
+		case POLYLIST:
+			return streamMeshPrimitiveBlock ( STREAMING_BLOCK_VERTEX_COUNT );
+		default:
+			return true;
+		}
+	}
+
+	//------------------------------
+	bool MeshLoader::streamMeshPrimitiveBlock( size_t minimumVertexCount )
+	{
+		if ( !mStreamingWriter || !mCurrentMeshPrimitive )
+			return true;
 
-			// Write the indices
-			if ( mUsePositions && (mCurrentOffset == mPositionsOffset) )
+		// Determine the complete faces not passed yet
+		size_t vertexCount = 0;
+		size_t faceCount = 0;
+		switch ( mCurrentPrimitiveType )
+		{
+		case TRIANGLES:
+			faceCount = (mCurrentVertexCount - mStreamedVertexCount) / 3;
+			vertexCount = 3 * faceCount;
+			break;
+		case LINES:
+			faceCount = (mCurrentVertexCount - mStreamedVertexCount) / 2;
+			vertexCount = 2 * faceCount;
+			break;
+		case POLYLIST:
 			{
-				COLLADAFW::UIntValuesArray& positionIndices = mCurrentMeshPrimitive->getPositionIndices();
-				positionIndices.append ( index + mPositionsIndexOffset );
+				const COLLADAFW::Polylist::VertexCountArray& vertexCountArray = 
+					((COLLADAFW::Polylist*)mCurrentMeshPrimitive)->getGroupedVerticesVertexCountArray();
+				size_t availableVertexCount = mCurrentVertexCount - mStreamedVertexCount;
+				for ( size_t i = mStreamedFaceCount, count = vertexCountArray.getCount(); i < count; ++i )
+				{
+					size_t faceVertexCount = (size_t)vertexCountArray[i];
+					if ( vertexCount + faceVertexCount > availableVertexCount )
+						break;
+					vertexCount += faceVertexCount;
+					faceCount++;
+				}
 			}
+			break;
+		default:
+			// Called after a p or ph element only, i.e. the index lists contain complete groups
+			vertexCount = mCurrentMeshPrimitive->getPositionIndices().getCount();
+			faceCount = mCurrentFaceOrLineCount - mStreamedFaceCount;
+			break;
+		}
+
+		if ( (faceCount == 0) || (vertexCount < minimumVertexCount) )
+			return true;
+
+		COLLADAFW::UIntValuesArray* indexArrays[4] = { &mCurrentMeshPrimitive->getPositionIndices(),
+			                                           &mCurrentMeshPrimitive->getNormalIndices(),
+			                                           &mCurrentMeshPrimitive->getTangentIndices(),
+			                                           &mCurrentMeshPrimitive->getBinormalIndices() };
+		COLLADAFW::IndexListArray& uvCoordIndicesArray = mCurrentMeshPrimitive->getUVCoordIndicesArray();
+		COLLADAFW::IndexListArray& colorIndicesArray = mCurrentMeshPrimitive->getColorIndicesArray();
+		size_t uvCoordIndicesCount = uvCoordIndicesArray.getCount();
+		size_t indexArrayCount = 4 + uvCoordIndicesCount + colorIndicesArray.getCount();
+
+		// Hide the indices of incomplete faces, i.e. the indices after vertexCount, from the writer
+		std::vector<size_t> indexCounts( indexArrayCount );
+		for ( size_t i = 0; i < indexArrayCount; ++i )
+		{
+			COLLADAFW::UIntValuesArray& indices = (i < 4) ? *indexArrays[i] 
+				: (i < 4 + uvCoordIndicesCount) ? uvCoordIndicesArray[i - 4]->getIndices()
+				: colorIndicesArray[i - 4 - uvCoordIndicesCount]->getIndices();
+			indexCounts[i] = indices.getCount();
+			if ( indexCounts[i] > vertexCount )
+				indices.setCount( vertexCount );
+		}
+
+		mCurrentMeshPrimitive->setFaceCount( faceCount );
 
-			if ( mUseNormals && (mCurrentOffset == mNormalsOffset) )
+		bool success = true;
+		if ( mCurrentPrimitiveType == POLYLIST )
+		{
+			// Let the vertex count array refer to the faces of this block only
+			COLLADAFW::Polylist::VertexCountArray& vertexCountArray = 
+				((COLLADAFW::Polylist*)mCurrentMeshPrimitive)->getGroupedVerticesVertexCountArray();
+			int* vertexCounts = vertexCountArray.getData();
+			size_t vertexCountsCount = vertexCountArray.getCount();
+			size_t vertexCountsCapacity = vertexCountArray.getCapacity();
+			vertexCountArray.setData( vertexCounts + mStreamedFaceCount, faceCount );
+			success = mStreamingWriter->writeMeshPrimitive( mMesh, mCurrentMeshPrimitive );
+			vertexCountArray.setData( vertexCounts, vertexCountsCount, vertexCountsCapacity );
+		}
+		else
+		{
+			success = mStreamingWriter->writeMeshPrimitive( mMesh, mCurrentMeshPrimitive );
+		}
+
+		// Move the indices of incomplete faces to the front
+		for ( size_t i = 0; i < indexArrayCount; ++i )
+		{
+			COLLADAFW::UIntValuesArray& indices = (i < 4) ? *indexArrays[i] 
+				: (i < 4 + uvCoordIndicesCount) ? uvCoordIndicesArray[i - 4]->getIndices()
+				: colorIndicesArray[i - 4 - uvCoordIndicesCount]->getIndices();
+			size_t remainingCount = (indexCounts[i] > vertexCount) ? (indexCounts[i] - vertexCount) : 0;
+			if ( remainingCount > 0 )
+				memmove( indices.getData(), indices.getData() + vertexCount, remainingCount * sizeof(unsigned int) );
+			indices.setCount( remainingCount );
+		}
+
+		// The groups of the block have been passed completely
+		switch ( mCurrentPrimitiveType )
+		{
+		case TRIFANS:
+			((COLLADAFW::Trifans*)mCurrentMeshPrimitive)->getGroupedVerticesVertexCountArray().setCount( 0 );
+			((COLLADAFW::Trifans*)mCurrentMeshPrimitive)->setTrifanCount( 0 );
+			break;
+		case TRISTRIPS:
+			((COLLADAFW::Tristrips*)mCurrentMeshPrimitive)->getGroupedVerticesVertexCountArray().setCount( 0 );
+			((COLLADAFW::Tristrips*)mCurrentMeshPrimitive)->setTristripCount( 0 );
+			break;
+		case LINESTRIPS:
+			((COLLADAFW::Linestrips*)mCurrentMeshPrimitive)->getGroupedVerticesVertexCountArray().setCount( 0 );
+			((COLLADAFW::Linestrips*)mCurrentMeshPrimitive)->setLinestripCount( 0 );
+			break;
+		case POLYGONS:
+		case POLYGONS_HOLE:
+			((COLLADAFW::Polygons*)mCurrentMeshPrimitive)->getGroupedVerticesVertexCountArray().setCount( 0 );
+			break;
+		default:
+			break;
+		}
+
+		mStreamedVertexCount += vertexCount;
+		mStreamedFaceCount += faceCount;
+		return success;
+	}
+
+	//------------------------------
+	bool MeshLoader::endStreamedMeshPrimitive()
+	{
+		bool success = true;
+		// As in end__polylist(), a polylist with less vertices than required by its vcount is discarded.
+		// The blocks passed before the end tag cannot be withdrawn, the error handler is told about them
+		if ( (mCurrentPrimitiveType == POLYLIST) && (mCurrentVertexCount < mCurrentExpectedVertexCount) )
+		{
+			if ( mStreamedFaceCount > 0 )
 			{
-				COLLADAFW::UIntValuesArray& normalIndices = mCurrentMeshPrimitive->getNormalIndices();
-				normalIndices.append ( index + mNormalsIndexOffset );
+				std::ostringstream msg;
+				msg << "Polylist of mesh \"" << mMesh->getOriginalId() << "\" contains " << mCurrentVertexCount
+					<< " of the " << mCurrentExpectedVertexCount << " vertices required by its vcount. The "
+					<< mStreamedFaceCount << " faces already passed to the streaming writer remain written.";
+				if ( handleFWLError( SaxFWLError::ERROR_DATA_NOT_VALID, msg.str() ) )
+					success = false;
 			}
+		}
+		else
+		{
+			success = streamMeshPrimitiveBlock( 0 );
+		}
+		delete mCurrentMeshPrimitive;
+		initCurrentValues();
+		mMeshPrimitiveInputs.clearInputs();
+		mCurrentPrimitiveType = NONE;
+		return success;
+	}
+
+    //------------------------------
+	void MeshLoader::initializeIndexDeinterleaver()
+	{
+		mIndexDeinterleaver.reset ( mCurrentMaxOffset + 1 );
+
+		if ( mUsePositions )
+			mIndexDeinterleaver.addDestination ( (size_t)mPositionsOffset, mCurrentMeshPrimitive->getPositionIndices(), mPositionsIndexOffset );
 
-            if ( mUseTangents && (mCurrentOffset == mTangentsOffset) )
+		if ( mUseNormals )
+			mIndexDeinterleaver.addDestination ( (size_t)mNormalsOffset, mCurrentMeshPrimitive->getNormalIndices(), mNormalsIndexOffset );
+
+		if ( mUseTangents )
+			mIndexDeinterleaver.addDestination ( (size_t)mTangentsOffset, mCurrentMeshPrimitive->getTangentIndices(), mTangentsIndexOffset );
+
+		if ( mUseBinormals )
+			mIndexDeinterleaver.addDestination ( (size_t)mBinormalsOffset, mCurrentMeshPrimitive->getBinormalIndices(), mBinormalsIndexOffset );
+
+        size_t numTexCoordinates = mTexCoordList.size();
+        if ( numTexCoordinates > 0 )
+        {
+            COLLADAFW::ArrayPrimitiveType<COLLADAFW::IndexList*>& texCoordIndicesArray = 
+                mCurrentMeshPrimitive->getUVCoordIndicesArray();
+
+            // Resize the array if necessary
+            if ( texCoordIndicesArray.getCount () != numTexCoordinates ) 
             {
-                COLLADAFW::UIntValuesArray& tangentIndices = mCurrentMeshPrimitive->getTangentIndices();
-                tangentIndices.append ( index + mTangentsIndexOffset );
+                // Be careful: no constructor is called!
+                texCoordIndicesArray.reallocMemory ( numTexCoordinates );
+                for ( size_t k=0; k<numTexCoordinates; ++k )
+                {
+                    COLLADAFW::IndexList* texCoordIndices = new COLLADAFW::IndexList ();
+                    PrimitiveInput& tex = mTexCoordList [k];
+                    texCoordIndices->setSetIndex ( tex.mSetIndex );
+                    texCoordIndices->setName ( tex.mName );
+                    texCoordIndices->setStride ( tex.mStride );
+                    texCoordIndices->setInitialIndex ( tex.mInitialIndex );
+
+                    texCoordIndicesArray.append( texCoordIndices );
+                }
             }
 
-            if ( mUseBinormals && (mCurrentOffset == mBinormalsOffset) )
+            for ( size_t j=0; j<numTexCoordinates; ++j )
             {
-                COLLADAFW::UIntValuesArray& binormalIndices = mCurrentMeshPrimitive->getBinormalIndices();
-                binormalIndices.append ( index + mBinormalsIndexOffset );
+                PrimitiveInput& texCoord = mTexCoordList[j];
+                COLLADAFW::IndexList* texCoordIndices = mCurrentMeshPrimitive->getUVCoordIndices ( j );
+                mIndexDeinterleaver.addDestination ( texCoord.mOffset, texCoordIndices->getIndices(), (unsigned int)texCoord.mInitialIndex );
             }
+        }
 
+        size_t numColors = mColorList.size ();
+        if ( numColors > 0 )
+        {
+            COLLADAFW::ArrayPrimitiveType<COLLADAFW::IndexList*>& colorIndicesArray = 
+                mCurrentMeshPrimitive->getColorIndicesArray ();
 
-            // Look if the current offset is a texcoord offset.
-            size_t numTexCoordinates = mTexCoordList.size();
-            for ( size_t j=0; j<numTexCoordinates; ++j )
+            // Resize the array if necessary
+            if ( colorIndicesArray.getCount () != numColors ) 
             {
-                PrimitiveInput& texCoord = mTexCoordList[j];
-                if ( mCurrentOffset == texCoord.mOffset )
+                // Be careful: no constructor is called!
+                colorIndicesArray.reallocMemory ( numColors );
+                for ( size_t k=0; k<numColors; ++k )
                 {
-                    COLLADAFW::ArrayPrimitiveType<COLLADAFW::IndexList*>& texCoordIndicesArray = 
-                        mCurrentMeshPrimitive->getUVCoordIndicesArray();
-
-                    // Resize the array if necessary
-                    if ( texCoordIndicesArray.getCount () != numTexCoordinates ) 
-                    {
-                        // Be careful: no constructor is called!
-                        texCoordIndicesArray.reallocMemory ( numTexCoordinates );
-                        for ( size_t k=0; k<numTexCoordinates; ++k )
-                        {
-                            COLLADAFW::IndexList* texCoordIndices = new COLLADAFW::IndexList ();
-                            PrimitiveInput& tex = mTexCoordList [k];
-                            texCoordIndices->setSetIndex ( tex.mSetIndex );
-                            texCoordIndices->setName ( tex.mName );
-                            texCoordIndices->setStride ( tex.mStride );
-                            texCoordIndices->setInitialIndex ( tex.mInitialIndex );
-
-                            texCoordIndicesArray.append( texCoordIndices );
-                        }
-                    }
-
-                    // Write the values.
-                    COLLADAFW::IndexList* texCoordIndices = mCurrentMeshPrimitive->getUVCoordIndices ( j );
-                    texCoordIndices->getIndices().append ( index + (unsigned int)texCoord.mInitialIndex );
+                    COLLADAFW::IndexList* colorIndices = new COLLADAFW::IndexList ();
+                    PrimitiveInput& col = mColorList [k];
+                    colorIndices->setSetIndex ( col.mSetIndex );
+                    colorIndices->setName ( col.mName );
+                    colorIndices->setStride ( col.mStride );
+                    colorIndices->setInitialIndex ( col.mInitialIndex );
+
+                    colorIndicesArray.append ( colorIndices );
                 }
             }
 
-            // Look if the current offset is a texcoord offset.
-            size_t numColors = mColorList.size ();
             for ( size_t j=0; j<numColors; ++j )
             {
                 PrimitiveInput& color = mColorList [j];
-                if ( mCurrentOffset == color.mOffset )
-                {
-                    COLLADAFW::ArrayPrimitiveType<COLLADAFW::IndexList*>& colorIndicesArray = 
-                        mCurrentMeshPrimitive->getColorIndicesArray ();
-
-                    // Resize the array if necessary
-                    if ( colorIndicesArray.getCount () != numColors ) 
-                    {
-                        // Be careful: no constructor is called!
-                        colorIndicesArray.reallocMemory ( numColors );
-                        for ( size_t k=0; k<numColors; ++k )
-                        {
-                            COLLADAFW::IndexList* colorIndices = new COLLADAFW::IndexList ();
-                            PrimitiveInput& col = mColorList [k];
-                            colorIndices->setSetIndex ( col.mSetIndex );
-                            colorIndices->setName ( col.mName );
-                            colorIndices->setStride ( col.mStride );
-                            colorIndices->setInitialIndex ( col.mInitialIndex );
-
-                            colorIndicesArray.append ( colorIndices );
-                        }
-                    }
-
-                    // Write the values.
-                    COLLADAFW::IndexList* colorIndices = mCurrentMeshPrimitive->getColorIndices ( j );
-                    colorIndices->getIndices().append ( index + (unsigned int)color.mInitialIndex );
-                }
+                COLLADAFW::IndexList* colorIndices = mCurrentMeshPrimitive->getColorIndices ( j );
+                mIndexDeinterleaver.addDestination ( color.mOffset, colorIndices->getIndices(), (unsigned int)color.mInitialIndex );
             }
+        }
 
-			// Reset the offset if we went through all offset values
-			if ( mCurrentOffset == mCurrentMaxOffset )
-			{
-				// Reset the current offset value
-				mCurrentOffset = 0;
-				++mCurrentVertexCount;
-			}
-			else
-			{
-				// Increment the current offset value
-				++mCurrentOffset;
-			}
+		// Pre-alloc memory for all the vertices, if their number is known in advance
+		size_t expectedVertexCount = 0;
+		switch ( mCurrentPrimitiveType )
+		{
+		case TRIANGLES:
+			expectedVertexCount = 3 * mCurrentCOLLADAPrimitiveCount;
+			break;
+		case LINES:
+			expectedVertexCount = 2 * mCurrentCOLLADAPrimitiveCount;
+			break;
+		case POLYLIST:
+			expectedVertexCount = mCurrentExpectedVertexCount;
+			break;
+		default:
+			break;
 		}
-		return true;
+		// A streaming writer receives the indices in blocks, which need less memory
+		if ( mStreamingWriter && (expectedVertexCount > STREAMING_BLOCK_VERTEX_COUNT) )
+			expectedVertexCount = STREAMING_BLOCK_VERTEX_COUNT;
+		if ( expectedVertexCount > 0 )
+			mIndexDeinterleaver.reserve ( expectedVertexCount );
+
+		mIndexDeinterleaverMeshPrimitive = mCurrentMeshPrimitive;
 	}
 
 
@@ -722,6 +900,7 @@ namespace COLLADASaxFWL
         mUseBinormals = false;
         mTexCoordList.clear ();
         mColorList.clear ();
+		mIndexDeinterleaverMeshPrimitive = 0;
 
 		// We need the maximum offset value of the input elements to calculate the 
 		// number of indices for each index list.
@@ -974,6 +1153,8 @@ namespace COLLADASaxFWL
 		mCurrentFaceOrLineCount = 0;
 		mCurrentPhHasEmptyP = true;
 		mPOrPhElementCountOfCurrentPrimitive = 0;
+		mStreamedVertexCount = 0;
+		mStreamedFaceCount = 0;
 	}
 
 	//------------------------------
@@ -1038,26 +1219,8 @@ namespace COLLADASaxFWL
 	{
 		mCurrentPrimitiveType = TRIANGLES;
 		mCurrentMeshPrimitive = new COLLADAFW::Triangles(createUniqueId(COLLADAFW::Triangles::ID()));
-		if ( (size_t)attributeData.count > 0)
-		{
-			mCurrentMeshPrimitive->getPositionIndices().reallocMemory((size_t)attributeData.count);
-			if ( mUseNormals )
-			{
-				mCurrentMeshPrimitive->getNormalIndices().reallocMemory((size_t)attributeData.count);
-			}
-
-            if ( mUseTangents )
-            {
-                mCurrentMeshPrimitive->getTangentIndices().reallocMemory((size_t)attributeData.count);
-            }
-
-            if ( mUseBinormals )
-            {
-                mCurrentMeshPrimitive->getBinormalIndices().reallocMemory((size_t)attributeData.count);
-            }
-
-			// TODO pre-alloc memory for uv indices
-		}
+		// Used by initializeIndexDeinterleaver() to pre-alloc memory for the indices
+		mCurrentCOLLADAPrimitiveCount = (size_t)attributeData.count;
 		if ( attributeData.material )
 		{
 			mCurrentMeshPrimitive->setMaterialId(mMaterialIdInfo.getMaterialId(attributeData.material));
@@ -1069,6 +1232,9 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__triangles()
 	{
+		if ( mStreamingWriter )
+			return endStreamedMeshPrimitive();
+
 		size_t trianglesCount = mCurrentVertexCount/3;
 		// check if the triangles really contains triangles. If not, we will discard it
 		if ( trianglesCount > 0 )
@@ -1129,6 +1295,9 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__polylist()
 	{
+		if ( mStreamingWriter )
+			return endStreamedMeshPrimitive();
+
 		// check if there are enough vertices as expected by the vcount and that there exist at least
 		// one polygon. If not, we will discard it
 		if ( mCurrentVertexCount >= mCurrentExpectedVertexCount && mCurrentVertexCount > 0 )
@@ -1188,6 +1357,9 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__linestrips()
 	{
+		if ( mStreamingWriter )
+			return endStreamedMeshPrimitive();
+
 		mCurrentPrimitiveType = LINESTRIPS;
 		// check if there is at least one linestrip. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
@@ -1253,6 +1425,9 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__polygons()
 	{
+		if ( mStreamingWriter )
+			return endStreamedMeshPrimitive();
+
 		// check if there is at least one polygon. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
 		{
@@ -1282,7 +1457,7 @@ namespace COLLADASaxFWL
 	{
 		mCurrentPrimitiveType = POLYGONS;
 		mPOrPhElementCountOfCurrentPrimitive++;
-		return true;
+		return streamMeshPrimitiveBlock( STREAMING_BLOCK_VERTEX_COUNT );
 	}
 
 	//------------------------------
@@ -1333,6 +1508,9 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__tristrips()
 	{
+		if ( mStreamingWriter )
+			return endStreamedMeshPrimitive();
+
 		mCurrentPrimitiveType = TRISTRIPS;
 		// check if there is at least one tristrip. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
@@ -1369,6 +1547,9 @@ namespace COLLADASaxFWL
 	//------------------------------
 	bool MeshLoader::end__trifans()
 	{
+		if ( mStreamingWriter )
+			return endStreamedMeshPrimitive();
+
 		// check if there is at least one trifan. If not, we will discard it.
 		if ( mCurrentFaceOrLineCount > 0 )
 		{
@@ -1403,15 +1584,6 @@ namespace COLLADASaxFWL
 				if (initializeOffsets())
 					return false; // abort
                 mCurrentMeshPrimitive = new COLLADAFW::Lines(createUniqueId(COLLADAFW::Lines::ID()));
-                if ( mCurrentCOLLADAPrimitiveCount > 0)
-                {
-                    mCurrentMeshPrimitive->getPositionIndices().reallocMemory(mCurrentCOLLADAPrimitiveCount);
-                    if ( mUseNormals )
-                    {
-                        mCurrentMeshPrimitive->getNormalIndices().reallocMemory(mCurrentCOLLADAPrimitiveCount);
-                    }
-                    // TODO pre-alloc memory for uv indices
-                }
                 mCurrentMeshPrimitive->setMaterialId(mMaterialIdInfo.getMaterialId(mCurrentMeshMaterial));
 				mCurrentMeshPrimitive->setMaterial(mCurrentMeshMaterial);
             }
@@ -1485,6 +1657,13 @@ namespace COLLADASaxFWL
 			break;
         case LINES:
             {
+                if ( mStreamingWriter )
+                {
+                    bool success = streamMeshPrimitiveBlock( 0 );
+                    delete mCurrentMeshPrimitive;
+                    initCurrentValues();
+                    return success;
+                }
                 size_t linesCount = mCurrentVertexCount/2;
                 // check if the lines really contains lines. If not, we will discard it
                 if ( linesCount > 0 )
@@ -1628,7 +1807,11 @@ namespace COLLADASaxFWL
         case NONE:
             return false;
 		}
-		return true;
+
+		// The holes of a ph element follow its p element
+		if ( mCurrentPrimitiveType == POLYGONS_HOLE )
+			return true;
+		return streamMeshPrimitiveBlock( STREAMING_BLOCK_VERTEX_COUNT );
 	}
 
 	//------------------------------
@@ -0,0 +1,227 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLSectionIndex.h"
+
+#include "GeneratedSaxParserCompressedFileReader.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserUtils.h"
+#include "GeneratedSaxParserXmlScanner.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	SectionIndex::SectionIndex()
+		: mFileSize(-1)
+		, mModificationTime(0)
+		, mPrologEnd(0)
+		, mDocumentEnd(0)
+	{
+	}
+
+	//------------------------------
+	SectionIndex::~SectionIndex()
+	{
+	}
+
+	//------------------------------
+	void SectionIndex::clear()
+	{
+		mFileName.clear();
+		mFileSize = -1;
+		mModificationTime = 0;
+		mPrologEnd = 0;
+		mDocumentEnd = 0;
+		mSections.clear();
+	}
+
+	//------------------------------
+	bool SectionIndex::isIndexed( const String& fileName ) const
+	{
+		if ( mFileName.empty() || (mFileName != fileName) || (mFileSize < 0) )
+			return false;
+
+		// The file might have been changed since it has been indexed
+		long long fileSize = 0;
+		time_t modificationTime = 0;
+		if ( !getFileState(fileName, fileSize, modificationTime) )
+			return false;
+		return (fileSize == mFileSize) && (modificationTime == mModificationTime);
+	}
+
+	//------------------------------
+	void SectionIndex::recordFileState( const String& fileName )
+	{
+		if ( !getFileState(fileName, mFileSize, mModificationTime) )
+		{
+			mFileSize = -1;
+			mModificationTime = 0;
+		}
+	}
+
+	//------------------------------
+	bool SectionIndex::getFileState( const String& fileName, long long& fileSize, time_t& modificationTime )
+	{
+		struct stat fileStat;
+		if ( stat(fileName.c_str(), &fileStat) != 0 )
+			return false;
+		fileSize = (long long)fileStat.st_size;
+		modificationTime = fileStat.st_mtime;
+		return true;
+	}
+
+	//------------------------------
+	bool SectionIndex::scanFile( const String& fileName )
+	{
+		GeneratedSaxParser::MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName.c_str()) )
+			return false;
+
+		// The ranges of compressed files refer to the inflated document, which is not in memory
+		if ( GeneratedSaxParser::CompressedFileReader::getFormat(mappedFile.getData(), mappedFile.getSize()) != GeneratedSaxParser::CompressedFileReader::FORMAT_UNCOMPRESSED )
+			return false;
+
+		return scan( fileName, mappedFile.getData(), mappedFile.getSize() );
+	}
+
+	//------------------------------
+	bool SectionIndex::scan( const String& fileName, const char* data, size_t length )
+	{
+		typedef GeneratedSaxParser::XmlScanner XmlScanner;
+
+		clear();
+		recordFileState( fileName );
+
+		const char* dataEnd = data + length;
+
+		// UTF-16 and UTF-32 documents start with a byte order mark or a zero byte
+		if ( (length < 2) || (data[0] == 0) || (data[1] == 0) || ((unsigned char)data[0] == 0xfe) || ((unsigned char)data[0] == 0xff) )
+			return false;
+
+		// The prolog ends behind the start tag of the COLLADA element
+		const char* pos = data;
+		XmlScanner::MarkupType type = XmlScanner::MARKUP_OTHER;
+		while ( type == XmlScanner::MARKUP_OTHER )
+		{
+			pos = XmlScanner::findMarkup( pos, dataEnd );
+			if ( pos == dataEnd )
+				return false;
+			pos = XmlScanner::skipMarkup( pos, dataEnd, type );
+			if ( !pos )
+				return false;
+		}
+		if ( type != XmlScanner::MARKUP_START_TAG )
+			return false;
+		mPrologEnd = pos - data;
+
+		size_t sectionBegin = mPrologEnd;
+		while ( true )
+		{
+			const char* markup = XmlScanner::findMarkup( pos, dataEnd );
+			if ( markup == dataEnd )
+				break;
+
+			pos = XmlScanner::skipMarkup( markup, dataEnd, type );
+			if ( !pos )
+				break;
+
+			if ( type == XmlScanner::MARKUP_END_TAG )
+			{
+				mDocumentEnd = pos - data;
+				mFileName = fileName;
+				return true;
+			}
+			else if ( type == XmlScanner::MARKUP_OTHER )
+			{
+				// Comments and processing instructions belong to the following section
+				continue;
+			}
+
+			if ( type == XmlScanner::MARKUP_START_TAG )
+			{
+				pos = XmlScanner::skipElement( markup, dataEnd );
+				if ( !pos )
+					break;
+			}
+
+			size_t nameLength = 0;
+			const char* name = XmlScanner::getElementName( markup, dataEnd, nameLength );
+			const char* localName = name;
+			for ( const char* c = name; c < name + nameLength; ++c )
+			{
+				if ( *c == ':' )
+					localName = c + 1;
+			}
+
+			Section section;
+			section.elementHash = GeneratedSaxParser::Utils::calculateStringHash( localName, name + nameLength - localName );
+			section.begin = sectionBegin;
+			section.end = pos - data;
+			mSections.push_back( section );
+			sectionBegin = section.end;
+		}
+
+		clear();
+		return false;
+	}
+
+	//------------------------------
+	void SectionIndex::getFileRanges( const StringHash* elementHashes,
+									  size_t elementHashCount,
+									  GeneratedSaxParser::SaxParser::FileRangeList& ranges ) const
+	{
+		ranges.clear();
+
+		GeneratedSaxParser::SaxParser::FileRange prolog = { 0, mPrologEnd };
+		ranges.push_back( prolog );
+
+		for ( SectionList::const_iterator it = mSections.begin(); it != mSections.end(); ++it )
+		{
+			const Section& section = *it;
+			bool selected = false;
+			for ( size_t i = 0; (i < elementHashCount) && !selected; ++i )
+			{
+				selected = (elementHashes[i] == section.elementHash);
+			}
+			if ( !selected )
+				continue;
+
+			// Adjacent sections are passed in one range
+			if ( ranges.back().end == section.begin )
+			{
+				ranges.back().end = section.end;
+			}
+			else
+			{
+				GeneratedSaxParser::SaxParser::FileRange range = { section.begin, section.end };
+				ranges.push_back( range );
+			}
+		}
+
+		// The end tag of the COLLADA element follows the last section
+		size_t epilogBegin = mSections.empty() ? mPrologEnd : mSections.back().end;
+		if ( ranges.back().end == epilogBegin )
+		{
+			ranges.back().end = mDocumentEnd;
+		}
+		else
+		{
+			GeneratedSaxParser::SaxParser::FileRange epilog = { epilogBegin, mDocumentEnd };
+			ranges.push_back( epilog );
+		}
+	}
+
+} // namespace COLLADASaxFWL
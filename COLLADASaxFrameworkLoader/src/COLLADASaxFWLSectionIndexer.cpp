@@ -0,0 +1,95 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLSectionIndexer.h"
+#include "COLLADASaxFWLSectionIndex.h"
+
+#include "GeneratedSaxParserSaxParser.h"
+#include "GeneratedSaxParserUtils.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	SectionIndexer::SectionIndexer( SectionIndex& sectionIndex,
+									const String& fileName,
+									GeneratedSaxParser::Parser* parser,
+									GeneratedSaxParser::IErrorHandler* errorHandler )
+		: GeneratedSaxParser::Parser( errorHandler )
+		, mSectionIndex( sectionIndex )
+		, mFileName( fileName )
+		, mParser( parser )
+		, mDepth( 0 )
+		, mLastOffset( 0 )
+	{
+		mSectionIndex.clear();
+		mSectionIndex.recordFileState( mFileName );
+	}
+
+	//------------------------------
+	SectionIndexer::~SectionIndexer()
+	{
+	}
+
+	//------------------------------
+	bool SectionIndexer::elementBegin( const ParserChar* elementName, const ParserAttributes& attributes )
+	{
+		if ( mDepth == 0 )
+		{
+			mSectionIndex.mPrologEnd = getSaxParser()->getByteOffset();
+			mLastOffset = mSectionIndex.mPrologEnd;
+		}
+		else if ( mDepth == 1 )
+		{
+			SectionIndex::Section section;
+			section.elementHash = GeneratedSaxParser::Utils::calculateStringHashWithNamespace( elementName ).second;
+			section.begin = mLastOffset;
+			section.end = 0;
+			mSectionIndex.mSections.push_back( section );
+		}
+		mDepth++;
+
+		return mParser->elementBegin( elementName, attributes );
+	}
+
+	//------------------------------
+	bool SectionIndexer::elementEnd( const ParserChar* elementName )
+	{
+		mDepth--;
+		if ( mDepth == 1 )
+		{
+			mLastOffset = getSaxParser()->getByteOffset();
+			mSectionIndex.mSections.back().end = mLastOffset;
+		}
+		else if ( mDepth == 0 )
+		{
+			// The index is complete, once the end of the COLLADA element has been reached
+			mSectionIndex.mDocumentEnd = getSaxParser()->getByteOffset();
+			mSectionIndex.mFileName = mFileName;
+		}
+
+		return mParser->elementEnd( elementName );
+	}
+
+	//------------------------------
+	bool SectionIndexer::textData( const ParserChar* text, size_t textLength )
+	{
+		// Text between the sections is not part of any section
+		if ( mDepth == 1 )
+		{
+			mLastOffset = getSaxParser()->getByteOffset();
+		}
+
+		return mParser->textData( text, textLength );
+	}
+
+} // namespace COLLADASaxFWL
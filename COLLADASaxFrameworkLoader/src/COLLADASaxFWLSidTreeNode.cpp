@@ -18,28 +18,11 @@ namespace COLLADASaxFWL
 
 
 	//------------------------------
-	bool SidTreeNode::SidIdentifier::operator<( const SidIdentifier& rhs ) const
-	{
-		if ( sid < rhs.sid)
-			return true;
-
-		if ( sid > rhs.sid)
-			return false;
-
-		if ( hierarchyLevel < rhs.hierarchyLevel)
-			return true;
-
-		if ( hierarchyLevel > rhs.hierarchyLevel)
-			return false;
-
-		return false;
-	}
-
-	//------------------------------
-	SidTreeNode::SidTreeNode(const String& sid, SidTreeNode *parent)
+	SidTreeNode::SidTreeNode(const String& sid, SidTreeNode *parent, StringAtomTable& sidAtomTable)
 		: mParent(parent)
 		, mTargetType(TARGETTYPECLASS_UNKNOWN)
 		, mSid(sid)
+		, mSidAtomTable(&sidAtomTable)
 	{
 		mTarget.object = 0;
 	}
@@ -57,33 +40,43 @@ namespace COLLADASaxFWL
 	//------------------------------
 	SidTreeNode* SidTreeNode::createAndAddChild( const String& sid )
 	{
-		SidTreeNode* newChild = new SidTreeNode(sid, this);
+		SidTreeNode* newChild = new SidTreeNode(sid, this, *mSidAtomTable);
 		mDirectChildren.push_back(newChild);
 		if ( !sid.empty() )
 		{
-			SidIdentifier newIdentifier(newChild->getSid(), 0);
-			mChildren.insert(std::make_pair(newIdentifier, newChild));
-			addChildToParents( newChild, newIdentifier );
+			StringAtomTable::Atom sidAtom = mSidAtomTable->intern(sid);
+			addChild( newChild, sidAtom, 0 );
+			addChildToParents( newChild, sidAtom, 0 );
 		}
 		return newChild;
 	}
 
 	//------------------------------
-	void SidTreeNode::addChildToParents( SidTreeNode *sidTreeNode, const SidIdentifier& sidIdentifier )
+	void SidTreeNode::addChild( SidTreeNode *sidTreeNode, StringAtomTable::Atom sidAtom, size_t hierarchyLevel )
+	{
+		std::pair<AtomSidChildMap::iterator, bool> inserted = mChildren.insert(std::make_pair(sidAtom, SidChild(sidTreeNode, hierarchyLevel)));
+		if ( !inserted.second && (hierarchyLevel < inserted.first->second.hierarchyLevel) )
+		{
+			inserted.first->second = SidChild(sidTreeNode, hierarchyLevel);
+		}
+	}
+
+	//------------------------------
+	void SidTreeNode::addChildToParents( SidTreeNode *sidTreeNode, StringAtomTable::Atom sidAtom, size_t hierarchyLevel )
 	{
 		if ( sidTreeNode )
 		{
 			SidTreeNode *parent = getParent();
 			if ( parent )
 			{
-				SidIdentifier parentSidIdentifier = sidIdentifier;
+				size_t parentHierarchyLevel = hierarchyLevel;
 				// if the parent has no sid, i.e. it has an id, we don't increase the hierarchy level.*/
 				if ( !parent->getSid().empty() )
 				{
-					parentSidIdentifier.hierarchyLevel++;
+					parentHierarchyLevel++;
 				}
-				parent->mChildren.insert(std::make_pair(parentSidIdentifier, sidTreeNode));
-				parent->addChildToParents( sidTreeNode, parentSidIdentifier );
+				parent->addChild( sidTreeNode, sidAtom, parentHierarchyLevel );
+				parent->addChildToParents( sidTreeNode, sidAtom, parentHierarchyLevel );
 			}
 		}
 	}
@@ -91,21 +84,21 @@ namespace COLLADASaxFWL
 	//------------------------------
 	SidTreeNode* SidTreeNode::findChildBySid( const String& sid )
 	{
-		SidIdentifier lowerBound( sid, 0);
-		SidIdentifierSidTreeNodeMap::iterator it = mChildren.lower_bound( lowerBound );
+		StringAtomTable::Atom sidAtom = mSidAtomTable->find( sid );
+		if ( sidAtom == StringAtomTable::INVALID_ATOM )
+			return 0;
+		return findChildBySid( sidAtom );
+	}
+
+	//------------------------------
+	SidTreeNode* SidTreeNode::findChildBySid( StringAtomTable::Atom sidAtom )
+	{
+		AtomSidChildMap::const_iterator it = mChildren.find( sidAtom );
 
 		if ( it == mChildren.end() )
 			return 0;
 
-		SidIdentifier canidate = it->first;
-		if ( canidate.sid == sid )
-		{
-			return it->second;
-		}
-		else
-		{
-			return 0;
-		}
+		return it->second.node;
 	}
 
 } // namespace COLLADASaxFWL
@@ -0,0 +1,50 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License, 
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "COLLADASaxFWLStableHeaders.h"
+#include "COLLADASaxFWLStringAtomTable.h"
+
+
+namespace COLLADASaxFWL
+{
+
+	//------------------------------
+	StringAtomTable::StringAtomTable()
+	{
+	}
+
+	//------------------------------
+	StringAtomTable::~StringAtomTable()
+	{
+	}
+
+	//------------------------------
+	StringAtomTable::Atom StringAtomTable::intern( const String& str )
+	{
+		// atoms start at 1, 0 is INVALID_ATOM
+		std::pair<StringAtomMap::iterator, bool> inserted = mAtoms.insert( std::make_pair(str, mAtoms.size() + 1) );
+		return inserted.first->second;
+	}
+
+	//------------------------------
+	StringAtomTable::Atom StringAtomTable::find( const String& str ) const
+	{
+		StringAtomMap::const_iterator it = mAtoms.find( str );
+		if ( it == mAtoms.end() )
+		{
+			return INVALID_ATOM;
+		}
+		else
+		{
+			return it->second;
+		}
+	}
+
+} // namespace COLLADASaxFWL
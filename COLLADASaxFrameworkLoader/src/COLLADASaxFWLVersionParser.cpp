@@ -13,8 +13,13 @@
 #include "COLLADASaxFWLFileLoader.h"
 #include "COLLADASaxFWLRootParser14.h"
 #include "COLLADASaxFWLRootParser15.h"
+#include "COLLADASaxFWLSectionIndex.h"
+#include "COLLADASaxFWLSectionIndexer.h"
 
 #include "GeneratedSaxParserUtils.h"
+#include "GeneratedSaxParserRecordedSaxParser.h"
+
+#include <vector>
 
 namespace COLLADASaxFWL
 {
@@ -52,6 +57,38 @@ namespace COLLADASaxFWL
         COLLADA_SCENE                        = 1<<21
     };
 
+    struct LibraryFlagsElementNamePair
+    {
+        LibraryFlags flag;
+        const char* elementName;
+    };
+
+    LibraryFlagsElementNamePair libraryFlagsElementNameMap[] = {
+        {COLLADA_ASSET, "asset"},
+        {COLLADA_LIBRARY_ANIMATION_CLIPS, "library_animation_clips"},
+        {COLLADA_LIBRARY_ANIMATIONS, "library_animations"},
+        {COLLADA_LIBRARY_ARTICULATED_SYSTEMS, "library_articulated_systems"},
+        {COLLADA_LIBRARY_CAMERAS, "library_cameras"},
+        {COLLADA_LIBRARY_CONTROLLERS, "library_controllers"},
+        {COLLADA_LIBRARY_EFFECTS, "library_effects"},
+        {COLLADA_LIBRARY_FORCE_FIELDS, "library_force_fields"},
+        {COLLADA_LIBRARY_FORMULAS, "library_formulas"},
+        {COLLADA_LIBRARY_GEOMETRIES, "library_geometries"},
+        {COLLADA_LIBRARY_IMAGES, "library_images"},
+        {COLLADA_LIBRARY_JOINTS, "library_joints"},
+        {COLLADA_LIBRARY_KINEMATICS_MODELS, "library_kinematics_models"},
+        {COLLADA_LIBRARY_KINEMATICS_SCENES, "library_kinematics_scenes"},
+        {COLLADA_LIBRARY_LIGHTS, "library_lights"},
+        {COLLADA_LIBRARY_MATERIALS, "library_materials"},
+        {COLLADA_LIBRARY_NODES, "library_nodes"},
+        {COLLADA_LIBRARY_PHYSICS_MATERIALS, "library_physics_materials"},
+        {COLLADA_LIBRARY_PHYSICS_MODELS, "library_physics_models"},
+        {COLLADA_LIBRARY_PHYSICS_SCENES, "library_physics_scenes"},
+        {COLLADA_LIBRARY_VISUAL_SCENES, "library_visual_scenes"},
+        {COLLADA_SCENE, "scene"}};
+
+    size_t libraryFlagsElementNameMapSize = sizeof(libraryFlagsElementNameMap)/sizeof(LibraryFlagsElementNamePair);
+
     struct LibraryFlagsFunctionMapPair14
     {
         LibraryFlags flag;
@@ -161,113 +198,122 @@ namespace COLLADASaxFWL
     }
 
     //------------------------------
-    template<class FlagsMapPair, class ElementFunctionMap>
-    void createFunctionMap( int flags, int& parsedFlags, ElementFunctionMap& functionMap, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    /** Returns the LibraryFlags of the COLLADA elements required to parse all the objects in @a flags.
+    Adds the ObjectFlags of the objects that will have been parsed additionally to @a afterLoadParsedObjectFlags.*/
+    int calculateRequiredFunctionMaps( int flags, int parsedFlags, int& afterLoadParsedObjectFlags )
     {
-        // A combination of ObjectFlags, indicating which objects will have been parsed, after load() 
-        // has been called. These will be contained for sure.
-        // We need this to ensure that objects that are store by the Loader ( visual scene, library nodes, 
-        // effects, cameras, lights) are parsed only once.
-        int afterLoadParsedObjectFlags = parsedFlags | flags;
+        int requiredFunctionMaps = 0;
 
-        if ( (flags & Loader::ALL_OBJECTS_MASK ) != Loader::ALL_OBJECTS_MASK )
+        if ( (flags & Loader::ASSET_FLAG) != 0 )
         {
-            // we need to set a customized function map, since we don't need all COLLADA libraries 
-            //determine which COLLADA elements we need to parse to get all date needed to parse objects in mObjectFlags
-            int requiredFunctionMaps = 0;
+            requiredFunctionMaps|= COLLADA_ASSET;
+        }
 
-            if ( (flags & Loader::ASSET_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_ASSET;
-            }
+        if ( (flags & Loader::SCENE_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_SCENE;
+        }
 
-            if ( (flags & Loader::SCENE_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_SCENE;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::VISUAL_SCENES_FLAG) )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::VISUAL_SCENES_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::LIBRARY_NODES_FLAG) )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::LIBRARY_NODES_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::GEOMETRY_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_GEOMETRIES;
+        }
 
-            if ( (flags & Loader::GEOMETRY_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_GEOMETRIES;
-            }
+        if ( (flags & Loader::MATERIAL_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_MATERIALS;
+        }
 
-            if ( (flags & Loader::MATERIAL_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_MATERIALS;
-            }
+        if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::EFFECT_FLAG) )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( setInFirstUnsetInSecond(flags, parsedFlags, Loader::EFFECT_FLAG) )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::CAMERA_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
+            //requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( (flags & Loader::CAMERA_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
-                //requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::IMAGE_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_IMAGES;
+        }
 
-            if ( (flags & Loader::IMAGE_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_IMAGES;
-            }
+        if ( (flags & Loader::LIGHT_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
+        }
 
-            if ( (flags & Loader::LIGHT_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
-            }
+        if ( (flags & Loader::ANIMATION_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+        }
 
-            if ( (flags & Loader::ANIMATION_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
-            }
+        if ( (flags & Loader::ANIMATION_LIST_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
 
-            if ( (flags & Loader::ANIMATION_LIST_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_ANIMATIONS;
+            requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
+            afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
+            requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
+            afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
+            requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
+            afterLoadParsedObjectFlags |= Loader::EFFECT_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_EFFECTS;
-                afterLoadParsedObjectFlags |= Loader::EFFECT_FLAG;
+            //requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
+            //requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
+        }
 
-                //requiredFunctionMaps|= COLLADA_LIBRARY_CAMERAS;
-                //requiredFunctionMaps|= COLLADA_LIBRARY_LIGHTS;
-            }
+        if ( (flags & Loader::CONTROLLER_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
 
-            if ( (flags & Loader::CONTROLLER_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
+            requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
+            afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_VISUAL_SCENES;
-                afterLoadParsedObjectFlags |= Loader::VISUAL_SCENES_FLAG;
+            requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
+            afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
+        }
 
-                requiredFunctionMaps|= COLLADA_LIBRARY_NODES;
-                afterLoadParsedObjectFlags |= Loader::LIBRARY_NODES_FLAG;
-            }
+        if ( (flags & Loader::SKIN_CONTROLLER_DATA_FLAG) != 0 )
+        {
+            requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
+        }
 
-            if ( (flags & Loader::SKIN_CONTROLLER_DATA_FLAG) != 0 )
-            {
-                requiredFunctionMaps|= COLLADA_LIBRARY_CONTROLLERS;
-            }
+        return requiredFunctionMaps;
+    }
 
+    //------------------------------
+    template<class FlagsMapPair, class ElementFunctionMap>
+    void createFunctionMap( int flags, int& parsedFlags, ElementFunctionMap& functionMap, FlagsMapPair* flagsMapMap, size_t flagsMapMapSize )
+    {
+        // A combination of ObjectFlags, indicating which objects will have been parsed, after load() 
+        // has been called. These will be contained for sure.
+        // We need this to ensure that objects that are store by the Loader ( visual scene, library nodes, 
+        // effects, cameras, lights) are parsed only once.
+        int afterLoadParsedObjectFlags = parsedFlags | flags;
+
+        if ( (flags & Loader::ALL_OBJECTS_MASK ) != Loader::ALL_OBJECTS_MASK )
+        {
+            // we need to set a customized function map, since we don't need all COLLADA libraries 
+            //determine which COLLADA elements we need to parse to get all date needed to parse objects in mObjectFlags
+            int requiredFunctionMaps = calculateRequiredFunctionMaps( flags, parsedFlags, afterLoadParsedObjectFlags );
 
             // Fills function map
             for ( size_t i = 0; i < flagsMapMapSize; ++i )
@@ -275,7 +321,7 @@ namespace COLLADASaxFWL
                 const FlagsMapPair& libraryFlagsFunctionMapPair = flagsMapMap[i];
                 if ( (requiredFunctionMaps & libraryFlagsFunctionMapPair.flag) != 0 )
                 {
-                    functionMap.insert(libraryFlagsFunctionMapPair.functionMap.begin(), libraryFlagsFunctionMapPair.functionMap.end());
+                    functionMap.insert(libraryFlagsFunctionMapPair.functionMap);
                 }
             }
 
@@ -305,6 +351,8 @@ namespace COLLADASaxFWL
         , mFileLoader( fileLoader )
         , mFlags( flags )
         , mParsedFlags( parsedFlags )
+        , mSectionIndex( 0 )
+        , mSectionIndexer( 0 )
     {
 
     }
@@ -312,12 +360,14 @@ namespace COLLADASaxFWL
     //------------------------------
     VersionParser::~VersionParser()
     {
-
+        delete mSectionIndexer;
     }
 
     //------------------------------
-    bool VersionParser::createAndLaunchParser()
+    bool VersionParser::createAndLaunchParser( bool memoryMapped, SectionIndex* sectionIndex )
     {
+        mSectionIndex = sectionIndex;
+
         const COLLADABU::URI& fileURI = mFileLoader->getFileUri();
         String nativePath = fileURI.toNativePath();
         const char* fileName = nativePath.c_str();
@@ -326,7 +376,7 @@ namespace COLLADASaxFWL
 #elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
         GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
 #endif
-        bool success = versionSaxParser.parseFile( fileName );
+        bool success = memoryMapped ? versionSaxParser.parseMappedFile( fileName ) : versionSaxParser.parseFile( fileName );
 
  //       mFileLoader->postProcess();
 
@@ -335,6 +385,7 @@ namespace COLLADASaxFWL
 
         mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
         mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
+        mFileLoader->setSaxParser( 0 );
 
         return success;
     }
@@ -343,7 +394,8 @@ namespace COLLADASaxFWL
     bool VersionParser::createAndLaunchParser( const char* buffer, int length )
     {
         const COLLADABU::URI& uri = mFileLoader->getFileUri();
-        const char* uriString = uri.originalStr().c_str();
+        const String originalUriString = uri.originalStr();
+        const char* uriString = originalUriString.c_str();
 //        const char* uriString = uri.getURIString().c_str();
 #if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
         GeneratedSaxParser::LibxmlSaxParser versionSaxParser( this );
@@ -359,9 +411,70 @@ namespace COLLADASaxFWL
         
         mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
         mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
+        mFileLoader->setSaxParser( 0 );
         
         return success;
     }
+
+    //------------------------------
+    bool VersionParser::createAndLaunchParser( const GeneratedSaxParser::SaxEventRecorder& recording )
+    {
+        GeneratedSaxParser::RecordedSaxParser versionSaxParser( this, recording );
+        bool success = versionSaxParser.replay();
+
+        delete mPrivateParser14;
+        delete mPrivateParser15;
+
+        mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
+        mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
+        mFileLoader->setSaxParser( 0 );
+
+        return success;
+    }
+
+    //------------------------------
+    bool VersionParser::createAndLaunchParser( const SectionIndex& sectionIndex )
+    {
+        int afterLoadParsedObjectFlags = mParsedFlags | mFlags;
+        int requiredFunctionMaps = calculateRequiredFunctionMaps( mFlags, mParsedFlags, afterLoadParsedObjectFlags );
+
+        // All sections are required, if all objects are parsed. The parser uses the complete function
+        // map as well, if no library is required
+        if ( ((mFlags & Loader::ALL_OBJECTS_MASK ) == Loader::ALL_OBJECTS_MASK) || (requiredFunctionMaps == 0) )
+        {
+            return createAndLaunchParser( true );
+        }
+
+        std::vector<StringHash> requiredElementHashes;
+        for ( size_t i = 0; i < libraryFlagsElementNameMapSize; ++i )
+        {
+            const LibraryFlagsElementNamePair& libraryFlagsElementNamePair = libraryFlagsElementNameMap[i];
+            if ( (requiredFunctionMaps & libraryFlagsElementNamePair.flag) != 0 )
+            {
+                requiredElementHashes.push_back( GeneratedSaxParser::Utils::calculateStringHash(libraryFlagsElementNamePair.elementName) );
+            }
+        }
+
+        GeneratedSaxParser::SaxParser::FileRangeList ranges;
+        sectionIndex.getFileRanges( requiredElementHashes.empty() ? 0 : &requiredElementHashes[0], requiredElementHashes.size(), ranges );
+
+        String nativePath = mFileLoader->getFileUri().toNativePath();
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+        GeneratedSaxParser::LibxmlSaxParser versionSaxParser( this );
+#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+        GeneratedSaxParser::ExpatSaxParser versionSaxParser( this, XMLPARSER_BUFFERSIZE );
+#endif
+        bool success = versionSaxParser.parseFileRanges( nativePath.c_str(), ranges );
+
+        delete mPrivateParser14;
+        delete mPrivateParser15;
+
+        mFileLoader->setPrivateParser( (COLLADASaxFWL14::ColladaParserAutoGen14Private*)0 );
+        mFileLoader->setPrivateParser( (COLLADASaxFWL15::ColladaParserAutoGen15Private*)0 );
+        mFileLoader->setSaxParser( 0 );
+
+        return success;
+    }
     
     //------------------------------
     bool VersionParser::elementBegin( const ParserChar* elementName, const ParserAttributes& attributes )
@@ -441,9 +554,7 @@ namespace COLLADASaxFWL
             mPrivateParser14->setElementFunctionMap( &mFunctionMap14 );
         }
 
-        getSaxParser()->setParser( mPrivateParser14 );
-
-        return mPrivateParser14->elementBegin( elementName, attributes );
+        return launchPrivateParser( mPrivateParser14, elementName, attributes );
     }
     //------------------------------
     bool VersionParser::parse15( const ParserChar* elementName, const ParserAttributes& attributes )
@@ -464,9 +575,25 @@ namespace COLLADASaxFWL
             mPrivateParser15->setElementFunctionMap( &mFunctionMap15 );
         }
 
-        getSaxParser()->setParser( mPrivateParser15 );
+        return launchPrivateParser( mPrivateParser15, elementName, attributes );
+    }
+
+    //------------------------------
+    bool VersionParser::launchPrivateParser( GeneratedSaxParser::Parser* privateParser, const ParserChar* elementName, const ParserAttributes& attributes )
+    {
+        getSaxParser()->setParser( privateParser );
+        mFileLoader->setSaxParser( getSaxParser() );
+
+        if ( !mSectionIndex )
+        {
+            return privateParser->elementBegin( elementName, attributes );
+        }
+
+        // The section indexer passes all events on to the private parser
+        mSectionIndexer = new SectionIndexer( *mSectionIndex, mFileLoader->getFileUri().toNativePath(), privateParser, getErrorHandler() );
+        getSaxParser()->setParser( mSectionIndexer );
 
-        return mPrivateParser15->elementBegin( elementName, attributes );
+        return mSectionIndexer->elementBegin( elementName, attributes );
     }
 
 	//------------------------------
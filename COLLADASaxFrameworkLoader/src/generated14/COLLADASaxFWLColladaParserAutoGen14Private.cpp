@@ -10834,21 +10834,8 @@ bool ColladaParserAutoGen14Private::_freeAttributes__image( void* attributeData
 //---------------------------------------------------------------------
 bool ColladaParserAutoGen14Private::_data__data( const ParserChar* text, size_t textLength )
 {
-#ifdef GENERATEDSAXPARSER_VALIDATION
-    if ( mValidate )
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen14::data__data, 0, 0, 0);
-    }
-    else
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen14::data__data);
-    }
-#else
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen14::data__data);
-    } // validation
-#endif
 
+return mImpl->data__data(text, textLength);
 }
 
 //---------------------------------------------------------------------
@@ -10880,22 +10867,7 @@ bool ColladaParserAutoGen14Private::_preEnd__data()
     } // validation
 #endif
 
-#ifdef GENERATEDSAXPARSER_VALIDATION
-    if ( mValidate )
-    {
-bool returnValue = uint8DataEnd( &ColladaParserAutoGen14::data__data, 0, 0, 0 );
-        return returnValue;
-    }
-    else
-    {
-return uint8DataEnd( &ColladaParserAutoGen14::data__data );
-    }
-#else
-    {
-return uint8DataEnd( &ColladaParserAutoGen14::data__data );
-    } // validation
-#endif
-
+    return true;
 }
 
 //---------------------------------------------------------------------
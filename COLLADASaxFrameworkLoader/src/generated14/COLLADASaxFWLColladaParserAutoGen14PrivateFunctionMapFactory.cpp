@@ -17,2198 +17,2144 @@ namespace COLLADASaxFWL14
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__COLLADA__1level() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_LIBRARY_ANIMATION_CLIPS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_animation_clips, &ColladaParserAutoGen14Private::_data__library_animation_clips, &ColladaParserAutoGen14Private::_end__library_animation_clips, &ColladaParserAutoGen14Private::_preBegin__library_animation_clips, &ColladaParserAutoGen14Private::_preEnd__library_animation_clips, &ColladaParserAutoGen14Private::_freeAttributes__library_animation_clips);
-functionMap[HASH_ELEMENT_LIBRARY_ANIMATIONS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_animations, &ColladaParserAutoGen14Private::_data__library_animations, &ColladaParserAutoGen14Private::_end__library_animations, &ColladaParserAutoGen14Private::_preBegin__library_animations, &ColladaParserAutoGen14Private::_preEnd__library_animations, &ColladaParserAutoGen14Private::_freeAttributes__library_animations);
-functionMap[HASH_ELEMENT_LIBRARY_CAMERAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_cameras, &ColladaParserAutoGen14Private::_data__library_cameras, &ColladaParserAutoGen14Private::_end__library_cameras, &ColladaParserAutoGen14Private::_preBegin__library_cameras, &ColladaParserAutoGen14Private::_preEnd__library_cameras, &ColladaParserAutoGen14Private::_freeAttributes__library_cameras);
-functionMap[HASH_ELEMENT_LIBRARY_CONTROLLERS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_controllers, &ColladaParserAutoGen14Private::_data__library_controllers, &ColladaParserAutoGen14Private::_end__library_controllers, &ColladaParserAutoGen14Private::_preBegin__library_controllers, &ColladaParserAutoGen14Private::_preEnd__library_controllers, &ColladaParserAutoGen14Private::_freeAttributes__library_controllers);
-functionMap[HASH_ELEMENT_LIBRARY_EFFECTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_effects, &ColladaParserAutoGen14Private::_data__library_effects, &ColladaParserAutoGen14Private::_end__library_effects, &ColladaParserAutoGen14Private::_preBegin__library_effects, &ColladaParserAutoGen14Private::_preEnd__library_effects, &ColladaParserAutoGen14Private::_freeAttributes__library_effects);
-functionMap[HASH_ELEMENT_LIBRARY_FORCE_FIELDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_force_fields, &ColladaParserAutoGen14Private::_data__library_force_fields, &ColladaParserAutoGen14Private::_end__library_force_fields, &ColladaParserAutoGen14Private::_preBegin__library_force_fields, &ColladaParserAutoGen14Private::_preEnd__library_force_fields, &ColladaParserAutoGen14Private::_freeAttributes__library_force_fields);
-functionMap[HASH_ELEMENT_LIBRARY_GEOMETRIES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_geometries, &ColladaParserAutoGen14Private::_data__library_geometries, &ColladaParserAutoGen14Private::_end__library_geometries, &ColladaParserAutoGen14Private::_preBegin__library_geometries, &ColladaParserAutoGen14Private::_preEnd__library_geometries, &ColladaParserAutoGen14Private::_freeAttributes__library_geometries);
-functionMap[HASH_ELEMENT_LIBRARY_IMAGES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_images, &ColladaParserAutoGen14Private::_data__library_images, &ColladaParserAutoGen14Private::_end__library_images, &ColladaParserAutoGen14Private::_preBegin__library_images, &ColladaParserAutoGen14Private::_preEnd__library_images, &ColladaParserAutoGen14Private::_freeAttributes__library_images);
-functionMap[HASH_ELEMENT_LIBRARY_LIGHTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_lights, &ColladaParserAutoGen14Private::_data__library_lights, &ColladaParserAutoGen14Private::_end__library_lights, &ColladaParserAutoGen14Private::_preBegin__library_lights, &ColladaParserAutoGen14Private::_preEnd__library_lights, &ColladaParserAutoGen14Private::_freeAttributes__library_lights);
-functionMap[HASH_ELEMENT_LIBRARY_MATERIALS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_materials, &ColladaParserAutoGen14Private::_data__library_materials, &ColladaParserAutoGen14Private::_end__library_materials, &ColladaParserAutoGen14Private::_preBegin__library_materials, &ColladaParserAutoGen14Private::_preEnd__library_materials, &ColladaParserAutoGen14Private::_freeAttributes__library_materials);
-functionMap[HASH_ELEMENT_LIBRARY_NODES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_nodes, &ColladaParserAutoGen14Private::_data__library_nodes, &ColladaParserAutoGen14Private::_end__library_nodes, &ColladaParserAutoGen14Private::_preBegin__library_nodes, &ColladaParserAutoGen14Private::_preEnd__library_nodes, &ColladaParserAutoGen14Private::_freeAttributes__library_nodes);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_MATERIALS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_materials, &ColladaParserAutoGen14Private::_data__library_physics_materials, &ColladaParserAutoGen14Private::_end__library_physics_materials, &ColladaParserAutoGen14Private::_preBegin__library_physics_materials, &ColladaParserAutoGen14Private::_preEnd__library_physics_materials, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_materials);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_MODELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_models, &ColladaParserAutoGen14Private::_data__library_physics_models, &ColladaParserAutoGen14Private::_end__library_physics_models, &ColladaParserAutoGen14Private::_preBegin__library_physics_models, &ColladaParserAutoGen14Private::_preEnd__library_physics_models, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_models);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_SCENES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_scenes, &ColladaParserAutoGen14Private::_data__library_physics_scenes, &ColladaParserAutoGen14Private::_end__library_physics_scenes, &ColladaParserAutoGen14Private::_preBegin__library_physics_scenes, &ColladaParserAutoGen14Private::_preEnd__library_physics_scenes, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_scenes);
-functionMap[HASH_ELEMENT_LIBRARY_VISUAL_SCENES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_visual_scenes, &ColladaParserAutoGen14Private::_data__library_visual_scenes, &ColladaParserAutoGen14Private::_end__library_visual_scenes, &ColladaParserAutoGen14Private::_preBegin__library_visual_scenes, &ColladaParserAutoGen14Private::_preEnd__library_visual_scenes, &ColladaParserAutoGen14Private::_freeAttributes__library_visual_scenes);
-functionMap[HASH_ELEMENT_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__scene, &ColladaParserAutoGen14Private::_data__scene, &ColladaParserAutoGen14Private::_end__scene, &ColladaParserAutoGen14Private::_preBegin__scene, &ColladaParserAutoGen14Private::_preEnd__scene, &ColladaParserAutoGen14Private::_freeAttributes__scene);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_LIBRARY_ANIMATION_CLIPS,
+HASH_ELEMENT_LIBRARY_ANIMATIONS,
+HASH_ELEMENT_LIBRARY_CAMERAS,
+HASH_ELEMENT_LIBRARY_CONTROLLERS,
+HASH_ELEMENT_LIBRARY_EFFECTS,
+HASH_ELEMENT_LIBRARY_FORCE_FIELDS,
+HASH_ELEMENT_LIBRARY_GEOMETRIES,
+HASH_ELEMENT_LIBRARY_IMAGES,
+HASH_ELEMENT_LIBRARY_LIGHTS,
+HASH_ELEMENT_LIBRARY_MATERIALS,
+HASH_ELEMENT_LIBRARY_NODES,
+HASH_ELEMENT_LIBRARY_PHYSICS_MATERIALS,
+HASH_ELEMENT_LIBRARY_PHYSICS_MODELS,
+HASH_ELEMENT_LIBRARY_PHYSICS_SCENES,
+HASH_ELEMENT_LIBRARY_VISUAL_SCENES,
+HASH_ELEMENT_SCENE,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__asset__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__alpha_func);
-functionMap[HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_data__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_end__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preBegin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preEnd__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_freeAttributes__ambient____common_color_or_texture_type);
-functionMap[HASH_ELEMENT_ANIMATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__animation, &ColladaParserAutoGen14Private::_data__animation, &ColladaParserAutoGen14Private::_end__animation, &ColladaParserAutoGen14Private::_preBegin__animation, &ColladaParserAutoGen14Private::_preEnd__animation, &ColladaParserAutoGen14Private::_freeAttributes__animation);
-functionMap[HASH_ELEMENT_ANIMATION_CLIP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__animation_clip, &ColladaParserAutoGen14Private::_data__animation_clip, &ColladaParserAutoGen14Private::_end__animation_clip, &ColladaParserAutoGen14Private::_preBegin__animation_clip, &ColladaParserAutoGen14Private::_preEnd__animation_clip, &ColladaParserAutoGen14Private::_freeAttributes__animation_clip);
-functionMap[HASH_ELEMENT_ARRAY____GLSL_NEWARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_data__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_end__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_preBegin__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_preEnd__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____glsl_newarray_type);
-functionMap[HASH_ELEMENT_ATTACHMENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__attachment, &ColladaParserAutoGen14Private::_data__attachment, &ColladaParserAutoGen14Private::_end__attachment, &ColladaParserAutoGen14Private::_preBegin__attachment, &ColladaParserAutoGen14Private::_preEnd__attachment, &ColladaParserAutoGen14Private::_freeAttributes__attachment);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__BIND] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shader__bind);
-functionMap[HASH_ELEMENT_BIND_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material, &ColladaParserAutoGen14Private::_data__bind_material, &ColladaParserAutoGen14Private::_end__bind_material, &ColladaParserAutoGen14Private::_preBegin__bind_material, &ColladaParserAutoGen14Private::_preEnd__bind_material, &ColladaParserAutoGen14Private::_freeAttributes__bind_material);
-functionMap[HASH_ELEMENT_BLINN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__blinn, &ColladaParserAutoGen14Private::_data__blinn, &ColladaParserAutoGen14Private::_end__blinn, &ColladaParserAutoGen14Private::_preBegin__blinn, &ColladaParserAutoGen14Private::_preEnd__blinn, &ColladaParserAutoGen14Private::_freeAttributes__blinn);
-functionMap[HASH_ELEMENT_BOX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__box, &ColladaParserAutoGen14Private::_data__box, &ColladaParserAutoGen14Private::_end__box, &ColladaParserAutoGen14Private::_preBegin__box, &ColladaParserAutoGen14Private::_preEnd__box, &ColladaParserAutoGen14Private::_freeAttributes__box);
-functionMap[HASH_ELEMENT_CAMERA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__camera, &ColladaParserAutoGen14Private::_data__camera, &ColladaParserAutoGen14Private::_end__camera, &ColladaParserAutoGen14Private::_preBegin__camera, &ColladaParserAutoGen14Private::_preEnd__camera, &ColladaParserAutoGen14Private::_freeAttributes__camera);
-functionMap[HASH_ELEMENT_CAPSULE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__capsule, &ColladaParserAutoGen14Private::_data__capsule, &ColladaParserAutoGen14Private::_end__capsule, &ColladaParserAutoGen14Private::_preBegin__capsule, &ColladaParserAutoGen14Private::_preEnd__capsule, &ColladaParserAutoGen14Private::_freeAttributes__capsule);
-functionMap[HASH_ELEMENT_PROFILE_COMMON__TECHNIQUE__CONSTANT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_data__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_end__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_preBegin__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_preEnd__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_freeAttributes__profile_COMMON__technique__constant);
-functionMap[HASH_ELEMENT_CONTROL_VERTICES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__control_vertices, &ColladaParserAutoGen14Private::_data__control_vertices, &ColladaParserAutoGen14Private::_end__control_vertices, &ColladaParserAutoGen14Private::_preBegin__control_vertices, &ColladaParserAutoGen14Private::_preEnd__control_vertices, &ColladaParserAutoGen14Private::_freeAttributes__control_vertices);
-functionMap[HASH_ELEMENT_CONTROLLER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__controller, &ColladaParserAutoGen14Private::_data__controller, &ColladaParserAutoGen14Private::_end__controller, &ColladaParserAutoGen14Private::_preBegin__controller, &ColladaParserAutoGen14Private::_preEnd__controller, &ColladaParserAutoGen14Private::_freeAttributes__controller);
-functionMap[HASH_ELEMENT_CONVEX_MESH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__convex_mesh, &ColladaParserAutoGen14Private::_data__convex_mesh, &ColladaParserAutoGen14Private::_end__convex_mesh, &ColladaParserAutoGen14Private::_preBegin__convex_mesh, &ColladaParserAutoGen14Private::_preEnd__convex_mesh, &ColladaParserAutoGen14Private::_freeAttributes__convex_mesh);
-functionMap[HASH_ELEMENT_CYLINDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__cylinder, &ColladaParserAutoGen14Private::_data__cylinder, &ColladaParserAutoGen14Private::_end__cylinder, &ColladaParserAutoGen14Private::_preBegin__cylinder, &ColladaParserAutoGen14Private::_preEnd__cylinder, &ColladaParserAutoGen14Private::_freeAttributes__cylinder);
-functionMap[HASH_ELEMENT_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__diffuse, &ColladaParserAutoGen14Private::_data__diffuse, &ColladaParserAutoGen14Private::_end__diffuse, &ColladaParserAutoGen14Private::_preBegin__diffuse, &ColladaParserAutoGen14Private::_preEnd__diffuse, &ColladaParserAutoGen14Private::_freeAttributes__diffuse);
-functionMap[HASH_ELEMENT_EFFECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__effect, &ColladaParserAutoGen14Private::_data__effect, &ColladaParserAutoGen14Private::_end__effect, &ColladaParserAutoGen14Private::_preBegin__effect, &ColladaParserAutoGen14Private::_preEnd__effect, &ColladaParserAutoGen14Private::_freeAttributes__effect);
-functionMap[HASH_ELEMENT_EMISSION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__emission, &ColladaParserAutoGen14Private::_data__emission, &ColladaParserAutoGen14Private::_end__emission, &ColladaParserAutoGen14Private::_preBegin__emission, &ColladaParserAutoGen14Private::_preEnd__emission, &ColladaParserAutoGen14Private::_freeAttributes__emission);
-functionMap[HASH_ELEMENT_EVALUATE_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__evaluate_scene, &ColladaParserAutoGen14Private::_data__evaluate_scene, &ColladaParserAutoGen14Private::_end__evaluate_scene, &ColladaParserAutoGen14Private::_preBegin__evaluate_scene, &ColladaParserAutoGen14Private::_preEnd__evaluate_scene, &ColladaParserAutoGen14Private::_freeAttributes__evaluate_scene);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_FORCE_FIELD] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__force_field, &ColladaParserAutoGen14Private::_data__force_field, &ColladaParserAutoGen14Private::_end__force_field, &ColladaParserAutoGen14Private::_preBegin__force_field, &ColladaParserAutoGen14Private::_preEnd__force_field, &ColladaParserAutoGen14Private::_freeAttributes__force_field);
-functionMap[HASH_ELEMENT_FORMAT_HINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__format_hint, &ColladaParserAutoGen14Private::_data__format_hint, &ColladaParserAutoGen14Private::_end__format_hint, &ColladaParserAutoGen14Private::_preBegin__format_hint, &ColladaParserAutoGen14Private::_preEnd__format_hint, &ColladaParserAutoGen14Private::_freeAttributes__format_hint);
-functionMap[HASH_ELEMENT_GLSL_SURFACE_TYPE____GENERATOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_data__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_end__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_preBegin__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_preEnd__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_freeAttributes__glsl_surface_type____generator);
-functionMap[HASH_ELEMENT_GEOMETRY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__geometry, &ColladaParserAutoGen14Private::_data__geometry, &ColladaParserAutoGen14Private::_end__geometry, &ColladaParserAutoGen14Private::_preBegin__geometry, &ColladaParserAutoGen14Private::_preEnd__geometry, &ColladaParserAutoGen14Private::_freeAttributes__geometry);
-functionMap[HASH_ELEMENT_IMAGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__image, &ColladaParserAutoGen14Private::_data__image, &ColladaParserAutoGen14Private::_end__image, &ColladaParserAutoGen14Private::_preBegin__image, &ColladaParserAutoGen14Private::_preEnd__image, &ColladaParserAutoGen14Private::_freeAttributes__image);
-functionMap[HASH_ELEMENT_IMAGER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__imager, &ColladaParserAutoGen14Private::_data__imager, &ColladaParserAutoGen14Private::_end__imager, &ColladaParserAutoGen14Private::_preBegin__imager, &ColladaParserAutoGen14Private::_preEnd__imager, &ColladaParserAutoGen14Private::_freeAttributes__imager);
-functionMap[HASH_ELEMENT_INSTANCE_ANIMATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_animation, &ColladaParserAutoGen14Private::_data__instance_animation, &ColladaParserAutoGen14Private::_end__instance_animation, &ColladaParserAutoGen14Private::_preBegin__instance_animation, &ColladaParserAutoGen14Private::_preEnd__instance_animation, &ColladaParserAutoGen14Private::_freeAttributes__instance_animation);
-functionMap[HASH_ELEMENT_INSTANCE_CAMERA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_camera, &ColladaParserAutoGen14Private::_data__instance_camera, &ColladaParserAutoGen14Private::_end__instance_camera, &ColladaParserAutoGen14Private::_preBegin__instance_camera, &ColladaParserAutoGen14Private::_preEnd__instance_camera, &ColladaParserAutoGen14Private::_freeAttributes__instance_camera);
-functionMap[HASH_ELEMENT_INSTANCE_CONTROLLER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_controller, &ColladaParserAutoGen14Private::_data__instance_controller, &ColladaParserAutoGen14Private::_end__instance_controller, &ColladaParserAutoGen14Private::_preBegin__instance_controller, &ColladaParserAutoGen14Private::_preEnd__instance_controller, &ColladaParserAutoGen14Private::_freeAttributes__instance_controller);
-functionMap[HASH_ELEMENT_INSTANCE_EFFECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_effect, &ColladaParserAutoGen14Private::_data__instance_effect, &ColladaParserAutoGen14Private::_end__instance_effect, &ColladaParserAutoGen14Private::_preBegin__instance_effect, &ColladaParserAutoGen14Private::_preEnd__instance_effect, &ColladaParserAutoGen14Private::_freeAttributes__instance_effect);
-functionMap[HASH_ELEMENT_INSTANCE_FORCE_FIELD] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_force_field, &ColladaParserAutoGen14Private::_data__instance_force_field, &ColladaParserAutoGen14Private::_end__instance_force_field, &ColladaParserAutoGen14Private::_preBegin__instance_force_field, &ColladaParserAutoGen14Private::_preEnd__instance_force_field, &ColladaParserAutoGen14Private::_freeAttributes__instance_force_field);
-functionMap[HASH_ELEMENT_INSTANCE_GEOMETRY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_geometry, &ColladaParserAutoGen14Private::_data__instance_geometry, &ColladaParserAutoGen14Private::_end__instance_geometry, &ColladaParserAutoGen14Private::_preBegin__instance_geometry, &ColladaParserAutoGen14Private::_preEnd__instance_geometry, &ColladaParserAutoGen14Private::_freeAttributes__instance_geometry);
-functionMap[HASH_ELEMENT_INSTANCE_LIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_light, &ColladaParserAutoGen14Private::_data__instance_light, &ColladaParserAutoGen14Private::_end__instance_light, &ColladaParserAutoGen14Private::_preBegin__instance_light, &ColladaParserAutoGen14Private::_preEnd__instance_light, &ColladaParserAutoGen14Private::_freeAttributes__instance_light);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material, &ColladaParserAutoGen14Private::_data__instance_material, &ColladaParserAutoGen14Private::_end__instance_material, &ColladaParserAutoGen14Private::_preBegin__instance_material, &ColladaParserAutoGen14Private::_preEnd__instance_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_material);
-functionMap[HASH_ELEMENT_INSTANCE_NODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_node, &ColladaParserAutoGen14Private::_data__instance_node, &ColladaParserAutoGen14Private::_end__instance_node, &ColladaParserAutoGen14Private::_preBegin__instance_node, &ColladaParserAutoGen14Private::_preEnd__instance_node, &ColladaParserAutoGen14Private::_freeAttributes__instance_node);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_material, &ColladaParserAutoGen14Private::_data__instance_physics_material, &ColladaParserAutoGen14Private::_end__instance_physics_material, &ColladaParserAutoGen14Private::_preBegin__instance_physics_material, &ColladaParserAutoGen14Private::_preEnd__instance_physics_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_material);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_MODEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_model, &ColladaParserAutoGen14Private::_data__instance_physics_model, &ColladaParserAutoGen14Private::_end__instance_physics_model, &ColladaParserAutoGen14Private::_preBegin__instance_physics_model, &ColladaParserAutoGen14Private::_preEnd__instance_physics_model, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_model);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_scene, &ColladaParserAutoGen14Private::_data__instance_physics_scene, &ColladaParserAutoGen14Private::_end__instance_physics_scene, &ColladaParserAutoGen14Private::_preBegin__instance_physics_scene, &ColladaParserAutoGen14Private::_preEnd__instance_physics_scene, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_scene);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body, &ColladaParserAutoGen14Private::_data__instance_rigid_body, &ColladaParserAutoGen14Private::_end__instance_rigid_body, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_CONSTRAINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_constraint, &ColladaParserAutoGen14Private::_data__instance_rigid_constraint, &ColladaParserAutoGen14Private::_end__instance_rigid_constraint, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_constraint, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_constraint, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_constraint);
-functionMap[HASH_ELEMENT_INSTANCE_VISUAL_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_visual_scene, &ColladaParserAutoGen14Private::_data__instance_visual_scene, &ColladaParserAutoGen14Private::_end__instance_visual_scene, &ColladaParserAutoGen14Private::_preBegin__instance_visual_scene, &ColladaParserAutoGen14Private::_preEnd__instance_visual_scene, &ColladaParserAutoGen14Private::_freeAttributes__instance_visual_scene);
-functionMap[HASH_ELEMENT_JOINTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__joints, &ColladaParserAutoGen14Private::_data__joints, &ColladaParserAutoGen14Private::_end__joints, &ColladaParserAutoGen14Private::_preBegin__joints, &ColladaParserAutoGen14Private::_preEnd__joints, &ColladaParserAutoGen14Private::_freeAttributes__joints);
-functionMap[HASH_ELEMENT_LAMBERT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__lambert, &ColladaParserAutoGen14Private::_data__lambert, &ColladaParserAutoGen14Private::_end__lambert, &ColladaParserAutoGen14Private::_preBegin__lambert, &ColladaParserAutoGen14Private::_preEnd__lambert, &ColladaParserAutoGen14Private::_freeAttributes__lambert);
-functionMap[HASH_ELEMENT_LIBRARY_ANIMATION_CLIPS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_animation_clips, &ColladaParserAutoGen14Private::_data__library_animation_clips, &ColladaParserAutoGen14Private::_end__library_animation_clips, &ColladaParserAutoGen14Private::_preBegin__library_animation_clips, &ColladaParserAutoGen14Private::_preEnd__library_animation_clips, &ColladaParserAutoGen14Private::_freeAttributes__library_animation_clips);
-functionMap[HASH_ELEMENT_LIBRARY_ANIMATIONS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_animations, &ColladaParserAutoGen14Private::_data__library_animations, &ColladaParserAutoGen14Private::_end__library_animations, &ColladaParserAutoGen14Private::_preBegin__library_animations, &ColladaParserAutoGen14Private::_preEnd__library_animations, &ColladaParserAutoGen14Private::_freeAttributes__library_animations);
-functionMap[HASH_ELEMENT_LIBRARY_CAMERAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_cameras, &ColladaParserAutoGen14Private::_data__library_cameras, &ColladaParserAutoGen14Private::_end__library_cameras, &ColladaParserAutoGen14Private::_preBegin__library_cameras, &ColladaParserAutoGen14Private::_preEnd__library_cameras, &ColladaParserAutoGen14Private::_freeAttributes__library_cameras);
-functionMap[HASH_ELEMENT_LIBRARY_CONTROLLERS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_controllers, &ColladaParserAutoGen14Private::_data__library_controllers, &ColladaParserAutoGen14Private::_end__library_controllers, &ColladaParserAutoGen14Private::_preBegin__library_controllers, &ColladaParserAutoGen14Private::_preEnd__library_controllers, &ColladaParserAutoGen14Private::_freeAttributes__library_controllers);
-functionMap[HASH_ELEMENT_LIBRARY_EFFECTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_effects, &ColladaParserAutoGen14Private::_data__library_effects, &ColladaParserAutoGen14Private::_end__library_effects, &ColladaParserAutoGen14Private::_preBegin__library_effects, &ColladaParserAutoGen14Private::_preEnd__library_effects, &ColladaParserAutoGen14Private::_freeAttributes__library_effects);
-functionMap[HASH_ELEMENT_LIBRARY_FORCE_FIELDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_force_fields, &ColladaParserAutoGen14Private::_data__library_force_fields, &ColladaParserAutoGen14Private::_end__library_force_fields, &ColladaParserAutoGen14Private::_preBegin__library_force_fields, &ColladaParserAutoGen14Private::_preEnd__library_force_fields, &ColladaParserAutoGen14Private::_freeAttributes__library_force_fields);
-functionMap[HASH_ELEMENT_LIBRARY_GEOMETRIES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_geometries, &ColladaParserAutoGen14Private::_data__library_geometries, &ColladaParserAutoGen14Private::_end__library_geometries, &ColladaParserAutoGen14Private::_preBegin__library_geometries, &ColladaParserAutoGen14Private::_preEnd__library_geometries, &ColladaParserAutoGen14Private::_freeAttributes__library_geometries);
-functionMap[HASH_ELEMENT_LIBRARY_IMAGES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_images, &ColladaParserAutoGen14Private::_data__library_images, &ColladaParserAutoGen14Private::_end__library_images, &ColladaParserAutoGen14Private::_preBegin__library_images, &ColladaParserAutoGen14Private::_preEnd__library_images, &ColladaParserAutoGen14Private::_freeAttributes__library_images);
-functionMap[HASH_ELEMENT_LIBRARY_LIGHTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_lights, &ColladaParserAutoGen14Private::_data__library_lights, &ColladaParserAutoGen14Private::_end__library_lights, &ColladaParserAutoGen14Private::_preBegin__library_lights, &ColladaParserAutoGen14Private::_preEnd__library_lights, &ColladaParserAutoGen14Private::_freeAttributes__library_lights);
-functionMap[HASH_ELEMENT_LIBRARY_MATERIALS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_materials, &ColladaParserAutoGen14Private::_data__library_materials, &ColladaParserAutoGen14Private::_end__library_materials, &ColladaParserAutoGen14Private::_preBegin__library_materials, &ColladaParserAutoGen14Private::_preEnd__library_materials, &ColladaParserAutoGen14Private::_freeAttributes__library_materials);
-functionMap[HASH_ELEMENT_LIBRARY_NODES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_nodes, &ColladaParserAutoGen14Private::_data__library_nodes, &ColladaParserAutoGen14Private::_end__library_nodes, &ColladaParserAutoGen14Private::_preBegin__library_nodes, &ColladaParserAutoGen14Private::_preEnd__library_nodes, &ColladaParserAutoGen14Private::_freeAttributes__library_nodes);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_MATERIALS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_materials, &ColladaParserAutoGen14Private::_data__library_physics_materials, &ColladaParserAutoGen14Private::_end__library_physics_materials, &ColladaParserAutoGen14Private::_preBegin__library_physics_materials, &ColladaParserAutoGen14Private::_preEnd__library_physics_materials, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_materials);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_MODELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_models, &ColladaParserAutoGen14Private::_data__library_physics_models, &ColladaParserAutoGen14Private::_end__library_physics_models, &ColladaParserAutoGen14Private::_preBegin__library_physics_models, &ColladaParserAutoGen14Private::_preEnd__library_physics_models, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_models);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_SCENES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_scenes, &ColladaParserAutoGen14Private::_data__library_physics_scenes, &ColladaParserAutoGen14Private::_end__library_physics_scenes, &ColladaParserAutoGen14Private::_preBegin__library_physics_scenes, &ColladaParserAutoGen14Private::_preEnd__library_physics_scenes, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_scenes);
-functionMap[HASH_ELEMENT_LIBRARY_VISUAL_SCENES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_visual_scenes, &ColladaParserAutoGen14Private::_data__library_visual_scenes, &ColladaParserAutoGen14Private::_end__library_visual_scenes, &ColladaParserAutoGen14Private::_preBegin__library_visual_scenes, &ColladaParserAutoGen14Private::_preEnd__library_visual_scenes, &ColladaParserAutoGen14Private::_freeAttributes__library_visual_scenes);
-functionMap[HASH_ELEMENT_LIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light, &ColladaParserAutoGen14Private::_data__light, &ColladaParserAutoGen14Private::_end__light, &ColladaParserAutoGen14Private::_preBegin__light, &ColladaParserAutoGen14Private::_preEnd__light, &ColladaParserAutoGen14Private::_freeAttributes__light);
-functionMap[HASH_ELEMENT_LINES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__lines, &ColladaParserAutoGen14Private::_data__lines, &ColladaParserAutoGen14Private::_end__lines, &ColladaParserAutoGen14Private::_preBegin__lines, &ColladaParserAutoGen14Private::_preEnd__lines, &ColladaParserAutoGen14Private::_freeAttributes__lines);
-functionMap[HASH_ELEMENT_LINESTRIPS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__linestrips, &ColladaParserAutoGen14Private::_data__linestrips, &ColladaParserAutoGen14Private::_end__linestrips, &ColladaParserAutoGen14Private::_preBegin__linestrips, &ColladaParserAutoGen14Private::_preEnd__linestrips, &ColladaParserAutoGen14Private::_freeAttributes__linestrips);
-functionMap[HASH_ELEMENT_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__material, &ColladaParserAutoGen14Private::_data__material, &ColladaParserAutoGen14Private::_end__material, &ColladaParserAutoGen14Private::_preBegin__material, &ColladaParserAutoGen14Private::_preEnd__material, &ColladaParserAutoGen14Private::_freeAttributes__material);
-functionMap[HASH_ELEMENT_MESH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mesh, &ColladaParserAutoGen14Private::_data__mesh, &ColladaParserAutoGen14Private::_end__mesh, &ColladaParserAutoGen14Private::_preBegin__mesh, &ColladaParserAutoGen14Private::_preEnd__mesh, &ColladaParserAutoGen14Private::_freeAttributes__mesh);
-functionMap[HASH_ELEMENT_MORPH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__morph, &ColladaParserAutoGen14Private::_data__morph, &ColladaParserAutoGen14Private::_end__morph, &ColladaParserAutoGen14Private::_preBegin__morph, &ColladaParserAutoGen14Private::_preEnd__morph, &ColladaParserAutoGen14Private::_freeAttributes__morph);
-functionMap[HASH_ELEMENT_NEWPARAM____FX_NEWPARAM_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_data__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_end__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_preBegin__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_preEnd__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_freeAttributes__newparam____fx_newparam_common);
-functionMap[HASH_ELEMENT_NODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__node, &ColladaParserAutoGen14Private::_data__node, &ColladaParserAutoGen14Private::_end__node, &ColladaParserAutoGen14Private::_preBegin__node, &ColladaParserAutoGen14Private::_preEnd__node, &ColladaParserAutoGen14Private::_freeAttributes__node);
-functionMap[HASH_ELEMENT_OPTICS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__optics, &ColladaParserAutoGen14Private::_data__optics, &ColladaParserAutoGen14Private::_end__optics, &ColladaParserAutoGen14Private::_preBegin__optics, &ColladaParserAutoGen14Private::_preEnd__optics, &ColladaParserAutoGen14Private::_freeAttributes__optics);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass);
-functionMap[HASH_ELEMENT_PHONG] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__phong, &ColladaParserAutoGen14Private::_data__phong, &ColladaParserAutoGen14Private::_end__phong, &ColladaParserAutoGen14Private::_preBegin__phong, &ColladaParserAutoGen14Private::_preEnd__phong, &ColladaParserAutoGen14Private::_freeAttributes__phong);
-functionMap[HASH_ELEMENT_PHYSICS_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_material, &ColladaParserAutoGen14Private::_data__physics_material, &ColladaParserAutoGen14Private::_end__physics_material, &ColladaParserAutoGen14Private::_preBegin__physics_material, &ColladaParserAutoGen14Private::_preEnd__physics_material, &ColladaParserAutoGen14Private::_freeAttributes__physics_material);
-functionMap[HASH_ELEMENT_PHYSICS_MODEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_model, &ColladaParserAutoGen14Private::_data__physics_model, &ColladaParserAutoGen14Private::_end__physics_model, &ColladaParserAutoGen14Private::_preBegin__physics_model, &ColladaParserAutoGen14Private::_preEnd__physics_model, &ColladaParserAutoGen14Private::_freeAttributes__physics_model);
-functionMap[HASH_ELEMENT_PHYSICS_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_scene, &ColladaParserAutoGen14Private::_data__physics_scene, &ColladaParserAutoGen14Private::_end__physics_scene, &ColladaParserAutoGen14Private::_preBegin__physics_scene, &ColladaParserAutoGen14Private::_preEnd__physics_scene, &ColladaParserAutoGen14Private::_freeAttributes__physics_scene);
-functionMap[HASH_ELEMENT_PLANE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__plane, &ColladaParserAutoGen14Private::_data__plane, &ColladaParserAutoGen14Private::_end__plane, &ColladaParserAutoGen14Private::_preBegin__plane, &ColladaParserAutoGen14Private::_preEnd__plane, &ColladaParserAutoGen14Private::_freeAttributes__plane);
-functionMap[HASH_ELEMENT_POLYGONS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygons, &ColladaParserAutoGen14Private::_data__polygons, &ColladaParserAutoGen14Private::_end__polygons, &ColladaParserAutoGen14Private::_preBegin__polygons, &ColladaParserAutoGen14Private::_preEnd__polygons, &ColladaParserAutoGen14Private::_freeAttributes__polygons);
-functionMap[HASH_ELEMENT_POLYLIST] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polylist, &ColladaParserAutoGen14Private::_data__polylist, &ColladaParserAutoGen14Private::_end__polylist, &ColladaParserAutoGen14Private::_preBegin__polylist, &ColladaParserAutoGen14Private::_preEnd__polylist, &ColladaParserAutoGen14Private::_freeAttributes__polylist);
-functionMap[HASH_ELEMENT_PROFILE_CG] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG, &ColladaParserAutoGen14Private::_data__profile_CG, &ColladaParserAutoGen14Private::_end__profile_CG, &ColladaParserAutoGen14Private::_preBegin__profile_CG, &ColladaParserAutoGen14Private::_preEnd__profile_CG, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG);
-functionMap[HASH_ELEMENT_PROFILE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_COMMON, &ColladaParserAutoGen14Private::_data__profile_COMMON, &ColladaParserAutoGen14Private::_end__profile_COMMON, &ColladaParserAutoGen14Private::_preBegin__profile_COMMON, &ColladaParserAutoGen14Private::_preEnd__profile_COMMON, &ColladaParserAutoGen14Private::_freeAttributes__profile_COMMON);
-functionMap[HASH_ELEMENT_PROFILE_GLES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES, &ColladaParserAutoGen14Private::_data__profile_GLES, &ColladaParserAutoGen14Private::_end__profile_GLES, &ColladaParserAutoGen14Private::_preBegin__profile_GLES, &ColladaParserAutoGen14Private::_preEnd__profile_GLES, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES);
-functionMap[HASH_ELEMENT_PROFILE_GLSL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL, &ColladaParserAutoGen14Private::_data__profile_GLSL, &ColladaParserAutoGen14Private::_end__profile_GLSL, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL);
-functionMap[HASH_ELEMENT_REF_ATTACHMENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ref_attachment, &ColladaParserAutoGen14Private::_data__ref_attachment, &ColladaParserAutoGen14Private::_end__ref_attachment, &ColladaParserAutoGen14Private::_preBegin__ref_attachment, &ColladaParserAutoGen14Private::_preEnd__ref_attachment, &ColladaParserAutoGen14Private::_freeAttributes__ref_attachment);
-functionMap[HASH_ELEMENT_REFLECTIVE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflective, &ColladaParserAutoGen14Private::_data__reflective, &ColladaParserAutoGen14Private::_end__reflective, &ColladaParserAutoGen14Private::_preBegin__reflective, &ColladaParserAutoGen14Private::_preEnd__reflective, &ColladaParserAutoGen14Private::_freeAttributes__reflective);
-functionMap[HASH_ELEMENT_RENDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__render, &ColladaParserAutoGen14Private::_data__render, &ColladaParserAutoGen14Private::_end__render, &ColladaParserAutoGen14Private::_preBegin__render, &ColladaParserAutoGen14Private::_preEnd__render, &ColladaParserAutoGen14Private::_freeAttributes__render);
-functionMap[HASH_ELEMENT_RIGID_BODY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_body, &ColladaParserAutoGen14Private::_data__rigid_body, &ColladaParserAutoGen14Private::_end__rigid_body, &ColladaParserAutoGen14Private::_preBegin__rigid_body, &ColladaParserAutoGen14Private::_preEnd__rigid_body, &ColladaParserAutoGen14Private::_freeAttributes__rigid_body);
-functionMap[HASH_ELEMENT_RIGID_CONSTRAINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_constraint, &ColladaParserAutoGen14Private::_data__rigid_constraint, &ColladaParserAutoGen14Private::_end__rigid_constraint, &ColladaParserAutoGen14Private::_preBegin__rigid_constraint, &ColladaParserAutoGen14Private::_preEnd__rigid_constraint, &ColladaParserAutoGen14Private::_freeAttributes__rigid_constraint);
-functionMap[HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_data__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_end__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preBegin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preEnd__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____fx_sampler1D_common);
-functionMap[HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_data__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_end__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preBegin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preEnd__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____fx_sampler2D_common);
-functionMap[HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_data__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_end__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preBegin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preEnd__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____fx_sampler3D_common);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_data__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_end__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____fx_samplerCUBE_common);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_data__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_end__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____fx_samplerDEPTH_common);
-functionMap[HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_data__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_end__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____fx_samplerRECT_common);
-functionMap[HASH_ELEMENT_SAMPLER_STATE____GLES_SAMPLER_STATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_data__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_end__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_preBegin__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_preEnd__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_freeAttributes__sampler_state____gles_sampler_state);
-functionMap[HASH_ELEMENT_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__scene, &ColladaParserAutoGen14Private::_data__scene, &ColladaParserAutoGen14Private::_end__scene, &ColladaParserAutoGen14Private::_preBegin__scene, &ColladaParserAutoGen14Private::_preEnd__scene, &ColladaParserAutoGen14Private::_freeAttributes__scene);
-functionMap[HASH_ELEMENT_INSTANCE_EFFECT__SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_effect__setparam, &ColladaParserAutoGen14Private::_data__instance_effect__setparam, &ColladaParserAutoGen14Private::_end__instance_effect__setparam, &ColladaParserAutoGen14Private::_preBegin__instance_effect__setparam, &ColladaParserAutoGen14Private::_preEnd__instance_effect__setparam, &ColladaParserAutoGen14Private::_freeAttributes__instance_effect__setparam);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shader);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__shape);
-functionMap[HASH_ELEMENT_SKIN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__skin, &ColladaParserAutoGen14Private::_data__skin, &ColladaParserAutoGen14Private::_end__skin, &ColladaParserAutoGen14Private::_preBegin__skin, &ColladaParserAutoGen14Private::_preEnd__skin, &ColladaParserAutoGen14Private::_freeAttributes__skin);
-functionMap[HASH_ELEMENT_SOURCE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source, &ColladaParserAutoGen14Private::_data__source, &ColladaParserAutoGen14Private::_end__source, &ColladaParserAutoGen14Private::_preBegin__source, &ColladaParserAutoGen14Private::_preEnd__source, &ColladaParserAutoGen14Private::_freeAttributes__source);
-functionMap[HASH_ELEMENT_SPECULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__specular, &ColladaParserAutoGen14Private::_data__specular, &ColladaParserAutoGen14Private::_end__specular, &ColladaParserAutoGen14Private::_preBegin__specular, &ColladaParserAutoGen14Private::_preEnd__specular, &ColladaParserAutoGen14Private::_freeAttributes__specular);
-functionMap[HASH_ELEMENT_SPHERE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sphere, &ColladaParserAutoGen14Private::_data__sphere, &ColladaParserAutoGen14Private::_end__sphere, &ColladaParserAutoGen14Private::_preBegin__sphere, &ColladaParserAutoGen14Private::_preEnd__sphere, &ColladaParserAutoGen14Private::_freeAttributes__sphere);
-functionMap[HASH_ELEMENT_SPLINE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__spline, &ColladaParserAutoGen14Private::_data__spline, &ColladaParserAutoGen14Private::_end__spline, &ColladaParserAutoGen14Private::_preBegin__spline, &ColladaParserAutoGen14Private::_preEnd__spline, &ColladaParserAutoGen14Private::_freeAttributes__spline);
-functionMap[HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_data__surface____fx_surface_common, &ColladaParserAutoGen14Private::_end__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preBegin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preEnd__surface____fx_surface_common, &ColladaParserAutoGen14Private::_freeAttributes__surface____fx_surface_common);
-functionMap[HASH_ELEMENT_TAPERED_CAPSULE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tapered_capsule, &ColladaParserAutoGen14Private::_data__tapered_capsule, &ColladaParserAutoGen14Private::_end__tapered_capsule, &ColladaParserAutoGen14Private::_preBegin__tapered_capsule, &ColladaParserAutoGen14Private::_preEnd__tapered_capsule, &ColladaParserAutoGen14Private::_freeAttributes__tapered_capsule);
-functionMap[HASH_ELEMENT_TAPERED_CYLINDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tapered_cylinder, &ColladaParserAutoGen14Private::_data__tapered_cylinder, &ColladaParserAutoGen14Private::_end__tapered_cylinder, &ColladaParserAutoGen14Private::_preBegin__tapered_cylinder, &ColladaParserAutoGen14Private::_preEnd__tapered_cylinder, &ColladaParserAutoGen14Private::_freeAttributes__tapered_cylinder);
-functionMap[HASH_ELEMENT_TARGETS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__targets, &ColladaParserAutoGen14Private::_data__targets, &ColladaParserAutoGen14Private::_end__targets, &ColladaParserAutoGen14Private::_preBegin__targets, &ColladaParserAutoGen14Private::_preEnd__targets, &ColladaParserAutoGen14Private::_freeAttributes__targets);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique, &ColladaParserAutoGen14Private::_data__profile_GLES__technique, &ColladaParserAutoGen14Private::_end__profile_GLES__technique, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common);
-functionMap[HASH_ELEMENT_TEXCOMBINER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texcombiner, &ColladaParserAutoGen14Private::_data__texcombiner, &ColladaParserAutoGen14Private::_end__texcombiner, &ColladaParserAutoGen14Private::_preBegin__texcombiner, &ColladaParserAutoGen14Private::_preEnd__texcombiner, &ColladaParserAutoGen14Private::_freeAttributes__texcombiner);
-functionMap[HASH_ELEMENT_TEXENV] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texenv, &ColladaParserAutoGen14Private::_data__texenv, &ColladaParserAutoGen14Private::_end__texenv, &ColladaParserAutoGen14Private::_preBegin__texenv, &ColladaParserAutoGen14Private::_preEnd__texenv, &ColladaParserAutoGen14Private::_freeAttributes__texenv);
-functionMap[HASH_ELEMENT_TEXTURE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture, &ColladaParserAutoGen14Private::_data__texture, &ColladaParserAutoGen14Private::_end__texture, &ColladaParserAutoGen14Private::_preBegin__texture, &ColladaParserAutoGen14Private::_preEnd__texture, &ColladaParserAutoGen14Private::_freeAttributes__texture);
-functionMap[HASH_ELEMENT_TEXTURE1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture1D, &ColladaParserAutoGen14Private::_data__texture1D, &ColladaParserAutoGen14Private::_end__texture1D, &ColladaParserAutoGen14Private::_preBegin__texture1D, &ColladaParserAutoGen14Private::_preEnd__texture1D, &ColladaParserAutoGen14Private::_freeAttributes__texture1D);
-functionMap[HASH_ELEMENT_TEXTURE2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture2D, &ColladaParserAutoGen14Private::_data__texture2D, &ColladaParserAutoGen14Private::_end__texture2D, &ColladaParserAutoGen14Private::_preBegin__texture2D, &ColladaParserAutoGen14Private::_preEnd__texture2D, &ColladaParserAutoGen14Private::_freeAttributes__texture2D);
-functionMap[HASH_ELEMENT_TEXTURE3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture3D, &ColladaParserAutoGen14Private::_data__texture3D, &ColladaParserAutoGen14Private::_end__texture3D, &ColladaParserAutoGen14Private::_preBegin__texture3D, &ColladaParserAutoGen14Private::_preEnd__texture3D, &ColladaParserAutoGen14Private::_freeAttributes__texture3D);
-functionMap[HASH_ELEMENT_TEXTURECUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureCUBE, &ColladaParserAutoGen14Private::_data__textureCUBE, &ColladaParserAutoGen14Private::_end__textureCUBE, &ColladaParserAutoGen14Private::_preBegin__textureCUBE, &ColladaParserAutoGen14Private::_preEnd__textureCUBE, &ColladaParserAutoGen14Private::_freeAttributes__textureCUBE);
-functionMap[HASH_ELEMENT_TEXTUREDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureDEPTH, &ColladaParserAutoGen14Private::_data__textureDEPTH, &ColladaParserAutoGen14Private::_end__textureDEPTH, &ColladaParserAutoGen14Private::_preBegin__textureDEPTH, &ColladaParserAutoGen14Private::_preEnd__textureDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__textureDEPTH);
-functionMap[HASH_ELEMENT_TEXTURERECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureRECT, &ColladaParserAutoGen14Private::_data__textureRECT, &ColladaParserAutoGen14Private::_end__textureRECT, &ColladaParserAutoGen14Private::_preBegin__textureRECT, &ColladaParserAutoGen14Private::_preEnd__textureRECT, &ColladaParserAutoGen14Private::_freeAttributes__textureRECT);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__TEXTURE_PIPELINE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__texture_pipeline);
-functionMap[HASH_ELEMENT_TEXTURE_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture_unit, &ColladaParserAutoGen14Private::_data__texture_unit, &ColladaParserAutoGen14Private::_end__texture_unit, &ColladaParserAutoGen14Private::_preBegin__texture_unit, &ColladaParserAutoGen14Private::_preEnd__texture_unit, &ColladaParserAutoGen14Private::_freeAttributes__texture_unit);
-functionMap[HASH_ELEMENT_TRANSPARENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparent, &ColladaParserAutoGen14Private::_data__transparent, &ColladaParserAutoGen14Private::_end__transparent, &ColladaParserAutoGen14Private::_preBegin__transparent, &ColladaParserAutoGen14Private::_preEnd__transparent, &ColladaParserAutoGen14Private::_freeAttributes__transparent);
-functionMap[HASH_ELEMENT_TRIANGLES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__triangles, &ColladaParserAutoGen14Private::_data__triangles, &ColladaParserAutoGen14Private::_end__triangles, &ColladaParserAutoGen14Private::_preBegin__triangles, &ColladaParserAutoGen14Private::_preEnd__triangles, &ColladaParserAutoGen14Private::_freeAttributes__triangles);
-functionMap[HASH_ELEMENT_TRIFANS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__trifans, &ColladaParserAutoGen14Private::_data__trifans, &ColladaParserAutoGen14Private::_end__trifans, &ColladaParserAutoGen14Private::_preBegin__trifans, &ColladaParserAutoGen14Private::_preEnd__trifans, &ColladaParserAutoGen14Private::_freeAttributes__trifans);
-functionMap[HASH_ELEMENT_TRISTRIPS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tristrips, &ColladaParserAutoGen14Private::_data__tristrips, &ColladaParserAutoGen14Private::_end__tristrips, &ColladaParserAutoGen14Private::_preBegin__tristrips, &ColladaParserAutoGen14Private::_preEnd__tristrips, &ColladaParserAutoGen14Private::_freeAttributes__tristrips);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_VALUE____GL_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gl_sampler1D, &ColladaParserAutoGen14Private::_data__value____gl_sampler1D, &ColladaParserAutoGen14Private::_end__value____gl_sampler1D, &ColladaParserAutoGen14Private::_preBegin__value____gl_sampler1D, &ColladaParserAutoGen14Private::_preEnd__value____gl_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__value____gl_sampler1D);
-functionMap[HASH_ELEMENT_VERTEX_WEIGHTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__vertex_weights, &ColladaParserAutoGen14Private::_data__vertex_weights, &ColladaParserAutoGen14Private::_end__vertex_weights, &ColladaParserAutoGen14Private::_preBegin__vertex_weights, &ColladaParserAutoGen14Private::_preEnd__vertex_weights, &ColladaParserAutoGen14Private::_freeAttributes__vertex_weights);
-functionMap[HASH_ELEMENT_VERTICES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__vertices, &ColladaParserAutoGen14Private::_data__vertices, &ColladaParserAutoGen14Private::_end__vertices, &ColladaParserAutoGen14Private::_preBegin__vertices, &ColladaParserAutoGen14Private::_preEnd__vertices, &ColladaParserAutoGen14Private::_freeAttributes__vertices);
-functionMap[HASH_ELEMENT_VISUAL_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__visual_scene, &ColladaParserAutoGen14Private::_data__visual_scene, &ColladaParserAutoGen14Private::_end__visual_scene, &ColladaParserAutoGen14Private::_preBegin__visual_scene, &ColladaParserAutoGen14Private::_preEnd__visual_scene, &ColladaParserAutoGen14Private::_freeAttributes__visual_scene);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC,
+HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE,
+HASH_ELEMENT_ANIMATION,
+HASH_ELEMENT_ANIMATION_CLIP,
+HASH_ELEMENT_ARRAY____GLSL_NEWARRAY_TYPE,
+HASH_ELEMENT_ATTACHMENT,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__BIND,
+HASH_ELEMENT_BIND_MATERIAL,
+HASH_ELEMENT_BLINN,
+HASH_ELEMENT_BOX,
+HASH_ELEMENT_CAMERA,
+HASH_ELEMENT_CAPSULE,
+HASH_ELEMENT_PROFILE_COMMON__TECHNIQUE__CONSTANT,
+HASH_ELEMENT_CONTROL_VERTICES,
+HASH_ELEMENT_CONTROLLER,
+HASH_ELEMENT_CONVEX_MESH,
+HASH_ELEMENT_CYLINDER,
+HASH_ELEMENT_DIFFUSE,
+HASH_ELEMENT_EFFECT,
+HASH_ELEMENT_EMISSION,
+HASH_ELEMENT_EVALUATE_SCENE,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_FORCE_FIELD,
+HASH_ELEMENT_FORMAT_HINT,
+HASH_ELEMENT_GLSL_SURFACE_TYPE____GENERATOR,
+HASH_ELEMENT_GEOMETRY,
+HASH_ELEMENT_IMAGE,
+HASH_ELEMENT_IMAGER,
+HASH_ELEMENT_INSTANCE_ANIMATION,
+HASH_ELEMENT_INSTANCE_CAMERA,
+HASH_ELEMENT_INSTANCE_CONTROLLER,
+HASH_ELEMENT_INSTANCE_EFFECT,
+HASH_ELEMENT_INSTANCE_FORCE_FIELD,
+HASH_ELEMENT_INSTANCE_GEOMETRY,
+HASH_ELEMENT_INSTANCE_LIGHT,
+HASH_ELEMENT_INSTANCE_MATERIAL,
+HASH_ELEMENT_INSTANCE_NODE,
+HASH_ELEMENT_INSTANCE_PHYSICS_MATERIAL,
+HASH_ELEMENT_INSTANCE_PHYSICS_MODEL,
+HASH_ELEMENT_INSTANCE_PHYSICS_SCENE,
+HASH_ELEMENT_INSTANCE_RIGID_BODY,
+HASH_ELEMENT_INSTANCE_RIGID_CONSTRAINT,
+HASH_ELEMENT_INSTANCE_VISUAL_SCENE,
+HASH_ELEMENT_JOINTS,
+HASH_ELEMENT_LAMBERT,
+HASH_ELEMENT_LIBRARY_ANIMATION_CLIPS,
+HASH_ELEMENT_LIBRARY_ANIMATIONS,
+HASH_ELEMENT_LIBRARY_CAMERAS,
+HASH_ELEMENT_LIBRARY_CONTROLLERS,
+HASH_ELEMENT_LIBRARY_EFFECTS,
+HASH_ELEMENT_LIBRARY_FORCE_FIELDS,
+HASH_ELEMENT_LIBRARY_GEOMETRIES,
+HASH_ELEMENT_LIBRARY_IMAGES,
+HASH_ELEMENT_LIBRARY_LIGHTS,
+HASH_ELEMENT_LIBRARY_MATERIALS,
+HASH_ELEMENT_LIBRARY_NODES,
+HASH_ELEMENT_LIBRARY_PHYSICS_MATERIALS,
+HASH_ELEMENT_LIBRARY_PHYSICS_MODELS,
+HASH_ELEMENT_LIBRARY_PHYSICS_SCENES,
+HASH_ELEMENT_LIBRARY_VISUAL_SCENES,
+HASH_ELEMENT_LIGHT,
+HASH_ELEMENT_LINES,
+HASH_ELEMENT_LINESTRIPS,
+HASH_ELEMENT_MATERIAL,
+HASH_ELEMENT_MESH,
+HASH_ELEMENT_MORPH,
+HASH_ELEMENT_NEWPARAM____FX_NEWPARAM_COMMON,
+HASH_ELEMENT_NODE,
+HASH_ELEMENT_OPTICS,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS,
+HASH_ELEMENT_PHONG,
+HASH_ELEMENT_PHYSICS_MATERIAL,
+HASH_ELEMENT_PHYSICS_MODEL,
+HASH_ELEMENT_PHYSICS_SCENE,
+HASH_ELEMENT_PLANE,
+HASH_ELEMENT_POLYGONS,
+HASH_ELEMENT_POLYLIST,
+HASH_ELEMENT_PROFILE_CG,
+HASH_ELEMENT_PROFILE_COMMON,
+HASH_ELEMENT_PROFILE_GLES,
+HASH_ELEMENT_PROFILE_GLSL,
+HASH_ELEMENT_REF_ATTACHMENT,
+HASH_ELEMENT_REFLECTIVE,
+HASH_ELEMENT_RENDER,
+HASH_ELEMENT_RIGID_BODY,
+HASH_ELEMENT_RIGID_CONSTRAINT,
+HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON,
+HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON,
+HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON,
+HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON,
+HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON,
+HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON,
+HASH_ELEMENT_SAMPLER_STATE____GLES_SAMPLER_STATE,
+HASH_ELEMENT_SCENE,
+HASH_ELEMENT_INSTANCE_EFFECT__SETPARAM,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE,
+HASH_ELEMENT_SKIN,
+HASH_ELEMENT_SOURCE,
+HASH_ELEMENT_SPECULAR,
+HASH_ELEMENT_SPHERE,
+HASH_ELEMENT_SPLINE,
+HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON,
+HASH_ELEMENT_TAPERED_CAPSULE,
+HASH_ELEMENT_TAPERED_CYLINDER,
+HASH_ELEMENT_TARGETS,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON,
+HASH_ELEMENT_TEXCOMBINER,
+HASH_ELEMENT_TEXENV,
+HASH_ELEMENT_TEXTURE,
+HASH_ELEMENT_TEXTURE1D,
+HASH_ELEMENT_TEXTURE2D,
+HASH_ELEMENT_TEXTURE3D,
+HASH_ELEMENT_TEXTURECUBE,
+HASH_ELEMENT_TEXTUREDEPTH,
+HASH_ELEMENT_TEXTURERECT,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__TEXTURE_PIPELINE,
+HASH_ELEMENT_TEXTURE_UNIT,
+HASH_ELEMENT_TRANSPARENT,
+HASH_ELEMENT_TRIANGLES,
+HASH_ELEMENT_TRIFANS,
+HASH_ELEMENT_TRISTRIPS,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_VALUE____GL_SAMPLER1D,
+HASH_ELEMENT_VERTEX_WEIGHTS,
+HASH_ELEMENT_VERTICES,
+HASH_ELEMENT_VISUAL_SCENE,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__scene__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__scene, &ColladaParserAutoGen14Private::_data__scene, &ColladaParserAutoGen14Private::_end__scene, &ColladaParserAutoGen14Private::_preBegin__scene, &ColladaParserAutoGen14Private::_preEnd__scene, &ColladaParserAutoGen14Private::_freeAttributes__scene);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_scene, &ColladaParserAutoGen14Private::_data__instance_physics_scene, &ColladaParserAutoGen14Private::_end__instance_physics_scene, &ColladaParserAutoGen14Private::_preBegin__instance_physics_scene, &ColladaParserAutoGen14Private::_preEnd__instance_physics_scene, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_scene);
-functionMap[HASH_ELEMENT_INSTANCE_VISUAL_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_visual_scene, &ColladaParserAutoGen14Private::_data__instance_visual_scene, &ColladaParserAutoGen14Private::_end__instance_visual_scene, &ColladaParserAutoGen14Private::_preBegin__instance_visual_scene, &ColladaParserAutoGen14Private::_preEnd__instance_visual_scene, &ColladaParserAutoGen14Private::_freeAttributes__instance_visual_scene);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_SCENE,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_INSTANCE_PHYSICS_SCENE,
+HASH_ELEMENT_INSTANCE_VISUAL_SCENE,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_animation_clips__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_ANIMATION_CLIPS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_animation_clips, &ColladaParserAutoGen14Private::_data__library_animation_clips, &ColladaParserAutoGen14Private::_end__library_animation_clips, &ColladaParserAutoGen14Private::_preBegin__library_animation_clips, &ColladaParserAutoGen14Private::_preEnd__library_animation_clips, &ColladaParserAutoGen14Private::_freeAttributes__library_animation_clips);
-functionMap[HASH_ELEMENT_ANIMATION_CLIP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__animation_clip, &ColladaParserAutoGen14Private::_data__animation_clip, &ColladaParserAutoGen14Private::_end__animation_clip, &ColladaParserAutoGen14Private::_preBegin__animation_clip, &ColladaParserAutoGen14Private::_preEnd__animation_clip, &ColladaParserAutoGen14Private::_freeAttributes__animation_clip);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_INSTANCE_ANIMATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_animation, &ColladaParserAutoGen14Private::_data__instance_animation, &ColladaParserAutoGen14Private::_end__instance_animation, &ColladaParserAutoGen14Private::_preBegin__instance_animation, &ColladaParserAutoGen14Private::_preEnd__instance_animation, &ColladaParserAutoGen14Private::_freeAttributes__instance_animation);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_ANIMATION_CLIPS,
+HASH_ELEMENT_ANIMATION_CLIP,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_INSTANCE_ANIMATION,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_animations__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_ANIMATIONS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_animations, &ColladaParserAutoGen14Private::_data__library_animations, &ColladaParserAutoGen14Private::_end__library_animations, &ColladaParserAutoGen14Private::_preBegin__library_animations, &ColladaParserAutoGen14Private::_preEnd__library_animations, &ColladaParserAutoGen14Private::_freeAttributes__library_animations);
-functionMap[HASH_ELEMENT_ANIMATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__animation, &ColladaParserAutoGen14Private::_data__animation, &ColladaParserAutoGen14Private::_end__animation, &ColladaParserAutoGen14Private::_preBegin__animation, &ColladaParserAutoGen14Private::_preEnd__animation, &ColladaParserAutoGen14Private::_freeAttributes__animation);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_CHANNEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__channel, &ColladaParserAutoGen14Private::_data__channel, &ColladaParserAutoGen14Private::_end__channel, &ColladaParserAutoGen14Private::_preBegin__channel, &ColladaParserAutoGen14Private::_preEnd__channel, &ColladaParserAutoGen14Private::_freeAttributes__channel);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_SAMPLER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler, &ColladaParserAutoGen14Private::_data__sampler, &ColladaParserAutoGen14Private::_end__sampler, &ColladaParserAutoGen14Private::_preBegin__sampler, &ColladaParserAutoGen14Private::_preEnd__sampler, &ColladaParserAutoGen14Private::_freeAttributes__sampler);
-functionMap[HASH_ELEMENT_SOURCE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source, &ColladaParserAutoGen14Private::_data__source, &ColladaParserAutoGen14Private::_end__source, &ColladaParserAutoGen14Private::_preBegin__source, &ColladaParserAutoGen14Private::_preEnd__source, &ColladaParserAutoGen14Private::_freeAttributes__source);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocal, &ColladaParserAutoGen14Private::_data__input____InputLocal, &ColladaParserAutoGen14Private::_end__input____InputLocal, &ColladaParserAutoGen14Private::_preBegin__input____InputLocal, &ColladaParserAutoGen14Private::_preEnd__input____InputLocal, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocal);
-functionMap[HASH_ELEMENT_IDREF_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__IDREF_array, &ColladaParserAutoGen14Private::_data__IDREF_array, &ColladaParserAutoGen14Private::_end__IDREF_array, &ColladaParserAutoGen14Private::_preBegin__IDREF_array, &ColladaParserAutoGen14Private::_preEnd__IDREF_array, &ColladaParserAutoGen14Private::_freeAttributes__IDREF_array);
-functionMap[HASH_ELEMENT_NAME_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__Name_array, &ColladaParserAutoGen14Private::_data__Name_array, &ColladaParserAutoGen14Private::_end__Name_array, &ColladaParserAutoGen14Private::_preBegin__Name_array, &ColladaParserAutoGen14Private::_preEnd__Name_array, &ColladaParserAutoGen14Private::_freeAttributes__Name_array);
-functionMap[HASH_ELEMENT_BOOL_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool_array, &ColladaParserAutoGen14Private::_data__bool_array, &ColladaParserAutoGen14Private::_end__bool_array, &ColladaParserAutoGen14Private::_preBegin__bool_array, &ColladaParserAutoGen14Private::_preEnd__bool_array, &ColladaParserAutoGen14Private::_freeAttributes__bool_array);
-functionMap[HASH_ELEMENT_FLOAT_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float_array, &ColladaParserAutoGen14Private::_data__float_array, &ColladaParserAutoGen14Private::_end__float_array, &ColladaParserAutoGen14Private::_preBegin__float_array, &ColladaParserAutoGen14Private::_preEnd__float_array, &ColladaParserAutoGen14Private::_freeAttributes__float_array);
-functionMap[HASH_ELEMENT_INT_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int_array, &ColladaParserAutoGen14Private::_data__int_array, &ColladaParserAutoGen14Private::_end__int_array, &ColladaParserAutoGen14Private::_preBegin__int_array, &ColladaParserAutoGen14Private::_preEnd__int_array, &ColladaParserAutoGen14Private::_freeAttributes__int_array);
-functionMap[HASH_ELEMENT_ANIMATION__SOURCE__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__animation__source__technique_common, &ColladaParserAutoGen14Private::_data__animation__source__technique_common, &ColladaParserAutoGen14Private::_end__animation__source__technique_common, &ColladaParserAutoGen14Private::_preBegin__animation__source__technique_common, &ColladaParserAutoGen14Private::_preEnd__animation__source__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__animation__source__technique_common);
-functionMap[HASH_ELEMENT_ACCESSOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__accessor, &ColladaParserAutoGen14Private::_data__accessor, &ColladaParserAutoGen14Private::_end__accessor, &ColladaParserAutoGen14Private::_preBegin__accessor, &ColladaParserAutoGen14Private::_preEnd__accessor, &ColladaParserAutoGen14Private::_freeAttributes__accessor);
-functionMap[HASH_ELEMENT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param, &ColladaParserAutoGen14Private::_data__param, &ColladaParserAutoGen14Private::_end__param, &ColladaParserAutoGen14Private::_preBegin__param, &ColladaParserAutoGen14Private::_preEnd__param, &ColladaParserAutoGen14Private::_freeAttributes__param);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_ANIMATIONS,
+HASH_ELEMENT_ANIMATION,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_CHANNEL,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_SAMPLER,
+HASH_ELEMENT_SOURCE,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_INPUT____INPUTLOCAL,
+HASH_ELEMENT_IDREF_ARRAY,
+HASH_ELEMENT_NAME_ARRAY,
+HASH_ELEMENT_BOOL_ARRAY,
+HASH_ELEMENT_FLOAT_ARRAY,
+HASH_ELEMENT_INT_ARRAY,
+HASH_ELEMENT_ANIMATION__SOURCE__TECHNIQUE_COMMON,
+HASH_ELEMENT_ACCESSOR,
+HASH_ELEMENT_PARAM,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_cameras__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_CAMERAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_cameras, &ColladaParserAutoGen14Private::_data__library_cameras, &ColladaParserAutoGen14Private::_end__library_cameras, &ColladaParserAutoGen14Private::_preBegin__library_cameras, &ColladaParserAutoGen14Private::_preEnd__library_cameras, &ColladaParserAutoGen14Private::_freeAttributes__library_cameras);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_CAMERA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__camera, &ColladaParserAutoGen14Private::_data__camera, &ColladaParserAutoGen14Private::_end__camera, &ColladaParserAutoGen14Private::_preBegin__camera, &ColladaParserAutoGen14Private::_preEnd__camera, &ColladaParserAutoGen14Private::_freeAttributes__camera);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_IMAGER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__imager, &ColladaParserAutoGen14Private::_data__imager, &ColladaParserAutoGen14Private::_end__imager, &ColladaParserAutoGen14Private::_preBegin__imager, &ColladaParserAutoGen14Private::_preEnd__imager, &ColladaParserAutoGen14Private::_freeAttributes__imager);
-functionMap[HASH_ELEMENT_OPTICS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__optics, &ColladaParserAutoGen14Private::_data__optics, &ColladaParserAutoGen14Private::_end__optics, &ColladaParserAutoGen14Private::_preBegin__optics, &ColladaParserAutoGen14Private::_preEnd__optics, &ColladaParserAutoGen14Private::_freeAttributes__optics);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_OPTICS__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__optics__technique_common, &ColladaParserAutoGen14Private::_data__optics__technique_common, &ColladaParserAutoGen14Private::_end__optics__technique_common, &ColladaParserAutoGen14Private::_preBegin__optics__technique_common, &ColladaParserAutoGen14Private::_preEnd__optics__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__optics__technique_common);
-functionMap[HASH_ELEMENT_ORTHOGRAPHIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__orthographic, &ColladaParserAutoGen14Private::_data__orthographic, &ColladaParserAutoGen14Private::_end__orthographic, &ColladaParserAutoGen14Private::_preBegin__orthographic, &ColladaParserAutoGen14Private::_preEnd__orthographic, &ColladaParserAutoGen14Private::_freeAttributes__orthographic);
-functionMap[HASH_ELEMENT_PERSPECTIVE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__perspective, &ColladaParserAutoGen14Private::_data__perspective, &ColladaParserAutoGen14Private::_end__perspective, &ColladaParserAutoGen14Private::_preBegin__perspective, &ColladaParserAutoGen14Private::_preEnd__perspective, &ColladaParserAutoGen14Private::_freeAttributes__perspective);
-functionMap[HASH_ELEMENT_ASPECT_RATIO] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__aspect_ratio, &ColladaParserAutoGen14Private::_data__aspect_ratio, &ColladaParserAutoGen14Private::_end__aspect_ratio, &ColladaParserAutoGen14Private::_preBegin__aspect_ratio, &ColladaParserAutoGen14Private::_preEnd__aspect_ratio, &ColladaParserAutoGen14Private::_freeAttributes__aspect_ratio);
-functionMap[HASH_ELEMENT_XMAG] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__xmag, &ColladaParserAutoGen14Private::_data__xmag, &ColladaParserAutoGen14Private::_end__xmag, &ColladaParserAutoGen14Private::_preBegin__xmag, &ColladaParserAutoGen14Private::_preEnd__xmag, &ColladaParserAutoGen14Private::_freeAttributes__xmag);
-functionMap[HASH_ELEMENT_YMAG] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ymag, &ColladaParserAutoGen14Private::_data__ymag, &ColladaParserAutoGen14Private::_end__ymag, &ColladaParserAutoGen14Private::_preBegin__ymag, &ColladaParserAutoGen14Private::_preEnd__ymag, &ColladaParserAutoGen14Private::_freeAttributes__ymag);
-functionMap[HASH_ELEMENT_ZFAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__zfar, &ColladaParserAutoGen14Private::_data__zfar, &ColladaParserAutoGen14Private::_end__zfar, &ColladaParserAutoGen14Private::_preBegin__zfar, &ColladaParserAutoGen14Private::_preEnd__zfar, &ColladaParserAutoGen14Private::_freeAttributes__zfar);
-functionMap[HASH_ELEMENT_ZNEAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__znear, &ColladaParserAutoGen14Private::_data__znear, &ColladaParserAutoGen14Private::_end__znear, &ColladaParserAutoGen14Private::_preBegin__znear, &ColladaParserAutoGen14Private::_preEnd__znear, &ColladaParserAutoGen14Private::_freeAttributes__znear);
-functionMap[HASH_ELEMENT_ASPECT_RATIO] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__aspect_ratio, &ColladaParserAutoGen14Private::_data__aspect_ratio, &ColladaParserAutoGen14Private::_end__aspect_ratio, &ColladaParserAutoGen14Private::_preBegin__aspect_ratio, &ColladaParserAutoGen14Private::_preEnd__aspect_ratio, &ColladaParserAutoGen14Private::_freeAttributes__aspect_ratio);
-functionMap[HASH_ELEMENT_XFOV] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__xfov, &ColladaParserAutoGen14Private::_data__xfov, &ColladaParserAutoGen14Private::_end__xfov, &ColladaParserAutoGen14Private::_preBegin__xfov, &ColladaParserAutoGen14Private::_preEnd__xfov, &ColladaParserAutoGen14Private::_freeAttributes__xfov);
-functionMap[HASH_ELEMENT_YFOV] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__yfov, &ColladaParserAutoGen14Private::_data__yfov, &ColladaParserAutoGen14Private::_end__yfov, &ColladaParserAutoGen14Private::_preBegin__yfov, &ColladaParserAutoGen14Private::_preEnd__yfov, &ColladaParserAutoGen14Private::_freeAttributes__yfov);
-functionMap[HASH_ELEMENT_ZFAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__zfar, &ColladaParserAutoGen14Private::_data__zfar, &ColladaParserAutoGen14Private::_end__zfar, &ColladaParserAutoGen14Private::_preBegin__zfar, &ColladaParserAutoGen14Private::_preEnd__zfar, &ColladaParserAutoGen14Private::_freeAttributes__zfar);
-functionMap[HASH_ELEMENT_ZNEAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__znear, &ColladaParserAutoGen14Private::_data__znear, &ColladaParserAutoGen14Private::_end__znear, &ColladaParserAutoGen14Private::_preBegin__znear, &ColladaParserAutoGen14Private::_preEnd__znear, &ColladaParserAutoGen14Private::_freeAttributes__znear);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_CAMERAS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_CAMERA,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_IMAGER,
+HASH_ELEMENT_OPTICS,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_OPTICS__TECHNIQUE_COMMON,
+HASH_ELEMENT_ORTHOGRAPHIC,
+HASH_ELEMENT_PERSPECTIVE,
+HASH_ELEMENT_ASPECT_RATIO,
+HASH_ELEMENT_XMAG,
+HASH_ELEMENT_YMAG,
+HASH_ELEMENT_ZFAR,
+HASH_ELEMENT_ZNEAR,
+HASH_ELEMENT_ASPECT_RATIO,
+HASH_ELEMENT_XFOV,
+HASH_ELEMENT_YFOV,
+HASH_ELEMENT_ZFAR,
+HASH_ELEMENT_ZNEAR,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_controllers__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_CONTROLLERS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_controllers, &ColladaParserAutoGen14Private::_data__library_controllers, &ColladaParserAutoGen14Private::_end__library_controllers, &ColladaParserAutoGen14Private::_preBegin__library_controllers, &ColladaParserAutoGen14Private::_preEnd__library_controllers, &ColladaParserAutoGen14Private::_freeAttributes__library_controllers);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_CONTROLLER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__controller, &ColladaParserAutoGen14Private::_data__controller, &ColladaParserAutoGen14Private::_end__controller, &ColladaParserAutoGen14Private::_preBegin__controller, &ColladaParserAutoGen14Private::_preEnd__controller, &ColladaParserAutoGen14Private::_freeAttributes__controller);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_MORPH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__morph, &ColladaParserAutoGen14Private::_data__morph, &ColladaParserAutoGen14Private::_end__morph, &ColladaParserAutoGen14Private::_preBegin__morph, &ColladaParserAutoGen14Private::_preEnd__morph, &ColladaParserAutoGen14Private::_freeAttributes__morph);
-functionMap[HASH_ELEMENT_SKIN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__skin, &ColladaParserAutoGen14Private::_data__skin, &ColladaParserAutoGen14Private::_end__skin, &ColladaParserAutoGen14Private::_preBegin__skin, &ColladaParserAutoGen14Private::_preEnd__skin, &ColladaParserAutoGen14Private::_freeAttributes__skin);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_SOURCE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source, &ColladaParserAutoGen14Private::_data__source, &ColladaParserAutoGen14Private::_end__source, &ColladaParserAutoGen14Private::_preBegin__source, &ColladaParserAutoGen14Private::_preEnd__source, &ColladaParserAutoGen14Private::_freeAttributes__source);
-functionMap[HASH_ELEMENT_TARGETS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__targets, &ColladaParserAutoGen14Private::_data__targets, &ColladaParserAutoGen14Private::_end__targets, &ColladaParserAutoGen14Private::_preBegin__targets, &ColladaParserAutoGen14Private::_preEnd__targets, &ColladaParserAutoGen14Private::_freeAttributes__targets);
-functionMap[HASH_ELEMENT_IDREF_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__IDREF_array, &ColladaParserAutoGen14Private::_data__IDREF_array, &ColladaParserAutoGen14Private::_end__IDREF_array, &ColladaParserAutoGen14Private::_preBegin__IDREF_array, &ColladaParserAutoGen14Private::_preEnd__IDREF_array, &ColladaParserAutoGen14Private::_freeAttributes__IDREF_array);
-functionMap[HASH_ELEMENT_NAME_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__Name_array, &ColladaParserAutoGen14Private::_data__Name_array, &ColladaParserAutoGen14Private::_end__Name_array, &ColladaParserAutoGen14Private::_preBegin__Name_array, &ColladaParserAutoGen14Private::_preEnd__Name_array, &ColladaParserAutoGen14Private::_freeAttributes__Name_array);
-functionMap[HASH_ELEMENT_BOOL_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool_array, &ColladaParserAutoGen14Private::_data__bool_array, &ColladaParserAutoGen14Private::_end__bool_array, &ColladaParserAutoGen14Private::_preBegin__bool_array, &ColladaParserAutoGen14Private::_preEnd__bool_array, &ColladaParserAutoGen14Private::_freeAttributes__bool_array);
-functionMap[HASH_ELEMENT_FLOAT_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float_array, &ColladaParserAutoGen14Private::_data__float_array, &ColladaParserAutoGen14Private::_end__float_array, &ColladaParserAutoGen14Private::_preBegin__float_array, &ColladaParserAutoGen14Private::_preEnd__float_array, &ColladaParserAutoGen14Private::_freeAttributes__float_array);
-functionMap[HASH_ELEMENT_INT_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int_array, &ColladaParserAutoGen14Private::_data__int_array, &ColladaParserAutoGen14Private::_end__int_array, &ColladaParserAutoGen14Private::_preBegin__int_array, &ColladaParserAutoGen14Private::_preEnd__int_array, &ColladaParserAutoGen14Private::_freeAttributes__int_array);
-functionMap[HASH_ELEMENT_ANIMATION__SOURCE__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__animation__source__technique_common, &ColladaParserAutoGen14Private::_data__animation__source__technique_common, &ColladaParserAutoGen14Private::_end__animation__source__technique_common, &ColladaParserAutoGen14Private::_preBegin__animation__source__technique_common, &ColladaParserAutoGen14Private::_preEnd__animation__source__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__animation__source__technique_common);
-functionMap[HASH_ELEMENT_ACCESSOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__accessor, &ColladaParserAutoGen14Private::_data__accessor, &ColladaParserAutoGen14Private::_end__accessor, &ColladaParserAutoGen14Private::_preBegin__accessor, &ColladaParserAutoGen14Private::_preEnd__accessor, &ColladaParserAutoGen14Private::_freeAttributes__accessor);
-functionMap[HASH_ELEMENT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param, &ColladaParserAutoGen14Private::_data__param, &ColladaParserAutoGen14Private::_end__param, &ColladaParserAutoGen14Private::_preBegin__param, &ColladaParserAutoGen14Private::_preEnd__param, &ColladaParserAutoGen14Private::_freeAttributes__param);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocal, &ColladaParserAutoGen14Private::_data__input____InputLocal, &ColladaParserAutoGen14Private::_end__input____InputLocal, &ColladaParserAutoGen14Private::_preBegin__input____InputLocal, &ColladaParserAutoGen14Private::_preEnd__input____InputLocal, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocal);
-functionMap[HASH_ELEMENT_BIND_SHAPE_MATRIX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_shape_matrix, &ColladaParserAutoGen14Private::_data__bind_shape_matrix, &ColladaParserAutoGen14Private::_end__bind_shape_matrix, &ColladaParserAutoGen14Private::_preBegin__bind_shape_matrix, &ColladaParserAutoGen14Private::_preEnd__bind_shape_matrix, &ColladaParserAutoGen14Private::_freeAttributes__bind_shape_matrix);
-functionMap[HASH_ELEMENT_JOINTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__joints, &ColladaParserAutoGen14Private::_data__joints, &ColladaParserAutoGen14Private::_end__joints, &ColladaParserAutoGen14Private::_preBegin__joints, &ColladaParserAutoGen14Private::_preEnd__joints, &ColladaParserAutoGen14Private::_freeAttributes__joints);
-functionMap[HASH_ELEMENT_VERTEX_WEIGHTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__vertex_weights, &ColladaParserAutoGen14Private::_data__vertex_weights, &ColladaParserAutoGen14Private::_end__vertex_weights, &ColladaParserAutoGen14Private::_preBegin__vertex_weights, &ColladaParserAutoGen14Private::_preEnd__vertex_weights, &ColladaParserAutoGen14Private::_freeAttributes__vertex_weights);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocal, &ColladaParserAutoGen14Private::_data__input____InputLocal, &ColladaParserAutoGen14Private::_end__input____InputLocal, &ColladaParserAutoGen14Private::_preBegin__input____InputLocal, &ColladaParserAutoGen14Private::_preEnd__input____InputLocal, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocal);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_V] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__v, &ColladaParserAutoGen14Private::_data__v, &ColladaParserAutoGen14Private::_end__v, &ColladaParserAutoGen14Private::_preBegin__v, &ColladaParserAutoGen14Private::_preEnd__v, &ColladaParserAutoGen14Private::_freeAttributes__v);
-functionMap[HASH_ELEMENT_VCOUNT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__vcount, &ColladaParserAutoGen14Private::_data__vcount, &ColladaParserAutoGen14Private::_end__vcount, &ColladaParserAutoGen14Private::_preBegin__vcount, &ColladaParserAutoGen14Private::_preEnd__vcount, &ColladaParserAutoGen14Private::_freeAttributes__vcount);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_CONTROLLERS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_CONTROLLER,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_MORPH,
+HASH_ELEMENT_SKIN,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_SOURCE,
+HASH_ELEMENT_TARGETS,
+HASH_ELEMENT_IDREF_ARRAY,
+HASH_ELEMENT_NAME_ARRAY,
+HASH_ELEMENT_BOOL_ARRAY,
+HASH_ELEMENT_FLOAT_ARRAY,
+HASH_ELEMENT_INT_ARRAY,
+HASH_ELEMENT_ANIMATION__SOURCE__TECHNIQUE_COMMON,
+HASH_ELEMENT_ACCESSOR,
+HASH_ELEMENT_PARAM,
+HASH_ELEMENT_INPUT____INPUTLOCAL,
+HASH_ELEMENT_BIND_SHAPE_MATRIX,
+HASH_ELEMENT_JOINTS,
+HASH_ELEMENT_VERTEX_WEIGHTS,
+HASH_ELEMENT_INPUT____INPUTLOCAL,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_V,
+HASH_ELEMENT_VCOUNT,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_effects__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_EFFECTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_effects, &ColladaParserAutoGen14Private::_data__library_effects, &ColladaParserAutoGen14Private::_end__library_effects, &ColladaParserAutoGen14Private::_preBegin__library_effects, &ColladaParserAutoGen14Private::_preEnd__library_effects, &ColladaParserAutoGen14Private::_freeAttributes__library_effects);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EFFECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__effect, &ColladaParserAutoGen14Private::_data__effect, &ColladaParserAutoGen14Private::_end__effect, &ColladaParserAutoGen14Private::_preBegin__effect, &ColladaParserAutoGen14Private::_preEnd__effect, &ColladaParserAutoGen14Private::_freeAttributes__effect);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_IMAGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__image, &ColladaParserAutoGen14Private::_data__image, &ColladaParserAutoGen14Private::_end__image, &ColladaParserAutoGen14Private::_preBegin__image, &ColladaParserAutoGen14Private::_preEnd__image, &ColladaParserAutoGen14Private::_freeAttributes__image);
-functionMap[HASH_ELEMENT_NEWPARAM____FX_NEWPARAM_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_data__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_end__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_preBegin__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_preEnd__newparam____fx_newparam_common, &ColladaParserAutoGen14Private::_freeAttributes__newparam____fx_newparam_common);
-functionMap[HASH_ELEMENT_PROFILE_CG] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG, &ColladaParserAutoGen14Private::_data__profile_CG, &ColladaParserAutoGen14Private::_end__profile_CG, &ColladaParserAutoGen14Private::_preBegin__profile_CG, &ColladaParserAutoGen14Private::_preEnd__profile_CG, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG);
-functionMap[HASH_ELEMENT_PROFILE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_COMMON, &ColladaParserAutoGen14Private::_data__profile_COMMON, &ColladaParserAutoGen14Private::_end__profile_COMMON, &ColladaParserAutoGen14Private::_preBegin__profile_COMMON, &ColladaParserAutoGen14Private::_preEnd__profile_COMMON, &ColladaParserAutoGen14Private::_freeAttributes__profile_COMMON);
-functionMap[HASH_ELEMENT_PROFILE_GLES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES, &ColladaParserAutoGen14Private::_data__profile_GLES, &ColladaParserAutoGen14Private::_end__profile_GLES, &ColladaParserAutoGen14Private::_preBegin__profile_GLES, &ColladaParserAutoGen14Private::_preEnd__profile_GLES, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES);
-functionMap[HASH_ELEMENT_PROFILE_GLSL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL, &ColladaParserAutoGen14Private::_data__profile_GLSL, &ColladaParserAutoGen14Private::_end__profile_GLSL, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL);
-functionMap[HASH_ELEMENT_BOOL____BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____bool, &ColladaParserAutoGen14Private::_data__bool____bool, &ColladaParserAutoGen14Private::_end__bool____bool, &ColladaParserAutoGen14Private::_preBegin__bool____bool, &ColladaParserAutoGen14Private::_preEnd__bool____bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____bool);
-functionMap[HASH_ELEMENT_BOOL2____BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____bool2, &ColladaParserAutoGen14Private::_data__bool2____bool2, &ColladaParserAutoGen14Private::_end__bool2____bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____bool2);
-functionMap[HASH_ELEMENT_BOOL3____BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____bool3, &ColladaParserAutoGen14Private::_data__bool3____bool3, &ColladaParserAutoGen14Private::_end__bool3____bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____bool3);
-functionMap[HASH_ELEMENT_BOOL4____BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____bool4, &ColladaParserAutoGen14Private::_data__bool4____bool4, &ColladaParserAutoGen14Private::_end__bool4____bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____bool4);
-functionMap[HASH_ELEMENT_FLOAT____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____float, &ColladaParserAutoGen14Private::_data__float____float, &ColladaParserAutoGen14Private::_end__float____float, &ColladaParserAutoGen14Private::_preBegin__float____float, &ColladaParserAutoGen14Private::_preEnd__float____float, &ColladaParserAutoGen14Private::_freeAttributes__float____float);
-functionMap[HASH_ELEMENT_FLOAT2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____float2, &ColladaParserAutoGen14Private::_data__float2____float2, &ColladaParserAutoGen14Private::_end__float2____float2, &ColladaParserAutoGen14Private::_preBegin__float2____float2, &ColladaParserAutoGen14Private::_preEnd__float2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____float2x2, &ColladaParserAutoGen14Private::_data__float2x2____float2x2, &ColladaParserAutoGen14Private::_end__float2x2____float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____float2x2);
-functionMap[HASH_ELEMENT_FLOAT3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____float3, &ColladaParserAutoGen14Private::_data__float3____float3, &ColladaParserAutoGen14Private::_end__float3____float3, &ColladaParserAutoGen14Private::_preBegin__float3____float3, &ColladaParserAutoGen14Private::_preEnd__float3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____float3);
-functionMap[HASH_ELEMENT_FLOAT3X3____FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____float3x3, &ColladaParserAutoGen14Private::_data__float3x3____float3x3, &ColladaParserAutoGen14Private::_end__float3x3____float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____float3x3);
-functionMap[HASH_ELEMENT_FLOAT4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____float4, &ColladaParserAutoGen14Private::_data__float4____float4, &ColladaParserAutoGen14Private::_end__float4____float4, &ColladaParserAutoGen14Private::_preBegin__float4____float4, &ColladaParserAutoGen14Private::_preEnd__float4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____float4);
-functionMap[HASH_ELEMENT_FLOAT4X4____FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____float4x4, &ColladaParserAutoGen14Private::_data__float4x4____float4x4, &ColladaParserAutoGen14Private::_end__float4x4____float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____float4x4);
-functionMap[HASH_ELEMENT_INT____INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____int, &ColladaParserAutoGen14Private::_data__int____int, &ColladaParserAutoGen14Private::_end__int____int, &ColladaParserAutoGen14Private::_preBegin__int____int, &ColladaParserAutoGen14Private::_preEnd__int____int, &ColladaParserAutoGen14Private::_freeAttributes__int____int);
-functionMap[HASH_ELEMENT_INT2____INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____int2, &ColladaParserAutoGen14Private::_data__int2____int2, &ColladaParserAutoGen14Private::_end__int2____int2, &ColladaParserAutoGen14Private::_preBegin__int2____int2, &ColladaParserAutoGen14Private::_preEnd__int2____int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____int2);
-functionMap[HASH_ELEMENT_INT3____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____int3, &ColladaParserAutoGen14Private::_data__int3____int3, &ColladaParserAutoGen14Private::_end__int3____int3, &ColladaParserAutoGen14Private::_preBegin__int3____int3, &ColladaParserAutoGen14Private::_preEnd__int3____int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____int3);
-functionMap[HASH_ELEMENT_INT4____INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____int4, &ColladaParserAutoGen14Private::_data__int4____int4, &ColladaParserAutoGen14Private::_end__int4____int4, &ColladaParserAutoGen14Private::_preBegin__int4____int4, &ColladaParserAutoGen14Private::_preEnd__int4____int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____int4);
-functionMap[HASH_ELEMENT_STRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__string, &ColladaParserAutoGen14Private::_data__string, &ColladaParserAutoGen14Private::_end__string, &ColladaParserAutoGen14Private::_preBegin__string, &ColladaParserAutoGen14Private::_preEnd__string, &ColladaParserAutoGen14Private::_freeAttributes__string);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__data, &ColladaParserAutoGen14Private::_data__data, &ColladaParserAutoGen14Private::_end__data, &ColladaParserAutoGen14Private::_preBegin__data, &ColladaParserAutoGen14Private::_preEnd__data, &ColladaParserAutoGen14Private::_freeAttributes__data);
-functionMap[HASH_ELEMENT_INIT_FROM____ANYURI] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_from____anyURI, &ColladaParserAutoGen14Private::_data__init_from____anyURI, &ColladaParserAutoGen14Private::_end__init_from____anyURI, &ColladaParserAutoGen14Private::_preBegin__init_from____anyURI, &ColladaParserAutoGen14Private::_preEnd__init_from____anyURI, &ColladaParserAutoGen14Private::_freeAttributes__init_from____anyURI);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_BOOL____BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____bool, &ColladaParserAutoGen14Private::_data__bool____bool, &ColladaParserAutoGen14Private::_end__bool____bool, &ColladaParserAutoGen14Private::_preBegin__bool____bool, &ColladaParserAutoGen14Private::_preEnd__bool____bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____bool);
-functionMap[HASH_ELEMENT_BOOL2____BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____bool2, &ColladaParserAutoGen14Private::_data__bool2____bool2, &ColladaParserAutoGen14Private::_end__bool2____bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____bool2);
-functionMap[HASH_ELEMENT_BOOL3____BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____bool3, &ColladaParserAutoGen14Private::_data__bool3____bool3, &ColladaParserAutoGen14Private::_end__bool3____bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____bool3);
-functionMap[HASH_ELEMENT_BOOL4____BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____bool4, &ColladaParserAutoGen14Private::_data__bool4____bool4, &ColladaParserAutoGen14Private::_end__bool4____bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____bool4);
-functionMap[HASH_ELEMENT_ENUM____STRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____string, &ColladaParserAutoGen14Private::_data__enum____string, &ColladaParserAutoGen14Private::_end__enum____string, &ColladaParserAutoGen14Private::_preBegin__enum____string, &ColladaParserAutoGen14Private::_preEnd__enum____string, &ColladaParserAutoGen14Private::_freeAttributes__enum____string);
-functionMap[HASH_ELEMENT_FLOAT____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____float, &ColladaParserAutoGen14Private::_data__float____float, &ColladaParserAutoGen14Private::_end__float____float, &ColladaParserAutoGen14Private::_preBegin__float____float, &ColladaParserAutoGen14Private::_preEnd__float____float, &ColladaParserAutoGen14Private::_freeAttributes__float____float);
-functionMap[HASH_ELEMENT_FLOAT1X1____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x1____float, &ColladaParserAutoGen14Private::_data__float1x1____float, &ColladaParserAutoGen14Private::_end__float1x1____float, &ColladaParserAutoGen14Private::_preBegin__float1x1____float, &ColladaParserAutoGen14Private::_preEnd__float1x1____float, &ColladaParserAutoGen14Private::_freeAttributes__float1x1____float);
-functionMap[HASH_ELEMENT_FLOAT1X2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x2____float2, &ColladaParserAutoGen14Private::_data__float1x2____float2, &ColladaParserAutoGen14Private::_end__float1x2____float2, &ColladaParserAutoGen14Private::_preBegin__float1x2____float2, &ColladaParserAutoGen14Private::_preEnd__float1x2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float1x2____float2);
-functionMap[HASH_ELEMENT_FLOAT1X3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x3____float3, &ColladaParserAutoGen14Private::_data__float1x3____float3, &ColladaParserAutoGen14Private::_end__float1x3____float3, &ColladaParserAutoGen14Private::_preBegin__float1x3____float3, &ColladaParserAutoGen14Private::_preEnd__float1x3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float1x3____float3);
-functionMap[HASH_ELEMENT_FLOAT1X4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x4____float4, &ColladaParserAutoGen14Private::_data__float1x4____float4, &ColladaParserAutoGen14Private::_end__float1x4____float4, &ColladaParserAutoGen14Private::_preBegin__float1x4____float4, &ColladaParserAutoGen14Private::_preEnd__float1x4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float1x4____float4);
-functionMap[HASH_ELEMENT_FLOAT2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____float2, &ColladaParserAutoGen14Private::_data__float2____float2, &ColladaParserAutoGen14Private::_end__float2____float2, &ColladaParserAutoGen14Private::_preBegin__float2____float2, &ColladaParserAutoGen14Private::_preEnd__float2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____float2);
-functionMap[HASH_ELEMENT_FLOAT2X1____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x1____float2, &ColladaParserAutoGen14Private::_data__float2x1____float2, &ColladaParserAutoGen14Private::_end__float2x1____float2, &ColladaParserAutoGen14Private::_preBegin__float2x1____float2, &ColladaParserAutoGen14Private::_preEnd__float2x1____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2x1____float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____float2x2, &ColladaParserAutoGen14Private::_data__float2x2____float2x2, &ColladaParserAutoGen14Private::_end__float2x2____float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____float2x2);
-functionMap[HASH_ELEMENT_FLOAT2X3____FLOAT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x3____float2x3, &ColladaParserAutoGen14Private::_data__float2x3____float2x3, &ColladaParserAutoGen14Private::_end__float2x3____float2x3, &ColladaParserAutoGen14Private::_preBegin__float2x3____float2x3, &ColladaParserAutoGen14Private::_preEnd__float2x3____float2x3, &ColladaParserAutoGen14Private::_freeAttributes__float2x3____float2x3);
-functionMap[HASH_ELEMENT_FLOAT2X4____FLOAT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x4____float2x4, &ColladaParserAutoGen14Private::_data__float2x4____float2x4, &ColladaParserAutoGen14Private::_end__float2x4____float2x4, &ColladaParserAutoGen14Private::_preBegin__float2x4____float2x4, &ColladaParserAutoGen14Private::_preEnd__float2x4____float2x4, &ColladaParserAutoGen14Private::_freeAttributes__float2x4____float2x4);
-functionMap[HASH_ELEMENT_FLOAT3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____float3, &ColladaParserAutoGen14Private::_data__float3____float3, &ColladaParserAutoGen14Private::_end__float3____float3, &ColladaParserAutoGen14Private::_preBegin__float3____float3, &ColladaParserAutoGen14Private::_preEnd__float3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____float3);
-functionMap[HASH_ELEMENT_FLOAT3X1____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x1____float3, &ColladaParserAutoGen14Private::_data__float3x1____float3, &ColladaParserAutoGen14Private::_end__float3x1____float3, &ColladaParserAutoGen14Private::_preBegin__float3x1____float3, &ColladaParserAutoGen14Private::_preEnd__float3x1____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3x1____float3);
-functionMap[HASH_ELEMENT_FLOAT3X2____FLOAT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x2____float3x2, &ColladaParserAutoGen14Private::_data__float3x2____float3x2, &ColladaParserAutoGen14Private::_end__float3x2____float3x2, &ColladaParserAutoGen14Private::_preBegin__float3x2____float3x2, &ColladaParserAutoGen14Private::_preEnd__float3x2____float3x2, &ColladaParserAutoGen14Private::_freeAttributes__float3x2____float3x2);
-functionMap[HASH_ELEMENT_FLOAT3X3____FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____float3x3, &ColladaParserAutoGen14Private::_data__float3x3____float3x3, &ColladaParserAutoGen14Private::_end__float3x3____float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____float3x3);
-functionMap[HASH_ELEMENT_FLOAT3X4____FLOAT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x4____float3x4, &ColladaParserAutoGen14Private::_data__float3x4____float3x4, &ColladaParserAutoGen14Private::_end__float3x4____float3x4, &ColladaParserAutoGen14Private::_preBegin__float3x4____float3x4, &ColladaParserAutoGen14Private::_preEnd__float3x4____float3x4, &ColladaParserAutoGen14Private::_freeAttributes__float3x4____float3x4);
-functionMap[HASH_ELEMENT_FLOAT4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____float4, &ColladaParserAutoGen14Private::_data__float4____float4, &ColladaParserAutoGen14Private::_end__float4____float4, &ColladaParserAutoGen14Private::_preBegin__float4____float4, &ColladaParserAutoGen14Private::_preEnd__float4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____float4);
-functionMap[HASH_ELEMENT_FLOAT4X1____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x1____float4, &ColladaParserAutoGen14Private::_data__float4x1____float4, &ColladaParserAutoGen14Private::_end__float4x1____float4, &ColladaParserAutoGen14Private::_preBegin__float4x1____float4, &ColladaParserAutoGen14Private::_preEnd__float4x1____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4x1____float4);
-functionMap[HASH_ELEMENT_FLOAT4X2____FLOAT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x2____float4x2, &ColladaParserAutoGen14Private::_data__float4x2____float4x2, &ColladaParserAutoGen14Private::_end__float4x2____float4x2, &ColladaParserAutoGen14Private::_preBegin__float4x2____float4x2, &ColladaParserAutoGen14Private::_preEnd__float4x2____float4x2, &ColladaParserAutoGen14Private::_freeAttributes__float4x2____float4x2);
-functionMap[HASH_ELEMENT_FLOAT4X3____FLOAT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x3____float4x3, &ColladaParserAutoGen14Private::_data__float4x3____float4x3, &ColladaParserAutoGen14Private::_end__float4x3____float4x3, &ColladaParserAutoGen14Private::_preBegin__float4x3____float4x3, &ColladaParserAutoGen14Private::_preEnd__float4x3____float4x3, &ColladaParserAutoGen14Private::_freeAttributes__float4x3____float4x3);
-functionMap[HASH_ELEMENT_FLOAT4X4____FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____float4x4, &ColladaParserAutoGen14Private::_data__float4x4____float4x4, &ColladaParserAutoGen14Private::_end__float4x4____float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____float4x4);
-functionMap[HASH_ELEMENT_INT____INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____int, &ColladaParserAutoGen14Private::_data__int____int, &ColladaParserAutoGen14Private::_end__int____int, &ColladaParserAutoGen14Private::_preBegin__int____int, &ColladaParserAutoGen14Private::_preEnd__int____int, &ColladaParserAutoGen14Private::_freeAttributes__int____int);
-functionMap[HASH_ELEMENT_INT2____INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____int2, &ColladaParserAutoGen14Private::_data__int2____int2, &ColladaParserAutoGen14Private::_end__int2____int2, &ColladaParserAutoGen14Private::_preBegin__int2____int2, &ColladaParserAutoGen14Private::_preEnd__int2____int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____int2);
-functionMap[HASH_ELEMENT_INT3____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____int3, &ColladaParserAutoGen14Private::_data__int3____int3, &ColladaParserAutoGen14Private::_end__int3____int3, &ColladaParserAutoGen14Private::_preBegin__int3____int3, &ColladaParserAutoGen14Private::_preEnd__int3____int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____int3);
-functionMap[HASH_ELEMENT_INT4____INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____int4, &ColladaParserAutoGen14Private::_data__int4____int4, &ColladaParserAutoGen14Private::_end__int4____int4, &ColladaParserAutoGen14Private::_preBegin__int4____int4, &ColladaParserAutoGen14Private::_preEnd__int4____int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____int4);
-functionMap[HASH_ELEMENT_MODIFIER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modifier, &ColladaParserAutoGen14Private::_data__modifier, &ColladaParserAutoGen14Private::_end__modifier, &ColladaParserAutoGen14Private::_preBegin__modifier, &ColladaParserAutoGen14Private::_preEnd__modifier, &ColladaParserAutoGen14Private::_freeAttributes__modifier);
-functionMap[HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_data__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_end__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preBegin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preEnd__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____fx_sampler1D_common);
-functionMap[HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_data__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_end__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preBegin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preEnd__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____fx_sampler2D_common);
-functionMap[HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_data__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_end__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preBegin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preEnd__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____fx_sampler3D_common);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_data__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_end__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____fx_samplerCUBE_common);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_data__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_end__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____fx_samplerDEPTH_common);
-functionMap[HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_data__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_end__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____fx_samplerRECT_common);
-functionMap[HASH_ELEMENT_SEMANTIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__semantic, &ColladaParserAutoGen14Private::_data__semantic, &ColladaParserAutoGen14Private::_end__semantic, &ColladaParserAutoGen14Private::_preBegin__semantic, &ColladaParserAutoGen14Private::_preEnd__semantic, &ColladaParserAutoGen14Private::_freeAttributes__semantic);
-functionMap[HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_data__surface____fx_surface_common, &ColladaParserAutoGen14Private::_end__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preBegin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preEnd__surface____fx_surface_common, &ColladaParserAutoGen14Private::_freeAttributes__surface____fx_surface_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_P] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_p, &ColladaParserAutoGen14Private::_data__wrap_p, &ColladaParserAutoGen14Private::_end__wrap_p, &ColladaParserAutoGen14Private::_preBegin__wrap_p, &ColladaParserAutoGen14Private::_preEnd__wrap_p, &ColladaParserAutoGen14Private::_freeAttributes__wrap_p);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_P] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_p, &ColladaParserAutoGen14Private::_data__wrap_p, &ColladaParserAutoGen14Private::_end__wrap_p, &ColladaParserAutoGen14Private::_preBegin__wrap_p, &ColladaParserAutoGen14Private::_preEnd__wrap_p, &ColladaParserAutoGen14Private::_freeAttributes__wrap_p);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_FORMAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__format, &ColladaParserAutoGen14Private::_data__format, &ColladaParserAutoGen14Private::_end__format, &ColladaParserAutoGen14Private::_preBegin__format, &ColladaParserAutoGen14Private::_preEnd__format, &ColladaParserAutoGen14Private::_freeAttributes__format);
-functionMap[HASH_ELEMENT_FORMAT_HINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__format_hint, &ColladaParserAutoGen14Private::_data__format_hint, &ColladaParserAutoGen14Private::_end__format_hint, &ColladaParserAutoGen14Private::_preBegin__format_hint, &ColladaParserAutoGen14Private::_preEnd__format_hint, &ColladaParserAutoGen14Private::_freeAttributes__format_hint);
-functionMap[HASH_ELEMENT_INIT_AS_NULL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_as_null, &ColladaParserAutoGen14Private::_data__init_as_null, &ColladaParserAutoGen14Private::_end__init_as_null, &ColladaParserAutoGen14Private::_preBegin__init_as_null, &ColladaParserAutoGen14Private::_preEnd__init_as_null, &ColladaParserAutoGen14Private::_freeAttributes__init_as_null);
-functionMap[HASH_ELEMENT_INIT_AS_TARGET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_as_target, &ColladaParserAutoGen14Private::_data__init_as_target, &ColladaParserAutoGen14Private::_end__init_as_target, &ColladaParserAutoGen14Private::_preBegin__init_as_target, &ColladaParserAutoGen14Private::_preEnd__init_as_target, &ColladaParserAutoGen14Private::_freeAttributes__init_as_target);
-functionMap[HASH_ELEMENT_INIT_CUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_cube, &ColladaParserAutoGen14Private::_data__init_cube, &ColladaParserAutoGen14Private::_end__init_cube, &ColladaParserAutoGen14Private::_preBegin__init_cube, &ColladaParserAutoGen14Private::_preEnd__init_cube, &ColladaParserAutoGen14Private::_freeAttributes__init_cube);
-functionMap[HASH_ELEMENT_INIT_FROM____FX_SURFACE_INIT_FROM_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_data__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_end__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_preBegin__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_preEnd__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_freeAttributes__init_from____fx_surface_init_from_common);
-functionMap[HASH_ELEMENT_INIT_PLANAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_planar, &ColladaParserAutoGen14Private::_data__init_planar, &ColladaParserAutoGen14Private::_end__init_planar, &ColladaParserAutoGen14Private::_preBegin__init_planar, &ColladaParserAutoGen14Private::_preEnd__init_planar, &ColladaParserAutoGen14Private::_freeAttributes__init_planar);
-functionMap[HASH_ELEMENT_INIT_VOLUME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_volume, &ColladaParserAutoGen14Private::_data__init_volume, &ColladaParserAutoGen14Private::_end__init_volume, &ColladaParserAutoGen14Private::_preBegin__init_volume, &ColladaParserAutoGen14Private::_preEnd__init_volume, &ColladaParserAutoGen14Private::_freeAttributes__init_volume);
-functionMap[HASH_ELEMENT_MIP_LEVELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mip_levels, &ColladaParserAutoGen14Private::_data__mip_levels, &ColladaParserAutoGen14Private::_end__mip_levels, &ColladaParserAutoGen14Private::_preBegin__mip_levels, &ColladaParserAutoGen14Private::_preEnd__mip_levels, &ColladaParserAutoGen14Private::_freeAttributes__mip_levels);
-functionMap[HASH_ELEMENT_MIPMAP_GENERATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_generate, &ColladaParserAutoGen14Private::_data__mipmap_generate, &ColladaParserAutoGen14Private::_end__mipmap_generate, &ColladaParserAutoGen14Private::_preBegin__mipmap_generate, &ColladaParserAutoGen14Private::_preEnd__mipmap_generate, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_generate);
-functionMap[HASH_ELEMENT_SIZE____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__size____int3, &ColladaParserAutoGen14Private::_data__size____int3, &ColladaParserAutoGen14Private::_end__size____int3, &ColladaParserAutoGen14Private::_preBegin__size____int3, &ColladaParserAutoGen14Private::_preEnd__size____int3, &ColladaParserAutoGen14Private::_freeAttributes__size____int3);
-functionMap[HASH_ELEMENT_VIEWPORT_RATIO] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__viewport_ratio, &ColladaParserAutoGen14Private::_data__viewport_ratio, &ColladaParserAutoGen14Private::_end__viewport_ratio, &ColladaParserAutoGen14Private::_preBegin__viewport_ratio, &ColladaParserAutoGen14Private::_preEnd__viewport_ratio, &ColladaParserAutoGen14Private::_freeAttributes__viewport_ratio);
-functionMap[HASH_ELEMENT_CHANNELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__channels, &ColladaParserAutoGen14Private::_data__channels, &ColladaParserAutoGen14Private::_end__channels, &ColladaParserAutoGen14Private::_preBegin__channels, &ColladaParserAutoGen14Private::_preEnd__channels, &ColladaParserAutoGen14Private::_freeAttributes__channels);
-functionMap[HASH_ELEMENT_OPTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__option, &ColladaParserAutoGen14Private::_data__option, &ColladaParserAutoGen14Private::_end__option, &ColladaParserAutoGen14Private::_preBegin__option, &ColladaParserAutoGen14Private::_preEnd__option, &ColladaParserAutoGen14Private::_freeAttributes__option);
-functionMap[HASH_ELEMENT_PRECISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__precision, &ColladaParserAutoGen14Private::_data__precision, &ColladaParserAutoGen14Private::_end__precision, &ColladaParserAutoGen14Private::_preBegin__precision, &ColladaParserAutoGen14Private::_preEnd__precision, &ColladaParserAutoGen14Private::_freeAttributes__precision);
-functionMap[HASH_ELEMENT_RANGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__range, &ColladaParserAutoGen14Private::_data__range, &ColladaParserAutoGen14Private::_end__range, &ColladaParserAutoGen14Private::_preBegin__range, &ColladaParserAutoGen14Private::_preEnd__range, &ColladaParserAutoGen14Private::_freeAttributes__range);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____face);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____PRIMARY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____primary);
-functionMap[HASH_ELEMENT_ORDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__order, &ColladaParserAutoGen14Private::_data__order, &ColladaParserAutoGen14Private::_end__order, &ColladaParserAutoGen14Private::_preBegin__order, &ColladaParserAutoGen14Private::_preEnd__order, &ColladaParserAutoGen14Private::_freeAttributes__order);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_PLANAR_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_planar_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_volume_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____PRIMARY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_data__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_end__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_volume_common____primary);
-functionMap[HASH_ELEMENT_CODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__code, &ColladaParserAutoGen14Private::_data__code, &ColladaParserAutoGen14Private::_end__code, &ColladaParserAutoGen14Private::_preBegin__code, &ColladaParserAutoGen14Private::_preEnd__code, &ColladaParserAutoGen14Private::_freeAttributes__code);
-functionMap[HASH_ELEMENT_INCLUDE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__include, &ColladaParserAutoGen14Private::_data__include, &ColladaParserAutoGen14Private::_end__include, &ColladaParserAutoGen14Private::_preBegin__include, &ColladaParserAutoGen14Private::_preEnd__include, &ColladaParserAutoGen14Private::_freeAttributes__include);
-functionMap[HASH_ELEMENT_NEWPARAM____CG_NEWPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____cg_newparam, &ColladaParserAutoGen14Private::_data__newparam____cg_newparam, &ColladaParserAutoGen14Private::_end__newparam____cg_newparam, &ColladaParserAutoGen14Private::_preBegin__newparam____cg_newparam, &ColladaParserAutoGen14Private::_preEnd__newparam____cg_newparam, &ColladaParserAutoGen14Private::_freeAttributes__newparam____cg_newparam);
-functionMap[HASH_ELEMENT_PROFILE_CG__TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__technique, &ColladaParserAutoGen14Private::_data__profile_CG__technique, &ColladaParserAutoGen14Private::_end__profile_CG__technique, &ColladaParserAutoGen14Private::_preBegin__profile_CG__technique, &ColladaParserAutoGen14Private::_preEnd__profile_CG__technique, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__technique);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_ARRAY____CG_NEWARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____cg_newarray_type, &ColladaParserAutoGen14Private::_data__array____cg_newarray_type, &ColladaParserAutoGen14Private::_end__array____cg_newarray_type, &ColladaParserAutoGen14Private::_preBegin__array____cg_newarray_type, &ColladaParserAutoGen14Private::_preEnd__array____cg_newarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____cg_newarray_type);
-functionMap[HASH_ELEMENT_BOOL____CG_BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____cg_bool, &ColladaParserAutoGen14Private::_data__bool____cg_bool, &ColladaParserAutoGen14Private::_end__bool____cg_bool, &ColladaParserAutoGen14Private::_preBegin__bool____cg_bool, &ColladaParserAutoGen14Private::_preEnd__bool____cg_bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____cg_bool);
-functionMap[HASH_ELEMENT_BOOL1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1, &ColladaParserAutoGen14Private::_data__bool1, &ColladaParserAutoGen14Private::_end__bool1, &ColladaParserAutoGen14Private::_preBegin__bool1, &ColladaParserAutoGen14Private::_preEnd__bool1, &ColladaParserAutoGen14Private::_freeAttributes__bool1);
-functionMap[HASH_ELEMENT_BOOL1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x1, &ColladaParserAutoGen14Private::_data__bool1x1, &ColladaParserAutoGen14Private::_end__bool1x1, &ColladaParserAutoGen14Private::_preBegin__bool1x1, &ColladaParserAutoGen14Private::_preEnd__bool1x1, &ColladaParserAutoGen14Private::_freeAttributes__bool1x1);
-functionMap[HASH_ELEMENT_BOOL1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x2, &ColladaParserAutoGen14Private::_data__bool1x2, &ColladaParserAutoGen14Private::_end__bool1x2, &ColladaParserAutoGen14Private::_preBegin__bool1x2, &ColladaParserAutoGen14Private::_preEnd__bool1x2, &ColladaParserAutoGen14Private::_freeAttributes__bool1x2);
-functionMap[HASH_ELEMENT_BOOL1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x3, &ColladaParserAutoGen14Private::_data__bool1x3, &ColladaParserAutoGen14Private::_end__bool1x3, &ColladaParserAutoGen14Private::_preBegin__bool1x3, &ColladaParserAutoGen14Private::_preEnd__bool1x3, &ColladaParserAutoGen14Private::_freeAttributes__bool1x3);
-functionMap[HASH_ELEMENT_BOOL1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x4, &ColladaParserAutoGen14Private::_data__bool1x4, &ColladaParserAutoGen14Private::_end__bool1x4, &ColladaParserAutoGen14Private::_preBegin__bool1x4, &ColladaParserAutoGen14Private::_preEnd__bool1x4, &ColladaParserAutoGen14Private::_freeAttributes__bool1x4);
-functionMap[HASH_ELEMENT_BOOL2____CG_BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____cg_bool2, &ColladaParserAutoGen14Private::_data__bool2____cg_bool2, &ColladaParserAutoGen14Private::_end__bool2____cg_bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____cg_bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____cg_bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____cg_bool2);
-functionMap[HASH_ELEMENT_BOOL2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x1, &ColladaParserAutoGen14Private::_data__bool2x1, &ColladaParserAutoGen14Private::_end__bool2x1, &ColladaParserAutoGen14Private::_preBegin__bool2x1, &ColladaParserAutoGen14Private::_preEnd__bool2x1, &ColladaParserAutoGen14Private::_freeAttributes__bool2x1);
-functionMap[HASH_ELEMENT_BOOL2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x2, &ColladaParserAutoGen14Private::_data__bool2x2, &ColladaParserAutoGen14Private::_end__bool2x2, &ColladaParserAutoGen14Private::_preBegin__bool2x2, &ColladaParserAutoGen14Private::_preEnd__bool2x2, &ColladaParserAutoGen14Private::_freeAttributes__bool2x2);
-functionMap[HASH_ELEMENT_BOOL2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x3, &ColladaParserAutoGen14Private::_data__bool2x3, &ColladaParserAutoGen14Private::_end__bool2x3, &ColladaParserAutoGen14Private::_preBegin__bool2x3, &ColladaParserAutoGen14Private::_preEnd__bool2x3, &ColladaParserAutoGen14Private::_freeAttributes__bool2x3);
-functionMap[HASH_ELEMENT_BOOL2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x4, &ColladaParserAutoGen14Private::_data__bool2x4, &ColladaParserAutoGen14Private::_end__bool2x4, &ColladaParserAutoGen14Private::_preBegin__bool2x4, &ColladaParserAutoGen14Private::_preEnd__bool2x4, &ColladaParserAutoGen14Private::_freeAttributes__bool2x4);
-functionMap[HASH_ELEMENT_BOOL3____CG_BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____cg_bool3, &ColladaParserAutoGen14Private::_data__bool3____cg_bool3, &ColladaParserAutoGen14Private::_end__bool3____cg_bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____cg_bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____cg_bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____cg_bool3);
-functionMap[HASH_ELEMENT_BOOL3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x1, &ColladaParserAutoGen14Private::_data__bool3x1, &ColladaParserAutoGen14Private::_end__bool3x1, &ColladaParserAutoGen14Private::_preBegin__bool3x1, &ColladaParserAutoGen14Private::_preEnd__bool3x1, &ColladaParserAutoGen14Private::_freeAttributes__bool3x1);
-functionMap[HASH_ELEMENT_BOOL3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x2, &ColladaParserAutoGen14Private::_data__bool3x2, &ColladaParserAutoGen14Private::_end__bool3x2, &ColladaParserAutoGen14Private::_preBegin__bool3x2, &ColladaParserAutoGen14Private::_preEnd__bool3x2, &ColladaParserAutoGen14Private::_freeAttributes__bool3x2);
-functionMap[HASH_ELEMENT_BOOL3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x3, &ColladaParserAutoGen14Private::_data__bool3x3, &ColladaParserAutoGen14Private::_end__bool3x3, &ColladaParserAutoGen14Private::_preBegin__bool3x3, &ColladaParserAutoGen14Private::_preEnd__bool3x3, &ColladaParserAutoGen14Private::_freeAttributes__bool3x3);
-functionMap[HASH_ELEMENT_BOOL3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x4, &ColladaParserAutoGen14Private::_data__bool3x4, &ColladaParserAutoGen14Private::_end__bool3x4, &ColladaParserAutoGen14Private::_preBegin__bool3x4, &ColladaParserAutoGen14Private::_preEnd__bool3x4, &ColladaParserAutoGen14Private::_freeAttributes__bool3x4);
-functionMap[HASH_ELEMENT_BOOL4____CG_BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____cg_bool4, &ColladaParserAutoGen14Private::_data__bool4____cg_bool4, &ColladaParserAutoGen14Private::_end__bool4____cg_bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____cg_bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____cg_bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____cg_bool4);
-functionMap[HASH_ELEMENT_BOOL4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x1, &ColladaParserAutoGen14Private::_data__bool4x1, &ColladaParserAutoGen14Private::_end__bool4x1, &ColladaParserAutoGen14Private::_preBegin__bool4x1, &ColladaParserAutoGen14Private::_preEnd__bool4x1, &ColladaParserAutoGen14Private::_freeAttributes__bool4x1);
-functionMap[HASH_ELEMENT_BOOL4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x2, &ColladaParserAutoGen14Private::_data__bool4x2, &ColladaParserAutoGen14Private::_end__bool4x2, &ColladaParserAutoGen14Private::_preBegin__bool4x2, &ColladaParserAutoGen14Private::_preEnd__bool4x2, &ColladaParserAutoGen14Private::_freeAttributes__bool4x2);
-functionMap[HASH_ELEMENT_BOOL4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x3, &ColladaParserAutoGen14Private::_data__bool4x3, &ColladaParserAutoGen14Private::_end__bool4x3, &ColladaParserAutoGen14Private::_preBegin__bool4x3, &ColladaParserAutoGen14Private::_preEnd__bool4x3, &ColladaParserAutoGen14Private::_freeAttributes__bool4x3);
-functionMap[HASH_ELEMENT_BOOL4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x4, &ColladaParserAutoGen14Private::_data__bool4x4, &ColladaParserAutoGen14Private::_end__bool4x4, &ColladaParserAutoGen14Private::_preBegin__bool4x4, &ColladaParserAutoGen14Private::_preEnd__bool4x4, &ColladaParserAutoGen14Private::_freeAttributes__bool4x4);
-functionMap[HASH_ELEMENT_ENUM____GL_ENUMERATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_data__enum____gl_enumeration, &ColladaParserAutoGen14Private::_end__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preBegin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preEnd__enum____gl_enumeration, &ColladaParserAutoGen14Private::_freeAttributes__enum____gl_enumeration);
-functionMap[HASH_ELEMENT_FIXED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed, &ColladaParserAutoGen14Private::_data__fixed, &ColladaParserAutoGen14Private::_end__fixed, &ColladaParserAutoGen14Private::_preBegin__fixed, &ColladaParserAutoGen14Private::_preEnd__fixed, &ColladaParserAutoGen14Private::_freeAttributes__fixed);
-functionMap[HASH_ELEMENT_FIXED1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1, &ColladaParserAutoGen14Private::_data__fixed1, &ColladaParserAutoGen14Private::_end__fixed1, &ColladaParserAutoGen14Private::_preBegin__fixed1, &ColladaParserAutoGen14Private::_preEnd__fixed1, &ColladaParserAutoGen14Private::_freeAttributes__fixed1);
-functionMap[HASH_ELEMENT_FIXED1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x1, &ColladaParserAutoGen14Private::_data__fixed1x1, &ColladaParserAutoGen14Private::_end__fixed1x1, &ColladaParserAutoGen14Private::_preBegin__fixed1x1, &ColladaParserAutoGen14Private::_preEnd__fixed1x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x1);
-functionMap[HASH_ELEMENT_FIXED1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x2, &ColladaParserAutoGen14Private::_data__fixed1x2, &ColladaParserAutoGen14Private::_end__fixed1x2, &ColladaParserAutoGen14Private::_preBegin__fixed1x2, &ColladaParserAutoGen14Private::_preEnd__fixed1x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x2);
-functionMap[HASH_ELEMENT_FIXED1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x3, &ColladaParserAutoGen14Private::_data__fixed1x3, &ColladaParserAutoGen14Private::_end__fixed1x3, &ColladaParserAutoGen14Private::_preBegin__fixed1x3, &ColladaParserAutoGen14Private::_preEnd__fixed1x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x3);
-functionMap[HASH_ELEMENT_FIXED1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x4, &ColladaParserAutoGen14Private::_data__fixed1x4, &ColladaParserAutoGen14Private::_end__fixed1x4, &ColladaParserAutoGen14Private::_preBegin__fixed1x4, &ColladaParserAutoGen14Private::_preEnd__fixed1x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x4);
-functionMap[HASH_ELEMENT_FIXED2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2, &ColladaParserAutoGen14Private::_data__fixed2, &ColladaParserAutoGen14Private::_end__fixed2, &ColladaParserAutoGen14Private::_preBegin__fixed2, &ColladaParserAutoGen14Private::_preEnd__fixed2, &ColladaParserAutoGen14Private::_freeAttributes__fixed2);
-functionMap[HASH_ELEMENT_FIXED2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x1, &ColladaParserAutoGen14Private::_data__fixed2x1, &ColladaParserAutoGen14Private::_end__fixed2x1, &ColladaParserAutoGen14Private::_preBegin__fixed2x1, &ColladaParserAutoGen14Private::_preEnd__fixed2x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x1);
-functionMap[HASH_ELEMENT_FIXED2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x2, &ColladaParserAutoGen14Private::_data__fixed2x2, &ColladaParserAutoGen14Private::_end__fixed2x2, &ColladaParserAutoGen14Private::_preBegin__fixed2x2, &ColladaParserAutoGen14Private::_preEnd__fixed2x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x2);
-functionMap[HASH_ELEMENT_FIXED2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x3, &ColladaParserAutoGen14Private::_data__fixed2x3, &ColladaParserAutoGen14Private::_end__fixed2x3, &ColladaParserAutoGen14Private::_preBegin__fixed2x3, &ColladaParserAutoGen14Private::_preEnd__fixed2x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x3);
-functionMap[HASH_ELEMENT_FIXED2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x4, &ColladaParserAutoGen14Private::_data__fixed2x4, &ColladaParserAutoGen14Private::_end__fixed2x4, &ColladaParserAutoGen14Private::_preBegin__fixed2x4, &ColladaParserAutoGen14Private::_preEnd__fixed2x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x4);
-functionMap[HASH_ELEMENT_FIXED3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3, &ColladaParserAutoGen14Private::_data__fixed3, &ColladaParserAutoGen14Private::_end__fixed3, &ColladaParserAutoGen14Private::_preBegin__fixed3, &ColladaParserAutoGen14Private::_preEnd__fixed3, &ColladaParserAutoGen14Private::_freeAttributes__fixed3);
-functionMap[HASH_ELEMENT_FIXED3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x1, &ColladaParserAutoGen14Private::_data__fixed3x1, &ColladaParserAutoGen14Private::_end__fixed3x1, &ColladaParserAutoGen14Private::_preBegin__fixed3x1, &ColladaParserAutoGen14Private::_preEnd__fixed3x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x1);
-functionMap[HASH_ELEMENT_FIXED3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x2, &ColladaParserAutoGen14Private::_data__fixed3x2, &ColladaParserAutoGen14Private::_end__fixed3x2, &ColladaParserAutoGen14Private::_preBegin__fixed3x2, &ColladaParserAutoGen14Private::_preEnd__fixed3x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x2);
-functionMap[HASH_ELEMENT_FIXED3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x3, &ColladaParserAutoGen14Private::_data__fixed3x3, &ColladaParserAutoGen14Private::_end__fixed3x3, &ColladaParserAutoGen14Private::_preBegin__fixed3x3, &ColladaParserAutoGen14Private::_preEnd__fixed3x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x3);
-functionMap[HASH_ELEMENT_FIXED3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x4, &ColladaParserAutoGen14Private::_data__fixed3x4, &ColladaParserAutoGen14Private::_end__fixed3x4, &ColladaParserAutoGen14Private::_preBegin__fixed3x4, &ColladaParserAutoGen14Private::_preEnd__fixed3x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x4);
-functionMap[HASH_ELEMENT_FIXED4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4, &ColladaParserAutoGen14Private::_data__fixed4, &ColladaParserAutoGen14Private::_end__fixed4, &ColladaParserAutoGen14Private::_preBegin__fixed4, &ColladaParserAutoGen14Private::_preEnd__fixed4, &ColladaParserAutoGen14Private::_freeAttributes__fixed4);
-functionMap[HASH_ELEMENT_FIXED4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x1, &ColladaParserAutoGen14Private::_data__fixed4x1, &ColladaParserAutoGen14Private::_end__fixed4x1, &ColladaParserAutoGen14Private::_preBegin__fixed4x1, &ColladaParserAutoGen14Private::_preEnd__fixed4x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x1);
-functionMap[HASH_ELEMENT_FIXED4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x2, &ColladaParserAutoGen14Private::_data__fixed4x2, &ColladaParserAutoGen14Private::_end__fixed4x2, &ColladaParserAutoGen14Private::_preBegin__fixed4x2, &ColladaParserAutoGen14Private::_preEnd__fixed4x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x2);
-functionMap[HASH_ELEMENT_FIXED4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x3, &ColladaParserAutoGen14Private::_data__fixed4x3, &ColladaParserAutoGen14Private::_end__fixed4x3, &ColladaParserAutoGen14Private::_preBegin__fixed4x3, &ColladaParserAutoGen14Private::_preEnd__fixed4x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x3);
-functionMap[HASH_ELEMENT_FIXED4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x4, &ColladaParserAutoGen14Private::_data__fixed4x4, &ColladaParserAutoGen14Private::_end__fixed4x4, &ColladaParserAutoGen14Private::_preBegin__fixed4x4, &ColladaParserAutoGen14Private::_preEnd__fixed4x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x4);
-functionMap[HASH_ELEMENT_FLOAT____CG_FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____cg_float, &ColladaParserAutoGen14Private::_data__float____cg_float, &ColladaParserAutoGen14Private::_end__float____cg_float, &ColladaParserAutoGen14Private::_preBegin__float____cg_float, &ColladaParserAutoGen14Private::_preEnd__float____cg_float, &ColladaParserAutoGen14Private::_freeAttributes__float____cg_float);
-functionMap[HASH_ELEMENT_FLOAT1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1, &ColladaParserAutoGen14Private::_data__float1, &ColladaParserAutoGen14Private::_end__float1, &ColladaParserAutoGen14Private::_preBegin__float1, &ColladaParserAutoGen14Private::_preEnd__float1, &ColladaParserAutoGen14Private::_freeAttributes__float1);
-functionMap[HASH_ELEMENT_FLOAT1X1____CG_FLOAT1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_data__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_end__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_preBegin__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_preEnd__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_freeAttributes__float1x1____cg_float1x1);
-functionMap[HASH_ELEMENT_FLOAT1X2____CG_FLOAT1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_data__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_end__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_preBegin__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_preEnd__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_freeAttributes__float1x2____cg_float1x2);
-functionMap[HASH_ELEMENT_FLOAT1X3____CG_FLOAT1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_data__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_end__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_preBegin__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_preEnd__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_freeAttributes__float1x3____cg_float1x3);
-functionMap[HASH_ELEMENT_FLOAT1X4____CG_FLOAT1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_data__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_end__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_preBegin__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_preEnd__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_freeAttributes__float1x4____cg_float1x4);
-functionMap[HASH_ELEMENT_FLOAT2____CG_FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____cg_float2, &ColladaParserAutoGen14Private::_data__float2____cg_float2, &ColladaParserAutoGen14Private::_end__float2____cg_float2, &ColladaParserAutoGen14Private::_preBegin__float2____cg_float2, &ColladaParserAutoGen14Private::_preEnd__float2____cg_float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____cg_float2);
-functionMap[HASH_ELEMENT_FLOAT2X1____CG_FLOAT2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_data__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_end__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_preBegin__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_preEnd__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_freeAttributes__float2x1____cg_float2x1);
-functionMap[HASH_ELEMENT_FLOAT2X2____CG_FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_data__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_end__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____cg_float2x2);
-functionMap[HASH_ELEMENT_FLOAT2X3____CG_FLOAT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_data__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_end__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_preBegin__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_preEnd__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_freeAttributes__float2x3____cg_float2x3);
-functionMap[HASH_ELEMENT_FLOAT2X4____CG_FLOAT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_data__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_end__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_preBegin__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_preEnd__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_freeAttributes__float2x4____cg_float2x4);
-functionMap[HASH_ELEMENT_FLOAT3____CG_FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____cg_float3, &ColladaParserAutoGen14Private::_data__float3____cg_float3, &ColladaParserAutoGen14Private::_end__float3____cg_float3, &ColladaParserAutoGen14Private::_preBegin__float3____cg_float3, &ColladaParserAutoGen14Private::_preEnd__float3____cg_float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____cg_float3);
-functionMap[HASH_ELEMENT_FLOAT3X1____CG_FLOAT3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_data__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_end__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_preBegin__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_preEnd__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_freeAttributes__float3x1____cg_float3x1);
-functionMap[HASH_ELEMENT_FLOAT3X2____CG_FLOAT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_data__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_end__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_preBegin__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_preEnd__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_freeAttributes__float3x2____cg_float3x2);
-functionMap[HASH_ELEMENT_FLOAT3X3____CG_FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_data__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_end__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____cg_float3x3);
-functionMap[HASH_ELEMENT_FLOAT3X4____CG_FLOAT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_data__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_end__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_preBegin__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_preEnd__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_freeAttributes__float3x4____cg_float3x4);
-functionMap[HASH_ELEMENT_FLOAT4____CG_FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____cg_float4, &ColladaParserAutoGen14Private::_data__float4____cg_float4, &ColladaParserAutoGen14Private::_end__float4____cg_float4, &ColladaParserAutoGen14Private::_preBegin__float4____cg_float4, &ColladaParserAutoGen14Private::_preEnd__float4____cg_float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____cg_float4);
-functionMap[HASH_ELEMENT_FLOAT4X1____CG_FLOAT4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_data__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_end__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_preBegin__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_preEnd__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_freeAttributes__float4x1____cg_float4x1);
-functionMap[HASH_ELEMENT_FLOAT4X2____CG_FLOAT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_data__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_end__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_preBegin__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_preEnd__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_freeAttributes__float4x2____cg_float4x2);
-functionMap[HASH_ELEMENT_FLOAT4X3____CG_FLOAT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_data__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_end__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_preBegin__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_preEnd__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_freeAttributes__float4x3____cg_float4x3);
-functionMap[HASH_ELEMENT_FLOAT4X4____CG_FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_data__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_end__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____cg_float4x4);
-functionMap[HASH_ELEMENT_HALF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half, &ColladaParserAutoGen14Private::_data__half, &ColladaParserAutoGen14Private::_end__half, &ColladaParserAutoGen14Private::_preBegin__half, &ColladaParserAutoGen14Private::_preEnd__half, &ColladaParserAutoGen14Private::_freeAttributes__half);
-functionMap[HASH_ELEMENT_HALF1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1, &ColladaParserAutoGen14Private::_data__half1, &ColladaParserAutoGen14Private::_end__half1, &ColladaParserAutoGen14Private::_preBegin__half1, &ColladaParserAutoGen14Private::_preEnd__half1, &ColladaParserAutoGen14Private::_freeAttributes__half1);
-functionMap[HASH_ELEMENT_HALF1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x1, &ColladaParserAutoGen14Private::_data__half1x1, &ColladaParserAutoGen14Private::_end__half1x1, &ColladaParserAutoGen14Private::_preBegin__half1x1, &ColladaParserAutoGen14Private::_preEnd__half1x1, &ColladaParserAutoGen14Private::_freeAttributes__half1x1);
-functionMap[HASH_ELEMENT_HALF1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x2, &ColladaParserAutoGen14Private::_data__half1x2, &ColladaParserAutoGen14Private::_end__half1x2, &ColladaParserAutoGen14Private::_preBegin__half1x2, &ColladaParserAutoGen14Private::_preEnd__half1x2, &ColladaParserAutoGen14Private::_freeAttributes__half1x2);
-functionMap[HASH_ELEMENT_HALF1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x3, &ColladaParserAutoGen14Private::_data__half1x3, &ColladaParserAutoGen14Private::_end__half1x3, &ColladaParserAutoGen14Private::_preBegin__half1x3, &ColladaParserAutoGen14Private::_preEnd__half1x3, &ColladaParserAutoGen14Private::_freeAttributes__half1x3);
-functionMap[HASH_ELEMENT_HALF1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x4, &ColladaParserAutoGen14Private::_data__half1x4, &ColladaParserAutoGen14Private::_end__half1x4, &ColladaParserAutoGen14Private::_preBegin__half1x4, &ColladaParserAutoGen14Private::_preEnd__half1x4, &ColladaParserAutoGen14Private::_freeAttributes__half1x4);
-functionMap[HASH_ELEMENT_HALF2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2, &ColladaParserAutoGen14Private::_data__half2, &ColladaParserAutoGen14Private::_end__half2, &ColladaParserAutoGen14Private::_preBegin__half2, &ColladaParserAutoGen14Private::_preEnd__half2, &ColladaParserAutoGen14Private::_freeAttributes__half2);
-functionMap[HASH_ELEMENT_HALF2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x1, &ColladaParserAutoGen14Private::_data__half2x1, &ColladaParserAutoGen14Private::_end__half2x1, &ColladaParserAutoGen14Private::_preBegin__half2x1, &ColladaParserAutoGen14Private::_preEnd__half2x1, &ColladaParserAutoGen14Private::_freeAttributes__half2x1);
-functionMap[HASH_ELEMENT_HALF2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x2, &ColladaParserAutoGen14Private::_data__half2x2, &ColladaParserAutoGen14Private::_end__half2x2, &ColladaParserAutoGen14Private::_preBegin__half2x2, &ColladaParserAutoGen14Private::_preEnd__half2x2, &ColladaParserAutoGen14Private::_freeAttributes__half2x2);
-functionMap[HASH_ELEMENT_HALF2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x3, &ColladaParserAutoGen14Private::_data__half2x3, &ColladaParserAutoGen14Private::_end__half2x3, &ColladaParserAutoGen14Private::_preBegin__half2x3, &ColladaParserAutoGen14Private::_preEnd__half2x3, &ColladaParserAutoGen14Private::_freeAttributes__half2x3);
-functionMap[HASH_ELEMENT_HALF2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x4, &ColladaParserAutoGen14Private::_data__half2x4, &ColladaParserAutoGen14Private::_end__half2x4, &ColladaParserAutoGen14Private::_preBegin__half2x4, &ColladaParserAutoGen14Private::_preEnd__half2x4, &ColladaParserAutoGen14Private::_freeAttributes__half2x4);
-functionMap[HASH_ELEMENT_HALF3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3, &ColladaParserAutoGen14Private::_data__half3, &ColladaParserAutoGen14Private::_end__half3, &ColladaParserAutoGen14Private::_preBegin__half3, &ColladaParserAutoGen14Private::_preEnd__half3, &ColladaParserAutoGen14Private::_freeAttributes__half3);
-functionMap[HASH_ELEMENT_HALF3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x1, &ColladaParserAutoGen14Private::_data__half3x1, &ColladaParserAutoGen14Private::_end__half3x1, &ColladaParserAutoGen14Private::_preBegin__half3x1, &ColladaParserAutoGen14Private::_preEnd__half3x1, &ColladaParserAutoGen14Private::_freeAttributes__half3x1);
-functionMap[HASH_ELEMENT_HALF3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x2, &ColladaParserAutoGen14Private::_data__half3x2, &ColladaParserAutoGen14Private::_end__half3x2, &ColladaParserAutoGen14Private::_preBegin__half3x2, &ColladaParserAutoGen14Private::_preEnd__half3x2, &ColladaParserAutoGen14Private::_freeAttributes__half3x2);
-functionMap[HASH_ELEMENT_HALF3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x3, &ColladaParserAutoGen14Private::_data__half3x3, &ColladaParserAutoGen14Private::_end__half3x3, &ColladaParserAutoGen14Private::_preBegin__half3x3, &ColladaParserAutoGen14Private::_preEnd__half3x3, &ColladaParserAutoGen14Private::_freeAttributes__half3x3);
-functionMap[HASH_ELEMENT_HALF3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x4, &ColladaParserAutoGen14Private::_data__half3x4, &ColladaParserAutoGen14Private::_end__half3x4, &ColladaParserAutoGen14Private::_preBegin__half3x4, &ColladaParserAutoGen14Private::_preEnd__half3x4, &ColladaParserAutoGen14Private::_freeAttributes__half3x4);
-functionMap[HASH_ELEMENT_HALF4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4, &ColladaParserAutoGen14Private::_data__half4, &ColladaParserAutoGen14Private::_end__half4, &ColladaParserAutoGen14Private::_preBegin__half4, &ColladaParserAutoGen14Private::_preEnd__half4, &ColladaParserAutoGen14Private::_freeAttributes__half4);
-functionMap[HASH_ELEMENT_HALF4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x1, &ColladaParserAutoGen14Private::_data__half4x1, &ColladaParserAutoGen14Private::_end__half4x1, &ColladaParserAutoGen14Private::_preBegin__half4x1, &ColladaParserAutoGen14Private::_preEnd__half4x1, &ColladaParserAutoGen14Private::_freeAttributes__half4x1);
-functionMap[HASH_ELEMENT_HALF4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x2, &ColladaParserAutoGen14Private::_data__half4x2, &ColladaParserAutoGen14Private::_end__half4x2, &ColladaParserAutoGen14Private::_preBegin__half4x2, &ColladaParserAutoGen14Private::_preEnd__half4x2, &ColladaParserAutoGen14Private::_freeAttributes__half4x2);
-functionMap[HASH_ELEMENT_HALF4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x3, &ColladaParserAutoGen14Private::_data__half4x3, &ColladaParserAutoGen14Private::_end__half4x3, &ColladaParserAutoGen14Private::_preBegin__half4x3, &ColladaParserAutoGen14Private::_preEnd__half4x3, &ColladaParserAutoGen14Private::_freeAttributes__half4x3);
-functionMap[HASH_ELEMENT_HALF4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x4, &ColladaParserAutoGen14Private::_data__half4x4, &ColladaParserAutoGen14Private::_end__half4x4, &ColladaParserAutoGen14Private::_preBegin__half4x4, &ColladaParserAutoGen14Private::_preEnd__half4x4, &ColladaParserAutoGen14Private::_freeAttributes__half4x4);
-functionMap[HASH_ELEMENT_INT____CG_INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____cg_int, &ColladaParserAutoGen14Private::_data__int____cg_int, &ColladaParserAutoGen14Private::_end__int____cg_int, &ColladaParserAutoGen14Private::_preBegin__int____cg_int, &ColladaParserAutoGen14Private::_preEnd__int____cg_int, &ColladaParserAutoGen14Private::_freeAttributes__int____cg_int);
-functionMap[HASH_ELEMENT_INT1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1, &ColladaParserAutoGen14Private::_data__int1, &ColladaParserAutoGen14Private::_end__int1, &ColladaParserAutoGen14Private::_preBegin__int1, &ColladaParserAutoGen14Private::_preEnd__int1, &ColladaParserAutoGen14Private::_freeAttributes__int1);
-functionMap[HASH_ELEMENT_INT1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x1, &ColladaParserAutoGen14Private::_data__int1x1, &ColladaParserAutoGen14Private::_end__int1x1, &ColladaParserAutoGen14Private::_preBegin__int1x1, &ColladaParserAutoGen14Private::_preEnd__int1x1, &ColladaParserAutoGen14Private::_freeAttributes__int1x1);
-functionMap[HASH_ELEMENT_INT1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x2, &ColladaParserAutoGen14Private::_data__int1x2, &ColladaParserAutoGen14Private::_end__int1x2, &ColladaParserAutoGen14Private::_preBegin__int1x2, &ColladaParserAutoGen14Private::_preEnd__int1x2, &ColladaParserAutoGen14Private::_freeAttributes__int1x2);
-functionMap[HASH_ELEMENT_INT1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x3, &ColladaParserAutoGen14Private::_data__int1x3, &ColladaParserAutoGen14Private::_end__int1x3, &ColladaParserAutoGen14Private::_preBegin__int1x3, &ColladaParserAutoGen14Private::_preEnd__int1x3, &ColladaParserAutoGen14Private::_freeAttributes__int1x3);
-functionMap[HASH_ELEMENT_INT1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x4, &ColladaParserAutoGen14Private::_data__int1x4, &ColladaParserAutoGen14Private::_end__int1x4, &ColladaParserAutoGen14Private::_preBegin__int1x4, &ColladaParserAutoGen14Private::_preEnd__int1x4, &ColladaParserAutoGen14Private::_freeAttributes__int1x4);
-functionMap[HASH_ELEMENT_INT2____CG_INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____cg_int2, &ColladaParserAutoGen14Private::_data__int2____cg_int2, &ColladaParserAutoGen14Private::_end__int2____cg_int2, &ColladaParserAutoGen14Private::_preBegin__int2____cg_int2, &ColladaParserAutoGen14Private::_preEnd__int2____cg_int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____cg_int2);
-functionMap[HASH_ELEMENT_INT2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x1, &ColladaParserAutoGen14Private::_data__int2x1, &ColladaParserAutoGen14Private::_end__int2x1, &ColladaParserAutoGen14Private::_preBegin__int2x1, &ColladaParserAutoGen14Private::_preEnd__int2x1, &ColladaParserAutoGen14Private::_freeAttributes__int2x1);
-functionMap[HASH_ELEMENT_INT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x2, &ColladaParserAutoGen14Private::_data__int2x2, &ColladaParserAutoGen14Private::_end__int2x2, &ColladaParserAutoGen14Private::_preBegin__int2x2, &ColladaParserAutoGen14Private::_preEnd__int2x2, &ColladaParserAutoGen14Private::_freeAttributes__int2x2);
-functionMap[HASH_ELEMENT_INT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x3, &ColladaParserAutoGen14Private::_data__int2x3, &ColladaParserAutoGen14Private::_end__int2x3, &ColladaParserAutoGen14Private::_preBegin__int2x3, &ColladaParserAutoGen14Private::_preEnd__int2x3, &ColladaParserAutoGen14Private::_freeAttributes__int2x3);
-functionMap[HASH_ELEMENT_INT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x4, &ColladaParserAutoGen14Private::_data__int2x4, &ColladaParserAutoGen14Private::_end__int2x4, &ColladaParserAutoGen14Private::_preBegin__int2x4, &ColladaParserAutoGen14Private::_preEnd__int2x4, &ColladaParserAutoGen14Private::_freeAttributes__int2x4);
-functionMap[HASH_ELEMENT_INT3____CG_INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____cg_int3, &ColladaParserAutoGen14Private::_data__int3____cg_int3, &ColladaParserAutoGen14Private::_end__int3____cg_int3, &ColladaParserAutoGen14Private::_preBegin__int3____cg_int3, &ColladaParserAutoGen14Private::_preEnd__int3____cg_int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____cg_int3);
-functionMap[HASH_ELEMENT_INT3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x1, &ColladaParserAutoGen14Private::_data__int3x1, &ColladaParserAutoGen14Private::_end__int3x1, &ColladaParserAutoGen14Private::_preBegin__int3x1, &ColladaParserAutoGen14Private::_preEnd__int3x1, &ColladaParserAutoGen14Private::_freeAttributes__int3x1);
-functionMap[HASH_ELEMENT_INT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x2, &ColladaParserAutoGen14Private::_data__int3x2, &ColladaParserAutoGen14Private::_end__int3x2, &ColladaParserAutoGen14Private::_preBegin__int3x2, &ColladaParserAutoGen14Private::_preEnd__int3x2, &ColladaParserAutoGen14Private::_freeAttributes__int3x2);
-functionMap[HASH_ELEMENT_INT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x3, &ColladaParserAutoGen14Private::_data__int3x3, &ColladaParserAutoGen14Private::_end__int3x3, &ColladaParserAutoGen14Private::_preBegin__int3x3, &ColladaParserAutoGen14Private::_preEnd__int3x3, &ColladaParserAutoGen14Private::_freeAttributes__int3x3);
-functionMap[HASH_ELEMENT_INT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x4, &ColladaParserAutoGen14Private::_data__int3x4, &ColladaParserAutoGen14Private::_end__int3x4, &ColladaParserAutoGen14Private::_preBegin__int3x4, &ColladaParserAutoGen14Private::_preEnd__int3x4, &ColladaParserAutoGen14Private::_freeAttributes__int3x4);
-functionMap[HASH_ELEMENT_INT4____CG_INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____cg_int4, &ColladaParserAutoGen14Private::_data__int4____cg_int4, &ColladaParserAutoGen14Private::_end__int4____cg_int4, &ColladaParserAutoGen14Private::_preBegin__int4____cg_int4, &ColladaParserAutoGen14Private::_preEnd__int4____cg_int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____cg_int4);
-functionMap[HASH_ELEMENT_INT4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x1, &ColladaParserAutoGen14Private::_data__int4x1, &ColladaParserAutoGen14Private::_end__int4x1, &ColladaParserAutoGen14Private::_preBegin__int4x1, &ColladaParserAutoGen14Private::_preEnd__int4x1, &ColladaParserAutoGen14Private::_freeAttributes__int4x1);
-functionMap[HASH_ELEMENT_INT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x2, &ColladaParserAutoGen14Private::_data__int4x2, &ColladaParserAutoGen14Private::_end__int4x2, &ColladaParserAutoGen14Private::_preBegin__int4x2, &ColladaParserAutoGen14Private::_preEnd__int4x2, &ColladaParserAutoGen14Private::_freeAttributes__int4x2);
-functionMap[HASH_ELEMENT_INT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x3, &ColladaParserAutoGen14Private::_data__int4x3, &ColladaParserAutoGen14Private::_end__int4x3, &ColladaParserAutoGen14Private::_preBegin__int4x3, &ColladaParserAutoGen14Private::_preEnd__int4x3, &ColladaParserAutoGen14Private::_freeAttributes__int4x3);
-functionMap[HASH_ELEMENT_INT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x4, &ColladaParserAutoGen14Private::_data__int4x4, &ColladaParserAutoGen14Private::_end__int4x4, &ColladaParserAutoGen14Private::_preBegin__int4x4, &ColladaParserAutoGen14Private::_preEnd__int4x4, &ColladaParserAutoGen14Private::_freeAttributes__int4x4);
-functionMap[HASH_ELEMENT_MODIFIER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modifier, &ColladaParserAutoGen14Private::_data__modifier, &ColladaParserAutoGen14Private::_end__modifier, &ColladaParserAutoGen14Private::_preBegin__modifier, &ColladaParserAutoGen14Private::_preEnd__modifier, &ColladaParserAutoGen14Private::_freeAttributes__modifier);
-functionMap[HASH_ELEMENT_SAMPLER1D____CG_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_data__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_end__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_preBegin__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_preEnd__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____cg_sampler1D);
-functionMap[HASH_ELEMENT_SAMPLER2D____CG_SAMPLER2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_data__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_end__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_preBegin__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_preEnd__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____cg_sampler2D);
-functionMap[HASH_ELEMENT_SAMPLER3D____CG_SAMPLER3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_data__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_end__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_preBegin__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_preEnd__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____cg_sampler3D);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____CG_SAMPLERCUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_data__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_end__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____cg_samplerCUBE);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____CG_SAMPLERDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_data__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_end__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____cg_samplerDEPTH);
-functionMap[HASH_ELEMENT_SAMPLERRECT____CG_SAMPLERRECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_data__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_end__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____cg_samplerRECT);
-functionMap[HASH_ELEMENT_SEMANTIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__semantic, &ColladaParserAutoGen14Private::_data__semantic, &ColladaParserAutoGen14Private::_end__semantic, &ColladaParserAutoGen14Private::_preBegin__semantic, &ColladaParserAutoGen14Private::_preEnd__semantic, &ColladaParserAutoGen14Private::_freeAttributes__semantic);
-functionMap[HASH_ELEMENT_STRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__string, &ColladaParserAutoGen14Private::_data__string, &ColladaParserAutoGen14Private::_end__string, &ColladaParserAutoGen14Private::_preBegin__string, &ColladaParserAutoGen14Private::_preEnd__string, &ColladaParserAutoGen14Private::_freeAttributes__string);
-functionMap[HASH_ELEMENT_SURFACE____CG_SURFACE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____cg_surface_type, &ColladaParserAutoGen14Private::_data__surface____cg_surface_type, &ColladaParserAutoGen14Private::_end__surface____cg_surface_type, &ColladaParserAutoGen14Private::_preBegin__surface____cg_surface_type, &ColladaParserAutoGen14Private::_preEnd__surface____cg_surface_type, &ColladaParserAutoGen14Private::_freeAttributes__surface____cg_surface_type);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_ARRAY____CG_NEWARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____cg_newarray_type, &ColladaParserAutoGen14Private::_data__array____cg_newarray_type, &ColladaParserAutoGen14Private::_end__array____cg_newarray_type, &ColladaParserAutoGen14Private::_preBegin__array____cg_newarray_type, &ColladaParserAutoGen14Private::_preEnd__array____cg_newarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____cg_newarray_type);
-functionMap[HASH_ELEMENT_BOOL____CG_BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____cg_bool, &ColladaParserAutoGen14Private::_data__bool____cg_bool, &ColladaParserAutoGen14Private::_end__bool____cg_bool, &ColladaParserAutoGen14Private::_preBegin__bool____cg_bool, &ColladaParserAutoGen14Private::_preEnd__bool____cg_bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____cg_bool);
-functionMap[HASH_ELEMENT_BOOL1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1, &ColladaParserAutoGen14Private::_data__bool1, &ColladaParserAutoGen14Private::_end__bool1, &ColladaParserAutoGen14Private::_preBegin__bool1, &ColladaParserAutoGen14Private::_preEnd__bool1, &ColladaParserAutoGen14Private::_freeAttributes__bool1);
-functionMap[HASH_ELEMENT_BOOL1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x1, &ColladaParserAutoGen14Private::_data__bool1x1, &ColladaParserAutoGen14Private::_end__bool1x1, &ColladaParserAutoGen14Private::_preBegin__bool1x1, &ColladaParserAutoGen14Private::_preEnd__bool1x1, &ColladaParserAutoGen14Private::_freeAttributes__bool1x1);
-functionMap[HASH_ELEMENT_BOOL1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x2, &ColladaParserAutoGen14Private::_data__bool1x2, &ColladaParserAutoGen14Private::_end__bool1x2, &ColladaParserAutoGen14Private::_preBegin__bool1x2, &ColladaParserAutoGen14Private::_preEnd__bool1x2, &ColladaParserAutoGen14Private::_freeAttributes__bool1x2);
-functionMap[HASH_ELEMENT_BOOL1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x3, &ColladaParserAutoGen14Private::_data__bool1x3, &ColladaParserAutoGen14Private::_end__bool1x3, &ColladaParserAutoGen14Private::_preBegin__bool1x3, &ColladaParserAutoGen14Private::_preEnd__bool1x3, &ColladaParserAutoGen14Private::_freeAttributes__bool1x3);
-functionMap[HASH_ELEMENT_BOOL1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x4, &ColladaParserAutoGen14Private::_data__bool1x4, &ColladaParserAutoGen14Private::_end__bool1x4, &ColladaParserAutoGen14Private::_preBegin__bool1x4, &ColladaParserAutoGen14Private::_preEnd__bool1x4, &ColladaParserAutoGen14Private::_freeAttributes__bool1x4);
-functionMap[HASH_ELEMENT_BOOL2____CG_BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____cg_bool2, &ColladaParserAutoGen14Private::_data__bool2____cg_bool2, &ColladaParserAutoGen14Private::_end__bool2____cg_bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____cg_bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____cg_bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____cg_bool2);
-functionMap[HASH_ELEMENT_BOOL2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x1, &ColladaParserAutoGen14Private::_data__bool2x1, &ColladaParserAutoGen14Private::_end__bool2x1, &ColladaParserAutoGen14Private::_preBegin__bool2x1, &ColladaParserAutoGen14Private::_preEnd__bool2x1, &ColladaParserAutoGen14Private::_freeAttributes__bool2x1);
-functionMap[HASH_ELEMENT_BOOL2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x2, &ColladaParserAutoGen14Private::_data__bool2x2, &ColladaParserAutoGen14Private::_end__bool2x2, &ColladaParserAutoGen14Private::_preBegin__bool2x2, &ColladaParserAutoGen14Private::_preEnd__bool2x2, &ColladaParserAutoGen14Private::_freeAttributes__bool2x2);
-functionMap[HASH_ELEMENT_BOOL2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x3, &ColladaParserAutoGen14Private::_data__bool2x3, &ColladaParserAutoGen14Private::_end__bool2x3, &ColladaParserAutoGen14Private::_preBegin__bool2x3, &ColladaParserAutoGen14Private::_preEnd__bool2x3, &ColladaParserAutoGen14Private::_freeAttributes__bool2x3);
-functionMap[HASH_ELEMENT_BOOL2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x4, &ColladaParserAutoGen14Private::_data__bool2x4, &ColladaParserAutoGen14Private::_end__bool2x4, &ColladaParserAutoGen14Private::_preBegin__bool2x4, &ColladaParserAutoGen14Private::_preEnd__bool2x4, &ColladaParserAutoGen14Private::_freeAttributes__bool2x4);
-functionMap[HASH_ELEMENT_BOOL3____CG_BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____cg_bool3, &ColladaParserAutoGen14Private::_data__bool3____cg_bool3, &ColladaParserAutoGen14Private::_end__bool3____cg_bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____cg_bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____cg_bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____cg_bool3);
-functionMap[HASH_ELEMENT_BOOL3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x1, &ColladaParserAutoGen14Private::_data__bool3x1, &ColladaParserAutoGen14Private::_end__bool3x1, &ColladaParserAutoGen14Private::_preBegin__bool3x1, &ColladaParserAutoGen14Private::_preEnd__bool3x1, &ColladaParserAutoGen14Private::_freeAttributes__bool3x1);
-functionMap[HASH_ELEMENT_BOOL3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x2, &ColladaParserAutoGen14Private::_data__bool3x2, &ColladaParserAutoGen14Private::_end__bool3x2, &ColladaParserAutoGen14Private::_preBegin__bool3x2, &ColladaParserAutoGen14Private::_preEnd__bool3x2, &ColladaParserAutoGen14Private::_freeAttributes__bool3x2);
-functionMap[HASH_ELEMENT_BOOL3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x3, &ColladaParserAutoGen14Private::_data__bool3x3, &ColladaParserAutoGen14Private::_end__bool3x3, &ColladaParserAutoGen14Private::_preBegin__bool3x3, &ColladaParserAutoGen14Private::_preEnd__bool3x3, &ColladaParserAutoGen14Private::_freeAttributes__bool3x3);
-functionMap[HASH_ELEMENT_BOOL3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x4, &ColladaParserAutoGen14Private::_data__bool3x4, &ColladaParserAutoGen14Private::_end__bool3x4, &ColladaParserAutoGen14Private::_preBegin__bool3x4, &ColladaParserAutoGen14Private::_preEnd__bool3x4, &ColladaParserAutoGen14Private::_freeAttributes__bool3x4);
-functionMap[HASH_ELEMENT_BOOL4____CG_BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____cg_bool4, &ColladaParserAutoGen14Private::_data__bool4____cg_bool4, &ColladaParserAutoGen14Private::_end__bool4____cg_bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____cg_bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____cg_bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____cg_bool4);
-functionMap[HASH_ELEMENT_BOOL4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x1, &ColladaParserAutoGen14Private::_data__bool4x1, &ColladaParserAutoGen14Private::_end__bool4x1, &ColladaParserAutoGen14Private::_preBegin__bool4x1, &ColladaParserAutoGen14Private::_preEnd__bool4x1, &ColladaParserAutoGen14Private::_freeAttributes__bool4x1);
-functionMap[HASH_ELEMENT_BOOL4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x2, &ColladaParserAutoGen14Private::_data__bool4x2, &ColladaParserAutoGen14Private::_end__bool4x2, &ColladaParserAutoGen14Private::_preBegin__bool4x2, &ColladaParserAutoGen14Private::_preEnd__bool4x2, &ColladaParserAutoGen14Private::_freeAttributes__bool4x2);
-functionMap[HASH_ELEMENT_BOOL4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x3, &ColladaParserAutoGen14Private::_data__bool4x3, &ColladaParserAutoGen14Private::_end__bool4x3, &ColladaParserAutoGen14Private::_preBegin__bool4x3, &ColladaParserAutoGen14Private::_preEnd__bool4x3, &ColladaParserAutoGen14Private::_freeAttributes__bool4x3);
-functionMap[HASH_ELEMENT_BOOL4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x4, &ColladaParserAutoGen14Private::_data__bool4x4, &ColladaParserAutoGen14Private::_end__bool4x4, &ColladaParserAutoGen14Private::_preBegin__bool4x4, &ColladaParserAutoGen14Private::_preEnd__bool4x4, &ColladaParserAutoGen14Private::_freeAttributes__bool4x4);
-functionMap[HASH_ELEMENT_CONNECT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__connect_param, &ColladaParserAutoGen14Private::_data__connect_param, &ColladaParserAutoGen14Private::_end__connect_param, &ColladaParserAutoGen14Private::_preBegin__connect_param, &ColladaParserAutoGen14Private::_preEnd__connect_param, &ColladaParserAutoGen14Private::_freeAttributes__connect_param);
-functionMap[HASH_ELEMENT_ENUM____GL_ENUMERATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_data__enum____gl_enumeration, &ColladaParserAutoGen14Private::_end__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preBegin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preEnd__enum____gl_enumeration, &ColladaParserAutoGen14Private::_freeAttributes__enum____gl_enumeration);
-functionMap[HASH_ELEMENT_FIXED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed, &ColladaParserAutoGen14Private::_data__fixed, &ColladaParserAutoGen14Private::_end__fixed, &ColladaParserAutoGen14Private::_preBegin__fixed, &ColladaParserAutoGen14Private::_preEnd__fixed, &ColladaParserAutoGen14Private::_freeAttributes__fixed);
-functionMap[HASH_ELEMENT_FIXED1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1, &ColladaParserAutoGen14Private::_data__fixed1, &ColladaParserAutoGen14Private::_end__fixed1, &ColladaParserAutoGen14Private::_preBegin__fixed1, &ColladaParserAutoGen14Private::_preEnd__fixed1, &ColladaParserAutoGen14Private::_freeAttributes__fixed1);
-functionMap[HASH_ELEMENT_FIXED1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x1, &ColladaParserAutoGen14Private::_data__fixed1x1, &ColladaParserAutoGen14Private::_end__fixed1x1, &ColladaParserAutoGen14Private::_preBegin__fixed1x1, &ColladaParserAutoGen14Private::_preEnd__fixed1x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x1);
-functionMap[HASH_ELEMENT_FIXED1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x2, &ColladaParserAutoGen14Private::_data__fixed1x2, &ColladaParserAutoGen14Private::_end__fixed1x2, &ColladaParserAutoGen14Private::_preBegin__fixed1x2, &ColladaParserAutoGen14Private::_preEnd__fixed1x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x2);
-functionMap[HASH_ELEMENT_FIXED1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x3, &ColladaParserAutoGen14Private::_data__fixed1x3, &ColladaParserAutoGen14Private::_end__fixed1x3, &ColladaParserAutoGen14Private::_preBegin__fixed1x3, &ColladaParserAutoGen14Private::_preEnd__fixed1x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x3);
-functionMap[HASH_ELEMENT_FIXED1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x4, &ColladaParserAutoGen14Private::_data__fixed1x4, &ColladaParserAutoGen14Private::_end__fixed1x4, &ColladaParserAutoGen14Private::_preBegin__fixed1x4, &ColladaParserAutoGen14Private::_preEnd__fixed1x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x4);
-functionMap[HASH_ELEMENT_FIXED2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2, &ColladaParserAutoGen14Private::_data__fixed2, &ColladaParserAutoGen14Private::_end__fixed2, &ColladaParserAutoGen14Private::_preBegin__fixed2, &ColladaParserAutoGen14Private::_preEnd__fixed2, &ColladaParserAutoGen14Private::_freeAttributes__fixed2);
-functionMap[HASH_ELEMENT_FIXED2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x1, &ColladaParserAutoGen14Private::_data__fixed2x1, &ColladaParserAutoGen14Private::_end__fixed2x1, &ColladaParserAutoGen14Private::_preBegin__fixed2x1, &ColladaParserAutoGen14Private::_preEnd__fixed2x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x1);
-functionMap[HASH_ELEMENT_FIXED2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x2, &ColladaParserAutoGen14Private::_data__fixed2x2, &ColladaParserAutoGen14Private::_end__fixed2x2, &ColladaParserAutoGen14Private::_preBegin__fixed2x2, &ColladaParserAutoGen14Private::_preEnd__fixed2x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x2);
-functionMap[HASH_ELEMENT_FIXED2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x3, &ColladaParserAutoGen14Private::_data__fixed2x3, &ColladaParserAutoGen14Private::_end__fixed2x3, &ColladaParserAutoGen14Private::_preBegin__fixed2x3, &ColladaParserAutoGen14Private::_preEnd__fixed2x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x3);
-functionMap[HASH_ELEMENT_FIXED2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x4, &ColladaParserAutoGen14Private::_data__fixed2x4, &ColladaParserAutoGen14Private::_end__fixed2x4, &ColladaParserAutoGen14Private::_preBegin__fixed2x4, &ColladaParserAutoGen14Private::_preEnd__fixed2x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x4);
-functionMap[HASH_ELEMENT_FIXED3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3, &ColladaParserAutoGen14Private::_data__fixed3, &ColladaParserAutoGen14Private::_end__fixed3, &ColladaParserAutoGen14Private::_preBegin__fixed3, &ColladaParserAutoGen14Private::_preEnd__fixed3, &ColladaParserAutoGen14Private::_freeAttributes__fixed3);
-functionMap[HASH_ELEMENT_FIXED3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x1, &ColladaParserAutoGen14Private::_data__fixed3x1, &ColladaParserAutoGen14Private::_end__fixed3x1, &ColladaParserAutoGen14Private::_preBegin__fixed3x1, &ColladaParserAutoGen14Private::_preEnd__fixed3x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x1);
-functionMap[HASH_ELEMENT_FIXED3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x2, &ColladaParserAutoGen14Private::_data__fixed3x2, &ColladaParserAutoGen14Private::_end__fixed3x2, &ColladaParserAutoGen14Private::_preBegin__fixed3x2, &ColladaParserAutoGen14Private::_preEnd__fixed3x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x2);
-functionMap[HASH_ELEMENT_FIXED3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x3, &ColladaParserAutoGen14Private::_data__fixed3x3, &ColladaParserAutoGen14Private::_end__fixed3x3, &ColladaParserAutoGen14Private::_preBegin__fixed3x3, &ColladaParserAutoGen14Private::_preEnd__fixed3x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x3);
-functionMap[HASH_ELEMENT_FIXED3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x4, &ColladaParserAutoGen14Private::_data__fixed3x4, &ColladaParserAutoGen14Private::_end__fixed3x4, &ColladaParserAutoGen14Private::_preBegin__fixed3x4, &ColladaParserAutoGen14Private::_preEnd__fixed3x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x4);
-functionMap[HASH_ELEMENT_FIXED4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4, &ColladaParserAutoGen14Private::_data__fixed4, &ColladaParserAutoGen14Private::_end__fixed4, &ColladaParserAutoGen14Private::_preBegin__fixed4, &ColladaParserAutoGen14Private::_preEnd__fixed4, &ColladaParserAutoGen14Private::_freeAttributes__fixed4);
-functionMap[HASH_ELEMENT_FIXED4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x1, &ColladaParserAutoGen14Private::_data__fixed4x1, &ColladaParserAutoGen14Private::_end__fixed4x1, &ColladaParserAutoGen14Private::_preBegin__fixed4x1, &ColladaParserAutoGen14Private::_preEnd__fixed4x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x1);
-functionMap[HASH_ELEMENT_FIXED4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x2, &ColladaParserAutoGen14Private::_data__fixed4x2, &ColladaParserAutoGen14Private::_end__fixed4x2, &ColladaParserAutoGen14Private::_preBegin__fixed4x2, &ColladaParserAutoGen14Private::_preEnd__fixed4x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x2);
-functionMap[HASH_ELEMENT_FIXED4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x3, &ColladaParserAutoGen14Private::_data__fixed4x3, &ColladaParserAutoGen14Private::_end__fixed4x3, &ColladaParserAutoGen14Private::_preBegin__fixed4x3, &ColladaParserAutoGen14Private::_preEnd__fixed4x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x3);
-functionMap[HASH_ELEMENT_FIXED4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x4, &ColladaParserAutoGen14Private::_data__fixed4x4, &ColladaParserAutoGen14Private::_end__fixed4x4, &ColladaParserAutoGen14Private::_preBegin__fixed4x4, &ColladaParserAutoGen14Private::_preEnd__fixed4x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x4);
-functionMap[HASH_ELEMENT_FLOAT____CG_FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____cg_float, &ColladaParserAutoGen14Private::_data__float____cg_float, &ColladaParserAutoGen14Private::_end__float____cg_float, &ColladaParserAutoGen14Private::_preBegin__float____cg_float, &ColladaParserAutoGen14Private::_preEnd__float____cg_float, &ColladaParserAutoGen14Private::_freeAttributes__float____cg_float);
-functionMap[HASH_ELEMENT_FLOAT1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1, &ColladaParserAutoGen14Private::_data__float1, &ColladaParserAutoGen14Private::_end__float1, &ColladaParserAutoGen14Private::_preBegin__float1, &ColladaParserAutoGen14Private::_preEnd__float1, &ColladaParserAutoGen14Private::_freeAttributes__float1);
-functionMap[HASH_ELEMENT_FLOAT1X1____CG_FLOAT1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_data__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_end__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_preBegin__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_preEnd__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_freeAttributes__float1x1____cg_float1x1);
-functionMap[HASH_ELEMENT_FLOAT1X2____CG_FLOAT1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_data__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_end__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_preBegin__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_preEnd__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_freeAttributes__float1x2____cg_float1x2);
-functionMap[HASH_ELEMENT_FLOAT1X3____CG_FLOAT1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_data__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_end__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_preBegin__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_preEnd__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_freeAttributes__float1x3____cg_float1x3);
-functionMap[HASH_ELEMENT_FLOAT1X4____CG_FLOAT1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_data__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_end__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_preBegin__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_preEnd__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_freeAttributes__float1x4____cg_float1x4);
-functionMap[HASH_ELEMENT_FLOAT2____CG_FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____cg_float2, &ColladaParserAutoGen14Private::_data__float2____cg_float2, &ColladaParserAutoGen14Private::_end__float2____cg_float2, &ColladaParserAutoGen14Private::_preBegin__float2____cg_float2, &ColladaParserAutoGen14Private::_preEnd__float2____cg_float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____cg_float2);
-functionMap[HASH_ELEMENT_FLOAT2X1____CG_FLOAT2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_data__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_end__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_preBegin__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_preEnd__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_freeAttributes__float2x1____cg_float2x1);
-functionMap[HASH_ELEMENT_FLOAT2X2____CG_FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_data__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_end__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____cg_float2x2);
-functionMap[HASH_ELEMENT_FLOAT2X3____CG_FLOAT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_data__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_end__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_preBegin__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_preEnd__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_freeAttributes__float2x3____cg_float2x3);
-functionMap[HASH_ELEMENT_FLOAT2X4____CG_FLOAT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_data__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_end__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_preBegin__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_preEnd__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_freeAttributes__float2x4____cg_float2x4);
-functionMap[HASH_ELEMENT_FLOAT3____CG_FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____cg_float3, &ColladaParserAutoGen14Private::_data__float3____cg_float3, &ColladaParserAutoGen14Private::_end__float3____cg_float3, &ColladaParserAutoGen14Private::_preBegin__float3____cg_float3, &ColladaParserAutoGen14Private::_preEnd__float3____cg_float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____cg_float3);
-functionMap[HASH_ELEMENT_FLOAT3X1____CG_FLOAT3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_data__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_end__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_preBegin__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_preEnd__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_freeAttributes__float3x1____cg_float3x1);
-functionMap[HASH_ELEMENT_FLOAT3X2____CG_FLOAT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_data__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_end__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_preBegin__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_preEnd__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_freeAttributes__float3x2____cg_float3x2);
-functionMap[HASH_ELEMENT_FLOAT3X3____CG_FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_data__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_end__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____cg_float3x3);
-functionMap[HASH_ELEMENT_FLOAT3X4____CG_FLOAT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_data__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_end__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_preBegin__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_preEnd__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_freeAttributes__float3x4____cg_float3x4);
-functionMap[HASH_ELEMENT_FLOAT4____CG_FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____cg_float4, &ColladaParserAutoGen14Private::_data__float4____cg_float4, &ColladaParserAutoGen14Private::_end__float4____cg_float4, &ColladaParserAutoGen14Private::_preBegin__float4____cg_float4, &ColladaParserAutoGen14Private::_preEnd__float4____cg_float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____cg_float4);
-functionMap[HASH_ELEMENT_FLOAT4X1____CG_FLOAT4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_data__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_end__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_preBegin__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_preEnd__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_freeAttributes__float4x1____cg_float4x1);
-functionMap[HASH_ELEMENT_FLOAT4X2____CG_FLOAT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_data__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_end__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_preBegin__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_preEnd__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_freeAttributes__float4x2____cg_float4x2);
-functionMap[HASH_ELEMENT_FLOAT4X3____CG_FLOAT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_data__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_end__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_preBegin__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_preEnd__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_freeAttributes__float4x3____cg_float4x3);
-functionMap[HASH_ELEMENT_FLOAT4X4____CG_FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_data__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_end__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____cg_float4x4);
-functionMap[HASH_ELEMENT_HALF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half, &ColladaParserAutoGen14Private::_data__half, &ColladaParserAutoGen14Private::_end__half, &ColladaParserAutoGen14Private::_preBegin__half, &ColladaParserAutoGen14Private::_preEnd__half, &ColladaParserAutoGen14Private::_freeAttributes__half);
-functionMap[HASH_ELEMENT_HALF1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1, &ColladaParserAutoGen14Private::_data__half1, &ColladaParserAutoGen14Private::_end__half1, &ColladaParserAutoGen14Private::_preBegin__half1, &ColladaParserAutoGen14Private::_preEnd__half1, &ColladaParserAutoGen14Private::_freeAttributes__half1);
-functionMap[HASH_ELEMENT_HALF1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x1, &ColladaParserAutoGen14Private::_data__half1x1, &ColladaParserAutoGen14Private::_end__half1x1, &ColladaParserAutoGen14Private::_preBegin__half1x1, &ColladaParserAutoGen14Private::_preEnd__half1x1, &ColladaParserAutoGen14Private::_freeAttributes__half1x1);
-functionMap[HASH_ELEMENT_HALF1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x2, &ColladaParserAutoGen14Private::_data__half1x2, &ColladaParserAutoGen14Private::_end__half1x2, &ColladaParserAutoGen14Private::_preBegin__half1x2, &ColladaParserAutoGen14Private::_preEnd__half1x2, &ColladaParserAutoGen14Private::_freeAttributes__half1x2);
-functionMap[HASH_ELEMENT_HALF1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x3, &ColladaParserAutoGen14Private::_data__half1x3, &ColladaParserAutoGen14Private::_end__half1x3, &ColladaParserAutoGen14Private::_preBegin__half1x3, &ColladaParserAutoGen14Private::_preEnd__half1x3, &ColladaParserAutoGen14Private::_freeAttributes__half1x3);
-functionMap[HASH_ELEMENT_HALF1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x4, &ColladaParserAutoGen14Private::_data__half1x4, &ColladaParserAutoGen14Private::_end__half1x4, &ColladaParserAutoGen14Private::_preBegin__half1x4, &ColladaParserAutoGen14Private::_preEnd__half1x4, &ColladaParserAutoGen14Private::_freeAttributes__half1x4);
-functionMap[HASH_ELEMENT_HALF2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2, &ColladaParserAutoGen14Private::_data__half2, &ColladaParserAutoGen14Private::_end__half2, &ColladaParserAutoGen14Private::_preBegin__half2, &ColladaParserAutoGen14Private::_preEnd__half2, &ColladaParserAutoGen14Private::_freeAttributes__half2);
-functionMap[HASH_ELEMENT_HALF2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x1, &ColladaParserAutoGen14Private::_data__half2x1, &ColladaParserAutoGen14Private::_end__half2x1, &ColladaParserAutoGen14Private::_preBegin__half2x1, &ColladaParserAutoGen14Private::_preEnd__half2x1, &ColladaParserAutoGen14Private::_freeAttributes__half2x1);
-functionMap[HASH_ELEMENT_HALF2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x2, &ColladaParserAutoGen14Private::_data__half2x2, &ColladaParserAutoGen14Private::_end__half2x2, &ColladaParserAutoGen14Private::_preBegin__half2x2, &ColladaParserAutoGen14Private::_preEnd__half2x2, &ColladaParserAutoGen14Private::_freeAttributes__half2x2);
-functionMap[HASH_ELEMENT_HALF2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x3, &ColladaParserAutoGen14Private::_data__half2x3, &ColladaParserAutoGen14Private::_end__half2x3, &ColladaParserAutoGen14Private::_preBegin__half2x3, &ColladaParserAutoGen14Private::_preEnd__half2x3, &ColladaParserAutoGen14Private::_freeAttributes__half2x3);
-functionMap[HASH_ELEMENT_HALF2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x4, &ColladaParserAutoGen14Private::_data__half2x4, &ColladaParserAutoGen14Private::_end__half2x4, &ColladaParserAutoGen14Private::_preBegin__half2x4, &ColladaParserAutoGen14Private::_preEnd__half2x4, &ColladaParserAutoGen14Private::_freeAttributes__half2x4);
-functionMap[HASH_ELEMENT_HALF3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3, &ColladaParserAutoGen14Private::_data__half3, &ColladaParserAutoGen14Private::_end__half3, &ColladaParserAutoGen14Private::_preBegin__half3, &ColladaParserAutoGen14Private::_preEnd__half3, &ColladaParserAutoGen14Private::_freeAttributes__half3);
-functionMap[HASH_ELEMENT_HALF3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x1, &ColladaParserAutoGen14Private::_data__half3x1, &ColladaParserAutoGen14Private::_end__half3x1, &ColladaParserAutoGen14Private::_preBegin__half3x1, &ColladaParserAutoGen14Private::_preEnd__half3x1, &ColladaParserAutoGen14Private::_freeAttributes__half3x1);
-functionMap[HASH_ELEMENT_HALF3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x2, &ColladaParserAutoGen14Private::_data__half3x2, &ColladaParserAutoGen14Private::_end__half3x2, &ColladaParserAutoGen14Private::_preBegin__half3x2, &ColladaParserAutoGen14Private::_preEnd__half3x2, &ColladaParserAutoGen14Private::_freeAttributes__half3x2);
-functionMap[HASH_ELEMENT_HALF3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x3, &ColladaParserAutoGen14Private::_data__half3x3, &ColladaParserAutoGen14Private::_end__half3x3, &ColladaParserAutoGen14Private::_preBegin__half3x3, &ColladaParserAutoGen14Private::_preEnd__half3x3, &ColladaParserAutoGen14Private::_freeAttributes__half3x3);
-functionMap[HASH_ELEMENT_HALF3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x4, &ColladaParserAutoGen14Private::_data__half3x4, &ColladaParserAutoGen14Private::_end__half3x4, &ColladaParserAutoGen14Private::_preBegin__half3x4, &ColladaParserAutoGen14Private::_preEnd__half3x4, &ColladaParserAutoGen14Private::_freeAttributes__half3x4);
-functionMap[HASH_ELEMENT_HALF4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4, &ColladaParserAutoGen14Private::_data__half4, &ColladaParserAutoGen14Private::_end__half4, &ColladaParserAutoGen14Private::_preBegin__half4, &ColladaParserAutoGen14Private::_preEnd__half4, &ColladaParserAutoGen14Private::_freeAttributes__half4);
-functionMap[HASH_ELEMENT_HALF4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x1, &ColladaParserAutoGen14Private::_data__half4x1, &ColladaParserAutoGen14Private::_end__half4x1, &ColladaParserAutoGen14Private::_preBegin__half4x1, &ColladaParserAutoGen14Private::_preEnd__half4x1, &ColladaParserAutoGen14Private::_freeAttributes__half4x1);
-functionMap[HASH_ELEMENT_HALF4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x2, &ColladaParserAutoGen14Private::_data__half4x2, &ColladaParserAutoGen14Private::_end__half4x2, &ColladaParserAutoGen14Private::_preBegin__half4x2, &ColladaParserAutoGen14Private::_preEnd__half4x2, &ColladaParserAutoGen14Private::_freeAttributes__half4x2);
-functionMap[HASH_ELEMENT_HALF4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x3, &ColladaParserAutoGen14Private::_data__half4x3, &ColladaParserAutoGen14Private::_end__half4x3, &ColladaParserAutoGen14Private::_preBegin__half4x3, &ColladaParserAutoGen14Private::_preEnd__half4x3, &ColladaParserAutoGen14Private::_freeAttributes__half4x3);
-functionMap[HASH_ELEMENT_HALF4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x4, &ColladaParserAutoGen14Private::_data__half4x4, &ColladaParserAutoGen14Private::_end__half4x4, &ColladaParserAutoGen14Private::_preBegin__half4x4, &ColladaParserAutoGen14Private::_preEnd__half4x4, &ColladaParserAutoGen14Private::_freeAttributes__half4x4);
-functionMap[HASH_ELEMENT_INT____CG_INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____cg_int, &ColladaParserAutoGen14Private::_data__int____cg_int, &ColladaParserAutoGen14Private::_end__int____cg_int, &ColladaParserAutoGen14Private::_preBegin__int____cg_int, &ColladaParserAutoGen14Private::_preEnd__int____cg_int, &ColladaParserAutoGen14Private::_freeAttributes__int____cg_int);
-functionMap[HASH_ELEMENT_INT1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1, &ColladaParserAutoGen14Private::_data__int1, &ColladaParserAutoGen14Private::_end__int1, &ColladaParserAutoGen14Private::_preBegin__int1, &ColladaParserAutoGen14Private::_preEnd__int1, &ColladaParserAutoGen14Private::_freeAttributes__int1);
-functionMap[HASH_ELEMENT_INT1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x1, &ColladaParserAutoGen14Private::_data__int1x1, &ColladaParserAutoGen14Private::_end__int1x1, &ColladaParserAutoGen14Private::_preBegin__int1x1, &ColladaParserAutoGen14Private::_preEnd__int1x1, &ColladaParserAutoGen14Private::_freeAttributes__int1x1);
-functionMap[HASH_ELEMENT_INT1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x2, &ColladaParserAutoGen14Private::_data__int1x2, &ColladaParserAutoGen14Private::_end__int1x2, &ColladaParserAutoGen14Private::_preBegin__int1x2, &ColladaParserAutoGen14Private::_preEnd__int1x2, &ColladaParserAutoGen14Private::_freeAttributes__int1x2);
-functionMap[HASH_ELEMENT_INT1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x3, &ColladaParserAutoGen14Private::_data__int1x3, &ColladaParserAutoGen14Private::_end__int1x3, &ColladaParserAutoGen14Private::_preBegin__int1x3, &ColladaParserAutoGen14Private::_preEnd__int1x3, &ColladaParserAutoGen14Private::_freeAttributes__int1x3);
-functionMap[HASH_ELEMENT_INT1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x4, &ColladaParserAutoGen14Private::_data__int1x4, &ColladaParserAutoGen14Private::_end__int1x4, &ColladaParserAutoGen14Private::_preBegin__int1x4, &ColladaParserAutoGen14Private::_preEnd__int1x4, &ColladaParserAutoGen14Private::_freeAttributes__int1x4);
-functionMap[HASH_ELEMENT_INT2____CG_INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____cg_int2, &ColladaParserAutoGen14Private::_data__int2____cg_int2, &ColladaParserAutoGen14Private::_end__int2____cg_int2, &ColladaParserAutoGen14Private::_preBegin__int2____cg_int2, &ColladaParserAutoGen14Private::_preEnd__int2____cg_int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____cg_int2);
-functionMap[HASH_ELEMENT_INT2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x1, &ColladaParserAutoGen14Private::_data__int2x1, &ColladaParserAutoGen14Private::_end__int2x1, &ColladaParserAutoGen14Private::_preBegin__int2x1, &ColladaParserAutoGen14Private::_preEnd__int2x1, &ColladaParserAutoGen14Private::_freeAttributes__int2x1);
-functionMap[HASH_ELEMENT_INT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x2, &ColladaParserAutoGen14Private::_data__int2x2, &ColladaParserAutoGen14Private::_end__int2x2, &ColladaParserAutoGen14Private::_preBegin__int2x2, &ColladaParserAutoGen14Private::_preEnd__int2x2, &ColladaParserAutoGen14Private::_freeAttributes__int2x2);
-functionMap[HASH_ELEMENT_INT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x3, &ColladaParserAutoGen14Private::_data__int2x3, &ColladaParserAutoGen14Private::_end__int2x3, &ColladaParserAutoGen14Private::_preBegin__int2x3, &ColladaParserAutoGen14Private::_preEnd__int2x3, &ColladaParserAutoGen14Private::_freeAttributes__int2x3);
-functionMap[HASH_ELEMENT_INT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x4, &ColladaParserAutoGen14Private::_data__int2x4, &ColladaParserAutoGen14Private::_end__int2x4, &ColladaParserAutoGen14Private::_preBegin__int2x4, &ColladaParserAutoGen14Private::_preEnd__int2x4, &ColladaParserAutoGen14Private::_freeAttributes__int2x4);
-functionMap[HASH_ELEMENT_INT3____CG_INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____cg_int3, &ColladaParserAutoGen14Private::_data__int3____cg_int3, &ColladaParserAutoGen14Private::_end__int3____cg_int3, &ColladaParserAutoGen14Private::_preBegin__int3____cg_int3, &ColladaParserAutoGen14Private::_preEnd__int3____cg_int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____cg_int3);
-functionMap[HASH_ELEMENT_INT3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x1, &ColladaParserAutoGen14Private::_data__int3x1, &ColladaParserAutoGen14Private::_end__int3x1, &ColladaParserAutoGen14Private::_preBegin__int3x1, &ColladaParserAutoGen14Private::_preEnd__int3x1, &ColladaParserAutoGen14Private::_freeAttributes__int3x1);
-functionMap[HASH_ELEMENT_INT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x2, &ColladaParserAutoGen14Private::_data__int3x2, &ColladaParserAutoGen14Private::_end__int3x2, &ColladaParserAutoGen14Private::_preBegin__int3x2, &ColladaParserAutoGen14Private::_preEnd__int3x2, &ColladaParserAutoGen14Private::_freeAttributes__int3x2);
-functionMap[HASH_ELEMENT_INT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x3, &ColladaParserAutoGen14Private::_data__int3x3, &ColladaParserAutoGen14Private::_end__int3x3, &ColladaParserAutoGen14Private::_preBegin__int3x3, &ColladaParserAutoGen14Private::_preEnd__int3x3, &ColladaParserAutoGen14Private::_freeAttributes__int3x3);
-functionMap[HASH_ELEMENT_INT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x4, &ColladaParserAutoGen14Private::_data__int3x4, &ColladaParserAutoGen14Private::_end__int3x4, &ColladaParserAutoGen14Private::_preBegin__int3x4, &ColladaParserAutoGen14Private::_preEnd__int3x4, &ColladaParserAutoGen14Private::_freeAttributes__int3x4);
-functionMap[HASH_ELEMENT_INT4____CG_INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____cg_int4, &ColladaParserAutoGen14Private::_data__int4____cg_int4, &ColladaParserAutoGen14Private::_end__int4____cg_int4, &ColladaParserAutoGen14Private::_preBegin__int4____cg_int4, &ColladaParserAutoGen14Private::_preEnd__int4____cg_int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____cg_int4);
-functionMap[HASH_ELEMENT_INT4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x1, &ColladaParserAutoGen14Private::_data__int4x1, &ColladaParserAutoGen14Private::_end__int4x1, &ColladaParserAutoGen14Private::_preBegin__int4x1, &ColladaParserAutoGen14Private::_preEnd__int4x1, &ColladaParserAutoGen14Private::_freeAttributes__int4x1);
-functionMap[HASH_ELEMENT_INT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x2, &ColladaParserAutoGen14Private::_data__int4x2, &ColladaParserAutoGen14Private::_end__int4x2, &ColladaParserAutoGen14Private::_preBegin__int4x2, &ColladaParserAutoGen14Private::_preEnd__int4x2, &ColladaParserAutoGen14Private::_freeAttributes__int4x2);
-functionMap[HASH_ELEMENT_INT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x3, &ColladaParserAutoGen14Private::_data__int4x3, &ColladaParserAutoGen14Private::_end__int4x3, &ColladaParserAutoGen14Private::_preBegin__int4x3, &ColladaParserAutoGen14Private::_preEnd__int4x3, &ColladaParserAutoGen14Private::_freeAttributes__int4x3);
-functionMap[HASH_ELEMENT_INT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x4, &ColladaParserAutoGen14Private::_data__int4x4, &ColladaParserAutoGen14Private::_end__int4x4, &ColladaParserAutoGen14Private::_preBegin__int4x4, &ColladaParserAutoGen14Private::_preEnd__int4x4, &ColladaParserAutoGen14Private::_freeAttributes__int4x4);
-functionMap[HASH_ELEMENT_SAMPLER1D____CG_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_data__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_end__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_preBegin__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_preEnd__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____cg_sampler1D);
-functionMap[HASH_ELEMENT_SAMPLER2D____CG_SAMPLER2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_data__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_end__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_preBegin__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_preEnd__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____cg_sampler2D);
-functionMap[HASH_ELEMENT_SAMPLER3D____CG_SAMPLER3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_data__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_end__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_preBegin__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_preEnd__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____cg_sampler3D);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____CG_SAMPLERCUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_data__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_end__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____cg_samplerCUBE);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____CG_SAMPLERDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_data__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_end__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____cg_samplerDEPTH);
-functionMap[HASH_ELEMENT_SAMPLERRECT____CG_SAMPLERRECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_data__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_end__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____cg_samplerRECT);
-functionMap[HASH_ELEMENT_STRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__string, &ColladaParserAutoGen14Private::_data__string, &ColladaParserAutoGen14Private::_end__string, &ColladaParserAutoGen14Private::_preBegin__string, &ColladaParserAutoGen14Private::_preEnd__string, &ColladaParserAutoGen14Private::_freeAttributes__string);
-functionMap[HASH_ELEMENT_SURFACE____CG_SURFACE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____cg_surface_type, &ColladaParserAutoGen14Private::_data__surface____cg_surface_type, &ColladaParserAutoGen14Private::_end__surface____cg_surface_type, &ColladaParserAutoGen14Private::_preBegin__surface____cg_surface_type, &ColladaParserAutoGen14Private::_preEnd__surface____cg_surface_type, &ColladaParserAutoGen14Private::_freeAttributes__surface____cg_surface_type);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_BOOL____CG_BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____cg_bool, &ColladaParserAutoGen14Private::_data__bool____cg_bool, &ColladaParserAutoGen14Private::_end__bool____cg_bool, &ColladaParserAutoGen14Private::_preBegin__bool____cg_bool, &ColladaParserAutoGen14Private::_preEnd__bool____cg_bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____cg_bool);
-functionMap[HASH_ELEMENT_BOOL1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1, &ColladaParserAutoGen14Private::_data__bool1, &ColladaParserAutoGen14Private::_end__bool1, &ColladaParserAutoGen14Private::_preBegin__bool1, &ColladaParserAutoGen14Private::_preEnd__bool1, &ColladaParserAutoGen14Private::_freeAttributes__bool1);
-functionMap[HASH_ELEMENT_BOOL1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x1, &ColladaParserAutoGen14Private::_data__bool1x1, &ColladaParserAutoGen14Private::_end__bool1x1, &ColladaParserAutoGen14Private::_preBegin__bool1x1, &ColladaParserAutoGen14Private::_preEnd__bool1x1, &ColladaParserAutoGen14Private::_freeAttributes__bool1x1);
-functionMap[HASH_ELEMENT_BOOL1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x2, &ColladaParserAutoGen14Private::_data__bool1x2, &ColladaParserAutoGen14Private::_end__bool1x2, &ColladaParserAutoGen14Private::_preBegin__bool1x2, &ColladaParserAutoGen14Private::_preEnd__bool1x2, &ColladaParserAutoGen14Private::_freeAttributes__bool1x2);
-functionMap[HASH_ELEMENT_BOOL1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x3, &ColladaParserAutoGen14Private::_data__bool1x3, &ColladaParserAutoGen14Private::_end__bool1x3, &ColladaParserAutoGen14Private::_preBegin__bool1x3, &ColladaParserAutoGen14Private::_preEnd__bool1x3, &ColladaParserAutoGen14Private::_freeAttributes__bool1x3);
-functionMap[HASH_ELEMENT_BOOL1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool1x4, &ColladaParserAutoGen14Private::_data__bool1x4, &ColladaParserAutoGen14Private::_end__bool1x4, &ColladaParserAutoGen14Private::_preBegin__bool1x4, &ColladaParserAutoGen14Private::_preEnd__bool1x4, &ColladaParserAutoGen14Private::_freeAttributes__bool1x4);
-functionMap[HASH_ELEMENT_BOOL2____CG_BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____cg_bool2, &ColladaParserAutoGen14Private::_data__bool2____cg_bool2, &ColladaParserAutoGen14Private::_end__bool2____cg_bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____cg_bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____cg_bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____cg_bool2);
-functionMap[HASH_ELEMENT_BOOL2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x1, &ColladaParserAutoGen14Private::_data__bool2x1, &ColladaParserAutoGen14Private::_end__bool2x1, &ColladaParserAutoGen14Private::_preBegin__bool2x1, &ColladaParserAutoGen14Private::_preEnd__bool2x1, &ColladaParserAutoGen14Private::_freeAttributes__bool2x1);
-functionMap[HASH_ELEMENT_BOOL2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x2, &ColladaParserAutoGen14Private::_data__bool2x2, &ColladaParserAutoGen14Private::_end__bool2x2, &ColladaParserAutoGen14Private::_preBegin__bool2x2, &ColladaParserAutoGen14Private::_preEnd__bool2x2, &ColladaParserAutoGen14Private::_freeAttributes__bool2x2);
-functionMap[HASH_ELEMENT_BOOL2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x3, &ColladaParserAutoGen14Private::_data__bool2x3, &ColladaParserAutoGen14Private::_end__bool2x3, &ColladaParserAutoGen14Private::_preBegin__bool2x3, &ColladaParserAutoGen14Private::_preEnd__bool2x3, &ColladaParserAutoGen14Private::_freeAttributes__bool2x3);
-functionMap[HASH_ELEMENT_BOOL2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2x4, &ColladaParserAutoGen14Private::_data__bool2x4, &ColladaParserAutoGen14Private::_end__bool2x4, &ColladaParserAutoGen14Private::_preBegin__bool2x4, &ColladaParserAutoGen14Private::_preEnd__bool2x4, &ColladaParserAutoGen14Private::_freeAttributes__bool2x4);
-functionMap[HASH_ELEMENT_BOOL3____CG_BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____cg_bool3, &ColladaParserAutoGen14Private::_data__bool3____cg_bool3, &ColladaParserAutoGen14Private::_end__bool3____cg_bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____cg_bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____cg_bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____cg_bool3);
-functionMap[HASH_ELEMENT_BOOL3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x1, &ColladaParserAutoGen14Private::_data__bool3x1, &ColladaParserAutoGen14Private::_end__bool3x1, &ColladaParserAutoGen14Private::_preBegin__bool3x1, &ColladaParserAutoGen14Private::_preEnd__bool3x1, &ColladaParserAutoGen14Private::_freeAttributes__bool3x1);
-functionMap[HASH_ELEMENT_BOOL3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x2, &ColladaParserAutoGen14Private::_data__bool3x2, &ColladaParserAutoGen14Private::_end__bool3x2, &ColladaParserAutoGen14Private::_preBegin__bool3x2, &ColladaParserAutoGen14Private::_preEnd__bool3x2, &ColladaParserAutoGen14Private::_freeAttributes__bool3x2);
-functionMap[HASH_ELEMENT_BOOL3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x3, &ColladaParserAutoGen14Private::_data__bool3x3, &ColladaParserAutoGen14Private::_end__bool3x3, &ColladaParserAutoGen14Private::_preBegin__bool3x3, &ColladaParserAutoGen14Private::_preEnd__bool3x3, &ColladaParserAutoGen14Private::_freeAttributes__bool3x3);
-functionMap[HASH_ELEMENT_BOOL3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3x4, &ColladaParserAutoGen14Private::_data__bool3x4, &ColladaParserAutoGen14Private::_end__bool3x4, &ColladaParserAutoGen14Private::_preBegin__bool3x4, &ColladaParserAutoGen14Private::_preEnd__bool3x4, &ColladaParserAutoGen14Private::_freeAttributes__bool3x4);
-functionMap[HASH_ELEMENT_BOOL4____CG_BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____cg_bool4, &ColladaParserAutoGen14Private::_data__bool4____cg_bool4, &ColladaParserAutoGen14Private::_end__bool4____cg_bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____cg_bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____cg_bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____cg_bool4);
-functionMap[HASH_ELEMENT_BOOL4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x1, &ColladaParserAutoGen14Private::_data__bool4x1, &ColladaParserAutoGen14Private::_end__bool4x1, &ColladaParserAutoGen14Private::_preBegin__bool4x1, &ColladaParserAutoGen14Private::_preEnd__bool4x1, &ColladaParserAutoGen14Private::_freeAttributes__bool4x1);
-functionMap[HASH_ELEMENT_BOOL4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x2, &ColladaParserAutoGen14Private::_data__bool4x2, &ColladaParserAutoGen14Private::_end__bool4x2, &ColladaParserAutoGen14Private::_preBegin__bool4x2, &ColladaParserAutoGen14Private::_preEnd__bool4x2, &ColladaParserAutoGen14Private::_freeAttributes__bool4x2);
-functionMap[HASH_ELEMENT_BOOL4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x3, &ColladaParserAutoGen14Private::_data__bool4x3, &ColladaParserAutoGen14Private::_end__bool4x3, &ColladaParserAutoGen14Private::_preBegin__bool4x3, &ColladaParserAutoGen14Private::_preEnd__bool4x3, &ColladaParserAutoGen14Private::_freeAttributes__bool4x3);
-functionMap[HASH_ELEMENT_BOOL4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4x4, &ColladaParserAutoGen14Private::_data__bool4x4, &ColladaParserAutoGen14Private::_end__bool4x4, &ColladaParserAutoGen14Private::_preBegin__bool4x4, &ColladaParserAutoGen14Private::_preEnd__bool4x4, &ColladaParserAutoGen14Private::_freeAttributes__bool4x4);
-functionMap[HASH_ELEMENT_CONNECT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__connect_param, &ColladaParserAutoGen14Private::_data__connect_param, &ColladaParserAutoGen14Private::_end__connect_param, &ColladaParserAutoGen14Private::_preBegin__connect_param, &ColladaParserAutoGen14Private::_preEnd__connect_param, &ColladaParserAutoGen14Private::_freeAttributes__connect_param);
-functionMap[HASH_ELEMENT_ENUM____GL_ENUMERATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_data__enum____gl_enumeration, &ColladaParserAutoGen14Private::_end__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preBegin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preEnd__enum____gl_enumeration, &ColladaParserAutoGen14Private::_freeAttributes__enum____gl_enumeration);
-functionMap[HASH_ELEMENT_FIXED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed, &ColladaParserAutoGen14Private::_data__fixed, &ColladaParserAutoGen14Private::_end__fixed, &ColladaParserAutoGen14Private::_preBegin__fixed, &ColladaParserAutoGen14Private::_preEnd__fixed, &ColladaParserAutoGen14Private::_freeAttributes__fixed);
-functionMap[HASH_ELEMENT_FIXED1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1, &ColladaParserAutoGen14Private::_data__fixed1, &ColladaParserAutoGen14Private::_end__fixed1, &ColladaParserAutoGen14Private::_preBegin__fixed1, &ColladaParserAutoGen14Private::_preEnd__fixed1, &ColladaParserAutoGen14Private::_freeAttributes__fixed1);
-functionMap[HASH_ELEMENT_FIXED1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x1, &ColladaParserAutoGen14Private::_data__fixed1x1, &ColladaParserAutoGen14Private::_end__fixed1x1, &ColladaParserAutoGen14Private::_preBegin__fixed1x1, &ColladaParserAutoGen14Private::_preEnd__fixed1x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x1);
-functionMap[HASH_ELEMENT_FIXED1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x2, &ColladaParserAutoGen14Private::_data__fixed1x2, &ColladaParserAutoGen14Private::_end__fixed1x2, &ColladaParserAutoGen14Private::_preBegin__fixed1x2, &ColladaParserAutoGen14Private::_preEnd__fixed1x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x2);
-functionMap[HASH_ELEMENT_FIXED1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x3, &ColladaParserAutoGen14Private::_data__fixed1x3, &ColladaParserAutoGen14Private::_end__fixed1x3, &ColladaParserAutoGen14Private::_preBegin__fixed1x3, &ColladaParserAutoGen14Private::_preEnd__fixed1x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x3);
-functionMap[HASH_ELEMENT_FIXED1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed1x4, &ColladaParserAutoGen14Private::_data__fixed1x4, &ColladaParserAutoGen14Private::_end__fixed1x4, &ColladaParserAutoGen14Private::_preBegin__fixed1x4, &ColladaParserAutoGen14Private::_preEnd__fixed1x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed1x4);
-functionMap[HASH_ELEMENT_FIXED2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2, &ColladaParserAutoGen14Private::_data__fixed2, &ColladaParserAutoGen14Private::_end__fixed2, &ColladaParserAutoGen14Private::_preBegin__fixed2, &ColladaParserAutoGen14Private::_preEnd__fixed2, &ColladaParserAutoGen14Private::_freeAttributes__fixed2);
-functionMap[HASH_ELEMENT_FIXED2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x1, &ColladaParserAutoGen14Private::_data__fixed2x1, &ColladaParserAutoGen14Private::_end__fixed2x1, &ColladaParserAutoGen14Private::_preBegin__fixed2x1, &ColladaParserAutoGen14Private::_preEnd__fixed2x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x1);
-functionMap[HASH_ELEMENT_FIXED2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x2, &ColladaParserAutoGen14Private::_data__fixed2x2, &ColladaParserAutoGen14Private::_end__fixed2x2, &ColladaParserAutoGen14Private::_preBegin__fixed2x2, &ColladaParserAutoGen14Private::_preEnd__fixed2x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x2);
-functionMap[HASH_ELEMENT_FIXED2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x3, &ColladaParserAutoGen14Private::_data__fixed2x3, &ColladaParserAutoGen14Private::_end__fixed2x3, &ColladaParserAutoGen14Private::_preBegin__fixed2x3, &ColladaParserAutoGen14Private::_preEnd__fixed2x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x3);
-functionMap[HASH_ELEMENT_FIXED2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed2x4, &ColladaParserAutoGen14Private::_data__fixed2x4, &ColladaParserAutoGen14Private::_end__fixed2x4, &ColladaParserAutoGen14Private::_preBegin__fixed2x4, &ColladaParserAutoGen14Private::_preEnd__fixed2x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed2x4);
-functionMap[HASH_ELEMENT_FIXED3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3, &ColladaParserAutoGen14Private::_data__fixed3, &ColladaParserAutoGen14Private::_end__fixed3, &ColladaParserAutoGen14Private::_preBegin__fixed3, &ColladaParserAutoGen14Private::_preEnd__fixed3, &ColladaParserAutoGen14Private::_freeAttributes__fixed3);
-functionMap[HASH_ELEMENT_FIXED3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x1, &ColladaParserAutoGen14Private::_data__fixed3x1, &ColladaParserAutoGen14Private::_end__fixed3x1, &ColladaParserAutoGen14Private::_preBegin__fixed3x1, &ColladaParserAutoGen14Private::_preEnd__fixed3x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x1);
-functionMap[HASH_ELEMENT_FIXED3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x2, &ColladaParserAutoGen14Private::_data__fixed3x2, &ColladaParserAutoGen14Private::_end__fixed3x2, &ColladaParserAutoGen14Private::_preBegin__fixed3x2, &ColladaParserAutoGen14Private::_preEnd__fixed3x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x2);
-functionMap[HASH_ELEMENT_FIXED3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x3, &ColladaParserAutoGen14Private::_data__fixed3x3, &ColladaParserAutoGen14Private::_end__fixed3x3, &ColladaParserAutoGen14Private::_preBegin__fixed3x3, &ColladaParserAutoGen14Private::_preEnd__fixed3x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x3);
-functionMap[HASH_ELEMENT_FIXED3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed3x4, &ColladaParserAutoGen14Private::_data__fixed3x4, &ColladaParserAutoGen14Private::_end__fixed3x4, &ColladaParserAutoGen14Private::_preBegin__fixed3x4, &ColladaParserAutoGen14Private::_preEnd__fixed3x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed3x4);
-functionMap[HASH_ELEMENT_FIXED4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4, &ColladaParserAutoGen14Private::_data__fixed4, &ColladaParserAutoGen14Private::_end__fixed4, &ColladaParserAutoGen14Private::_preBegin__fixed4, &ColladaParserAutoGen14Private::_preEnd__fixed4, &ColladaParserAutoGen14Private::_freeAttributes__fixed4);
-functionMap[HASH_ELEMENT_FIXED4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x1, &ColladaParserAutoGen14Private::_data__fixed4x1, &ColladaParserAutoGen14Private::_end__fixed4x1, &ColladaParserAutoGen14Private::_preBegin__fixed4x1, &ColladaParserAutoGen14Private::_preEnd__fixed4x1, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x1);
-functionMap[HASH_ELEMENT_FIXED4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x2, &ColladaParserAutoGen14Private::_data__fixed4x2, &ColladaParserAutoGen14Private::_end__fixed4x2, &ColladaParserAutoGen14Private::_preBegin__fixed4x2, &ColladaParserAutoGen14Private::_preEnd__fixed4x2, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x2);
-functionMap[HASH_ELEMENT_FIXED4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x3, &ColladaParserAutoGen14Private::_data__fixed4x3, &ColladaParserAutoGen14Private::_end__fixed4x3, &ColladaParserAutoGen14Private::_preBegin__fixed4x3, &ColladaParserAutoGen14Private::_preEnd__fixed4x3, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x3);
-functionMap[HASH_ELEMENT_FIXED4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fixed4x4, &ColladaParserAutoGen14Private::_data__fixed4x4, &ColladaParserAutoGen14Private::_end__fixed4x4, &ColladaParserAutoGen14Private::_preBegin__fixed4x4, &ColladaParserAutoGen14Private::_preEnd__fixed4x4, &ColladaParserAutoGen14Private::_freeAttributes__fixed4x4);
-functionMap[HASH_ELEMENT_FLOAT____CG_FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____cg_float, &ColladaParserAutoGen14Private::_data__float____cg_float, &ColladaParserAutoGen14Private::_end__float____cg_float, &ColladaParserAutoGen14Private::_preBegin__float____cg_float, &ColladaParserAutoGen14Private::_preEnd__float____cg_float, &ColladaParserAutoGen14Private::_freeAttributes__float____cg_float);
-functionMap[HASH_ELEMENT_FLOAT1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1, &ColladaParserAutoGen14Private::_data__float1, &ColladaParserAutoGen14Private::_end__float1, &ColladaParserAutoGen14Private::_preBegin__float1, &ColladaParserAutoGen14Private::_preEnd__float1, &ColladaParserAutoGen14Private::_freeAttributes__float1);
-functionMap[HASH_ELEMENT_FLOAT1X1____CG_FLOAT1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_data__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_end__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_preBegin__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_preEnd__float1x1____cg_float1x1, &ColladaParserAutoGen14Private::_freeAttributes__float1x1____cg_float1x1);
-functionMap[HASH_ELEMENT_FLOAT1X2____CG_FLOAT1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_data__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_end__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_preBegin__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_preEnd__float1x2____cg_float1x2, &ColladaParserAutoGen14Private::_freeAttributes__float1x2____cg_float1x2);
-functionMap[HASH_ELEMENT_FLOAT1X3____CG_FLOAT1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_data__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_end__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_preBegin__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_preEnd__float1x3____cg_float1x3, &ColladaParserAutoGen14Private::_freeAttributes__float1x3____cg_float1x3);
-functionMap[HASH_ELEMENT_FLOAT1X4____CG_FLOAT1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_data__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_end__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_preBegin__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_preEnd__float1x4____cg_float1x4, &ColladaParserAutoGen14Private::_freeAttributes__float1x4____cg_float1x4);
-functionMap[HASH_ELEMENT_FLOAT2____CG_FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____cg_float2, &ColladaParserAutoGen14Private::_data__float2____cg_float2, &ColladaParserAutoGen14Private::_end__float2____cg_float2, &ColladaParserAutoGen14Private::_preBegin__float2____cg_float2, &ColladaParserAutoGen14Private::_preEnd__float2____cg_float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____cg_float2);
-functionMap[HASH_ELEMENT_FLOAT2X1____CG_FLOAT2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_data__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_end__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_preBegin__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_preEnd__float2x1____cg_float2x1, &ColladaParserAutoGen14Private::_freeAttributes__float2x1____cg_float2x1);
-functionMap[HASH_ELEMENT_FLOAT2X2____CG_FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_data__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_end__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____cg_float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____cg_float2x2);
-functionMap[HASH_ELEMENT_FLOAT2X3____CG_FLOAT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_data__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_end__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_preBegin__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_preEnd__float2x3____cg_float2x3, &ColladaParserAutoGen14Private::_freeAttributes__float2x3____cg_float2x3);
-functionMap[HASH_ELEMENT_FLOAT2X4____CG_FLOAT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_data__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_end__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_preBegin__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_preEnd__float2x4____cg_float2x4, &ColladaParserAutoGen14Private::_freeAttributes__float2x4____cg_float2x4);
-functionMap[HASH_ELEMENT_FLOAT3____CG_FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____cg_float3, &ColladaParserAutoGen14Private::_data__float3____cg_float3, &ColladaParserAutoGen14Private::_end__float3____cg_float3, &ColladaParserAutoGen14Private::_preBegin__float3____cg_float3, &ColladaParserAutoGen14Private::_preEnd__float3____cg_float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____cg_float3);
-functionMap[HASH_ELEMENT_FLOAT3X1____CG_FLOAT3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_data__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_end__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_preBegin__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_preEnd__float3x1____cg_float3x1, &ColladaParserAutoGen14Private::_freeAttributes__float3x1____cg_float3x1);
-functionMap[HASH_ELEMENT_FLOAT3X2____CG_FLOAT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_data__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_end__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_preBegin__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_preEnd__float3x2____cg_float3x2, &ColladaParserAutoGen14Private::_freeAttributes__float3x2____cg_float3x2);
-functionMap[HASH_ELEMENT_FLOAT3X3____CG_FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_data__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_end__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____cg_float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____cg_float3x3);
-functionMap[HASH_ELEMENT_FLOAT3X4____CG_FLOAT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_data__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_end__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_preBegin__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_preEnd__float3x4____cg_float3x4, &ColladaParserAutoGen14Private::_freeAttributes__float3x4____cg_float3x4);
-functionMap[HASH_ELEMENT_FLOAT4____CG_FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____cg_float4, &ColladaParserAutoGen14Private::_data__float4____cg_float4, &ColladaParserAutoGen14Private::_end__float4____cg_float4, &ColladaParserAutoGen14Private::_preBegin__float4____cg_float4, &ColladaParserAutoGen14Private::_preEnd__float4____cg_float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____cg_float4);
-functionMap[HASH_ELEMENT_FLOAT4X1____CG_FLOAT4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_data__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_end__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_preBegin__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_preEnd__float4x1____cg_float4x1, &ColladaParserAutoGen14Private::_freeAttributes__float4x1____cg_float4x1);
-functionMap[HASH_ELEMENT_FLOAT4X2____CG_FLOAT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_data__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_end__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_preBegin__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_preEnd__float4x2____cg_float4x2, &ColladaParserAutoGen14Private::_freeAttributes__float4x2____cg_float4x2);
-functionMap[HASH_ELEMENT_FLOAT4X3____CG_FLOAT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_data__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_end__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_preBegin__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_preEnd__float4x3____cg_float4x3, &ColladaParserAutoGen14Private::_freeAttributes__float4x3____cg_float4x3);
-functionMap[HASH_ELEMENT_FLOAT4X4____CG_FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_data__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_end__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____cg_float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____cg_float4x4);
-functionMap[HASH_ELEMENT_HALF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half, &ColladaParserAutoGen14Private::_data__half, &ColladaParserAutoGen14Private::_end__half, &ColladaParserAutoGen14Private::_preBegin__half, &ColladaParserAutoGen14Private::_preEnd__half, &ColladaParserAutoGen14Private::_freeAttributes__half);
-functionMap[HASH_ELEMENT_HALF1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1, &ColladaParserAutoGen14Private::_data__half1, &ColladaParserAutoGen14Private::_end__half1, &ColladaParserAutoGen14Private::_preBegin__half1, &ColladaParserAutoGen14Private::_preEnd__half1, &ColladaParserAutoGen14Private::_freeAttributes__half1);
-functionMap[HASH_ELEMENT_HALF1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x1, &ColladaParserAutoGen14Private::_data__half1x1, &ColladaParserAutoGen14Private::_end__half1x1, &ColladaParserAutoGen14Private::_preBegin__half1x1, &ColladaParserAutoGen14Private::_preEnd__half1x1, &ColladaParserAutoGen14Private::_freeAttributes__half1x1);
-functionMap[HASH_ELEMENT_HALF1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x2, &ColladaParserAutoGen14Private::_data__half1x2, &ColladaParserAutoGen14Private::_end__half1x2, &ColladaParserAutoGen14Private::_preBegin__half1x2, &ColladaParserAutoGen14Private::_preEnd__half1x2, &ColladaParserAutoGen14Private::_freeAttributes__half1x2);
-functionMap[HASH_ELEMENT_HALF1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x3, &ColladaParserAutoGen14Private::_data__half1x3, &ColladaParserAutoGen14Private::_end__half1x3, &ColladaParserAutoGen14Private::_preBegin__half1x3, &ColladaParserAutoGen14Private::_preEnd__half1x3, &ColladaParserAutoGen14Private::_freeAttributes__half1x3);
-functionMap[HASH_ELEMENT_HALF1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half1x4, &ColladaParserAutoGen14Private::_data__half1x4, &ColladaParserAutoGen14Private::_end__half1x4, &ColladaParserAutoGen14Private::_preBegin__half1x4, &ColladaParserAutoGen14Private::_preEnd__half1x4, &ColladaParserAutoGen14Private::_freeAttributes__half1x4);
-functionMap[HASH_ELEMENT_HALF2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2, &ColladaParserAutoGen14Private::_data__half2, &ColladaParserAutoGen14Private::_end__half2, &ColladaParserAutoGen14Private::_preBegin__half2, &ColladaParserAutoGen14Private::_preEnd__half2, &ColladaParserAutoGen14Private::_freeAttributes__half2);
-functionMap[HASH_ELEMENT_HALF2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x1, &ColladaParserAutoGen14Private::_data__half2x1, &ColladaParserAutoGen14Private::_end__half2x1, &ColladaParserAutoGen14Private::_preBegin__half2x1, &ColladaParserAutoGen14Private::_preEnd__half2x1, &ColladaParserAutoGen14Private::_freeAttributes__half2x1);
-functionMap[HASH_ELEMENT_HALF2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x2, &ColladaParserAutoGen14Private::_data__half2x2, &ColladaParserAutoGen14Private::_end__half2x2, &ColladaParserAutoGen14Private::_preBegin__half2x2, &ColladaParserAutoGen14Private::_preEnd__half2x2, &ColladaParserAutoGen14Private::_freeAttributes__half2x2);
-functionMap[HASH_ELEMENT_HALF2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x3, &ColladaParserAutoGen14Private::_data__half2x3, &ColladaParserAutoGen14Private::_end__half2x3, &ColladaParserAutoGen14Private::_preBegin__half2x3, &ColladaParserAutoGen14Private::_preEnd__half2x3, &ColladaParserAutoGen14Private::_freeAttributes__half2x3);
-functionMap[HASH_ELEMENT_HALF2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half2x4, &ColladaParserAutoGen14Private::_data__half2x4, &ColladaParserAutoGen14Private::_end__half2x4, &ColladaParserAutoGen14Private::_preBegin__half2x4, &ColladaParserAutoGen14Private::_preEnd__half2x4, &ColladaParserAutoGen14Private::_freeAttributes__half2x4);
-functionMap[HASH_ELEMENT_HALF3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3, &ColladaParserAutoGen14Private::_data__half3, &ColladaParserAutoGen14Private::_end__half3, &ColladaParserAutoGen14Private::_preBegin__half3, &ColladaParserAutoGen14Private::_preEnd__half3, &ColladaParserAutoGen14Private::_freeAttributes__half3);
-functionMap[HASH_ELEMENT_HALF3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x1, &ColladaParserAutoGen14Private::_data__half3x1, &ColladaParserAutoGen14Private::_end__half3x1, &ColladaParserAutoGen14Private::_preBegin__half3x1, &ColladaParserAutoGen14Private::_preEnd__half3x1, &ColladaParserAutoGen14Private::_freeAttributes__half3x1);
-functionMap[HASH_ELEMENT_HALF3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x2, &ColladaParserAutoGen14Private::_data__half3x2, &ColladaParserAutoGen14Private::_end__half3x2, &ColladaParserAutoGen14Private::_preBegin__half3x2, &ColladaParserAutoGen14Private::_preEnd__half3x2, &ColladaParserAutoGen14Private::_freeAttributes__half3x2);
-functionMap[HASH_ELEMENT_HALF3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x3, &ColladaParserAutoGen14Private::_data__half3x3, &ColladaParserAutoGen14Private::_end__half3x3, &ColladaParserAutoGen14Private::_preBegin__half3x3, &ColladaParserAutoGen14Private::_preEnd__half3x3, &ColladaParserAutoGen14Private::_freeAttributes__half3x3);
-functionMap[HASH_ELEMENT_HALF3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half3x4, &ColladaParserAutoGen14Private::_data__half3x4, &ColladaParserAutoGen14Private::_end__half3x4, &ColladaParserAutoGen14Private::_preBegin__half3x4, &ColladaParserAutoGen14Private::_preEnd__half3x4, &ColladaParserAutoGen14Private::_freeAttributes__half3x4);
-functionMap[HASH_ELEMENT_HALF4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4, &ColladaParserAutoGen14Private::_data__half4, &ColladaParserAutoGen14Private::_end__half4, &ColladaParserAutoGen14Private::_preBegin__half4, &ColladaParserAutoGen14Private::_preEnd__half4, &ColladaParserAutoGen14Private::_freeAttributes__half4);
-functionMap[HASH_ELEMENT_HALF4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x1, &ColladaParserAutoGen14Private::_data__half4x1, &ColladaParserAutoGen14Private::_end__half4x1, &ColladaParserAutoGen14Private::_preBegin__half4x1, &ColladaParserAutoGen14Private::_preEnd__half4x1, &ColladaParserAutoGen14Private::_freeAttributes__half4x1);
-functionMap[HASH_ELEMENT_HALF4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x2, &ColladaParserAutoGen14Private::_data__half4x2, &ColladaParserAutoGen14Private::_end__half4x2, &ColladaParserAutoGen14Private::_preBegin__half4x2, &ColladaParserAutoGen14Private::_preEnd__half4x2, &ColladaParserAutoGen14Private::_freeAttributes__half4x2);
-functionMap[HASH_ELEMENT_HALF4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x3, &ColladaParserAutoGen14Private::_data__half4x3, &ColladaParserAutoGen14Private::_end__half4x3, &ColladaParserAutoGen14Private::_preBegin__half4x3, &ColladaParserAutoGen14Private::_preEnd__half4x3, &ColladaParserAutoGen14Private::_freeAttributes__half4x3);
-functionMap[HASH_ELEMENT_HALF4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half4x4, &ColladaParserAutoGen14Private::_data__half4x4, &ColladaParserAutoGen14Private::_end__half4x4, &ColladaParserAutoGen14Private::_preBegin__half4x4, &ColladaParserAutoGen14Private::_preEnd__half4x4, &ColladaParserAutoGen14Private::_freeAttributes__half4x4);
-functionMap[HASH_ELEMENT_INT____CG_INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____cg_int, &ColladaParserAutoGen14Private::_data__int____cg_int, &ColladaParserAutoGen14Private::_end__int____cg_int, &ColladaParserAutoGen14Private::_preBegin__int____cg_int, &ColladaParserAutoGen14Private::_preEnd__int____cg_int, &ColladaParserAutoGen14Private::_freeAttributes__int____cg_int);
-functionMap[HASH_ELEMENT_INT1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1, &ColladaParserAutoGen14Private::_data__int1, &ColladaParserAutoGen14Private::_end__int1, &ColladaParserAutoGen14Private::_preBegin__int1, &ColladaParserAutoGen14Private::_preEnd__int1, &ColladaParserAutoGen14Private::_freeAttributes__int1);
-functionMap[HASH_ELEMENT_INT1X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x1, &ColladaParserAutoGen14Private::_data__int1x1, &ColladaParserAutoGen14Private::_end__int1x1, &ColladaParserAutoGen14Private::_preBegin__int1x1, &ColladaParserAutoGen14Private::_preEnd__int1x1, &ColladaParserAutoGen14Private::_freeAttributes__int1x1);
-functionMap[HASH_ELEMENT_INT1X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x2, &ColladaParserAutoGen14Private::_data__int1x2, &ColladaParserAutoGen14Private::_end__int1x2, &ColladaParserAutoGen14Private::_preBegin__int1x2, &ColladaParserAutoGen14Private::_preEnd__int1x2, &ColladaParserAutoGen14Private::_freeAttributes__int1x2);
-functionMap[HASH_ELEMENT_INT1X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x3, &ColladaParserAutoGen14Private::_data__int1x3, &ColladaParserAutoGen14Private::_end__int1x3, &ColladaParserAutoGen14Private::_preBegin__int1x3, &ColladaParserAutoGen14Private::_preEnd__int1x3, &ColladaParserAutoGen14Private::_freeAttributes__int1x3);
-functionMap[HASH_ELEMENT_INT1X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int1x4, &ColladaParserAutoGen14Private::_data__int1x4, &ColladaParserAutoGen14Private::_end__int1x4, &ColladaParserAutoGen14Private::_preBegin__int1x4, &ColladaParserAutoGen14Private::_preEnd__int1x4, &ColladaParserAutoGen14Private::_freeAttributes__int1x4);
-functionMap[HASH_ELEMENT_INT2____CG_INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____cg_int2, &ColladaParserAutoGen14Private::_data__int2____cg_int2, &ColladaParserAutoGen14Private::_end__int2____cg_int2, &ColladaParserAutoGen14Private::_preBegin__int2____cg_int2, &ColladaParserAutoGen14Private::_preEnd__int2____cg_int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____cg_int2);
-functionMap[HASH_ELEMENT_INT2X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x1, &ColladaParserAutoGen14Private::_data__int2x1, &ColladaParserAutoGen14Private::_end__int2x1, &ColladaParserAutoGen14Private::_preBegin__int2x1, &ColladaParserAutoGen14Private::_preEnd__int2x1, &ColladaParserAutoGen14Private::_freeAttributes__int2x1);
-functionMap[HASH_ELEMENT_INT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x2, &ColladaParserAutoGen14Private::_data__int2x2, &ColladaParserAutoGen14Private::_end__int2x2, &ColladaParserAutoGen14Private::_preBegin__int2x2, &ColladaParserAutoGen14Private::_preEnd__int2x2, &ColladaParserAutoGen14Private::_freeAttributes__int2x2);
-functionMap[HASH_ELEMENT_INT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x3, &ColladaParserAutoGen14Private::_data__int2x3, &ColladaParserAutoGen14Private::_end__int2x3, &ColladaParserAutoGen14Private::_preBegin__int2x3, &ColladaParserAutoGen14Private::_preEnd__int2x3, &ColladaParserAutoGen14Private::_freeAttributes__int2x3);
-functionMap[HASH_ELEMENT_INT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2x4, &ColladaParserAutoGen14Private::_data__int2x4, &ColladaParserAutoGen14Private::_end__int2x4, &ColladaParserAutoGen14Private::_preBegin__int2x4, &ColladaParserAutoGen14Private::_preEnd__int2x4, &ColladaParserAutoGen14Private::_freeAttributes__int2x4);
-functionMap[HASH_ELEMENT_INT3____CG_INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____cg_int3, &ColladaParserAutoGen14Private::_data__int3____cg_int3, &ColladaParserAutoGen14Private::_end__int3____cg_int3, &ColladaParserAutoGen14Private::_preBegin__int3____cg_int3, &ColladaParserAutoGen14Private::_preEnd__int3____cg_int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____cg_int3);
-functionMap[HASH_ELEMENT_INT3X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x1, &ColladaParserAutoGen14Private::_data__int3x1, &ColladaParserAutoGen14Private::_end__int3x1, &ColladaParserAutoGen14Private::_preBegin__int3x1, &ColladaParserAutoGen14Private::_preEnd__int3x1, &ColladaParserAutoGen14Private::_freeAttributes__int3x1);
-functionMap[HASH_ELEMENT_INT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x2, &ColladaParserAutoGen14Private::_data__int3x2, &ColladaParserAutoGen14Private::_end__int3x2, &ColladaParserAutoGen14Private::_preBegin__int3x2, &ColladaParserAutoGen14Private::_preEnd__int3x2, &ColladaParserAutoGen14Private::_freeAttributes__int3x2);
-functionMap[HASH_ELEMENT_INT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x3, &ColladaParserAutoGen14Private::_data__int3x3, &ColladaParserAutoGen14Private::_end__int3x3, &ColladaParserAutoGen14Private::_preBegin__int3x3, &ColladaParserAutoGen14Private::_preEnd__int3x3, &ColladaParserAutoGen14Private::_freeAttributes__int3x3);
-functionMap[HASH_ELEMENT_INT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3x4, &ColladaParserAutoGen14Private::_data__int3x4, &ColladaParserAutoGen14Private::_end__int3x4, &ColladaParserAutoGen14Private::_preBegin__int3x4, &ColladaParserAutoGen14Private::_preEnd__int3x4, &ColladaParserAutoGen14Private::_freeAttributes__int3x4);
-functionMap[HASH_ELEMENT_INT4____CG_INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____cg_int4, &ColladaParserAutoGen14Private::_data__int4____cg_int4, &ColladaParserAutoGen14Private::_end__int4____cg_int4, &ColladaParserAutoGen14Private::_preBegin__int4____cg_int4, &ColladaParserAutoGen14Private::_preEnd__int4____cg_int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____cg_int4);
-functionMap[HASH_ELEMENT_INT4X1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x1, &ColladaParserAutoGen14Private::_data__int4x1, &ColladaParserAutoGen14Private::_end__int4x1, &ColladaParserAutoGen14Private::_preBegin__int4x1, &ColladaParserAutoGen14Private::_preEnd__int4x1, &ColladaParserAutoGen14Private::_freeAttributes__int4x1);
-functionMap[HASH_ELEMENT_INT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x2, &ColladaParserAutoGen14Private::_data__int4x2, &ColladaParserAutoGen14Private::_end__int4x2, &ColladaParserAutoGen14Private::_preBegin__int4x2, &ColladaParserAutoGen14Private::_preEnd__int4x2, &ColladaParserAutoGen14Private::_freeAttributes__int4x2);
-functionMap[HASH_ELEMENT_INT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x3, &ColladaParserAutoGen14Private::_data__int4x3, &ColladaParserAutoGen14Private::_end__int4x3, &ColladaParserAutoGen14Private::_preBegin__int4x3, &ColladaParserAutoGen14Private::_preEnd__int4x3, &ColladaParserAutoGen14Private::_freeAttributes__int4x3);
-functionMap[HASH_ELEMENT_INT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4x4, &ColladaParserAutoGen14Private::_data__int4x4, &ColladaParserAutoGen14Private::_end__int4x4, &ColladaParserAutoGen14Private::_preBegin__int4x4, &ColladaParserAutoGen14Private::_preEnd__int4x4, &ColladaParserAutoGen14Private::_freeAttributes__int4x4);
-functionMap[HASH_ELEMENT_SAMPLER1D____CG_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_data__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_end__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_preBegin__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_preEnd__sampler1D____cg_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____cg_sampler1D);
-functionMap[HASH_ELEMENT_SAMPLER2D____CG_SAMPLER2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_data__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_end__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_preBegin__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_preEnd__sampler2D____cg_sampler2D, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____cg_sampler2D);
-functionMap[HASH_ELEMENT_SAMPLER3D____CG_SAMPLER3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_data__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_end__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_preBegin__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_preEnd__sampler3D____cg_sampler3D, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____cg_sampler3D);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____CG_SAMPLERCUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_data__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_end__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____cg_samplerCUBE, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____cg_samplerCUBE);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____CG_SAMPLERDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_data__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_end__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____cg_samplerDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____cg_samplerDEPTH);
-functionMap[HASH_ELEMENT_SAMPLERRECT____CG_SAMPLERRECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_data__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_end__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____cg_samplerRECT, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____cg_samplerRECT);
-functionMap[HASH_ELEMENT_STRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__string, &ColladaParserAutoGen14Private::_data__string, &ColladaParserAutoGen14Private::_end__string, &ColladaParserAutoGen14Private::_preBegin__string, &ColladaParserAutoGen14Private::_preEnd__string, &ColladaParserAutoGen14Private::_freeAttributes__string);
-functionMap[HASH_ELEMENT_SURFACE____CG_SURFACE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____cg_surface_type, &ColladaParserAutoGen14Private::_data__surface____cg_surface_type, &ColladaParserAutoGen14Private::_end__surface____cg_surface_type, &ColladaParserAutoGen14Private::_preBegin__surface____cg_surface_type, &ColladaParserAutoGen14Private::_preEnd__surface____cg_surface_type, &ColladaParserAutoGen14Private::_freeAttributes__surface____cg_surface_type);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_CG_SURFACE_TYPE____GENERATOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__cg_surface_type____generator, &ColladaParserAutoGen14Private::_data__cg_surface_type____generator, &ColladaParserAutoGen14Private::_end__cg_surface_type____generator, &ColladaParserAutoGen14Private::_preBegin__cg_surface_type____generator, &ColladaParserAutoGen14Private::_preEnd__cg_surface_type____generator, &ColladaParserAutoGen14Private::_freeAttributes__cg_surface_type____generator);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_CODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__code, &ColladaParserAutoGen14Private::_data__code, &ColladaParserAutoGen14Private::_end__code, &ColladaParserAutoGen14Private::_preBegin__code, &ColladaParserAutoGen14Private::_preEnd__code, &ColladaParserAutoGen14Private::_freeAttributes__code);
-functionMap[HASH_ELEMENT_INCLUDE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__include, &ColladaParserAutoGen14Private::_data__include, &ColladaParserAutoGen14Private::_end__include, &ColladaParserAutoGen14Private::_preBegin__include, &ColladaParserAutoGen14Private::_preEnd__include, &ColladaParserAutoGen14Private::_freeAttributes__include);
-functionMap[HASH_ELEMENT_PROFILE_CG__NEWPARAM__SURFACE__GENERATOR__NAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_data__profile_CG__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_end__profile_CG__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_preBegin__profile_CG__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_preEnd__profile_CG__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__newparam__surface__generator__name);
-functionMap[HASH_ELEMENT_SETPARAM____CG_SETPARAM_SIMPLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__setparam____cg_setparam_simple, &ColladaParserAutoGen14Private::_data__setparam____cg_setparam_simple, &ColladaParserAutoGen14Private::_end__setparam____cg_setparam_simple, &ColladaParserAutoGen14Private::_preBegin__setparam____cg_setparam_simple, &ColladaParserAutoGen14Private::_preEnd__setparam____cg_setparam_simple, &ColladaParserAutoGen14Private::_freeAttributes__setparam____cg_setparam_simple);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_ARRAY____CG_SETARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____cg_setarray_type, &ColladaParserAutoGen14Private::_data__array____cg_setarray_type, &ColladaParserAutoGen14Private::_end__array____cg_setarray_type, &ColladaParserAutoGen14Private::_preBegin__array____cg_setarray_type, &ColladaParserAutoGen14Private::_preEnd__array____cg_setarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____cg_setarray_type);
-functionMap[HASH_ELEMENT_CONNECT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__connect_param, &ColladaParserAutoGen14Private::_data__connect_param, &ColladaParserAutoGen14Private::_end__connect_param, &ColladaParserAutoGen14Private::_preBegin__connect_param, &ColladaParserAutoGen14Private::_preEnd__connect_param, &ColladaParserAutoGen14Private::_freeAttributes__connect_param);
-functionMap[HASH_ELEMENT_SETPARAM____CG_SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__setparam____cg_setparam, &ColladaParserAutoGen14Private::_data__setparam____cg_setparam, &ColladaParserAutoGen14Private::_end__setparam____cg_setparam, &ColladaParserAutoGen14Private::_preBegin__setparam____cg_setparam, &ColladaParserAutoGen14Private::_preEnd__setparam____cg_setparam, &ColladaParserAutoGen14Private::_freeAttributes__setparam____cg_setparam);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_ARRAY____CG_SETARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____cg_setarray_type, &ColladaParserAutoGen14Private::_data__array____cg_setarray_type, &ColladaParserAutoGen14Private::_end__array____cg_setarray_type, &ColladaParserAutoGen14Private::_preBegin__array____cg_setarray_type, &ColladaParserAutoGen14Private::_preEnd__array____cg_setarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____cg_setarray_type);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_CONNECT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__connect_param, &ColladaParserAutoGen14Private::_data__connect_param, &ColladaParserAutoGen14Private::_end__connect_param, &ColladaParserAutoGen14Private::_preBegin__connect_param, &ColladaParserAutoGen14Private::_preEnd__connect_param, &ColladaParserAutoGen14Private::_freeAttributes__connect_param);
-functionMap[HASH_ELEMENT_SETPARAM____CG_SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__setparam____cg_setparam, &ColladaParserAutoGen14Private::_data__setparam____cg_setparam, &ColladaParserAutoGen14Private::_end__setparam____cg_setparam, &ColladaParserAutoGen14Private::_preBegin__setparam____cg_setparam, &ColladaParserAutoGen14Private::_preEnd__setparam____cg_setparam, &ColladaParserAutoGen14Private::_freeAttributes__setparam____cg_setparam);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_ARRAY____CG_SETARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____cg_setarray_type, &ColladaParserAutoGen14Private::_data__array____cg_setarray_type, &ColladaParserAutoGen14Private::_end__array____cg_setarray_type, &ColladaParserAutoGen14Private::_preBegin__array____cg_setarray_type, &ColladaParserAutoGen14Private::_preEnd__array____cg_setarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____cg_setarray_type);
-functionMap[HASH_ELEMENT_CONNECT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__connect_param, &ColladaParserAutoGen14Private::_data__connect_param, &ColladaParserAutoGen14Private::_end__connect_param, &ColladaParserAutoGen14Private::_preBegin__connect_param, &ColladaParserAutoGen14Private::_preEnd__connect_param, &ColladaParserAutoGen14Private::_freeAttributes__connect_param);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_USERTYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__usertype, &ColladaParserAutoGen14Private::_data__usertype, &ColladaParserAutoGen14Private::_end__usertype, &ColladaParserAutoGen14Private::_preBegin__usertype, &ColladaParserAutoGen14Private::_preEnd__usertype, &ColladaParserAutoGen14Private::_freeAttributes__usertype);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_CODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__code, &ColladaParserAutoGen14Private::_data__code, &ColladaParserAutoGen14Private::_end__code, &ColladaParserAutoGen14Private::_preBegin__code, &ColladaParserAutoGen14Private::_preEnd__code, &ColladaParserAutoGen14Private::_freeAttributes__code);
-functionMap[HASH_ELEMENT_INCLUDE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__include, &ColladaParserAutoGen14Private::_data__include, &ColladaParserAutoGen14Private::_end__include, &ColladaParserAutoGen14Private::_preBegin__include, &ColladaParserAutoGen14Private::_preEnd__include, &ColladaParserAutoGen14Private::_freeAttributes__include);
-functionMap[HASH_ELEMENT_NEWPARAM____CG_NEWPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____cg_newparam, &ColladaParserAutoGen14Private::_data__newparam____cg_newparam, &ColladaParserAutoGen14Private::_end__newparam____cg_newparam, &ColladaParserAutoGen14Private::_preBegin__newparam____cg_newparam, &ColladaParserAutoGen14Private::_preEnd__newparam____cg_newparam, &ColladaParserAutoGen14Private::_freeAttributes__newparam____cg_newparam);
-functionMap[HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__technique__pass, &ColladaParserAutoGen14Private::_data__profile_CG__technique__pass, &ColladaParserAutoGen14Private::_end__profile_CG__technique__pass, &ColladaParserAutoGen14Private::_preBegin__profile_CG__technique__pass, &ColladaParserAutoGen14Private::_preEnd__profile_CG__technique__pass, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__technique__pass);
-functionMap[HASH_ELEMENT_SETPARAM____CG_SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__setparam____cg_setparam, &ColladaParserAutoGen14Private::_data__setparam____cg_setparam, &ColladaParserAutoGen14Private::_end__setparam____cg_setparam, &ColladaParserAutoGen14Private::_preBegin__setparam____cg_setparam, &ColladaParserAutoGen14Private::_preEnd__setparam____cg_setparam, &ColladaParserAutoGen14Private::_freeAttributes__setparam____cg_setparam);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__alpha_func);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__alpha_test_enable);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_AUTO_NORMAL_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__auto_normal_enable, &ColladaParserAutoGen14Private::_data__auto_normal_enable, &ColladaParserAutoGen14Private::_end__auto_normal_enable, &ColladaParserAutoGen14Private::_preBegin__auto_normal_enable, &ColladaParserAutoGen14Private::_preEnd__auto_normal_enable, &ColladaParserAutoGen14Private::_freeAttributes__auto_normal_enable);
-functionMap[HASH_ELEMENT_BLEND_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__blend_color, &ColladaParserAutoGen14Private::_data__blend_color, &ColladaParserAutoGen14Private::_end__blend_color, &ColladaParserAutoGen14Private::_preBegin__blend_color, &ColladaParserAutoGen14Private::_preEnd__blend_color, &ColladaParserAutoGen14Private::_freeAttributes__blend_color);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__blend_enable);
-functionMap[HASH_ELEMENT_BLEND_EQUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__blend_equation, &ColladaParserAutoGen14Private::_data__blend_equation, &ColladaParserAutoGen14Private::_end__blend_equation, &ColladaParserAutoGen14Private::_preBegin__blend_equation, &ColladaParserAutoGen14Private::_preEnd__blend_equation, &ColladaParserAutoGen14Private::_freeAttributes__blend_equation);
-functionMap[HASH_ELEMENT_BLEND_EQUATION_SEPARATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__blend_equation_separate, &ColladaParserAutoGen14Private::_data__blend_equation_separate, &ColladaParserAutoGen14Private::_end__blend_equation_separate, &ColladaParserAutoGen14Private::_preBegin__blend_equation_separate, &ColladaParserAutoGen14Private::_preEnd__blend_equation_separate, &ColladaParserAutoGen14Private::_freeAttributes__blend_equation_separate);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__blend_func, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__blend_func, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__blend_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__blend_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__blend_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__blend_func);
-functionMap[HASH_ELEMENT_BLEND_FUNC_SEPARATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__blend_func_separate, &ColladaParserAutoGen14Private::_data__blend_func_separate, &ColladaParserAutoGen14Private::_end__blend_func_separate, &ColladaParserAutoGen14Private::_preBegin__blend_func_separate, &ColladaParserAutoGen14Private::_preEnd__blend_func_separate, &ColladaParserAutoGen14Private::_freeAttributes__blend_func_separate);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLEAR_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__clear_color, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__clear_color, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__clear_color, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__clear_color, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__clear_color, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__clear_color);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLEAR_DEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__clear_depth);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLEAR_STENCIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__clear_stencil);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLIP_PLANE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__clip_plane);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLIP_PLANE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__clip_plane_enable);
-functionMap[HASH_ELEMENT_COLOR_CLEAR____FX_CLEARCOLOR_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_data__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_end__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_preBegin__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_preEnd__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_freeAttributes__color_clear____fx_clearcolor_common);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__COLOR_LOGIC_OP_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__color_logic_op_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__COLOR_MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__color_mask, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__color_mask, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__color_mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__color_mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__color_mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__color_mask);
-functionMap[HASH_ELEMENT_COLOR_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_material, &ColladaParserAutoGen14Private::_data__color_material, &ColladaParserAutoGen14Private::_end__color_material, &ColladaParserAutoGen14Private::_preBegin__color_material, &ColladaParserAutoGen14Private::_preEnd__color_material, &ColladaParserAutoGen14Private::_freeAttributes__color_material);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__COLOR_MATERIAL_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__color_material_enable);
-functionMap[HASH_ELEMENT_COLOR_TARGET____FX_COLORTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_data__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_end__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_preBegin__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_preEnd__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_freeAttributes__color_target____fx_colortarget_common);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CULL_FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__cull_face, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__cull_face, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__cull_face, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__cull_face, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__cull_face, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__cull_face);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CULL_FACE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__cull_face_enable);
-functionMap[HASH_ELEMENT_DEPTH_BOUNDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_bounds, &ColladaParserAutoGen14Private::_data__depth_bounds, &ColladaParserAutoGen14Private::_end__depth_bounds, &ColladaParserAutoGen14Private::_preBegin__depth_bounds, &ColladaParserAutoGen14Private::_preEnd__depth_bounds, &ColladaParserAutoGen14Private::_freeAttributes__depth_bounds);
-functionMap[HASH_ELEMENT_DEPTH_BOUNDS_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_bounds_enable, &ColladaParserAutoGen14Private::_data__depth_bounds_enable, &ColladaParserAutoGen14Private::_end__depth_bounds_enable, &ColladaParserAutoGen14Private::_preBegin__depth_bounds_enable, &ColladaParserAutoGen14Private::_preEnd__depth_bounds_enable, &ColladaParserAutoGen14Private::_freeAttributes__depth_bounds_enable);
-functionMap[HASH_ELEMENT_DEPTH_CLAMP_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_clamp_enable, &ColladaParserAutoGen14Private::_data__depth_clamp_enable, &ColladaParserAutoGen14Private::_end__depth_clamp_enable, &ColladaParserAutoGen14Private::_preBegin__depth_clamp_enable, &ColladaParserAutoGen14Private::_preEnd__depth_clamp_enable, &ColladaParserAutoGen14Private::_freeAttributes__depth_clamp_enable);
-functionMap[HASH_ELEMENT_DEPTH_CLEAR____FX_CLEARDEPTH_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_data__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_end__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_preBegin__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_preEnd__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_freeAttributes__depth_clear____fx_cleardepth_common);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__depth_func, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__depth_func, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__depth_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__depth_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__depth_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__depth_func);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__depth_mask);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_RANGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__depth_range, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__depth_range, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__depth_range, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__depth_range, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__depth_range, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__depth_range);
-functionMap[HASH_ELEMENT_DEPTH_TARGET____FX_DEPTHTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_data__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_end__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_preBegin__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_preEnd__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_freeAttributes__depth_target____fx_depthtarget_common);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__depth_test_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DITHER_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__dither_enable);
-functionMap[HASH_ELEMENT_DRAW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__draw, &ColladaParserAutoGen14Private::_data__draw, &ColladaParserAutoGen14Private::_end__draw, &ColladaParserAutoGen14Private::_preBegin__draw, &ColladaParserAutoGen14Private::_preEnd__draw, &ColladaParserAutoGen14Private::_freeAttributes__draw);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__fog_color, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__fog_color, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__fog_color, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__fog_color, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__fog_color, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__fog_color);
-functionMap[HASH_ELEMENT_FOG_COORD_SRC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fog_coord_src, &ColladaParserAutoGen14Private::_data__fog_coord_src, &ColladaParserAutoGen14Private::_end__fog_coord_src, &ColladaParserAutoGen14Private::_preBegin__fog_coord_src, &ColladaParserAutoGen14Private::_preEnd__fog_coord_src, &ColladaParserAutoGen14Private::_freeAttributes__fog_coord_src);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_DENSITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__fog_density, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__fog_density, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__fog_density, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__fog_density, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__fog_density, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__fog_density);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__fog_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_END] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__fog_end, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__fog_end, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__fog_end, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__fog_end, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__fog_end, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__fog_end);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_MODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__fog_mode);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_START] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__fog_start, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__fog_start, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__fog_start, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__fog_start, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__fog_start, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__fog_start);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FRONT_FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__front_face, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__front_face, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__front_face, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__front_face, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__front_face, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__front_face);
-functionMap[HASH_ELEMENT_GL_HOOK_ABSTRACT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__gl_hook_abstract, &ColladaParserAutoGen14Private::_data__gl_hook_abstract, &ColladaParserAutoGen14Private::_end__gl_hook_abstract, &ColladaParserAutoGen14Private::_preBegin__gl_hook_abstract, &ColladaParserAutoGen14Private::_preEnd__gl_hook_abstract, &ColladaParserAutoGen14Private::_freeAttributes__gl_hook_abstract);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_AMBIENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_ambient);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_CONSTANT_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_constant_attenuation);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_diffuse);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_enable);
-functionMap[HASH_ELEMENT_LIGHT_LINEAR_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light_linear_attenuation, &ColladaParserAutoGen14Private::_data__light_linear_attenuation, &ColladaParserAutoGen14Private::_end__light_linear_attenuation, &ColladaParserAutoGen14Private::_preBegin__light_linear_attenuation, &ColladaParserAutoGen14Private::_preEnd__light_linear_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__light_linear_attenuation);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_MODEL_AMBIENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_model_ambient);
-functionMap[HASH_ELEMENT_LIGHT_MODEL_COLOR_CONTROL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light_model_color_control, &ColladaParserAutoGen14Private::_data__light_model_color_control, &ColladaParserAutoGen14Private::_end__light_model_color_control, &ColladaParserAutoGen14Private::_preBegin__light_model_color_control, &ColladaParserAutoGen14Private::_preEnd__light_model_color_control, &ColladaParserAutoGen14Private::_freeAttributes__light_model_color_control);
-functionMap[HASH_ELEMENT_LIGHT_MODEL_LOCAL_VIEWER_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light_model_local_viewer_enable, &ColladaParserAutoGen14Private::_data__light_model_local_viewer_enable, &ColladaParserAutoGen14Private::_end__light_model_local_viewer_enable, &ColladaParserAutoGen14Private::_preBegin__light_model_local_viewer_enable, &ColladaParserAutoGen14Private::_preEnd__light_model_local_viewer_enable, &ColladaParserAutoGen14Private::_freeAttributes__light_model_local_viewer_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_MODEL_TWO_SIDE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_model_two_side_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_POSITION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_position, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_position, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_position, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_position, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_position, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_position);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_QUADRATIC_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_quadratic_attenuation);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPECULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_specular, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_specular, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_specular, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_specular, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_specular, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_specular);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPOT_CUTOFF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_spot_cutoff);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPOT_DIRECTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_spot_direction);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPOT_EXPONENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__light_spot_exponent);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHTING_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__lighting_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LINE_SMOOTH_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__line_smooth_enable);
-functionMap[HASH_ELEMENT_LINE_STIPPLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__line_stipple, &ColladaParserAutoGen14Private::_data__line_stipple, &ColladaParserAutoGen14Private::_end__line_stipple, &ColladaParserAutoGen14Private::_preBegin__line_stipple, &ColladaParserAutoGen14Private::_preEnd__line_stipple, &ColladaParserAutoGen14Private::_freeAttributes__line_stipple);
-functionMap[HASH_ELEMENT_LINE_STIPPLE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__line_stipple_enable, &ColladaParserAutoGen14Private::_data__line_stipple_enable, &ColladaParserAutoGen14Private::_end__line_stipple_enable, &ColladaParserAutoGen14Private::_preBegin__line_stipple_enable, &ColladaParserAutoGen14Private::_preEnd__line_stipple_enable, &ColladaParserAutoGen14Private::_freeAttributes__line_stipple_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LINE_WIDTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__line_width, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__line_width, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__line_width, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__line_width, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__line_width, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__line_width);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LOGIC_OP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__logic_op, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__logic_op, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__logic_op, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__logic_op, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__logic_op, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__logic_op);
-functionMap[HASH_ELEMENT_LOGIC_OP_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__logic_op_enable, &ColladaParserAutoGen14Private::_data__logic_op_enable, &ColladaParserAutoGen14Private::_end__logic_op_enable, &ColladaParserAutoGen14Private::_preBegin__logic_op_enable, &ColladaParserAutoGen14Private::_preEnd__logic_op_enable, &ColladaParserAutoGen14Private::_freeAttributes__logic_op_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_AMBIENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__material_ambient);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__material_diffuse);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_EMISSION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__material_emission, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__material_emission, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__material_emission, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__material_emission, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__material_emission, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__material_emission);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_SHININESS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__material_shininess);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_SPECULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__material_specular, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__material_specular, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__material_specular, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__material_specular, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__material_specular, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__material_specular);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MODEL_VIEW_MATRIX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__model_view_matrix);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MULTISAMPLE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__multisample_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__NORMALIZE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__normalize_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_DISTANCE_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__point_distance_attenuation);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_FADE_THRESHOLD_SIZE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__point_fade_threshold_size);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SIZE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__point_size, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__point_size, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__point_size, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__point_size, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__point_size, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__point_size);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SIZE_MAX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__point_size_max);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SIZE_MIN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__point_size_min);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SMOOTH_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__point_smooth_enable);
-functionMap[HASH_ELEMENT_POLYGON_MODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygon_mode, &ColladaParserAutoGen14Private::_data__polygon_mode, &ColladaParserAutoGen14Private::_end__polygon_mode, &ColladaParserAutoGen14Private::_preBegin__polygon_mode, &ColladaParserAutoGen14Private::_preEnd__polygon_mode, &ColladaParserAutoGen14Private::_freeAttributes__polygon_mode);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POLYGON_OFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__polygon_offset);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POLYGON_OFFSET_FILL_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__polygon_offset_fill_enable);
-functionMap[HASH_ELEMENT_POLYGON_OFFSET_LINE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygon_offset_line_enable, &ColladaParserAutoGen14Private::_data__polygon_offset_line_enable, &ColladaParserAutoGen14Private::_end__polygon_offset_line_enable, &ColladaParserAutoGen14Private::_preBegin__polygon_offset_line_enable, &ColladaParserAutoGen14Private::_preEnd__polygon_offset_line_enable, &ColladaParserAutoGen14Private::_freeAttributes__polygon_offset_line_enable);
-functionMap[HASH_ELEMENT_POLYGON_OFFSET_POINT_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygon_offset_point_enable, &ColladaParserAutoGen14Private::_data__polygon_offset_point_enable, &ColladaParserAutoGen14Private::_end__polygon_offset_point_enable, &ColladaParserAutoGen14Private::_preBegin__polygon_offset_point_enable, &ColladaParserAutoGen14Private::_preEnd__polygon_offset_point_enable, &ColladaParserAutoGen14Private::_freeAttributes__polygon_offset_point_enable);
-functionMap[HASH_ELEMENT_POLYGON_SMOOTH_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygon_smooth_enable, &ColladaParserAutoGen14Private::_data__polygon_smooth_enable, &ColladaParserAutoGen14Private::_end__polygon_smooth_enable, &ColladaParserAutoGen14Private::_preBegin__polygon_smooth_enable, &ColladaParserAutoGen14Private::_preEnd__polygon_smooth_enable, &ColladaParserAutoGen14Private::_freeAttributes__polygon_smooth_enable);
-functionMap[HASH_ELEMENT_POLYGON_STIPPLE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygon_stipple_enable, &ColladaParserAutoGen14Private::_data__polygon_stipple_enable, &ColladaParserAutoGen14Private::_end__polygon_stipple_enable, &ColladaParserAutoGen14Private::_preBegin__polygon_stipple_enable, &ColladaParserAutoGen14Private::_preEnd__polygon_stipple_enable, &ColladaParserAutoGen14Private::_freeAttributes__polygon_stipple_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__PROJECTION_MATRIX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__projection_matrix);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__RESCALE_NORMAL_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__rescale_normal_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_COVERAGE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__sample_alpha_to_coverage_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_ONE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__sample_alpha_to_one_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SAMPLE_COVERAGE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__sample_coverage_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SCISSOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__scissor, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__scissor, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__scissor, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__scissor, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__scissor, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__scissor);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SCISSOR_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__scissor_test_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADE_MODEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shade_model, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shade_model, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shade_model, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shade_model, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shade_model, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shade_model);
-functionMap[HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__technique__pass__shader, &ColladaParserAutoGen14Private::_data__profile_CG__technique__pass__shader, &ColladaParserAutoGen14Private::_end__profile_CG__technique__pass__shader, &ColladaParserAutoGen14Private::_preBegin__profile_CG__technique__pass__shader, &ColladaParserAutoGen14Private::_preEnd__profile_CG__technique__pass__shader, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__technique__pass__shader);
-functionMap[HASH_ELEMENT_STENCIL_CLEAR____FX_CLEARSTENCIL_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_data__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_end__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_preBegin__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_preEnd__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_freeAttributes__stencil_clear____fx_clearstencil_common);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_func);
-functionMap[HASH_ELEMENT_STENCIL_FUNC_SEPARATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_func_separate, &ColladaParserAutoGen14Private::_data__stencil_func_separate, &ColladaParserAutoGen14Private::_end__stencil_func_separate, &ColladaParserAutoGen14Private::_preBegin__stencil_func_separate, &ColladaParserAutoGen14Private::_preEnd__stencil_func_separate, &ColladaParserAutoGen14Private::_freeAttributes__stencil_func_separate);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_mask);
-functionMap[HASH_ELEMENT_STENCIL_MASK_SEPARATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_mask_separate, &ColladaParserAutoGen14Private::_data__stencil_mask_separate, &ColladaParserAutoGen14Private::_end__stencil_mask_separate, &ColladaParserAutoGen14Private::_preBegin__stencil_mask_separate, &ColladaParserAutoGen14Private::_preEnd__stencil_mask_separate, &ColladaParserAutoGen14Private::_freeAttributes__stencil_mask_separate);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_op);
-functionMap[HASH_ELEMENT_STENCIL_OP_SEPARATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_op_separate, &ColladaParserAutoGen14Private::_data__stencil_op_separate, &ColladaParserAutoGen14Private::_end__stencil_op_separate, &ColladaParserAutoGen14Private::_preBegin__stencil_op_separate, &ColladaParserAutoGen14Private::_preEnd__stencil_op_separate, &ColladaParserAutoGen14Private::_freeAttributes__stencil_op_separate);
-functionMap[HASH_ELEMENT_STENCIL_TARGET____FX_STENCILTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_data__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_end__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_preBegin__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_preEnd__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_freeAttributes__stencil_target____fx_stenciltarget_common);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_test_enable);
-functionMap[HASH_ELEMENT_TEXTURE1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture1D, &ColladaParserAutoGen14Private::_data__texture1D, &ColladaParserAutoGen14Private::_end__texture1D, &ColladaParserAutoGen14Private::_preBegin__texture1D, &ColladaParserAutoGen14Private::_preEnd__texture1D, &ColladaParserAutoGen14Private::_freeAttributes__texture1D);
-functionMap[HASH_ELEMENT_TEXTURE1D_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture1D_enable, &ColladaParserAutoGen14Private::_data__texture1D_enable, &ColladaParserAutoGen14Private::_end__texture1D_enable, &ColladaParserAutoGen14Private::_preBegin__texture1D_enable, &ColladaParserAutoGen14Private::_preEnd__texture1D_enable, &ColladaParserAutoGen14Private::_freeAttributes__texture1D_enable);
-functionMap[HASH_ELEMENT_TEXTURE2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture2D, &ColladaParserAutoGen14Private::_data__texture2D, &ColladaParserAutoGen14Private::_end__texture2D, &ColladaParserAutoGen14Private::_preBegin__texture2D, &ColladaParserAutoGen14Private::_preEnd__texture2D, &ColladaParserAutoGen14Private::_freeAttributes__texture2D);
-functionMap[HASH_ELEMENT_TEXTURE2D_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture2D_enable, &ColladaParserAutoGen14Private::_data__texture2D_enable, &ColladaParserAutoGen14Private::_end__texture2D_enable, &ColladaParserAutoGen14Private::_preBegin__texture2D_enable, &ColladaParserAutoGen14Private::_preEnd__texture2D_enable, &ColladaParserAutoGen14Private::_freeAttributes__texture2D_enable);
-functionMap[HASH_ELEMENT_TEXTURE3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture3D, &ColladaParserAutoGen14Private::_data__texture3D, &ColladaParserAutoGen14Private::_end__texture3D, &ColladaParserAutoGen14Private::_preBegin__texture3D, &ColladaParserAutoGen14Private::_preEnd__texture3D, &ColladaParserAutoGen14Private::_freeAttributes__texture3D);
-functionMap[HASH_ELEMENT_TEXTURE3D_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture3D_enable, &ColladaParserAutoGen14Private::_data__texture3D_enable, &ColladaParserAutoGen14Private::_end__texture3D_enable, &ColladaParserAutoGen14Private::_preBegin__texture3D_enable, &ColladaParserAutoGen14Private::_preEnd__texture3D_enable, &ColladaParserAutoGen14Private::_freeAttributes__texture3D_enable);
-functionMap[HASH_ELEMENT_TEXTURECUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureCUBE, &ColladaParserAutoGen14Private::_data__textureCUBE, &ColladaParserAutoGen14Private::_end__textureCUBE, &ColladaParserAutoGen14Private::_preBegin__textureCUBE, &ColladaParserAutoGen14Private::_preEnd__textureCUBE, &ColladaParserAutoGen14Private::_freeAttributes__textureCUBE);
-functionMap[HASH_ELEMENT_TEXTURECUBE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureCUBE_enable, &ColladaParserAutoGen14Private::_data__textureCUBE_enable, &ColladaParserAutoGen14Private::_end__textureCUBE_enable, &ColladaParserAutoGen14Private::_preBegin__textureCUBE_enable, &ColladaParserAutoGen14Private::_preEnd__textureCUBE_enable, &ColladaParserAutoGen14Private::_freeAttributes__textureCUBE_enable);
-functionMap[HASH_ELEMENT_TEXTUREDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureDEPTH, &ColladaParserAutoGen14Private::_data__textureDEPTH, &ColladaParserAutoGen14Private::_end__textureDEPTH, &ColladaParserAutoGen14Private::_preBegin__textureDEPTH, &ColladaParserAutoGen14Private::_preEnd__textureDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__textureDEPTH);
-functionMap[HASH_ELEMENT_TEXTUREDEPTH_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureDEPTH_enable, &ColladaParserAutoGen14Private::_data__textureDEPTH_enable, &ColladaParserAutoGen14Private::_end__textureDEPTH_enable, &ColladaParserAutoGen14Private::_preBegin__textureDEPTH_enable, &ColladaParserAutoGen14Private::_preEnd__textureDEPTH_enable, &ColladaParserAutoGen14Private::_freeAttributes__textureDEPTH_enable);
-functionMap[HASH_ELEMENT_TEXTURERECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureRECT, &ColladaParserAutoGen14Private::_data__textureRECT, &ColladaParserAutoGen14Private::_end__textureRECT, &ColladaParserAutoGen14Private::_preBegin__textureRECT, &ColladaParserAutoGen14Private::_preEnd__textureRECT, &ColladaParserAutoGen14Private::_freeAttributes__textureRECT);
-functionMap[HASH_ELEMENT_TEXTURERECT_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__textureRECT_enable, &ColladaParserAutoGen14Private::_data__textureRECT_enable, &ColladaParserAutoGen14Private::_end__textureRECT_enable, &ColladaParserAutoGen14Private::_preBegin__textureRECT_enable, &ColladaParserAutoGen14Private::_preEnd__textureRECT_enable, &ColladaParserAutoGen14Private::_freeAttributes__textureRECT_enable);
-functionMap[HASH_ELEMENT_TEXTURE_ENV_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture_env_color, &ColladaParserAutoGen14Private::_data__texture_env_color, &ColladaParserAutoGen14Private::_end__texture_env_color, &ColladaParserAutoGen14Private::_preBegin__texture_env_color, &ColladaParserAutoGen14Private::_preEnd__texture_env_color, &ColladaParserAutoGen14Private::_freeAttributes__texture_env_color);
-functionMap[HASH_ELEMENT_TEXTURE_ENV_MODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture_env_mode, &ColladaParserAutoGen14Private::_data__texture_env_mode, &ColladaParserAutoGen14Private::_end__texture_env_mode, &ColladaParserAutoGen14Private::_preBegin__texture_env_mode, &ColladaParserAutoGen14Private::_preEnd__texture_env_mode, &ColladaParserAutoGen14Private::_freeAttributes__texture_env_mode);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_FUNC__FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__alpha_func__func);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_FUNC__VALUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__alpha_func__value);
-functionMap[HASH_ELEMENT_BLEND_EQUATION_SEPARATE__ALPHA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__blend_equation_separate__alpha, &ColladaParserAutoGen14Private::_data__blend_equation_separate__alpha, &ColladaParserAutoGen14Private::_end__blend_equation_separate__alpha, &ColladaParserAutoGen14Private::_preBegin__blend_equation_separate__alpha, &ColladaParserAutoGen14Private::_preEnd__blend_equation_separate__alpha, &ColladaParserAutoGen14Private::_freeAttributes__blend_equation_separate__alpha);
-functionMap[HASH_ELEMENT_RGB] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rgb, &ColladaParserAutoGen14Private::_data__rgb, &ColladaParserAutoGen14Private::_end__rgb, &ColladaParserAutoGen14Private::_preBegin__rgb, &ColladaParserAutoGen14Private::_preEnd__rgb, &ColladaParserAutoGen14Private::_freeAttributes__rgb);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_FUNC__DEST] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__blend_func__dest);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_FUNC__SRC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__blend_func__src);
-functionMap[HASH_ELEMENT_DEST_ALPHA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__dest_alpha, &ColladaParserAutoGen14Private::_data__dest_alpha, &ColladaParserAutoGen14Private::_end__dest_alpha, &ColladaParserAutoGen14Private::_preBegin__dest_alpha, &ColladaParserAutoGen14Private::_preEnd__dest_alpha, &ColladaParserAutoGen14Private::_freeAttributes__dest_alpha);
-functionMap[HASH_ELEMENT_DEST_RGB] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__dest_rgb, &ColladaParserAutoGen14Private::_data__dest_rgb, &ColladaParserAutoGen14Private::_end__dest_rgb, &ColladaParserAutoGen14Private::_preBegin__dest_rgb, &ColladaParserAutoGen14Private::_preEnd__dest_rgb, &ColladaParserAutoGen14Private::_freeAttributes__dest_rgb);
-functionMap[HASH_ELEMENT_SRC_ALPHA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__src_alpha, &ColladaParserAutoGen14Private::_data__src_alpha, &ColladaParserAutoGen14Private::_end__src_alpha, &ColladaParserAutoGen14Private::_preBegin__src_alpha, &ColladaParserAutoGen14Private::_preEnd__src_alpha, &ColladaParserAutoGen14Private::_freeAttributes__src_alpha);
-functionMap[HASH_ELEMENT_SRC_RGB] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__src_rgb, &ColladaParserAutoGen14Private::_data__src_rgb, &ColladaParserAutoGen14Private::_end__src_rgb, &ColladaParserAutoGen14Private::_preBegin__src_rgb, &ColladaParserAutoGen14Private::_preEnd__src_rgb, &ColladaParserAutoGen14Private::_freeAttributes__src_rgb);
-functionMap[HASH_ELEMENT_COLOR_MATERIAL__FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_material__face, &ColladaParserAutoGen14Private::_data__color_material__face, &ColladaParserAutoGen14Private::_end__color_material__face, &ColladaParserAutoGen14Private::_preBegin__color_material__face, &ColladaParserAutoGen14Private::_preEnd__color_material__face, &ColladaParserAutoGen14Private::_freeAttributes__color_material__face);
-functionMap[HASH_ELEMENT_COLOR_MATERIAL__MODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_material__mode, &ColladaParserAutoGen14Private::_data__color_material__mode, &ColladaParserAutoGen14Private::_end__color_material__mode, &ColladaParserAutoGen14Private::_preBegin__color_material__mode, &ColladaParserAutoGen14Private::_preEnd__color_material__mode, &ColladaParserAutoGen14Private::_freeAttributes__color_material__mode);
-functionMap[HASH_ELEMENT_POLYGON_MODE__FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygon_mode__face, &ColladaParserAutoGen14Private::_data__polygon_mode__face, &ColladaParserAutoGen14Private::_end__polygon_mode__face, &ColladaParserAutoGen14Private::_preBegin__polygon_mode__face, &ColladaParserAutoGen14Private::_preEnd__polygon_mode__face, &ColladaParserAutoGen14Private::_freeAttributes__polygon_mode__face);
-functionMap[HASH_ELEMENT_POLYGON_MODE__MODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygon_mode__mode, &ColladaParserAutoGen14Private::_data__polygon_mode__mode, &ColladaParserAutoGen14Private::_end__polygon_mode__mode, &ColladaParserAutoGen14Private::_preBegin__polygon_mode__mode, &ColladaParserAutoGen14Private::_preEnd__polygon_mode__mode, &ColladaParserAutoGen14Private::_freeAttributes__polygon_mode__mode);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__BIND] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_data__profile_CG__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_end__profile_CG__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_preBegin__profile_CG__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_preEnd__profile_CG__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__technique__pass__shader__bind);
-functionMap[HASH_ELEMENT_COMPILER_OPTIONS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__compiler_options, &ColladaParserAutoGen14Private::_data__compiler_options, &ColladaParserAutoGen14Private::_end__compiler_options, &ColladaParserAutoGen14Private::_preBegin__compiler_options, &ColladaParserAutoGen14Private::_preEnd__compiler_options, &ColladaParserAutoGen14Private::_freeAttributes__compiler_options);
-functionMap[HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__COMPILER_TARGET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_data__profile_CG__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_end__profile_CG__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_preBegin__profile_CG__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_preEnd__profile_CG__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__technique__pass__shader__compiler_target);
-functionMap[HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__NAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__technique__pass__shader__name, &ColladaParserAutoGen14Private::_data__profile_CG__technique__pass__shader__name, &ColladaParserAutoGen14Private::_end__profile_CG__technique__pass__shader__name, &ColladaParserAutoGen14Private::_preBegin__profile_CG__technique__pass__shader__name, &ColladaParserAutoGen14Private::_preEnd__profile_CG__technique__pass__shader__name, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__technique__pass__shader__name);
-functionMap[HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__BIND__PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_CG__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_data__profile_CG__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_end__profile_CG__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_preBegin__profile_CG__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_preEnd__profile_CG__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_freeAttributes__profile_CG__technique__pass__shader__bind__param);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC__FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_func__func);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC__MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_func__mask);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC__REF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_func__ref);
-functionMap[HASH_ELEMENT_BACK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__back, &ColladaParserAutoGen14Private::_data__back, &ColladaParserAutoGen14Private::_end__back, &ColladaParserAutoGen14Private::_preBegin__back, &ColladaParserAutoGen14Private::_preEnd__back, &ColladaParserAutoGen14Private::_freeAttributes__back);
-functionMap[HASH_ELEMENT_FRONT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__front, &ColladaParserAutoGen14Private::_data__front, &ColladaParserAutoGen14Private::_end__front, &ColladaParserAutoGen14Private::_preBegin__front, &ColladaParserAutoGen14Private::_preEnd__front, &ColladaParserAutoGen14Private::_freeAttributes__front);
-functionMap[HASH_ELEMENT_STENCIL_FUNC_SEPARATE__MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_func_separate__mask, &ColladaParserAutoGen14Private::_data__stencil_func_separate__mask, &ColladaParserAutoGen14Private::_end__stencil_func_separate__mask, &ColladaParserAutoGen14Private::_preBegin__stencil_func_separate__mask, &ColladaParserAutoGen14Private::_preEnd__stencil_func_separate__mask, &ColladaParserAutoGen14Private::_freeAttributes__stencil_func_separate__mask);
-functionMap[HASH_ELEMENT_STENCIL_FUNC_SEPARATE__REF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_func_separate__ref, &ColladaParserAutoGen14Private::_data__stencil_func_separate__ref, &ColladaParserAutoGen14Private::_end__stencil_func_separate__ref, &ColladaParserAutoGen14Private::_preBegin__stencil_func_separate__ref, &ColladaParserAutoGen14Private::_preEnd__stencil_func_separate__ref, &ColladaParserAutoGen14Private::_freeAttributes__stencil_func_separate__ref);
-functionMap[HASH_ELEMENT_STENCIL_MASK_SEPARATE__FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_mask_separate__face, &ColladaParserAutoGen14Private::_data__stencil_mask_separate__face, &ColladaParserAutoGen14Private::_end__stencil_mask_separate__face, &ColladaParserAutoGen14Private::_preBegin__stencil_mask_separate__face, &ColladaParserAutoGen14Private::_preEnd__stencil_mask_separate__face, &ColladaParserAutoGen14Private::_freeAttributes__stencil_mask_separate__face);
-functionMap[HASH_ELEMENT_STENCIL_MASK_SEPARATE__MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_mask_separate__mask, &ColladaParserAutoGen14Private::_data__stencil_mask_separate__mask, &ColladaParserAutoGen14Private::_end__stencil_mask_separate__mask, &ColladaParserAutoGen14Private::_preBegin__stencil_mask_separate__mask, &ColladaParserAutoGen14Private::_preEnd__stencil_mask_separate__mask, &ColladaParserAutoGen14Private::_freeAttributes__stencil_mask_separate__mask);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP__FAIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_op__fail);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP__ZFAIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_op__zfail);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP__ZPASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__stencil_op__zpass);
-functionMap[HASH_ELEMENT_STENCIL_OP_SEPARATE__FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_op_separate__face, &ColladaParserAutoGen14Private::_data__stencil_op_separate__face, &ColladaParserAutoGen14Private::_end__stencil_op_separate__face, &ColladaParserAutoGen14Private::_preBegin__stencil_op_separate__face, &ColladaParserAutoGen14Private::_preEnd__stencil_op_separate__face, &ColladaParserAutoGen14Private::_freeAttributes__stencil_op_separate__face);
-functionMap[HASH_ELEMENT_STENCIL_OP_SEPARATE__FAIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_op_separate__fail, &ColladaParserAutoGen14Private::_data__stencil_op_separate__fail, &ColladaParserAutoGen14Private::_end__stencil_op_separate__fail, &ColladaParserAutoGen14Private::_preBegin__stencil_op_separate__fail, &ColladaParserAutoGen14Private::_preEnd__stencil_op_separate__fail, &ColladaParserAutoGen14Private::_freeAttributes__stencil_op_separate__fail);
-functionMap[HASH_ELEMENT_STENCIL_OP_SEPARATE__ZFAIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_op_separate__zfail, &ColladaParserAutoGen14Private::_data__stencil_op_separate__zfail, &ColladaParserAutoGen14Private::_end__stencil_op_separate__zfail, &ColladaParserAutoGen14Private::_preBegin__stencil_op_separate__zfail, &ColladaParserAutoGen14Private::_preEnd__stencil_op_separate__zfail, &ColladaParserAutoGen14Private::_freeAttributes__stencil_op_separate__zfail);
-functionMap[HASH_ELEMENT_STENCIL_OP_SEPARATE__ZPASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_op_separate__zpass, &ColladaParserAutoGen14Private::_data__stencil_op_separate__zpass, &ColladaParserAutoGen14Private::_end__stencil_op_separate__zpass, &ColladaParserAutoGen14Private::_preBegin__stencil_op_separate__zpass, &ColladaParserAutoGen14Private::_preEnd__stencil_op_separate__zpass, &ColladaParserAutoGen14Private::_freeAttributes__stencil_op_separate__zpass);
-functionMap[HASH_ELEMENT_PARAM____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param____NCName, &ColladaParserAutoGen14Private::_data__param____NCName, &ColladaParserAutoGen14Private::_end__param____NCName, &ColladaParserAutoGen14Private::_preBegin__param____NCName, &ColladaParserAutoGen14Private::_preEnd__param____NCName, &ColladaParserAutoGen14Private::_freeAttributes__param____NCName);
-functionMap[HASH_ELEMENT_VALUE____GL_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gl_sampler1D, &ColladaParserAutoGen14Private::_data__value____gl_sampler1D, &ColladaParserAutoGen14Private::_end__value____gl_sampler1D, &ColladaParserAutoGen14Private::_preBegin__value____gl_sampler1D, &ColladaParserAutoGen14Private::_preEnd__value____gl_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__value____gl_sampler1D);
-functionMap[HASH_ELEMENT_PARAM____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param____NCName, &ColladaParserAutoGen14Private::_data__param____NCName, &ColladaParserAutoGen14Private::_end__param____NCName, &ColladaParserAutoGen14Private::_preBegin__param____NCName, &ColladaParserAutoGen14Private::_preEnd__param____NCName, &ColladaParserAutoGen14Private::_freeAttributes__param____NCName);
-functionMap[HASH_ELEMENT_VALUE____GL_SAMPLER2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gl_sampler2D, &ColladaParserAutoGen14Private::_data__value____gl_sampler2D, &ColladaParserAutoGen14Private::_end__value____gl_sampler2D, &ColladaParserAutoGen14Private::_preBegin__value____gl_sampler2D, &ColladaParserAutoGen14Private::_preEnd__value____gl_sampler2D, &ColladaParserAutoGen14Private::_freeAttributes__value____gl_sampler2D);
-functionMap[HASH_ELEMENT_PARAM____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param____NCName, &ColladaParserAutoGen14Private::_data__param____NCName, &ColladaParserAutoGen14Private::_end__param____NCName, &ColladaParserAutoGen14Private::_preBegin__param____NCName, &ColladaParserAutoGen14Private::_preEnd__param____NCName, &ColladaParserAutoGen14Private::_freeAttributes__param____NCName);
-functionMap[HASH_ELEMENT_VALUE____GL_SAMPLER3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gl_sampler3D, &ColladaParserAutoGen14Private::_data__value____gl_sampler3D, &ColladaParserAutoGen14Private::_end__value____gl_sampler3D, &ColladaParserAutoGen14Private::_preBegin__value____gl_sampler3D, &ColladaParserAutoGen14Private::_preEnd__value____gl_sampler3D, &ColladaParserAutoGen14Private::_freeAttributes__value____gl_sampler3D);
-functionMap[HASH_ELEMENT_PARAM____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param____NCName, &ColladaParserAutoGen14Private::_data__param____NCName, &ColladaParserAutoGen14Private::_end__param____NCName, &ColladaParserAutoGen14Private::_preBegin__param____NCName, &ColladaParserAutoGen14Private::_preEnd__param____NCName, &ColladaParserAutoGen14Private::_freeAttributes__param____NCName);
-functionMap[HASH_ELEMENT_VALUE____GL_SAMPLERCUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gl_samplerCUBE, &ColladaParserAutoGen14Private::_data__value____gl_samplerCUBE, &ColladaParserAutoGen14Private::_end__value____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preBegin__value____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preEnd__value____gl_samplerCUBE, &ColladaParserAutoGen14Private::_freeAttributes__value____gl_samplerCUBE);
-functionMap[HASH_ELEMENT_PARAM____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param____NCName, &ColladaParserAutoGen14Private::_data__param____NCName, &ColladaParserAutoGen14Private::_end__param____NCName, &ColladaParserAutoGen14Private::_preBegin__param____NCName, &ColladaParserAutoGen14Private::_preEnd__param____NCName, &ColladaParserAutoGen14Private::_freeAttributes__param____NCName);
-functionMap[HASH_ELEMENT_VALUE____GL_SAMPLERDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_data__value____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_end__value____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preBegin__value____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preEnd__value____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__value____gl_samplerDEPTH);
-functionMap[HASH_ELEMENT_PARAM____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param____NCName, &ColladaParserAutoGen14Private::_data__param____NCName, &ColladaParserAutoGen14Private::_end__param____NCName, &ColladaParserAutoGen14Private::_preBegin__param____NCName, &ColladaParserAutoGen14Private::_preEnd__param____NCName, &ColladaParserAutoGen14Private::_freeAttributes__param____NCName);
-functionMap[HASH_ELEMENT_VALUE____GL_SAMPLERRECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gl_samplerRECT, &ColladaParserAutoGen14Private::_data__value____gl_samplerRECT, &ColladaParserAutoGen14Private::_end__value____gl_samplerRECT, &ColladaParserAutoGen14Private::_preBegin__value____gl_samplerRECT, &ColladaParserAutoGen14Private::_preEnd__value____gl_samplerRECT, &ColladaParserAutoGen14Private::_freeAttributes__value____gl_samplerRECT);
-functionMap[HASH_ELEMENT_NEWPARAM____COMMON_NEWPARAM_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_data__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_end__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_preBegin__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_preEnd__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_freeAttributes__newparam____common_newparam_type);
-functionMap[HASH_ELEMENT_PROFILE_COMMON__TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_COMMON__technique, &ColladaParserAutoGen14Private::_data__profile_COMMON__technique, &ColladaParserAutoGen14Private::_end__profile_COMMON__technique, &ColladaParserAutoGen14Private::_preBegin__profile_COMMON__technique, &ColladaParserAutoGen14Private::_preEnd__profile_COMMON__technique, &ColladaParserAutoGen14Private::_freeAttributes__profile_COMMON__technique);
-functionMap[HASH_ELEMENT_FLOAT____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____float, &ColladaParserAutoGen14Private::_data__float____float, &ColladaParserAutoGen14Private::_end__float____float, &ColladaParserAutoGen14Private::_preBegin__float____float, &ColladaParserAutoGen14Private::_preEnd__float____float, &ColladaParserAutoGen14Private::_freeAttributes__float____float);
-functionMap[HASH_ELEMENT_FLOAT2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____float2, &ColladaParserAutoGen14Private::_data__float2____float2, &ColladaParserAutoGen14Private::_end__float2____float2, &ColladaParserAutoGen14Private::_preBegin__float2____float2, &ColladaParserAutoGen14Private::_preEnd__float2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____float2);
-functionMap[HASH_ELEMENT_FLOAT3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____float3, &ColladaParserAutoGen14Private::_data__float3____float3, &ColladaParserAutoGen14Private::_end__float3____float3, &ColladaParserAutoGen14Private::_preBegin__float3____float3, &ColladaParserAutoGen14Private::_preEnd__float3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____float3);
-functionMap[HASH_ELEMENT_FLOAT4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____float4, &ColladaParserAutoGen14Private::_data__float4____float4, &ColladaParserAutoGen14Private::_end__float4____float4, &ColladaParserAutoGen14Private::_preBegin__float4____float4, &ColladaParserAutoGen14Private::_preEnd__float4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____float4);
-functionMap[HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_data__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_end__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preBegin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preEnd__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____fx_sampler2D_common);
-functionMap[HASH_ELEMENT_SEMANTIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__semantic, &ColladaParserAutoGen14Private::_data__semantic, &ColladaParserAutoGen14Private::_end__semantic, &ColladaParserAutoGen14Private::_preBegin__semantic, &ColladaParserAutoGen14Private::_preEnd__semantic, &ColladaParserAutoGen14Private::_freeAttributes__semantic);
-functionMap[HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_data__surface____fx_surface_common, &ColladaParserAutoGen14Private::_end__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preBegin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preEnd__surface____fx_surface_common, &ColladaParserAutoGen14Private::_freeAttributes__surface____fx_surface_common);
-functionMap[HASH_ELEMENT_BLINN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__blinn, &ColladaParserAutoGen14Private::_data__blinn, &ColladaParserAutoGen14Private::_end__blinn, &ColladaParserAutoGen14Private::_preBegin__blinn, &ColladaParserAutoGen14Private::_preEnd__blinn, &ColladaParserAutoGen14Private::_freeAttributes__blinn);
-functionMap[HASH_ELEMENT_PROFILE_COMMON__TECHNIQUE__CONSTANT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_data__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_end__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_preBegin__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_preEnd__profile_COMMON__technique__constant, &ColladaParserAutoGen14Private::_freeAttributes__profile_COMMON__technique__constant);
-functionMap[HASH_ELEMENT_LAMBERT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__lambert, &ColladaParserAutoGen14Private::_data__lambert, &ColladaParserAutoGen14Private::_end__lambert, &ColladaParserAutoGen14Private::_preBegin__lambert, &ColladaParserAutoGen14Private::_preEnd__lambert, &ColladaParserAutoGen14Private::_freeAttributes__lambert);
-functionMap[HASH_ELEMENT_NEWPARAM____COMMON_NEWPARAM_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_data__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_end__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_preBegin__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_preEnd__newparam____common_newparam_type, &ColladaParserAutoGen14Private::_freeAttributes__newparam____common_newparam_type);
-functionMap[HASH_ELEMENT_PHONG] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__phong, &ColladaParserAutoGen14Private::_data__phong, &ColladaParserAutoGen14Private::_end__phong, &ColladaParserAutoGen14Private::_preBegin__phong, &ColladaParserAutoGen14Private::_preEnd__phong, &ColladaParserAutoGen14Private::_freeAttributes__phong);
-functionMap[HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_data__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_end__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preBegin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preEnd__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_freeAttributes__ambient____common_color_or_texture_type);
-functionMap[HASH_ELEMENT_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__diffuse, &ColladaParserAutoGen14Private::_data__diffuse, &ColladaParserAutoGen14Private::_end__diffuse, &ColladaParserAutoGen14Private::_preBegin__diffuse, &ColladaParserAutoGen14Private::_preEnd__diffuse, &ColladaParserAutoGen14Private::_freeAttributes__diffuse);
-functionMap[HASH_ELEMENT_EMISSION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__emission, &ColladaParserAutoGen14Private::_data__emission, &ColladaParserAutoGen14Private::_end__emission, &ColladaParserAutoGen14Private::_preBegin__emission, &ColladaParserAutoGen14Private::_preEnd__emission, &ColladaParserAutoGen14Private::_freeAttributes__emission);
-functionMap[HASH_ELEMENT_INDEX_OF_REFRACTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__index_of_refraction, &ColladaParserAutoGen14Private::_data__index_of_refraction, &ColladaParserAutoGen14Private::_end__index_of_refraction, &ColladaParserAutoGen14Private::_preBegin__index_of_refraction, &ColladaParserAutoGen14Private::_preEnd__index_of_refraction, &ColladaParserAutoGen14Private::_freeAttributes__index_of_refraction);
-functionMap[HASH_ELEMENT_REFLECTIVE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflective, &ColladaParserAutoGen14Private::_data__reflective, &ColladaParserAutoGen14Private::_end__reflective, &ColladaParserAutoGen14Private::_preBegin__reflective, &ColladaParserAutoGen14Private::_preEnd__reflective, &ColladaParserAutoGen14Private::_freeAttributes__reflective);
-functionMap[HASH_ELEMENT_REFLECTIVITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflectivity, &ColladaParserAutoGen14Private::_data__reflectivity, &ColladaParserAutoGen14Private::_end__reflectivity, &ColladaParserAutoGen14Private::_preBegin__reflectivity, &ColladaParserAutoGen14Private::_preEnd__reflectivity, &ColladaParserAutoGen14Private::_freeAttributes__reflectivity);
-functionMap[HASH_ELEMENT_SHININESS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__shininess, &ColladaParserAutoGen14Private::_data__shininess, &ColladaParserAutoGen14Private::_end__shininess, &ColladaParserAutoGen14Private::_preBegin__shininess, &ColladaParserAutoGen14Private::_preEnd__shininess, &ColladaParserAutoGen14Private::_freeAttributes__shininess);
-functionMap[HASH_ELEMENT_SPECULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__specular, &ColladaParserAutoGen14Private::_data__specular, &ColladaParserAutoGen14Private::_end__specular, &ColladaParserAutoGen14Private::_preBegin__specular, &ColladaParserAutoGen14Private::_preEnd__specular, &ColladaParserAutoGen14Private::_freeAttributes__specular);
-functionMap[HASH_ELEMENT_TRANSPARENCY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparency, &ColladaParserAutoGen14Private::_data__transparency, &ColladaParserAutoGen14Private::_end__transparency, &ColladaParserAutoGen14Private::_preBegin__transparency, &ColladaParserAutoGen14Private::_preEnd__transparency, &ColladaParserAutoGen14Private::_freeAttributes__transparency);
-functionMap[HASH_ELEMENT_TRANSPARENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparent, &ColladaParserAutoGen14Private::_data__transparent, &ColladaParserAutoGen14Private::_end__transparent, &ColladaParserAutoGen14Private::_preBegin__transparent, &ColladaParserAutoGen14Private::_preEnd__transparent, &ColladaParserAutoGen14Private::_freeAttributes__transparent);
-functionMap[HASH_ELEMENT_COMMON_COLOR_OR_TEXTURE_TYPE____COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__common_color_or_texture_type____color, &ColladaParserAutoGen14Private::_data__common_color_or_texture_type____color, &ColladaParserAutoGen14Private::_end__common_color_or_texture_type____color, &ColladaParserAutoGen14Private::_preBegin__common_color_or_texture_type____color, &ColladaParserAutoGen14Private::_preEnd__common_color_or_texture_type____color, &ColladaParserAutoGen14Private::_freeAttributes__common_color_or_texture_type____color);
-functionMap[HASH_ELEMENT_COMMON_COLOR_OR_TEXTURE_TYPE____PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__common_color_or_texture_type____param, &ColladaParserAutoGen14Private::_data__common_color_or_texture_type____param, &ColladaParserAutoGen14Private::_end__common_color_or_texture_type____param, &ColladaParserAutoGen14Private::_preBegin__common_color_or_texture_type____param, &ColladaParserAutoGen14Private::_preEnd__common_color_or_texture_type____param, &ColladaParserAutoGen14Private::_freeAttributes__common_color_or_texture_type____param);
-functionMap[HASH_ELEMENT_TEXTURE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture, &ColladaParserAutoGen14Private::_data__texture, &ColladaParserAutoGen14Private::_end__texture, &ColladaParserAutoGen14Private::_preBegin__texture, &ColladaParserAutoGen14Private::_preEnd__texture, &ColladaParserAutoGen14Private::_freeAttributes__texture);
-functionMap[HASH_ELEMENT_COMMON_FLOAT_OR_PARAM_TYPE____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__common_float_or_param_type____float, &ColladaParserAutoGen14Private::_data__common_float_or_param_type____float, &ColladaParserAutoGen14Private::_end__common_float_or_param_type____float, &ColladaParserAutoGen14Private::_preBegin__common_float_or_param_type____float, &ColladaParserAutoGen14Private::_preEnd__common_float_or_param_type____float, &ColladaParserAutoGen14Private::_freeAttributes__common_float_or_param_type____float);
-functionMap[HASH_ELEMENT_COMMON_FLOAT_OR_PARAM_TYPE____PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__common_float_or_param_type____param, &ColladaParserAutoGen14Private::_data__common_float_or_param_type____param, &ColladaParserAutoGen14Private::_end__common_float_or_param_type____param, &ColladaParserAutoGen14Private::_preBegin__common_float_or_param_type____param, &ColladaParserAutoGen14Private::_preEnd__common_float_or_param_type____param, &ColladaParserAutoGen14Private::_freeAttributes__common_float_or_param_type____param);
-functionMap[HASH_ELEMENT_EMISSION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__emission, &ColladaParserAutoGen14Private::_data__emission, &ColladaParserAutoGen14Private::_end__emission, &ColladaParserAutoGen14Private::_preBegin__emission, &ColladaParserAutoGen14Private::_preEnd__emission, &ColladaParserAutoGen14Private::_freeAttributes__emission);
-functionMap[HASH_ELEMENT_INDEX_OF_REFRACTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__index_of_refraction, &ColladaParserAutoGen14Private::_data__index_of_refraction, &ColladaParserAutoGen14Private::_end__index_of_refraction, &ColladaParserAutoGen14Private::_preBegin__index_of_refraction, &ColladaParserAutoGen14Private::_preEnd__index_of_refraction, &ColladaParserAutoGen14Private::_freeAttributes__index_of_refraction);
-functionMap[HASH_ELEMENT_REFLECTIVE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflective, &ColladaParserAutoGen14Private::_data__reflective, &ColladaParserAutoGen14Private::_end__reflective, &ColladaParserAutoGen14Private::_preBegin__reflective, &ColladaParserAutoGen14Private::_preEnd__reflective, &ColladaParserAutoGen14Private::_freeAttributes__reflective);
-functionMap[HASH_ELEMENT_REFLECTIVITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflectivity, &ColladaParserAutoGen14Private::_data__reflectivity, &ColladaParserAutoGen14Private::_end__reflectivity, &ColladaParserAutoGen14Private::_preBegin__reflectivity, &ColladaParserAutoGen14Private::_preEnd__reflectivity, &ColladaParserAutoGen14Private::_freeAttributes__reflectivity);
-functionMap[HASH_ELEMENT_TRANSPARENCY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparency, &ColladaParserAutoGen14Private::_data__transparency, &ColladaParserAutoGen14Private::_end__transparency, &ColladaParserAutoGen14Private::_preBegin__transparency, &ColladaParserAutoGen14Private::_preEnd__transparency, &ColladaParserAutoGen14Private::_freeAttributes__transparency);
-functionMap[HASH_ELEMENT_TRANSPARENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparent, &ColladaParserAutoGen14Private::_data__transparent, &ColladaParserAutoGen14Private::_end__transparent, &ColladaParserAutoGen14Private::_preBegin__transparent, &ColladaParserAutoGen14Private::_preEnd__transparent, &ColladaParserAutoGen14Private::_freeAttributes__transparent);
-functionMap[HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_data__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_end__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preBegin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preEnd__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_freeAttributes__ambient____common_color_or_texture_type);
-functionMap[HASH_ELEMENT_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__diffuse, &ColladaParserAutoGen14Private::_data__diffuse, &ColladaParserAutoGen14Private::_end__diffuse, &ColladaParserAutoGen14Private::_preBegin__diffuse, &ColladaParserAutoGen14Private::_preEnd__diffuse, &ColladaParserAutoGen14Private::_freeAttributes__diffuse);
-functionMap[HASH_ELEMENT_EMISSION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__emission, &ColladaParserAutoGen14Private::_data__emission, &ColladaParserAutoGen14Private::_end__emission, &ColladaParserAutoGen14Private::_preBegin__emission, &ColladaParserAutoGen14Private::_preEnd__emission, &ColladaParserAutoGen14Private::_freeAttributes__emission);
-functionMap[HASH_ELEMENT_INDEX_OF_REFRACTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__index_of_refraction, &ColladaParserAutoGen14Private::_data__index_of_refraction, &ColladaParserAutoGen14Private::_end__index_of_refraction, &ColladaParserAutoGen14Private::_preBegin__index_of_refraction, &ColladaParserAutoGen14Private::_preEnd__index_of_refraction, &ColladaParserAutoGen14Private::_freeAttributes__index_of_refraction);
-functionMap[HASH_ELEMENT_REFLECTIVE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflective, &ColladaParserAutoGen14Private::_data__reflective, &ColladaParserAutoGen14Private::_end__reflective, &ColladaParserAutoGen14Private::_preBegin__reflective, &ColladaParserAutoGen14Private::_preEnd__reflective, &ColladaParserAutoGen14Private::_freeAttributes__reflective);
-functionMap[HASH_ELEMENT_REFLECTIVITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflectivity, &ColladaParserAutoGen14Private::_data__reflectivity, &ColladaParserAutoGen14Private::_end__reflectivity, &ColladaParserAutoGen14Private::_preBegin__reflectivity, &ColladaParserAutoGen14Private::_preEnd__reflectivity, &ColladaParserAutoGen14Private::_freeAttributes__reflectivity);
-functionMap[HASH_ELEMENT_TRANSPARENCY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparency, &ColladaParserAutoGen14Private::_data__transparency, &ColladaParserAutoGen14Private::_end__transparency, &ColladaParserAutoGen14Private::_preBegin__transparency, &ColladaParserAutoGen14Private::_preEnd__transparency, &ColladaParserAutoGen14Private::_freeAttributes__transparency);
-functionMap[HASH_ELEMENT_TRANSPARENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparent, &ColladaParserAutoGen14Private::_data__transparent, &ColladaParserAutoGen14Private::_end__transparent, &ColladaParserAutoGen14Private::_preBegin__transparent, &ColladaParserAutoGen14Private::_preEnd__transparent, &ColladaParserAutoGen14Private::_freeAttributes__transparent);
-functionMap[HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_data__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_end__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preBegin__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_preEnd__ambient____common_color_or_texture_type, &ColladaParserAutoGen14Private::_freeAttributes__ambient____common_color_or_texture_type);
-functionMap[HASH_ELEMENT_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__diffuse, &ColladaParserAutoGen14Private::_data__diffuse, &ColladaParserAutoGen14Private::_end__diffuse, &ColladaParserAutoGen14Private::_preBegin__diffuse, &ColladaParserAutoGen14Private::_preEnd__diffuse, &ColladaParserAutoGen14Private::_freeAttributes__diffuse);
-functionMap[HASH_ELEMENT_EMISSION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__emission, &ColladaParserAutoGen14Private::_data__emission, &ColladaParserAutoGen14Private::_end__emission, &ColladaParserAutoGen14Private::_preBegin__emission, &ColladaParserAutoGen14Private::_preEnd__emission, &ColladaParserAutoGen14Private::_freeAttributes__emission);
-functionMap[HASH_ELEMENT_INDEX_OF_REFRACTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__index_of_refraction, &ColladaParserAutoGen14Private::_data__index_of_refraction, &ColladaParserAutoGen14Private::_end__index_of_refraction, &ColladaParserAutoGen14Private::_preBegin__index_of_refraction, &ColladaParserAutoGen14Private::_preEnd__index_of_refraction, &ColladaParserAutoGen14Private::_freeAttributes__index_of_refraction);
-functionMap[HASH_ELEMENT_REFLECTIVE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflective, &ColladaParserAutoGen14Private::_data__reflective, &ColladaParserAutoGen14Private::_end__reflective, &ColladaParserAutoGen14Private::_preBegin__reflective, &ColladaParserAutoGen14Private::_preEnd__reflective, &ColladaParserAutoGen14Private::_freeAttributes__reflective);
-functionMap[HASH_ELEMENT_REFLECTIVITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__reflectivity, &ColladaParserAutoGen14Private::_data__reflectivity, &ColladaParserAutoGen14Private::_end__reflectivity, &ColladaParserAutoGen14Private::_preBegin__reflectivity, &ColladaParserAutoGen14Private::_preEnd__reflectivity, &ColladaParserAutoGen14Private::_freeAttributes__reflectivity);
-functionMap[HASH_ELEMENT_SHININESS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__shininess, &ColladaParserAutoGen14Private::_data__shininess, &ColladaParserAutoGen14Private::_end__shininess, &ColladaParserAutoGen14Private::_preBegin__shininess, &ColladaParserAutoGen14Private::_preEnd__shininess, &ColladaParserAutoGen14Private::_freeAttributes__shininess);
-functionMap[HASH_ELEMENT_SPECULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__specular, &ColladaParserAutoGen14Private::_data__specular, &ColladaParserAutoGen14Private::_end__specular, &ColladaParserAutoGen14Private::_preBegin__specular, &ColladaParserAutoGen14Private::_preEnd__specular, &ColladaParserAutoGen14Private::_freeAttributes__specular);
-functionMap[HASH_ELEMENT_TRANSPARENCY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparency, &ColladaParserAutoGen14Private::_data__transparency, &ColladaParserAutoGen14Private::_end__transparency, &ColladaParserAutoGen14Private::_preBegin__transparency, &ColladaParserAutoGen14Private::_preEnd__transparency, &ColladaParserAutoGen14Private::_freeAttributes__transparency);
-functionMap[HASH_ELEMENT_TRANSPARENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__transparent, &ColladaParserAutoGen14Private::_data__transparent, &ColladaParserAutoGen14Private::_end__transparent, &ColladaParserAutoGen14Private::_preBegin__transparent, &ColladaParserAutoGen14Private::_preEnd__transparent, &ColladaParserAutoGen14Private::_freeAttributes__transparent);
-functionMap[HASH_ELEMENT_NEWPARAM____GLES_NEWPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____gles_newparam, &ColladaParserAutoGen14Private::_data__newparam____gles_newparam, &ColladaParserAutoGen14Private::_end__newparam____gles_newparam, &ColladaParserAutoGen14Private::_preBegin__newparam____gles_newparam, &ColladaParserAutoGen14Private::_preEnd__newparam____gles_newparam, &ColladaParserAutoGen14Private::_freeAttributes__newparam____gles_newparam);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique, &ColladaParserAutoGen14Private::_data__profile_GLES__technique, &ColladaParserAutoGen14Private::_end__profile_GLES__technique, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_BOOL____BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____bool, &ColladaParserAutoGen14Private::_data__bool____bool, &ColladaParserAutoGen14Private::_end__bool____bool, &ColladaParserAutoGen14Private::_preBegin__bool____bool, &ColladaParserAutoGen14Private::_preEnd__bool____bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____bool);
-functionMap[HASH_ELEMENT_BOOL2____BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____bool2, &ColladaParserAutoGen14Private::_data__bool2____bool2, &ColladaParserAutoGen14Private::_end__bool2____bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____bool2);
-functionMap[HASH_ELEMENT_BOOL3____BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____bool3, &ColladaParserAutoGen14Private::_data__bool3____bool3, &ColladaParserAutoGen14Private::_end__bool3____bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____bool3);
-functionMap[HASH_ELEMENT_BOOL4____BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____bool4, &ColladaParserAutoGen14Private::_data__bool4____bool4, &ColladaParserAutoGen14Private::_end__bool4____bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____bool4);
-functionMap[HASH_ELEMENT_ENUM____GLES_ENUMERATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____gles_enumeration, &ColladaParserAutoGen14Private::_data__enum____gles_enumeration, &ColladaParserAutoGen14Private::_end__enum____gles_enumeration, &ColladaParserAutoGen14Private::_preBegin__enum____gles_enumeration, &ColladaParserAutoGen14Private::_preEnd__enum____gles_enumeration, &ColladaParserAutoGen14Private::_freeAttributes__enum____gles_enumeration);
-functionMap[HASH_ELEMENT_FLOAT____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____float, &ColladaParserAutoGen14Private::_data__float____float, &ColladaParserAutoGen14Private::_end__float____float, &ColladaParserAutoGen14Private::_preBegin__float____float, &ColladaParserAutoGen14Private::_preEnd__float____float, &ColladaParserAutoGen14Private::_freeAttributes__float____float);
-functionMap[HASH_ELEMENT_FLOAT1X1____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x1____float, &ColladaParserAutoGen14Private::_data__float1x1____float, &ColladaParserAutoGen14Private::_end__float1x1____float, &ColladaParserAutoGen14Private::_preBegin__float1x1____float, &ColladaParserAutoGen14Private::_preEnd__float1x1____float, &ColladaParserAutoGen14Private::_freeAttributes__float1x1____float);
-functionMap[HASH_ELEMENT_FLOAT1X2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x2____float2, &ColladaParserAutoGen14Private::_data__float1x2____float2, &ColladaParserAutoGen14Private::_end__float1x2____float2, &ColladaParserAutoGen14Private::_preBegin__float1x2____float2, &ColladaParserAutoGen14Private::_preEnd__float1x2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float1x2____float2);
-functionMap[HASH_ELEMENT_FLOAT1X3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x3____float3, &ColladaParserAutoGen14Private::_data__float1x3____float3, &ColladaParserAutoGen14Private::_end__float1x3____float3, &ColladaParserAutoGen14Private::_preBegin__float1x3____float3, &ColladaParserAutoGen14Private::_preEnd__float1x3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float1x3____float3);
-functionMap[HASH_ELEMENT_FLOAT1X4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x4____float4, &ColladaParserAutoGen14Private::_data__float1x4____float4, &ColladaParserAutoGen14Private::_end__float1x4____float4, &ColladaParserAutoGen14Private::_preBegin__float1x4____float4, &ColladaParserAutoGen14Private::_preEnd__float1x4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float1x4____float4);
-functionMap[HASH_ELEMENT_FLOAT2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____float2, &ColladaParserAutoGen14Private::_data__float2____float2, &ColladaParserAutoGen14Private::_end__float2____float2, &ColladaParserAutoGen14Private::_preBegin__float2____float2, &ColladaParserAutoGen14Private::_preEnd__float2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____float2);
-functionMap[HASH_ELEMENT_FLOAT2X1____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x1____float2, &ColladaParserAutoGen14Private::_data__float2x1____float2, &ColladaParserAutoGen14Private::_end__float2x1____float2, &ColladaParserAutoGen14Private::_preBegin__float2x1____float2, &ColladaParserAutoGen14Private::_preEnd__float2x1____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2x1____float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____float2x2, &ColladaParserAutoGen14Private::_data__float2x2____float2x2, &ColladaParserAutoGen14Private::_end__float2x2____float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____float2x2);
-functionMap[HASH_ELEMENT_FLOAT2X3____FLOAT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x3____float2x3, &ColladaParserAutoGen14Private::_data__float2x3____float2x3, &ColladaParserAutoGen14Private::_end__float2x3____float2x3, &ColladaParserAutoGen14Private::_preBegin__float2x3____float2x3, &ColladaParserAutoGen14Private::_preEnd__float2x3____float2x3, &ColladaParserAutoGen14Private::_freeAttributes__float2x3____float2x3);
-functionMap[HASH_ELEMENT_FLOAT2X4____FLOAT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x4____float2x4, &ColladaParserAutoGen14Private::_data__float2x4____float2x4, &ColladaParserAutoGen14Private::_end__float2x4____float2x4, &ColladaParserAutoGen14Private::_preBegin__float2x4____float2x4, &ColladaParserAutoGen14Private::_preEnd__float2x4____float2x4, &ColladaParserAutoGen14Private::_freeAttributes__float2x4____float2x4);
-functionMap[HASH_ELEMENT_FLOAT3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____float3, &ColladaParserAutoGen14Private::_data__float3____float3, &ColladaParserAutoGen14Private::_end__float3____float3, &ColladaParserAutoGen14Private::_preBegin__float3____float3, &ColladaParserAutoGen14Private::_preEnd__float3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____float3);
-functionMap[HASH_ELEMENT_FLOAT3X1____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x1____float3, &ColladaParserAutoGen14Private::_data__float3x1____float3, &ColladaParserAutoGen14Private::_end__float3x1____float3, &ColladaParserAutoGen14Private::_preBegin__float3x1____float3, &ColladaParserAutoGen14Private::_preEnd__float3x1____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3x1____float3);
-functionMap[HASH_ELEMENT_FLOAT3X2____FLOAT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x2____float3x2, &ColladaParserAutoGen14Private::_data__float3x2____float3x2, &ColladaParserAutoGen14Private::_end__float3x2____float3x2, &ColladaParserAutoGen14Private::_preBegin__float3x2____float3x2, &ColladaParserAutoGen14Private::_preEnd__float3x2____float3x2, &ColladaParserAutoGen14Private::_freeAttributes__float3x2____float3x2);
-functionMap[HASH_ELEMENT_FLOAT3X3____FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____float3x3, &ColladaParserAutoGen14Private::_data__float3x3____float3x3, &ColladaParserAutoGen14Private::_end__float3x3____float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____float3x3);
-functionMap[HASH_ELEMENT_FLOAT3X4____FLOAT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x4____float3x4, &ColladaParserAutoGen14Private::_data__float3x4____float3x4, &ColladaParserAutoGen14Private::_end__float3x4____float3x4, &ColladaParserAutoGen14Private::_preBegin__float3x4____float3x4, &ColladaParserAutoGen14Private::_preEnd__float3x4____float3x4, &ColladaParserAutoGen14Private::_freeAttributes__float3x4____float3x4);
-functionMap[HASH_ELEMENT_FLOAT4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____float4, &ColladaParserAutoGen14Private::_data__float4____float4, &ColladaParserAutoGen14Private::_end__float4____float4, &ColladaParserAutoGen14Private::_preBegin__float4____float4, &ColladaParserAutoGen14Private::_preEnd__float4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____float4);
-functionMap[HASH_ELEMENT_FLOAT4X1____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x1____float4, &ColladaParserAutoGen14Private::_data__float4x1____float4, &ColladaParserAutoGen14Private::_end__float4x1____float4, &ColladaParserAutoGen14Private::_preBegin__float4x1____float4, &ColladaParserAutoGen14Private::_preEnd__float4x1____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4x1____float4);
-functionMap[HASH_ELEMENT_FLOAT4X2____FLOAT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x2____float4x2, &ColladaParserAutoGen14Private::_data__float4x2____float4x2, &ColladaParserAutoGen14Private::_end__float4x2____float4x2, &ColladaParserAutoGen14Private::_preBegin__float4x2____float4x2, &ColladaParserAutoGen14Private::_preEnd__float4x2____float4x2, &ColladaParserAutoGen14Private::_freeAttributes__float4x2____float4x2);
-functionMap[HASH_ELEMENT_FLOAT4X3____FLOAT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x3____float4x3, &ColladaParserAutoGen14Private::_data__float4x3____float4x3, &ColladaParserAutoGen14Private::_end__float4x3____float4x3, &ColladaParserAutoGen14Private::_preBegin__float4x3____float4x3, &ColladaParserAutoGen14Private::_preEnd__float4x3____float4x3, &ColladaParserAutoGen14Private::_freeAttributes__float4x3____float4x3);
-functionMap[HASH_ELEMENT_FLOAT4X4____FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____float4x4, &ColladaParserAutoGen14Private::_data__float4x4____float4x4, &ColladaParserAutoGen14Private::_end__float4x4____float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____float4x4);
-functionMap[HASH_ELEMENT_INT____INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____int, &ColladaParserAutoGen14Private::_data__int____int, &ColladaParserAutoGen14Private::_end__int____int, &ColladaParserAutoGen14Private::_preBegin__int____int, &ColladaParserAutoGen14Private::_preEnd__int____int, &ColladaParserAutoGen14Private::_freeAttributes__int____int);
-functionMap[HASH_ELEMENT_INT2____INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____int2, &ColladaParserAutoGen14Private::_data__int2____int2, &ColladaParserAutoGen14Private::_end__int2____int2, &ColladaParserAutoGen14Private::_preBegin__int2____int2, &ColladaParserAutoGen14Private::_preEnd__int2____int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____int2);
-functionMap[HASH_ELEMENT_INT3____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____int3, &ColladaParserAutoGen14Private::_data__int3____int3, &ColladaParserAutoGen14Private::_end__int3____int3, &ColladaParserAutoGen14Private::_preBegin__int3____int3, &ColladaParserAutoGen14Private::_preEnd__int3____int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____int3);
-functionMap[HASH_ELEMENT_INT4____INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____int4, &ColladaParserAutoGen14Private::_data__int4____int4, &ColladaParserAutoGen14Private::_end__int4____int4, &ColladaParserAutoGen14Private::_preBegin__int4____int4, &ColladaParserAutoGen14Private::_preEnd__int4____int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____int4);
-functionMap[HASH_ELEMENT_MODIFIER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modifier, &ColladaParserAutoGen14Private::_data__modifier, &ColladaParserAutoGen14Private::_end__modifier, &ColladaParserAutoGen14Private::_preBegin__modifier, &ColladaParserAutoGen14Private::_preEnd__modifier, &ColladaParserAutoGen14Private::_freeAttributes__modifier);
-functionMap[HASH_ELEMENT_SAMPLER_STATE____GLES_SAMPLER_STATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_data__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_end__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_preBegin__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_preEnd__sampler_state____gles_sampler_state, &ColladaParserAutoGen14Private::_freeAttributes__sampler_state____gles_sampler_state);
-functionMap[HASH_ELEMENT_SEMANTIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__semantic, &ColladaParserAutoGen14Private::_data__semantic, &ColladaParserAutoGen14Private::_end__semantic, &ColladaParserAutoGen14Private::_preBegin__semantic, &ColladaParserAutoGen14Private::_preEnd__semantic, &ColladaParserAutoGen14Private::_freeAttributes__semantic);
-functionMap[HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_data__surface____fx_surface_common, &ColladaParserAutoGen14Private::_end__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preBegin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preEnd__surface____fx_surface_common, &ColladaParserAutoGen14Private::_freeAttributes__surface____fx_surface_common);
-functionMap[HASH_ELEMENT_TEXTURE_PIPELINE____GLES_TEXTURE_PIPELINE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture_pipeline____gles_texture_pipeline, &ColladaParserAutoGen14Private::_data__texture_pipeline____gles_texture_pipeline, &ColladaParserAutoGen14Private::_end__texture_pipeline____gles_texture_pipeline, &ColladaParserAutoGen14Private::_preBegin__texture_pipeline____gles_texture_pipeline, &ColladaParserAutoGen14Private::_preEnd__texture_pipeline____gles_texture_pipeline, &ColladaParserAutoGen14Private::_freeAttributes__texture_pipeline____gles_texture_pipeline);
-functionMap[HASH_ELEMENT_TEXTURE_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture_unit, &ColladaParserAutoGen14Private::_data__texture_unit, &ColladaParserAutoGen14Private::_end__texture_unit, &ColladaParserAutoGen14Private::_preBegin__texture_unit, &ColladaParserAutoGen14Private::_preEnd__texture_unit, &ColladaParserAutoGen14Private::_freeAttributes__texture_unit);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_WRAP_S____GLES_SAMPLER_WRAP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____gles_sampler_wrap, &ColladaParserAutoGen14Private::_data__wrap_s____gles_sampler_wrap, &ColladaParserAutoGen14Private::_end__wrap_s____gles_sampler_wrap, &ColladaParserAutoGen14Private::_preBegin__wrap_s____gles_sampler_wrap, &ColladaParserAutoGen14Private::_preEnd__wrap_s____gles_sampler_wrap, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____gles_sampler_wrap);
-functionMap[HASH_ELEMENT_WRAP_T____GLES_SAMPLER_WRAP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____gles_sampler_wrap, &ColladaParserAutoGen14Private::_data__wrap_t____gles_sampler_wrap, &ColladaParserAutoGen14Private::_end__wrap_t____gles_sampler_wrap, &ColladaParserAutoGen14Private::_preBegin__wrap_t____gles_sampler_wrap, &ColladaParserAutoGen14Private::_preEnd__wrap_t____gles_sampler_wrap, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____gles_sampler_wrap);
-functionMap[HASH_ELEMENT_TEXCOMBINER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texcombiner, &ColladaParserAutoGen14Private::_data__texcombiner, &ColladaParserAutoGen14Private::_end__texcombiner, &ColladaParserAutoGen14Private::_preBegin__texcombiner, &ColladaParserAutoGen14Private::_preEnd__texcombiner, &ColladaParserAutoGen14Private::_freeAttributes__texcombiner);
-functionMap[HASH_ELEMENT_TEXENV] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texenv, &ColladaParserAutoGen14Private::_data__texenv, &ColladaParserAutoGen14Private::_end__texenv, &ColladaParserAutoGen14Private::_preBegin__texenv, &ColladaParserAutoGen14Private::_preEnd__texenv, &ColladaParserAutoGen14Private::_freeAttributes__texenv);
-functionMap[HASH_ELEMENT_RGB] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__RGB, &ColladaParserAutoGen14Private::_data__RGB, &ColladaParserAutoGen14Private::_end__RGB, &ColladaParserAutoGen14Private::_preBegin__RGB, &ColladaParserAutoGen14Private::_preEnd__RGB, &ColladaParserAutoGen14Private::_freeAttributes__RGB);
-functionMap[HASH_ELEMENT_ALPHA____GLES_TEXCOMBINER_COMMANDALPHA_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__alpha____gles_texcombiner_commandAlpha_type, &ColladaParserAutoGen14Private::_data__alpha____gles_texcombiner_commandAlpha_type, &ColladaParserAutoGen14Private::_end__alpha____gles_texcombiner_commandAlpha_type, &ColladaParserAutoGen14Private::_preBegin__alpha____gles_texcombiner_commandAlpha_type, &ColladaParserAutoGen14Private::_preEnd__alpha____gles_texcombiner_commandAlpha_type, &ColladaParserAutoGen14Private::_freeAttributes__alpha____gles_texcombiner_commandAlpha_type);
-functionMap[HASH_ELEMENT_CONSTANT____GLES_TEXTURE_CONSTANT_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_data__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_end__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_preBegin__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_preEnd__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_freeAttributes__constant____gles_texture_constant_type);
-functionMap[HASH_ELEMENT_ARGUMENT____GLES_TEXCOMBINER_ARGUMENTRGB_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__argument____gles_texcombiner_argumentRGB_type, &ColladaParserAutoGen14Private::_data__argument____gles_texcombiner_argumentRGB_type, &ColladaParserAutoGen14Private::_end__argument____gles_texcombiner_argumentRGB_type, &ColladaParserAutoGen14Private::_preBegin__argument____gles_texcombiner_argumentRGB_type, &ColladaParserAutoGen14Private::_preEnd__argument____gles_texcombiner_argumentRGB_type, &ColladaParserAutoGen14Private::_freeAttributes__argument____gles_texcombiner_argumentRGB_type);
-functionMap[HASH_ELEMENT_ARGUMENT____GLES_TEXCOMBINER_ARGUMENTALPHA_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__argument____gles_texcombiner_argumentAlpha_type, &ColladaParserAutoGen14Private::_data__argument____gles_texcombiner_argumentAlpha_type, &ColladaParserAutoGen14Private::_end__argument____gles_texcombiner_argumentAlpha_type, &ColladaParserAutoGen14Private::_preBegin__argument____gles_texcombiner_argumentAlpha_type, &ColladaParserAutoGen14Private::_preEnd__argument____gles_texcombiner_argumentAlpha_type, &ColladaParserAutoGen14Private::_freeAttributes__argument____gles_texcombiner_argumentAlpha_type);
-functionMap[HASH_ELEMENT_CONSTANT____GLES_TEXTURE_CONSTANT_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_data__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_end__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_preBegin__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_preEnd__constant____gles_texture_constant_type, &ColladaParserAutoGen14Private::_freeAttributes__constant____gles_texture_constant_type);
-functionMap[HASH_ELEMENT_SAMPLER_STATE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler_state____NCName, &ColladaParserAutoGen14Private::_data__sampler_state____NCName, &ColladaParserAutoGen14Private::_end__sampler_state____NCName, &ColladaParserAutoGen14Private::_preBegin__sampler_state____NCName, &ColladaParserAutoGen14Private::_preEnd__sampler_state____NCName, &ColladaParserAutoGen14Private::_freeAttributes__sampler_state____NCName);
-functionMap[HASH_ELEMENT_SURFACE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____NCName, &ColladaParserAutoGen14Private::_data__surface____NCName, &ColladaParserAutoGen14Private::_end__surface____NCName, &ColladaParserAutoGen14Private::_preBegin__surface____NCName, &ColladaParserAutoGen14Private::_preEnd__surface____NCName, &ColladaParserAutoGen14Private::_freeAttributes__surface____NCName);
-functionMap[HASH_ELEMENT_TEXCOORD] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texcoord, &ColladaParserAutoGen14Private::_data__texcoord, &ColladaParserAutoGen14Private::_end__texcoord, &ColladaParserAutoGen14Private::_preBegin__texcoord, &ColladaParserAutoGen14Private::_preEnd__texcoord, &ColladaParserAutoGen14Private::_freeAttributes__texcoord);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_NEWPARAM____GLES_NEWPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____gles_newparam, &ColladaParserAutoGen14Private::_data__newparam____gles_newparam, &ColladaParserAutoGen14Private::_end__newparam____gles_newparam, &ColladaParserAutoGen14Private::_preBegin__newparam____gles_newparam, &ColladaParserAutoGen14Private::_preEnd__newparam____gles_newparam, &ColladaParserAutoGen14Private::_freeAttributes__newparam____gles_newparam);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__setparam, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__setparam, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__setparam, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__setparam, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__setparam, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__setparam);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__alpha_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__alpha_func);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__alpha_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__alpha_test_enable);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__blend_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__blend_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__blend_func, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__blend_func, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__blend_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__blend_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__blend_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__blend_func);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLEAR_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__clear_color, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__clear_color, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__clear_color, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__clear_color, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__clear_color, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__clear_color);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLEAR_DEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__clear_depth, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__clear_depth);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLEAR_STENCIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__clear_stencil, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__clear_stencil);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLIP_PLANE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__clip_plane, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__clip_plane);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLIP_PLANE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__clip_plane_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__clip_plane_enable);
-functionMap[HASH_ELEMENT_COLOR_CLEAR____FX_COLOR_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_clear____fx_color_common, &ColladaParserAutoGen14Private::_data__color_clear____fx_color_common, &ColladaParserAutoGen14Private::_end__color_clear____fx_color_common, &ColladaParserAutoGen14Private::_preBegin__color_clear____fx_color_common, &ColladaParserAutoGen14Private::_preEnd__color_clear____fx_color_common, &ColladaParserAutoGen14Private::_freeAttributes__color_clear____fx_color_common);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__COLOR_LOGIC_OP_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__color_logic_op_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__color_logic_op_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__COLOR_MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__color_mask, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__color_mask, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__color_mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__color_mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__color_mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__color_mask);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__COLOR_MATERIAL_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__color_material_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__color_material_enable);
-functionMap[HASH_ELEMENT_COLOR_TARGET____GLES_RENDERTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_data__color_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_end__color_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_preBegin__color_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_preEnd__color_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_freeAttributes__color_target____gles_rendertarget_common);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CULL_FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__cull_face, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__cull_face, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__cull_face, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__cull_face, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__cull_face, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__cull_face);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CULL_FACE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__cull_face_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__cull_face_enable);
-functionMap[HASH_ELEMENT_DEPTH_CLEAR____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_clear____float, &ColladaParserAutoGen14Private::_data__depth_clear____float, &ColladaParserAutoGen14Private::_end__depth_clear____float, &ColladaParserAutoGen14Private::_preBegin__depth_clear____float, &ColladaParserAutoGen14Private::_preEnd__depth_clear____float, &ColladaParserAutoGen14Private::_freeAttributes__depth_clear____float);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__depth_func, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__depth_func, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__depth_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__depth_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__depth_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__depth_func);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__depth_mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__depth_mask);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_RANGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__depth_range, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__depth_range, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__depth_range, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__depth_range, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__depth_range, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__depth_range);
-functionMap[HASH_ELEMENT_DEPTH_TARGET____GLES_RENDERTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_data__depth_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_end__depth_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_preBegin__depth_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_preEnd__depth_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_freeAttributes__depth_target____gles_rendertarget_common);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__depth_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__depth_test_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DITHER_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__dither_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__dither_enable);
-functionMap[HASH_ELEMENT_DRAW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__draw, &ColladaParserAutoGen14Private::_data__draw, &ColladaParserAutoGen14Private::_end__draw, &ColladaParserAutoGen14Private::_preBegin__draw, &ColladaParserAutoGen14Private::_preEnd__draw, &ColladaParserAutoGen14Private::_freeAttributes__draw);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__fog_color, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__fog_color, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__fog_color, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__fog_color, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__fog_color, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__fog_color);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_DENSITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__fog_density, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__fog_density, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__fog_density, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__fog_density, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__fog_density, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__fog_density);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__fog_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__fog_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_END] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__fog_end, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__fog_end, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__fog_end, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__fog_end, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__fog_end, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__fog_end);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_MODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__fog_mode, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__fog_mode);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_START] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__fog_start, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__fog_start, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__fog_start, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__fog_start, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__fog_start, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__fog_start);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FRONT_FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__front_face, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__front_face, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__front_face, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__front_face, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__front_face, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__front_face);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_AMBIENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_ambient, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_ambient);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_CONSTANT_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_constant_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_constant_attenuation);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_diffuse, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_diffuse);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_enable);
-functionMap[HASH_ELEMENT_LIGHT_LINEAR_ATTENUTATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light_linear_attenutation, &ColladaParserAutoGen14Private::_data__light_linear_attenutation, &ColladaParserAutoGen14Private::_end__light_linear_attenutation, &ColladaParserAutoGen14Private::_preBegin__light_linear_attenutation, &ColladaParserAutoGen14Private::_preEnd__light_linear_attenutation, &ColladaParserAutoGen14Private::_freeAttributes__light_linear_attenutation);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_MODEL_AMBIENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_model_ambient, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_model_ambient);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_MODEL_TWO_SIDE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_model_two_side_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_model_two_side_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_POSITION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_position, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_position, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_position, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_position, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_position, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_position);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_QUADRATIC_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_quadratic_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_quadratic_attenuation);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPECULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_specular, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_specular, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_specular, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_specular, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_specular, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_specular);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPOT_CUTOFF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_spot_cutoff, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_spot_cutoff);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPOT_DIRECTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_spot_direction, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_spot_direction);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPOT_EXPONENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__light_spot_exponent, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__light_spot_exponent);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHTING_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__lighting_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__lighting_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LINE_SMOOTH_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__line_smooth_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__line_smooth_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LINE_WIDTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__line_width, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__line_width, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__line_width, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__line_width, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__line_width, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__line_width);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LOGIC_OP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__logic_op, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__logic_op, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__logic_op, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__logic_op, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__logic_op, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__logic_op);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_AMBIENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__material_ambient, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__material_ambient);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_DIFFUSE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__material_diffuse, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__material_diffuse);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_EMISSION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__material_emission, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__material_emission, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__material_emission, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__material_emission, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__material_emission, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__material_emission);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_SHININESS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__material_shininess, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__material_shininess);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_SPECULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__material_specular, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__material_specular, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__material_specular, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__material_specular, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__material_specular, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__material_specular);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MODEL_VIEW_MATRIX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__model_view_matrix, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__model_view_matrix);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MULTISAMPLE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__multisample_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__multisample_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__NORMALIZE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__normalize_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__normalize_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_DISTANCE_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__point_distance_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__point_distance_attenuation);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_FADE_THRESHOLD_SIZE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__point_fade_threshold_size, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__point_fade_threshold_size);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SIZE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__point_size, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__point_size, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__point_size, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__point_size, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__point_size, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__point_size);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SIZE_MAX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__point_size_max, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__point_size_max);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SIZE_MIN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__point_size_min, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__point_size_min);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SMOOTH_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__point_smooth_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__point_smooth_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POLYGON_OFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__polygon_offset, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__polygon_offset);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POLYGON_OFFSET_FILL_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__polygon_offset_fill_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__polygon_offset_fill_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__PROJECTION_MATRIX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__projection_matrix, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__projection_matrix);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__RESCALE_NORMAL_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__rescale_normal_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__rescale_normal_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_COVERAGE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__sample_alpha_to_coverage_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__sample_alpha_to_coverage_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_ONE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__sample_alpha_to_one_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__sample_alpha_to_one_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SAMPLE_COVERAGE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__sample_coverage_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__sample_coverage_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SCISSOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__scissor, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__scissor, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__scissor, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__scissor, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__scissor, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__scissor);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SCISSOR_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__scissor_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__scissor_test_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SHADE_MODEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__shade_model, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__shade_model, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__shade_model, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__shade_model, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__shade_model, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__shade_model);
-functionMap[HASH_ELEMENT_STENCIL_CLEAR____BYTE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_clear____byte, &ColladaParserAutoGen14Private::_data__stencil_clear____byte, &ColladaParserAutoGen14Private::_end__stencil_clear____byte, &ColladaParserAutoGen14Private::_preBegin__stencil_clear____byte, &ColladaParserAutoGen14Private::_preEnd__stencil_clear____byte, &ColladaParserAutoGen14Private::_freeAttributes__stencil_clear____byte);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_func);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_mask);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_op, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_op);
-functionMap[HASH_ELEMENT_STENCIL_TARGET____GLES_RENDERTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_data__stencil_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_end__stencil_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_preBegin__stencil_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_preEnd__stencil_target____gles_rendertarget_common, &ColladaParserAutoGen14Private::_freeAttributes__stencil_target____gles_rendertarget_common);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_TEST_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_test_enable, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_test_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__TEXTURE_PIPELINE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__texture_pipeline, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__texture_pipeline);
-functionMap[HASH_ELEMENT_TEXTURE_PIPELINE_ENABLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__texture_pipeline_enable, &ColladaParserAutoGen14Private::_data__texture_pipeline_enable, &ColladaParserAutoGen14Private::_end__texture_pipeline_enable, &ColladaParserAutoGen14Private::_preBegin__texture_pipeline_enable, &ColladaParserAutoGen14Private::_preEnd__texture_pipeline_enable, &ColladaParserAutoGen14Private::_freeAttributes__texture_pipeline_enable);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC__FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__alpha_func__func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__alpha_func__func);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC__VALUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__alpha_func__value, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__alpha_func__value);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_FUNC__DEST] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__blend_func__dest, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__blend_func__dest);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_FUNC__SRC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__blend_func__src, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__blend_func__src);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC__FUNC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_func__func, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_func__func);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC__MASK] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_func__mask, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_func__mask);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC__REF] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_func__ref, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_func__ref);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP__FAIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_op__fail, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_op__fail);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP__ZFAIL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_op__zfail, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_op__zfail);
-functionMap[HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP__ZPASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLES__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_data__profile_GLES__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_end__profile_GLES__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_preBegin__profile_GLES__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_preEnd__profile_GLES__technique__pass__stencil_op__zpass, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLES__technique__pass__stencil_op__zpass);
-functionMap[HASH_ELEMENT_VALUE____GLES_TEXTURE_PIPELINE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__value____gles_texture_pipeline, &ColladaParserAutoGen14Private::_data__value____gles_texture_pipeline, &ColladaParserAutoGen14Private::_end__value____gles_texture_pipeline, &ColladaParserAutoGen14Private::_preBegin__value____gles_texture_pipeline, &ColladaParserAutoGen14Private::_preEnd__value____gles_texture_pipeline, &ColladaParserAutoGen14Private::_freeAttributes__value____gles_texture_pipeline);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_CODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__code, &ColladaParserAutoGen14Private::_data__code, &ColladaParserAutoGen14Private::_end__code, &ColladaParserAutoGen14Private::_preBegin__code, &ColladaParserAutoGen14Private::_preEnd__code, &ColladaParserAutoGen14Private::_freeAttributes__code);
-functionMap[HASH_ELEMENT_INCLUDE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__include, &ColladaParserAutoGen14Private::_data__include, &ColladaParserAutoGen14Private::_end__include, &ColladaParserAutoGen14Private::_preBegin__include, &ColladaParserAutoGen14Private::_preEnd__include, &ColladaParserAutoGen14Private::_freeAttributes__include);
-functionMap[HASH_ELEMENT_NEWPARAM____GLSL_NEWPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_data__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_end__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_preBegin__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_preEnd__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_freeAttributes__newparam____glsl_newparam);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_ARRAY____GLSL_NEWARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_data__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_end__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_preBegin__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_preEnd__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____glsl_newarray_type);
-functionMap[HASH_ELEMENT_BOOL____GLSL_BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____glsl_bool, &ColladaParserAutoGen14Private::_data__bool____glsl_bool, &ColladaParserAutoGen14Private::_end__bool____glsl_bool, &ColladaParserAutoGen14Private::_preBegin__bool____glsl_bool, &ColladaParserAutoGen14Private::_preEnd__bool____glsl_bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____glsl_bool);
-functionMap[HASH_ELEMENT_BOOL2____GLSL_BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_data__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_end__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____glsl_bool2);
-functionMap[HASH_ELEMENT_BOOL3____GLSL_BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_data__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_end__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____glsl_bool3);
-functionMap[HASH_ELEMENT_BOOL4____GLSL_BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_data__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_end__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____glsl_bool4);
-functionMap[HASH_ELEMENT_ENUM____GL_ENUMERATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_data__enum____gl_enumeration, &ColladaParserAutoGen14Private::_end__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preBegin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preEnd__enum____gl_enumeration, &ColladaParserAutoGen14Private::_freeAttributes__enum____gl_enumeration);
-functionMap[HASH_ELEMENT_FLOAT____GLSL_FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____glsl_float, &ColladaParserAutoGen14Private::_data__float____glsl_float, &ColladaParserAutoGen14Private::_end__float____glsl_float, &ColladaParserAutoGen14Private::_preBegin__float____glsl_float, &ColladaParserAutoGen14Private::_preEnd__float____glsl_float, &ColladaParserAutoGen14Private::_freeAttributes__float____glsl_float);
-functionMap[HASH_ELEMENT_FLOAT2____GLSL_FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____glsl_float2, &ColladaParserAutoGen14Private::_data__float2____glsl_float2, &ColladaParserAutoGen14Private::_end__float2____glsl_float2, &ColladaParserAutoGen14Private::_preBegin__float2____glsl_float2, &ColladaParserAutoGen14Private::_preEnd__float2____glsl_float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____glsl_float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____GLSL_FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_data__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_end__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____glsl_float2x2);
-functionMap[HASH_ELEMENT_FLOAT3____GLSL_FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____glsl_float3, &ColladaParserAutoGen14Private::_data__float3____glsl_float3, &ColladaParserAutoGen14Private::_end__float3____glsl_float3, &ColladaParserAutoGen14Private::_preBegin__float3____glsl_float3, &ColladaParserAutoGen14Private::_preEnd__float3____glsl_float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____glsl_float3);
-functionMap[HASH_ELEMENT_FLOAT3X3____GLSL_FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_data__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_end__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____glsl_float3x3);
-functionMap[HASH_ELEMENT_FLOAT4____GLSL_FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____glsl_float4, &ColladaParserAutoGen14Private::_data__float4____glsl_float4, &ColladaParserAutoGen14Private::_end__float4____glsl_float4, &ColladaParserAutoGen14Private::_preBegin__float4____glsl_float4, &ColladaParserAutoGen14Private::_preEnd__float4____glsl_float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____glsl_float4);
-functionMap[HASH_ELEMENT_FLOAT4X4____GLSL_FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_data__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_end__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____glsl_float4x4);
-functionMap[HASH_ELEMENT_INT____GLSL_INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____glsl_int, &ColladaParserAutoGen14Private::_data__int____glsl_int, &ColladaParserAutoGen14Private::_end__int____glsl_int, &ColladaParserAutoGen14Private::_preBegin__int____glsl_int, &ColladaParserAutoGen14Private::_preEnd__int____glsl_int, &ColladaParserAutoGen14Private::_freeAttributes__int____glsl_int);
-functionMap[HASH_ELEMENT_INT2____GLSL_INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____glsl_int2, &ColladaParserAutoGen14Private::_data__int2____glsl_int2, &ColladaParserAutoGen14Private::_end__int2____glsl_int2, &ColladaParserAutoGen14Private::_preBegin__int2____glsl_int2, &ColladaParserAutoGen14Private::_preEnd__int2____glsl_int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____glsl_int2);
-functionMap[HASH_ELEMENT_INT3____GLSL_INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____glsl_int3, &ColladaParserAutoGen14Private::_data__int3____glsl_int3, &ColladaParserAutoGen14Private::_end__int3____glsl_int3, &ColladaParserAutoGen14Private::_preBegin__int3____glsl_int3, &ColladaParserAutoGen14Private::_preEnd__int3____glsl_int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____glsl_int3);
-functionMap[HASH_ELEMENT_INT4____GLSL_INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____glsl_int4, &ColladaParserAutoGen14Private::_data__int4____glsl_int4, &ColladaParserAutoGen14Private::_end__int4____glsl_int4, &ColladaParserAutoGen14Private::_preBegin__int4____glsl_int4, &ColladaParserAutoGen14Private::_preEnd__int4____glsl_int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____glsl_int4);
-functionMap[HASH_ELEMENT_MODIFIER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modifier, &ColladaParserAutoGen14Private::_data__modifier, &ColladaParserAutoGen14Private::_end__modifier, &ColladaParserAutoGen14Private::_preBegin__modifier, &ColladaParserAutoGen14Private::_preEnd__modifier, &ColladaParserAutoGen14Private::_freeAttributes__modifier);
-functionMap[HASH_ELEMENT_SAMPLER1D____GL_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_data__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_end__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_preBegin__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_preEnd__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____gl_sampler1D);
-functionMap[HASH_ELEMENT_SAMPLER2D____GL_SAMPLER2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_data__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_end__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_preBegin__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_preEnd__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____gl_sampler2D);
-functionMap[HASH_ELEMENT_SAMPLER3D____GL_SAMPLER3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_data__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_end__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_preBegin__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_preEnd__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____gl_sampler3D);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____GL_SAMPLERCUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_data__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_end__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____gl_samplerCUBE);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____GL_SAMPLERDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_data__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_end__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____gl_samplerDEPTH);
-functionMap[HASH_ELEMENT_SAMPLERRECT____GL_SAMPLERRECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_data__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_end__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____gl_samplerRECT);
-functionMap[HASH_ELEMENT_SEMANTIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__semantic, &ColladaParserAutoGen14Private::_data__semantic, &ColladaParserAutoGen14Private::_end__semantic, &ColladaParserAutoGen14Private::_preBegin__semantic, &ColladaParserAutoGen14Private::_preEnd__semantic, &ColladaParserAutoGen14Private::_freeAttributes__semantic);
-functionMap[HASH_ELEMENT_SURFACE____GLSL_SURFACE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_data__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_end__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_preBegin__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_preEnd__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_freeAttributes__surface____glsl_surface_type);
-functionMap[HASH_ELEMENT_ARRAY____GLSL_NEWARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_data__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_end__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_preBegin__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_preEnd__array____glsl_newarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____glsl_newarray_type);
-functionMap[HASH_ELEMENT_BOOL____GLSL_BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____glsl_bool, &ColladaParserAutoGen14Private::_data__bool____glsl_bool, &ColladaParserAutoGen14Private::_end__bool____glsl_bool, &ColladaParserAutoGen14Private::_preBegin__bool____glsl_bool, &ColladaParserAutoGen14Private::_preEnd__bool____glsl_bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____glsl_bool);
-functionMap[HASH_ELEMENT_BOOL2____GLSL_BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_data__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_end__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____glsl_bool2);
-functionMap[HASH_ELEMENT_BOOL3____GLSL_BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_data__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_end__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____glsl_bool3);
-functionMap[HASH_ELEMENT_BOOL4____GLSL_BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_data__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_end__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____glsl_bool4);
-functionMap[HASH_ELEMENT_ENUM____GL_ENUMERATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_data__enum____gl_enumeration, &ColladaParserAutoGen14Private::_end__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preBegin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preEnd__enum____gl_enumeration, &ColladaParserAutoGen14Private::_freeAttributes__enum____gl_enumeration);
-functionMap[HASH_ELEMENT_FLOAT____GLSL_FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____glsl_float, &ColladaParserAutoGen14Private::_data__float____glsl_float, &ColladaParserAutoGen14Private::_end__float____glsl_float, &ColladaParserAutoGen14Private::_preBegin__float____glsl_float, &ColladaParserAutoGen14Private::_preEnd__float____glsl_float, &ColladaParserAutoGen14Private::_freeAttributes__float____glsl_float);
-functionMap[HASH_ELEMENT_FLOAT2____GLSL_FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____glsl_float2, &ColladaParserAutoGen14Private::_data__float2____glsl_float2, &ColladaParserAutoGen14Private::_end__float2____glsl_float2, &ColladaParserAutoGen14Private::_preBegin__float2____glsl_float2, &ColladaParserAutoGen14Private::_preEnd__float2____glsl_float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____glsl_float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____GLSL_FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_data__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_end__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____glsl_float2x2);
-functionMap[HASH_ELEMENT_FLOAT3____GLSL_FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____glsl_float3, &ColladaParserAutoGen14Private::_data__float3____glsl_float3, &ColladaParserAutoGen14Private::_end__float3____glsl_float3, &ColladaParserAutoGen14Private::_preBegin__float3____glsl_float3, &ColladaParserAutoGen14Private::_preEnd__float3____glsl_float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____glsl_float3);
-functionMap[HASH_ELEMENT_FLOAT3X3____GLSL_FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_data__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_end__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____glsl_float3x3);
-functionMap[HASH_ELEMENT_FLOAT4____GLSL_FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____glsl_float4, &ColladaParserAutoGen14Private::_data__float4____glsl_float4, &ColladaParserAutoGen14Private::_end__float4____glsl_float4, &ColladaParserAutoGen14Private::_preBegin__float4____glsl_float4, &ColladaParserAutoGen14Private::_preEnd__float4____glsl_float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____glsl_float4);
-functionMap[HASH_ELEMENT_FLOAT4X4____GLSL_FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_data__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_end__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____glsl_float4x4);
-functionMap[HASH_ELEMENT_INT____GLSL_INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____glsl_int, &ColladaParserAutoGen14Private::_data__int____glsl_int, &ColladaParserAutoGen14Private::_end__int____glsl_int, &ColladaParserAutoGen14Private::_preBegin__int____glsl_int, &ColladaParserAutoGen14Private::_preEnd__int____glsl_int, &ColladaParserAutoGen14Private::_freeAttributes__int____glsl_int);
-functionMap[HASH_ELEMENT_INT2____GLSL_INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____glsl_int2, &ColladaParserAutoGen14Private::_data__int2____glsl_int2, &ColladaParserAutoGen14Private::_end__int2____glsl_int2, &ColladaParserAutoGen14Private::_preBegin__int2____glsl_int2, &ColladaParserAutoGen14Private::_preEnd__int2____glsl_int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____glsl_int2);
-functionMap[HASH_ELEMENT_INT3____GLSL_INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____glsl_int3, &ColladaParserAutoGen14Private::_data__int3____glsl_int3, &ColladaParserAutoGen14Private::_end__int3____glsl_int3, &ColladaParserAutoGen14Private::_preBegin__int3____glsl_int3, &ColladaParserAutoGen14Private::_preEnd__int3____glsl_int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____glsl_int3);
-functionMap[HASH_ELEMENT_INT4____GLSL_INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____glsl_int4, &ColladaParserAutoGen14Private::_data__int4____glsl_int4, &ColladaParserAutoGen14Private::_end__int4____glsl_int4, &ColladaParserAutoGen14Private::_preBegin__int4____glsl_int4, &ColladaParserAutoGen14Private::_preEnd__int4____glsl_int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____glsl_int4);
-functionMap[HASH_ELEMENT_SAMPLER1D____GL_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_data__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_end__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_preBegin__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_preEnd__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____gl_sampler1D);
-functionMap[HASH_ELEMENT_SAMPLER2D____GL_SAMPLER2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_data__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_end__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_preBegin__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_preEnd__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____gl_sampler2D);
-functionMap[HASH_ELEMENT_SAMPLER3D____GL_SAMPLER3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_data__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_end__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_preBegin__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_preEnd__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____gl_sampler3D);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____GL_SAMPLERCUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_data__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_end__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____gl_samplerCUBE);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____GL_SAMPLERDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_data__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_end__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____gl_samplerDEPTH);
-functionMap[HASH_ELEMENT_SAMPLERRECT____GL_SAMPLERRECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_data__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_end__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____gl_samplerRECT);
-functionMap[HASH_ELEMENT_SURFACE____GLSL_SURFACE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_data__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_end__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_preBegin__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_preEnd__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_freeAttributes__surface____glsl_surface_type);
-functionMap[HASH_ELEMENT_BOOL____GLSL_BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____glsl_bool, &ColladaParserAutoGen14Private::_data__bool____glsl_bool, &ColladaParserAutoGen14Private::_end__bool____glsl_bool, &ColladaParserAutoGen14Private::_preBegin__bool____glsl_bool, &ColladaParserAutoGen14Private::_preEnd__bool____glsl_bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____glsl_bool);
-functionMap[HASH_ELEMENT_BOOL2____GLSL_BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_data__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_end__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____glsl_bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____glsl_bool2);
-functionMap[HASH_ELEMENT_BOOL3____GLSL_BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_data__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_end__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____glsl_bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____glsl_bool3);
-functionMap[HASH_ELEMENT_BOOL4____GLSL_BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_data__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_end__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____glsl_bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____glsl_bool4);
-functionMap[HASH_ELEMENT_ENUM____GL_ENUMERATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_data__enum____gl_enumeration, &ColladaParserAutoGen14Private::_end__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preBegin__enum____gl_enumeration, &ColladaParserAutoGen14Private::_preEnd__enum____gl_enumeration, &ColladaParserAutoGen14Private::_freeAttributes__enum____gl_enumeration);
-functionMap[HASH_ELEMENT_FLOAT____GLSL_FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____glsl_float, &ColladaParserAutoGen14Private::_data__float____glsl_float, &ColladaParserAutoGen14Private::_end__float____glsl_float, &ColladaParserAutoGen14Private::_preBegin__float____glsl_float, &ColladaParserAutoGen14Private::_preEnd__float____glsl_float, &ColladaParserAutoGen14Private::_freeAttributes__float____glsl_float);
-functionMap[HASH_ELEMENT_FLOAT2____GLSL_FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____glsl_float2, &ColladaParserAutoGen14Private::_data__float2____glsl_float2, &ColladaParserAutoGen14Private::_end__float2____glsl_float2, &ColladaParserAutoGen14Private::_preBegin__float2____glsl_float2, &ColladaParserAutoGen14Private::_preEnd__float2____glsl_float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____glsl_float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____GLSL_FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_data__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_end__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____glsl_float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____glsl_float2x2);
-functionMap[HASH_ELEMENT_FLOAT3____GLSL_FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____glsl_float3, &ColladaParserAutoGen14Private::_data__float3____glsl_float3, &ColladaParserAutoGen14Private::_end__float3____glsl_float3, &ColladaParserAutoGen14Private::_preBegin__float3____glsl_float3, &ColladaParserAutoGen14Private::_preEnd__float3____glsl_float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____glsl_float3);
-functionMap[HASH_ELEMENT_FLOAT3X3____GLSL_FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_data__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_end__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____glsl_float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____glsl_float3x3);
-functionMap[HASH_ELEMENT_FLOAT4____GLSL_FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____glsl_float4, &ColladaParserAutoGen14Private::_data__float4____glsl_float4, &ColladaParserAutoGen14Private::_end__float4____glsl_float4, &ColladaParserAutoGen14Private::_preBegin__float4____glsl_float4, &ColladaParserAutoGen14Private::_preEnd__float4____glsl_float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____glsl_float4);
-functionMap[HASH_ELEMENT_FLOAT4X4____GLSL_FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_data__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_end__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____glsl_float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____glsl_float4x4);
-functionMap[HASH_ELEMENT_INT____GLSL_INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____glsl_int, &ColladaParserAutoGen14Private::_data__int____glsl_int, &ColladaParserAutoGen14Private::_end__int____glsl_int, &ColladaParserAutoGen14Private::_preBegin__int____glsl_int, &ColladaParserAutoGen14Private::_preEnd__int____glsl_int, &ColladaParserAutoGen14Private::_freeAttributes__int____glsl_int);
-functionMap[HASH_ELEMENT_INT2____GLSL_INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____glsl_int2, &ColladaParserAutoGen14Private::_data__int2____glsl_int2, &ColladaParserAutoGen14Private::_end__int2____glsl_int2, &ColladaParserAutoGen14Private::_preBegin__int2____glsl_int2, &ColladaParserAutoGen14Private::_preEnd__int2____glsl_int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____glsl_int2);
-functionMap[HASH_ELEMENT_INT3____GLSL_INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____glsl_int3, &ColladaParserAutoGen14Private::_data__int3____glsl_int3, &ColladaParserAutoGen14Private::_end__int3____glsl_int3, &ColladaParserAutoGen14Private::_preBegin__int3____glsl_int3, &ColladaParserAutoGen14Private::_preEnd__int3____glsl_int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____glsl_int3);
-functionMap[HASH_ELEMENT_INT4____GLSL_INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____glsl_int4, &ColladaParserAutoGen14Private::_data__int4____glsl_int4, &ColladaParserAutoGen14Private::_end__int4____glsl_int4, &ColladaParserAutoGen14Private::_preBegin__int4____glsl_int4, &ColladaParserAutoGen14Private::_preEnd__int4____glsl_int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____glsl_int4);
-functionMap[HASH_ELEMENT_SAMPLER1D____GL_SAMPLER1D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_data__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_end__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_preBegin__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_preEnd__sampler1D____gl_sampler1D, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____gl_sampler1D);
-functionMap[HASH_ELEMENT_SAMPLER2D____GL_SAMPLER2D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_data__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_end__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_preBegin__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_preEnd__sampler2D____gl_sampler2D, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____gl_sampler2D);
-functionMap[HASH_ELEMENT_SAMPLER3D____GL_SAMPLER3D] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_data__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_end__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_preBegin__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_preEnd__sampler3D____gl_sampler3D, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____gl_sampler3D);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____GL_SAMPLERCUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_data__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_end__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____gl_samplerCUBE, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____gl_samplerCUBE);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____GL_SAMPLERDEPTH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_data__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_end__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____gl_samplerDEPTH, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____gl_samplerDEPTH);
-functionMap[HASH_ELEMENT_SAMPLERRECT____GL_SAMPLERRECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_data__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_end__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____gl_samplerRECT, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____gl_samplerRECT);
-functionMap[HASH_ELEMENT_SURFACE____GLSL_SURFACE_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_data__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_end__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_preBegin__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_preEnd__surface____glsl_surface_type, &ColladaParserAutoGen14Private::_freeAttributes__surface____glsl_surface_type);
-functionMap[HASH_ELEMENT_GLSL_SURFACE_TYPE____GENERATOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_data__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_end__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_preBegin__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_preEnd__glsl_surface_type____generator, &ColladaParserAutoGen14Private::_freeAttributes__glsl_surface_type____generator);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_CODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__code, &ColladaParserAutoGen14Private::_data__code, &ColladaParserAutoGen14Private::_end__code, &ColladaParserAutoGen14Private::_preBegin__code, &ColladaParserAutoGen14Private::_preEnd__code, &ColladaParserAutoGen14Private::_freeAttributes__code);
-functionMap[HASH_ELEMENT_INCLUDE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__include, &ColladaParserAutoGen14Private::_data__include, &ColladaParserAutoGen14Private::_end__include, &ColladaParserAutoGen14Private::_preBegin__include, &ColladaParserAutoGen14Private::_preEnd__include, &ColladaParserAutoGen14Private::_freeAttributes__include);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__NEWPARAM__SURFACE__GENERATOR__NAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_data__profile_GLSL__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_end__profile_GLSL__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__newparam__surface__generator__name, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__newparam__surface__generator__name);
-functionMap[HASH_ELEMENT_SETPARAM____GLSL_SETPARAM_SIMPLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__setparam____glsl_setparam_simple, &ColladaParserAutoGen14Private::_data__setparam____glsl_setparam_simple, &ColladaParserAutoGen14Private::_end__setparam____glsl_setparam_simple, &ColladaParserAutoGen14Private::_preBegin__setparam____glsl_setparam_simple, &ColladaParserAutoGen14Private::_preEnd__setparam____glsl_setparam_simple, &ColladaParserAutoGen14Private::_freeAttributes__setparam____glsl_setparam_simple);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_CODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__code, &ColladaParserAutoGen14Private::_data__code, &ColladaParserAutoGen14Private::_end__code, &ColladaParserAutoGen14Private::_preBegin__code, &ColladaParserAutoGen14Private::_preEnd__code, &ColladaParserAutoGen14Private::_freeAttributes__code);
-functionMap[HASH_ELEMENT_INCLUDE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__include, &ColladaParserAutoGen14Private::_data__include, &ColladaParserAutoGen14Private::_end__include, &ColladaParserAutoGen14Private::_preBegin__include, &ColladaParserAutoGen14Private::_preEnd__include, &ColladaParserAutoGen14Private::_freeAttributes__include);
-functionMap[HASH_ELEMENT_NEWPARAM____GLSL_NEWPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_data__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_end__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_preBegin__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_preEnd__newparam____glsl_newparam, &ColladaParserAutoGen14Private::_freeAttributes__newparam____glsl_newparam);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass);
-functionMap[HASH_ELEMENT_SETPARAM____GLSL_SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__setparam____glsl_setparam, &ColladaParserAutoGen14Private::_data__setparam____glsl_setparam, &ColladaParserAutoGen14Private::_end__setparam____glsl_setparam, &ColladaParserAutoGen14Private::_preBegin__setparam____glsl_setparam, &ColladaParserAutoGen14Private::_preEnd__setparam____glsl_setparam, &ColladaParserAutoGen14Private::_freeAttributes__setparam____glsl_setparam);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_COLOR_CLEAR____FX_CLEARCOLOR_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_data__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_end__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_preBegin__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_preEnd__color_clear____fx_clearcolor_common, &ColladaParserAutoGen14Private::_freeAttributes__color_clear____fx_clearcolor_common);
-functionMap[HASH_ELEMENT_COLOR_TARGET____FX_COLORTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_data__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_end__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_preBegin__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_preEnd__color_target____fx_colortarget_common, &ColladaParserAutoGen14Private::_freeAttributes__color_target____fx_colortarget_common);
-functionMap[HASH_ELEMENT_DEPTH_CLEAR____FX_CLEARDEPTH_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_data__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_end__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_preBegin__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_preEnd__depth_clear____fx_cleardepth_common, &ColladaParserAutoGen14Private::_freeAttributes__depth_clear____fx_cleardepth_common);
-functionMap[HASH_ELEMENT_DEPTH_TARGET____FX_DEPTHTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_data__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_end__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_preBegin__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_preEnd__depth_target____fx_depthtarget_common, &ColladaParserAutoGen14Private::_freeAttributes__depth_target____fx_depthtarget_common);
-functionMap[HASH_ELEMENT_DRAW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__draw, &ColladaParserAutoGen14Private::_data__draw, &ColladaParserAutoGen14Private::_end__draw, &ColladaParserAutoGen14Private::_preBegin__draw, &ColladaParserAutoGen14Private::_preEnd__draw, &ColladaParserAutoGen14Private::_freeAttributes__draw);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shader, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shader);
-functionMap[HASH_ELEMENT_STENCIL_CLEAR____FX_CLEARSTENCIL_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_data__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_end__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_preBegin__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_preEnd__stencil_clear____fx_clearstencil_common, &ColladaParserAutoGen14Private::_freeAttributes__stencil_clear____fx_clearstencil_common);
-functionMap[HASH_ELEMENT_STENCIL_TARGET____FX_STENCILTARGET_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_data__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_end__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_preBegin__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_preEnd__stencil_target____fx_stenciltarget_common, &ColladaParserAutoGen14Private::_freeAttributes__stencil_target____fx_stenciltarget_common);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__BIND] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shader__bind, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shader__bind);
-functionMap[HASH_ELEMENT_COMPILER_OPTIONS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__compiler_options, &ColladaParserAutoGen14Private::_data__compiler_options, &ColladaParserAutoGen14Private::_end__compiler_options, &ColladaParserAutoGen14Private::_preBegin__compiler_options, &ColladaParserAutoGen14Private::_preEnd__compiler_options, &ColladaParserAutoGen14Private::_freeAttributes__compiler_options);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__COMPILER_TARGET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shader__compiler_target, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shader__compiler_target);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__NAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shader__name, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shader__name, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shader__name, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shader__name, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shader__name, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shader__name);
-functionMap[HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__BIND__PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__profile_GLSL__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_data__profile_GLSL__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_end__profile_GLSL__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_preBegin__profile_GLSL__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_preEnd__profile_GLSL__technique__pass__shader__bind__param, &ColladaParserAutoGen14Private::_freeAttributes__profile_GLSL__technique__pass__shader__bind__param);
-functionMap[HASH_ELEMENT_ANNOTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__annotate, &ColladaParserAutoGen14Private::_data__annotate, &ColladaParserAutoGen14Private::_end__annotate, &ColladaParserAutoGen14Private::_preBegin__annotate, &ColladaParserAutoGen14Private::_preEnd__annotate, &ColladaParserAutoGen14Private::_freeAttributes__annotate);
-functionMap[HASH_ELEMENT_ARRAY____GLSL_SETARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_data__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_end__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_preBegin__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_preEnd__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____glsl_setarray_type);
-functionMap[HASH_ELEMENT_ARRAY____GLSL_SETARRAY_TYPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_data__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_end__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_preBegin__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_preEnd__array____glsl_setarray_type, &ColladaParserAutoGen14Private::_freeAttributes__array____glsl_setarray_type);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_EFFECTS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EFFECT,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_IMAGE,
+HASH_ELEMENT_NEWPARAM____FX_NEWPARAM_COMMON,
+HASH_ELEMENT_PROFILE_CG,
+HASH_ELEMENT_PROFILE_COMMON,
+HASH_ELEMENT_PROFILE_GLES,
+HASH_ELEMENT_PROFILE_GLSL,
+HASH_ELEMENT_BOOL____BOOL,
+HASH_ELEMENT_BOOL2____BOOL2,
+HASH_ELEMENT_BOOL3____BOOL3,
+HASH_ELEMENT_BOOL4____BOOL4,
+HASH_ELEMENT_FLOAT____FLOAT,
+HASH_ELEMENT_FLOAT2____FLOAT2,
+HASH_ELEMENT_FLOAT2X2____FLOAT2X2,
+HASH_ELEMENT_FLOAT3____FLOAT3,
+HASH_ELEMENT_FLOAT3X3____FLOAT3X3,
+HASH_ELEMENT_FLOAT4____FLOAT4,
+HASH_ELEMENT_FLOAT4X4____FLOAT4X4,
+HASH_ELEMENT_INT____INT,
+HASH_ELEMENT_INT2____INT2,
+HASH_ELEMENT_INT3____INT3,
+HASH_ELEMENT_INT4____INT4,
+HASH_ELEMENT_STRING,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_DATA,
+HASH_ELEMENT_INIT_FROM____ANYURI,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_BOOL____BOOL,
+HASH_ELEMENT_BOOL2____BOOL2,
+HASH_ELEMENT_BOOL3____BOOL3,
+HASH_ELEMENT_BOOL4____BOOL4,
+HASH_ELEMENT_ENUM____STRING,
+HASH_ELEMENT_FLOAT____FLOAT,
+HASH_ELEMENT_FLOAT1X1____FLOAT,
+HASH_ELEMENT_FLOAT1X2____FLOAT2,
+HASH_ELEMENT_FLOAT1X3____FLOAT3,
+HASH_ELEMENT_FLOAT1X4____FLOAT4,
+HASH_ELEMENT_FLOAT2____FLOAT2,
+HASH_ELEMENT_FLOAT2X1____FLOAT2,
+HASH_ELEMENT_FLOAT2X2____FLOAT2X2,
+HASH_ELEMENT_FLOAT2X3____FLOAT2X3,
+HASH_ELEMENT_FLOAT2X4____FLOAT2X4,
+HASH_ELEMENT_FLOAT3____FLOAT3,
+HASH_ELEMENT_FLOAT3X1____FLOAT3,
+HASH_ELEMENT_FLOAT3X2____FLOAT3X2,
+HASH_ELEMENT_FLOAT3X3____FLOAT3X3,
+HASH_ELEMENT_FLOAT3X4____FLOAT3X4,
+HASH_ELEMENT_FLOAT4____FLOAT4,
+HASH_ELEMENT_FLOAT4X1____FLOAT4,
+HASH_ELEMENT_FLOAT4X2____FLOAT4X2,
+HASH_ELEMENT_FLOAT4X3____FLOAT4X3,
+HASH_ELEMENT_FLOAT4X4____FLOAT4X4,
+HASH_ELEMENT_INT____INT,
+HASH_ELEMENT_INT2____INT2,
+HASH_ELEMENT_INT3____INT3,
+HASH_ELEMENT_INT4____INT4,
+HASH_ELEMENT_MODIFIER,
+HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON,
+HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON,
+HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON,
+HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON,
+HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON,
+HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON,
+HASH_ELEMENT_SEMANTIC,
+HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_P,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_P,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_FORMAT,
+HASH_ELEMENT_FORMAT_HINT,
+HASH_ELEMENT_INIT_AS_NULL,
+HASH_ELEMENT_INIT_AS_TARGET,
+HASH_ELEMENT_INIT_CUBE,
+HASH_ELEMENT_INIT_FROM____FX_SURFACE_INIT_FROM_COMMON,
+HASH_ELEMENT_INIT_PLANAR,
+HASH_ELEMENT_INIT_VOLUME,
+HASH_ELEMENT_MIP_LEVELS,
+HASH_ELEMENT_MIPMAP_GENERATE,
+HASH_ELEMENT_SIZE____INT3,
+HASH_ELEMENT_VIEWPORT_RATIO,
+HASH_ELEMENT_CHANNELS,
+HASH_ELEMENT_OPTION,
+HASH_ELEMENT_PRECISION,
+HASH_ELEMENT_RANGE,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____FACE,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____PRIMARY,
+HASH_ELEMENT_ORDER,
+HASH_ELEMENT_FX_SURFACE_INIT_PLANAR_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____PRIMARY,
+HASH_ELEMENT_CODE,
+HASH_ELEMENT_INCLUDE,
+HASH_ELEMENT_NEWPARAM____CG_NEWPARAM,
+HASH_ELEMENT_PROFILE_CG__TECHNIQUE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_ARRAY____CG_NEWARRAY_TYPE,
+HASH_ELEMENT_BOOL____CG_BOOL,
+HASH_ELEMENT_BOOL1,
+HASH_ELEMENT_BOOL1X1,
+HASH_ELEMENT_BOOL1X2,
+HASH_ELEMENT_BOOL1X3,
+HASH_ELEMENT_BOOL1X4,
+HASH_ELEMENT_BOOL2____CG_BOOL2,
+HASH_ELEMENT_BOOL2X1,
+HASH_ELEMENT_BOOL2X2,
+HASH_ELEMENT_BOOL2X3,
+HASH_ELEMENT_BOOL2X4,
+HASH_ELEMENT_BOOL3____CG_BOOL3,
+HASH_ELEMENT_BOOL3X1,
+HASH_ELEMENT_BOOL3X2,
+HASH_ELEMENT_BOOL3X3,
+HASH_ELEMENT_BOOL3X4,
+HASH_ELEMENT_BOOL4____CG_BOOL4,
+HASH_ELEMENT_BOOL4X1,
+HASH_ELEMENT_BOOL4X2,
+HASH_ELEMENT_BOOL4X3,
+HASH_ELEMENT_BOOL4X4,
+HASH_ELEMENT_ENUM____GL_ENUMERATION,
+HASH_ELEMENT_FIXED,
+HASH_ELEMENT_FIXED1,
+HASH_ELEMENT_FIXED1X1,
+HASH_ELEMENT_FIXED1X2,
+HASH_ELEMENT_FIXED1X3,
+HASH_ELEMENT_FIXED1X4,
+HASH_ELEMENT_FIXED2,
+HASH_ELEMENT_FIXED2X1,
+HASH_ELEMENT_FIXED2X2,
+HASH_ELEMENT_FIXED2X3,
+HASH_ELEMENT_FIXED2X4,
+HASH_ELEMENT_FIXED3,
+HASH_ELEMENT_FIXED3X1,
+HASH_ELEMENT_FIXED3X2,
+HASH_ELEMENT_FIXED3X3,
+HASH_ELEMENT_FIXED3X4,
+HASH_ELEMENT_FIXED4,
+HASH_ELEMENT_FIXED4X1,
+HASH_ELEMENT_FIXED4X2,
+HASH_ELEMENT_FIXED4X3,
+HASH_ELEMENT_FIXED4X4,
+HASH_ELEMENT_FLOAT____CG_FLOAT,
+HASH_ELEMENT_FLOAT1,
+HASH_ELEMENT_FLOAT1X1____CG_FLOAT1X1,
+HASH_ELEMENT_FLOAT1X2____CG_FLOAT1X2,
+HASH_ELEMENT_FLOAT1X3____CG_FLOAT1X3,
+HASH_ELEMENT_FLOAT1X4____CG_FLOAT1X4,
+HASH_ELEMENT_FLOAT2____CG_FLOAT2,
+HASH_ELEMENT_FLOAT2X1____CG_FLOAT2X1,
+HASH_ELEMENT_FLOAT2X2____CG_FLOAT2X2,
+HASH_ELEMENT_FLOAT2X3____CG_FLOAT2X3,
+HASH_ELEMENT_FLOAT2X4____CG_FLOAT2X4,
+HASH_ELEMENT_FLOAT3____CG_FLOAT3,
+HASH_ELEMENT_FLOAT3X1____CG_FLOAT3X1,
+HASH_ELEMENT_FLOAT3X2____CG_FLOAT3X2,
+HASH_ELEMENT_FLOAT3X3____CG_FLOAT3X3,
+HASH_ELEMENT_FLOAT3X4____CG_FLOAT3X4,
+HASH_ELEMENT_FLOAT4____CG_FLOAT4,
+HASH_ELEMENT_FLOAT4X1____CG_FLOAT4X1,
+HASH_ELEMENT_FLOAT4X2____CG_FLOAT4X2,
+HASH_ELEMENT_FLOAT4X3____CG_FLOAT4X3,
+HASH_ELEMENT_FLOAT4X4____CG_FLOAT4X4,
+HASH_ELEMENT_HALF,
+HASH_ELEMENT_HALF1,
+HASH_ELEMENT_HALF1X1,
+HASH_ELEMENT_HALF1X2,
+HASH_ELEMENT_HALF1X3,
+HASH_ELEMENT_HALF1X4,
+HASH_ELEMENT_HALF2,
+HASH_ELEMENT_HALF2X1,
+HASH_ELEMENT_HALF2X2,
+HASH_ELEMENT_HALF2X3,
+HASH_ELEMENT_HALF2X4,
+HASH_ELEMENT_HALF3,
+HASH_ELEMENT_HALF3X1,
+HASH_ELEMENT_HALF3X2,
+HASH_ELEMENT_HALF3X3,
+HASH_ELEMENT_HALF3X4,
+HASH_ELEMENT_HALF4,
+HASH_ELEMENT_HALF4X1,
+HASH_ELEMENT_HALF4X2,
+HASH_ELEMENT_HALF4X3,
+HASH_ELEMENT_HALF4X4,
+HASH_ELEMENT_INT____CG_INT,
+HASH_ELEMENT_INT1,
+HASH_ELEMENT_INT1X1,
+HASH_ELEMENT_INT1X2,
+HASH_ELEMENT_INT1X3,
+HASH_ELEMENT_INT1X4,
+HASH_ELEMENT_INT2____CG_INT2,
+HASH_ELEMENT_INT2X1,
+HASH_ELEMENT_INT2X2,
+HASH_ELEMENT_INT2X3,
+HASH_ELEMENT_INT2X4,
+HASH_ELEMENT_INT3____CG_INT3,
+HASH_ELEMENT_INT3X1,
+HASH_ELEMENT_INT3X2,
+HASH_ELEMENT_INT3X3,
+HASH_ELEMENT_INT3X4,
+HASH_ELEMENT_INT4____CG_INT4,
+HASH_ELEMENT_INT4X1,
+HASH_ELEMENT_INT4X2,
+HASH_ELEMENT_INT4X3,
+HASH_ELEMENT_INT4X4,
+HASH_ELEMENT_MODIFIER,
+HASH_ELEMENT_SAMPLER1D____CG_SAMPLER1D,
+HASH_ELEMENT_SAMPLER2D____CG_SAMPLER2D,
+HASH_ELEMENT_SAMPLER3D____CG_SAMPLER3D,
+HASH_ELEMENT_SAMPLERCUBE____CG_SAMPLERCUBE,
+HASH_ELEMENT_SAMPLERDEPTH____CG_SAMPLERDEPTH,
+HASH_ELEMENT_SAMPLERRECT____CG_SAMPLERRECT,
+HASH_ELEMENT_SEMANTIC,
+HASH_ELEMENT_STRING,
+HASH_ELEMENT_SURFACE____CG_SURFACE_TYPE,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_ARRAY____CG_NEWARRAY_TYPE,
+HASH_ELEMENT_BOOL____CG_BOOL,
+HASH_ELEMENT_BOOL1,
+HASH_ELEMENT_BOOL1X1,
+HASH_ELEMENT_BOOL1X2,
+HASH_ELEMENT_BOOL1X3,
+HASH_ELEMENT_BOOL1X4,
+HASH_ELEMENT_BOOL2____CG_BOOL2,
+HASH_ELEMENT_BOOL2X1,
+HASH_ELEMENT_BOOL2X2,
+HASH_ELEMENT_BOOL2X3,
+HASH_ELEMENT_BOOL2X4,
+HASH_ELEMENT_BOOL3____CG_BOOL3,
+HASH_ELEMENT_BOOL3X1,
+HASH_ELEMENT_BOOL3X2,
+HASH_ELEMENT_BOOL3X3,
+HASH_ELEMENT_BOOL3X4,
+HASH_ELEMENT_BOOL4____CG_BOOL4,
+HASH_ELEMENT_BOOL4X1,
+HASH_ELEMENT_BOOL4X2,
+HASH_ELEMENT_BOOL4X3,
+HASH_ELEMENT_BOOL4X4,
+HASH_ELEMENT_CONNECT_PARAM,
+HASH_ELEMENT_ENUM____GL_ENUMERATION,
+HASH_ELEMENT_FIXED,
+HASH_ELEMENT_FIXED1,
+HASH_ELEMENT_FIXED1X1,
+HASH_ELEMENT_FIXED1X2,
+HASH_ELEMENT_FIXED1X3,
+HASH_ELEMENT_FIXED1X4,
+HASH_ELEMENT_FIXED2,
+HASH_ELEMENT_FIXED2X1,
+HASH_ELEMENT_FIXED2X2,
+HASH_ELEMENT_FIXED2X3,
+HASH_ELEMENT_FIXED2X4,
+HASH_ELEMENT_FIXED3,
+HASH_ELEMENT_FIXED3X1,
+HASH_ELEMENT_FIXED3X2,
+HASH_ELEMENT_FIXED3X3,
+HASH_ELEMENT_FIXED3X4,
+HASH_ELEMENT_FIXED4,
+HASH_ELEMENT_FIXED4X1,
+HASH_ELEMENT_FIXED4X2,
+HASH_ELEMENT_FIXED4X3,
+HASH_ELEMENT_FIXED4X4,
+HASH_ELEMENT_FLOAT____CG_FLOAT,
+HASH_ELEMENT_FLOAT1,
+HASH_ELEMENT_FLOAT1X1____CG_FLOAT1X1,
+HASH_ELEMENT_FLOAT1X2____CG_FLOAT1X2,
+HASH_ELEMENT_FLOAT1X3____CG_FLOAT1X3,
+HASH_ELEMENT_FLOAT1X4____CG_FLOAT1X4,
+HASH_ELEMENT_FLOAT2____CG_FLOAT2,
+HASH_ELEMENT_FLOAT2X1____CG_FLOAT2X1,
+HASH_ELEMENT_FLOAT2X2____CG_FLOAT2X2,
+HASH_ELEMENT_FLOAT2X3____CG_FLOAT2X3,
+HASH_ELEMENT_FLOAT2X4____CG_FLOAT2X4,
+HASH_ELEMENT_FLOAT3____CG_FLOAT3,
+HASH_ELEMENT_FLOAT3X1____CG_FLOAT3X1,
+HASH_ELEMENT_FLOAT3X2____CG_FLOAT3X2,
+HASH_ELEMENT_FLOAT3X3____CG_FLOAT3X3,
+HASH_ELEMENT_FLOAT3X4____CG_FLOAT3X4,
+HASH_ELEMENT_FLOAT4____CG_FLOAT4,
+HASH_ELEMENT_FLOAT4X1____CG_FLOAT4X1,
+HASH_ELEMENT_FLOAT4X2____CG_FLOAT4X2,
+HASH_ELEMENT_FLOAT4X3____CG_FLOAT4X3,
+HASH_ELEMENT_FLOAT4X4____CG_FLOAT4X4,
+HASH_ELEMENT_HALF,
+HASH_ELEMENT_HALF1,
+HASH_ELEMENT_HALF1X1,
+HASH_ELEMENT_HALF1X2,
+HASH_ELEMENT_HALF1X3,
+HASH_ELEMENT_HALF1X4,
+HASH_ELEMENT_HALF2,
+HASH_ELEMENT_HALF2X1,
+HASH_ELEMENT_HALF2X2,
+HASH_ELEMENT_HALF2X3,
+HASH_ELEMENT_HALF2X4,
+HASH_ELEMENT_HALF3,
+HASH_ELEMENT_HALF3X1,
+HASH_ELEMENT_HALF3X2,
+HASH_ELEMENT_HALF3X3,
+HASH_ELEMENT_HALF3X4,
+HASH_ELEMENT_HALF4,
+HASH_ELEMENT_HALF4X1,
+HASH_ELEMENT_HALF4X2,
+HASH_ELEMENT_HALF4X3,
+HASH_ELEMENT_HALF4X4,
+HASH_ELEMENT_INT____CG_INT,
+HASH_ELEMENT_INT1,
+HASH_ELEMENT_INT1X1,
+HASH_ELEMENT_INT1X2,
+HASH_ELEMENT_INT1X3,
+HASH_ELEMENT_INT1X4,
+HASH_ELEMENT_INT2____CG_INT2,
+HASH_ELEMENT_INT2X1,
+HASH_ELEMENT_INT2X2,
+HASH_ELEMENT_INT2X3,
+HASH_ELEMENT_INT2X4,
+HASH_ELEMENT_INT3____CG_INT3,
+HASH_ELEMENT_INT3X1,
+HASH_ELEMENT_INT3X2,
+HASH_ELEMENT_INT3X3,
+HASH_ELEMENT_INT3X4,
+HASH_ELEMENT_INT4____CG_INT4,
+HASH_ELEMENT_INT4X1,
+HASH_ELEMENT_INT4X2,
+HASH_ELEMENT_INT4X3,
+HASH_ELEMENT_INT4X4,
+HASH_ELEMENT_SAMPLER1D____CG_SAMPLER1D,
+HASH_ELEMENT_SAMPLER2D____CG_SAMPLER2D,
+HASH_ELEMENT_SAMPLER3D____CG_SAMPLER3D,
+HASH_ELEMENT_SAMPLERCUBE____CG_SAMPLERCUBE,
+HASH_ELEMENT_SAMPLERDEPTH____CG_SAMPLERDEPTH,
+HASH_ELEMENT_SAMPLERRECT____CG_SAMPLERRECT,
+HASH_ELEMENT_STRING,
+HASH_ELEMENT_SURFACE____CG_SURFACE_TYPE,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_BOOL____CG_BOOL,
+HASH_ELEMENT_BOOL1,
+HASH_ELEMENT_BOOL1X1,
+HASH_ELEMENT_BOOL1X2,
+HASH_ELEMENT_BOOL1X3,
+HASH_ELEMENT_BOOL1X4,
+HASH_ELEMENT_BOOL2____CG_BOOL2,
+HASH_ELEMENT_BOOL2X1,
+HASH_ELEMENT_BOOL2X2,
+HASH_ELEMENT_BOOL2X3,
+HASH_ELEMENT_BOOL2X4,
+HASH_ELEMENT_BOOL3____CG_BOOL3,
+HASH_ELEMENT_BOOL3X1,
+HASH_ELEMENT_BOOL3X2,
+HASH_ELEMENT_BOOL3X3,
+HASH_ELEMENT_BOOL3X4,
+HASH_ELEMENT_BOOL4____CG_BOOL4,
+HASH_ELEMENT_BOOL4X1,
+HASH_ELEMENT_BOOL4X2,
+HASH_ELEMENT_BOOL4X3,
+HASH_ELEMENT_BOOL4X4,
+HASH_ELEMENT_CONNECT_PARAM,
+HASH_ELEMENT_ENUM____GL_ENUMERATION,
+HASH_ELEMENT_FIXED,
+HASH_ELEMENT_FIXED1,
+HASH_ELEMENT_FIXED1X1,
+HASH_ELEMENT_FIXED1X2,
+HASH_ELEMENT_FIXED1X3,
+HASH_ELEMENT_FIXED1X4,
+HASH_ELEMENT_FIXED2,
+HASH_ELEMENT_FIXED2X1,
+HASH_ELEMENT_FIXED2X2,
+HASH_ELEMENT_FIXED2X3,
+HASH_ELEMENT_FIXED2X4,
+HASH_ELEMENT_FIXED3,
+HASH_ELEMENT_FIXED3X1,
+HASH_ELEMENT_FIXED3X2,
+HASH_ELEMENT_FIXED3X3,
+HASH_ELEMENT_FIXED3X4,
+HASH_ELEMENT_FIXED4,
+HASH_ELEMENT_FIXED4X1,
+HASH_ELEMENT_FIXED4X2,
+HASH_ELEMENT_FIXED4X3,
+HASH_ELEMENT_FIXED4X4,
+HASH_ELEMENT_FLOAT____CG_FLOAT,
+HASH_ELEMENT_FLOAT1,
+HASH_ELEMENT_FLOAT1X1____CG_FLOAT1X1,
+HASH_ELEMENT_FLOAT1X2____CG_FLOAT1X2,
+HASH_ELEMENT_FLOAT1X3____CG_FLOAT1X3,
+HASH_ELEMENT_FLOAT1X4____CG_FLOAT1X4,
+HASH_ELEMENT_FLOAT2____CG_FLOAT2,
+HASH_ELEMENT_FLOAT2X1____CG_FLOAT2X1,
+HASH_ELEMENT_FLOAT2X2____CG_FLOAT2X2,
+HASH_ELEMENT_FLOAT2X3____CG_FLOAT2X3,
+HASH_ELEMENT_FLOAT2X4____CG_FLOAT2X4,
+HASH_ELEMENT_FLOAT3____CG_FLOAT3,
+HASH_ELEMENT_FLOAT3X1____CG_FLOAT3X1,
+HASH_ELEMENT_FLOAT3X2____CG_FLOAT3X2,
+HASH_ELEMENT_FLOAT3X3____CG_FLOAT3X3,
+HASH_ELEMENT_FLOAT3X4____CG_FLOAT3X4,
+HASH_ELEMENT_FLOAT4____CG_FLOAT4,
+HASH_ELEMENT_FLOAT4X1____CG_FLOAT4X1,
+HASH_ELEMENT_FLOAT4X2____CG_FLOAT4X2,
+HASH_ELEMENT_FLOAT4X3____CG_FLOAT4X3,
+HASH_ELEMENT_FLOAT4X4____CG_FLOAT4X4,
+HASH_ELEMENT_HALF,
+HASH_ELEMENT_HALF1,
+HASH_ELEMENT_HALF1X1,
+HASH_ELEMENT_HALF1X2,
+HASH_ELEMENT_HALF1X3,
+HASH_ELEMENT_HALF1X4,
+HASH_ELEMENT_HALF2,
+HASH_ELEMENT_HALF2X1,
+HASH_ELEMENT_HALF2X2,
+HASH_ELEMENT_HALF2X3,
+HASH_ELEMENT_HALF2X4,
+HASH_ELEMENT_HALF3,
+HASH_ELEMENT_HALF3X1,
+HASH_ELEMENT_HALF3X2,
+HASH_ELEMENT_HALF3X3,
+HASH_ELEMENT_HALF3X4,
+HASH_ELEMENT_HALF4,
+HASH_ELEMENT_HALF4X1,
+HASH_ELEMENT_HALF4X2,
+HASH_ELEMENT_HALF4X3,
+HASH_ELEMENT_HALF4X4,
+HASH_ELEMENT_INT____CG_INT,
+HASH_ELEMENT_INT1,
+HASH_ELEMENT_INT1X1,
+HASH_ELEMENT_INT1X2,
+HASH_ELEMENT_INT1X3,
+HASH_ELEMENT_INT1X4,
+HASH_ELEMENT_INT2____CG_INT2,
+HASH_ELEMENT_INT2X1,
+HASH_ELEMENT_INT2X2,
+HASH_ELEMENT_INT2X3,
+HASH_ELEMENT_INT2X4,
+HASH_ELEMENT_INT3____CG_INT3,
+HASH_ELEMENT_INT3X1,
+HASH_ELEMENT_INT3X2,
+HASH_ELEMENT_INT3X3,
+HASH_ELEMENT_INT3X4,
+HASH_ELEMENT_INT4____CG_INT4,
+HASH_ELEMENT_INT4X1,
+HASH_ELEMENT_INT4X2,
+HASH_ELEMENT_INT4X3,
+HASH_ELEMENT_INT4X4,
+HASH_ELEMENT_SAMPLER1D____CG_SAMPLER1D,
+HASH_ELEMENT_SAMPLER2D____CG_SAMPLER2D,
+HASH_ELEMENT_SAMPLER3D____CG_SAMPLER3D,
+HASH_ELEMENT_SAMPLERCUBE____CG_SAMPLERCUBE,
+HASH_ELEMENT_SAMPLERDEPTH____CG_SAMPLERDEPTH,
+HASH_ELEMENT_SAMPLERRECT____CG_SAMPLERRECT,
+HASH_ELEMENT_STRING,
+HASH_ELEMENT_SURFACE____CG_SURFACE_TYPE,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_CG_SURFACE_TYPE____GENERATOR,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_CODE,
+HASH_ELEMENT_INCLUDE,
+HASH_ELEMENT_PROFILE_CG__NEWPARAM__SURFACE__GENERATOR__NAME,
+HASH_ELEMENT_SETPARAM____CG_SETPARAM_SIMPLE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_ARRAY____CG_SETARRAY_TYPE,
+HASH_ELEMENT_CONNECT_PARAM,
+HASH_ELEMENT_SETPARAM____CG_SETPARAM,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_ARRAY____CG_SETARRAY_TYPE,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_CONNECT_PARAM,
+HASH_ELEMENT_SETPARAM____CG_SETPARAM,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_ARRAY____CG_SETARRAY_TYPE,
+HASH_ELEMENT_CONNECT_PARAM,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_USERTYPE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_CODE,
+HASH_ELEMENT_INCLUDE,
+HASH_ELEMENT_NEWPARAM____CG_NEWPARAM,
+HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS,
+HASH_ELEMENT_SETPARAM____CG_SETPARAM,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_FUNC,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_TEST_ENABLE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_AUTO_NORMAL_ENABLE,
+HASH_ELEMENT_BLEND_COLOR,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_ENABLE,
+HASH_ELEMENT_BLEND_EQUATION,
+HASH_ELEMENT_BLEND_EQUATION_SEPARATE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_FUNC,
+HASH_ELEMENT_BLEND_FUNC_SEPARATE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLEAR_COLOR,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLEAR_DEPTH,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLEAR_STENCIL,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLIP_PLANE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CLIP_PLANE_ENABLE,
+HASH_ELEMENT_COLOR_CLEAR____FX_CLEARCOLOR_COMMON,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__COLOR_LOGIC_OP_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__COLOR_MASK,
+HASH_ELEMENT_COLOR_MATERIAL,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__COLOR_MATERIAL_ENABLE,
+HASH_ELEMENT_COLOR_TARGET____FX_COLORTARGET_COMMON,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CULL_FACE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__CULL_FACE_ENABLE,
+HASH_ELEMENT_DEPTH_BOUNDS,
+HASH_ELEMENT_DEPTH_BOUNDS_ENABLE,
+HASH_ELEMENT_DEPTH_CLAMP_ENABLE,
+HASH_ELEMENT_DEPTH_CLEAR____FX_CLEARDEPTH_COMMON,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_FUNC,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_MASK,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_RANGE,
+HASH_ELEMENT_DEPTH_TARGET____FX_DEPTHTARGET_COMMON,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DEPTH_TEST_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__DITHER_ENABLE,
+HASH_ELEMENT_DRAW,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_COLOR,
+HASH_ELEMENT_FOG_COORD_SRC,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_DENSITY,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_END,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_MODE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FOG_START,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__FRONT_FACE,
+HASH_ELEMENT_GL_HOOK_ABSTRACT,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_AMBIENT,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_CONSTANT_ATTENUATION,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_DIFFUSE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_ENABLE,
+HASH_ELEMENT_LIGHT_LINEAR_ATTENUATION,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_MODEL_AMBIENT,
+HASH_ELEMENT_LIGHT_MODEL_COLOR_CONTROL,
+HASH_ELEMENT_LIGHT_MODEL_LOCAL_VIEWER_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_MODEL_TWO_SIDE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_POSITION,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_QUADRATIC_ATTENUATION,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPECULAR,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPOT_CUTOFF,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPOT_DIRECTION,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHT_SPOT_EXPONENT,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LIGHTING_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LINE_SMOOTH_ENABLE,
+HASH_ELEMENT_LINE_STIPPLE,
+HASH_ELEMENT_LINE_STIPPLE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LINE_WIDTH,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__LOGIC_OP,
+HASH_ELEMENT_LOGIC_OP_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_AMBIENT,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_DIFFUSE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_EMISSION,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_SHININESS,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MATERIAL_SPECULAR,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MODEL_VIEW_MATRIX,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__MULTISAMPLE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__NORMALIZE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_DISTANCE_ATTENUATION,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_FADE_THRESHOLD_SIZE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SIZE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SIZE_MAX,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SIZE_MIN,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POINT_SMOOTH_ENABLE,
+HASH_ELEMENT_POLYGON_MODE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POLYGON_OFFSET,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__POLYGON_OFFSET_FILL_ENABLE,
+HASH_ELEMENT_POLYGON_OFFSET_LINE_ENABLE,
+HASH_ELEMENT_POLYGON_OFFSET_POINT_ENABLE,
+HASH_ELEMENT_POLYGON_SMOOTH_ENABLE,
+HASH_ELEMENT_POLYGON_STIPPLE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__PROJECTION_MATRIX,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__RESCALE_NORMAL_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_COVERAGE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_ONE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SAMPLE_COVERAGE_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SCISSOR,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SCISSOR_TEST_ENABLE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADE_MODEL,
+HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER,
+HASH_ELEMENT_STENCIL_CLEAR____FX_CLEARSTENCIL_COMMON,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC,
+HASH_ELEMENT_STENCIL_FUNC_SEPARATE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_MASK,
+HASH_ELEMENT_STENCIL_MASK_SEPARATE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP,
+HASH_ELEMENT_STENCIL_OP_SEPARATE,
+HASH_ELEMENT_STENCIL_TARGET____FX_STENCILTARGET_COMMON,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_TEST_ENABLE,
+HASH_ELEMENT_TEXTURE1D,
+HASH_ELEMENT_TEXTURE1D_ENABLE,
+HASH_ELEMENT_TEXTURE2D,
+HASH_ELEMENT_TEXTURE2D_ENABLE,
+HASH_ELEMENT_TEXTURE3D,
+HASH_ELEMENT_TEXTURE3D_ENABLE,
+HASH_ELEMENT_TEXTURECUBE,
+HASH_ELEMENT_TEXTURECUBE_ENABLE,
+HASH_ELEMENT_TEXTUREDEPTH,
+HASH_ELEMENT_TEXTUREDEPTH_ENABLE,
+HASH_ELEMENT_TEXTURERECT,
+HASH_ELEMENT_TEXTURERECT_ENABLE,
+HASH_ELEMENT_TEXTURE_ENV_COLOR,
+HASH_ELEMENT_TEXTURE_ENV_MODE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_FUNC__FUNC,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__ALPHA_FUNC__VALUE,
+HASH_ELEMENT_BLEND_EQUATION_SEPARATE__ALPHA,
+HASH_ELEMENT_RGB,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_FUNC__DEST,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__BLEND_FUNC__SRC,
+HASH_ELEMENT_DEST_ALPHA,
+HASH_ELEMENT_DEST_RGB,
+HASH_ELEMENT_SRC_ALPHA,
+HASH_ELEMENT_SRC_RGB,
+HASH_ELEMENT_COLOR_MATERIAL__FACE,
+HASH_ELEMENT_COLOR_MATERIAL__MODE,
+HASH_ELEMENT_POLYGON_MODE__FACE,
+HASH_ELEMENT_POLYGON_MODE__MODE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__BIND,
+HASH_ELEMENT_COMPILER_OPTIONS,
+HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__COMPILER_TARGET,
+HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__NAME,
+HASH_ELEMENT_PROFILE_CG__TECHNIQUE__PASS__SHADER__BIND__PARAM,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC__FUNC,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC__MASK,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_FUNC__REF,
+HASH_ELEMENT_BACK,
+HASH_ELEMENT_FRONT,
+HASH_ELEMENT_STENCIL_FUNC_SEPARATE__MASK,
+HASH_ELEMENT_STENCIL_FUNC_SEPARATE__REF,
+HASH_ELEMENT_STENCIL_MASK_SEPARATE__FACE,
+HASH_ELEMENT_STENCIL_MASK_SEPARATE__MASK,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP__FAIL,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP__ZFAIL,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__STENCIL_OP__ZPASS,
+HASH_ELEMENT_STENCIL_OP_SEPARATE__FACE,
+HASH_ELEMENT_STENCIL_OP_SEPARATE__FAIL,
+HASH_ELEMENT_STENCIL_OP_SEPARATE__ZFAIL,
+HASH_ELEMENT_STENCIL_OP_SEPARATE__ZPASS,
+HASH_ELEMENT_PARAM____NCNAME,
+HASH_ELEMENT_VALUE____GL_SAMPLER1D,
+HASH_ELEMENT_PARAM____NCNAME,
+HASH_ELEMENT_VALUE____GL_SAMPLER2D,
+HASH_ELEMENT_PARAM____NCNAME,
+HASH_ELEMENT_VALUE____GL_SAMPLER3D,
+HASH_ELEMENT_PARAM____NCNAME,
+HASH_ELEMENT_VALUE____GL_SAMPLERCUBE,
+HASH_ELEMENT_PARAM____NCNAME,
+HASH_ELEMENT_VALUE____GL_SAMPLERDEPTH,
+HASH_ELEMENT_PARAM____NCNAME,
+HASH_ELEMENT_VALUE____GL_SAMPLERRECT,
+HASH_ELEMENT_NEWPARAM____COMMON_NEWPARAM_TYPE,
+HASH_ELEMENT_PROFILE_COMMON__TECHNIQUE,
+HASH_ELEMENT_FLOAT____FLOAT,
+HASH_ELEMENT_FLOAT2____FLOAT2,
+HASH_ELEMENT_FLOAT3____FLOAT3,
+HASH_ELEMENT_FLOAT4____FLOAT4,
+HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON,
+HASH_ELEMENT_SEMANTIC,
+HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON,
+HASH_ELEMENT_BLINN,
+HASH_ELEMENT_PROFILE_COMMON__TECHNIQUE__CONSTANT,
+HASH_ELEMENT_LAMBERT,
+HASH_ELEMENT_NEWPARAM____COMMON_NEWPARAM_TYPE,
+HASH_ELEMENT_PHONG,
+HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE,
+HASH_ELEMENT_DIFFUSE,
+HASH_ELEMENT_EMISSION,
+HASH_ELEMENT_INDEX_OF_REFRACTION,
+HASH_ELEMENT_REFLECTIVE,
+HASH_ELEMENT_REFLECTIVITY,
+HASH_ELEMENT_SHININESS,
+HASH_ELEMENT_SPECULAR,
+HASH_ELEMENT_TRANSPARENCY,
+HASH_ELEMENT_TRANSPARENT,
+HASH_ELEMENT_COMMON_COLOR_OR_TEXTURE_TYPE____COLOR,
+HASH_ELEMENT_COMMON_COLOR_OR_TEXTURE_TYPE____PARAM,
+HASH_ELEMENT_TEXTURE,
+HASH_ELEMENT_COMMON_FLOAT_OR_PARAM_TYPE____FLOAT,
+HASH_ELEMENT_COMMON_FLOAT_OR_PARAM_TYPE____PARAM,
+HASH_ELEMENT_EMISSION,
+HASH_ELEMENT_INDEX_OF_REFRACTION,
+HASH_ELEMENT_REFLECTIVE,
+HASH_ELEMENT_REFLECTIVITY,
+HASH_ELEMENT_TRANSPARENCY,
+HASH_ELEMENT_TRANSPARENT,
+HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE,
+HASH_ELEMENT_DIFFUSE,
+HASH_ELEMENT_EMISSION,
+HASH_ELEMENT_INDEX_OF_REFRACTION,
+HASH_ELEMENT_REFLECTIVE,
+HASH_ELEMENT_REFLECTIVITY,
+HASH_ELEMENT_TRANSPARENCY,
+HASH_ELEMENT_TRANSPARENT,
+HASH_ELEMENT_AMBIENT____COMMON_COLOR_OR_TEXTURE_TYPE,
+HASH_ELEMENT_DIFFUSE,
+HASH_ELEMENT_EMISSION,
+HASH_ELEMENT_INDEX_OF_REFRACTION,
+HASH_ELEMENT_REFLECTIVE,
+HASH_ELEMENT_REFLECTIVITY,
+HASH_ELEMENT_SHININESS,
+HASH_ELEMENT_SPECULAR,
+HASH_ELEMENT_TRANSPARENCY,
+HASH_ELEMENT_TRANSPARENT,
+HASH_ELEMENT_NEWPARAM____GLES_NEWPARAM,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_BOOL____BOOL,
+HASH_ELEMENT_BOOL2____BOOL2,
+HASH_ELEMENT_BOOL3____BOOL3,
+HASH_ELEMENT_BOOL4____BOOL4,
+HASH_ELEMENT_ENUM____GLES_ENUMERATION,
+HASH_ELEMENT_FLOAT____FLOAT,
+HASH_ELEMENT_FLOAT1X1____FLOAT,
+HASH_ELEMENT_FLOAT1X2____FLOAT2,
+HASH_ELEMENT_FLOAT1X3____FLOAT3,
+HASH_ELEMENT_FLOAT1X4____FLOAT4,
+HASH_ELEMENT_FLOAT2____FLOAT2,
+HASH_ELEMENT_FLOAT2X1____FLOAT2,
+HASH_ELEMENT_FLOAT2X2____FLOAT2X2,
+HASH_ELEMENT_FLOAT2X3____FLOAT2X3,
+HASH_ELEMENT_FLOAT2X4____FLOAT2X4,
+HASH_ELEMENT_FLOAT3____FLOAT3,
+HASH_ELEMENT_FLOAT3X1____FLOAT3,
+HASH_ELEMENT_FLOAT3X2____FLOAT3X2,
+HASH_ELEMENT_FLOAT3X3____FLOAT3X3,
+HASH_ELEMENT_FLOAT3X4____FLOAT3X4,
+HASH_ELEMENT_FLOAT4____FLOAT4,
+HASH_ELEMENT_FLOAT4X1____FLOAT4,
+HASH_ELEMENT_FLOAT4X2____FLOAT4X2,
+HASH_ELEMENT_FLOAT4X3____FLOAT4X3,
+HASH_ELEMENT_FLOAT4X4____FLOAT4X4,
+HASH_ELEMENT_INT____INT,
+HASH_ELEMENT_INT2____INT2,
+HASH_ELEMENT_INT3____INT3,
+HASH_ELEMENT_INT4____INT4,
+HASH_ELEMENT_MODIFIER,
+HASH_ELEMENT_SAMPLER_STATE____GLES_SAMPLER_STATE,
+HASH_ELEMENT_SEMANTIC,
+HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON,
+HASH_ELEMENT_TEXTURE_PIPELINE____GLES_TEXTURE_PIPELINE,
+HASH_ELEMENT_TEXTURE_UNIT,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_WRAP_S____GLES_SAMPLER_WRAP,
+HASH_ELEMENT_WRAP_T____GLES_SAMPLER_WRAP,
+HASH_ELEMENT_TEXCOMBINER,
+HASH_ELEMENT_TEXENV,
+HASH_ELEMENT_RGB,
+HASH_ELEMENT_ALPHA____GLES_TEXCOMBINER_COMMANDALPHA_TYPE,
+HASH_ELEMENT_CONSTANT____GLES_TEXTURE_CONSTANT_TYPE,
+HASH_ELEMENT_ARGUMENT____GLES_TEXCOMBINER_ARGUMENTRGB_TYPE,
+HASH_ELEMENT_ARGUMENT____GLES_TEXCOMBINER_ARGUMENTALPHA_TYPE,
+HASH_ELEMENT_CONSTANT____GLES_TEXTURE_CONSTANT_TYPE,
+HASH_ELEMENT_SAMPLER_STATE____NCNAME,
+HASH_ELEMENT_SURFACE____NCNAME,
+HASH_ELEMENT_TEXCOORD,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_NEWPARAM____GLES_NEWPARAM,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__SETPARAM,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_TEST_ENABLE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_FUNC,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLEAR_COLOR,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLEAR_DEPTH,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLEAR_STENCIL,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLIP_PLANE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CLIP_PLANE_ENABLE,
+HASH_ELEMENT_COLOR_CLEAR____FX_COLOR_COMMON,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__COLOR_LOGIC_OP_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__COLOR_MASK,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__COLOR_MATERIAL_ENABLE,
+HASH_ELEMENT_COLOR_TARGET____GLES_RENDERTARGET_COMMON,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CULL_FACE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__CULL_FACE_ENABLE,
+HASH_ELEMENT_DEPTH_CLEAR____FLOAT,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_FUNC,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_MASK,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_RANGE,
+HASH_ELEMENT_DEPTH_TARGET____GLES_RENDERTARGET_COMMON,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DEPTH_TEST_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__DITHER_ENABLE,
+HASH_ELEMENT_DRAW,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_COLOR,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_DENSITY,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_END,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_MODE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FOG_START,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__FRONT_FACE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_AMBIENT,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_CONSTANT_ATTENUATION,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_DIFFUSE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_ENABLE,
+HASH_ELEMENT_LIGHT_LINEAR_ATTENUTATION,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_MODEL_AMBIENT,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_MODEL_TWO_SIDE_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_POSITION,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_QUADRATIC_ATTENUATION,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPECULAR,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPOT_CUTOFF,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPOT_DIRECTION,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHT_SPOT_EXPONENT,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LIGHTING_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LINE_SMOOTH_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LINE_WIDTH,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__LOGIC_OP,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_AMBIENT,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_DIFFUSE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_EMISSION,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_SHININESS,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MATERIAL_SPECULAR,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MODEL_VIEW_MATRIX,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__MULTISAMPLE_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__NORMALIZE_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_DISTANCE_ATTENUATION,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_FADE_THRESHOLD_SIZE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SIZE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SIZE_MAX,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SIZE_MIN,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POINT_SMOOTH_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POLYGON_OFFSET,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__POLYGON_OFFSET_FILL_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__PROJECTION_MATRIX,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__RESCALE_NORMAL_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_COVERAGE_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SAMPLE_ALPHA_TO_ONE_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SAMPLE_COVERAGE_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SCISSOR,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SCISSOR_TEST_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__SHADE_MODEL,
+HASH_ELEMENT_STENCIL_CLEAR____BYTE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_MASK,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP,
+HASH_ELEMENT_STENCIL_TARGET____GLES_RENDERTARGET_COMMON,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_TEST_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__TEXTURE_PIPELINE,
+HASH_ELEMENT_TEXTURE_PIPELINE_ENABLE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC__FUNC,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__ALPHA_FUNC__VALUE,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_FUNC__DEST,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__BLEND_FUNC__SRC,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC__FUNC,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC__MASK,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_FUNC__REF,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP__FAIL,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP__ZFAIL,
+HASH_ELEMENT_PROFILE_GLES__TECHNIQUE__PASS__STENCIL_OP__ZPASS,
+HASH_ELEMENT_VALUE____GLES_TEXTURE_PIPELINE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_CODE,
+HASH_ELEMENT_INCLUDE,
+HASH_ELEMENT_NEWPARAM____GLSL_NEWPARAM,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_ARRAY____GLSL_NEWARRAY_TYPE,
+HASH_ELEMENT_BOOL____GLSL_BOOL,
+HASH_ELEMENT_BOOL2____GLSL_BOOL2,
+HASH_ELEMENT_BOOL3____GLSL_BOOL3,
+HASH_ELEMENT_BOOL4____GLSL_BOOL4,
+HASH_ELEMENT_ENUM____GL_ENUMERATION,
+HASH_ELEMENT_FLOAT____GLSL_FLOAT,
+HASH_ELEMENT_FLOAT2____GLSL_FLOAT2,
+HASH_ELEMENT_FLOAT2X2____GLSL_FLOAT2X2,
+HASH_ELEMENT_FLOAT3____GLSL_FLOAT3,
+HASH_ELEMENT_FLOAT3X3____GLSL_FLOAT3X3,
+HASH_ELEMENT_FLOAT4____GLSL_FLOAT4,
+HASH_ELEMENT_FLOAT4X4____GLSL_FLOAT4X4,
+HASH_ELEMENT_INT____GLSL_INT,
+HASH_ELEMENT_INT2____GLSL_INT2,
+HASH_ELEMENT_INT3____GLSL_INT3,
+HASH_ELEMENT_INT4____GLSL_INT4,
+HASH_ELEMENT_MODIFIER,
+HASH_ELEMENT_SAMPLER1D____GL_SAMPLER1D,
+HASH_ELEMENT_SAMPLER2D____GL_SAMPLER2D,
+HASH_ELEMENT_SAMPLER3D____GL_SAMPLER3D,
+HASH_ELEMENT_SAMPLERCUBE____GL_SAMPLERCUBE,
+HASH_ELEMENT_SAMPLERDEPTH____GL_SAMPLERDEPTH,
+HASH_ELEMENT_SAMPLERRECT____GL_SAMPLERRECT,
+HASH_ELEMENT_SEMANTIC,
+HASH_ELEMENT_SURFACE____GLSL_SURFACE_TYPE,
+HASH_ELEMENT_ARRAY____GLSL_NEWARRAY_TYPE,
+HASH_ELEMENT_BOOL____GLSL_BOOL,
+HASH_ELEMENT_BOOL2____GLSL_BOOL2,
+HASH_ELEMENT_BOOL3____GLSL_BOOL3,
+HASH_ELEMENT_BOOL4____GLSL_BOOL4,
+HASH_ELEMENT_ENUM____GL_ENUMERATION,
+HASH_ELEMENT_FLOAT____GLSL_FLOAT,
+HASH_ELEMENT_FLOAT2____GLSL_FLOAT2,
+HASH_ELEMENT_FLOAT2X2____GLSL_FLOAT2X2,
+HASH_ELEMENT_FLOAT3____GLSL_FLOAT3,
+HASH_ELEMENT_FLOAT3X3____GLSL_FLOAT3X3,
+HASH_ELEMENT_FLOAT4____GLSL_FLOAT4,
+HASH_ELEMENT_FLOAT4X4____GLSL_FLOAT4X4,
+HASH_ELEMENT_INT____GLSL_INT,
+HASH_ELEMENT_INT2____GLSL_INT2,
+HASH_ELEMENT_INT3____GLSL_INT3,
+HASH_ELEMENT_INT4____GLSL_INT4,
+HASH_ELEMENT_SAMPLER1D____GL_SAMPLER1D,
+HASH_ELEMENT_SAMPLER2D____GL_SAMPLER2D,
+HASH_ELEMENT_SAMPLER3D____GL_SAMPLER3D,
+HASH_ELEMENT_SAMPLERCUBE____GL_SAMPLERCUBE,
+HASH_ELEMENT_SAMPLERDEPTH____GL_SAMPLERDEPTH,
+HASH_ELEMENT_SAMPLERRECT____GL_SAMPLERRECT,
+HASH_ELEMENT_SURFACE____GLSL_SURFACE_TYPE,
+HASH_ELEMENT_BOOL____GLSL_BOOL,
+HASH_ELEMENT_BOOL2____GLSL_BOOL2,
+HASH_ELEMENT_BOOL3____GLSL_BOOL3,
+HASH_ELEMENT_BOOL4____GLSL_BOOL4,
+HASH_ELEMENT_ENUM____GL_ENUMERATION,
+HASH_ELEMENT_FLOAT____GLSL_FLOAT,
+HASH_ELEMENT_FLOAT2____GLSL_FLOAT2,
+HASH_ELEMENT_FLOAT2X2____GLSL_FLOAT2X2,
+HASH_ELEMENT_FLOAT3____GLSL_FLOAT3,
+HASH_ELEMENT_FLOAT3X3____GLSL_FLOAT3X3,
+HASH_ELEMENT_FLOAT4____GLSL_FLOAT4,
+HASH_ELEMENT_FLOAT4X4____GLSL_FLOAT4X4,
+HASH_ELEMENT_INT____GLSL_INT,
+HASH_ELEMENT_INT2____GLSL_INT2,
+HASH_ELEMENT_INT3____GLSL_INT3,
+HASH_ELEMENT_INT4____GLSL_INT4,
+HASH_ELEMENT_SAMPLER1D____GL_SAMPLER1D,
+HASH_ELEMENT_SAMPLER2D____GL_SAMPLER2D,
+HASH_ELEMENT_SAMPLER3D____GL_SAMPLER3D,
+HASH_ELEMENT_SAMPLERCUBE____GL_SAMPLERCUBE,
+HASH_ELEMENT_SAMPLERDEPTH____GL_SAMPLERDEPTH,
+HASH_ELEMENT_SAMPLERRECT____GL_SAMPLERRECT,
+HASH_ELEMENT_SURFACE____GLSL_SURFACE_TYPE,
+HASH_ELEMENT_GLSL_SURFACE_TYPE____GENERATOR,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_CODE,
+HASH_ELEMENT_INCLUDE,
+HASH_ELEMENT_PROFILE_GLSL__NEWPARAM__SURFACE__GENERATOR__NAME,
+HASH_ELEMENT_SETPARAM____GLSL_SETPARAM_SIMPLE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_CODE,
+HASH_ELEMENT_INCLUDE,
+HASH_ELEMENT_NEWPARAM____GLSL_NEWPARAM,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS,
+HASH_ELEMENT_SETPARAM____GLSL_SETPARAM,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_COLOR_CLEAR____FX_CLEARCOLOR_COMMON,
+HASH_ELEMENT_COLOR_TARGET____FX_COLORTARGET_COMMON,
+HASH_ELEMENT_DEPTH_CLEAR____FX_CLEARDEPTH_COMMON,
+HASH_ELEMENT_DEPTH_TARGET____FX_DEPTHTARGET_COMMON,
+HASH_ELEMENT_DRAW,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER,
+HASH_ELEMENT_STENCIL_CLEAR____FX_CLEARSTENCIL_COMMON,
+HASH_ELEMENT_STENCIL_TARGET____FX_STENCILTARGET_COMMON,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__BIND,
+HASH_ELEMENT_COMPILER_OPTIONS,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__COMPILER_TARGET,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__NAME,
+HASH_ELEMENT_PROFILE_GLSL__TECHNIQUE__PASS__SHADER__BIND__PARAM,
+HASH_ELEMENT_ANNOTATE,
+HASH_ELEMENT_ARRAY____GLSL_SETARRAY_TYPE,
+HASH_ELEMENT_ARRAY____GLSL_SETARRAY_TYPE,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_force_fields__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_FORCE_FIELDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_force_fields, &ColladaParserAutoGen14Private::_data__library_force_fields, &ColladaParserAutoGen14Private::_end__library_force_fields, &ColladaParserAutoGen14Private::_preBegin__library_force_fields, &ColladaParserAutoGen14Private::_preEnd__library_force_fields, &ColladaParserAutoGen14Private::_freeAttributes__library_force_fields);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_FORCE_FIELD] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__force_field, &ColladaParserAutoGen14Private::_data__force_field, &ColladaParserAutoGen14Private::_end__force_field, &ColladaParserAutoGen14Private::_preBegin__force_field, &ColladaParserAutoGen14Private::_preEnd__force_field, &ColladaParserAutoGen14Private::_freeAttributes__force_field);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_FORCE_FIELDS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_FORCE_FIELD,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_geometries__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_GEOMETRIES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_geometries, &ColladaParserAutoGen14Private::_data__library_geometries, &ColladaParserAutoGen14Private::_end__library_geometries, &ColladaParserAutoGen14Private::_preBegin__library_geometries, &ColladaParserAutoGen14Private::_preEnd__library_geometries, &ColladaParserAutoGen14Private::_freeAttributes__library_geometries);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_GEOMETRY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__geometry, &ColladaParserAutoGen14Private::_data__geometry, &ColladaParserAutoGen14Private::_end__geometry, &ColladaParserAutoGen14Private::_preBegin__geometry, &ColladaParserAutoGen14Private::_preEnd__geometry, &ColladaParserAutoGen14Private::_freeAttributes__geometry);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_CONVEX_MESH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__convex_mesh, &ColladaParserAutoGen14Private::_data__convex_mesh, &ColladaParserAutoGen14Private::_end__convex_mesh, &ColladaParserAutoGen14Private::_preBegin__convex_mesh, &ColladaParserAutoGen14Private::_preEnd__convex_mesh, &ColladaParserAutoGen14Private::_freeAttributes__convex_mesh);
-functionMap[HASH_ELEMENT_MESH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mesh, &ColladaParserAutoGen14Private::_data__mesh, &ColladaParserAutoGen14Private::_end__mesh, &ColladaParserAutoGen14Private::_preBegin__mesh, &ColladaParserAutoGen14Private::_preEnd__mesh, &ColladaParserAutoGen14Private::_freeAttributes__mesh);
-functionMap[HASH_ELEMENT_SPLINE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__spline, &ColladaParserAutoGen14Private::_data__spline, &ColladaParserAutoGen14Private::_end__spline, &ColladaParserAutoGen14Private::_preBegin__spline, &ColladaParserAutoGen14Private::_preEnd__spline, &ColladaParserAutoGen14Private::_freeAttributes__spline);
-functionMap[HASH_ELEMENT_LINES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__lines, &ColladaParserAutoGen14Private::_data__lines, &ColladaParserAutoGen14Private::_end__lines, &ColladaParserAutoGen14Private::_preBegin__lines, &ColladaParserAutoGen14Private::_preEnd__lines, &ColladaParserAutoGen14Private::_freeAttributes__lines);
-functionMap[HASH_ELEMENT_LINESTRIPS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__linestrips, &ColladaParserAutoGen14Private::_data__linestrips, &ColladaParserAutoGen14Private::_end__linestrips, &ColladaParserAutoGen14Private::_preBegin__linestrips, &ColladaParserAutoGen14Private::_preEnd__linestrips, &ColladaParserAutoGen14Private::_freeAttributes__linestrips);
-functionMap[HASH_ELEMENT_POLYGONS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polygons, &ColladaParserAutoGen14Private::_data__polygons, &ColladaParserAutoGen14Private::_end__polygons, &ColladaParserAutoGen14Private::_preBegin__polygons, &ColladaParserAutoGen14Private::_preEnd__polygons, &ColladaParserAutoGen14Private::_freeAttributes__polygons);
-functionMap[HASH_ELEMENT_POLYLIST] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__polylist, &ColladaParserAutoGen14Private::_data__polylist, &ColladaParserAutoGen14Private::_end__polylist, &ColladaParserAutoGen14Private::_preBegin__polylist, &ColladaParserAutoGen14Private::_preEnd__polylist, &ColladaParserAutoGen14Private::_freeAttributes__polylist);
-functionMap[HASH_ELEMENT_SOURCE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source, &ColladaParserAutoGen14Private::_data__source, &ColladaParserAutoGen14Private::_end__source, &ColladaParserAutoGen14Private::_preBegin__source, &ColladaParserAutoGen14Private::_preEnd__source, &ColladaParserAutoGen14Private::_freeAttributes__source);
-functionMap[HASH_ELEMENT_TRIANGLES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__triangles, &ColladaParserAutoGen14Private::_data__triangles, &ColladaParserAutoGen14Private::_end__triangles, &ColladaParserAutoGen14Private::_preBegin__triangles, &ColladaParserAutoGen14Private::_preEnd__triangles, &ColladaParserAutoGen14Private::_freeAttributes__triangles);
-functionMap[HASH_ELEMENT_TRIFANS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__trifans, &ColladaParserAutoGen14Private::_data__trifans, &ColladaParserAutoGen14Private::_end__trifans, &ColladaParserAutoGen14Private::_preBegin__trifans, &ColladaParserAutoGen14Private::_preEnd__trifans, &ColladaParserAutoGen14Private::_freeAttributes__trifans);
-functionMap[HASH_ELEMENT_TRISTRIPS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tristrips, &ColladaParserAutoGen14Private::_data__tristrips, &ColladaParserAutoGen14Private::_end__tristrips, &ColladaParserAutoGen14Private::_preBegin__tristrips, &ColladaParserAutoGen14Private::_preEnd__tristrips, &ColladaParserAutoGen14Private::_freeAttributes__tristrips);
-functionMap[HASH_ELEMENT_VERTICES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__vertices, &ColladaParserAutoGen14Private::_data__vertices, &ColladaParserAutoGen14Private::_end__vertices, &ColladaParserAutoGen14Private::_preBegin__vertices, &ColladaParserAutoGen14Private::_preEnd__vertices, &ColladaParserAutoGen14Private::_freeAttributes__vertices);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_P] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__p, &ColladaParserAutoGen14Private::_data__p, &ColladaParserAutoGen14Private::_end__p, &ColladaParserAutoGen14Private::_preBegin__p, &ColladaParserAutoGen14Private::_preEnd__p, &ColladaParserAutoGen14Private::_freeAttributes__p);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_PH] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ph, &ColladaParserAutoGen14Private::_data__ph, &ColladaParserAutoGen14Private::_end__ph, &ColladaParserAutoGen14Private::_preBegin__ph, &ColladaParserAutoGen14Private::_preEnd__ph, &ColladaParserAutoGen14Private::_freeAttributes__ph);
-functionMap[HASH_ELEMENT_H] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__h, &ColladaParserAutoGen14Private::_data__h, &ColladaParserAutoGen14Private::_end__h, &ColladaParserAutoGen14Private::_preBegin__h, &ColladaParserAutoGen14Private::_preEnd__h, &ColladaParserAutoGen14Private::_freeAttributes__h);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_VCOUNT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__vcount, &ColladaParserAutoGen14Private::_data__vcount, &ColladaParserAutoGen14Private::_end__vcount, &ColladaParserAutoGen14Private::_preBegin__vcount, &ColladaParserAutoGen14Private::_preEnd__vcount, &ColladaParserAutoGen14Private::_freeAttributes__vcount);
-functionMap[HASH_ELEMENT_IDREF_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__IDREF_array, &ColladaParserAutoGen14Private::_data__IDREF_array, &ColladaParserAutoGen14Private::_end__IDREF_array, &ColladaParserAutoGen14Private::_preBegin__IDREF_array, &ColladaParserAutoGen14Private::_preEnd__IDREF_array, &ColladaParserAutoGen14Private::_freeAttributes__IDREF_array);
-functionMap[HASH_ELEMENT_NAME_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__Name_array, &ColladaParserAutoGen14Private::_data__Name_array, &ColladaParserAutoGen14Private::_end__Name_array, &ColladaParserAutoGen14Private::_preBegin__Name_array, &ColladaParserAutoGen14Private::_preEnd__Name_array, &ColladaParserAutoGen14Private::_freeAttributes__Name_array);
-functionMap[HASH_ELEMENT_BOOL_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool_array, &ColladaParserAutoGen14Private::_data__bool_array, &ColladaParserAutoGen14Private::_end__bool_array, &ColladaParserAutoGen14Private::_preBegin__bool_array, &ColladaParserAutoGen14Private::_preEnd__bool_array, &ColladaParserAutoGen14Private::_freeAttributes__bool_array);
-functionMap[HASH_ELEMENT_FLOAT_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float_array, &ColladaParserAutoGen14Private::_data__float_array, &ColladaParserAutoGen14Private::_end__float_array, &ColladaParserAutoGen14Private::_preBegin__float_array, &ColladaParserAutoGen14Private::_preEnd__float_array, &ColladaParserAutoGen14Private::_freeAttributes__float_array);
-functionMap[HASH_ELEMENT_INT_ARRAY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int_array, &ColladaParserAutoGen14Private::_data__int_array, &ColladaParserAutoGen14Private::_end__int_array, &ColladaParserAutoGen14Private::_preBegin__int_array, &ColladaParserAutoGen14Private::_preEnd__int_array, &ColladaParserAutoGen14Private::_freeAttributes__int_array);
-functionMap[HASH_ELEMENT_ANIMATION__SOURCE__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__animation__source__technique_common, &ColladaParserAutoGen14Private::_data__animation__source__technique_common, &ColladaParserAutoGen14Private::_end__animation__source__technique_common, &ColladaParserAutoGen14Private::_preBegin__animation__source__technique_common, &ColladaParserAutoGen14Private::_preEnd__animation__source__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__animation__source__technique_common);
-functionMap[HASH_ELEMENT_ACCESSOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__accessor, &ColladaParserAutoGen14Private::_data__accessor, &ColladaParserAutoGen14Private::_end__accessor, &ColladaParserAutoGen14Private::_preBegin__accessor, &ColladaParserAutoGen14Private::_preEnd__accessor, &ColladaParserAutoGen14Private::_freeAttributes__accessor);
-functionMap[HASH_ELEMENT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param, &ColladaParserAutoGen14Private::_data__param, &ColladaParserAutoGen14Private::_end__param, &ColladaParserAutoGen14Private::_preBegin__param, &ColladaParserAutoGen14Private::_preEnd__param, &ColladaParserAutoGen14Private::_freeAttributes__param);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCALOFFSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_data__input____InputLocalOffset, &ColladaParserAutoGen14Private::_end__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preBegin__input____InputLocalOffset, &ColladaParserAutoGen14Private::_preEnd__input____InputLocalOffset, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocalOffset);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocal, &ColladaParserAutoGen14Private::_data__input____InputLocal, &ColladaParserAutoGen14Private::_end__input____InputLocal, &ColladaParserAutoGen14Private::_preBegin__input____InputLocal, &ColladaParserAutoGen14Private::_preEnd__input____InputLocal, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocal);
-functionMap[HASH_ELEMENT_CONTROL_VERTICES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__control_vertices, &ColladaParserAutoGen14Private::_data__control_vertices, &ColladaParserAutoGen14Private::_end__control_vertices, &ColladaParserAutoGen14Private::_preBegin__control_vertices, &ColladaParserAutoGen14Private::_preEnd__control_vertices, &ColladaParserAutoGen14Private::_freeAttributes__control_vertices);
-functionMap[HASH_ELEMENT_INPUT____INPUTLOCAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__input____InputLocal, &ColladaParserAutoGen14Private::_data__input____InputLocal, &ColladaParserAutoGen14Private::_end__input____InputLocal, &ColladaParserAutoGen14Private::_preBegin__input____InputLocal, &ColladaParserAutoGen14Private::_preEnd__input____InputLocal, &ColladaParserAutoGen14Private::_freeAttributes__input____InputLocal);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_GEOMETRIES,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_GEOMETRY,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_CONVEX_MESH,
+HASH_ELEMENT_MESH,
+HASH_ELEMENT_SPLINE,
+HASH_ELEMENT_LINES,
+HASH_ELEMENT_LINESTRIPS,
+HASH_ELEMENT_POLYGONS,
+HASH_ELEMENT_POLYLIST,
+HASH_ELEMENT_SOURCE,
+HASH_ELEMENT_TRIANGLES,
+HASH_ELEMENT_TRIFANS,
+HASH_ELEMENT_TRISTRIPS,
+HASH_ELEMENT_VERTICES,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_P,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_PH,
+HASH_ELEMENT_H,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_VCOUNT,
+HASH_ELEMENT_IDREF_ARRAY,
+HASH_ELEMENT_NAME_ARRAY,
+HASH_ELEMENT_BOOL_ARRAY,
+HASH_ELEMENT_FLOAT_ARRAY,
+HASH_ELEMENT_INT_ARRAY,
+HASH_ELEMENT_ANIMATION__SOURCE__TECHNIQUE_COMMON,
+HASH_ELEMENT_ACCESSOR,
+HASH_ELEMENT_PARAM,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_INPUT____INPUTLOCALOFFSET,
+HASH_ELEMENT_INPUT____INPUTLOCAL,
+HASH_ELEMENT_CONTROL_VERTICES,
+HASH_ELEMENT_INPUT____INPUTLOCAL,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_images__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_IMAGES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_images, &ColladaParserAutoGen14Private::_data__library_images, &ColladaParserAutoGen14Private::_end__library_images, &ColladaParserAutoGen14Private::_preBegin__library_images, &ColladaParserAutoGen14Private::_preEnd__library_images, &ColladaParserAutoGen14Private::_freeAttributes__library_images);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_IMAGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__image, &ColladaParserAutoGen14Private::_data__image, &ColladaParserAutoGen14Private::_end__image, &ColladaParserAutoGen14Private::_preBegin__image, &ColladaParserAutoGen14Private::_preEnd__image, &ColladaParserAutoGen14Private::_freeAttributes__image);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__data, &ColladaParserAutoGen14Private::_data__data, &ColladaParserAutoGen14Private::_end__data, &ColladaParserAutoGen14Private::_preBegin__data, &ColladaParserAutoGen14Private::_preEnd__data, &ColladaParserAutoGen14Private::_freeAttributes__data);
-functionMap[HASH_ELEMENT_INIT_FROM____ANYURI] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_from____anyURI, &ColladaParserAutoGen14Private::_data__init_from____anyURI, &ColladaParserAutoGen14Private::_end__init_from____anyURI, &ColladaParserAutoGen14Private::_preBegin__init_from____anyURI, &ColladaParserAutoGen14Private::_preEnd__init_from____anyURI, &ColladaParserAutoGen14Private::_freeAttributes__init_from____anyURI);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_IMAGES,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_IMAGE,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_DATA,
+HASH_ELEMENT_INIT_FROM____ANYURI,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_lights__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_LIGHTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_lights, &ColladaParserAutoGen14Private::_data__library_lights, &ColladaParserAutoGen14Private::_end__library_lights, &ColladaParserAutoGen14Private::_preBegin__library_lights, &ColladaParserAutoGen14Private::_preEnd__library_lights, &ColladaParserAutoGen14Private::_freeAttributes__library_lights);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_LIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light, &ColladaParserAutoGen14Private::_data__light, &ColladaParserAutoGen14Private::_end__light, &ColladaParserAutoGen14Private::_preBegin__light, &ColladaParserAutoGen14Private::_preEnd__light, &ColladaParserAutoGen14Private::_freeAttributes__light);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_LIGHT__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light__technique_common, &ColladaParserAutoGen14Private::_data__light__technique_common, &ColladaParserAutoGen14Private::_end__light__technique_common, &ColladaParserAutoGen14Private::_preBegin__light__technique_common, &ColladaParserAutoGen14Private::_preEnd__light__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__light__technique_common);
-functionMap[HASH_ELEMENT_LIGHT__TECHNIQUE_COMMON__AMBIENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__light__technique_common__ambient, &ColladaParserAutoGen14Private::_data__light__technique_common__ambient, &ColladaParserAutoGen14Private::_end__light__technique_common__ambient, &ColladaParserAutoGen14Private::_preBegin__light__technique_common__ambient, &ColladaParserAutoGen14Private::_preEnd__light__technique_common__ambient, &ColladaParserAutoGen14Private::_freeAttributes__light__technique_common__ambient);
-functionMap[HASH_ELEMENT_DIRECTIONAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__directional, &ColladaParserAutoGen14Private::_data__directional, &ColladaParserAutoGen14Private::_end__directional, &ColladaParserAutoGen14Private::_preBegin__directional, &ColladaParserAutoGen14Private::_preEnd__directional, &ColladaParserAutoGen14Private::_freeAttributes__directional);
-functionMap[HASH_ELEMENT_POINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__point, &ColladaParserAutoGen14Private::_data__point, &ColladaParserAutoGen14Private::_end__point, &ColladaParserAutoGen14Private::_preBegin__point, &ColladaParserAutoGen14Private::_preEnd__point, &ColladaParserAutoGen14Private::_freeAttributes__point);
-functionMap[HASH_ELEMENT_SPOT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__spot, &ColladaParserAutoGen14Private::_data__spot, &ColladaParserAutoGen14Private::_end__spot, &ColladaParserAutoGen14Private::_preBegin__spot, &ColladaParserAutoGen14Private::_preEnd__spot, &ColladaParserAutoGen14Private::_freeAttributes__spot);
-functionMap[HASH_ELEMENT_COLOR____TARGETABLEFLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_data__color____TargetableFloat3, &ColladaParserAutoGen14Private::_end__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preBegin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preEnd__color____TargetableFloat3, &ColladaParserAutoGen14Private::_freeAttributes__color____TargetableFloat3);
-functionMap[HASH_ELEMENT_COLOR____TARGETABLEFLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_data__color____TargetableFloat3, &ColladaParserAutoGen14Private::_end__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preBegin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preEnd__color____TargetableFloat3, &ColladaParserAutoGen14Private::_freeAttributes__color____TargetableFloat3);
-functionMap[HASH_ELEMENT_COLOR____TARGETABLEFLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_data__color____TargetableFloat3, &ColladaParserAutoGen14Private::_end__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preBegin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preEnd__color____TargetableFloat3, &ColladaParserAutoGen14Private::_freeAttributes__color____TargetableFloat3);
-functionMap[HASH_ELEMENT_CONSTANT_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__constant_attenuation, &ColladaParserAutoGen14Private::_data__constant_attenuation, &ColladaParserAutoGen14Private::_end__constant_attenuation, &ColladaParserAutoGen14Private::_preBegin__constant_attenuation, &ColladaParserAutoGen14Private::_preEnd__constant_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__constant_attenuation);
-functionMap[HASH_ELEMENT_LINEAR_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__linear_attenuation, &ColladaParserAutoGen14Private::_data__linear_attenuation, &ColladaParserAutoGen14Private::_end__linear_attenuation, &ColladaParserAutoGen14Private::_preBegin__linear_attenuation, &ColladaParserAutoGen14Private::_preEnd__linear_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__linear_attenuation);
-functionMap[HASH_ELEMENT_QUADRATIC_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__quadratic_attenuation, &ColladaParserAutoGen14Private::_data__quadratic_attenuation, &ColladaParserAutoGen14Private::_end__quadratic_attenuation, &ColladaParserAutoGen14Private::_preBegin__quadratic_attenuation, &ColladaParserAutoGen14Private::_preEnd__quadratic_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__quadratic_attenuation);
-functionMap[HASH_ELEMENT_COLOR____TARGETABLEFLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_data__color____TargetableFloat3, &ColladaParserAutoGen14Private::_end__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preBegin__color____TargetableFloat3, &ColladaParserAutoGen14Private::_preEnd__color____TargetableFloat3, &ColladaParserAutoGen14Private::_freeAttributes__color____TargetableFloat3);
-functionMap[HASH_ELEMENT_CONSTANT_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__constant_attenuation, &ColladaParserAutoGen14Private::_data__constant_attenuation, &ColladaParserAutoGen14Private::_end__constant_attenuation, &ColladaParserAutoGen14Private::_preBegin__constant_attenuation, &ColladaParserAutoGen14Private::_preEnd__constant_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__constant_attenuation);
-functionMap[HASH_ELEMENT_FALLOFF_ANGLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__falloff_angle, &ColladaParserAutoGen14Private::_data__falloff_angle, &ColladaParserAutoGen14Private::_end__falloff_angle, &ColladaParserAutoGen14Private::_preBegin__falloff_angle, &ColladaParserAutoGen14Private::_preEnd__falloff_angle, &ColladaParserAutoGen14Private::_freeAttributes__falloff_angle);
-functionMap[HASH_ELEMENT_FALLOFF_EXPONENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__falloff_exponent, &ColladaParserAutoGen14Private::_data__falloff_exponent, &ColladaParserAutoGen14Private::_end__falloff_exponent, &ColladaParserAutoGen14Private::_preBegin__falloff_exponent, &ColladaParserAutoGen14Private::_preEnd__falloff_exponent, &ColladaParserAutoGen14Private::_freeAttributes__falloff_exponent);
-functionMap[HASH_ELEMENT_LINEAR_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__linear_attenuation, &ColladaParserAutoGen14Private::_data__linear_attenuation, &ColladaParserAutoGen14Private::_end__linear_attenuation, &ColladaParserAutoGen14Private::_preBegin__linear_attenuation, &ColladaParserAutoGen14Private::_preEnd__linear_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__linear_attenuation);
-functionMap[HASH_ELEMENT_QUADRATIC_ATTENUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__quadratic_attenuation, &ColladaParserAutoGen14Private::_data__quadratic_attenuation, &ColladaParserAutoGen14Private::_end__quadratic_attenuation, &ColladaParserAutoGen14Private::_preBegin__quadratic_attenuation, &ColladaParserAutoGen14Private::_preEnd__quadratic_attenuation, &ColladaParserAutoGen14Private::_freeAttributes__quadratic_attenuation);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_LIGHTS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_LIGHT,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_LIGHT__TECHNIQUE_COMMON,
+HASH_ELEMENT_LIGHT__TECHNIQUE_COMMON__AMBIENT,
+HASH_ELEMENT_DIRECTIONAL,
+HASH_ELEMENT_POINT,
+HASH_ELEMENT_SPOT,
+HASH_ELEMENT_COLOR____TARGETABLEFLOAT3,
+HASH_ELEMENT_COLOR____TARGETABLEFLOAT3,
+HASH_ELEMENT_COLOR____TARGETABLEFLOAT3,
+HASH_ELEMENT_CONSTANT_ATTENUATION,
+HASH_ELEMENT_LINEAR_ATTENUATION,
+HASH_ELEMENT_QUADRATIC_ATTENUATION,
+HASH_ELEMENT_COLOR____TARGETABLEFLOAT3,
+HASH_ELEMENT_CONSTANT_ATTENUATION,
+HASH_ELEMENT_FALLOFF_ANGLE,
+HASH_ELEMENT_FALLOFF_EXPONENT,
+HASH_ELEMENT_LINEAR_ATTENUATION,
+HASH_ELEMENT_QUADRATIC_ATTENUATION,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_materials__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_MATERIALS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_materials, &ColladaParserAutoGen14Private::_data__library_materials, &ColladaParserAutoGen14Private::_end__library_materials, &ColladaParserAutoGen14Private::_preBegin__library_materials, &ColladaParserAutoGen14Private::_preEnd__library_materials, &ColladaParserAutoGen14Private::_freeAttributes__library_materials);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__material, &ColladaParserAutoGen14Private::_data__material, &ColladaParserAutoGen14Private::_end__material, &ColladaParserAutoGen14Private::_preBegin__material, &ColladaParserAutoGen14Private::_preEnd__material, &ColladaParserAutoGen14Private::_freeAttributes__material);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_INSTANCE_EFFECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_effect, &ColladaParserAutoGen14Private::_data__instance_effect, &ColladaParserAutoGen14Private::_end__instance_effect, &ColladaParserAutoGen14Private::_preBegin__instance_effect, &ColladaParserAutoGen14Private::_preEnd__instance_effect, &ColladaParserAutoGen14Private::_freeAttributes__instance_effect);
-functionMap[HASH_ELEMENT_INSTANCE_EFFECT__SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_effect__setparam, &ColladaParserAutoGen14Private::_data__instance_effect__setparam, &ColladaParserAutoGen14Private::_end__instance_effect__setparam, &ColladaParserAutoGen14Private::_preBegin__instance_effect__setparam, &ColladaParserAutoGen14Private::_preEnd__instance_effect__setparam, &ColladaParserAutoGen14Private::_freeAttributes__instance_effect__setparam);
-functionMap[HASH_ELEMENT_TECHNIQUE_HINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique_hint, &ColladaParserAutoGen14Private::_data__technique_hint, &ColladaParserAutoGen14Private::_end__technique_hint, &ColladaParserAutoGen14Private::_preBegin__technique_hint, &ColladaParserAutoGen14Private::_preEnd__technique_hint, &ColladaParserAutoGen14Private::_freeAttributes__technique_hint);
-functionMap[HASH_ELEMENT_BOOL____BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____bool, &ColladaParserAutoGen14Private::_data__bool____bool, &ColladaParserAutoGen14Private::_end__bool____bool, &ColladaParserAutoGen14Private::_preBegin__bool____bool, &ColladaParserAutoGen14Private::_preEnd__bool____bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____bool);
-functionMap[HASH_ELEMENT_BOOL2____BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____bool2, &ColladaParserAutoGen14Private::_data__bool2____bool2, &ColladaParserAutoGen14Private::_end__bool2____bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____bool2);
-functionMap[HASH_ELEMENT_BOOL3____BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____bool3, &ColladaParserAutoGen14Private::_data__bool3____bool3, &ColladaParserAutoGen14Private::_end__bool3____bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____bool3);
-functionMap[HASH_ELEMENT_BOOL4____BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____bool4, &ColladaParserAutoGen14Private::_data__bool4____bool4, &ColladaParserAutoGen14Private::_end__bool4____bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____bool4);
-functionMap[HASH_ELEMENT_ENUM____STRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____string, &ColladaParserAutoGen14Private::_data__enum____string, &ColladaParserAutoGen14Private::_end__enum____string, &ColladaParserAutoGen14Private::_preBegin__enum____string, &ColladaParserAutoGen14Private::_preEnd__enum____string, &ColladaParserAutoGen14Private::_freeAttributes__enum____string);
-functionMap[HASH_ELEMENT_FLOAT____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____float, &ColladaParserAutoGen14Private::_data__float____float, &ColladaParserAutoGen14Private::_end__float____float, &ColladaParserAutoGen14Private::_preBegin__float____float, &ColladaParserAutoGen14Private::_preEnd__float____float, &ColladaParserAutoGen14Private::_freeAttributes__float____float);
-functionMap[HASH_ELEMENT_FLOAT1X1____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x1____float, &ColladaParserAutoGen14Private::_data__float1x1____float, &ColladaParserAutoGen14Private::_end__float1x1____float, &ColladaParserAutoGen14Private::_preBegin__float1x1____float, &ColladaParserAutoGen14Private::_preEnd__float1x1____float, &ColladaParserAutoGen14Private::_freeAttributes__float1x1____float);
-functionMap[HASH_ELEMENT_FLOAT1X2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x2____float2, &ColladaParserAutoGen14Private::_data__float1x2____float2, &ColladaParserAutoGen14Private::_end__float1x2____float2, &ColladaParserAutoGen14Private::_preBegin__float1x2____float2, &ColladaParserAutoGen14Private::_preEnd__float1x2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float1x2____float2);
-functionMap[HASH_ELEMENT_FLOAT1X3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x3____float3, &ColladaParserAutoGen14Private::_data__float1x3____float3, &ColladaParserAutoGen14Private::_end__float1x3____float3, &ColladaParserAutoGen14Private::_preBegin__float1x3____float3, &ColladaParserAutoGen14Private::_preEnd__float1x3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float1x3____float3);
-functionMap[HASH_ELEMENT_FLOAT1X4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x4____float4, &ColladaParserAutoGen14Private::_data__float1x4____float4, &ColladaParserAutoGen14Private::_end__float1x4____float4, &ColladaParserAutoGen14Private::_preBegin__float1x4____float4, &ColladaParserAutoGen14Private::_preEnd__float1x4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float1x4____float4);
-functionMap[HASH_ELEMENT_FLOAT2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____float2, &ColladaParserAutoGen14Private::_data__float2____float2, &ColladaParserAutoGen14Private::_end__float2____float2, &ColladaParserAutoGen14Private::_preBegin__float2____float2, &ColladaParserAutoGen14Private::_preEnd__float2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____float2);
-functionMap[HASH_ELEMENT_FLOAT2X1____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x1____float2, &ColladaParserAutoGen14Private::_data__float2x1____float2, &ColladaParserAutoGen14Private::_end__float2x1____float2, &ColladaParserAutoGen14Private::_preBegin__float2x1____float2, &ColladaParserAutoGen14Private::_preEnd__float2x1____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2x1____float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____float2x2, &ColladaParserAutoGen14Private::_data__float2x2____float2x2, &ColladaParserAutoGen14Private::_end__float2x2____float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____float2x2);
-functionMap[HASH_ELEMENT_FLOAT2X3____FLOAT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x3____float2x3, &ColladaParserAutoGen14Private::_data__float2x3____float2x3, &ColladaParserAutoGen14Private::_end__float2x3____float2x3, &ColladaParserAutoGen14Private::_preBegin__float2x3____float2x3, &ColladaParserAutoGen14Private::_preEnd__float2x3____float2x3, &ColladaParserAutoGen14Private::_freeAttributes__float2x3____float2x3);
-functionMap[HASH_ELEMENT_FLOAT2X4____FLOAT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x4____float2x4, &ColladaParserAutoGen14Private::_data__float2x4____float2x4, &ColladaParserAutoGen14Private::_end__float2x4____float2x4, &ColladaParserAutoGen14Private::_preBegin__float2x4____float2x4, &ColladaParserAutoGen14Private::_preEnd__float2x4____float2x4, &ColladaParserAutoGen14Private::_freeAttributes__float2x4____float2x4);
-functionMap[HASH_ELEMENT_FLOAT3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____float3, &ColladaParserAutoGen14Private::_data__float3____float3, &ColladaParserAutoGen14Private::_end__float3____float3, &ColladaParserAutoGen14Private::_preBegin__float3____float3, &ColladaParserAutoGen14Private::_preEnd__float3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____float3);
-functionMap[HASH_ELEMENT_FLOAT3X1____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x1____float3, &ColladaParserAutoGen14Private::_data__float3x1____float3, &ColladaParserAutoGen14Private::_end__float3x1____float3, &ColladaParserAutoGen14Private::_preBegin__float3x1____float3, &ColladaParserAutoGen14Private::_preEnd__float3x1____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3x1____float3);
-functionMap[HASH_ELEMENT_FLOAT3X2____FLOAT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x2____float3x2, &ColladaParserAutoGen14Private::_data__float3x2____float3x2, &ColladaParserAutoGen14Private::_end__float3x2____float3x2, &ColladaParserAutoGen14Private::_preBegin__float3x2____float3x2, &ColladaParserAutoGen14Private::_preEnd__float3x2____float3x2, &ColladaParserAutoGen14Private::_freeAttributes__float3x2____float3x2);
-functionMap[HASH_ELEMENT_FLOAT3X3____FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____float3x3, &ColladaParserAutoGen14Private::_data__float3x3____float3x3, &ColladaParserAutoGen14Private::_end__float3x3____float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____float3x3);
-functionMap[HASH_ELEMENT_FLOAT3X4____FLOAT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x4____float3x4, &ColladaParserAutoGen14Private::_data__float3x4____float3x4, &ColladaParserAutoGen14Private::_end__float3x4____float3x4, &ColladaParserAutoGen14Private::_preBegin__float3x4____float3x4, &ColladaParserAutoGen14Private::_preEnd__float3x4____float3x4, &ColladaParserAutoGen14Private::_freeAttributes__float3x4____float3x4);
-functionMap[HASH_ELEMENT_FLOAT4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____float4, &ColladaParserAutoGen14Private::_data__float4____float4, &ColladaParserAutoGen14Private::_end__float4____float4, &ColladaParserAutoGen14Private::_preBegin__float4____float4, &ColladaParserAutoGen14Private::_preEnd__float4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____float4);
-functionMap[HASH_ELEMENT_FLOAT4X1____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x1____float4, &ColladaParserAutoGen14Private::_data__float4x1____float4, &ColladaParserAutoGen14Private::_end__float4x1____float4, &ColladaParserAutoGen14Private::_preBegin__float4x1____float4, &ColladaParserAutoGen14Private::_preEnd__float4x1____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4x1____float4);
-functionMap[HASH_ELEMENT_FLOAT4X2____FLOAT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x2____float4x2, &ColladaParserAutoGen14Private::_data__float4x2____float4x2, &ColladaParserAutoGen14Private::_end__float4x2____float4x2, &ColladaParserAutoGen14Private::_preBegin__float4x2____float4x2, &ColladaParserAutoGen14Private::_preEnd__float4x2____float4x2, &ColladaParserAutoGen14Private::_freeAttributes__float4x2____float4x2);
-functionMap[HASH_ELEMENT_FLOAT4X3____FLOAT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x3____float4x3, &ColladaParserAutoGen14Private::_data__float4x3____float4x3, &ColladaParserAutoGen14Private::_end__float4x3____float4x3, &ColladaParserAutoGen14Private::_preBegin__float4x3____float4x3, &ColladaParserAutoGen14Private::_preEnd__float4x3____float4x3, &ColladaParserAutoGen14Private::_freeAttributes__float4x3____float4x3);
-functionMap[HASH_ELEMENT_FLOAT4X4____FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____float4x4, &ColladaParserAutoGen14Private::_data__float4x4____float4x4, &ColladaParserAutoGen14Private::_end__float4x4____float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____float4x4);
-functionMap[HASH_ELEMENT_INT____INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____int, &ColladaParserAutoGen14Private::_data__int____int, &ColladaParserAutoGen14Private::_end__int____int, &ColladaParserAutoGen14Private::_preBegin__int____int, &ColladaParserAutoGen14Private::_preEnd__int____int, &ColladaParserAutoGen14Private::_freeAttributes__int____int);
-functionMap[HASH_ELEMENT_INT2____INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____int2, &ColladaParserAutoGen14Private::_data__int2____int2, &ColladaParserAutoGen14Private::_end__int2____int2, &ColladaParserAutoGen14Private::_preBegin__int2____int2, &ColladaParserAutoGen14Private::_preEnd__int2____int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____int2);
-functionMap[HASH_ELEMENT_INT3____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____int3, &ColladaParserAutoGen14Private::_data__int3____int3, &ColladaParserAutoGen14Private::_end__int3____int3, &ColladaParserAutoGen14Private::_preBegin__int3____int3, &ColladaParserAutoGen14Private::_preEnd__int3____int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____int3);
-functionMap[HASH_ELEMENT_INT4____INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____int4, &ColladaParserAutoGen14Private::_data__int4____int4, &ColladaParserAutoGen14Private::_end__int4____int4, &ColladaParserAutoGen14Private::_preBegin__int4____int4, &ColladaParserAutoGen14Private::_preEnd__int4____int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____int4);
-functionMap[HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_data__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_end__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preBegin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preEnd__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____fx_sampler1D_common);
-functionMap[HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_data__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_end__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preBegin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preEnd__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____fx_sampler2D_common);
-functionMap[HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_data__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_end__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preBegin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preEnd__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____fx_sampler3D_common);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_data__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_end__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____fx_samplerCUBE_common);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_data__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_end__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____fx_samplerDEPTH_common);
-functionMap[HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_data__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_end__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____fx_samplerRECT_common);
-functionMap[HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_data__surface____fx_surface_common, &ColladaParserAutoGen14Private::_end__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preBegin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preEnd__surface____fx_surface_common, &ColladaParserAutoGen14Private::_freeAttributes__surface____fx_surface_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_P] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_p, &ColladaParserAutoGen14Private::_data__wrap_p, &ColladaParserAutoGen14Private::_end__wrap_p, &ColladaParserAutoGen14Private::_preBegin__wrap_p, &ColladaParserAutoGen14Private::_preEnd__wrap_p, &ColladaParserAutoGen14Private::_freeAttributes__wrap_p);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_P] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_p, &ColladaParserAutoGen14Private::_data__wrap_p, &ColladaParserAutoGen14Private::_end__wrap_p, &ColladaParserAutoGen14Private::_preBegin__wrap_p, &ColladaParserAutoGen14Private::_preEnd__wrap_p, &ColladaParserAutoGen14Private::_freeAttributes__wrap_p);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_FORMAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__format, &ColladaParserAutoGen14Private::_data__format, &ColladaParserAutoGen14Private::_end__format, &ColladaParserAutoGen14Private::_preBegin__format, &ColladaParserAutoGen14Private::_preEnd__format, &ColladaParserAutoGen14Private::_freeAttributes__format);
-functionMap[HASH_ELEMENT_FORMAT_HINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__format_hint, &ColladaParserAutoGen14Private::_data__format_hint, &ColladaParserAutoGen14Private::_end__format_hint, &ColladaParserAutoGen14Private::_preBegin__format_hint, &ColladaParserAutoGen14Private::_preEnd__format_hint, &ColladaParserAutoGen14Private::_freeAttributes__format_hint);
-functionMap[HASH_ELEMENT_INIT_AS_NULL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_as_null, &ColladaParserAutoGen14Private::_data__init_as_null, &ColladaParserAutoGen14Private::_end__init_as_null, &ColladaParserAutoGen14Private::_preBegin__init_as_null, &ColladaParserAutoGen14Private::_preEnd__init_as_null, &ColladaParserAutoGen14Private::_freeAttributes__init_as_null);
-functionMap[HASH_ELEMENT_INIT_AS_TARGET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_as_target, &ColladaParserAutoGen14Private::_data__init_as_target, &ColladaParserAutoGen14Private::_end__init_as_target, &ColladaParserAutoGen14Private::_preBegin__init_as_target, &ColladaParserAutoGen14Private::_preEnd__init_as_target, &ColladaParserAutoGen14Private::_freeAttributes__init_as_target);
-functionMap[HASH_ELEMENT_INIT_CUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_cube, &ColladaParserAutoGen14Private::_data__init_cube, &ColladaParserAutoGen14Private::_end__init_cube, &ColladaParserAutoGen14Private::_preBegin__init_cube, &ColladaParserAutoGen14Private::_preEnd__init_cube, &ColladaParserAutoGen14Private::_freeAttributes__init_cube);
-functionMap[HASH_ELEMENT_INIT_FROM____FX_SURFACE_INIT_FROM_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_data__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_end__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_preBegin__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_preEnd__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_freeAttributes__init_from____fx_surface_init_from_common);
-functionMap[HASH_ELEMENT_INIT_PLANAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_planar, &ColladaParserAutoGen14Private::_data__init_planar, &ColladaParserAutoGen14Private::_end__init_planar, &ColladaParserAutoGen14Private::_preBegin__init_planar, &ColladaParserAutoGen14Private::_preEnd__init_planar, &ColladaParserAutoGen14Private::_freeAttributes__init_planar);
-functionMap[HASH_ELEMENT_INIT_VOLUME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_volume, &ColladaParserAutoGen14Private::_data__init_volume, &ColladaParserAutoGen14Private::_end__init_volume, &ColladaParserAutoGen14Private::_preBegin__init_volume, &ColladaParserAutoGen14Private::_preEnd__init_volume, &ColladaParserAutoGen14Private::_freeAttributes__init_volume);
-functionMap[HASH_ELEMENT_MIP_LEVELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mip_levels, &ColladaParserAutoGen14Private::_data__mip_levels, &ColladaParserAutoGen14Private::_end__mip_levels, &ColladaParserAutoGen14Private::_preBegin__mip_levels, &ColladaParserAutoGen14Private::_preEnd__mip_levels, &ColladaParserAutoGen14Private::_freeAttributes__mip_levels);
-functionMap[HASH_ELEMENT_MIPMAP_GENERATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_generate, &ColladaParserAutoGen14Private::_data__mipmap_generate, &ColladaParserAutoGen14Private::_end__mipmap_generate, &ColladaParserAutoGen14Private::_preBegin__mipmap_generate, &ColladaParserAutoGen14Private::_preEnd__mipmap_generate, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_generate);
-functionMap[HASH_ELEMENT_SIZE____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__size____int3, &ColladaParserAutoGen14Private::_data__size____int3, &ColladaParserAutoGen14Private::_end__size____int3, &ColladaParserAutoGen14Private::_preBegin__size____int3, &ColladaParserAutoGen14Private::_preEnd__size____int3, &ColladaParserAutoGen14Private::_freeAttributes__size____int3);
-functionMap[HASH_ELEMENT_VIEWPORT_RATIO] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__viewport_ratio, &ColladaParserAutoGen14Private::_data__viewport_ratio, &ColladaParserAutoGen14Private::_end__viewport_ratio, &ColladaParserAutoGen14Private::_preBegin__viewport_ratio, &ColladaParserAutoGen14Private::_preEnd__viewport_ratio, &ColladaParserAutoGen14Private::_freeAttributes__viewport_ratio);
-functionMap[HASH_ELEMENT_CHANNELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__channels, &ColladaParserAutoGen14Private::_data__channels, &ColladaParserAutoGen14Private::_end__channels, &ColladaParserAutoGen14Private::_preBegin__channels, &ColladaParserAutoGen14Private::_preEnd__channels, &ColladaParserAutoGen14Private::_freeAttributes__channels);
-functionMap[HASH_ELEMENT_OPTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__option, &ColladaParserAutoGen14Private::_data__option, &ColladaParserAutoGen14Private::_end__option, &ColladaParserAutoGen14Private::_preBegin__option, &ColladaParserAutoGen14Private::_preEnd__option, &ColladaParserAutoGen14Private::_freeAttributes__option);
-functionMap[HASH_ELEMENT_PRECISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__precision, &ColladaParserAutoGen14Private::_data__precision, &ColladaParserAutoGen14Private::_end__precision, &ColladaParserAutoGen14Private::_preBegin__precision, &ColladaParserAutoGen14Private::_preEnd__precision, &ColladaParserAutoGen14Private::_freeAttributes__precision);
-functionMap[HASH_ELEMENT_RANGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__range, &ColladaParserAutoGen14Private::_data__range, &ColladaParserAutoGen14Private::_end__range, &ColladaParserAutoGen14Private::_preBegin__range, &ColladaParserAutoGen14Private::_preEnd__range, &ColladaParserAutoGen14Private::_freeAttributes__range);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____face);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____PRIMARY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____primary);
-functionMap[HASH_ELEMENT_ORDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__order, &ColladaParserAutoGen14Private::_data__order, &ColladaParserAutoGen14Private::_end__order, &ColladaParserAutoGen14Private::_preBegin__order, &ColladaParserAutoGen14Private::_preEnd__order, &ColladaParserAutoGen14Private::_freeAttributes__order);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_PLANAR_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_planar_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_volume_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____PRIMARY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_data__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_end__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_volume_common____primary);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_MATERIALS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_MATERIAL,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_INSTANCE_EFFECT,
+HASH_ELEMENT_INSTANCE_EFFECT__SETPARAM,
+HASH_ELEMENT_TECHNIQUE_HINT,
+HASH_ELEMENT_BOOL____BOOL,
+HASH_ELEMENT_BOOL2____BOOL2,
+HASH_ELEMENT_BOOL3____BOOL3,
+HASH_ELEMENT_BOOL4____BOOL4,
+HASH_ELEMENT_ENUM____STRING,
+HASH_ELEMENT_FLOAT____FLOAT,
+HASH_ELEMENT_FLOAT1X1____FLOAT,
+HASH_ELEMENT_FLOAT1X2____FLOAT2,
+HASH_ELEMENT_FLOAT1X3____FLOAT3,
+HASH_ELEMENT_FLOAT1X4____FLOAT4,
+HASH_ELEMENT_FLOAT2____FLOAT2,
+HASH_ELEMENT_FLOAT2X1____FLOAT2,
+HASH_ELEMENT_FLOAT2X2____FLOAT2X2,
+HASH_ELEMENT_FLOAT2X3____FLOAT2X3,
+HASH_ELEMENT_FLOAT2X4____FLOAT2X4,
+HASH_ELEMENT_FLOAT3____FLOAT3,
+HASH_ELEMENT_FLOAT3X1____FLOAT3,
+HASH_ELEMENT_FLOAT3X2____FLOAT3X2,
+HASH_ELEMENT_FLOAT3X3____FLOAT3X3,
+HASH_ELEMENT_FLOAT3X4____FLOAT3X4,
+HASH_ELEMENT_FLOAT4____FLOAT4,
+HASH_ELEMENT_FLOAT4X1____FLOAT4,
+HASH_ELEMENT_FLOAT4X2____FLOAT4X2,
+HASH_ELEMENT_FLOAT4X3____FLOAT4X3,
+HASH_ELEMENT_FLOAT4X4____FLOAT4X4,
+HASH_ELEMENT_INT____INT,
+HASH_ELEMENT_INT2____INT2,
+HASH_ELEMENT_INT3____INT3,
+HASH_ELEMENT_INT4____INT4,
+HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON,
+HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON,
+HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON,
+HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON,
+HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON,
+HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON,
+HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_P,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_P,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_FORMAT,
+HASH_ELEMENT_FORMAT_HINT,
+HASH_ELEMENT_INIT_AS_NULL,
+HASH_ELEMENT_INIT_AS_TARGET,
+HASH_ELEMENT_INIT_CUBE,
+HASH_ELEMENT_INIT_FROM____FX_SURFACE_INIT_FROM_COMMON,
+HASH_ELEMENT_INIT_PLANAR,
+HASH_ELEMENT_INIT_VOLUME,
+HASH_ELEMENT_MIP_LEVELS,
+HASH_ELEMENT_MIPMAP_GENERATE,
+HASH_ELEMENT_SIZE____INT3,
+HASH_ELEMENT_VIEWPORT_RATIO,
+HASH_ELEMENT_CHANNELS,
+HASH_ELEMENT_OPTION,
+HASH_ELEMENT_PRECISION,
+HASH_ELEMENT_RANGE,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____FACE,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____PRIMARY,
+HASH_ELEMENT_ORDER,
+HASH_ELEMENT_FX_SURFACE_INIT_PLANAR_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____PRIMARY,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_nodes__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_NODES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_nodes, &ColladaParserAutoGen14Private::_data__library_nodes, &ColladaParserAutoGen14Private::_end__library_nodes, &ColladaParserAutoGen14Private::_preBegin__library_nodes, &ColladaParserAutoGen14Private::_preEnd__library_nodes, &ColladaParserAutoGen14Private::_freeAttributes__library_nodes);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_NODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__node, &ColladaParserAutoGen14Private::_data__node, &ColladaParserAutoGen14Private::_end__node, &ColladaParserAutoGen14Private::_preBegin__node, &ColladaParserAutoGen14Private::_preEnd__node, &ColladaParserAutoGen14Private::_freeAttributes__node);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_INSTANCE_CAMERA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_camera, &ColladaParserAutoGen14Private::_data__instance_camera, &ColladaParserAutoGen14Private::_end__instance_camera, &ColladaParserAutoGen14Private::_preBegin__instance_camera, &ColladaParserAutoGen14Private::_preEnd__instance_camera, &ColladaParserAutoGen14Private::_freeAttributes__instance_camera);
-functionMap[HASH_ELEMENT_INSTANCE_CONTROLLER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_controller, &ColladaParserAutoGen14Private::_data__instance_controller, &ColladaParserAutoGen14Private::_end__instance_controller, &ColladaParserAutoGen14Private::_preBegin__instance_controller, &ColladaParserAutoGen14Private::_preEnd__instance_controller, &ColladaParserAutoGen14Private::_freeAttributes__instance_controller);
-functionMap[HASH_ELEMENT_INSTANCE_GEOMETRY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_geometry, &ColladaParserAutoGen14Private::_data__instance_geometry, &ColladaParserAutoGen14Private::_end__instance_geometry, &ColladaParserAutoGen14Private::_preBegin__instance_geometry, &ColladaParserAutoGen14Private::_preEnd__instance_geometry, &ColladaParserAutoGen14Private::_freeAttributes__instance_geometry);
-functionMap[HASH_ELEMENT_INSTANCE_LIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_light, &ColladaParserAutoGen14Private::_data__instance_light, &ColladaParserAutoGen14Private::_end__instance_light, &ColladaParserAutoGen14Private::_preBegin__instance_light, &ColladaParserAutoGen14Private::_preEnd__instance_light, &ColladaParserAutoGen14Private::_freeAttributes__instance_light);
-functionMap[HASH_ELEMENT_INSTANCE_NODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_node, &ColladaParserAutoGen14Private::_data__instance_node, &ColladaParserAutoGen14Private::_end__instance_node, &ColladaParserAutoGen14Private::_preBegin__instance_node, &ColladaParserAutoGen14Private::_preEnd__instance_node, &ColladaParserAutoGen14Private::_freeAttributes__instance_node);
-functionMap[HASH_ELEMENT_LOOKAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__lookat, &ColladaParserAutoGen14Private::_data__lookat, &ColladaParserAutoGen14Private::_end__lookat, &ColladaParserAutoGen14Private::_preBegin__lookat, &ColladaParserAutoGen14Private::_preEnd__lookat, &ColladaParserAutoGen14Private::_freeAttributes__lookat);
-functionMap[HASH_ELEMENT_MATRIX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__matrix, &ColladaParserAutoGen14Private::_data__matrix, &ColladaParserAutoGen14Private::_end__matrix, &ColladaParserAutoGen14Private::_preBegin__matrix, &ColladaParserAutoGen14Private::_preEnd__matrix, &ColladaParserAutoGen14Private::_freeAttributes__matrix);
-functionMap[HASH_ELEMENT_ROTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rotate, &ColladaParserAutoGen14Private::_data__rotate, &ColladaParserAutoGen14Private::_end__rotate, &ColladaParserAutoGen14Private::_preBegin__rotate, &ColladaParserAutoGen14Private::_preEnd__rotate, &ColladaParserAutoGen14Private::_freeAttributes__rotate);
-functionMap[HASH_ELEMENT_SCALE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__scale, &ColladaParserAutoGen14Private::_data__scale, &ColladaParserAutoGen14Private::_end__scale, &ColladaParserAutoGen14Private::_preBegin__scale, &ColladaParserAutoGen14Private::_preEnd__scale, &ColladaParserAutoGen14Private::_freeAttributes__scale);
-functionMap[HASH_ELEMENT_SKEW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__skew, &ColladaParserAutoGen14Private::_data__skew, &ColladaParserAutoGen14Private::_end__skew, &ColladaParserAutoGen14Private::_preBegin__skew, &ColladaParserAutoGen14Private::_preEnd__skew, &ColladaParserAutoGen14Private::_freeAttributes__skew);
-functionMap[HASH_ELEMENT_TRANSLATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__translate, &ColladaParserAutoGen14Private::_data__translate, &ColladaParserAutoGen14Private::_end__translate, &ColladaParserAutoGen14Private::_preBegin__translate, &ColladaParserAutoGen14Private::_preEnd__translate, &ColladaParserAutoGen14Private::_freeAttributes__translate);
-functionMap[HASH_ELEMENT_BIND_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material, &ColladaParserAutoGen14Private::_data__bind_material, &ColladaParserAutoGen14Private::_end__bind_material, &ColladaParserAutoGen14Private::_preBegin__bind_material, &ColladaParserAutoGen14Private::_preEnd__bind_material, &ColladaParserAutoGen14Private::_freeAttributes__bind_material);
-functionMap[HASH_ELEMENT_SKELETON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__skeleton, &ColladaParserAutoGen14Private::_data__skeleton, &ColladaParserAutoGen14Private::_end__skeleton, &ColladaParserAutoGen14Private::_preBegin__skeleton, &ColladaParserAutoGen14Private::_preEnd__skeleton, &ColladaParserAutoGen14Private::_freeAttributes__skeleton);
-functionMap[HASH_ELEMENT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param, &ColladaParserAutoGen14Private::_data__param, &ColladaParserAutoGen14Private::_end__param, &ColladaParserAutoGen14Private::_preBegin__param, &ColladaParserAutoGen14Private::_preEnd__param, &ColladaParserAutoGen14Private::_freeAttributes__param);
-functionMap[HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material__technique_common, &ColladaParserAutoGen14Private::_data__bind_material__technique_common, &ColladaParserAutoGen14Private::_end__bind_material__technique_common, &ColladaParserAutoGen14Private::_preBegin__bind_material__technique_common, &ColladaParserAutoGen14Private::_preEnd__bind_material__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__bind_material__technique_common);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material, &ColladaParserAutoGen14Private::_data__instance_material, &ColladaParserAutoGen14Private::_end__instance_material, &ColladaParserAutoGen14Private::_preBegin__instance_material, &ColladaParserAutoGen14Private::_preEnd__instance_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_material);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL__BIND] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material__bind, &ColladaParserAutoGen14Private::_data__instance_material__bind, &ColladaParserAutoGen14Private::_end__instance_material__bind, &ColladaParserAutoGen14Private::_preBegin__instance_material__bind, &ColladaParserAutoGen14Private::_preEnd__instance_material__bind, &ColladaParserAutoGen14Private::_freeAttributes__instance_material__bind);
-functionMap[HASH_ELEMENT_BIND_VERTEX_INPUT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_vertex_input, &ColladaParserAutoGen14Private::_data__bind_vertex_input, &ColladaParserAutoGen14Private::_end__bind_vertex_input, &ColladaParserAutoGen14Private::_preBegin__bind_vertex_input, &ColladaParserAutoGen14Private::_preEnd__bind_vertex_input, &ColladaParserAutoGen14Private::_freeAttributes__bind_vertex_input);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_NODES,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_NODE,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_INSTANCE_CAMERA,
+HASH_ELEMENT_INSTANCE_CONTROLLER,
+HASH_ELEMENT_INSTANCE_GEOMETRY,
+HASH_ELEMENT_INSTANCE_LIGHT,
+HASH_ELEMENT_INSTANCE_NODE,
+HASH_ELEMENT_LOOKAT,
+HASH_ELEMENT_MATRIX,
+HASH_ELEMENT_ROTATE,
+HASH_ELEMENT_SCALE,
+HASH_ELEMENT_SKEW,
+HASH_ELEMENT_TRANSLATE,
+HASH_ELEMENT_BIND_MATERIAL,
+HASH_ELEMENT_SKELETON,
+HASH_ELEMENT_PARAM,
+HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON,
+HASH_ELEMENT_INSTANCE_MATERIAL,
+HASH_ELEMENT_INSTANCE_MATERIAL__BIND,
+HASH_ELEMENT_BIND_VERTEX_INPUT,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_physics_materials__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_MATERIALS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_materials, &ColladaParserAutoGen14Private::_data__library_physics_materials, &ColladaParserAutoGen14Private::_end__library_physics_materials, &ColladaParserAutoGen14Private::_preBegin__library_physics_materials, &ColladaParserAutoGen14Private::_preEnd__library_physics_materials, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_materials);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_PHYSICS_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_material, &ColladaParserAutoGen14Private::_data__physics_material, &ColladaParserAutoGen14Private::_end__physics_material, &ColladaParserAutoGen14Private::_preBegin__physics_material, &ColladaParserAutoGen14Private::_preEnd__physics_material, &ColladaParserAutoGen14Private::_freeAttributes__physics_material);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_PHYSICS_MATERIAL__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_material__technique_common, &ColladaParserAutoGen14Private::_data__physics_material__technique_common, &ColladaParserAutoGen14Private::_end__physics_material__technique_common, &ColladaParserAutoGen14Private::_preBegin__physics_material__technique_common, &ColladaParserAutoGen14Private::_preEnd__physics_material__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__physics_material__technique_common);
-functionMap[HASH_ELEMENT_DYNAMIC_FRICTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__dynamic_friction, &ColladaParserAutoGen14Private::_data__dynamic_friction, &ColladaParserAutoGen14Private::_end__dynamic_friction, &ColladaParserAutoGen14Private::_preBegin__dynamic_friction, &ColladaParserAutoGen14Private::_preEnd__dynamic_friction, &ColladaParserAutoGen14Private::_freeAttributes__dynamic_friction);
-functionMap[HASH_ELEMENT_RESTITUTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__restitution, &ColladaParserAutoGen14Private::_data__restitution, &ColladaParserAutoGen14Private::_end__restitution, &ColladaParserAutoGen14Private::_preBegin__restitution, &ColladaParserAutoGen14Private::_preEnd__restitution, &ColladaParserAutoGen14Private::_freeAttributes__restitution);
-functionMap[HASH_ELEMENT_STATIC_FRICTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__static_friction, &ColladaParserAutoGen14Private::_data__static_friction, &ColladaParserAutoGen14Private::_end__static_friction, &ColladaParserAutoGen14Private::_preBegin__static_friction, &ColladaParserAutoGen14Private::_preEnd__static_friction, &ColladaParserAutoGen14Private::_freeAttributes__static_friction);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_PHYSICS_MATERIALS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_PHYSICS_MATERIAL,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_PHYSICS_MATERIAL__TECHNIQUE_COMMON,
+HASH_ELEMENT_DYNAMIC_FRICTION,
+HASH_ELEMENT_RESTITUTION,
+HASH_ELEMENT_STATIC_FRICTION,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_physics_models__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_MODELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_models, &ColladaParserAutoGen14Private::_data__library_physics_models, &ColladaParserAutoGen14Private::_end__library_physics_models, &ColladaParserAutoGen14Private::_preBegin__library_physics_models, &ColladaParserAutoGen14Private::_preEnd__library_physics_models, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_models);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_PHYSICS_MODEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_model, &ColladaParserAutoGen14Private::_data__physics_model, &ColladaParserAutoGen14Private::_end__physics_model, &ColladaParserAutoGen14Private::_preBegin__physics_model, &ColladaParserAutoGen14Private::_preEnd__physics_model, &ColladaParserAutoGen14Private::_freeAttributes__physics_model);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_MODEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_model, &ColladaParserAutoGen14Private::_data__instance_physics_model, &ColladaParserAutoGen14Private::_end__instance_physics_model, &ColladaParserAutoGen14Private::_preBegin__instance_physics_model, &ColladaParserAutoGen14Private::_preEnd__instance_physics_model, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_model);
-functionMap[HASH_ELEMENT_RIGID_BODY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_body, &ColladaParserAutoGen14Private::_data__rigid_body, &ColladaParserAutoGen14Private::_end__rigid_body, &ColladaParserAutoGen14Private::_preBegin__rigid_body, &ColladaParserAutoGen14Private::_preEnd__rigid_body, &ColladaParserAutoGen14Private::_freeAttributes__rigid_body);
-functionMap[HASH_ELEMENT_RIGID_CONSTRAINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_constraint, &ColladaParserAutoGen14Private::_data__rigid_constraint, &ColladaParserAutoGen14Private::_end__rigid_constraint, &ColladaParserAutoGen14Private::_preBegin__rigid_constraint, &ColladaParserAutoGen14Private::_preEnd__rigid_constraint, &ColladaParserAutoGen14Private::_freeAttributes__rigid_constraint);
-functionMap[HASH_ELEMENT_INSTANCE_FORCE_FIELD] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_force_field, &ColladaParserAutoGen14Private::_data__instance_force_field, &ColladaParserAutoGen14Private::_end__instance_force_field, &ColladaParserAutoGen14Private::_preBegin__instance_force_field, &ColladaParserAutoGen14Private::_preEnd__instance_force_field, &ColladaParserAutoGen14Private::_freeAttributes__instance_force_field);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body, &ColladaParserAutoGen14Private::_data__instance_rigid_body, &ColladaParserAutoGen14Private::_end__instance_rigid_body, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_CONSTRAINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_constraint, &ColladaParserAutoGen14Private::_data__instance_rigid_constraint, &ColladaParserAutoGen14Private::_end__instance_rigid_constraint, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_constraint, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_constraint, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_constraint);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common);
-functionMap[HASH_ELEMENT_ANGULAR_VELOCITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__angular_velocity, &ColladaParserAutoGen14Private::_data__angular_velocity, &ColladaParserAutoGen14Private::_end__angular_velocity, &ColladaParserAutoGen14Private::_preBegin__angular_velocity, &ColladaParserAutoGen14Private::_preEnd__angular_velocity, &ColladaParserAutoGen14Private::_freeAttributes__angular_velocity);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__DYNAMIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__dynamic);
-functionMap[HASH_ELEMENT_INERTIA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__inertia, &ColladaParserAutoGen14Private::_data__inertia, &ColladaParserAutoGen14Private::_end__inertia, &ColladaParserAutoGen14Private::_preBegin__inertia, &ColladaParserAutoGen14Private::_preEnd__inertia, &ColladaParserAutoGen14Private::_freeAttributes__inertia);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_material, &ColladaParserAutoGen14Private::_data__instance_physics_material, &ColladaParserAutoGen14Private::_end__instance_physics_material, &ColladaParserAutoGen14Private::_preBegin__instance_physics_material, &ColladaParserAutoGen14Private::_preEnd__instance_physics_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_material);
-functionMap[HASH_ELEMENT_MASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mass, &ColladaParserAutoGen14Private::_data__mass, &ColladaParserAutoGen14Private::_end__mass, &ColladaParserAutoGen14Private::_preBegin__mass, &ColladaParserAutoGen14Private::_preEnd__mass, &ColladaParserAutoGen14Private::_freeAttributes__mass);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__MASS_FRAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__mass_frame);
-functionMap[HASH_ELEMENT_PHYSICS_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_material, &ColladaParserAutoGen14Private::_data__physics_material, &ColladaParserAutoGen14Private::_end__physics_material, &ColladaParserAutoGen14Private::_preBegin__physics_material, &ColladaParserAutoGen14Private::_preEnd__physics_material, &ColladaParserAutoGen14Private::_freeAttributes__physics_material);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__shape);
-functionMap[HASH_ELEMENT_VELOCITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__velocity, &ColladaParserAutoGen14Private::_data__velocity, &ColladaParserAutoGen14Private::_end__velocity, &ColladaParserAutoGen14Private::_preBegin__velocity, &ColladaParserAutoGen14Private::_preEnd__velocity, &ColladaParserAutoGen14Private::_freeAttributes__velocity);
-functionMap[HASH_ELEMENT_ROTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rotate, &ColladaParserAutoGen14Private::_data__rotate, &ColladaParserAutoGen14Private::_end__rotate, &ColladaParserAutoGen14Private::_preBegin__rotate, &ColladaParserAutoGen14Private::_preEnd__rotate, &ColladaParserAutoGen14Private::_freeAttributes__rotate);
-functionMap[HASH_ELEMENT_TRANSLATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__translate, &ColladaParserAutoGen14Private::_data__translate, &ColladaParserAutoGen14Private::_end__translate, &ColladaParserAutoGen14Private::_preBegin__translate, &ColladaParserAutoGen14Private::_preEnd__translate, &ColladaParserAutoGen14Private::_freeAttributes__translate);
-functionMap[HASH_ELEMENT_PHYSICS_MATERIAL__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_material__technique_common, &ColladaParserAutoGen14Private::_data__physics_material__technique_common, &ColladaParserAutoGen14Private::_end__physics_material__technique_common, &ColladaParserAutoGen14Private::_preBegin__physics_material__technique_common, &ColladaParserAutoGen14Private::_preEnd__physics_material__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__physics_material__technique_common);
-functionMap[HASH_ELEMENT_DYNAMIC_FRICTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__dynamic_friction, &ColladaParserAutoGen14Private::_data__dynamic_friction, &ColladaParserAutoGen14Private::_end__dynamic_friction, &ColladaParserAutoGen14Private::_preBegin__dynamic_friction, &ColladaParserAutoGen14Private::_preEnd__dynamic_friction, &ColladaParserAutoGen14Private::_freeAttributes__dynamic_friction);
-functionMap[HASH_ELEMENT_RESTITUTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__restitution, &ColladaParserAutoGen14Private::_data__restitution, &ColladaParserAutoGen14Private::_end__restitution, &ColladaParserAutoGen14Private::_preBegin__restitution, &ColladaParserAutoGen14Private::_preEnd__restitution, &ColladaParserAutoGen14Private::_freeAttributes__restitution);
-functionMap[HASH_ELEMENT_STATIC_FRICTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__static_friction, &ColladaParserAutoGen14Private::_data__static_friction, &ColladaParserAutoGen14Private::_end__static_friction, &ColladaParserAutoGen14Private::_preBegin__static_friction, &ColladaParserAutoGen14Private::_preEnd__static_friction, &ColladaParserAutoGen14Private::_freeAttributes__static_friction);
-functionMap[HASH_ELEMENT_BOX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__box, &ColladaParserAutoGen14Private::_data__box, &ColladaParserAutoGen14Private::_end__box, &ColladaParserAutoGen14Private::_preBegin__box, &ColladaParserAutoGen14Private::_preEnd__box, &ColladaParserAutoGen14Private::_freeAttributes__box);
-functionMap[HASH_ELEMENT_CAPSULE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__capsule, &ColladaParserAutoGen14Private::_data__capsule, &ColladaParserAutoGen14Private::_end__capsule, &ColladaParserAutoGen14Private::_preBegin__capsule, &ColladaParserAutoGen14Private::_preEnd__capsule, &ColladaParserAutoGen14Private::_freeAttributes__capsule);
-functionMap[HASH_ELEMENT_CYLINDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__cylinder, &ColladaParserAutoGen14Private::_data__cylinder, &ColladaParserAutoGen14Private::_end__cylinder, &ColladaParserAutoGen14Private::_preBegin__cylinder, &ColladaParserAutoGen14Private::_preEnd__cylinder, &ColladaParserAutoGen14Private::_freeAttributes__cylinder);
-functionMap[HASH_ELEMENT_DENSITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__density, &ColladaParserAutoGen14Private::_data__density, &ColladaParserAutoGen14Private::_end__density, &ColladaParserAutoGen14Private::_preBegin__density, &ColladaParserAutoGen14Private::_preEnd__density, &ColladaParserAutoGen14Private::_freeAttributes__density);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE__HOLLOW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__shape__hollow);
-functionMap[HASH_ELEMENT_INSTANCE_GEOMETRY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_geometry, &ColladaParserAutoGen14Private::_data__instance_geometry, &ColladaParserAutoGen14Private::_end__instance_geometry, &ColladaParserAutoGen14Private::_preBegin__instance_geometry, &ColladaParserAutoGen14Private::_preEnd__instance_geometry, &ColladaParserAutoGen14Private::_freeAttributes__instance_geometry);
-functionMap[HASH_ELEMENT_MASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mass, &ColladaParserAutoGen14Private::_data__mass, &ColladaParserAutoGen14Private::_end__mass, &ColladaParserAutoGen14Private::_preBegin__mass, &ColladaParserAutoGen14Private::_preEnd__mass, &ColladaParserAutoGen14Private::_freeAttributes__mass);
-functionMap[HASH_ELEMENT_PLANE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__plane, &ColladaParserAutoGen14Private::_data__plane, &ColladaParserAutoGen14Private::_end__plane, &ColladaParserAutoGen14Private::_preBegin__plane, &ColladaParserAutoGen14Private::_preEnd__plane, &ColladaParserAutoGen14Private::_freeAttributes__plane);
-functionMap[HASH_ELEMENT_SPHERE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sphere, &ColladaParserAutoGen14Private::_data__sphere, &ColladaParserAutoGen14Private::_end__sphere, &ColladaParserAutoGen14Private::_preBegin__sphere, &ColladaParserAutoGen14Private::_preEnd__sphere, &ColladaParserAutoGen14Private::_freeAttributes__sphere);
-functionMap[HASH_ELEMENT_TAPERED_CAPSULE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tapered_capsule, &ColladaParserAutoGen14Private::_data__tapered_capsule, &ColladaParserAutoGen14Private::_end__tapered_capsule, &ColladaParserAutoGen14Private::_preBegin__tapered_capsule, &ColladaParserAutoGen14Private::_preEnd__tapered_capsule, &ColladaParserAutoGen14Private::_freeAttributes__tapered_capsule);
-functionMap[HASH_ELEMENT_TAPERED_CYLINDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tapered_cylinder, &ColladaParserAutoGen14Private::_data__tapered_cylinder, &ColladaParserAutoGen14Private::_end__tapered_cylinder, &ColladaParserAutoGen14Private::_preBegin__tapered_cylinder, &ColladaParserAutoGen14Private::_preEnd__tapered_cylinder, &ColladaParserAutoGen14Private::_freeAttributes__tapered_cylinder);
-functionMap[HASH_ELEMENT_HALF_EXTENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half_extents, &ColladaParserAutoGen14Private::_data__half_extents, &ColladaParserAutoGen14Private::_end__half_extents, &ColladaParserAutoGen14Private::_preBegin__half_extents, &ColladaParserAutoGen14Private::_preEnd__half_extents, &ColladaParserAutoGen14Private::_freeAttributes__half_extents);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius____float2, &ColladaParserAutoGen14Private::_data__radius____float2, &ColladaParserAutoGen14Private::_end__radius____float2, &ColladaParserAutoGen14Private::_preBegin__radius____float2, &ColladaParserAutoGen14Private::_preEnd__radius____float2, &ColladaParserAutoGen14Private::_freeAttributes__radius____float2);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius____float2, &ColladaParserAutoGen14Private::_data__radius____float2, &ColladaParserAutoGen14Private::_end__radius____float2, &ColladaParserAutoGen14Private::_preBegin__radius____float2, &ColladaParserAutoGen14Private::_preEnd__radius____float2, &ColladaParserAutoGen14Private::_freeAttributes__radius____float2);
-functionMap[HASH_ELEMENT_BIND_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material, &ColladaParserAutoGen14Private::_data__bind_material, &ColladaParserAutoGen14Private::_end__bind_material, &ColladaParserAutoGen14Private::_preBegin__bind_material, &ColladaParserAutoGen14Private::_preEnd__bind_material, &ColladaParserAutoGen14Private::_freeAttributes__bind_material);
-functionMap[HASH_ELEMENT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param, &ColladaParserAutoGen14Private::_data__param, &ColladaParserAutoGen14Private::_end__param, &ColladaParserAutoGen14Private::_preBegin__param, &ColladaParserAutoGen14Private::_preEnd__param, &ColladaParserAutoGen14Private::_freeAttributes__param);
-functionMap[HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material__technique_common, &ColladaParserAutoGen14Private::_data__bind_material__technique_common, &ColladaParserAutoGen14Private::_end__bind_material__technique_common, &ColladaParserAutoGen14Private::_preBegin__bind_material__technique_common, &ColladaParserAutoGen14Private::_preEnd__bind_material__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__bind_material__technique_common);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material, &ColladaParserAutoGen14Private::_data__instance_material, &ColladaParserAutoGen14Private::_end__instance_material, &ColladaParserAutoGen14Private::_preBegin__instance_material, &ColladaParserAutoGen14Private::_preEnd__instance_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_material);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL__BIND] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material__bind, &ColladaParserAutoGen14Private::_data__instance_material__bind, &ColladaParserAutoGen14Private::_end__instance_material__bind, &ColladaParserAutoGen14Private::_preBegin__instance_material__bind, &ColladaParserAutoGen14Private::_preEnd__instance_material__bind, &ColladaParserAutoGen14Private::_freeAttributes__instance_material__bind);
-functionMap[HASH_ELEMENT_BIND_VERTEX_INPUT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_vertex_input, &ColladaParserAutoGen14Private::_data__bind_vertex_input, &ColladaParserAutoGen14Private::_end__bind_vertex_input, &ColladaParserAutoGen14Private::_preBegin__bind_vertex_input, &ColladaParserAutoGen14Private::_preEnd__bind_vertex_input, &ColladaParserAutoGen14Private::_freeAttributes__bind_vertex_input);
-functionMap[HASH_ELEMENT_EQUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__equation, &ColladaParserAutoGen14Private::_data__equation, &ColladaParserAutoGen14Private::_end__equation, &ColladaParserAutoGen14Private::_preBegin__equation, &ColladaParserAutoGen14Private::_preEnd__equation, &ColladaParserAutoGen14Private::_freeAttributes__equation);
-functionMap[HASH_ELEMENT_RADIUS____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius____float, &ColladaParserAutoGen14Private::_data__radius____float, &ColladaParserAutoGen14Private::_end__radius____float, &ColladaParserAutoGen14Private::_preBegin__radius____float, &ColladaParserAutoGen14Private::_preEnd__radius____float, &ColladaParserAutoGen14Private::_freeAttributes__radius____float);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius1, &ColladaParserAutoGen14Private::_data__radius1, &ColladaParserAutoGen14Private::_end__radius1, &ColladaParserAutoGen14Private::_preBegin__radius1, &ColladaParserAutoGen14Private::_preEnd__radius1, &ColladaParserAutoGen14Private::_freeAttributes__radius1);
-functionMap[HASH_ELEMENT_RADIUS2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius2, &ColladaParserAutoGen14Private::_data__radius2, &ColladaParserAutoGen14Private::_end__radius2, &ColladaParserAutoGen14Private::_preBegin__radius2, &ColladaParserAutoGen14Private::_preEnd__radius2, &ColladaParserAutoGen14Private::_freeAttributes__radius2);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius1, &ColladaParserAutoGen14Private::_data__radius1, &ColladaParserAutoGen14Private::_end__radius1, &ColladaParserAutoGen14Private::_preBegin__radius1, &ColladaParserAutoGen14Private::_preEnd__radius1, &ColladaParserAutoGen14Private::_freeAttributes__radius1);
-functionMap[HASH_ELEMENT_RADIUS2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius2, &ColladaParserAutoGen14Private::_data__radius2, &ColladaParserAutoGen14Private::_end__radius2, &ColladaParserAutoGen14Private::_preBegin__radius2, &ColladaParserAutoGen14Private::_preEnd__radius2, &ColladaParserAutoGen14Private::_freeAttributes__radius2);
-functionMap[HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_body__technique_common, &ColladaParserAutoGen14Private::_data__rigid_body__technique_common, &ColladaParserAutoGen14Private::_end__rigid_body__technique_common, &ColladaParserAutoGen14Private::_preBegin__rigid_body__technique_common, &ColladaParserAutoGen14Private::_preEnd__rigid_body__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__rigid_body__technique_common);
-functionMap[HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__DYNAMIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_data__rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_end__rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_preBegin__rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_preEnd__rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_freeAttributes__rigid_body__technique_common__dynamic);
-functionMap[HASH_ELEMENT_INERTIA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__inertia, &ColladaParserAutoGen14Private::_data__inertia, &ColladaParserAutoGen14Private::_end__inertia, &ColladaParserAutoGen14Private::_preBegin__inertia, &ColladaParserAutoGen14Private::_preEnd__inertia, &ColladaParserAutoGen14Private::_freeAttributes__inertia);
-functionMap[HASH_ELEMENT_MASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mass, &ColladaParserAutoGen14Private::_data__mass, &ColladaParserAutoGen14Private::_end__mass, &ColladaParserAutoGen14Private::_preBegin__mass, &ColladaParserAutoGen14Private::_preEnd__mass, &ColladaParserAutoGen14Private::_freeAttributes__mass);
-functionMap[HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__MASS_FRAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_data__rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_end__rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_preBegin__rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_preEnd__rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_freeAttributes__rigid_body__technique_common__mass_frame);
-functionMap[HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__SHAPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_data__rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_end__rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preBegin__rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preEnd__rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_freeAttributes__rigid_body__technique_common__shape);
-functionMap[HASH_ELEMENT_DENSITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__density, &ColladaParserAutoGen14Private::_data__density, &ColladaParserAutoGen14Private::_end__density, &ColladaParserAutoGen14Private::_preBegin__density, &ColladaParserAutoGen14Private::_preEnd__density, &ColladaParserAutoGen14Private::_freeAttributes__density);
-functionMap[HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__SHAPE__HOLLOW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_data__rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_end__rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_preBegin__rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_preEnd__rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_freeAttributes__rigid_body__technique_common__shape__hollow);
-functionMap[HASH_ELEMENT_MASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mass, &ColladaParserAutoGen14Private::_data__mass, &ColladaParserAutoGen14Private::_end__mass, &ColladaParserAutoGen14Private::_preBegin__mass, &ColladaParserAutoGen14Private::_preEnd__mass, &ColladaParserAutoGen14Private::_freeAttributes__mass);
-functionMap[HASH_ELEMENT_ATTACHMENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__attachment, &ColladaParserAutoGen14Private::_data__attachment, &ColladaParserAutoGen14Private::_end__attachment, &ColladaParserAutoGen14Private::_preBegin__attachment, &ColladaParserAutoGen14Private::_preEnd__attachment, &ColladaParserAutoGen14Private::_freeAttributes__attachment);
-functionMap[HASH_ELEMENT_REF_ATTACHMENT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__ref_attachment, &ColladaParserAutoGen14Private::_data__ref_attachment, &ColladaParserAutoGen14Private::_end__ref_attachment, &ColladaParserAutoGen14Private::_preBegin__ref_attachment, &ColladaParserAutoGen14Private::_preEnd__ref_attachment, &ColladaParserAutoGen14Private::_freeAttributes__ref_attachment);
-functionMap[HASH_ELEMENT_RIGID_CONSTRAINT__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rigid_constraint__technique_common, &ColladaParserAutoGen14Private::_data__rigid_constraint__technique_common, &ColladaParserAutoGen14Private::_end__rigid_constraint__technique_common, &ColladaParserAutoGen14Private::_preBegin__rigid_constraint__technique_common, &ColladaParserAutoGen14Private::_preEnd__rigid_constraint__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__rigid_constraint__technique_common);
-functionMap[HASH_ELEMENT_ENABLED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enabled, &ColladaParserAutoGen14Private::_data__enabled, &ColladaParserAutoGen14Private::_end__enabled, &ColladaParserAutoGen14Private::_preBegin__enabled, &ColladaParserAutoGen14Private::_preEnd__enabled, &ColladaParserAutoGen14Private::_freeAttributes__enabled);
-functionMap[HASH_ELEMENT_INTERPENETRATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__interpenetrate, &ColladaParserAutoGen14Private::_data__interpenetrate, &ColladaParserAutoGen14Private::_end__interpenetrate, &ColladaParserAutoGen14Private::_preBegin__interpenetrate, &ColladaParserAutoGen14Private::_preEnd__interpenetrate, &ColladaParserAutoGen14Private::_freeAttributes__interpenetrate);
-functionMap[HASH_ELEMENT_LIMITS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__limits, &ColladaParserAutoGen14Private::_data__limits, &ColladaParserAutoGen14Private::_end__limits, &ColladaParserAutoGen14Private::_preBegin__limits, &ColladaParserAutoGen14Private::_preEnd__limits, &ColladaParserAutoGen14Private::_freeAttributes__limits);
-functionMap[HASH_ELEMENT_SPRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__spring, &ColladaParserAutoGen14Private::_data__spring, &ColladaParserAutoGen14Private::_end__spring, &ColladaParserAutoGen14Private::_preBegin__spring, &ColladaParserAutoGen14Private::_preEnd__spring, &ColladaParserAutoGen14Private::_freeAttributes__spring);
-functionMap[HASH_ELEMENT_LIMITS__LINEAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__limits__linear, &ColladaParserAutoGen14Private::_data__limits__linear, &ColladaParserAutoGen14Private::_end__limits__linear, &ColladaParserAutoGen14Private::_preBegin__limits__linear, &ColladaParserAutoGen14Private::_preEnd__limits__linear, &ColladaParserAutoGen14Private::_freeAttributes__limits__linear);
-functionMap[HASH_ELEMENT_SWING_CONE_AND_TWIST] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__swing_cone_and_twist, &ColladaParserAutoGen14Private::_data__swing_cone_and_twist, &ColladaParserAutoGen14Private::_end__swing_cone_and_twist, &ColladaParserAutoGen14Private::_preBegin__swing_cone_and_twist, &ColladaParserAutoGen14Private::_preEnd__swing_cone_and_twist, &ColladaParserAutoGen14Private::_freeAttributes__swing_cone_and_twist);
-functionMap[HASH_ELEMENT_MAX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__max, &ColladaParserAutoGen14Private::_data__max, &ColladaParserAutoGen14Private::_end__max, &ColladaParserAutoGen14Private::_preBegin__max, &ColladaParserAutoGen14Private::_preEnd__max, &ColladaParserAutoGen14Private::_freeAttributes__max);
-functionMap[HASH_ELEMENT_MIN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__min, &ColladaParserAutoGen14Private::_data__min, &ColladaParserAutoGen14Private::_end__min, &ColladaParserAutoGen14Private::_preBegin__min, &ColladaParserAutoGen14Private::_preEnd__min, &ColladaParserAutoGen14Private::_freeAttributes__min);
-functionMap[HASH_ELEMENT_MAX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__max, &ColladaParserAutoGen14Private::_data__max, &ColladaParserAutoGen14Private::_end__max, &ColladaParserAutoGen14Private::_preBegin__max, &ColladaParserAutoGen14Private::_preEnd__max, &ColladaParserAutoGen14Private::_freeAttributes__max);
-functionMap[HASH_ELEMENT_MIN] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__min, &ColladaParserAutoGen14Private::_data__min, &ColladaParserAutoGen14Private::_end__min, &ColladaParserAutoGen14Private::_preBegin__min, &ColladaParserAutoGen14Private::_preEnd__min, &ColladaParserAutoGen14Private::_freeAttributes__min);
-functionMap[HASH_ELEMENT_ANGULAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__angular, &ColladaParserAutoGen14Private::_data__angular, &ColladaParserAutoGen14Private::_end__angular, &ColladaParserAutoGen14Private::_preBegin__angular, &ColladaParserAutoGen14Private::_preEnd__angular, &ColladaParserAutoGen14Private::_freeAttributes__angular);
-functionMap[HASH_ELEMENT_SPRING__LINEAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__spring__linear, &ColladaParserAutoGen14Private::_data__spring__linear, &ColladaParserAutoGen14Private::_end__spring__linear, &ColladaParserAutoGen14Private::_preBegin__spring__linear, &ColladaParserAutoGen14Private::_preEnd__spring__linear, &ColladaParserAutoGen14Private::_freeAttributes__spring__linear);
-functionMap[HASH_ELEMENT_DAMPING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__damping, &ColladaParserAutoGen14Private::_data__damping, &ColladaParserAutoGen14Private::_end__damping, &ColladaParserAutoGen14Private::_preBegin__damping, &ColladaParserAutoGen14Private::_preEnd__damping, &ColladaParserAutoGen14Private::_freeAttributes__damping);
-functionMap[HASH_ELEMENT_STIFFNESS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stiffness, &ColladaParserAutoGen14Private::_data__stiffness, &ColladaParserAutoGen14Private::_end__stiffness, &ColladaParserAutoGen14Private::_preBegin__stiffness, &ColladaParserAutoGen14Private::_preEnd__stiffness, &ColladaParserAutoGen14Private::_freeAttributes__stiffness);
-functionMap[HASH_ELEMENT_TARGET_VALUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__target_value, &ColladaParserAutoGen14Private::_data__target_value, &ColladaParserAutoGen14Private::_end__target_value, &ColladaParserAutoGen14Private::_preBegin__target_value, &ColladaParserAutoGen14Private::_preEnd__target_value, &ColladaParserAutoGen14Private::_freeAttributes__target_value);
-functionMap[HASH_ELEMENT_DAMPING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__damping, &ColladaParserAutoGen14Private::_data__damping, &ColladaParserAutoGen14Private::_end__damping, &ColladaParserAutoGen14Private::_preBegin__damping, &ColladaParserAutoGen14Private::_preEnd__damping, &ColladaParserAutoGen14Private::_freeAttributes__damping);
-functionMap[HASH_ELEMENT_STIFFNESS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__stiffness, &ColladaParserAutoGen14Private::_data__stiffness, &ColladaParserAutoGen14Private::_end__stiffness, &ColladaParserAutoGen14Private::_preBegin__stiffness, &ColladaParserAutoGen14Private::_preEnd__stiffness, &ColladaParserAutoGen14Private::_freeAttributes__stiffness);
-functionMap[HASH_ELEMENT_TARGET_VALUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__target_value, &ColladaParserAutoGen14Private::_data__target_value, &ColladaParserAutoGen14Private::_end__target_value, &ColladaParserAutoGen14Private::_preBegin__target_value, &ColladaParserAutoGen14Private::_preEnd__target_value, &ColladaParserAutoGen14Private::_freeAttributes__target_value);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_PHYSICS_MODELS,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_PHYSICS_MODEL,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_INSTANCE_PHYSICS_MODEL,
+HASH_ELEMENT_RIGID_BODY,
+HASH_ELEMENT_RIGID_CONSTRAINT,
+HASH_ELEMENT_INSTANCE_FORCE_FIELD,
+HASH_ELEMENT_INSTANCE_RIGID_BODY,
+HASH_ELEMENT_INSTANCE_RIGID_CONSTRAINT,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON,
+HASH_ELEMENT_ANGULAR_VELOCITY,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__DYNAMIC,
+HASH_ELEMENT_INERTIA,
+HASH_ELEMENT_INSTANCE_PHYSICS_MATERIAL,
+HASH_ELEMENT_MASS,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__MASS_FRAME,
+HASH_ELEMENT_PHYSICS_MATERIAL,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE,
+HASH_ELEMENT_VELOCITY,
+HASH_ELEMENT_ROTATE,
+HASH_ELEMENT_TRANSLATE,
+HASH_ELEMENT_PHYSICS_MATERIAL__TECHNIQUE_COMMON,
+HASH_ELEMENT_DYNAMIC_FRICTION,
+HASH_ELEMENT_RESTITUTION,
+HASH_ELEMENT_STATIC_FRICTION,
+HASH_ELEMENT_BOX,
+HASH_ELEMENT_CAPSULE,
+HASH_ELEMENT_CYLINDER,
+HASH_ELEMENT_DENSITY,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE__HOLLOW,
+HASH_ELEMENT_INSTANCE_GEOMETRY,
+HASH_ELEMENT_MASS,
+HASH_ELEMENT_PLANE,
+HASH_ELEMENT_SPHERE,
+HASH_ELEMENT_TAPERED_CAPSULE,
+HASH_ELEMENT_TAPERED_CYLINDER,
+HASH_ELEMENT_HALF_EXTENTS,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS____FLOAT2,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS____FLOAT2,
+HASH_ELEMENT_BIND_MATERIAL,
+HASH_ELEMENT_PARAM,
+HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON,
+HASH_ELEMENT_INSTANCE_MATERIAL,
+HASH_ELEMENT_INSTANCE_MATERIAL__BIND,
+HASH_ELEMENT_BIND_VERTEX_INPUT,
+HASH_ELEMENT_EQUATION,
+HASH_ELEMENT_RADIUS____FLOAT,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS1,
+HASH_ELEMENT_RADIUS2,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS1,
+HASH_ELEMENT_RADIUS2,
+HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON,
+HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__DYNAMIC,
+HASH_ELEMENT_INERTIA,
+HASH_ELEMENT_MASS,
+HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__MASS_FRAME,
+HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__SHAPE,
+HASH_ELEMENT_DENSITY,
+HASH_ELEMENT_RIGID_BODY__TECHNIQUE_COMMON__SHAPE__HOLLOW,
+HASH_ELEMENT_MASS,
+HASH_ELEMENT_ATTACHMENT,
+HASH_ELEMENT_REF_ATTACHMENT,
+HASH_ELEMENT_RIGID_CONSTRAINT__TECHNIQUE_COMMON,
+HASH_ELEMENT_ENABLED,
+HASH_ELEMENT_INTERPENETRATE,
+HASH_ELEMENT_LIMITS,
+HASH_ELEMENT_SPRING,
+HASH_ELEMENT_LIMITS__LINEAR,
+HASH_ELEMENT_SWING_CONE_AND_TWIST,
+HASH_ELEMENT_MAX,
+HASH_ELEMENT_MIN,
+HASH_ELEMENT_MAX,
+HASH_ELEMENT_MIN,
+HASH_ELEMENT_ANGULAR,
+HASH_ELEMENT_SPRING__LINEAR,
+HASH_ELEMENT_DAMPING,
+HASH_ELEMENT_STIFFNESS,
+HASH_ELEMENT_TARGET_VALUE,
+HASH_ELEMENT_DAMPING,
+HASH_ELEMENT_STIFFNESS,
+HASH_ELEMENT_TARGET_VALUE,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_physics_scenes__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_PHYSICS_SCENES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_physics_scenes, &ColladaParserAutoGen14Private::_data__library_physics_scenes, &ColladaParserAutoGen14Private::_end__library_physics_scenes, &ColladaParserAutoGen14Private::_preBegin__library_physics_scenes, &ColladaParserAutoGen14Private::_preEnd__library_physics_scenes, &ColladaParserAutoGen14Private::_freeAttributes__library_physics_scenes);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_PHYSICS_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_scene, &ColladaParserAutoGen14Private::_data__physics_scene, &ColladaParserAutoGen14Private::_end__physics_scene, &ColladaParserAutoGen14Private::_preBegin__physics_scene, &ColladaParserAutoGen14Private::_preEnd__physics_scene, &ColladaParserAutoGen14Private::_freeAttributes__physics_scene);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_INSTANCE_FORCE_FIELD] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_force_field, &ColladaParserAutoGen14Private::_data__instance_force_field, &ColladaParserAutoGen14Private::_end__instance_force_field, &ColladaParserAutoGen14Private::_preBegin__instance_force_field, &ColladaParserAutoGen14Private::_preEnd__instance_force_field, &ColladaParserAutoGen14Private::_freeAttributes__instance_force_field);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_MODEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_model, &ColladaParserAutoGen14Private::_data__instance_physics_model, &ColladaParserAutoGen14Private::_end__instance_physics_model, &ColladaParserAutoGen14Private::_preBegin__instance_physics_model, &ColladaParserAutoGen14Private::_preEnd__instance_physics_model, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_model);
-functionMap[HASH_ELEMENT_PHYSICS_SCENE__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_scene__technique_common, &ColladaParserAutoGen14Private::_data__physics_scene__technique_common, &ColladaParserAutoGen14Private::_end__physics_scene__technique_common, &ColladaParserAutoGen14Private::_preBegin__physics_scene__technique_common, &ColladaParserAutoGen14Private::_preEnd__physics_scene__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__physics_scene__technique_common);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body, &ColladaParserAutoGen14Private::_data__instance_rigid_body, &ColladaParserAutoGen14Private::_end__instance_rigid_body, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_CONSTRAINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_constraint, &ColladaParserAutoGen14Private::_data__instance_rigid_constraint, &ColladaParserAutoGen14Private::_end__instance_rigid_constraint, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_constraint, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_constraint, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_constraint);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common);
-functionMap[HASH_ELEMENT_ANGULAR_VELOCITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__angular_velocity, &ColladaParserAutoGen14Private::_data__angular_velocity, &ColladaParserAutoGen14Private::_end__angular_velocity, &ColladaParserAutoGen14Private::_preBegin__angular_velocity, &ColladaParserAutoGen14Private::_preEnd__angular_velocity, &ColladaParserAutoGen14Private::_freeAttributes__angular_velocity);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__DYNAMIC] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__dynamic, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__dynamic);
-functionMap[HASH_ELEMENT_INERTIA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__inertia, &ColladaParserAutoGen14Private::_data__inertia, &ColladaParserAutoGen14Private::_end__inertia, &ColladaParserAutoGen14Private::_preBegin__inertia, &ColladaParserAutoGen14Private::_preEnd__inertia, &ColladaParserAutoGen14Private::_freeAttributes__inertia);
-functionMap[HASH_ELEMENT_INSTANCE_PHYSICS_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_physics_material, &ColladaParserAutoGen14Private::_data__instance_physics_material, &ColladaParserAutoGen14Private::_end__instance_physics_material, &ColladaParserAutoGen14Private::_preBegin__instance_physics_material, &ColladaParserAutoGen14Private::_preEnd__instance_physics_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_physics_material);
-functionMap[HASH_ELEMENT_MASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mass, &ColladaParserAutoGen14Private::_data__mass, &ColladaParserAutoGen14Private::_end__mass, &ColladaParserAutoGen14Private::_preBegin__mass, &ColladaParserAutoGen14Private::_preEnd__mass, &ColladaParserAutoGen14Private::_freeAttributes__mass);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__MASS_FRAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__mass_frame, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__mass_frame);
-functionMap[HASH_ELEMENT_PHYSICS_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_material, &ColladaParserAutoGen14Private::_data__physics_material, &ColladaParserAutoGen14Private::_end__physics_material, &ColladaParserAutoGen14Private::_preBegin__physics_material, &ColladaParserAutoGen14Private::_preEnd__physics_material, &ColladaParserAutoGen14Private::_freeAttributes__physics_material);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__shape, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__shape);
-functionMap[HASH_ELEMENT_VELOCITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__velocity, &ColladaParserAutoGen14Private::_data__velocity, &ColladaParserAutoGen14Private::_end__velocity, &ColladaParserAutoGen14Private::_preBegin__velocity, &ColladaParserAutoGen14Private::_preEnd__velocity, &ColladaParserAutoGen14Private::_freeAttributes__velocity);
-functionMap[HASH_ELEMENT_ROTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rotate, &ColladaParserAutoGen14Private::_data__rotate, &ColladaParserAutoGen14Private::_end__rotate, &ColladaParserAutoGen14Private::_preBegin__rotate, &ColladaParserAutoGen14Private::_preEnd__rotate, &ColladaParserAutoGen14Private::_freeAttributes__rotate);
-functionMap[HASH_ELEMENT_TRANSLATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__translate, &ColladaParserAutoGen14Private::_data__translate, &ColladaParserAutoGen14Private::_end__translate, &ColladaParserAutoGen14Private::_preBegin__translate, &ColladaParserAutoGen14Private::_preEnd__translate, &ColladaParserAutoGen14Private::_freeAttributes__translate);
-functionMap[HASH_ELEMENT_PHYSICS_MATERIAL__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__physics_material__technique_common, &ColladaParserAutoGen14Private::_data__physics_material__technique_common, &ColladaParserAutoGen14Private::_end__physics_material__technique_common, &ColladaParserAutoGen14Private::_preBegin__physics_material__technique_common, &ColladaParserAutoGen14Private::_preEnd__physics_material__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__physics_material__technique_common);
-functionMap[HASH_ELEMENT_DYNAMIC_FRICTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__dynamic_friction, &ColladaParserAutoGen14Private::_data__dynamic_friction, &ColladaParserAutoGen14Private::_end__dynamic_friction, &ColladaParserAutoGen14Private::_preBegin__dynamic_friction, &ColladaParserAutoGen14Private::_preEnd__dynamic_friction, &ColladaParserAutoGen14Private::_freeAttributes__dynamic_friction);
-functionMap[HASH_ELEMENT_RESTITUTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__restitution, &ColladaParserAutoGen14Private::_data__restitution, &ColladaParserAutoGen14Private::_end__restitution, &ColladaParserAutoGen14Private::_preBegin__restitution, &ColladaParserAutoGen14Private::_preEnd__restitution, &ColladaParserAutoGen14Private::_freeAttributes__restitution);
-functionMap[HASH_ELEMENT_STATIC_FRICTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__static_friction, &ColladaParserAutoGen14Private::_data__static_friction, &ColladaParserAutoGen14Private::_end__static_friction, &ColladaParserAutoGen14Private::_preBegin__static_friction, &ColladaParserAutoGen14Private::_preEnd__static_friction, &ColladaParserAutoGen14Private::_freeAttributes__static_friction);
-functionMap[HASH_ELEMENT_BOX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__box, &ColladaParserAutoGen14Private::_data__box, &ColladaParserAutoGen14Private::_end__box, &ColladaParserAutoGen14Private::_preBegin__box, &ColladaParserAutoGen14Private::_preEnd__box, &ColladaParserAutoGen14Private::_freeAttributes__box);
-functionMap[HASH_ELEMENT_CAPSULE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__capsule, &ColladaParserAutoGen14Private::_data__capsule, &ColladaParserAutoGen14Private::_end__capsule, &ColladaParserAutoGen14Private::_preBegin__capsule, &ColladaParserAutoGen14Private::_preEnd__capsule, &ColladaParserAutoGen14Private::_freeAttributes__capsule);
-functionMap[HASH_ELEMENT_CYLINDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__cylinder, &ColladaParserAutoGen14Private::_data__cylinder, &ColladaParserAutoGen14Private::_end__cylinder, &ColladaParserAutoGen14Private::_preBegin__cylinder, &ColladaParserAutoGen14Private::_preEnd__cylinder, &ColladaParserAutoGen14Private::_freeAttributes__cylinder);
-functionMap[HASH_ELEMENT_DENSITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__density, &ColladaParserAutoGen14Private::_data__density, &ColladaParserAutoGen14Private::_end__density, &ColladaParserAutoGen14Private::_preBegin__density, &ColladaParserAutoGen14Private::_preEnd__density, &ColladaParserAutoGen14Private::_freeAttributes__density);
-functionMap[HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE__HOLLOW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_data__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_end__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_preBegin__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_preEnd__instance_rigid_body__technique_common__shape__hollow, &ColladaParserAutoGen14Private::_freeAttributes__instance_rigid_body__technique_common__shape__hollow);
-functionMap[HASH_ELEMENT_INSTANCE_GEOMETRY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_geometry, &ColladaParserAutoGen14Private::_data__instance_geometry, &ColladaParserAutoGen14Private::_end__instance_geometry, &ColladaParserAutoGen14Private::_preBegin__instance_geometry, &ColladaParserAutoGen14Private::_preEnd__instance_geometry, &ColladaParserAutoGen14Private::_freeAttributes__instance_geometry);
-functionMap[HASH_ELEMENT_MASS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mass, &ColladaParserAutoGen14Private::_data__mass, &ColladaParserAutoGen14Private::_end__mass, &ColladaParserAutoGen14Private::_preBegin__mass, &ColladaParserAutoGen14Private::_preEnd__mass, &ColladaParserAutoGen14Private::_freeAttributes__mass);
-functionMap[HASH_ELEMENT_PLANE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__plane, &ColladaParserAutoGen14Private::_data__plane, &ColladaParserAutoGen14Private::_end__plane, &ColladaParserAutoGen14Private::_preBegin__plane, &ColladaParserAutoGen14Private::_preEnd__plane, &ColladaParserAutoGen14Private::_freeAttributes__plane);
-functionMap[HASH_ELEMENT_SPHERE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sphere, &ColladaParserAutoGen14Private::_data__sphere, &ColladaParserAutoGen14Private::_end__sphere, &ColladaParserAutoGen14Private::_preBegin__sphere, &ColladaParserAutoGen14Private::_preEnd__sphere, &ColladaParserAutoGen14Private::_freeAttributes__sphere);
-functionMap[HASH_ELEMENT_TAPERED_CAPSULE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tapered_capsule, &ColladaParserAutoGen14Private::_data__tapered_capsule, &ColladaParserAutoGen14Private::_end__tapered_capsule, &ColladaParserAutoGen14Private::_preBegin__tapered_capsule, &ColladaParserAutoGen14Private::_preEnd__tapered_capsule, &ColladaParserAutoGen14Private::_freeAttributes__tapered_capsule);
-functionMap[HASH_ELEMENT_TAPERED_CYLINDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__tapered_cylinder, &ColladaParserAutoGen14Private::_data__tapered_cylinder, &ColladaParserAutoGen14Private::_end__tapered_cylinder, &ColladaParserAutoGen14Private::_preBegin__tapered_cylinder, &ColladaParserAutoGen14Private::_preEnd__tapered_cylinder, &ColladaParserAutoGen14Private::_freeAttributes__tapered_cylinder);
-functionMap[HASH_ELEMENT_HALF_EXTENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__half_extents, &ColladaParserAutoGen14Private::_data__half_extents, &ColladaParserAutoGen14Private::_end__half_extents, &ColladaParserAutoGen14Private::_preBegin__half_extents, &ColladaParserAutoGen14Private::_preEnd__half_extents, &ColladaParserAutoGen14Private::_freeAttributes__half_extents);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius____float2, &ColladaParserAutoGen14Private::_data__radius____float2, &ColladaParserAutoGen14Private::_end__radius____float2, &ColladaParserAutoGen14Private::_preBegin__radius____float2, &ColladaParserAutoGen14Private::_preEnd__radius____float2, &ColladaParserAutoGen14Private::_freeAttributes__radius____float2);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius____float2, &ColladaParserAutoGen14Private::_data__radius____float2, &ColladaParserAutoGen14Private::_end__radius____float2, &ColladaParserAutoGen14Private::_preBegin__radius____float2, &ColladaParserAutoGen14Private::_preEnd__radius____float2, &ColladaParserAutoGen14Private::_freeAttributes__radius____float2);
-functionMap[HASH_ELEMENT_BIND_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material, &ColladaParserAutoGen14Private::_data__bind_material, &ColladaParserAutoGen14Private::_end__bind_material, &ColladaParserAutoGen14Private::_preBegin__bind_material, &ColladaParserAutoGen14Private::_preEnd__bind_material, &ColladaParserAutoGen14Private::_freeAttributes__bind_material);
-functionMap[HASH_ELEMENT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param, &ColladaParserAutoGen14Private::_data__param, &ColladaParserAutoGen14Private::_end__param, &ColladaParserAutoGen14Private::_preBegin__param, &ColladaParserAutoGen14Private::_preEnd__param, &ColladaParserAutoGen14Private::_freeAttributes__param);
-functionMap[HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material__technique_common, &ColladaParserAutoGen14Private::_data__bind_material__technique_common, &ColladaParserAutoGen14Private::_end__bind_material__technique_common, &ColladaParserAutoGen14Private::_preBegin__bind_material__technique_common, &ColladaParserAutoGen14Private::_preEnd__bind_material__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__bind_material__technique_common);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material, &ColladaParserAutoGen14Private::_data__instance_material, &ColladaParserAutoGen14Private::_end__instance_material, &ColladaParserAutoGen14Private::_preBegin__instance_material, &ColladaParserAutoGen14Private::_preEnd__instance_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_material);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL__BIND] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material__bind, &ColladaParserAutoGen14Private::_data__instance_material__bind, &ColladaParserAutoGen14Private::_end__instance_material__bind, &ColladaParserAutoGen14Private::_preBegin__instance_material__bind, &ColladaParserAutoGen14Private::_preEnd__instance_material__bind, &ColladaParserAutoGen14Private::_freeAttributes__instance_material__bind);
-functionMap[HASH_ELEMENT_BIND_VERTEX_INPUT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_vertex_input, &ColladaParserAutoGen14Private::_data__bind_vertex_input, &ColladaParserAutoGen14Private::_end__bind_vertex_input, &ColladaParserAutoGen14Private::_preBegin__bind_vertex_input, &ColladaParserAutoGen14Private::_preEnd__bind_vertex_input, &ColladaParserAutoGen14Private::_freeAttributes__bind_vertex_input);
-functionMap[HASH_ELEMENT_EQUATION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__equation, &ColladaParserAutoGen14Private::_data__equation, &ColladaParserAutoGen14Private::_end__equation, &ColladaParserAutoGen14Private::_preBegin__equation, &ColladaParserAutoGen14Private::_preEnd__equation, &ColladaParserAutoGen14Private::_freeAttributes__equation);
-functionMap[HASH_ELEMENT_RADIUS____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius____float, &ColladaParserAutoGen14Private::_data__radius____float, &ColladaParserAutoGen14Private::_end__radius____float, &ColladaParserAutoGen14Private::_preBegin__radius____float, &ColladaParserAutoGen14Private::_preEnd__radius____float, &ColladaParserAutoGen14Private::_freeAttributes__radius____float);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius1, &ColladaParserAutoGen14Private::_data__radius1, &ColladaParserAutoGen14Private::_end__radius1, &ColladaParserAutoGen14Private::_preBegin__radius1, &ColladaParserAutoGen14Private::_preEnd__radius1, &ColladaParserAutoGen14Private::_freeAttributes__radius1);
-functionMap[HASH_ELEMENT_RADIUS2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius2, &ColladaParserAutoGen14Private::_data__radius2, &ColladaParserAutoGen14Private::_end__radius2, &ColladaParserAutoGen14Private::_preBegin__radius2, &ColladaParserAutoGen14Private::_preEnd__radius2, &ColladaParserAutoGen14Private::_freeAttributes__radius2);
-functionMap[HASH_ELEMENT_HEIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__height, &ColladaParserAutoGen14Private::_data__height, &ColladaParserAutoGen14Private::_end__height, &ColladaParserAutoGen14Private::_preBegin__height, &ColladaParserAutoGen14Private::_preEnd__height, &ColladaParserAutoGen14Private::_freeAttributes__height);
-functionMap[HASH_ELEMENT_RADIUS1] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius1, &ColladaParserAutoGen14Private::_data__radius1, &ColladaParserAutoGen14Private::_end__radius1, &ColladaParserAutoGen14Private::_preBegin__radius1, &ColladaParserAutoGen14Private::_preEnd__radius1, &ColladaParserAutoGen14Private::_freeAttributes__radius1);
-functionMap[HASH_ELEMENT_RADIUS2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__radius2, &ColladaParserAutoGen14Private::_data__radius2, &ColladaParserAutoGen14Private::_end__radius2, &ColladaParserAutoGen14Private::_preBegin__radius2, &ColladaParserAutoGen14Private::_preEnd__radius2, &ColladaParserAutoGen14Private::_freeAttributes__radius2);
-functionMap[HASH_ELEMENT_GRAVITY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__gravity, &ColladaParserAutoGen14Private::_data__gravity, &ColladaParserAutoGen14Private::_end__gravity, &ColladaParserAutoGen14Private::_preBegin__gravity, &ColladaParserAutoGen14Private::_preEnd__gravity, &ColladaParserAutoGen14Private::_freeAttributes__gravity);
-functionMap[HASH_ELEMENT_TIME_STEP] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__time_step, &ColladaParserAutoGen14Private::_data__time_step, &ColladaParserAutoGen14Private::_end__time_step, &ColladaParserAutoGen14Private::_preBegin__time_step, &ColladaParserAutoGen14Private::_preEnd__time_step, &ColladaParserAutoGen14Private::_freeAttributes__time_step);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_PHYSICS_SCENES,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_PHYSICS_SCENE,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_INSTANCE_FORCE_FIELD,
+HASH_ELEMENT_INSTANCE_PHYSICS_MODEL,
+HASH_ELEMENT_PHYSICS_SCENE__TECHNIQUE_COMMON,
+HASH_ELEMENT_INSTANCE_RIGID_BODY,
+HASH_ELEMENT_INSTANCE_RIGID_CONSTRAINT,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON,
+HASH_ELEMENT_ANGULAR_VELOCITY,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__DYNAMIC,
+HASH_ELEMENT_INERTIA,
+HASH_ELEMENT_INSTANCE_PHYSICS_MATERIAL,
+HASH_ELEMENT_MASS,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__MASS_FRAME,
+HASH_ELEMENT_PHYSICS_MATERIAL,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE,
+HASH_ELEMENT_VELOCITY,
+HASH_ELEMENT_ROTATE,
+HASH_ELEMENT_TRANSLATE,
+HASH_ELEMENT_PHYSICS_MATERIAL__TECHNIQUE_COMMON,
+HASH_ELEMENT_DYNAMIC_FRICTION,
+HASH_ELEMENT_RESTITUTION,
+HASH_ELEMENT_STATIC_FRICTION,
+HASH_ELEMENT_BOX,
+HASH_ELEMENT_CAPSULE,
+HASH_ELEMENT_CYLINDER,
+HASH_ELEMENT_DENSITY,
+HASH_ELEMENT_INSTANCE_RIGID_BODY__TECHNIQUE_COMMON__SHAPE__HOLLOW,
+HASH_ELEMENT_INSTANCE_GEOMETRY,
+HASH_ELEMENT_MASS,
+HASH_ELEMENT_PLANE,
+HASH_ELEMENT_SPHERE,
+HASH_ELEMENT_TAPERED_CAPSULE,
+HASH_ELEMENT_TAPERED_CYLINDER,
+HASH_ELEMENT_HALF_EXTENTS,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS____FLOAT2,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS____FLOAT2,
+HASH_ELEMENT_BIND_MATERIAL,
+HASH_ELEMENT_PARAM,
+HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON,
+HASH_ELEMENT_INSTANCE_MATERIAL,
+HASH_ELEMENT_INSTANCE_MATERIAL__BIND,
+HASH_ELEMENT_BIND_VERTEX_INPUT,
+HASH_ELEMENT_EQUATION,
+HASH_ELEMENT_RADIUS____FLOAT,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS1,
+HASH_ELEMENT_RADIUS2,
+HASH_ELEMENT_HEIGHT,
+HASH_ELEMENT_RADIUS1,
+HASH_ELEMENT_RADIUS2,
+HASH_ELEMENT_GRAVITY,
+HASH_ELEMENT_TIME_STEP,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
 //---------------------------------------------------------------------
 const ColladaParserAutoGen14Private::ElementFunctionMap& FunctionMapFactory::createFunctionMap__library_visual_scenes__allChildren() {
-static ColladaParserAutoGen14Private::ElementFunctionMap functionMap;
-static bool mapFilled = false;
-if ( !mapFilled )
-{
-functionMap[HASH_ELEMENT_COLLADA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__COLLADA, &ColladaParserAutoGen14Private::_data__COLLADA, &ColladaParserAutoGen14Private::_end__COLLADA, &ColladaParserAutoGen14Private::_preBegin__COLLADA, &ColladaParserAutoGen14Private::_preEnd__COLLADA, &ColladaParserAutoGen14Private::_freeAttributes__COLLADA);
-functionMap[HASH_ELEMENT_LIBRARY_VISUAL_SCENES] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__library_visual_scenes, &ColladaParserAutoGen14Private::_data__library_visual_scenes, &ColladaParserAutoGen14Private::_end__library_visual_scenes, &ColladaParserAutoGen14Private::_preBegin__library_visual_scenes, &ColladaParserAutoGen14Private::_preEnd__library_visual_scenes, &ColladaParserAutoGen14Private::_freeAttributes__library_visual_scenes);
-functionMap[HASH_ELEMENT_ASSET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__asset, &ColladaParserAutoGen14Private::_data__asset, &ColladaParserAutoGen14Private::_end__asset, &ColladaParserAutoGen14Private::_preBegin__asset, &ColladaParserAutoGen14Private::_preEnd__asset, &ColladaParserAutoGen14Private::_freeAttributes__asset);
-functionMap[HASH_ELEMENT_EXTRA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__extra, &ColladaParserAutoGen14Private::_data__extra, &ColladaParserAutoGen14Private::_end__extra, &ColladaParserAutoGen14Private::_preBegin__extra, &ColladaParserAutoGen14Private::_preEnd__extra, &ColladaParserAutoGen14Private::_freeAttributes__extra);
-functionMap[HASH_ELEMENT_VISUAL_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__visual_scene, &ColladaParserAutoGen14Private::_data__visual_scene, &ColladaParserAutoGen14Private::_end__visual_scene, &ColladaParserAutoGen14Private::_preBegin__visual_scene, &ColladaParserAutoGen14Private::_preEnd__visual_scene, &ColladaParserAutoGen14Private::_freeAttributes__visual_scene);
-functionMap[HASH_ELEMENT_CONTRIBUTOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__contributor, &ColladaParserAutoGen14Private::_data__contributor, &ColladaParserAutoGen14Private::_end__contributor, &ColladaParserAutoGen14Private::_preBegin__contributor, &ColladaParserAutoGen14Private::_preEnd__contributor, &ColladaParserAutoGen14Private::_freeAttributes__contributor);
-functionMap[HASH_ELEMENT_CREATED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__created, &ColladaParserAutoGen14Private::_data__created, &ColladaParserAutoGen14Private::_end__created, &ColladaParserAutoGen14Private::_preBegin__created, &ColladaParserAutoGen14Private::_preEnd__created, &ColladaParserAutoGen14Private::_freeAttributes__created);
-functionMap[HASH_ELEMENT_KEYWORDS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__keywords, &ColladaParserAutoGen14Private::_data__keywords, &ColladaParserAutoGen14Private::_end__keywords, &ColladaParserAutoGen14Private::_preBegin__keywords, &ColladaParserAutoGen14Private::_preEnd__keywords, &ColladaParserAutoGen14Private::_freeAttributes__keywords);
-functionMap[HASH_ELEMENT_MODIFIED] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__modified, &ColladaParserAutoGen14Private::_data__modified, &ColladaParserAutoGen14Private::_end__modified, &ColladaParserAutoGen14Private::_preBegin__modified, &ColladaParserAutoGen14Private::_preEnd__modified, &ColladaParserAutoGen14Private::_freeAttributes__modified);
-functionMap[HASH_ELEMENT_REVISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__revision, &ColladaParserAutoGen14Private::_data__revision, &ColladaParserAutoGen14Private::_end__revision, &ColladaParserAutoGen14Private::_preBegin__revision, &ColladaParserAutoGen14Private::_preEnd__revision, &ColladaParserAutoGen14Private::_freeAttributes__revision);
-functionMap[HASH_ELEMENT_SUBJECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__subject, &ColladaParserAutoGen14Private::_data__subject, &ColladaParserAutoGen14Private::_end__subject, &ColladaParserAutoGen14Private::_preBegin__subject, &ColladaParserAutoGen14Private::_preEnd__subject, &ColladaParserAutoGen14Private::_freeAttributes__subject);
-functionMap[HASH_ELEMENT_TITLE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__title, &ColladaParserAutoGen14Private::_data__title, &ColladaParserAutoGen14Private::_end__title, &ColladaParserAutoGen14Private::_preBegin__title, &ColladaParserAutoGen14Private::_preEnd__title, &ColladaParserAutoGen14Private::_freeAttributes__title);
-functionMap[HASH_ELEMENT_UNIT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__unit, &ColladaParserAutoGen14Private::_data__unit, &ColladaParserAutoGen14Private::_end__unit, &ColladaParserAutoGen14Private::_preBegin__unit, &ColladaParserAutoGen14Private::_preEnd__unit, &ColladaParserAutoGen14Private::_freeAttributes__unit);
-functionMap[HASH_ELEMENT_UP_AXIS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__up_axis, &ColladaParserAutoGen14Private::_data__up_axis, &ColladaParserAutoGen14Private::_end__up_axis, &ColladaParserAutoGen14Private::_preBegin__up_axis, &ColladaParserAutoGen14Private::_preEnd__up_axis, &ColladaParserAutoGen14Private::_freeAttributes__up_axis);
-functionMap[HASH_ELEMENT_AUTHOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__author, &ColladaParserAutoGen14Private::_data__author, &ColladaParserAutoGen14Private::_end__author, &ColladaParserAutoGen14Private::_preBegin__author, &ColladaParserAutoGen14Private::_preEnd__author, &ColladaParserAutoGen14Private::_freeAttributes__author);
-functionMap[HASH_ELEMENT_AUTHORING_TOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__authoring_tool, &ColladaParserAutoGen14Private::_data__authoring_tool, &ColladaParserAutoGen14Private::_end__authoring_tool, &ColladaParserAutoGen14Private::_preBegin__authoring_tool, &ColladaParserAutoGen14Private::_preEnd__authoring_tool, &ColladaParserAutoGen14Private::_freeAttributes__authoring_tool);
-functionMap[HASH_ELEMENT_COMMENTS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__comments, &ColladaParserAutoGen14Private::_data__comments, &ColladaParserAutoGen14Private::_end__comments, &ColladaParserAutoGen14Private::_preBegin__comments, &ColladaParserAutoGen14Private::_preEnd__comments, &ColladaParserAutoGen14Private::_freeAttributes__comments);
-functionMap[HASH_ELEMENT_COPYRIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__copyright, &ColladaParserAutoGen14Private::_data__copyright, &ColladaParserAutoGen14Private::_end__copyright, &ColladaParserAutoGen14Private::_preBegin__copyright, &ColladaParserAutoGen14Private::_preEnd__copyright, &ColladaParserAutoGen14Private::_freeAttributes__copyright);
-functionMap[HASH_ELEMENT_SOURCE_DATA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source_data, &ColladaParserAutoGen14Private::_data__source_data, &ColladaParserAutoGen14Private::_end__source_data, &ColladaParserAutoGen14Private::_preBegin__source_data, &ColladaParserAutoGen14Private::_preEnd__source_data, &ColladaParserAutoGen14Private::_freeAttributes__source_data);
-functionMap[HASH_ELEMENT_TECHNIQUE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique, &ColladaParserAutoGen14Private::_data__technique, &ColladaParserAutoGen14Private::_end__technique, &ColladaParserAutoGen14Private::_preBegin__technique, &ColladaParserAutoGen14Private::_preEnd__technique, &ColladaParserAutoGen14Private::_freeAttributes__technique);
-functionMap[HASH_ELEMENT_EVALUATE_SCENE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__evaluate_scene, &ColladaParserAutoGen14Private::_data__evaluate_scene, &ColladaParserAutoGen14Private::_end__evaluate_scene, &ColladaParserAutoGen14Private::_preBegin__evaluate_scene, &ColladaParserAutoGen14Private::_preEnd__evaluate_scene, &ColladaParserAutoGen14Private::_freeAttributes__evaluate_scene);
-functionMap[HASH_ELEMENT_NODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__node, &ColladaParserAutoGen14Private::_data__node, &ColladaParserAutoGen14Private::_end__node, &ColladaParserAutoGen14Private::_preBegin__node, &ColladaParserAutoGen14Private::_preEnd__node, &ColladaParserAutoGen14Private::_freeAttributes__node);
-functionMap[HASH_ELEMENT_RENDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__render, &ColladaParserAutoGen14Private::_data__render, &ColladaParserAutoGen14Private::_end__render, &ColladaParserAutoGen14Private::_preBegin__render, &ColladaParserAutoGen14Private::_preEnd__render, &ColladaParserAutoGen14Private::_freeAttributes__render);
-functionMap[HASH_ELEMENT_INSTANCE_EFFECT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_effect, &ColladaParserAutoGen14Private::_data__instance_effect, &ColladaParserAutoGen14Private::_end__instance_effect, &ColladaParserAutoGen14Private::_preBegin__instance_effect, &ColladaParserAutoGen14Private::_preEnd__instance_effect, &ColladaParserAutoGen14Private::_freeAttributes__instance_effect);
-functionMap[HASH_ELEMENT_LAYER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__layer, &ColladaParserAutoGen14Private::_data__layer, &ColladaParserAutoGen14Private::_end__layer, &ColladaParserAutoGen14Private::_preBegin__layer, &ColladaParserAutoGen14Private::_preEnd__layer, &ColladaParserAutoGen14Private::_freeAttributes__layer);
-functionMap[HASH_ELEMENT_INSTANCE_EFFECT__SETPARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_effect__setparam, &ColladaParserAutoGen14Private::_data__instance_effect__setparam, &ColladaParserAutoGen14Private::_end__instance_effect__setparam, &ColladaParserAutoGen14Private::_preBegin__instance_effect__setparam, &ColladaParserAutoGen14Private::_preEnd__instance_effect__setparam, &ColladaParserAutoGen14Private::_freeAttributes__instance_effect__setparam);
-functionMap[HASH_ELEMENT_TECHNIQUE_HINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__technique_hint, &ColladaParserAutoGen14Private::_data__technique_hint, &ColladaParserAutoGen14Private::_end__technique_hint, &ColladaParserAutoGen14Private::_preBegin__technique_hint, &ColladaParserAutoGen14Private::_preEnd__technique_hint, &ColladaParserAutoGen14Private::_freeAttributes__technique_hint);
-functionMap[HASH_ELEMENT_BOOL____BOOL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool____bool, &ColladaParserAutoGen14Private::_data__bool____bool, &ColladaParserAutoGen14Private::_end__bool____bool, &ColladaParserAutoGen14Private::_preBegin__bool____bool, &ColladaParserAutoGen14Private::_preEnd__bool____bool, &ColladaParserAutoGen14Private::_freeAttributes__bool____bool);
-functionMap[HASH_ELEMENT_BOOL2____BOOL2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool2____bool2, &ColladaParserAutoGen14Private::_data__bool2____bool2, &ColladaParserAutoGen14Private::_end__bool2____bool2, &ColladaParserAutoGen14Private::_preBegin__bool2____bool2, &ColladaParserAutoGen14Private::_preEnd__bool2____bool2, &ColladaParserAutoGen14Private::_freeAttributes__bool2____bool2);
-functionMap[HASH_ELEMENT_BOOL3____BOOL3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool3____bool3, &ColladaParserAutoGen14Private::_data__bool3____bool3, &ColladaParserAutoGen14Private::_end__bool3____bool3, &ColladaParserAutoGen14Private::_preBegin__bool3____bool3, &ColladaParserAutoGen14Private::_preEnd__bool3____bool3, &ColladaParserAutoGen14Private::_freeAttributes__bool3____bool3);
-functionMap[HASH_ELEMENT_BOOL4____BOOL4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bool4____bool4, &ColladaParserAutoGen14Private::_data__bool4____bool4, &ColladaParserAutoGen14Private::_end__bool4____bool4, &ColladaParserAutoGen14Private::_preBegin__bool4____bool4, &ColladaParserAutoGen14Private::_preEnd__bool4____bool4, &ColladaParserAutoGen14Private::_freeAttributes__bool4____bool4);
-functionMap[HASH_ELEMENT_ENUM____STRING] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__enum____string, &ColladaParserAutoGen14Private::_data__enum____string, &ColladaParserAutoGen14Private::_end__enum____string, &ColladaParserAutoGen14Private::_preBegin__enum____string, &ColladaParserAutoGen14Private::_preEnd__enum____string, &ColladaParserAutoGen14Private::_freeAttributes__enum____string);
-functionMap[HASH_ELEMENT_FLOAT____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float____float, &ColladaParserAutoGen14Private::_data__float____float, &ColladaParserAutoGen14Private::_end__float____float, &ColladaParserAutoGen14Private::_preBegin__float____float, &ColladaParserAutoGen14Private::_preEnd__float____float, &ColladaParserAutoGen14Private::_freeAttributes__float____float);
-functionMap[HASH_ELEMENT_FLOAT1X1____FLOAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x1____float, &ColladaParserAutoGen14Private::_data__float1x1____float, &ColladaParserAutoGen14Private::_end__float1x1____float, &ColladaParserAutoGen14Private::_preBegin__float1x1____float, &ColladaParserAutoGen14Private::_preEnd__float1x1____float, &ColladaParserAutoGen14Private::_freeAttributes__float1x1____float);
-functionMap[HASH_ELEMENT_FLOAT1X2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x2____float2, &ColladaParserAutoGen14Private::_data__float1x2____float2, &ColladaParserAutoGen14Private::_end__float1x2____float2, &ColladaParserAutoGen14Private::_preBegin__float1x2____float2, &ColladaParserAutoGen14Private::_preEnd__float1x2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float1x2____float2);
-functionMap[HASH_ELEMENT_FLOAT1X3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x3____float3, &ColladaParserAutoGen14Private::_data__float1x3____float3, &ColladaParserAutoGen14Private::_end__float1x3____float3, &ColladaParserAutoGen14Private::_preBegin__float1x3____float3, &ColladaParserAutoGen14Private::_preEnd__float1x3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float1x3____float3);
-functionMap[HASH_ELEMENT_FLOAT1X4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float1x4____float4, &ColladaParserAutoGen14Private::_data__float1x4____float4, &ColladaParserAutoGen14Private::_end__float1x4____float4, &ColladaParserAutoGen14Private::_preBegin__float1x4____float4, &ColladaParserAutoGen14Private::_preEnd__float1x4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float1x4____float4);
-functionMap[HASH_ELEMENT_FLOAT2____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2____float2, &ColladaParserAutoGen14Private::_data__float2____float2, &ColladaParserAutoGen14Private::_end__float2____float2, &ColladaParserAutoGen14Private::_preBegin__float2____float2, &ColladaParserAutoGen14Private::_preEnd__float2____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2____float2);
-functionMap[HASH_ELEMENT_FLOAT2X1____FLOAT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x1____float2, &ColladaParserAutoGen14Private::_data__float2x1____float2, &ColladaParserAutoGen14Private::_end__float2x1____float2, &ColladaParserAutoGen14Private::_preBegin__float2x1____float2, &ColladaParserAutoGen14Private::_preEnd__float2x1____float2, &ColladaParserAutoGen14Private::_freeAttributes__float2x1____float2);
-functionMap[HASH_ELEMENT_FLOAT2X2____FLOAT2X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x2____float2x2, &ColladaParserAutoGen14Private::_data__float2x2____float2x2, &ColladaParserAutoGen14Private::_end__float2x2____float2x2, &ColladaParserAutoGen14Private::_preBegin__float2x2____float2x2, &ColladaParserAutoGen14Private::_preEnd__float2x2____float2x2, &ColladaParserAutoGen14Private::_freeAttributes__float2x2____float2x2);
-functionMap[HASH_ELEMENT_FLOAT2X3____FLOAT2X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x3____float2x3, &ColladaParserAutoGen14Private::_data__float2x3____float2x3, &ColladaParserAutoGen14Private::_end__float2x3____float2x3, &ColladaParserAutoGen14Private::_preBegin__float2x3____float2x3, &ColladaParserAutoGen14Private::_preEnd__float2x3____float2x3, &ColladaParserAutoGen14Private::_freeAttributes__float2x3____float2x3);
-functionMap[HASH_ELEMENT_FLOAT2X4____FLOAT2X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float2x4____float2x4, &ColladaParserAutoGen14Private::_data__float2x4____float2x4, &ColladaParserAutoGen14Private::_end__float2x4____float2x4, &ColladaParserAutoGen14Private::_preBegin__float2x4____float2x4, &ColladaParserAutoGen14Private::_preEnd__float2x4____float2x4, &ColladaParserAutoGen14Private::_freeAttributes__float2x4____float2x4);
-functionMap[HASH_ELEMENT_FLOAT3____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3____float3, &ColladaParserAutoGen14Private::_data__float3____float3, &ColladaParserAutoGen14Private::_end__float3____float3, &ColladaParserAutoGen14Private::_preBegin__float3____float3, &ColladaParserAutoGen14Private::_preEnd__float3____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3____float3);
-functionMap[HASH_ELEMENT_FLOAT3X1____FLOAT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x1____float3, &ColladaParserAutoGen14Private::_data__float3x1____float3, &ColladaParserAutoGen14Private::_end__float3x1____float3, &ColladaParserAutoGen14Private::_preBegin__float3x1____float3, &ColladaParserAutoGen14Private::_preEnd__float3x1____float3, &ColladaParserAutoGen14Private::_freeAttributes__float3x1____float3);
-functionMap[HASH_ELEMENT_FLOAT3X2____FLOAT3X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x2____float3x2, &ColladaParserAutoGen14Private::_data__float3x2____float3x2, &ColladaParserAutoGen14Private::_end__float3x2____float3x2, &ColladaParserAutoGen14Private::_preBegin__float3x2____float3x2, &ColladaParserAutoGen14Private::_preEnd__float3x2____float3x2, &ColladaParserAutoGen14Private::_freeAttributes__float3x2____float3x2);
-functionMap[HASH_ELEMENT_FLOAT3X3____FLOAT3X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x3____float3x3, &ColladaParserAutoGen14Private::_data__float3x3____float3x3, &ColladaParserAutoGen14Private::_end__float3x3____float3x3, &ColladaParserAutoGen14Private::_preBegin__float3x3____float3x3, &ColladaParserAutoGen14Private::_preEnd__float3x3____float3x3, &ColladaParserAutoGen14Private::_freeAttributes__float3x3____float3x3);
-functionMap[HASH_ELEMENT_FLOAT3X4____FLOAT3X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float3x4____float3x4, &ColladaParserAutoGen14Private::_data__float3x4____float3x4, &ColladaParserAutoGen14Private::_end__float3x4____float3x4, &ColladaParserAutoGen14Private::_preBegin__float3x4____float3x4, &ColladaParserAutoGen14Private::_preEnd__float3x4____float3x4, &ColladaParserAutoGen14Private::_freeAttributes__float3x4____float3x4);
-functionMap[HASH_ELEMENT_FLOAT4____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4____float4, &ColladaParserAutoGen14Private::_data__float4____float4, &ColladaParserAutoGen14Private::_end__float4____float4, &ColladaParserAutoGen14Private::_preBegin__float4____float4, &ColladaParserAutoGen14Private::_preEnd__float4____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4____float4);
-functionMap[HASH_ELEMENT_FLOAT4X1____FLOAT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x1____float4, &ColladaParserAutoGen14Private::_data__float4x1____float4, &ColladaParserAutoGen14Private::_end__float4x1____float4, &ColladaParserAutoGen14Private::_preBegin__float4x1____float4, &ColladaParserAutoGen14Private::_preEnd__float4x1____float4, &ColladaParserAutoGen14Private::_freeAttributes__float4x1____float4);
-functionMap[HASH_ELEMENT_FLOAT4X2____FLOAT4X2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x2____float4x2, &ColladaParserAutoGen14Private::_data__float4x2____float4x2, &ColladaParserAutoGen14Private::_end__float4x2____float4x2, &ColladaParserAutoGen14Private::_preBegin__float4x2____float4x2, &ColladaParserAutoGen14Private::_preEnd__float4x2____float4x2, &ColladaParserAutoGen14Private::_freeAttributes__float4x2____float4x2);
-functionMap[HASH_ELEMENT_FLOAT4X3____FLOAT4X3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x3____float4x3, &ColladaParserAutoGen14Private::_data__float4x3____float4x3, &ColladaParserAutoGen14Private::_end__float4x3____float4x3, &ColladaParserAutoGen14Private::_preBegin__float4x3____float4x3, &ColladaParserAutoGen14Private::_preEnd__float4x3____float4x3, &ColladaParserAutoGen14Private::_freeAttributes__float4x3____float4x3);
-functionMap[HASH_ELEMENT_FLOAT4X4____FLOAT4X4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__float4x4____float4x4, &ColladaParserAutoGen14Private::_data__float4x4____float4x4, &ColladaParserAutoGen14Private::_end__float4x4____float4x4, &ColladaParserAutoGen14Private::_preBegin__float4x4____float4x4, &ColladaParserAutoGen14Private::_preEnd__float4x4____float4x4, &ColladaParserAutoGen14Private::_freeAttributes__float4x4____float4x4);
-functionMap[HASH_ELEMENT_INT____INT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int____int, &ColladaParserAutoGen14Private::_data__int____int, &ColladaParserAutoGen14Private::_end__int____int, &ColladaParserAutoGen14Private::_preBegin__int____int, &ColladaParserAutoGen14Private::_preEnd__int____int, &ColladaParserAutoGen14Private::_freeAttributes__int____int);
-functionMap[HASH_ELEMENT_INT2____INT2] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int2____int2, &ColladaParserAutoGen14Private::_data__int2____int2, &ColladaParserAutoGen14Private::_end__int2____int2, &ColladaParserAutoGen14Private::_preBegin__int2____int2, &ColladaParserAutoGen14Private::_preEnd__int2____int2, &ColladaParserAutoGen14Private::_freeAttributes__int2____int2);
-functionMap[HASH_ELEMENT_INT3____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int3____int3, &ColladaParserAutoGen14Private::_data__int3____int3, &ColladaParserAutoGen14Private::_end__int3____int3, &ColladaParserAutoGen14Private::_preBegin__int3____int3, &ColladaParserAutoGen14Private::_preEnd__int3____int3, &ColladaParserAutoGen14Private::_freeAttributes__int3____int3);
-functionMap[HASH_ELEMENT_INT4____INT4] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__int4____int4, &ColladaParserAutoGen14Private::_data__int4____int4, &ColladaParserAutoGen14Private::_end__int4____int4, &ColladaParserAutoGen14Private::_preBegin__int4____int4, &ColladaParserAutoGen14Private::_preEnd__int4____int4, &ColladaParserAutoGen14Private::_freeAttributes__int4____int4);
-functionMap[HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_data__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_end__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preBegin__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_preEnd__sampler1D____fx_sampler1D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler1D____fx_sampler1D_common);
-functionMap[HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_data__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_end__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preBegin__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_preEnd__sampler2D____fx_sampler2D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler2D____fx_sampler2D_common);
-functionMap[HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_data__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_end__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preBegin__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_preEnd__sampler3D____fx_sampler3D_common, &ColladaParserAutoGen14Private::_freeAttributes__sampler3D____fx_sampler3D_common);
-functionMap[HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_data__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_end__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preBegin__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_preEnd__samplerCUBE____fx_samplerCUBE_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerCUBE____fx_samplerCUBE_common);
-functionMap[HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_data__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_end__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preBegin__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_preEnd__samplerDEPTH____fx_samplerDEPTH_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerDEPTH____fx_samplerDEPTH_common);
-functionMap[HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_data__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_end__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preBegin__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_preEnd__samplerRECT____fx_samplerRECT_common, &ColladaParserAutoGen14Private::_freeAttributes__samplerRECT____fx_samplerRECT_common);
-functionMap[HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_data__surface____fx_surface_common, &ColladaParserAutoGen14Private::_end__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preBegin__surface____fx_surface_common, &ColladaParserAutoGen14Private::_preEnd__surface____fx_surface_common, &ColladaParserAutoGen14Private::_freeAttributes__surface____fx_surface_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_P] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_p, &ColladaParserAutoGen14Private::_data__wrap_p, &ColladaParserAutoGen14Private::_end__wrap_p, &ColladaParserAutoGen14Private::_preBegin__wrap_p, &ColladaParserAutoGen14Private::_preEnd__wrap_p, &ColladaParserAutoGen14Private::_freeAttributes__wrap_p);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_P] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_p, &ColladaParserAutoGen14Private::_data__wrap_p, &ColladaParserAutoGen14Private::_end__wrap_p, &ColladaParserAutoGen14Private::_preBegin__wrap_p, &ColladaParserAutoGen14Private::_preEnd__wrap_p, &ColladaParserAutoGen14Private::_freeAttributes__wrap_p);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_BORDER_COLOR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__border_color, &ColladaParserAutoGen14Private::_data__border_color, &ColladaParserAutoGen14Private::_end__border_color, &ColladaParserAutoGen14Private::_preBegin__border_color, &ColladaParserAutoGen14Private::_preEnd__border_color, &ColladaParserAutoGen14Private::_freeAttributes__border_color);
-functionMap[HASH_ELEMENT_MAGFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__magfilter, &ColladaParserAutoGen14Private::_data__magfilter, &ColladaParserAutoGen14Private::_end__magfilter, &ColladaParserAutoGen14Private::_preBegin__magfilter, &ColladaParserAutoGen14Private::_preEnd__magfilter, &ColladaParserAutoGen14Private::_freeAttributes__magfilter);
-functionMap[HASH_ELEMENT_MINFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__minfilter, &ColladaParserAutoGen14Private::_data__minfilter, &ColladaParserAutoGen14Private::_end__minfilter, &ColladaParserAutoGen14Private::_preBegin__minfilter, &ColladaParserAutoGen14Private::_preEnd__minfilter, &ColladaParserAutoGen14Private::_freeAttributes__minfilter);
-functionMap[HASH_ELEMENT_MIPFILTER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipfilter, &ColladaParserAutoGen14Private::_data__mipfilter, &ColladaParserAutoGen14Private::_end__mipfilter, &ColladaParserAutoGen14Private::_preBegin__mipfilter, &ColladaParserAutoGen14Private::_preEnd__mipfilter, &ColladaParserAutoGen14Private::_freeAttributes__mipfilter);
-functionMap[HASH_ELEMENT_MIPMAP_BIAS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_bias, &ColladaParserAutoGen14Private::_data__mipmap_bias, &ColladaParserAutoGen14Private::_end__mipmap_bias, &ColladaParserAutoGen14Private::_preBegin__mipmap_bias, &ColladaParserAutoGen14Private::_preEnd__mipmap_bias, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_bias);
-functionMap[HASH_ELEMENT_MIPMAP_MAXLEVEL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_data__mipmap_maxlevel, &ColladaParserAutoGen14Private::_end__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preBegin__mipmap_maxlevel, &ColladaParserAutoGen14Private::_preEnd__mipmap_maxlevel, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_maxlevel);
-functionMap[HASH_ELEMENT_SOURCE____NCNAME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__source____NCName, &ColladaParserAutoGen14Private::_data__source____NCName, &ColladaParserAutoGen14Private::_end__source____NCName, &ColladaParserAutoGen14Private::_preBegin__source____NCName, &ColladaParserAutoGen14Private::_preEnd__source____NCName, &ColladaParserAutoGen14Private::_freeAttributes__source____NCName);
-functionMap[HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_s____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_s____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_data__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_end__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preBegin__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_preEnd__wrap_t____fx_sampler_wrap_common, &ColladaParserAutoGen14Private::_freeAttributes__wrap_t____fx_sampler_wrap_common);
-functionMap[HASH_ELEMENT_FORMAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__format, &ColladaParserAutoGen14Private::_data__format, &ColladaParserAutoGen14Private::_end__format, &ColladaParserAutoGen14Private::_preBegin__format, &ColladaParserAutoGen14Private::_preEnd__format, &ColladaParserAutoGen14Private::_freeAttributes__format);
-functionMap[HASH_ELEMENT_FORMAT_HINT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__format_hint, &ColladaParserAutoGen14Private::_data__format_hint, &ColladaParserAutoGen14Private::_end__format_hint, &ColladaParserAutoGen14Private::_preBegin__format_hint, &ColladaParserAutoGen14Private::_preEnd__format_hint, &ColladaParserAutoGen14Private::_freeAttributes__format_hint);
-functionMap[HASH_ELEMENT_INIT_AS_NULL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_as_null, &ColladaParserAutoGen14Private::_data__init_as_null, &ColladaParserAutoGen14Private::_end__init_as_null, &ColladaParserAutoGen14Private::_preBegin__init_as_null, &ColladaParserAutoGen14Private::_preEnd__init_as_null, &ColladaParserAutoGen14Private::_freeAttributes__init_as_null);
-functionMap[HASH_ELEMENT_INIT_AS_TARGET] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_as_target, &ColladaParserAutoGen14Private::_data__init_as_target, &ColladaParserAutoGen14Private::_end__init_as_target, &ColladaParserAutoGen14Private::_preBegin__init_as_target, &ColladaParserAutoGen14Private::_preEnd__init_as_target, &ColladaParserAutoGen14Private::_freeAttributes__init_as_target);
-functionMap[HASH_ELEMENT_INIT_CUBE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_cube, &ColladaParserAutoGen14Private::_data__init_cube, &ColladaParserAutoGen14Private::_end__init_cube, &ColladaParserAutoGen14Private::_preBegin__init_cube, &ColladaParserAutoGen14Private::_preEnd__init_cube, &ColladaParserAutoGen14Private::_freeAttributes__init_cube);
-functionMap[HASH_ELEMENT_INIT_FROM____FX_SURFACE_INIT_FROM_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_data__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_end__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_preBegin__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_preEnd__init_from____fx_surface_init_from_common, &ColladaParserAutoGen14Private::_freeAttributes__init_from____fx_surface_init_from_common);
-functionMap[HASH_ELEMENT_INIT_PLANAR] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_planar, &ColladaParserAutoGen14Private::_data__init_planar, &ColladaParserAutoGen14Private::_end__init_planar, &ColladaParserAutoGen14Private::_preBegin__init_planar, &ColladaParserAutoGen14Private::_preEnd__init_planar, &ColladaParserAutoGen14Private::_freeAttributes__init_planar);
-functionMap[HASH_ELEMENT_INIT_VOLUME] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__init_volume, &ColladaParserAutoGen14Private::_data__init_volume, &ColladaParserAutoGen14Private::_end__init_volume, &ColladaParserAutoGen14Private::_preBegin__init_volume, &ColladaParserAutoGen14Private::_preEnd__init_volume, &ColladaParserAutoGen14Private::_freeAttributes__init_volume);
-functionMap[HASH_ELEMENT_MIP_LEVELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mip_levels, &ColladaParserAutoGen14Private::_data__mip_levels, &ColladaParserAutoGen14Private::_end__mip_levels, &ColladaParserAutoGen14Private::_preBegin__mip_levels, &ColladaParserAutoGen14Private::_preEnd__mip_levels, &ColladaParserAutoGen14Private::_freeAttributes__mip_levels);
-functionMap[HASH_ELEMENT_MIPMAP_GENERATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__mipmap_generate, &ColladaParserAutoGen14Private::_data__mipmap_generate, &ColladaParserAutoGen14Private::_end__mipmap_generate, &ColladaParserAutoGen14Private::_preBegin__mipmap_generate, &ColladaParserAutoGen14Private::_preEnd__mipmap_generate, &ColladaParserAutoGen14Private::_freeAttributes__mipmap_generate);
-functionMap[HASH_ELEMENT_SIZE____INT3] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__size____int3, &ColladaParserAutoGen14Private::_data__size____int3, &ColladaParserAutoGen14Private::_end__size____int3, &ColladaParserAutoGen14Private::_preBegin__size____int3, &ColladaParserAutoGen14Private::_preEnd__size____int3, &ColladaParserAutoGen14Private::_freeAttributes__size____int3);
-functionMap[HASH_ELEMENT_VIEWPORT_RATIO] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__viewport_ratio, &ColladaParserAutoGen14Private::_data__viewport_ratio, &ColladaParserAutoGen14Private::_end__viewport_ratio, &ColladaParserAutoGen14Private::_preBegin__viewport_ratio, &ColladaParserAutoGen14Private::_preEnd__viewport_ratio, &ColladaParserAutoGen14Private::_freeAttributes__viewport_ratio);
-functionMap[HASH_ELEMENT_CHANNELS] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__channels, &ColladaParserAutoGen14Private::_data__channels, &ColladaParserAutoGen14Private::_end__channels, &ColladaParserAutoGen14Private::_preBegin__channels, &ColladaParserAutoGen14Private::_preEnd__channels, &ColladaParserAutoGen14Private::_freeAttributes__channels);
-functionMap[HASH_ELEMENT_OPTION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__option, &ColladaParserAutoGen14Private::_data__option, &ColladaParserAutoGen14Private::_end__option, &ColladaParserAutoGen14Private::_preBegin__option, &ColladaParserAutoGen14Private::_preEnd__option, &ColladaParserAutoGen14Private::_freeAttributes__option);
-functionMap[HASH_ELEMENT_PRECISION] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__precision, &ColladaParserAutoGen14Private::_data__precision, &ColladaParserAutoGen14Private::_end__precision, &ColladaParserAutoGen14Private::_preBegin__precision, &ColladaParserAutoGen14Private::_preEnd__precision, &ColladaParserAutoGen14Private::_freeAttributes__precision);
-functionMap[HASH_ELEMENT_RANGE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__range, &ColladaParserAutoGen14Private::_data__range, &ColladaParserAutoGen14Private::_end__range, &ColladaParserAutoGen14Private::_preBegin__range, &ColladaParserAutoGen14Private::_preEnd__range, &ColladaParserAutoGen14Private::_freeAttributes__range);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____FACE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____face, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____face);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____PRIMARY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_data__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_end__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_cube_common____primary, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_cube_common____primary);
-functionMap[HASH_ELEMENT_ORDER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__order, &ColladaParserAutoGen14Private::_data__order, &ColladaParserAutoGen14Private::_end__order, &ColladaParserAutoGen14Private::_preBegin__order, &ColladaParserAutoGen14Private::_preEnd__order, &ColladaParserAutoGen14Private::_freeAttributes__order);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_PLANAR_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_planar_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_planar_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____ALL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_data__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_end__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_volume_common____all, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_volume_common____all);
-functionMap[HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____PRIMARY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_data__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_end__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_preBegin__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_preEnd__fx_surface_init_volume_common____primary, &ColladaParserAutoGen14Private::_freeAttributes__fx_surface_init_volume_common____primary);
-functionMap[HASH_ELEMENT_INSTANCE_CAMERA] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_camera, &ColladaParserAutoGen14Private::_data__instance_camera, &ColladaParserAutoGen14Private::_end__instance_camera, &ColladaParserAutoGen14Private::_preBegin__instance_camera, &ColladaParserAutoGen14Private::_preEnd__instance_camera, &ColladaParserAutoGen14Private::_freeAttributes__instance_camera);
-functionMap[HASH_ELEMENT_INSTANCE_CONTROLLER] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_controller, &ColladaParserAutoGen14Private::_data__instance_controller, &ColladaParserAutoGen14Private::_end__instance_controller, &ColladaParserAutoGen14Private::_preBegin__instance_controller, &ColladaParserAutoGen14Private::_preEnd__instance_controller, &ColladaParserAutoGen14Private::_freeAttributes__instance_controller);
-functionMap[HASH_ELEMENT_INSTANCE_GEOMETRY] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_geometry, &ColladaParserAutoGen14Private::_data__instance_geometry, &ColladaParserAutoGen14Private::_end__instance_geometry, &ColladaParserAutoGen14Private::_preBegin__instance_geometry, &ColladaParserAutoGen14Private::_preEnd__instance_geometry, &ColladaParserAutoGen14Private::_freeAttributes__instance_geometry);
-functionMap[HASH_ELEMENT_INSTANCE_LIGHT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_light, &ColladaParserAutoGen14Private::_data__instance_light, &ColladaParserAutoGen14Private::_end__instance_light, &ColladaParserAutoGen14Private::_preBegin__instance_light, &ColladaParserAutoGen14Private::_preEnd__instance_light, &ColladaParserAutoGen14Private::_freeAttributes__instance_light);
-functionMap[HASH_ELEMENT_INSTANCE_NODE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_node, &ColladaParserAutoGen14Private::_data__instance_node, &ColladaParserAutoGen14Private::_end__instance_node, &ColladaParserAutoGen14Private::_preBegin__instance_node, &ColladaParserAutoGen14Private::_preEnd__instance_node, &ColladaParserAutoGen14Private::_freeAttributes__instance_node);
-functionMap[HASH_ELEMENT_LOOKAT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__lookat, &ColladaParserAutoGen14Private::_data__lookat, &ColladaParserAutoGen14Private::_end__lookat, &ColladaParserAutoGen14Private::_preBegin__lookat, &ColladaParserAutoGen14Private::_preEnd__lookat, &ColladaParserAutoGen14Private::_freeAttributes__lookat);
-functionMap[HASH_ELEMENT_MATRIX] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__matrix, &ColladaParserAutoGen14Private::_data__matrix, &ColladaParserAutoGen14Private::_end__matrix, &ColladaParserAutoGen14Private::_preBegin__matrix, &ColladaParserAutoGen14Private::_preEnd__matrix, &ColladaParserAutoGen14Private::_freeAttributes__matrix);
-functionMap[HASH_ELEMENT_ROTATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__rotate, &ColladaParserAutoGen14Private::_data__rotate, &ColladaParserAutoGen14Private::_end__rotate, &ColladaParserAutoGen14Private::_preBegin__rotate, &ColladaParserAutoGen14Private::_preEnd__rotate, &ColladaParserAutoGen14Private::_freeAttributes__rotate);
-functionMap[HASH_ELEMENT_SCALE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__scale, &ColladaParserAutoGen14Private::_data__scale, &ColladaParserAutoGen14Private::_end__scale, &ColladaParserAutoGen14Private::_preBegin__scale, &ColladaParserAutoGen14Private::_preEnd__scale, &ColladaParserAutoGen14Private::_freeAttributes__scale);
-functionMap[HASH_ELEMENT_SKEW] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__skew, &ColladaParserAutoGen14Private::_data__skew, &ColladaParserAutoGen14Private::_end__skew, &ColladaParserAutoGen14Private::_preBegin__skew, &ColladaParserAutoGen14Private::_preEnd__skew, &ColladaParserAutoGen14Private::_freeAttributes__skew);
-functionMap[HASH_ELEMENT_TRANSLATE] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__translate, &ColladaParserAutoGen14Private::_data__translate, &ColladaParserAutoGen14Private::_end__translate, &ColladaParserAutoGen14Private::_preBegin__translate, &ColladaParserAutoGen14Private::_preEnd__translate, &ColladaParserAutoGen14Private::_freeAttributes__translate);
-functionMap[HASH_ELEMENT_BIND_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material, &ColladaParserAutoGen14Private::_data__bind_material, &ColladaParserAutoGen14Private::_end__bind_material, &ColladaParserAutoGen14Private::_preBegin__bind_material, &ColladaParserAutoGen14Private::_preEnd__bind_material, &ColladaParserAutoGen14Private::_freeAttributes__bind_material);
-functionMap[HASH_ELEMENT_SKELETON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__skeleton, &ColladaParserAutoGen14Private::_data__skeleton, &ColladaParserAutoGen14Private::_end__skeleton, &ColladaParserAutoGen14Private::_preBegin__skeleton, &ColladaParserAutoGen14Private::_preEnd__skeleton, &ColladaParserAutoGen14Private::_freeAttributes__skeleton);
-functionMap[HASH_ELEMENT_PARAM] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__param, &ColladaParserAutoGen14Private::_data__param, &ColladaParserAutoGen14Private::_end__param, &ColladaParserAutoGen14Private::_preBegin__param, &ColladaParserAutoGen14Private::_preEnd__param, &ColladaParserAutoGen14Private::_freeAttributes__param);
-functionMap[HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_material__technique_common, &ColladaParserAutoGen14Private::_data__bind_material__technique_common, &ColladaParserAutoGen14Private::_end__bind_material__technique_common, &ColladaParserAutoGen14Private::_preBegin__bind_material__technique_common, &ColladaParserAutoGen14Private::_preEnd__bind_material__technique_common, &ColladaParserAutoGen14Private::_freeAttributes__bind_material__technique_common);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material, &ColladaParserAutoGen14Private::_data__instance_material, &ColladaParserAutoGen14Private::_end__instance_material, &ColladaParserAutoGen14Private::_preBegin__instance_material, &ColladaParserAutoGen14Private::_preEnd__instance_material, &ColladaParserAutoGen14Private::_freeAttributes__instance_material);
-functionMap[HASH_ELEMENT_INSTANCE_MATERIAL__BIND] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__instance_material__bind, &ColladaParserAutoGen14Private::_data__instance_material__bind, &ColladaParserAutoGen14Private::_end__instance_material__bind, &ColladaParserAutoGen14Private::_preBegin__instance_material__bind, &ColladaParserAutoGen14Private::_preEnd__instance_material__bind, &ColladaParserAutoGen14Private::_freeAttributes__instance_material__bind);
-functionMap[HASH_ELEMENT_BIND_VERTEX_INPUT] = ColladaParserAutoGen14Private::FunctionStruct(&ColladaParserAutoGen14Private::_begin__bind_vertex_input, &ColladaParserAutoGen14Private::_data__bind_vertex_input, &ColladaParserAutoGen14Private::_end__bind_vertex_input, &ColladaParserAutoGen14Private::_preBegin__bind_vertex_input, &ColladaParserAutoGen14Private::_preEnd__bind_vertex_input, &ColladaParserAutoGen14Private::_freeAttributes__bind_vertex_input);
-mapFilled = true;
-}
+static const StringHash elementHashes[] = {
+HASH_ELEMENT_COLLADA,
+HASH_ELEMENT_LIBRARY_VISUAL_SCENES,
+HASH_ELEMENT_ASSET,
+HASH_ELEMENT_EXTRA,
+HASH_ELEMENT_VISUAL_SCENE,
+HASH_ELEMENT_CONTRIBUTOR,
+HASH_ELEMENT_CREATED,
+HASH_ELEMENT_KEYWORDS,
+HASH_ELEMENT_MODIFIED,
+HASH_ELEMENT_REVISION,
+HASH_ELEMENT_SUBJECT,
+HASH_ELEMENT_TITLE,
+HASH_ELEMENT_UNIT,
+HASH_ELEMENT_UP_AXIS,
+HASH_ELEMENT_AUTHOR,
+HASH_ELEMENT_AUTHORING_TOOL,
+HASH_ELEMENT_COMMENTS,
+HASH_ELEMENT_COPYRIGHT,
+HASH_ELEMENT_SOURCE_DATA,
+HASH_ELEMENT_TECHNIQUE,
+HASH_ELEMENT_EVALUATE_SCENE,
+HASH_ELEMENT_NODE,
+HASH_ELEMENT_RENDER,
+HASH_ELEMENT_INSTANCE_EFFECT,
+HASH_ELEMENT_LAYER,
+HASH_ELEMENT_INSTANCE_EFFECT__SETPARAM,
+HASH_ELEMENT_TECHNIQUE_HINT,
+HASH_ELEMENT_BOOL____BOOL,
+HASH_ELEMENT_BOOL2____BOOL2,
+HASH_ELEMENT_BOOL3____BOOL3,
+HASH_ELEMENT_BOOL4____BOOL4,
+HASH_ELEMENT_ENUM____STRING,
+HASH_ELEMENT_FLOAT____FLOAT,
+HASH_ELEMENT_FLOAT1X1____FLOAT,
+HASH_ELEMENT_FLOAT1X2____FLOAT2,
+HASH_ELEMENT_FLOAT1X3____FLOAT3,
+HASH_ELEMENT_FLOAT1X4____FLOAT4,
+HASH_ELEMENT_FLOAT2____FLOAT2,
+HASH_ELEMENT_FLOAT2X1____FLOAT2,
+HASH_ELEMENT_FLOAT2X2____FLOAT2X2,
+HASH_ELEMENT_FLOAT2X3____FLOAT2X3,
+HASH_ELEMENT_FLOAT2X4____FLOAT2X4,
+HASH_ELEMENT_FLOAT3____FLOAT3,
+HASH_ELEMENT_FLOAT3X1____FLOAT3,
+HASH_ELEMENT_FLOAT3X2____FLOAT3X2,
+HASH_ELEMENT_FLOAT3X3____FLOAT3X3,
+HASH_ELEMENT_FLOAT3X4____FLOAT3X4,
+HASH_ELEMENT_FLOAT4____FLOAT4,
+HASH_ELEMENT_FLOAT4X1____FLOAT4,
+HASH_ELEMENT_FLOAT4X2____FLOAT4X2,
+HASH_ELEMENT_FLOAT4X3____FLOAT4X3,
+HASH_ELEMENT_FLOAT4X4____FLOAT4X4,
+HASH_ELEMENT_INT____INT,
+HASH_ELEMENT_INT2____INT2,
+HASH_ELEMENT_INT3____INT3,
+HASH_ELEMENT_INT4____INT4,
+HASH_ELEMENT_SAMPLER1D____FX_SAMPLER1D_COMMON,
+HASH_ELEMENT_SAMPLER2D____FX_SAMPLER2D_COMMON,
+HASH_ELEMENT_SAMPLER3D____FX_SAMPLER3D_COMMON,
+HASH_ELEMENT_SAMPLERCUBE____FX_SAMPLERCUBE_COMMON,
+HASH_ELEMENT_SAMPLERDEPTH____FX_SAMPLERDEPTH_COMMON,
+HASH_ELEMENT_SAMPLERRECT____FX_SAMPLERRECT_COMMON,
+HASH_ELEMENT_SURFACE____FX_SURFACE_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_P,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_P,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_BORDER_COLOR,
+HASH_ELEMENT_MAGFILTER,
+HASH_ELEMENT_MINFILTER,
+HASH_ELEMENT_MIPFILTER,
+HASH_ELEMENT_MIPMAP_BIAS,
+HASH_ELEMENT_MIPMAP_MAXLEVEL,
+HASH_ELEMENT_SOURCE____NCNAME,
+HASH_ELEMENT_WRAP_S____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_WRAP_T____FX_SAMPLER_WRAP_COMMON,
+HASH_ELEMENT_FORMAT,
+HASH_ELEMENT_FORMAT_HINT,
+HASH_ELEMENT_INIT_AS_NULL,
+HASH_ELEMENT_INIT_AS_TARGET,
+HASH_ELEMENT_INIT_CUBE,
+HASH_ELEMENT_INIT_FROM____FX_SURFACE_INIT_FROM_COMMON,
+HASH_ELEMENT_INIT_PLANAR,
+HASH_ELEMENT_INIT_VOLUME,
+HASH_ELEMENT_MIP_LEVELS,
+HASH_ELEMENT_MIPMAP_GENERATE,
+HASH_ELEMENT_SIZE____INT3,
+HASH_ELEMENT_VIEWPORT_RATIO,
+HASH_ELEMENT_CHANNELS,
+HASH_ELEMENT_OPTION,
+HASH_ELEMENT_PRECISION,
+HASH_ELEMENT_RANGE,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____FACE,
+HASH_ELEMENT_FX_SURFACE_INIT_CUBE_COMMON____PRIMARY,
+HASH_ELEMENT_ORDER,
+HASH_ELEMENT_FX_SURFACE_INIT_PLANAR_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____ALL,
+HASH_ELEMENT_FX_SURFACE_INIT_VOLUME_COMMON____PRIMARY,
+HASH_ELEMENT_INSTANCE_CAMERA,
+HASH_ELEMENT_INSTANCE_CONTROLLER,
+HASH_ELEMENT_INSTANCE_GEOMETRY,
+HASH_ELEMENT_INSTANCE_LIGHT,
+HASH_ELEMENT_INSTANCE_NODE,
+HASH_ELEMENT_LOOKAT,
+HASH_ELEMENT_MATRIX,
+HASH_ELEMENT_ROTATE,
+HASH_ELEMENT_SCALE,
+HASH_ELEMENT_SKEW,
+HASH_ELEMENT_TRANSLATE,
+HASH_ELEMENT_BIND_MATERIAL,
+HASH_ELEMENT_SKELETON,
+HASH_ELEMENT_PARAM,
+HASH_ELEMENT_BIND_MATERIAL__TECHNIQUE_COMMON,
+HASH_ELEMENT_INSTANCE_MATERIAL,
+HASH_ELEMENT_INSTANCE_MATERIAL__BIND,
+HASH_ELEMENT_BIND_VERTEX_INPUT,
+};
+static const ColladaParserAutoGen14Private::ElementFunctionMap functionMap(ColladaParserAutoGen14Private::ELEMENT_FUNCTION_TABLE, elementHashes, sizeof(elementHashes) / sizeof(elementHashes[0]));
 return functionMap;
 }
 
@@ -88,7 +88,7 @@ return mLoader->end__data();
 }
 
 
-bool LibraryImagesLoader14::data__data( const uint8* data, size_t length )
+bool LibraryImagesLoader14::data__data( const ParserChar* data, size_t length )
 {
 SaxVirtualFunctionTest14(data__data(data, length));
 return mLoader->data__data(data, length);
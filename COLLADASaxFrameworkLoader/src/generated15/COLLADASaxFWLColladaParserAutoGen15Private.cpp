@@ -27993,21 +27993,8 @@ const binary__hex__AttributeData binary__hex__AttributeData::DEFAULT = {0};
 //---------------------------------------------------------------------
 bool ColladaParserAutoGen15Private::_data__binary__hex( const ParserChar* text, size_t textLength )
 {
-#ifdef GENERATEDSAXPARSER_VALIDATION
-    if ( mValidate )
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen15::data__binary__hex, 0, 0, 0);
-    }
-    else
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen15::data__binary__hex);
-    }
-#else
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen15::data__binary__hex);
-    } // validation
-#endif
 
+return mImpl->data__binary__hex(text, textLength);
 }
 
 //---------------------------------------------------------------------
@@ -28076,22 +28063,7 @@ bool ColladaParserAutoGen15Private::_preEnd__binary__hex()
     } // validation
 #endif
 
-#ifdef GENERATEDSAXPARSER_VALIDATION
-    if ( mValidate )
-    {
-bool returnValue = uint8DataEnd( &ColladaParserAutoGen15::data__binary__hex, 0, 0, 0 );
-        return returnValue;
-    }
-    else
-    {
-return uint8DataEnd( &ColladaParserAutoGen15::data__binary__hex );
-    }
-#else
-    {
-return uint8DataEnd( &ColladaParserAutoGen15::data__binary__hex );
-    } // validation
-#endif
-
+    return true;
 }
 
 //---------------------------------------------------------------------
@@ -67507,21 +67479,8 @@ const library_images__image__init_from__hex__AttributeData library_images__image
 //---------------------------------------------------------------------
 bool ColladaParserAutoGen15Private::_data__library_images__image__init_from__hex( const ParserChar* text, size_t textLength )
 {
-#ifdef GENERATEDSAXPARSER_VALIDATION
-    if ( mValidate )
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen15::data__library_images__image__init_from__hex, 0, 0, 0);
-    }
-    else
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen15::data__library_images__image__init_from__hex);
-    }
-#else
-    {
-return characterData2Uint8Data(text, textLength, &ColladaParserAutoGen15::data__library_images__image__init_from__hex);
-    } // validation
-#endif
 
+return mImpl->data__library_images__image__init_from__hex(text, textLength);
 }
 
 //---------------------------------------------------------------------
@@ -67595,22 +67554,7 @@ bool ColladaParserAutoGen15Private::_preEnd__library_images__image__init_from__h
     } // validation
 #endif
 
-#ifdef GENERATEDSAXPARSER_VALIDATION
-    if ( mValidate )
-    {
-bool returnValue = uint8DataEnd( &ColladaParserAutoGen15::data__library_images__image__init_from__hex, 0, 0, 0 );
-        return returnValue;
-    }
-    else
-    {
-return uint8DataEnd( &ColladaParserAutoGen15::data__library_images__image__init_from__hex );
-    }
-#else
-    {
-return uint8DataEnd( &ColladaParserAutoGen15::data__library_images__image__init_from__hex );
-    } // validation
-#endif
-
+    return true;
 }
 
 //---------------------------------------------------------------------
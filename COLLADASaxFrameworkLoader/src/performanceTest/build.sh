@@ -0,0 +1,14 @@
+
+OPTIONS="-std=c++11 -O3 -Wall -DPCRE_STATIC -DGENERATEDSAXPARSER_XMLPARSER_LIBXML"
+
+INCLUDES="-I../../include -I../../include/generated14 -I../../include/generated15 -I../../include/performanceTest -I../../../GeneratedSaxParser/include -I../../../COLLADAFramework/include -I../../../COLLADABaseUtils/include -I../../../COLLADABaseUtils/include/Math -I../../../Externals/MathMLSolver/include -I../../../Externals/MathMLSolver/include/AST -I../../../Externals/pcre/include -I../../../Externals/UTF/include -I../../../Externals/zlib/include -I/usr/include/libxml2"
+
+FILES="main.cpp performanceTest.cpp ../*.cpp ../generated14/*.cpp ../generated15/*.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserCompressedFileReader.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserCoutErrorHandler.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserLibxmlSaxParser.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserMemoryMappedFile.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserNamespaceStack.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserParser.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserParserError.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserParserTemplateBase.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserRawUnknownElementHandler.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserRecordedSaxParser.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserSaxEventRecorder.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserSaxParser.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserStackMemoryManager.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserUtils.cpp ../../../GeneratedSaxParser/src/GeneratedSaxParserXmlScanner.cpp ../../../COLLADAFramework/src/*.cpp ../../../COLLADABaseUtils/src/*.cpp ../../../COLLADABaseUtils/src/Math/*.cpp ../../../Externals/MathMLSolver/src/*.cpp ../../../Externals/MathMLSolver/src/AST/*.cpp ../../../Externals/pcre/src/pcre_chartables.c ../../../Externals/pcre/src/pcre_compile.c ../../../Externals/pcre/src/pcre_exec.c ../../../Externals/pcre/src/pcre_globals.c ../../../Externals/pcre/src/pcre_newline.c ../../../Externals/pcre/src/pcre_tables.c ../../../Externals/pcre/src/pcre_try_flipped.c ../../../Externals/UTF/src/ConvertUTF.c"
+
+LIBS="-lxml2 -lz -pthread"
+
+OUTPUTFILE="-o performanceTest"
+
+
+
+g++ $OPTIONS $INCLUDES $FILES $LIBS $OUTPUTFILE
@@ -0,0 +1,32 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include <stdlib.h>
+
+
+int main( int argc, char** argv )
+{
+	int repetitions = (argc > 1) ? atoi(argv[1]) : 100;
+	indexDeinterleavingPerformanceTest( 200000, repetitions );
+	sidResolvingPerformanceTest( 100000, repetitions );
+	uriResolvingPerformanceTest( 20000, 100000, repetitions );
+	elementDispatchPerformanceTest( 20000, repetitions );
+	listConversionPerformanceTest( 100000000, (repetitions + 99) / 100 );
+	vertexWeldingPerformanceTest( 5000000, (repetitions + 99) / 100 );
+	nodeHierarchyPerformanceTest( 1000000, (repetitions + 9) / 10 );
+	extraCapturePerformanceTest( 20000, (repetitions + 9) / 10 );
+	edgeBuildingPerformanceTest( 2000000, (repetitions + 9) / 10 );
+	imageDataPerformanceTest( 16, 1000000, (repetitions + 9) / 10 );
+	arenaPerformanceTest( 100000, (repetitions + 9) / 10 );
+
+	return 0;
+}
@@ -0,0 +1,1566 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of COLLADASaxFrameworkLoader.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include "COLLADASaxFWLIndexDeinterleaver.h"
+#include "COLLADASaxFWLLoader.h"
+#include "COLLADASaxFWLSidTreeNode.h"
+#include "COLLADASaxFWLColladaParserAutoGen14Private.h"
+
+#include "GeneratedSaxParserLibxmlSaxParser.h"
+#include "GeneratedSaxParserRawUnknownElementHandler.h"
+
+#include "COLLADABUURI.h"
+#include "COLLADABUHashFunctions.h"
+
+#include "COLLADAFWVertexWelder.h"
+#include "COLLADAFWFlatNodeHierarchy.h"
+#include "COLLADAFWEdgeBuilder.h"
+#include "COLLADAFWHexBinaryData.h"
+#include "COLLADAFWMesh.h"
+#include "COLLADAFWPolylist.h"
+#include "COLLADAFWNode.h"
+#include "COLLADAFWTranslate.h"
+#include "COLLADAFWRotate.h"
+#include "COLLADAFWScale.h"
+#include "COLLADAFWMatrix.h"
+#include "COLLADAFWRoot.h"
+#include "COLLADAFWIWriter.h"
+#include "COLLADAFWVisualScene.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/types.h>
+#include <sys/timeb.h>
+
+
+namespace
+{
+	/** Number of indices passed per call, like the chunks the sax parser delivers.*/
+	const size_t CHUNK_SIZE = 1000;
+
+	/** The offsets of the inputs within a vertex.*/
+	const size_t POSITIONS_OFFSET = 0;
+	const size_t NORMALS_OFFSET = 1;
+	const size_t TEXCOORDS_OFFSET = 2;
+	const size_t MAX_OFFSET = 2;
+
+	/** The index arrays of one primitive.*/
+	struct IndexArrays
+	{
+		COLLADAFW::UIntValuesArray positionIndices;
+		COLLADAFW::UIntValuesArray normalIndices;
+		COLLADAFW::UIntValuesArray texCoordIndices;
+
+		IndexArrays()
+			: positionIndices(COLLADAFW::UIntValuesArray::OWNER)
+			, normalIndices(COLLADAFW::UIntValuesArray::OWNER)
+			, texCoordIndices(COLLADAFW::UIntValuesArray::OWNER)
+		{}
+
+		bool equals( const IndexArrays& other ) const
+		{
+			return equals(positionIndices, other.positionIndices) 
+				&& equals(normalIndices, other.normalIndices) 
+				&& equals(texCoordIndices, other.texCoordIndices);
+		}
+
+		static bool equals( const COLLADAFW::UIntValuesArray& lhs, const COLLADAFW::UIntValuesArray& rhs )
+		{
+			return (lhs.getCount() == rhs.getCount()) 
+				&& (memcmp(lhs.getData(), rhs.getData(), lhs.getCount() * sizeof(unsigned int)) == 0);
+		}
+	};
+
+	double getTime()
+	{
+#ifdef WIN32
+#pragma warning(disable: 4996)
+		_timeb timeBuffer;
+		_ftime( &timeBuffer );
+#pragma warning(default: 4996)
+#else
+		timeb timeBuffer;
+		ftime( &timeBuffer );
+#endif
+		return (double)timeBuffer.time + (double)timeBuffer.millitm / 1000;
+	}
+
+	/** Writes the indices one by one, testing each against all inputs, as the MeshLoader did before.*/
+	void writeSingleIndices( const unsigned long long* data, size_t length, size_t& currentOffset, IndexArrays& arrays )
+	{
+		for ( size_t i = 0; i < length; ++i )
+		{
+			unsigned int index = (unsigned int)data[i];
+			if ( currentOffset == POSITIONS_OFFSET )
+				arrays.positionIndices.append( index );
+			if ( currentOffset == NORMALS_OFFSET )
+				arrays.normalIndices.append( index );
+			if ( currentOffset == TEXCOORDS_OFFSET )
+				arrays.texCoordIndices.append( index );
+
+			if ( currentOffset == MAX_OFFSET )
+				currentOffset = 0;
+			else
+				++currentOffset;
+		}
+	}
+
+	double deinterleaveSingleIndices( const std::vector<unsigned long long>& indices, int repetitions, IndexArrays& result )
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			IndexArrays arrays;
+			size_t currentOffset = 0;
+			for ( size_t j = 0; j < indices.size(); j += CHUNK_SIZE )
+			{
+				size_t length = (indices.size() - j < CHUNK_SIZE) ? (indices.size() - j) : CHUNK_SIZE;
+				writeSingleIndices( &indices[j], length, currentOffset, arrays );
+			}
+			if ( i == 0 )
+			{
+				arrays.positionIndices.cloneArray( result.positionIndices );
+				arrays.normalIndices.cloneArray( result.normalIndices );
+				arrays.texCoordIndices.cloneArray( result.texCoordIndices );
+			}
+		}
+		return getTime() - startTime;
+	}
+
+	double deinterleaveIndices( const std::vector<unsigned long long>& indices, size_t vertexCount, int repetitions, IndexArrays& result )
+	{
+		const size_t stride = MAX_OFFSET + 1;
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			IndexArrays arrays;
+			COLLADASaxFWL::IndexDeinterleaver deinterleaver;
+			deinterleaver.reset( stride );
+			deinterleaver.addDestination( POSITIONS_OFFSET, arrays.positionIndices, 0 );
+			deinterleaver.addDestination( NORMALS_OFFSET, arrays.normalIndices, 0 );
+			deinterleaver.addDestination( TEXCOORDS_OFFSET, arrays.texCoordIndices, 0 );
+			deinterleaver.reserve( vertexCount );
+
+			size_t currentOffset = 0;
+			for ( size_t j = 0; j < indices.size(); j += CHUNK_SIZE )
+			{
+				size_t length = (indices.size() - j < CHUNK_SIZE) ? (indices.size() - j) : CHUNK_SIZE;
+				deinterleaver.deinterleave( &indices[j], length, currentOffset );
+				currentOffset = (currentOffset + length) % stride;
+			}
+			if ( i == 0 )
+			{
+				arrays.positionIndices.cloneArray( result.positionIndices );
+				arrays.normalIndices.cloneArray( result.normalIndices );
+				arrays.texCoordIndices.cloneArray( result.texCoordIndices );
+			}
+		}
+		return getTime() - startTime;
+	}
+}
+
+
+void indexDeinterleavingPerformanceTest( size_t triangleCount, int repetitions )
+{
+	size_t vertexCount = 3 * triangleCount;
+	std::vector<unsigned long long> indices( vertexCount * (MAX_OFFSET + 1) );
+	for ( size_t i = 0; i < indices.size(); ++i )
+		indices[i] = rand() % 1000000;
+
+	IndexArrays singleResult;
+	IndexArrays deinterleavedResult;
+	double singleTime = deinterleaveSingleIndices( indices, repetitions, singleResult );
+	double deinterleavedTime = deinterleaveIndices( indices, vertexCount, repetitions, deinterleavedResult );
+	double totalIndices = (double)indices.size() * repetitions / 1000000;
+
+	std::cout << "single indices: " << singleTime << " s, " << totalIndices / singleTime << " M indices/s" << std::endl;
+	std::cout << "deinterleaved:  " << deinterleavedTime << " s, " << totalIndices / deinterleavedTime << " M indices/s" << std::endl;
+	if ( !singleResult.equals(deinterleavedResult) )
+		std::cout << "results differ" << std::endl;
+}
+
+
+namespace
+{
+	/** The sid tree node as it was before the sids were interned, with all children of the sub hierarchy 
+	in an ordered map.*/
+	class OrderedSidTreeNode
+	{
+	private:
+		struct SidIdentifier
+		{
+			SidIdentifier( const std::string& _sid, size_t _hierarchyLevel)
+				: sid(_sid), hierarchyLevel(_hierarchyLevel){}
+
+			const std::string& sid;
+			size_t hierarchyLevel;
+
+			bool operator<(const SidIdentifier& rhs)const
+			{
+				if ( sid < rhs.sid)
+					return true;
+				if ( sid > rhs.sid)
+					return false;
+				return hierarchyLevel < rhs.hierarchyLevel;
+			}
+		};
+
+		typedef std::map< SidIdentifier, OrderedSidTreeNode*> SidIdentifierSidTreeNodeMap;
+
+		OrderedSidTreeNode* mParent;
+		SidIdentifierSidTreeNodeMap mChildren;
+		std::vector<OrderedSidTreeNode*> mDirectChildren;
+		std::string mSid;
+
+	public:
+		OrderedSidTreeNode( const std::string& sid, OrderedSidTreeNode* parent ) : mParent(parent), mSid(sid) {}
+
+		~OrderedSidTreeNode()
+		{
+			for ( size_t i = 0; i < mDirectChildren.size(); ++i )
+				delete mDirectChildren[i];
+		}
+
+		const std::string& getSid() const { return mSid; }
+
+		OrderedSidTreeNode* createAndAddChild( const std::string& sid )
+		{
+			OrderedSidTreeNode* newChild = new OrderedSidTreeNode(sid, this);
+			mDirectChildren.push_back(newChild);
+			if ( !sid.empty() )
+			{
+				SidIdentifier newIdentifier(newChild->getSid(), 0);
+				mChildren.insert(std::make_pair(newIdentifier, newChild));
+				addChildToParents( newChild, newIdentifier );
+			}
+			return newChild;
+		}
+
+		OrderedSidTreeNode* findChildBySid( const std::string& sid )
+		{
+			SidIdentifierSidTreeNodeMap::iterator it = mChildren.lower_bound( SidIdentifier(sid, 0) );
+			if ( (it == mChildren.end()) || (it->first.sid != sid) )
+				return 0;
+			return it->second;
+		}
+
+	private:
+		void addChildToParents( OrderedSidTreeNode *sidTreeNode, const SidIdentifier& sidIdentifier )
+		{
+			if ( mParent )
+			{
+				SidIdentifier parentSidIdentifier = sidIdentifier;
+				if ( !mParent->getSid().empty() )
+					parentSidIdentifier.hierarchyLevel++;
+				mParent->mChildren.insert(std::make_pair(parentSidIdentifier, sidTreeNode));
+				mParent->addChildToParents( sidTreeNode, parentSidIdentifier );
+			}
+		}
+	};
+
+	/** Number of joints in the chain of one skeleton.*/
+	const size_t JOINTS_PER_SKELETON = 20;
+
+	/** The sids of the animated transformations of each joint.*/
+	const char* TRANSFORMATION_SIDS[] = { "translate", "rotateX", "rotateY", "rotateZ", "scale" };
+	const size_t TRANSFORMATIONS_PER_JOINT = sizeof(TRANSFORMATION_SIDS) / sizeof(TRANSFORMATION_SIDS[0]);
+
+	/** A parsed sid address, i.e. the id of the skeleton root and the sids of the joint and the transformation.*/
+	struct ChannelTarget
+	{
+		std::string id;
+		std::vector<std::string> sids;
+	};
+
+	std::string skeletonId( size_t skeleton )
+	{
+		std::ostringstream stream;
+		stream << "skeleton" << skeleton;
+		return stream.str();
+	}
+
+	std::string jointSid( size_t joint )
+	{
+		std::ostringstream stream;
+		stream << "joint" << joint;
+		return stream.str();
+	}
+
+	/** Adds the skeletons of the rig to the tree below @a root and their ids to @a idMap. The same sid 
+	tree is built for both node types.*/
+	template<class NodeType, class IdMap>
+	void buildRig( NodeType* root, IdMap& idMap, size_t skeletonCount )
+	{
+		for ( size_t s = 0; s < skeletonCount; ++s )
+		{
+			NodeType* parent = root->createAndAddChild( "" );
+			idMap[skeletonId(s)] = parent;
+			for ( size_t j = 0; j < JOINTS_PER_SKELETON; ++j )
+			{
+				NodeType* joint = parent->createAndAddChild( jointSid(j) );
+				for ( size_t t = 0; t < TRANSFORMATIONS_PER_JOINT; ++t )
+					joint->createAndAddChild( TRANSFORMATION_SIDS[t] );
+				parent = joint;
+			}
+		}
+	}
+
+	/** Resolves all targets as the DocumentProcessor does and returns the number of resolved targets.*/
+	template<class NodeType, class IdMap>
+	size_t resolveTargets( const std::vector<ChannelTarget>& targets, IdMap& idMap )
+	{
+		size_t resolvedCount = 0;
+		for ( size_t i = 0; i < targets.size(); ++i )
+		{
+			const ChannelTarget& target = targets[i];
+			typename IdMap::iterator it = idMap.find( target.id );
+			if ( it == idMap.end() )
+				continue;
+			NodeType* currentNode = it->second;
+			for ( size_t k = 0; currentNode && (k < target.sids.size()); ++k )
+				currentNode = currentNode->findChildBySid( target.sids[k] );
+			if ( currentNode )
+				++resolvedCount;
+		}
+		return resolvedCount;
+	}
+}
+
+
+void sidResolvingPerformanceTest( size_t channelCount, int repetitions )
+{
+	size_t skeletonCount = channelCount / (JOINTS_PER_SKELETON * TRANSFORMATIONS_PER_JOINT);
+	std::vector<ChannelTarget> targets;
+	for ( size_t s = 0; s < skeletonCount; ++s )
+	{
+		for ( size_t j = 0; j < JOINTS_PER_SKELETON; ++j )
+		{
+			for ( size_t t = 0; t < TRANSFORMATIONS_PER_JOINT; ++t )
+			{
+				ChannelTarget target;
+				target.id = skeletonId(s);
+				target.sids.push_back( jointSid(j) );
+				target.sids.push_back( TRANSFORMATION_SIDS[t] );
+				targets.push_back( target );
+			}
+		}
+	}
+	std::random_shuffle( targets.begin(), targets.end() );
+
+	typedef std::map<std::string, OrderedSidTreeNode*> OrderedIdMap;
+	OrderedSidTreeNode orderedRoot( "", 0 );
+	OrderedIdMap orderedIdMap;
+	buildRig( &orderedRoot, orderedIdMap, skeletonCount );
+
+	COLLADASaxFWL::StringAtomTable sidAtomTable;
+	COLLADASaxFWL::SidTreeNode hashedRoot( "", 0, sidAtomTable );
+	COLLADABU::hash_map<std::string, COLLADASaxFWL::SidTreeNode*> hashedIdMap;
+	buildRig( &hashedRoot, hashedIdMap, skeletonCount );
+
+	size_t orderedResolved = 0;
+	double startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+		orderedResolved = resolveTargets<OrderedSidTreeNode>( targets, orderedIdMap );
+	double orderedTime = getTime() - startTime;
+
+	size_t hashedResolved = 0;
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+		hashedResolved = resolveTargets<COLLADASaxFWL::SidTreeNode>( targets, hashedIdMap );
+	double hashedTime = getTime() - startTime;
+
+	double totalTargets = (double)targets.size() * repetitions / 1000000;
+	std::cout << "ordered sid tree: " << orderedTime << " s, " << totalTargets / orderedTime << " M targets/s" << std::endl;
+	std::cout << "hashed sid tree:  " << hashedTime << " s, " << totalTargets / hashedTime << " M targets/s" << std::endl;
+	if ( (orderedResolved != targets.size()) || (hashedResolved != targets.size()) )
+		std::cout << "not all targets resolved" << std::endl;
+}
+
+
+void uriResolvingPerformanceTest( size_t idCount, size_t referenceCount, int repetitions )
+{
+	COLLADABU::URI fileUri( COLLADABU::URI::nativePathToUri("/home/user/projects/characters/scenes/animated_character_scene.dae") );
+	fileUri.setScheme( COLLADABU::URI::SCHEME_FILE );
+
+	std::vector<std::string> references;
+	references.reserve( referenceCount );
+	for ( size_t i = 0; i < referenceCount; ++i )
+	{
+		std::ostringstream reference;
+		reference << "#geometry_node_" << (rand() % idCount);
+		references.push_back( reference.str() );
+	}
+
+	typedef COLLADABU::hash_map<COLLADABU::URI, size_t> URIIdMap;
+	size_t createdCount = 0;
+	double startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		URIIdMap uriIdMap;
+		for ( size_t j = 0; j < references.size(); ++j )
+		{
+			COLLADABU::URI uri( fileUri, references[j] );
+			URIIdMap::iterator it = uriIdMap.find( uri );
+			if ( it == uriIdMap.end() )
+				uriIdMap[uri] = uriIdMap.size();
+		}
+		createdCount = uriIdMap.size();
+	}
+	double time = getTime() - startTime;
+
+	double totalReferences = (double)references.size() * repetitions / 1000000;
+	std::cout << "uri references: " << time << " s, " << totalReferences / time << " M references/s, "
+		<< createdCount << " unique ids, " << sizeof(COLLADABU::URI) << " bytes per uri" << std::endl;
+}
+
+
+namespace
+{
+	/** A sax event of a synthetic document, as the sax parser passes it to the generated parser.*/
+	struct SaxEvent
+	{
+		enum Type { BEGIN, TEXT, END };
+		Type type;
+		/** Element name or text.*/
+		const char* string;
+		const char** attributes;
+	};
+
+	const char* NO_ATTRIBUTES[] = { 0 };
+	const char* COLLADA_ATTRIBUTES[] = { "xmlns", "http://www.collada.org/2005/11/COLLADASchema", "version", "1.4.1", 0 };
+	const char* VISUAL_SCENE_ATTRIBUTES[] = { "id", "visual_scene", 0 };
+	const char* NODE_ATTRIBUTES[] = { "id", "node", "name", "node", "sid", "joint", 0 };
+	const char* TRANSLATE_ATTRIBUTES[] = { "sid", "translate", 0 };
+	const char* ROTATE_ATTRIBUTES[] = { "sid", "rotate", 0 };
+	const char* INSTANCE_GEOMETRY_ATTRIBUTES[] = { "url", "#geometry", 0 };
+	const char* INSTANCE_MATERIAL_ATTRIBUTES[] = { "symbol", "material", "target", "#material", 0 };
+	const char* INSTANCE_VISUAL_SCENE_ATTRIBUTES[] = { "url", "#visual_scene", 0 };
+
+	/** Number of elements per node in the synthetic document.*/
+	const size_t TAGS_PER_NODE = 9;
+
+	class SaxEvents : public std::vector<SaxEvent>
+	{
+	public:
+		void begin( const char* name, const char** attributes = NO_ATTRIBUTES )
+		{
+			SaxEvent event = { SaxEvent::BEGIN, name, attributes };
+			push_back( event );
+		}
+
+		void text( const char* text )
+		{
+			SaxEvent event = { SaxEvent::TEXT, text, 0 };
+			push_back( event );
+		}
+
+		void end( const char* name )
+		{
+			SaxEvent event = { SaxEvent::END, name, 0 };
+			push_back( event );
+		}
+
+		void element( const char* name, const char** attributes, const char* text )
+		{
+			begin( name, attributes );
+			text ? this->text( text ) : (void)0;
+			end( name );
+		}
+
+		size_t tagCount() const
+		{
+			size_t count = 0;
+			for ( const_iterator it = begin(); it != end(); ++it )
+				if ( it->type == SaxEvent::BEGIN )
+					++count;
+			return count;
+		}
+
+	private:
+		using std::vector<SaxEvent>::begin;
+		using std::vector<SaxEvent>::end;
+	};
+
+	/** Creates the events of a visual scene with @a nodeCount transformed nodes instantiating a geometry.*/
+	void createVisualSceneEvents( size_t nodeCount, SaxEvents& events )
+	{
+		events.begin( "COLLADA", COLLADA_ATTRIBUTES );
+		events.begin( "asset" );
+		events.element( "created", NO_ATTRIBUTES, "2009-01-01T00:00:00Z" );
+		events.element( "modified", NO_ATTRIBUTES, "2009-01-01T00:00:00Z" );
+		events.element( "up_axis", NO_ATTRIBUTES, "Y_UP" );
+		events.end( "asset" );
+		events.begin( "library_visual_scenes" );
+		events.begin( "visual_scene", VISUAL_SCENE_ATTRIBUTES );
+		for ( size_t i = 0; i < nodeCount; ++i )
+		{
+			events.begin( "node", NODE_ATTRIBUTES );
+			events.element( "translate", TRANSLATE_ATTRIBUTES, "0 1 2" );
+			events.element( "rotate", ROTATE_ATTRIBUTES, "0 0 1 90" );
+			events.element( "rotate", ROTATE_ATTRIBUTES, "0 1 0 45" );
+			events.element( "scale", NO_ATTRIBUTES, "1 1 1" );
+			events.begin( "instance_geometry", INSTANCE_GEOMETRY_ATTRIBUTES );
+			events.begin( "bind_material" );
+			events.begin( "technique_common" );
+			events.element( "instance_material", INSTANCE_MATERIAL_ATTRIBUTES, 0 );
+			events.end( "technique_common" );
+			events.end( "bind_material" );
+			events.end( "instance_geometry" );
+			events.end( "node" );
+		}
+		events.end( "visual_scene" );
+		events.end( "library_visual_scenes" );
+		events.begin( "scene" );
+		events.element( "instance_visual_scene", INSTANCE_VISUAL_SCENE_ATTRIBUTES, 0 );
+		events.end( "scene" );
+		events.end( "COLLADA" );
+	}
+
+	/** Passes @a events to @a parser. Returns false if the parser failed.*/
+	bool passEvents( GeneratedSaxParser::Parser& parser, const SaxEvents& events )
+	{
+		for ( size_t i = 0; i < events.size(); ++i )
+		{
+			const SaxEvent& event = events[i];
+			bool success = true;
+			switch ( event.type )
+			{
+			case SaxEvent::BEGIN:
+				success = parser.elementBegin( event.string, GeneratedSaxParser::ParserAttributes(event.attributes) );
+				break;
+			case SaxEvent::TEXT:
+				success = parser.textData( event.string, strlen(event.string) );
+				break;
+			case SaxEvent::END:
+				success = parser.elementEnd( event.string );
+				break;
+			}
+			if ( !success )
+				return false;
+		}
+		return true;
+	}
+
+	/** Counts the nodes reported by the generated parser, to check that all elements are dispatched.*/
+	class NodeCounter14 : public COLLADASaxFWL14::ColladaParserAutoGen14
+	{
+	public:
+		size_t nodeCount;
+
+		NodeCounter14() : nodeCount(0) {}
+
+		virtual bool begin__node( const COLLADASaxFWL14::node__AttributeData& attributeData ){ ++nodeCount; return true; }
+	};
+
+	/** Generated parser that records the generated hash of each element.*/
+	class RecordingParser14 : public COLLADASaxFWL14::ColladaParserAutoGen14Private
+	{
+	public:
+		std::vector<GeneratedSaxParser::StringHash> generatedHashes;
+
+		RecordingParser14( COLLADASaxFWL14::ColladaParserAutoGen14* impl ) : COLLADASaxFWL14::ColladaParserAutoGen14Private( impl ) {}
+
+	protected:
+		virtual bool findElementHash( ElementData& elementData )
+		{
+			bool found = COLLADASaxFWL14::ColladaParserAutoGen14Private::findElementHash( elementData );
+			generatedHashes.push_back( elementData.generatedElementHash );
+			return found;
+		}
+	};
+
+	typedef COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionTable ElementFunctionTable14;
+	typedef COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionEntry ElementFunctionEntry14;
+	typedef COLLADASaxFWL14::ColladaParserAutoGen14Private::ElementFunctionMap ElementFunctionMap14;
+
+	/** The function map as it was before the generated function table, filled when the parser was created.*/
+	typedef std::map<GeneratedSaxParser::StringHash, ElementFunctionEntry14> OrderedFunctionMap14;
+
+	void fillOrderedFunctionMap( const ElementFunctionTable14& table, OrderedFunctionMap14& orderedMap )
+	{
+		for ( size_t i = 0; i < table.getSlotCount(); ++i )
+		{
+			if ( table.entries[i].elementHash != 0 )
+				orderedMap[table.entries[i].elementHash] = table.entries[i];
+		}
+	}
+}
+
+
+void elementDispatchPerformanceTest( size_t nodeCount, int repetitions )
+{
+	SaxEvents events;
+	createVisualSceneEvents( nodeCount, events );
+	double totalTags = (double)events.tagCount() * repetitions / 1000000;
+
+	NodeCounter14 nodeCounter;
+	bool success = true;
+	double startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		COLLADASaxFWL14::ColladaParserAutoGen14Private parser( &nodeCounter );
+		success &= passEvents( parser, events );
+	}
+	double parseTime = getTime() - startTime;
+
+	NodeCounter14 recordingCounter;
+	RecordingParser14 recordingParser( &recordingCounter );
+	passEvents( recordingParser, events );
+	const std::vector<GeneratedSaxParser::StringHash>& hashes = recordingParser.generatedHashes;
+	const ElementFunctionMap14& functionMap = recordingParser.getCompleteElementFunctionMap();
+	const ElementFunctionTable14& table = *functionMap.getTable();
+
+	OrderedFunctionMap14 orderedMap;
+	fillOrderedFunctionMap( table, orderedMap );
+
+	size_t orderedFound = 0;
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		for ( size_t j = 0; j < hashes.size(); ++j )
+		{
+			OrderedFunctionMap14::const_iterator it = orderedMap.find( hashes[j] );
+			if ( it != orderedMap.end() && it->second.functions.beginFunction )
+				++orderedFound;
+		}
+	}
+	double orderedTime = getTime() - startTime;
+
+	size_t tableFound = 0;
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		for ( size_t j = 0; j < hashes.size(); ++j )
+		{
+			const ElementFunctionEntry14* entry = functionMap.find( hashes[j] );
+			if ( entry && entry->functions.beginFunction )
+				++tableFound;
+		}
+	}
+	double tableTime = getTime() - startTime;
+
+	const int constructionCount = repetitions * 10;
+	startTime = getTime();
+	for ( int i = 0; i < constructionCount; ++i )
+	{
+		OrderedFunctionMap14 filledMap;
+		fillOrderedFunctionMap( table, filledMap );
+	}
+	double fillTime = getTime() - startTime;
+
+	startTime = getTime();
+	for ( int i = 0; i < constructionCount; ++i )
+	{
+		COLLADASaxFWL14::ColladaParserAutoGen14Private parser( &nodeCounter );
+	}
+	double constructionTime = getTime() - startTime;
+
+	double totalLookups = (double)hashes.size() * repetitions / 1000000;
+	std::cout << "element dispatch: " << parseTime << " s, " << totalTags / parseTime << " M tags/s" << std::endl;
+	std::cout << "ordered function map:  " << orderedTime << " s, " << totalLookups / orderedTime << " M lookups/s" << std::endl;
+	std::cout << "perfect hash table:    " << tableTime << " s, " << totalLookups / tableTime << " M lookups/s" << std::endl;
+	std::cout << "filling ordered map:   " << fillTime * 1000000 / constructionCount << " us, "
+		<< "parser construction: " << constructionTime * 1000000 / constructionCount << " us, "
+		<< orderedMap.size() << " elements, " << table.getSlotCount() << " slots" << std::endl;
+	if ( !success || nodeCounter.nodeCount != nodeCount * repetitions )
+		std::cout << "not all elements dispatched" << std::endl;
+	if ( orderedFound != tableFound || orderedFound != hashes.size() * repetitions )
+		std::cout << "lookup results differ" << std::endl;
+}
+
+
+namespace
+{
+	/** Generated parser that converts list attribute values on its memory stack.*/
+	class ListParser14 : public COLLADASaxFWL14::ColladaParserAutoGen14Private
+	{
+	public:
+		ListParser14( COLLADASaxFWL14::ColladaParserAutoGen14* impl ) : COLLADASaxFWL14::ColladaParserAutoGen14Private( impl ) {}
+
+		/** Converts @a text to @a list, with the buffer reserved for all values up front.*/
+		bool toFloatList( const GeneratedSaxParser::ParserChar* text, GeneratedSaxParser::XSList<float>& list )
+		{
+			return characterData2FloatList( text, list );
+		}
+
+		/** Converts @a text to @a list, with a buffer that starts with one value and doubles each time 
+		it is full, as the list attributes were converted before.*/
+		bool toFloatListGrowing( const GeneratedSaxParser::ParserChar* text, GeneratedSaxParser::XSList<float>& list )
+		{
+			size_t bufferSize = sizeof(float);
+			float* typedBuffer = (float*)mStackMemoryManager.newObject( bufferSize );
+			size_t dataBufferIndex = 0;
+			const GeneratedSaxParser::ParserChar* dataBufferPos = text;
+			bool failed = false;
+			while ( typedBuffer )
+			{
+				float dataValue = GeneratedSaxParser::Utils::toFloat( &dataBufferPos, failed );
+				if ( failed )
+					break;
+				typedBuffer[dataBufferIndex] = dataValue;
+				++dataBufferIndex;
+				if ( (dataBufferIndex * sizeof(float)) == bufferSize )
+				{
+					typedBuffer = (float*)mStackMemoryManager.growObject( bufferSize );
+					bufferSize *= 2;
+				}
+			}
+			list.data = typedBuffer;
+			list.size = dataBufferIndex;
+			return typedBuffer != 0;
+		}
+
+		/** Removes the last converted list from the stack.*/
+		void deleteList()
+		{
+			mStackMemoryManager.deleteObject();
+		}
+	};
+
+	double sumList( const GeneratedSaxParser::XSList<float>& list )
+	{
+		double sum = 0;
+		for ( size_t i = 0; i < list.size; ++i )
+			sum += list.data[i];
+		return sum;
+	}
+}
+
+
+//--------------------------------------------------------------------
+void listConversionPerformanceTest( size_t valueCount, int repetitions )
+{
+	const char* values[] = { "0.5 ", "1.5 ", "2.5 ", "3.5 ", "4.5 ", "5.5 ", "6.5 ", "7.5 " };
+	std::string text;
+	text.reserve( valueCount * 4 );
+	for ( size_t i = 0; i < valueCount; ++i )
+		text.append( values[i % 8] );
+
+	NodeCounter14 nodeCounter;
+	ListParser14 parser( &nodeCounter );
+	GeneratedSaxParser::XSList<float> list;
+
+	bool growingSuccess = true;
+	size_t growingCount = 0;
+	double growingSum = 0;
+	double startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		growingSuccess &= parser.toFloatListGrowing( text.c_str(), list );
+		growingCount = list.size;
+		growingSum = sumList( list );
+		if ( list.data )
+			parser.deleteList();
+	}
+	double growingTime = getTime() - startTime;
+
+	bool reservedSuccess = true;
+	size_t reservedCount = 0;
+	double reservedSum = 0;
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		reservedSuccess &= parser.toFloatList( text.c_str(), list );
+		reservedCount = list.size;
+		reservedSum = sumList( list );
+		if ( list.data )
+			parser.deleteList();
+	}
+	double reservedTime = getTime() - startTime;
+
+	double totalValues = (double)valueCount * repetitions / 1000000;
+	std::cout << "list conversion, doubling buffer: " << growingTime << " s, " << totalValues / growingTime << " M values/s" << std::endl;
+	std::cout << "list conversion, reserved buffer: " << reservedTime << " s, " << totalValues / reservedTime << " M values/s" << std::endl;
+	if ( !growingSuccess || !reservedSuccess || growingCount != valueCount || reservedCount != valueCount )
+		std::cout << "not all values converted" << std::endl;
+	if ( growingSum != reservedSum )
+		std::cout << "converted values differ" << std::endl;
+}
+
+
+namespace
+{
+	/** The indices of a face corner, as the dae2ogre MeshWriter keyed its map before.*/
+	struct Tuple
+	{
+		unsigned int positionIndex;
+		unsigned int normalIndex;
+		unsigned int textureIndex;
+
+		bool operator<( const Tuple& rhs ) const
+		{
+			if ( positionIndex != rhs.positionIndex )
+				return positionIndex < rhs.positionIndex;
+			if ( normalIndex != rhs.normalIndex )
+				return normalIndex < rhs.normalIndex;
+			return textureIndex < rhs.textureIndex;
+		}
+	};
+
+	/** The position, normal and uv coordinate indices of a triangle mesh.*/
+	struct TriangleIndices
+	{
+		std::vector<unsigned int> positionIndices;
+		std::vector<unsigned int> normalIndices;
+		std::vector<unsigned int> uvIndices;
+	};
+
+	/** Creates a closed cylinder of @a triangleCount triangles in rows of quads. The positions are shared
+	by all adjacent corners, the normals are smooth except at two hard edges along the cylinder and the
+	uv coordinates have a seam, where the rows are closed.*/
+	void createCylinder( size_t triangleCount, TriangleIndices& mesh )
+	{
+		const unsigned int columnCount = 1000;
+		unsigned int rowCount = (unsigned int)(triangleCount / (2 * columnCount));
+		if ( rowCount == 0 )
+			rowCount = 1;
+
+		for ( unsigned int row = 0; row < rowCount; ++row )
+		{
+			for ( unsigned int column = 0; column < columnCount; ++column )
+			{
+				unsigned int corners[4][2] = { {row, column}, {row, column + 1}, {row + 1, column + 1}, {row + 1, column} };
+				const int triangles[6] = { 0, 1, 2, 0, 2, 3 };
+				for ( int i = 0; i < 6; ++i )
+				{
+					unsigned int cornerRow = corners[triangles[i]][0];
+					unsigned int cornerColumn = corners[triangles[i]][1];
+					unsigned int positionColumn = cornerColumn % columnCount;
+					unsigned int position = cornerRow * columnCount + positionColumn;
+
+					// the corners at the hard edges get the normal of their face
+					unsigned int normal = position;
+					bool hardEdge = (positionColumn == 0) || (positionColumn == columnCount / 2);
+					if ( hardEdge && (cornerColumn != column) )
+						normal = rowCount * columnCount + cornerRow * 2 + (positionColumn == 0 ? 0 : 1);
+
+					mesh.positionIndices.push_back( position );
+					mesh.normalIndices.push_back( normal );
+					mesh.uvIndices.push_back( cornerRow * (columnCount + 1) + cornerColumn );
+				}
+			}
+		}
+	}
+
+	/** Welds the corners of @a mesh with an ordered map, as the dae2ogre MeshWriter did before.*/
+	double weldWithMap( const TriangleIndices& mesh, int repetitions, std::vector<unsigned int>& vertexIndices, size_t& vertexCount )
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			std::map<Tuple, unsigned int> tupleMap;
+			vertexIndices.clear();
+			for ( size_t j = 0; j < mesh.positionIndices.size(); ++j )
+			{
+				Tuple tuple = { mesh.positionIndices[j], mesh.normalIndices[j], mesh.uvIndices[j] };
+				std::map<Tuple, unsigned int>::const_iterator it = tupleMap.find( tuple );
+				if ( it == tupleMap.end() )
+				{
+					unsigned int vertexIndex = (unsigned int)tupleMap.size();
+					tupleMap[tuple] = vertexIndex;
+					vertexIndices.push_back( vertexIndex );
+				}
+				else
+				{
+					vertexIndices.push_back( it->second );
+				}
+			}
+			vertexCount = tupleMap.size();
+		}
+		return getTime() - startTime;
+	}
+
+	/** Welds the corners of @a mesh with the VertexWelder.*/
+	double weldWithWelder( const TriangleIndices& mesh, int repetitions, std::vector<unsigned int>& vertexIndices, size_t& vertexCount )
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			COLLADAFW::VertexWelder welder( 3 );
+			const unsigned int* indexLists[3] = { &mesh.positionIndices[0], &mesh.normalIndices[0], &mesh.uvIndices[0] };
+			vertexIndices.resize( mesh.positionIndices.size() );
+			welder.addVertices( indexLists, mesh.positionIndices.size(), &vertexIndices[0] );
+			vertexCount = welder.getVertexCount();
+		}
+		return getTime() - startTime;
+	}
+}
+
+
+//--------------------------------------------------------------------
+void vertexWeldingPerformanceTest( size_t triangleCount, int repetitions )
+{
+	TriangleIndices mesh;
+	createCylinder( triangleCount, mesh );
+
+	std::vector<unsigned int> mapIndices;
+	size_t mapVertexCount = 0;
+	double mapTime = weldWithMap( mesh, repetitions, mapIndices, mapVertexCount );
+
+	std::vector<unsigned int> welderIndices;
+	size_t welderVertexCount = 0;
+	double welderTime = weldWithWelder( mesh, repetitions, welderIndices, welderVertexCount );
+
+	double totalCorners = (double)mesh.positionIndices.size() * repetitions / 1000000;
+	std::cout << "vertex welding, ordered map:  " << mapTime << " s, " << totalCorners / mapTime << " M corners/s" << std::endl;
+	std::cout << "vertex welding, vertex welder: " << welderTime << " s, " << totalCorners / welderTime << " M corners/s" << std::endl;
+	if ( (mapVertexCount != welderVertexCount) || (mapIndices != welderIndices) )
+		std::cout << "welded vertices differ" << std::endl;
+}
+
+
+namespace
+{
+	/** Number of children of each node of the synthetic scene.*/
+	const size_t CHILDREN_PER_NODE = 4;
+
+	/** Number of root nodes of the synthetic scene.*/
+	const size_t ROOT_NODE_COUNT = 16;
+
+	/** Creates @a nodeCount nodes with random transformations below @a rootNodes. The nodes are added
+	level by level, each node gets CHILDREN_PER_NODE children. Most nodes have a translation, three
+	rotations and a scale, as exported by dcc tools, every tenth node has a matrix.*/
+	void createNodeHierarchy( size_t nodeCount, COLLADAFW::NodePointerArray& rootNodes )
+	{
+		std::vector<COLLADAFW::Node*> nodes;
+		nodes.reserve( nodeCount );
+		for ( size_t i = 0; i < nodeCount; ++i )
+		{
+			COLLADAFW::Node* node = new COLLADAFW::Node( COLLADAFW::UniqueId( COLLADAFW::COLLADA_TYPE::NODE, (COLLADAFW::ObjectId)i, 0 ) );
+			COLLADAFW::TransformationPointerArray& transformations = node->getTransformations();
+			double r = (double)rand() / RAND_MAX;
+			if ( i % 10 == 9 )
+			{
+				transformations.append( new COLLADAFW::Matrix( COLLADABU::Math::Matrix4( 0, -1, 0, r, 1, 0, 0, 2, 0, 0, 1, 3 * r, 0, 0, 0, 1 ) ) );
+			}
+			else
+			{
+				transformations.append( new COLLADAFW::Translate( r, 2 * r, -r ) );
+				transformations.append( new COLLADAFW::Rotate( 0, 0, 1, 90 * r ) );
+				transformations.append( new COLLADAFW::Rotate( 0, 1, 0, -45 * r ) );
+				transformations.append( new COLLADAFW::Rotate( 1, 0, 0, 30 ) );
+				transformations.append( new COLLADAFW::Scale( 1, 1 + r * 0.01, 1 ) );
+			}
+
+			if ( i < ROOT_NODE_COUNT )
+				rootNodes.append( node );
+			else
+				nodes[(i - ROOT_NODE_COUNT) / CHILDREN_PER_NODE]->getChildNodes().append( node );
+			nodes.push_back( node );
+		}
+	}
+
+	/** Calculates the world matrices recursively, as the converters do, and appends them in depth first order.*/
+	void calculateWorldMatricesRecursively( const COLLADAFW::NodePointerArray& nodes, const COLLADABU::Math::Matrix4& parentWorldMatrix, std::vector<COLLADABU::Math::Matrix4>& worldMatrices )
+	{
+		for ( size_t i = 0, count = nodes.getCount(); i < count; ++i )
+		{
+			const COLLADAFW::Node* node = nodes[i];
+			COLLADABU::Math::Matrix4 worldMatrix = parentWorldMatrix * node->getTransformationMatrix();
+			worldMatrices.push_back( worldMatrix );
+			calculateWorldMatricesRecursively( node->getChildNodes(), worldMatrix, worldMatrices );
+		}
+	}
+
+	/** Appends the indices of the nodes of @a flatHierarchy in depth first order to @a nodeIndices.*/
+	void collectDepthFirstIndices( const COLLADAFW::FlatNodeHierarchy& flatHierarchy, std::vector<size_t>& nodeIndices )
+	{
+		std::map<const COLLADAFW::Node*, size_t> nodeIndexMap;
+		for ( size_t i = 0; i < flatHierarchy.getNodeCount(); ++i )
+			nodeIndexMap[flatHierarchy.getNode(i)] = i;
+
+		std::vector<const COLLADAFW::Node*> stack;
+		for ( size_t i = flatHierarchy.getLevelOffset(1); i > 0; --i )
+			stack.push_back( flatHierarchy.getNode(i - 1) );
+		while ( !stack.empty() )
+		{
+			const COLLADAFW::Node* node = stack.back();
+			stack.pop_back();
+			nodeIndices.push_back( nodeIndexMap[node] );
+			const COLLADAFW::NodePointerArray& childNodes = node->getChildNodes();
+			for ( size_t i = childNodes.getCount(); i > 0; --i )
+				stack.push_back( childNodes[i - 1] );
+		}
+	}
+}
+
+
+//--------------------------------------------------------------------
+void nodeHierarchyPerformanceTest( size_t nodeCount, int repetitions )
+{
+	COLLADAFW::NodePointerArray rootNodes;
+	createNodeHierarchy( nodeCount, rootNodes );
+
+	std::vector<COLLADABU::Math::Matrix4> recursiveMatrices;
+	double startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		recursiveMatrices.clear();
+		calculateWorldMatricesRecursively( rootNodes, COLLADABU::Math::Matrix4::IDENTITY, recursiveMatrices );
+	}
+	double recursiveTime = getTime() - startTime;
+
+	COLLADAFW::FlatNodeHierarchy flatHierarchy;
+	startTime = getTime();
+	flatHierarchy.build( rootNodes );
+	double buildTime = getTime() - startTime;
+
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+		flatHierarchy.calculateMatrices();
+	double flatTime = getTime() - startTime;
+
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+		flatHierarchy.calculateWorldMatrices();
+	double worldTime = getTime() - startTime;
+
+	double totalNodes = (double)nodeCount * repetitions / 1000000;
+	std::cout << "world matrices, recursive:         " << recursiveTime << " s, " << totalNodes / recursiveTime << " M nodes/s" << std::endl;
+	std::cout << "world matrices, flat hierarchy:    " << flatTime << " s, " << totalNodes / flatTime << " M nodes/s (build " << buildTime << " s)" << std::endl;
+	std::cout << "world matrices, flat, world only:  " << worldTime << " s, " << totalNodes / worldTime << " M nodes/s" << std::endl;
+
+	std::vector<size_t> nodeIndices;
+	collectDepthFirstIndices( flatHierarchy, nodeIndices );
+	double maxDifference = (nodeIndices.size() == recursiveMatrices.size()) ? 0 : 1;
+	for ( size_t i = 0; (i < nodeIndices.size()) && (i < recursiveMatrices.size()); ++i )
+	{
+		COLLADABU::Math::Matrix4 flatMatrix;
+		flatHierarchy.getWorldMatrix( nodeIndices[i], flatMatrix );
+		for ( int row = 0; row < 4; ++row )
+			for ( int column = 0; column < 4; ++column )
+				maxDifference = std::max( maxDifference, fabs( flatMatrix.getElement(row, column) - recursiveMatrices[i].getElement(row, column) ) );
+	}
+	if ( maxDifference > 1e-9 )
+		std::cout << "world matrices differ by " << maxDifference << std::endl;
+}
+
+
+namespace
+{
+	/** Unknown element handler, that only looks at the byte ranges of the outermost elements, like an
+	extra data callback that needs the text of few of them.*/
+	class RangeCountingHandler : public GeneratedSaxParser::IUnknownElementHandler
+	{
+	public:
+		size_t elementCount;
+		size_t byteCount;
+
+		RangeCountingHandler() : elementCount(0), byteCount(0) {}
+
+		virtual bool elementBegin( const GeneratedSaxParser::ParserChar* elementName, const GeneratedSaxParser::xmlChar** attributes ) { ++elementCount; return true; }
+		virtual bool elementEnd( const GeneratedSaxParser::ParserChar* elementName ) { return true; }
+		virtual bool textData( const GeneratedSaxParser::ParserChar* text, size_t textLength ) { byteCount += textLength; return true; }
+		virtual bool captureElementRanges() { return true; }
+
+		virtual bool elementRange( const GeneratedSaxParser::ParserChar* elementName, size_t offset, size_t length, const GeneratedSaxParser::ParserChar* bytes )
+		{
+			++elementCount;
+			byteCount += length;
+			return true;
+		}
+	};
+
+	/** Writes a document with a visual scene with @a nodeCount nodes to @a document. Each node has an
+	extra technique with nested elements, like the ones exporters write for each node.*/
+	void createExtraDocument( size_t nodeCount, std::string& document )
+	{
+		std::ostringstream stream;
+		stream << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+			<< "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+			<< "<library_visual_scenes><visual_scene id=\"scene\">\n";
+		for ( size_t i = 0; i < nodeCount; ++i )
+		{
+			stream << "<node id=\"node" << i << "\"><translate>0 1 2</translate><extra><technique profile=\"MAYA\">"
+				<< "<originalMayaNodeId>node" << i << "</originalMayaNodeId><double_sided>1</double_sided>"
+				<< "<dynamic_attributes>";
+			for ( size_t j = 0; j < 8; ++j )
+			{
+				stream << "<attribute" << j << " short_name=\"a" << j << "\" type=\"float3\">"
+					<< "<value>" << i << " " << j << " 0.5</value><keyable>1</keyable><hidden/></attribute" << j << ">";
+			}
+			stream << "</dynamic_attributes></technique></extra></node>\n";
+		}
+		stream << "</visual_scene></library_visual_scenes>\n"
+			<< "<scene><instance_visual_scene url=\"#scene\"/></scene>\n"
+			<< "</COLLADA>\n";
+		document = stream.str();
+	}
+
+	/** Parses @a document @a repetitions times with the generated parser and passes the unknown elements
+	to @a handler. Returns the time it took.*/
+	double parseExtras( const std::string& document, GeneratedSaxParser::IUnknownElementHandler& handler, int repetitions, bool& success )
+	{
+		NodeCounter14 nodeCounter;
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			COLLADASaxFWL14::ColladaParserAutoGen14Private parser( &nodeCounter );
+			parser.registerUnknownElementHandler( &handler );
+			GeneratedSaxParser::LibxmlSaxParser saxParser( &parser );
+			success &= saxParser.parseBuffer( "extraCapturePerformanceTest", document.c_str(), (int)document.size() );
+		}
+		return getTime() - startTime;
+	}
+}
+
+
+//--------------------------------------------------------------------
+void extraCapturePerformanceTest( size_t nodeCount, int repetitions )
+{
+	std::string document;
+	createExtraDocument( nodeCount, document );
+	double totalBytes = (double)document.size() * repetitions / (1024*1024);
+
+	bool success = true;
+	GeneratedSaxParser::RawUnknownElementHandler serializingHandler;
+	double serializingTime = parseExtras( document, serializingHandler, repetitions, success );
+	std::string serializedData = serializingHandler.getRawData();
+
+	GeneratedSaxParser::RawUnknownElementHandler capturingHandler;
+	capturingHandler.setCaptureElementRanges( true );
+	double capturingTime = parseExtras( document, capturingHandler, repetitions, success );
+
+	RangeCountingHandler countingHandler;
+	double countingTime = parseExtras( document, countingHandler, repetitions, success );
+
+	std::cout << "extras serialized from events: " << serializingTime << " s, " << totalBytes / serializingTime << " MB/s" << std::endl;
+	std::cout << "extras copied from byte ranges: " << capturingTime << " s, " << totalBytes / capturingTime << " MB/s" << std::endl;
+	std::cout << "extras as byte ranges only:     " << countingTime << " s, " << totalBytes / countingTime << " MB/s, "
+		<< countingHandler.byteCount / repetitions << " bytes of extras" << std::endl;
+	if ( !success || (serializedData != capturingHandler.getRawData()) || (capturingHandler.getElementRanges().size() != countingHandler.elementCount) )
+		std::cout << "extra data differs" << std::endl;
+}
+
+
+namespace
+{
+	/** Number of polylists the synthetic grid is split into.*/
+	const size_t GRID_PRIMITIVE_COUNT = 8;
+
+	/** Creates a grid of about @a quadCount quads, that share their vertices, split into
+	GRID_PRIMITIVE_COUNT polylists of consecutive rows.*/
+	void createQuadGrid( size_t quadCount, COLLADAFW::Mesh& mesh )
+	{
+		const unsigned int columnCount = 1000;
+		unsigned int rowCount = (unsigned int)(quadCount / columnCount);
+		if ( rowCount < GRID_PRIMITIVE_COUNT )
+			rowCount = GRID_PRIMITIVE_COUNT;
+
+		unsigned int rowsPerPrimitive = rowCount / GRID_PRIMITIVE_COUNT;
+		for ( size_t i = 0; i < GRID_PRIMITIVE_COUNT; ++i )
+		{
+			COLLADAFW::Polylist* polylist = new COLLADAFW::Polylist( COLLADAFW::UniqueId( COLLADAFW::COLLADA_TYPE::POLYLIST, (COLLADAFW::ObjectId)i, 0 ) );
+			COLLADAFW::Polylist::VertexCountArray& vertexCounts = polylist->getGroupedVerticesVertexCountArray();
+			COLLADAFW::UIntValuesArray& positionIndices = polylist->getPositionIndices();
+			vertexCounts.reallocMemory( rowsPerPrimitive * columnCount );
+			positionIndices.reallocMemory( 4 * rowsPerPrimitive * columnCount );
+			for ( unsigned int row = (unsigned int)i * rowsPerPrimitive; row < (i + 1) * rowsPerPrimitive; ++row )
+			{
+				for ( unsigned int column = 0; column < columnCount; ++column )
+				{
+					unsigned int position = row * (columnCount + 1) + column;
+					unsigned int quad[4] = { position, position + 1, position + columnCount + 2, position + columnCount + 1 };
+					vertexCounts.append( 4 );
+					positionIndices.appendValues( quad, 4 );
+				}
+			}
+			polylist->setFaceCount( vertexCounts.getCount() );
+			mesh.getMeshPrimitives().append( polylist );
+		}
+	}
+
+	/** Numbers the edges of the polylists of @a mesh with a hash map, as the dae2ma GeometryImporter
+	did before, and writes the signed edge index of each face edge to @a faceEdgeIndices.*/
+	double buildEdgesWithMap( const COLLADAFW::Mesh& mesh, int repetitions, std::vector<int>& faceEdgeIndices, size_t& edgeCount )
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			std::unordered_map<unsigned long long, unsigned int> edgeMap;
+			faceEdgeIndices.clear();
+			const COLLADAFW::MeshPrimitiveArray& primitives = mesh.getMeshPrimitives();
+			for ( size_t j = 0; j < primitives.getCount(); ++j )
+			{
+				const COLLADAFW::MeshPrimitive* primitive = primitives[j];
+				const COLLADAFW::UIntValuesArray& positionIndices = primitive->getPositionIndices();
+				size_t positionIndex = 0;
+				for ( size_t face = 0; face < primitive->getGroupedVertexElementsCount(); ++face )
+				{
+					int vertexCount = primitive->getGroupedVerticesVertexCount( face );
+					for ( int k = 0; k < vertexCount; ++k )
+					{
+						unsigned int start = positionIndices[positionIndex + k];
+						unsigned int end = positionIndices[positionIndex + (k + 1) % vertexCount];
+						unsigned long long key = ((unsigned long long)std::min(start, end) << 32) | std::max(start, end);
+						unsigned int edgeIndex = (unsigned int)edgeMap.size();
+						edgeIndex = edgeMap.insert( std::make_pair(key, edgeIndex) ).first->second;
+						faceEdgeIndices.push_back( (start < end) ? (int)edgeIndex : -((int)edgeIndex + 1) );
+					}
+					positionIndex += vertexCount;
+				}
+			}
+			edgeCount = edgeMap.size();
+		}
+		return getTime() - startTime;
+	}
+
+	/** Numbers the edges of @a mesh with the EdgeBuilder using @a threadCount threads.*/
+	double buildEdgesWithBuilder( const COLLADAFW::Mesh& mesh, int repetitions, size_t threadCount, std::vector<int>& faceEdgeIndices, size_t& edgeCount )
+	{
+		COLLADAFW::EdgeBuilder edgeBuilder;
+		edgeBuilder.setThreadCount( threadCount );
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+			edgeBuilder.build( &mesh );
+		double time = getTime() - startTime;
+
+		faceEdgeIndices.clear();
+		for ( size_t j = 0; j < mesh.getMeshPrimitives().getCount(); ++j )
+		{
+			const int* indices = edgeBuilder.getFaceEdgeIndices( j );
+			faceEdgeIndices.insert( faceEdgeIndices.end(), indices, indices + edgeBuilder.getFaceEdgeCount(j) );
+		}
+		edgeCount = edgeBuilder.getEdges().size();
+		return time;
+	}
+}
+
+
+//--------------------------------------------------------------------
+void edgeBuildingPerformanceTest( size_t quadCount, int repetitions )
+{
+	COLLADAFW::Mesh mesh( COLLADAFW::UniqueId( COLLADAFW::COLLADA_TYPE::MESH, 0, 0 ) );
+	createQuadGrid( quadCount, mesh );
+
+	std::vector<int> mapIndices;
+	size_t mapEdgeCount = 0;
+	double mapTime = buildEdgesWithMap( mesh, repetitions, mapIndices, mapEdgeCount );
+
+	std::vector<int> builderIndices;
+	size_t builderEdgeCount = 0;
+	double builderTime = buildEdgesWithBuilder( mesh, repetitions, 1, builderIndices, builderEdgeCount );
+
+	size_t threadCount = std::max( std::thread::hardware_concurrency(), 1u );
+	std::vector<int> threadedIndices;
+	size_t threadedEdgeCount = 0;
+	double threadedTime = buildEdgesWithBuilder( mesh, repetitions, threadCount, threadedIndices, threadedEdgeCount );
+
+	double totalFaceEdges = (double)mapIndices.size() * repetitions / 1000000;
+	std::cout << "edge building, hash map:           " << mapTime << " s, " << totalFaceEdges / mapTime << " M face edges/s" << std::endl;
+	std::cout << "edge building, edge builder:       " << builderTime << " s, " << totalFaceEdges / builderTime << " M face edges/s" << std::endl;
+	std::cout << "edge building, edge builder, " << threadCount << " threads: " << threadedTime << " s, " << totalFaceEdges / threadedTime << " M face edges/s" << std::endl;
+	if ( (mapEdgeCount != builderEdgeCount) || (mapIndices != builderIndices) || (builderEdgeCount != threadedEdgeCount) || (builderIndices != threadedIndices) )
+		std::cout << "edges differ" << std::endl;
+}
+
+
+namespace
+{
+	/** Collects the embedded data of the images reported by the generated parser, like the library images
+	loader does for streamed documents.*/
+	class ImageDataCollector14 : public COLLADASaxFWL14::ColladaParserAutoGen14
+	{
+	public:
+		std::vector<COLLADAFW::HexBinaryData> imageData;
+
+		virtual bool begin__data(){ imageData.push_back( COLLADAFW::HexBinaryData() ); return true; }
+		virtual bool data__data( const GeneratedSaxParser::ParserChar* value, size_t length ){ imageData.back().appendText( value, length ); return true; }
+	};
+
+	/** Writes a document with @a imageCount images to @a document, each with @a byteCount random bytes of
+	embedded data, written as lines of 32 hexadecimal octets.*/
+	void createImageDocument( size_t imageCount, size_t byteCount, std::string& document )
+	{
+		static const char HEX_DIGITS[] = "0123456789ABCDEF";
+		std::string text;
+		text.reserve( imageCount * byteCount * 2 + imageCount * 200 );
+		text += "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+			"<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+			"<library_images>\n";
+		srand( 1 );
+		for ( size_t i = 0; i < imageCount; ++i )
+		{
+			std::ostringstream id;
+			id << "image" << i;
+			text += "<image id=\"" + id.str() + "\" format=\"PNG\"><data>\n";
+			for ( size_t j = 0; j < byteCount; ++j )
+			{
+				unsigned char byte = (unsigned char)rand();
+				text += HEX_DIGITS[byte >> 4];
+				text += HEX_DIGITS[byte & 0xF];
+				if ( (j % 32 == 31) || (j + 1 == byteCount) )
+					text += '\n';
+			}
+			text += "</data></image>\n";
+		}
+		text += "</library_images>\n</COLLADA>\n";
+		document.swap( text );
+	}
+
+	/** Decodes @a length characters of hexadecimal octets at @a text one character at a time, the way
+	the data would be decoded without COLLADAFW::HexBinaryData. Returns the number of bytes.*/
+	size_t decodeHexScalar( const char* text, size_t length, unsigned char* bytes )
+	{
+		size_t byteCount = 0;
+		int high = -1;
+		for ( size_t i = 0; i < length; ++i )
+		{
+			char c = text[i];
+			int value;
+			if ( (c >= '0') && (c <= '9') )
+				value = c - '0';
+			else if ( (c >= 'a') && (c <= 'f') )
+				value = c - 'a' + 10;
+			else if ( (c >= 'A') && (c <= 'F') )
+				value = c - 'A' + 10;
+			else
+				continue;
+			if ( high < 0 )
+			{
+				high = value;
+			}
+			else
+			{
+				bytes[byteCount++] = (unsigned char)((high << 4) | value);
+				high = -1;
+			}
+		}
+		return byteCount;
+	}
+}
+
+
+//--------------------------------------------------------------------
+void imageDataPerformanceTest( size_t imageCount, size_t byteCount, int repetitions )
+{
+	std::string document;
+	createImageDocument( imageCount, byteCount, document );
+	double totalDocumentBytes = (double)document.size() * repetitions / (1024*1024);
+
+	bool success = true;
+	ImageDataCollector14 collector;
+	double parsingTime = 0;
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			collector.imageData.clear();
+			COLLADASaxFWL14::ColladaParserAutoGen14Private parser( &collector );
+			GeneratedSaxParser::LibxmlSaxParser saxParser( &parser );
+			success &= saxParser.parseBuffer( "imageDataPerformanceTest", document.c_str(), (int)document.size() );
+		}
+		parsingTime = getTime() - startTime;
+	}
+	success &= (collector.imageData.size() == imageCount);
+
+	size_t textLength = 0;
+	for ( size_t i = 0; i < collector.imageData.size(); ++i )
+		textLength += collector.imageData[i].getTextLength();
+	double totalTextBytes = (double)textLength * repetitions / (1024*1024);
+
+	std::vector<unsigned char> scalarBytes( byteCount );
+	double scalarTime = 0;
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			for ( size_t j = 0; j < collector.imageData.size(); ++j )
+			{
+				const COLLADAFW::HexBinaryData& data = collector.imageData[j];
+				scalarBytes.resize( data.getMaxDecodedSize() );
+				scalarBytes.resize( decodeHexScalar( data.getText(), data.getTextLength(), &scalarBytes[0] ) );
+			}
+		}
+		scalarTime = getTime() - startTime;
+	}
+
+	std::vector<unsigned char> decodedBytes;
+	double decodingTime = 0;
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			for ( size_t j = 0; j < collector.imageData.size(); ++j )
+				success &= collector.imageData[j].decode( decodedBytes );
+		}
+		decodingTime = getTime() - startTime;
+	}
+
+	std::cout << "image data parsed as text:           " << parsingTime << " s, " << totalDocumentBytes / parsingTime << " MB/s" << std::endl;
+	std::cout << "image data decoded per character:    " << scalarTime << " s, " << totalTextBytes / scalarTime << " MB/s" << std::endl;
+	std::cout << "image data decoded by HexBinaryData: " << decodingTime << " s, " << totalTextBytes / decodingTime << " MB/s" << std::endl;
+	if ( !success || (decodedBytes.size() != byteCount) || (decodedBytes != scalarBytes) )
+		std::cout << "image data differs" << std::endl;
+}
+
+
+namespace
+{
+	/** Number of calls of the global operator new, counted by the replacements below.*/
+	std::atomic<size_t> heapAllocationCount( 0 );
+}
+
+/** Replaces the global operator new, to count the heap allocations made while loading a document. The
+memory of arrays is allocated using malloc and not counted.*/
+void* operator new( size_t size )
+{
+	++heapAllocationCount;
+	void* data = malloc( size > 0 ? size : 1 );
+	if ( !data )
+		throw std::bad_alloc();
+	return data;
+}
+
+void operator delete( void* data ) noexcept
+{
+	free( data );
+}
+
+
+namespace
+{
+	/** Writer that only counts the geometries and the nodes of the visual scenes passed by the loader.*/
+	class CountingWriter : public COLLADAFW::IWriter
+	{
+	public:
+		size_t geometryCount;
+		size_t nodeCount;
+
+		CountingWriter() : geometryCount(0), nodeCount(0) {}
+
+		void reset(){ geometryCount = 0; nodeCount = 0; }
+
+		virtual void cancel( const COLLADAFW::String& errorMessage ){}
+		virtual void start(){}
+		virtual void finish(){}
+		virtual bool writeGlobalAsset( const COLLADAFW::FileInfo* asset ){ return true; }
+		virtual bool writeScene( const COLLADAFW::Scene* scene ){ return true; }
+		virtual bool writeVisualScene( const COLLADAFW::VisualScene* visualScene ){ nodeCount += visualScene->getRootNodes().getCount(); return true; }
+		virtual bool writeLibraryNodes( const COLLADAFW::LibraryNodes* libraryNodes ){ return true; }
+		virtual bool writeGeometry( const COLLADAFW::Geometry* geometry ){ ++geometryCount; return true; }
+		virtual bool writeMaterial( const COLLADAFW::Material* material ){ return true; }
+		virtual bool writeEffect( const COLLADAFW::Effect* effect ){ return true; }
+		virtual bool writeCamera( const COLLADAFW::Camera* camera ){ return true; }
+		virtual bool writeImage( const COLLADAFW::Image* image ){ return true; }
+		virtual bool writeLight( const COLLADAFW::Light* light ){ return true; }
+		virtual bool writeAnimation( const COLLADAFW::Animation* animation ){ return true; }
+		virtual bool writeAnimationList( const COLLADAFW::AnimationList* animationList ){ return true; }
+		virtual bool writeSkinControllerData( const COLLADAFW::SkinControllerData* skinControllerData ){ return true; }
+		virtual bool writeController( const COLLADAFW::Controller* controller ){ return true; }
+		virtual bool writeFormulas( const COLLADAFW::Formulas* formulas ){ return true; }
+		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ){ return true; }
+	};
+
+	/** Writes a document with @a nodeCount nodes to @a document. Each node has a translation and a rotation
+	and instantiates its own cube mesh with positions and normals.*/
+	void createSceneDocument( size_t nodeCount, std::string& document )
+	{
+		static const char CUBE_POSITIONS[] = "-1 -1 -1 1 -1 -1 -1 1 -1 1 1 -1 -1 -1 1 1 -1 1 -1 1 1 1 1 1";
+		static const char CUBE_NORMALS[] = "0 0 -1 0 0 1 0 -1 0 0 1 0 -1 0 0 1 0 0";
+		static const char CUBE_INDICES[] = "0 0 2 0 1 0 1 0 2 0 3 0 4 1 5 1 6 1 5 1 7 1 6 1 0 2 1 2 4 2 1 2 5 2 4 2 "
+			"2 3 6 3 3 3 3 3 6 3 7 3 0 4 4 4 2 4 2 4 4 4 6 4 1 5 3 5 5 5 3 5 7 5 5 5";
+
+		std::ostringstream text;
+		text << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+			"<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+			"<library_geometries>\n";
+		for ( size_t i = 0; i < nodeCount; ++i )
+		{
+			text << "<geometry id=\"geometry" << i << "\"><mesh>\n"
+				"<source id=\"positions" << i << "\"><float_array id=\"positions" << i << "-array\" count=\"24\">" << CUBE_POSITIONS << "</float_array>"
+				"<technique_common><accessor source=\"#positions" << i << "-array\" count=\"8\" stride=\"3\">"
+				"<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/></accessor></technique_common></source>\n"
+				"<source id=\"normals" << i << "\"><float_array id=\"normals" << i << "-array\" count=\"18\">" << CUBE_NORMALS << "</float_array>"
+				"<technique_common><accessor source=\"#normals" << i << "-array\" count=\"6\" stride=\"3\">"
+				"<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/></accessor></technique_common></source>\n"
+				"<vertices id=\"vertices" << i << "\"><input semantic=\"POSITION\" source=\"#positions" << i << "\"/></vertices>\n"
+				"<triangles count=\"12\"><input semantic=\"VERTEX\" source=\"#vertices" << i << "\" offset=\"0\"/>"
+				"<input semantic=\"NORMAL\" source=\"#normals" << i << "\" offset=\"1\"/><p>" << CUBE_INDICES << "</p></triangles>\n"
+				"</mesh></geometry>\n";
+		}
+		text << "</library_geometries>\n"
+			"<library_visual_scenes><visual_scene id=\"scene\">\n";
+		for ( size_t i = 0; i < nodeCount; ++i )
+		{
+			text << "<node id=\"node" << i << "\"><translate>" << i % 100 << " " << i / 100 << " 0</translate>"
+				"<rotate>0 0 1 " << i % 360 << "</rotate><instance_geometry url=\"#geometry" << i << "\"/></node>\n";
+		}
+		text << "</visual_scene></library_visual_scenes>\n"
+			"<scene><instance_visual_scene url=\"#scene\"/></scene>\n"
+			"</COLLADA>\n";
+		document = text.str();
+	}
+
+	/** Loads @a document @a repetitions times with a new loader each time, with or without arena, and 
+	returns the time. The heap allocations and the arena counters of the last load are stored in 
+	@a heapAllocations and @a statistics.*/
+	double loadScene( const std::string& document, bool useArena, int repetitions, CountingWriter& writer, size_t& heapAllocations, COLLADAFW::Arena::Statistics& statistics )
+	{
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			writer.reset();
+			COLLADASaxFWL::Loader loader;
+			loader.setUseArena( useArena );
+			COLLADAFW::Root root( &loader, &writer );
+			size_t heapAllocationsBefore = heapAllocationCount;
+			if ( !root.loadDocument( "arenaPerformanceTest.dae", document.c_str(), (int)document.size() ) )
+				writer.geometryCount = 0;
+			heapAllocations = heapAllocationCount - heapAllocationsBefore;
+			statistics = loader.getArenaStatistics();
+		}
+		return getTime() - startTime;
+	}
+}
+
+
+//--------------------------------------------------------------------
+void arenaPerformanceTest( size_t nodeCount, int repetitions )
+{
+	std::string document;
+	createSceneDocument( nodeCount, document );
+	double totalDocumentBytes = (double)document.size() * repetitions / (1024*1024);
+
+	CountingWriter heapWriter;
+	size_t heapAllocations = 0;
+	COLLADAFW::Arena::Statistics heapStatistics;
+	double heapTime = loadScene( document, false, repetitions, heapWriter, heapAllocations, heapStatistics );
+
+	CountingWriter arenaWriter;
+	size_t arenaHeapAllocations = 0;
+	COLLADAFW::Arena::Statistics arenaStatistics;
+	double arenaTime = loadScene( document, true, repetitions, arenaWriter, arenaHeapAllocations, arenaStatistics );
+
+	const double MB = 1024*1024;
+	std::cout << "scene loaded from the heap: " << heapTime << " s, " << totalDocumentBytes / heapTime << " MB/s, " 
+		<< heapAllocations << " heap allocations" << std::endl;
+	std::cout << "scene loaded with arena:    " << arenaTime << " s, " << totalDocumentBytes / arenaTime << " MB/s, " 
+		<< arenaHeapAllocations << " heap allocations" << std::endl;
+	std::cout << "arena: " << arenaStatistics.allocationCount << " allocations, " << arenaStatistics.reallocationCount << " reallocations, "
+		<< arenaStatistics.allocatedBytes / MB << " MB allocated, " << arenaStatistics.abandonedBytes / MB << " MB abandoned, "
+		<< arenaStatistics.blockCount << " blocks, " << arenaStatistics.reservedBytes / MB << " MB reserved" << std::endl;
+	if ( (heapWriter.geometryCount != nodeCount) || (heapWriter.nodeCount != nodeCount) 
+		|| (arenaWriter.geometryCount != nodeCount) || (arenaWriter.nodeCount != nodeCount) )
+		std::cout << "loaded scenes differ" << std::endl;
+}
@@ -33,7 +33,7 @@ namespace COLLADABU
 
 namespace Common
 {
-	class FWriteBufferFlusher;
+	class IBufferFlusher;
 	class CharacterBuffer;
 }
 
@@ -111,7 +111,7 @@ namespace COLLADASW
 		typedef std::deque<OpenTag> OpenTagStack;
 
     private:
-		Common::FWriteBufferFlusher* mBufferFlusher;
+		Common::IBufferFlusher* mBufferFlusher;
 
 		Common::CharacterBuffer* mCharacterBuffer;
 
@@ -142,6 +142,11 @@ namespace COLLADASW
         /** Creates a stream writer that writes to file @a fileName*/
         StreamWriter ( const NativeString& fileName, bool doublePrecision = false, COLLADAVersion cOLLADAVersion = COLLADA_1_4_1);
 
+        /** Creates a stream writer that passes the document to @a bufferFlusher, e.g. a 
+        Common::AsyncFWriteBufferFlusher, or a Common::GZipBufferFlusher to write a .dae.gz file. 
+        The stream writer takes ownership of @a bufferFlusher.*/
+        StreamWriter ( Common::IBufferFlusher* bufferFlusher, bool doublePrecision = false, COLLADAVersion cOLLADAVersion = COLLADA_1_4_1);
+
         /** Closes all open tags and closes the stream*/
         ~StreamWriter();
 
@@ -208,7 +213,8 @@ namespace COLLADASW
         /** Adds @a number1, @a number2, @a number3 and @a number4 to the COLLADASW file.*/
         void appendValues ( const float number1, const float number2, const float number3, const float number4 );
 
-        /** Adds all values in the array to the COLLADASW file.*/
+        /** Adds all values in the array to the COLLADASW file, each one in the shortest representation
+        that is parsed back to the same float.*/
         void appendValues ( const float values[], const size_t length );
 
         /** Adds all values in the array to the COLLADASW file.*/
@@ -223,7 +229,8 @@ namespace COLLADASW
         /** Adds all values in the array to the COLLADASW file.*/
         void appendValues ( const double matrix[4][4] );
 
-        /** Adds all values in the array to the COLLADASW file.*/
+        /** Adds all values in the array to the COLLADASW file, each one in the shortest representation
+        that is parsed back to the same float.*/
         void appendValues ( const std::vector<float>& values );
 
         /** Adds all values in the array to the COLLADASW file.*/
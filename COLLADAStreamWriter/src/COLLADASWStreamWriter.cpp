@@ -81,6 +81,23 @@ namespace COLLADASW
 		}
     }
 
+    //---------------------------------------------------------------
+    StreamWriter::StreamWriter ( Common::IBufferFlusher* bufferFlusher, bool doublePrecision /*= false*/, COLLADAVersion cOLLADAVersion /*= COLLADA_1_4_1*/ )
+            : mBufferFlusher( bufferFlusher )
+			, mCharacterBuffer( new Common::CharacterBuffer(CHARACTERBUFFERSIZE, mBufferFlusher) )
+			, mLevel ( 0 )
+            , mIndent ( 2 )
+            , mDoublePrecision (doublePrecision)
+			, mCOLLADAVersion(cOLLADAVersion)
+			, mNextElementIndex(0)
+    {
+		int error = mBufferFlusher->getError();
+		if ( error != 0 )
+		{
+			throw StreamWriterException(StreamWriterException::ERROR_FILE_OPEN, "Could not open the output for writing. errno_t = " + Utils::toString(error) );
+		}
+    }
+
     //---------------------------------------------------------------
     StreamWriter::~StreamWriter()
     {
@@ -359,11 +376,7 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        for ( size_t i=0; i<length; ++i )
-        {
-            appendNumber ( values[i] );
-            appendChar ( ' ' );
-        }
+        mCharacterBuffer->copyToBufferAsChar ( values, length, ' ', std::numeric_limits<float>::epsilon() );
 
         mOpenTags.back().mHasText = true;
     }
@@ -437,11 +450,7 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        for ( size_t i=0; i<length; ++i )
-        {
-            appendNumber ( values[i] );
-            appendChar ( ' ' );
-        }
+        mCharacterBuffer->copyToBufferAsChar ( values, length, ' ', mDoublePrecision, std::numeric_limits<double>::epsilon() );
 
         mOpenTags.back().mHasText = true;
     }
@@ -499,12 +508,8 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        std::vector<float>::const_iterator it = values.begin();
-        for ( ; it!=values.end(); ++it )
-        {
-            appendNumber ( *it );
-            appendChar ( ' ' );
-        }
+        if ( !values.empty() )
+            mCharacterBuffer->copyToBufferAsChar ( &values[0], values.size(), ' ', std::numeric_limits<float>::epsilon() );
 
         mOpenTags.back().mHasText = true;
     }
@@ -516,12 +521,8 @@ namespace COLLADASW
 
         if ( mOpenTags.back().mHasText ) appendChar ( ' ' );
 
-        std::vector<double>::const_iterator it = values.begin();
-        for ( ; it!=values.end(); ++it )
-        {
-            appendNumber ( *it );
-            appendChar ( ' ' );
-        }
+        if ( !values.empty() )
+            mCharacterBuffer->copyToBufferAsChar ( &values[0], values.size(), ' ', mDoublePrecision, std::numeric_limits<double>::epsilon() );
 
         mOpenTags.back().mHasText = true;
     }
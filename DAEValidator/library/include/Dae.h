@@ -3,9 +3,9 @@
 #include "Xml.h"
 #include "Uri.h"
 #include "no_warning_map"
-#include <set>
 #include "no_warning_string"
 #include <tuple>
+#include "no_warning_unordered_map"
 #include "no_warning_vector"
 
 namespace opencollada
@@ -42,13 +42,20 @@ namespace opencollada
 		const std::map<Uri, Dae> & getExternalDAEs() const { return mExternalDAEs; }
 		const std::vector<std::tuple<size_t, Uri>> & getAnyURIs() const { return mAnyURIs; }
 		const std::vector<std::tuple<size_t, std::string>> & getIDREFs() const { return mIDREFs; }
-		const std::set<std::string> & getIds() const;
+		// id to index of its first declaration in getIdDeclarations()
+		const std::unordered_map<std::string, size_t> & getIds() const { return mIds; }
+		// line and value of id attributes, in document order
+		const std::vector<std::tuple<size_t, std::string>> & getIdDeclarations() const { return mIdDeclarations; }
+		// line, value and line of first declaration of sid attributes already used by a sibling element.
+		// Sorted by parent element in document order.
+		const std::vector<std::tuple<size_t, std::string, size_t>> & getDuplicatedSids() const { return mDuplicatedSids; }
 
 	private:
 		void readExternalFile(const std::string & path);
 		void onAnyDAEURI(size_t line, const std::string & uri);
 		void onAnyURI(size_t line, const std::string & uri);
-		void initializeCache() const;
+		// Collects ids and sids. Also collects xs:anyURI by group and IDREFs if uris is not null.
+		void index(std::vector<std::vector<std::tuple<size_t, std::string>>> * uris);
 
 		Dae(const Dae&) = delete;
 		const Dae& operator = (const Dae&) = delete;
@@ -58,9 +65,9 @@ namespace opencollada
 		std::map<Uri, Dae> mExternalDAEs;
 		std::vector<std::tuple<size_t, Uri>> mAnyURIs;
 		std::vector<std::tuple<size_t, std::string>> mIDREFs;
-
-		mutable std::set<std::string> mIdCache;
-		mutable bool mCacheInitialized = false;
+		std::unordered_map<std::string, size_t> mIds;
+		std::vector<std::tuple<size_t, std::string>> mIdDeclarations;
+		std::vector<std::tuple<size_t, std::string, size_t>> mDuplicatedSids;
 
 		static std::string mColladaNamespace141;
 		static std::string mColladaSchemaFileName141;
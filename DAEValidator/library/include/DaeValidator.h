@@ -5,6 +5,7 @@
 #include "no_warning_functional"
 #include "no_warning_list"
 #include "no_warning_map"
+#include "no_warning_mutex"
 #include "no_warning_string"
 
 namespace opencollada
@@ -12,7 +13,9 @@ namespace opencollada
 	class DaeValidator
 	{
 	public:
-		DaeValidator(const std::list<std::string> & daePaths);
+		// Files are checked on up to "jobs" threads. Checks of a file also run in parallel when
+		// there are more jobs than files. Output does not depend on the number of jobs.
+		DaeValidator(const std::list<std::string> & daePaths, size_t jobs = 1);
 
 		int checkAll() const;
 		int checkSchema(const std::string & schema_uri = std::string()) const;
@@ -30,13 +33,19 @@ namespace opencollada
 		int for_each_dae(const std::function<int(const Dae &)> & task) const;
 
 		static int ValidateAgainstSchema(const Dae & dae, const XmlSchema & schema);
+		static int ValidateAgainstSchema(const XmlNode & node, const XmlSchema & schema);
 		static int CheckEscapeChar(const std::string & s);
 
 	private:
 		std::vector<std::string> mDaePaths;
+		size_t mJobs = 1;
 		// namespace to XmlSchema
 		mutable std::map<std::string, XmlSchema> mSchemas;
 		// namespace to xsd location
 		mutable std::map<std::string, std::string> mSchemaLocations;
+		// namespace to location xsd has been loaded from, if different from xsd location
+		mutable std::map<std::string, std::string> mSchemaLoadLocations;
+		// Guards schema maps when files are checked in parallel
+		mutable std::mutex mSchemasMutex;
 	};
 }
\ No newline at end of file
@@ -20,6 +20,8 @@ namespace opencollada
 		std::streamsize xsputn(const char *_Ptr, std::streamsize _Count);
 		// override overflow and make it forward data to the callback function
 		std::char_traits<char>::int_type overflow(std::char_traits<char>::int_type v);
+		// override sync and make it flush the original stream buffer
+		int sync();
 
 	private:
 		const streamhook& operator = (const streamhook&) = delete;
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "no_warning_functional"
+#include "no_warning_string"
+#include "no_warning_vector"
+
+namespace opencollada
+{
+	class Parallel
+	{
+	public:
+		using Task = std::function<int()>;
+
+		// Runs tasks on up to "jobs" threads and returns the bitwise OR of their results.
+		// What a task writes to std::cout and std::cerr, including libxml messages, is buffered
+		// and written in task order, so the output does not depend on the number of jobs.
+		// Tasks run in the calling thread if "jobs" is less than 2.
+		static int Run(const std::vector<Task> & tasks, size_t jobs);
+
+		// Number of jobs used when 0 jobs are requested.
+		static size_t DefaultJobs();
+	};
+}
\ No newline at end of file
@@ -10,6 +10,7 @@ namespace opencollada
 		static const std::string accessor;
 		static const std::string attachment;
 		static const std::string binary;
+		static const std::string camera_node;
 		static const std::string channel;
 		static const std::string COLLADA;
 		static const std::string convex_mesh;
@@ -48,6 +49,7 @@ namespace opencollada
 		static const std::string ref_attachment;
 		static const std::string render;
 		static const std::string rigid_body;
+		static const std::string sid;
 		static const std::string skeleton;
 		static const std::string skin;
 		static const std::string source;
@@ -4,6 +4,7 @@
 #include "XmlNodeSet.h"
 #include <libxml/parser.h>
 #include "no_warning_map"
+#include "no_warning_mutex"
 #include "no_warning_string"
 
 namespace opencollada
@@ -62,5 +63,7 @@ namespace opencollada
 		xmlDocPtr mDoc = nullptr;
 
 		XPathCache mXPathCache;
+		// XmlNode::selectNodes() may be called by several threads on the same document.
+		std::mutex mXPathCacheMutex;
 	};
 }
\ No newline at end of file
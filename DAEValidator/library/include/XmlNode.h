@@ -15,6 +15,7 @@ namespace opencollada
 	{
 		friend class XmlDoc;
 		friend class XmlNodeSet;
+		friend class XmlSchema;
 	public:
 		XmlNode() = default;
 		operator bool() const;
@@ -31,9 +32,14 @@ namespace opencollada
 		const XmlNodeSet & selectNodes(const std::string & xpath) const;
 		class XmlNodes<class XmlNodeIteratorByName> children(const std::string & name) const;
 		XmlNode next(const std::string & name) const;
+		// Parent element. Null node if this is the root element.
+		XmlNode parent() const;
 		size_t line() const;
 
 		void for_each_attribute(const std::function<void(const class XmlAttribute &)> & fn) const;
+		// Calls fn for this element and all its descendant elements in document order.
+		// depth is 0 for this element, 1 for its children, and so on.
+		void for_each_element(const std::function<void(const XmlNode & node, size_t depth)> & fn) const;
 
 	private:
 		XmlNode(xmlNodePtr node);
@@ -16,6 +16,8 @@ namespace opencollada
 
 		void readFile(const std::string & url);
 		bool validate(const class XmlDoc & doc) const;
+		// Validates the subtree rooted at node without modifying its document.
+		bool validate(const class XmlNode & node) const;
 
 		operator bool() const;
 
@@ -20,6 +20,7 @@ namespace opencollada
 	const char* checkUniqueSids = "--check-unique-sids";
 	const char* checkLinks = "--check-links";
 	const char* recursive = "--recursive";
+	const char* jobs = "--jobs";
 	const char* quiet = "--quiet";
 	const char* help = "--help";
 
@@ -36,6 +37,7 @@ namespace opencollada
 		argparse.addArgument(checkUniqueSids).help("Check that sids in documents are unique in their scope.");
 		argparse.addArgument(checkLinks).help("Check that URIs refer to valid files and/or elements.");
 		argparse.addArgument(recursive).help("Recursively parse directories. Ignored if 'path' is not a directory.");
+		argparse.addArgument(jobs).numParameters(1).hint(0, "N").help("Check up to N documents or checks in parallel. 0 uses one job per hardware thread. Default is 1.");
 		argparse.addArgument(quiet).help("If set, no output is sent to standard out/err.");
 		argparse.addArgument(help).help("Display help.");
 
@@ -74,7 +76,11 @@ namespace opencollada
 			return 0;
 		}
 
-		DaeValidator validator(daePaths);
+		size_t jobCount = 1;
+		if (const auto & arg = argparse.findArgument(jobs))
+			jobCount = arg.getValue<size_t>();
+
+		DaeValidator validator(daePaths, jobCount);
 		int result = 0;
 
 		if (!argparse.findArgument(checkSchemaAuto) &&
@@ -4,7 +4,10 @@
 #include "StringUtil.h"
 #include "Strings.h"
 #include <iostream>
+#include "no_warning_algorithm"
+#include "no_warning_mutex"
 #include "no_warning_sstream"
+#include "no_warning_unordered_map"
 
 using namespace std;
 
@@ -18,9 +21,114 @@ namespace opencollada
 	string Dae::mColladaSchemaFileName15 = "collada_schema_1_5.xsd";
 	XmlSchema Dae::mColladaSchema15;
 
-	const string xpath_all = "//collada:";
-	const string xpath_or_all = "|//collada:";
-	const string xpath_child = "/collada:";
+	// Guards lazy loading of COLLADA schemas by concurrent validations.
+	static mutex colladaSchemaMutex;
+
+	namespace
+	{
+		// xs:anyURI values are listed group by group, in document order within a group.
+		enum URIGroup
+		{
+			// DAE references
+			InstanceURL,
+			InstanceNodeProxy,
+			Source,
+			RenderCameraNode,
+			Skeleton,
+			Target,
+			InstancePhysicsModelParent,
+			ConvexHullOf,
+			LastDAEURIGroup = ConvexHullOf,
+
+			// Other xs:anyURI
+			ImageInitFrom,
+			Ref,
+			URL,
+			SourceFragment,
+			URIGroupCount
+		};
+
+		// Describes where a COLLADA element holds an xs:anyURI.
+		struct URIRule
+		{
+			URIGroup group;
+			// Attribute holding the URI. nullptr if the URI is the element text.
+			const string* attribute;
+			// Required parent element. nullptr if any.
+			const string* parent;
+		};
+
+		// COLLADA element name to the xs:anyURI it may hold.
+		const unordered_map<string, vector<URIRule>> & GetURIRules()
+		{
+			static const unordered_map<string, vector<URIRule>> rules =
+			{
+				// InstanceWithExtra and other <instance_*> with "url" attribute
+				{ Strings::instance_animation, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_camera, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_controller, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_effect, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_force_field, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_formula, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_geometry, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_image, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_joint, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_kinematics_model, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_kinematics_scene, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_light, { { InstanceURL, &Strings::url, nullptr } } },
+				// <instance_node>
+				{ Strings::instance_node, { { InstanceURL, &Strings::url, nullptr }, { InstanceNodeProxy, &Strings::proxy, nullptr } } },
+				{ Strings::instance_physics_material, { { InstanceURL, &Strings::url, nullptr } } },
+				// <instance_physics_model>
+				{ Strings::instance_physics_model, { { InstanceURL, &Strings::url, nullptr }, { InstancePhysicsModelParent, &Strings::parent, nullptr } } },
+				{ Strings::instance_physics_scene, { { InstanceURL, &Strings::url, nullptr } } },
+				{ Strings::instance_visual_scene, { { InstanceURL, &Strings::url, nullptr } } },
+				// <accessor>
+				// <skin>
+				// <morph>
+				{ Strings::accessor, { { Source, &Strings::source, nullptr } } },
+				{ Strings::skin, { { Source, &Strings::source, nullptr } } },
+				{ Strings::morph, { { Source, &Strings::source, nullptr } } },
+				// <render>
+				{ Strings::render, { { RenderCameraNode, &Strings::camera_node, nullptr } } },
+				// <skeleton>
+				{ Strings::skeleton, { { Skeleton, nullptr, nullptr } } },
+				// <instance_material>
+				// <instance_rigid_body>
+				{ Strings::instance_material, { { Target, &Strings::target, nullptr } } },
+				{ Strings::instance_rigid_body, { { Target, &Strings::target, nullptr } } },
+				// <convex_mesh>
+				{ Strings::convex_mesh, { { ConvexHullOf, &Strings::convex_hull_of, nullptr } } },
+
+				// TODO
+				// rigid_body attribute is an sid. Make sid check.
+				// <ref_attachment>
+				// <attachment>
+
+				// <image>/<init_from>
+				{ Strings::init_from, { { ImageInitFrom, nullptr, &Strings::image } } },
+				// <binary>/<ref>
+				// <init_from>/<ref>
+				{ Strings::ref, { { Ref, nullptr, &Strings::binary }, { Ref, nullptr, &Strings::init_from } } },
+				// <include>
+				// <profile_BRIDGE>
+				{ Strings::include, { { URL, &Strings::url, nullptr } } },
+				{ Strings::profile_BRIDGE, { { URL, &Strings::url, nullptr } } },
+
+				// Ignore these anyURI:
+				// <COLLADA>@base
+				// <contributor>/<author_website>
+				// <contributor>/<source_data>
+
+				// URI fragments:
+				// <channel>
+				// <input>
+				{ Strings::channel, { { SourceFragment, &Strings::source, nullptr } } },
+				{ Strings::input, { { SourceFragment, &Strings::source, nullptr } } }
+			};
+			return rules;
+		}
+	}
 
 	Dae::Dae(Dae && other)
 	{
@@ -32,11 +140,17 @@ namespace opencollada
 		this->XmlDoc::operator=(move(other));
 		mUri = move(other.mUri);
 		mExternalDAEs = move(other.mExternalDAEs);
+		mAnyURIs = move(other.mAnyURIs);
+		mIDREFs = move(other.mIDREFs);
+		mIds = move(other.mIds);
+		mIdDeclarations = move(other.mIdDeclarations);
+		mDuplicatedSids = move(other.mDuplicatedSids);
 		return *this;
 	}
 
 	const XmlSchema & Dae::GetColladaSchema141()
 	{
+		lock_guard<mutex> lock(colladaSchemaMutex);
 		if (!mColladaSchema141)
 			mColladaSchema141.readFile(Path::Join(Path::GetExecutableDirectory(), mColladaSchemaFileName141));
 		if (!mColladaSchema141)
@@ -66,185 +180,35 @@ namespace opencollada
 	void Dae::readFile(const string & path)
 	{
 		mUri = Uri::FromNativePath(path);
+		mExternalDAEs.clear();
+		mAnyURIs.clear();
+		mIDREFs.clear();
+		mIds.clear();
+		mIdDeclarations.clear();
+		mDuplicatedSids.clear();
 
 		Super::readFile(path);
 
 		if (!*this)
 			return;
 
-		// List referenced DAEs
-
-		// InstanceWithExtra and other <instance_*> with "url" attribute
-		const auto & instances = root().selectNodes(
-			xpath_all + Strings::instance_animation +
-			xpath_or_all + Strings::instance_camera +
-			xpath_or_all + Strings::instance_controller +
-			xpath_or_all + Strings::instance_effect +
-			xpath_or_all + Strings::instance_force_field +
-			xpath_or_all + Strings::instance_formula +
-			xpath_or_all + Strings::instance_geometry +
-			xpath_or_all + Strings::instance_image +
-			xpath_or_all + Strings::instance_joint +
-			xpath_or_all + Strings::instance_kinematics_model +
-			xpath_or_all + Strings::instance_kinematics_scene +
-			xpath_or_all + Strings::instance_light +
-			xpath_or_all + Strings::instance_node +
-			xpath_or_all + Strings::instance_physics_material +
-			xpath_or_all + Strings::instance_physics_model +
-			xpath_or_all + Strings::instance_physics_scene +
-			xpath_or_all + Strings::instance_visual_scene
-		);
-		for (auto instance : instances)
-			if (auto url = instance.attribute(Strings::url))
-				onAnyDAEURI(instance.line(), url.value());
-
-		// <instance_node>
-		const auto & instance_nodes = root().selectNodes(xpath_all + Strings::instance_node);
-		for (auto instance_node : instance_nodes)
-		{
-			if (auto proxy = instance_node.attribute(Strings::proxy))
-				onAnyDAEURI(instance_node.line(), proxy.value());
-		}
-
-		// <accessor>
-		// <skin>
-		// <morph>
-		const auto & elementsWithSource = root().selectNodes(
-			xpath_all + Strings::accessor +
-			xpath_or_all + Strings::skin +
-			xpath_or_all + Strings::morph
-		);
-		for (auto element : elementsWithSource)
-		{
-			if (auto source = element.attribute(Strings::source))
-				onAnyDAEURI(element.line(), source.value());
-		}
-
-		// <render>
-		const auto & renders = root().selectNodes(xpath_all + Strings::render);
-		for (auto render : renders)
-		{
-			if (auto camera_node = render.attribute("camera_node"))
-				onAnyDAEURI(render.line(), camera_node.value());
-		}
-
-		// <skeleton>
-		const auto & skeletons = root().selectNodes(xpath_all + Strings::skeleton);
-		for (auto skeleton : skeletons)
-		{
-			onAnyDAEURI(skeleton.line(), skeleton.text());
-		}
-
-		// <instance_material>
-		// <instance_rigid_body>
-		const auto & elementsWithTarget = root().selectNodes(
-			xpath_all + Strings::instance_material +
-			xpath_or_all + Strings::instance_rigid_body
-		);
-		for (auto element : elementsWithTarget)
-		{
-			if (auto target = element.attribute(Strings::target))
-				onAnyDAEURI(element.line(), target.value());
-		}
-
-		// <instance_physics_model>
-		const auto & instance_physics_models = root().selectNodes(xpath_all + Strings::instance_physics_model);
-		for (auto instance_physics_model : instance_physics_models)
-		{
-			if (auto parent = instance_physics_model.attribute(Strings::parent))
-				onAnyDAEURI(instance_physics_model.line(),  parent.value());
-		}
-
-		// <convex_mesh>
-		const auto & convex_meshes = root().selectNodes(xpath_all + Strings::convex_mesh);
-		for (auto convex_mesh : convex_meshes)
-		{
-			if (auto convex_hull_of = convex_mesh.attribute(Strings::convex_hull_of))
-				onAnyDAEURI(convex_mesh.line(), convex_hull_of.value());
-		}
+		// Collect ids, sids, xs:anyURI and IDREFs in a single traversal
+		vector<vector<tuple<size_t, string>>> uris(URIGroupCount);
+		index(&uris);
 
-		// TODO
-		// rigid_body attribute is an sid. Make sid check.
-
-		// <ref_attachment>
-		// <attachment>
-		//auto attachments = root().selectNodes(
-		//	xpath_all + Strings::attachment +
-		//	xpath_or_all + Strings::ref_attachment
-		//);
-		//for (auto attachment : attachments)
-		//{
-		//	if (auto rigid_body = attachment.attribute(Strings::rigid_body))
-		//		onAnyDAEURI(attachment.line(), rigid_body.value());
-		//}
+		// List referenced DAEs
+		for (size_t group = 0; group <= LastDAEURIGroup; ++group)
+			for (const auto & uri : uris[group])
+				onAnyDAEURI(get<0>(uri), get<1>(uri));
 
 		// Load found DAE references
 		for (auto & uri_dae : mExternalDAEs)
 			uri_dae.second.readExternalFile(uri_dae.first.nativePath());
 
-		// Look for additional xs:anyURI that are not DAE references:
-
-		// <image>/<init_from>
-		const auto & init_froms = root().selectNodes(xpath_all + Strings::image + xpath_child + Strings::init_from);
-		for (auto init_from : init_froms)
-		{
-			onAnyURI(init_from.line(), init_from.text());
-		}
-
-		// <binary>/<ref>
-		// <init_from>/<ref>
-		const auto & refs = root().selectNodes(
-			xpath_all + Strings::binary + xpath_child + Strings::ref +
-			xpath_or_all + Strings::init_from + xpath_child + Strings::ref
-		);
-		for (auto ref : refs)
-		{
-			onAnyURI(ref.line(), ref.text());
-		}
-
-		// <include>
-		// <profile_BRIDGE>
-		const auto & elementsWithUrl = root().selectNodes(
-			xpath_all + Strings::include +
-			xpath_or_all + Strings::profile_BRIDGE
-		);
-		for (auto element : elementsWithUrl)
-		{
-			if (auto url = element.attribute(Strings::url))
-				onAnyURI(element.line(), url.value());
-		}
-
-		// Ignore these anyURI:
-		// <COLLADA>@base
-		// <contributor>/<author_website>
-		// <contributor>/<source_data>
-
-		// Look for URI fragments:
-
-		// <channel>
-		// <input>
-		const auto & elementsWithSourceFragment = root().selectNodes(
-			xpath_all + Strings::channel +
-			xpath_or_all + Strings::input
-		);
-		for (auto element : elementsWithSourceFragment)
-		{
-			if (auto source = element.attribute(Strings::source))
-				//onURIFragment(element.line(), source.value());
-				onAnyURI(element.line(), source.value());
-		}
-
-		// Look for IDREFs
-
-		// <IDREF_array>
-		const auto & IDREF_arrays = root().selectNodes(xpath_all + Strings::IDREF_array);
-		for (auto IDREF_array : IDREF_arrays)
-		{
-			stringstream ss(IDREF_array.text());
-			string buffer;
-			while (ss >> buffer)
-				mIDREFs.emplace_back(IDREF_array.line(), buffer);
-		}
+		// Additional xs:anyURI that are not DAE references
+		for (size_t group = LastDAEURIGroup + 1; group < URIGroupCount; ++group)
+			for (const auto & uri : uris[group])
+				onAnyURI(get<0>(uri), get<1>(uri));
 	}
 
 	Dae::Version Dae::getVersion() const
@@ -257,16 +221,106 @@ namespace opencollada
 		return Version::Unknown;
 	}
 
-	const set<string> & Dae::getIds() const
-	{
-		initializeCache();
-		return mIdCache;
-	}
-
 	void Dae::readExternalFile(const string & url)
 	{
 		// Simple load file but not the references
 		Super::readFile(url);
+
+		if (*this)
+			index(nullptr);
+	}
+
+	void Dae::index(vector<vector<tuple<size_t, string>>> * uris)
+	{
+		XmlNode root_node = root();
+		if (!root_node)
+			return;
+
+		const string colladaNamespace = getRootNamespace();
+		const auto & uriRules = GetURIRules();
+
+		// sid to line of the children of the last visited element at each depth.
+		// Index 0 holds the root element, whose parent is the document.
+		vector<unordered_map<string, size_t>> sidScopes(1);
+
+		// Pre-order index of the last visited element at each depth, starting at 1. 0 is the document.
+		vector<size_t> elementIndices(1, 0);
+		size_t elementIndex = 0;
+
+		// Duplicated sids and pre-order index of their parent
+		vector<tuple<size_t, size_t, string, size_t>> duplicatedSids;
+
+		root_node.for_each_element([&](const XmlNode & node, size_t depth) {
+			++elementIndex;
+
+			// node starts a new scope for its children
+			if (sidScopes.size() < depth + 2)
+			{
+				sidScopes.resize(depth + 2);
+				elementIndices.resize(depth + 2);
+			}
+			if (!sidScopes[depth + 1].empty())
+				sidScopes[depth + 1].clear();
+			elementIndices[depth + 1] = elementIndex;
+
+			if (auto id = node.attribute(Strings::id))
+			{
+				string value = id.value();
+				mIds.insert(pair<string, size_t>(value, mIdDeclarations.size()));
+				mIdDeclarations.emplace_back(node.line(), move(value));
+			}
+
+			if (auto sid = node.attribute(Strings::sid))
+			{
+				auto & scope = sidScopes[depth];
+				auto p = scope.insert(pair<string, size_t>(sid.value(), node.line()));
+				if (!p.second)
+					duplicatedSids.emplace_back(elementIndices[depth], node.line(), p.first->first, p.first->second);
+			}
+
+			if (!uris || colladaNamespace.empty())
+				return;
+
+			string name = node.name();
+			auto rules = uriRules.find(name);
+			bool isIDREFArray = name == Strings::IDREF_array;
+			if (rules == uriRules.end() && !isIDREFArray)
+				return;
+			if (node.ns().href() != colladaNamespace)
+				return;
+
+			if (isIDREFArray)
+			{
+				stringstream ss(node.text());
+				string buffer;
+				while (ss >> buffer)
+					mIDREFs.emplace_back(node.line(), buffer);
+				return;
+			}
+
+			for (const auto & rule : rules->second)
+			{
+				if (rule.parent)
+				{
+					XmlNode parent = node.parent();
+					if (!parent || parent.name() != *rule.parent || parent.ns().href() != colladaNamespace)
+						continue;
+				}
+
+				if (!rule.attribute)
+					(*uris)[rule.group].emplace_back(node.line(), node.text());
+				else if (auto attribute = node.attribute(*rule.attribute))
+					(*uris)[rule.group].emplace_back(node.line(), attribute.value());
+			}
+		});
+
+		// Report duplicated sids grouped by parent, parents in document order
+		stable_sort(duplicatedSids.begin(), duplicatedSids.end(), [](const tuple<size_t, size_t, string, size_t> & a, const tuple<size_t, size_t, string, size_t> & b) {
+			return get<0>(a) < get<0>(b);
+		});
+		mDuplicatedSids.reserve(duplicatedSids.size());
+		for (auto & sid : duplicatedSids)
+			mDuplicatedSids.emplace_back(get<1>(sid), move(get<2>(sid)), get<3>(sid));
 	}
 
 	void Dae::onAnyDAEURI(size_t line, const string & uri)
@@ -294,22 +348,4 @@ namespace opencollada
 	{
 		mAnyURIs.emplace_back(line, Uri(mUri, uri));
 	}
-
-	void Dae::initializeCache() const
-	{
-		if (!mCacheInitialized)
-		{
-			mCacheInitialized = true;
-
-			if (auto root_node = root())
-			{
-				const auto & nodes = root_node.selectNodes("//*[@id]");
-				for (const auto & node : nodes)
-				{
-					string id = node.attribute("id").value();
-					mIdCache.insert(id);
-				}
-			}
-		}
-	}
 }
\ No newline at end of file
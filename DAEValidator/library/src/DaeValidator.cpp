@@ -1,9 +1,11 @@
 #include "Macros.h"
 #include "DaeValidator.h"
+#include "Parallel.h"
 #include "PathUtil.h"
 #include "Strings.h"
 #include "StringUtil.h"
 #include <cmath>
+#include "no_warning_algorithm"
 #include "no_warning_iomanip"
 #include "no_warning_iostream"
 #include <set>
@@ -25,7 +27,8 @@ namespace std
 
 namespace opencollada
 {
-	DaeValidator::DaeValidator(const list<string> & daePaths)
+	DaeValidator::DaeValidator(const list<string> & daePaths, size_t jobs)
+		: mJobs(jobs == 0 ? Parallel::DefaultJobs() : jobs)
 	{
 		mDaePaths.reserve(daePaths.size());
 		mDaePaths.insert(mDaePaths.end(), daePaths.begin(), daePaths.end());
@@ -70,31 +73,33 @@ namespace opencollada
 
 	int DaeValidator::for_each_dae(const function<int(const Dae &)> & task) const
 	{
-		int result = 0;
-		size_t count = 1;
-		for (const auto & daePath : mDaePaths)
+		vector<Parallel::Task> tasks;
+		tasks.reserve(mDaePaths.size());
+		for (size_t i = 0; i < mDaePaths.size(); ++i)
 		{
-			if (mDaePaths.size() > 1)
-			{
-				cout << "[" << count << "/" << mDaePaths.size() << " " << static_cast<size_t>(static_cast<float>(count) / static_cast<float>(mDaePaths.size()) * 100.0f) << "%]" << endl;
-				++count;
-			}
+			tasks.push_back([&, i]() {
+				const auto & daePath = mDaePaths[i];
+				size_t count = i + 1;
 
-			cout << "Processing " << daePath << " (" << Size(Path::GetFileSize(daePath)).str() << ")" << endl;
+				if (mDaePaths.size() > 1)
+				{
+					cout << "[" << count << "/" << mDaePaths.size() << " " << static_cast<size_t>(static_cast<float>(count) / static_cast<float>(mDaePaths.size()) * 100.0f) << "%]" << endl;
+				}
+
+				cout << "Processing " << daePath << " (" << Size(Path::GetFileSize(daePath)).str() << ")" << endl;
+
+				Dae dae;
+				dae.readFile(daePath);
+				if (dae)
+				{
+					return task(dae);
+				}
 
-			Dae dae;
-			dae.readFile(daePath);
-			if (dae)
-			{
-				result |= task(dae);
-			}
-			else
-			{
-				result |= 1;
 				cerr << "Error loading " << daePath << endl;
-			}
+				return 1;
+			});
 		}
-		return result;
+		return Parallel::Run(tasks, mJobs);
 	}
 
 	int DaeValidator::checkAll() const
@@ -106,11 +111,16 @@ namespace opencollada
 
 	int DaeValidator::checkAll(const Dae & dae) const
 	{
-		return
-			checkSchema(dae) |
-			checkUniqueIds(dae) |
-			checkUniqueSids(dae) |
-			checkLinks(dae);
+		// Jobs not used to process other files are used to run checks in parallel.
+		size_t jobs = mJobs / max<size_t>(1, min(mJobs, mDaePaths.size()));
+
+		vector<Parallel::Task> checks = {
+			[&]() { return checkSchema(dae); },
+			[&]() { return checkUniqueIds(dae); },
+			[&]() { return checkUniqueSids(dae); },
+			[&]() { return checkLinks(dae); }
+		};
+		return Parallel::Run(checks, jobs);
 	}
 
 	int DaeValidator::checkSchema(const string & schema_uri) const
@@ -158,7 +168,8 @@ namespace opencollada
 			return 1;
 		}
 
-		vector<XmlNode> subDocs;
+		// namespace to xsd location, as declared in dae
+		map<string, string> schemaLocations;
 
 		// Find xsi:schemaLocation attributes in dae and try to validate against specified xsd documents
 		const auto & elements = dae.root().selectNodes("//*[@xsi:schemaLocation]");
@@ -176,20 +187,23 @@ namespace opencollada
 					if (ns != Dae::GetColladaNamespace141() && ns != Dae::GetColladaNamespace15())
 					{
 						// "insert" does nothing if element already exists.
-						mSchemas.insert(pair<string, XmlSchema>(ns, XmlSchema()));
-						mSchemaLocations.insert(pair<string, string>(ns, xsdUri));
+						schemaLocations.insert(pair<string, string>(ns, xsdUri));
 					}
 				}
 			}
 		}
 
+		// Schemas used by dae. Loaded schemas are shared by all files and never removed.
+		vector<pair<string, const XmlSchema*>> schemas;
+
 		// Preload uninitialized .xsd files
-		auto itSchema = mSchemas.begin();
-		auto itSchemaLocation = mSchemaLocations.begin();
-		for (; itSchema != mSchemas.end(); ++itSchema, ++itSchemaLocation)
+		unique_lock<mutex> lock(mSchemasMutex);
+		for (const auto & schemaLocation : schemaLocations)
 		{
-			const auto & schemaUri = itSchemaLocation->second;
-			auto & schema = itSchema->second;
+			const auto & ns = schemaLocation.first;
+			mSchemaLocations.insert(schemaLocation);
+			const auto & schemaUri = mSchemaLocations[ns];
+			auto & schema = mSchemas[ns];
 
 			// Don't try to load schemas that already failed in a previous run
 			if (schema.failedToLoad())
@@ -199,61 +213,67 @@ namespace opencollada
 				continue;
 			}
 
-			string uri = schemaUri;
-
 			if (!schema)
 			{
+				string uri = schemaUri;
+
 				schema.readFile(uri);
-			}
 
-			if (!schema)
-			{
-				// Try to find schema document in executable directory
-				Uri xsdUri(schemaUri);
-				if (xsdUri.isValid())
+				if (!schema)
+				{
+					// Try to find schema document in executable directory
+					Uri xsdUri(schemaUri);
+					if (xsdUri.isValid())
+					{
+						uri = Path::Join(Path::GetExecutableDirectory(), xsdUri.pathFile());
+						schema.readFile(uri);
+					}
+				}
+
+				if (!schema)
 				{
-					uri = Path::Join(Path::GetExecutableDirectory(), xsdUri.pathFile());
+					// Try to find schema document in COLLADA document directory
+					Uri xsdUri(schemaUri);
+					string xsdFile = xsdUri.pathFile();
+					xsdUri = dae.getURI();
+					xsdUri.setPathFile(xsdFile);
+					uri = xsdUri.str();
 					schema.readFile(uri);
 				}
-			}
 
-			if (!schema)
-			{
-				// Try to find schema document in COLLADA document directory
-				Uri xsdUri(schemaUri);
-				string xsdFile = xsdUri.pathFile();
-				xsdUri = dae.getURI();
-				xsdUri.setPathFile(xsdFile);
-				uri = xsdUri.str();
-				schema.readFile(uri);
+				if (schema && uri != schemaUri)
+				{
+					mSchemaLoadLocations[ns] = uri;
+				}
 			}
 
-			if (schema && uri != schemaUri)
+			if (schema)
 			{
-				cout << "Using " << uri << endl;
+				auto loadLocation = mSchemaLoadLocations.find(ns);
+				if (loadLocation != mSchemaLoadLocations.end())
+				{
+					cout << "Using " << loadLocation->second << endl;
+				}
+				schemas.push_back(pair<string, const XmlSchema*>(ns, &schema));
 			}
-			else if (!schema)
+			else
 			{
 				cout << "Error loading " << schemaUri << endl;
 				result |= 1;
 			}
 		}
+		lock.unlock();
 
 		// Validate "sub documents"
-		for (const auto & schema : mSchemas)
+		for (const auto & schema : schemas)
 		{
-			// Ignore schemas that failed to load
-			if (!schema.second)
-				continue;
-
 			const auto & ns = schema.first;
 			stringstream xpath;
 			xpath << "//*[namespace-uri()='" << ns << "' and not(namespace-uri(./..)='" << ns << "')]";
 			const auto & nodes = dae.root().selectNodes(xpath.str());
-			for (auto node : nodes)
+			for (const auto & node : nodes)
 			{
-				auto autoRestoreRoot = dae.setTempRoot(node);
-				result |= ValidateAgainstSchema(dae, schema.second);
+				result |= ValidateAgainstSchema(node, *schema.second);
 			}
 		}
 
@@ -272,12 +292,12 @@ namespace opencollada
 		cout << "Checking unique ids..." << endl;
 
 		int result = 0;
-		map<string, size_t> ids;
-		const auto & nodes = dae.root().selectNodes("//*[@id]");
-		for (const auto & node : nodes)
+		const auto & ids = dae.getIds();
+		const auto & declarations = dae.getIdDeclarations();
+		for (size_t i = 0; i < declarations.size(); ++i)
 		{
-			string id = node.attribute("id").value();
-			size_t line = node.line();
+			const auto & line = get<0>(declarations[i]);
+			const auto & id = get<1>(declarations[i]);
 
 			int checkEscapeCharResult = CheckEscapeChar(id);
 			if (checkEscapeCharResult != 0)
@@ -286,16 +306,12 @@ namespace opencollada
 				result |= checkEscapeCharResult;
 			}
 
-			auto it = ids.find(id);
-			if (it != ids.end())
+			size_t first = ids.find(id)->second;
+			if (first != i)
 			{
-				cerr << dae.getURI() << ":" << line << ": Duplicated id \"" << id << "\". See first declaration at line " << it->second << "." << endl;
+				cerr << dae.getURI() << ":" << line << ": Duplicated id \"" << id << "\". See first declaration at line " << get<0>(declarations[first]) << "." << endl;
 				result |= 1;
 			}
-			else
-			{
-				ids[id] = line;
-			}
 		}
 		return result;
 	}
@@ -312,27 +328,10 @@ namespace opencollada
 		cout << "Checking unique sids..." << endl;
 
 		int result = 0;
-		const auto & parents = dae.root().selectNodes("//*[@sid]/..");
-		for (auto parent : parents)
+		for (const auto & sid : dae.getDuplicatedSids())
 		{
-			const auto & children = parent.selectNodes("*[@sid]");
-			map<string, size_t> sids;
-			for (auto child : children)
-			{
-				string sid = child.attribute("sid").value();
-				size_t line = child.line();
-
-				auto it = sids.find(sid);
-				if (it != sids.end())
-				{
-					cerr << dae.getURI() << ":" << line << ": Duplicated sid \"" << sid << "\". See first declaration at line " << it->second << "." << endl;
-					result |= 1;
-				}
-				else
-				{
-					sids[sid] = line;
-				}
-			}
+			cerr << dae.getURI() << ":" << get<0>(sid) << ": Duplicated sid \"" << get<1>(sid) << "\". See first declaration at line " << get<2>(sid) << "." << endl;
+			result |= 1;
 		}
 		return result;
 	}
@@ -380,7 +379,7 @@ namespace opencollada
 					{
 						if (it->second)
 						{
-							auto ext_ids = it->second.getIds();
+							const auto & ext_ids = it->second.getIds();
 							auto id = ext_ids.find(uri.fragment());
 							if (id == ext_ids.end())
 							{
@@ -420,6 +419,11 @@ namespace opencollada
 		return schema.validate(dae) ? 0 : 1;
 	}
 
+	int DaeValidator::ValidateAgainstSchema(const XmlNode & node, const XmlSchema & schema)
+	{
+		return schema.validate(node) ? 0 : 1;
+	}
+
 	int DaeValidator::CheckEscapeChar(const std::string & s)
 	{
 		if (s.find_first_of(" #$%&/:;<=>?@[\\:]^`{|}~") != string::npos)
@@ -34,11 +34,10 @@ namespace opencollada
 			mCallback(str);
 		}
 
+		// Write to the original buffer directly. Swapping the stream buffer would not be thread safe.
 		if (!mQuiet)
 		{
-			mStream.rdbuf(mStreamBuf);
-			mStream << str;
-			mStream.rdbuf(this);
+			mStreamBuf->sputn(_Ptr, _Count);
 		}
 
 		return _Count;
@@ -56,14 +55,17 @@ namespace opencollada
 
 		if (!mQuiet)
 		{
-			mStream.rdbuf(mStreamBuf);
-			mStream << str;
-			mStream.rdbuf(this);
+			mStreamBuf->sputc(ch);
 		}
 
 		return char_traits<char>::not_eof(v);
 	}
 
+	int streamhook::sync()
+	{
+		return mStreamBuf->pubsync();
+	}
+
 	void libxmlhook::GenericErrorFunc(void *, const char *, ...)
 	{}
 
@@ -0,0 +1,269 @@
+#include "Parallel.h"
+#include "Log.h"
+#include <cstdio>
+#include <libxml/parser.h>
+
+#include "no_warning_algorithm"
+#include "no_warning_condition_variable"
+#include "no_warning_iostream"
+#include "no_warning_memory"
+#include "no_warning_mutex"
+#include "no_warning_thread"
+
+using namespace std;
+
+namespace opencollada
+{
+	namespace
+	{
+		// Output of one task. Consecutive writes to the same stream are merged into one chunk.
+		class TaskOutput
+		{
+		public:
+			~TaskOutput()
+			{
+				if (mLibxmlFile)
+					fclose(mLibxmlFile);
+			}
+
+			// Makes libxml messages of the calling thread part of the task output.
+			// libxml messages keep their default formatting. They are written to a temporary file
+			// and moved to the task output each time the task writes something else.
+			void captureLibxml()
+			{
+				mLibxmlFile = tmpfile();
+				if (mLibxmlFile)
+					xmlSetGenericErrorFunc(mLibxmlFile, nullptr);
+			}
+
+			bool capturesLibxml() const
+			{
+				return mLibxmlFile != nullptr;
+			}
+
+			void write(ostream & stream, const char * s, size_t n)
+			{
+				readLibxml();
+				append(stream, s, n);
+			}
+
+			// Writes the chunks to their streams in the order they have been written by the task.
+			void replay()
+			{
+				for (const auto & chunk : mChunks)
+					*chunk.first << chunk.second << flush;
+				mChunks.clear();
+			}
+
+			void readLibxml()
+			{
+				if (!mLibxmlFile)
+					return;
+
+				fflush(mLibxmlFile);
+				fseek(mLibxmlFile, mLibxmlOffset, SEEK_SET);
+				char buffer[1024];
+				size_t n = 0;
+				while ((n = fread(buffer, 1, sizeof(buffer), mLibxmlFile)) > 0)
+					append(cerr, buffer, n);
+				mLibxmlOffset = ftell(mLibxmlFile);
+				fseek(mLibxmlFile, 0, SEEK_END);
+			}
+
+		private:
+			void append(ostream & stream, const char * s, size_t n)
+			{
+				if (mChunks.empty() || mChunks.back().first != &stream)
+					mChunks.emplace_back(&stream, string());
+				mChunks.back().second.append(s, n);
+			}
+
+		private:
+			vector<pair<ostream*, string>> mChunks;
+			FILE* mLibxmlFile = nullptr;
+			long mLibxmlOffset = 0;
+		};
+
+		// Output of the task run by the current thread. nullptr if the thread does not run a task.
+		thread_local TaskOutput* currentTaskOutput = nullptr;
+
+		// Passes what a task writes to its TaskOutput. What other threads write is passed to the original stream buffer.
+		class taskhook : public streambuf
+		{
+		public:
+			taskhook(ostream & stream)
+				: mStream(stream)
+			{
+				mStreamBuf = stream.rdbuf(this);
+			}
+
+			~taskhook()
+			{
+				mStream.rdbuf(mStreamBuf);
+			}
+
+		protected:
+			streamsize xsputn(const char *s, streamsize n) override
+			{
+				if (currentTaskOutput)
+				{
+					currentTaskOutput->write(mStream, s, static_cast<size_t>(n));
+					return n;
+				}
+				return mStreamBuf->sputn(s, n);
+			}
+
+			char_traits<char>::int_type overflow(char_traits<char>::int_type v) override
+			{
+				if (char_traits<char>::eq_int_type(v, char_traits<char>::eof()))
+					return char_traits<char>::not_eof(v);
+
+				char ch = char_traits<char>::to_char_type(v);
+				if (currentTaskOutput)
+				{
+					currentTaskOutput->write(mStream, &ch, 1);
+					return v;
+				}
+				return mStreamBuf->sputc(ch);
+			}
+
+			int sync() override
+			{
+				if (currentTaskOutput)
+					return 0;
+				return mStreamBuf->pubsync();
+			}
+
+		private:
+			taskhook(const taskhook &) = delete;
+			const taskhook& operator = (const taskhook &) = delete;
+
+		private:
+			ostream & mStream;
+			streambuf* mStreamBuf = nullptr;
+		};
+
+		// Installs task hooks on std::cout and std::cerr while at least one Parallel::Run() uses several threads.
+		class TaskHooks
+		{
+		public:
+			TaskHooks()
+			{
+				lock_guard<mutex> lock(Mutex());
+				if (Users()++ == 0)
+				{
+					CoutHook().reset(new taskhook(cout));
+					CerrHook().reset(new taskhook(cerr));
+				}
+			}
+
+			~TaskHooks()
+			{
+				lock_guard<mutex> lock(Mutex());
+				if (--Users() == 0)
+				{
+					CerrHook().reset();
+					CoutHook().reset();
+				}
+			}
+
+		private:
+			static mutex & Mutex() { static mutex m; return m; }
+			static size_t & Users() { static size_t users = 0; return users; }
+			static unique_ptr<taskhook> & CoutHook() { static unique_ptr<taskhook> hook; return hook; }
+			static unique_ptr<taskhook> & CerrHook() { static unique_ptr<taskhook> hook; return hook; }
+		};
+	}
+
+	int Parallel::Run(const vector<Task> & tasks, size_t jobs)
+	{
+		int result = 0;
+
+		if (jobs < 2 || tasks.size() < 2)
+		{
+			for (const auto & task : tasks)
+				result |= task();
+			return result;
+		}
+
+		// libxml must be initialized before it is used by several threads.
+		xmlInitParser();
+
+		// libxml error handlers are set per thread. Worker threads use the handler of the calling thread,
+		// except for the default handler writing to stderr: its messages are captured in the task output.
+		xmlGenericErrorFunc errorFunc = xmlGenericError;
+		void* errorContext = xmlGenericErrorContext;
+		bool callerCapturesLibxml = currentTaskOutput && currentTaskOutput->capturesLibxml();
+
+		TaskHooks hooks;
+
+		vector<TaskOutput> outputs(tasks.size());
+		vector<int> results(tasks.size(), 0);
+		vector<bool> done(tasks.size(), false);
+		size_t next = 0;
+		mutex m;
+		condition_variable taskDone;
+
+		auto worker = [&]() {
+			// A new thread starts with the default handler.
+			bool captureLibxml =
+				xmlGenericError == errorFunc &&
+				(errorContext == nullptr || errorContext == stderr || callerCapturesLibxml);
+			if (!captureLibxml)
+				xmlSetGenericErrorFunc(errorContext, errorFunc);
+
+			for (;;)
+			{
+				size_t index = 0;
+				{
+					lock_guard<mutex> lock(m);
+					if (next == tasks.size())
+						return;
+					index = next++;
+				}
+
+				TaskOutput & output = outputs[index];
+				if (captureLibxml)
+					output.captureLibxml();
+
+				currentTaskOutput = &output;
+				int taskResult = tasks[index]();
+				currentTaskOutput = nullptr;
+				output.readLibxml();
+
+				{
+					lock_guard<mutex> lock(m);
+					results[index] = taskResult;
+					done[index] = true;
+				}
+				taskDone.notify_all();
+			}
+		};
+
+		vector<thread> threads;
+		size_t threadCount = min(jobs, tasks.size());
+		for (size_t i = 0; i < threadCount; ++i)
+			threads.emplace_back(worker);
+
+		// Write task output in task order, as soon as the task and all tasks before it are done.
+		for (size_t i = 0; i < tasks.size(); ++i)
+		{
+			{
+				unique_lock<mutex> lock(m);
+				taskDone.wait(lock, [&]() { return done[i]; });
+			}
+			outputs[i].replay();
+			result |= results[i];
+		}
+
+		for (auto & t : threads)
+			t.join();
+
+		return result;
+	}
+
+	size_t Parallel::DefaultJobs()
+	{
+		return max(1u, thread::hardware_concurrency());
+	}
+}
\ No newline at end of file
@@ -7,6 +7,7 @@ namespace opencollada
 	const string Strings::accessor = "accessor";
 	const string Strings::attachment = "attachment";
 	const string Strings::binary = "binary";
+	const string Strings::camera_node = "camera_node";
 	const string Strings::channel = "channel";
 	const string Strings::COLLADA = "COLLADA";
 	const string Strings::convex_mesh = "convex_mesh";
@@ -45,6 +46,7 @@ namespace opencollada
 	const string Strings::ref_attachment = "ref_attachment";
 	const string Strings::render = "render";
 	const string Strings::rigid_body = "rigid_body";
+	const string Strings::sid = "sid";
 	const string Strings::skeleton = "skeleton";
 	const string Strings::skin = "skin";
 	const string Strings::source = "source";
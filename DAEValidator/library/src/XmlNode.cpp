@@ -92,9 +92,12 @@ namespace opencollada
 	{
 		XmlDoc & doc = XmlDoc::GetXmlDoc(mNode->doc);
 		auto & xpathCache = doc.mXPathCache;
-		auto cache = xpathCache.find(XPathCacheKey(mNode, xpath));
-		if (cache != xpathCache.end())
-			return cache->second;
+		{
+			lock_guard<mutex> lock(doc.mXPathCacheMutex);
+			auto cache = xpathCache.find(XPathCacheKey(mNode, xpath));
+			if (cache != xpathCache.end())
+				return cache->second;
+		}
 
 		xmlXPathContextPtr context = xmlXPathNewContext(mNode->doc);
 
@@ -105,6 +108,9 @@ namespace opencollada
 
 		XmlNodeSet result(xmlXPathEvalExpression(BAD_CAST xpath.c_str(), context));
 		xmlXPathFreeContext(context);
+
+		// Keeps the node set of another thread if it evaluated the same expression in the meantime.
+		lock_guard<mutex> lock(doc.mXPathCacheMutex);
 		auto p = xpathCache.insert(pair<XPathCacheKey, XmlNodeSet>(XPathCacheKey(mNode, xpath), move(result)));
 		return p.first->second;
 	}
@@ -124,6 +130,13 @@ namespace opencollada
 		return XmlNode(next);
 	}
 
+	XmlNode XmlNode::parent() const
+	{
+		if (mNode->parent && mNode->parent->type == XML_ELEMENT_NODE)
+			return XmlNode(mNode->parent);
+		return XmlNode();
+	}
+
 	size_t XmlNode::line() const
 	{
 		return mNode->line;
@@ -136,6 +149,38 @@ namespace opencollada
 			fn(XmlAttribute(attr));
 		}
 	}
+
+	void XmlNode::for_each_element(const function<void(const XmlNode &, size_t)> & fn) const
+	{
+		if (!mNode || mNode->type != XML_ELEMENT_NODE)
+			return;
+
+		// Iterative pre-order traversal. Deeply nested documents don't overflow the stack.
+		xmlNodePtr node = mNode;
+		size_t depth = 0;
+		for (;;)
+		{
+			if (node->type == XML_ELEMENT_NODE)
+			{
+				fn(XmlNode(node), depth);
+				if (node->children)
+				{
+					node = node->children;
+					++depth;
+					continue;
+				}
+			}
+
+			while (node != mNode && !node->next)
+			{
+				node = node->parent;
+				--depth;
+			}
+			if (node == mNode)
+				return;
+			node = node->next;
+		}
+	}
 }
 
 bool operator == (const string & s, const unsigned char* c)
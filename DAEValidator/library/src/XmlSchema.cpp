@@ -1,5 +1,6 @@
 #include "XmlSchema.h"
 #include "XmlDoc.h"
+#include "XmlNode.h"
 
 #include "no_warning_string"
 using namespace std;
@@ -41,6 +42,17 @@ namespace opencollada
 		return result == 0;
 	}
 
+	bool XmlSchema::validate(const XmlNode & node) const
+	{
+		int result = 1;
+		if (xmlSchemaValidCtxtPtr ctxt = xmlSchemaNewValidCtxt(mSchema))
+		{
+			result = xmlSchemaValidateOneElement(ctxt, node.mNode);
+			xmlSchemaFreeValidCtxt(ctxt);
+		}
+		return result == 0;
+	}
+
 	XmlSchema::operator bool() const
 	{
 		return mSchema != nullptr;
@@ -96,6 +96,35 @@ namespace opencollada_test
 			Assert::AreEqual(ids.size(), static_cast<size_t>(25));
 		}
 
+		TEST_METHOD(GetIdDeclarations)
+		{
+			Dae dae;
+			dae.readFile(data_path("daevalidator/unique_ids_error.dae"));
+			const auto & ids = dae.getIds();
+			const auto & declarations = dae.getIdDeclarations();
+			Assert::IsTrue(declarations.size() > ids.size());
+			for (const auto & declaration : declarations)
+				Assert::IsTrue(ids.find(get<1>(declaration)) != ids.end());
+		}
+
+		TEST_METHOD(GetDuplicatedSids)
+		{
+			{
+				Dae dae;
+				dae.readFile(data_path("daevalidator/unique_sids_ok.dae"));
+				Assert::AreEqual(static_cast<size_t>(0), dae.getDuplicatedSids().size());
+			}
+			{
+				Dae dae;
+				dae.readFile(data_path("daevalidator/unique_sids_error.dae"));
+				const auto & sids = dae.getDuplicatedSids();
+				Assert::AreEqual(static_cast<size_t>(1), sids.size());
+				Assert::AreEqual(static_cast<size_t>(125), get<0>(sids[0]));
+				Assert::AreEqual("translate", get<1>(sids[0]).c_str());
+				Assert::AreEqual(static_cast<size_t>(124), get<2>(sids[0]));
+			}
+		}
+
 		TEST_METHOD(GetURI)
 		{
 			string dataPath = Path::GetAbsolutePath(data_path());
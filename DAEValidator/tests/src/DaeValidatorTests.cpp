@@ -24,6 +24,34 @@ namespace opencollada_test
 			Assert::AreEqual(0, v.checkAll());
 		}
 
+		TEST_METHOD(CheckAllJobs)
+		{
+			{
+				list<string> daes{ Path::GetAbsolutePath(data_path("daevalidator/file.dae")) };
+				DaeValidator v(daes, 4);
+				Assert::AreEqual(0, v.checkAll());
+			}
+			{
+				list<string> daes{
+					Path::GetAbsolutePath(data_path("daevalidator/file.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/check_schema.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/unique_ids_ok.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/links_ok.dae"))
+				};
+				DaeValidator v(daes, 0);
+				Assert::AreEqual(0, v.checkAll());
+			}
+			{
+				list<string> daes{
+					Path::GetAbsolutePath(data_path("daevalidator/file.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/unique_ids_error.dae")),
+					Path::GetAbsolutePath(data_path("daevalidator/links_ok.dae"))
+				};
+				DaeValidator v(daes, 2);
+				Assert::AreEqual(1, v.checkAll());
+			}
+		}
+
 		TEST_METHOD(CheckSchema)
 		{
 			{
@@ -208,6 +208,19 @@ namespace opencollada_test
 			Assert::IsTrue(next);
 		}
 
+		TEST_METHOD(Parent)
+		{
+			XmlDoc doc;
+			doc.readFile(data_path("xml/file.dae"));
+
+			XmlNode root = doc.root();
+			Assert::IsFalse(root.parent());
+
+			XmlNode asset = root.child("asset");
+			Assert::IsTrue(asset.parent() == root);
+			Assert::IsTrue(asset.child("created").parent() == asset);
+		}
+
 		TEST_METHOD(Line)
 		{
 			XmlDoc doc;
@@ -237,6 +250,33 @@ namespace opencollada_test
 			Assert::IsTrue(expected == attribute_names);
 		}
 
+		TEST_METHOD(ForEachElement)
+		{
+			XmlDoc doc;
+			doc.readFile(data_path("xml/file.dae"));
+			XmlNode root = doc.root();
+
+			vector<string> names;
+			vector<size_t> depths;
+			root.child("asset").for_each_element([&](const XmlNode & node, size_t depth) {
+				names.push_back(node.name());
+				depths.push_back(depth);
+			});
+			vector<string> expected_names{ "asset", "created", "modified" };
+			vector<size_t> expected_depths{ 0, 1, 1 };
+			Assert::IsTrue(expected_names == names);
+			Assert::IsTrue(expected_depths == depths);
+
+			vector<XmlNode> elements;
+			root.for_each_element([&](const XmlNode & node, size_t) {
+				elements.push_back(node);
+			});
+			const auto & expected_elements = root.selectNodes("//*");
+			Assert::AreEqual(expected_elements.size(), elements.size());
+			for (size_t i = 0; i < elements.size(); ++i)
+				Assert::IsTrue(expected_elements[static_cast<int>(i)] == elements[i]);
+		}
+
 		TEST_METHOD(StringUnsignedCharOperatorIsEqual)
 		{
 			string empty_s = "";
@@ -1,5 +1,7 @@
 #include "Common.h"
 #include "XmlDoc.h"
+#include "XmlNode.h"
+#include "XmlNodeSet.h"
 #include "XmlSchema.h"
 
 using namespace opencollada;
@@ -71,6 +73,26 @@ namespace opencollada_test
 			}
 		}
 
+		TEST_METHOD(ValidateNode)
+		{
+			XmlSchema s;
+			s.readFile(data_path("xml/COLLADAPhysX3Schema.xsd"));
+			{
+				XmlDoc doc;
+				doc.readFile(data_path("xml/file.dae"));
+				const auto & nodes = doc.root().selectNodes("//*[local-name()='px_rigid_body']");
+				Assert::AreEqual(static_cast<size_t>(1), nodes.size());
+				Assert::IsTrue(s.validate(nodes[0]));
+			}
+			{
+				XmlDoc doc;
+				doc.readFile(data_path("xml/schema_other_error.dae"));
+				const auto & nodes = doc.root().selectNodes("//*[local-name()='px_rigid_body']");
+				Assert::AreEqual(static_cast<size_t>(1), nodes.size());
+				Assert::IsFalse(s.validate(nodes[0]));
+			}
+		}
+
 		TEST_METHOD(OperatorBool)
 		{
 			XmlSchema s1;
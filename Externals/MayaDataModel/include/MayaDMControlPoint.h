@@ -12,6 +12,7 @@
 #include "MayaDMTypes.h"
 #include "MayaDMConnectables.h"
 #include "MayaDMDeformableShape.h"
+#include "MayaDMOutputBuffer.h"
 namespace MayaDM
 {
 class ControlPoint : public DeformableShape
@@ -192,6 +193,17 @@ public:
 	{
 		fprintf(mFile,";\n");
 	}
+	void setUvSetPoints(size_t uvst_i,size_t uvsp_start,size_t uvsp_end,const float* uvsp,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer("\tsetAttr \".uvst");
+		writeIndex(buffer,uvst_i);
+		buffer.copyToBuffer(".uvsp");
+		writeRange(buffer,uvsp_start,uvsp_end);
+		buffer.copyToBuffer("\" ");
+		buffer.copyToBufferAsChar(uvsp,(uvsp_end-uvsp_start)*2+2,' ');
+		buffer.copyToBuffer(";\n");
+		buffer.flushBuffer();
+	}
 	void setUvSetPointsU(size_t uvst_i,size_t uvsp_i,float uvpu)
 	{
 		if(uvpu == 0.0) return;
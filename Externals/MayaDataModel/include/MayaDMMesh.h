@@ -12,6 +12,7 @@
 #include "MayaDMTypes.h"
 #include "MayaDMConnectables.h"
 #include "MayaDMSurfaceShape.h"
+#include "MayaDMOutputBuffer.h"
 namespace MayaDM
 {
 class Mesh : public SurfaceShape
@@ -369,6 +370,15 @@ public:
 	{
 		fprintf(mFile,";\n");
 	}
+	void setVrts(size_t vt_start,size_t vt_end,const float* vt,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer("\tsetAttr \".vt");
+		writeRange(buffer,vt_start,vt_end);
+		buffer.copyToBuffer("\" ");
+		buffer.copyToBufferAsChar(vt,(vt_end-vt_start)*3+3,' ');
+		buffer.copyToBuffer(";\n");
+		buffer.flushBuffer();
+	}
 	void setVrtx(size_t vt_i,float vx)
 	{
 		if(vx == 0.0) return;
@@ -413,6 +423,15 @@ public:
 	{
 		fprintf(mFile,";\n");
 	}
+	void setEdge(size_t ed_start,size_t ed_end,const int* ed,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer("\tsetAttr \".ed");
+		writeRange(buffer,ed_start,ed_end);
+		buffer.copyToBuffer("\" ");
+		buffer.copyToBufferAsChar(ed,(ed_end-ed_start)*3+3,' ');
+		buffer.copyToBuffer(";\n");
+		buffer.flushBuffer();
+	}
 	void setEdg1(size_t ed_i,int e1)
 	{
 		if(e1 == 0) return;
@@ -547,6 +566,30 @@ public:
 	{
 		fprintf(mFile,";\n");
 	}
+	void setNormals(size_t n_start,size_t n_end,const float* n,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer("\tsetAttr \".n");
+		writeRange(buffer,n_start,n_end);
+		buffer.copyToBuffer("\" ");
+		buffer.copyToBufferAsChar(n,(n_end-n_start)*3+3,' ');
+		buffer.copyToBuffer(";\n");
+		buffer.flushBuffer();
+	}
+	void startNormals(size_t n_start,size_t n_end,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer("\tsetAttr \".n");
+		writeRange(buffer,n_start,n_end);
+		buffer.copyToBuffer("\" ");
+	}
+	void appendNormals(float n,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBufferAsChar(&n,1,' ');
+	}
+	void endNormals(Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer(";\n");
+		buffer.flushBuffer();
+	}
 	void setNormalx(size_t n_i,float nx)
 	{
 		if(nx == 1e20) return;
@@ -593,6 +636,22 @@ public:
 	{
 		fprintf(mFile,";\n");
 	}
+	void startFace(size_t fc_start,size_t fc_end,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer("\tsetAttr \".fc");
+		writeRange(buffer,fc_start,fc_end);
+		buffer.copyToBuffer("\" -type \"polyFaces\" ");
+	}
+	void appendFace(const polyFaces& fc,Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer(' ');
+		writePolyFaces(buffer,fc);
+	}
+	void endFace(Common::CharacterBuffer& buffer)const
+	{
+		buffer.copyToBuffer(";\n");
+		buffer.flushBuffer();
+	}
 	void setColorPerVertex(const ColorPerVertex& cpvx)
 	{
 		fprintf(mFile,"\tsetAttr \".cpvx\" ");
@@ -0,0 +1,161 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of MayaDataModel.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+#ifndef __MayaDM_OUTPUTBUFFER_H__
+#define __MayaDM_OUTPUTBUFFER_H__
+#include "MayaDMTypes.h"
+#include "CommonCharacterBuffer.h"
+#include <stdio.h>
+namespace MayaDM
+{
+
+/**
+Flusher of a Common::CharacterBuffer, that writes the buffered output into the file of the nodes.
+The file is not owned by the flusher.
+
+The setters of the nodes, that take a Common::CharacterBuffer, format large setAttr arrays into the
+buffer instead of calling fprintf for every value. All other setters still write with fprintf into
+the file. To keep the order of the statements, the buffered setters flush the buffer into the file,
+before they return. Any other flusher can be plugged into the buffer, if the output of the buffered
+setters should go somewhere else.
+*/
+class FileBufferFlusher : public Common::IBufferFlusher
+{
+private:
+	FILE* mFile;
+public:
+	FileBufferFlusher(FILE* file) : mFile(file) {}
+	virtual ~FileBufferFlusher(){}
+
+	FILE* getFile()const
+	{
+		return mFile;
+	}
+	void setFile(FILE* file)
+	{
+		mFile = file;
+	}
+
+	virtual bool receiveData(const char* buffer, size_t length)
+	{
+		if(mFile == 0) return false;
+		return fwrite(buffer, 1, length, mFile) == length;
+	}
+	virtual bool flush()
+	{
+		if(mFile == 0) return false;
+		return fflush(mFile) == 0;
+	}
+
+	/** Marks are not supported, the file is shared with fprintf. */
+	virtual void startMark(){}
+	virtual MarkId endMark()
+	{
+		return INVALID_ID;
+	}
+	virtual bool jumpToMark(MarkId markId, bool keepMarkId = false)
+	{
+		return false;
+	}
+
+	virtual int getError()const
+	{
+		if(mFile == 0) return -1;
+		return ferror(mFile);
+	}
+
+private:
+	/** Disable default copy ctor. */
+	FileBufferFlusher(const FileBufferFlusher& pre);
+	/** Disable default assignment operator. */
+	const FileBufferFlusher& operator=(const FileBufferFlusher& pre);
+};
+
+/** Writes the index [i] of a multi attribute. */
+inline void writeIndex(Common::CharacterBuffer& buffer, size_t i)
+{
+	buffer.copyToBuffer('[');
+	buffer.copyToBufferAsChar(i);
+	buffer.copyToBuffer(']');
+}
+
+/** Writes the index range [start:end] of a multi attribute. */
+inline void writeRange(Common::CharacterBuffer& buffer, size_t start, size_t end)
+{
+	buffer.copyToBuffer('[');
+	buffer.copyToBufferAsChar(start);
+	buffer.copyToBuffer(':');
+	buffer.copyToBufferAsChar(end);
+	buffer.copyToBuffer(']');
+}
+
+/** Writes a polyFaces value in the format of polyFaces::write(). */
+inline void writePolyFaces(Common::CharacterBuffer& buffer, const polyFaces& fc)
+{
+	if(fc.f.faceEdgeCount)
+	{
+		buffer.copyToBuffer("\n\t\tf ");
+		buffer.copyToBufferAsChar(fc.f.faceEdgeCount);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(fc.f.edgeIdValue, fc.f.faceEdgeCount, ' ');
+	}
+	if(fc.h.holeEdgeCount)
+	{
+		buffer.copyToBuffer("\n\t\th ");
+		buffer.copyToBufferAsChar(fc.h.holeEdgeCount);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(fc.h.edgeIdValue, fc.h.holeEdgeCount, ' ');
+	}
+	if(fc.mf.faceUVCount)
+	{
+		buffer.copyToBuffer("\n\t\tmf ");
+		buffer.copyToBufferAsChar(fc.mf.faceUVCount);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(fc.mf.uvIdValue, fc.mf.faceUVCount, ' ');
+	}
+	if(fc.mh.holeUVCount)
+	{
+		buffer.copyToBuffer("\n\t\tmh ");
+		buffer.copyToBufferAsChar(fc.mh.holeUVCount);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(fc.mh.uvIdValue, fc.mh.holeUVCount, ' ');
+	}
+	for(size_t i=0; i<fc.muCount; ++i)
+	{
+		const polyFaces::MU& mu = fc.mu[i];
+		if(mu.faceUVCount == 0) continue;
+		buffer.copyToBuffer("\n\t\tmu ");
+		buffer.copyToBufferAsChar(mu.uvSet);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(mu.faceUVCount);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(mu.uvIdValue, mu.faceUVCount, ' ');
+	}
+	for(size_t i=0; i<fc.mcCount; ++i)
+	{
+		const polyFaces::MC& mc = fc.mc[i];
+		if(mc.faceColorCount == 0) continue;
+		buffer.copyToBuffer("\n\t\tmc ");
+		buffer.copyToBufferAsChar(mc.colorSet);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(mc.faceColorCount);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(mc.colorIdValue, mc.faceColorCount, ' ');
+	}
+	if(fc.fc.faceColorCount)
+	{
+		buffer.copyToBuffer("\n\t\tfc ");
+		buffer.copyToBufferAsChar(fc.fc.faceColorCount);
+		buffer.copyToBuffer(' ');
+		buffer.copyToBufferAsChar(fc.fc.colorIndexValue, fc.fc.faceColorCount, ' ');
+	}
+}
+
+}//namespace MayaDM
+#endif//__MayaDM_OUTPUTBUFFER_H__
@@ -0,0 +1,157 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_COMPRESSEDFILEREADER_H__
+#define __GENERATEDSAXPARSER_COMPRESSEDFILEREADER_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserSaxParser.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct z_stream_s;
+
+
+namespace GeneratedSaxParser
+{
+	/** Reads the document of a compressed file chunk wise. Supported are gzip files and zip archives,
+	e.g. zae files. The compressed file is read and inflated in small chunks, neither the compressed nor
+	the inflated document is held in memory completely.
+	The document of a zip archive is the file referenced by the dae_root element of the manifest.xml in
+	the root of the archive or, if there is no manifest, the first file with the extension dae. Only
+	stored and deflated files are supported.*/
+	class CompressedFileReader
+	{
+	public:
+		enum Format
+		{
+			FORMAT_UNCOMPRESSED,
+			FORMAT_GZIP,
+			FORMAT_ZIP
+		};
+
+	private:
+		/** A file in a zip archive, as listed in the central directory.*/
+		struct ZipEntry
+		{
+			/** The path of the file in the archive.*/
+			std::string name;
+
+			/** The compression method, 0 (stored) or 8 (deflated).*/
+			int method;
+
+			/** The size of the data of the file in the archive.*/
+			size_t compressedSize;
+
+			/** The offset of the local header of the file in the archive.*/
+			size_t localHeaderOffset;
+		};
+
+		/** The compressed file.*/
+		FILE* mFile;
+
+		/** The format of the compressed file.*/
+		Format mFormat;
+
+		/** The inflate stream or 0, if nothing has been inflated yet.*/
+		z_stream_s* mZStream;
+
+		/** True, if the document is stored uncompressed in a zip archive.*/
+		bool mStored;
+
+		/** Buffer the compressed file is read into.*/
+		std::vector<char> mInput;
+
+		/** Number of bytes of the document that have not yet been read from the file. Only used for zip
+		archives.*/
+		size_t mRemainingInputSize;
+
+		/** Number of bytes of the document returned or skipped by read so far.*/
+		size_t mOffset;
+
+		/** If not empty, only the bytes in these ranges of the document are returned by read.*/
+		SaxParser::FileRangeList mRanges;
+
+		/** Index of the first range in mRanges that has not been read completely.*/
+		size_t mRangeIndex;
+
+		/** True, if the end of the document has been reached.*/
+		bool mEndOfDocument;
+
+		/** True, if reading or inflating has failed.*/
+		bool mFailed;
+
+	public:
+		CompressedFileReader();
+
+		/** Closes the file, if it is still open.*/
+		~CompressedFileReader();
+
+		/** Returns the format of the file that starts with the @a length bytes at @a data.*/
+		static Format getFormat( const char* data, size_t length );
+
+		/** Returns the format of the file @a fileName. Files that can not be read are reported as
+		uncompressed.*/
+		static Format getFormat( const char* fileName );
+
+		/** Opens the gzip file or zip archive @a fileName and prepares reading its document. A previously
+		opened file is closed.
+		@return True on success, false if the file could not be opened, is not compressed or the zip archive
+		does not contain a supported document.*/
+		bool open( const char* fileName );
+
+		/** Restricts the bytes returned by read to the byte ranges @a ranges of the inflated document.
+		The bytes between the ranges are inflated, but skipped. Must be called before the first call of read.*/
+		void setRanges( const SaxParser::FileRangeList& ranges );
+
+		/** Inflates the next at most @a length bytes of the document into @a buffer.
+		@return The number of bytes written to @a buffer. Zero, if the end of the document has been reached
+		or if reading has failed.*/
+		size_t read( char* buffer, size_t length );
+
+		/** Returns true, if reading or inflating has failed.*/
+		bool hasFailed() const { return mFailed; }
+
+		/** Closes the file.*/
+		void close();
+
+	private:
+		/** Disable default copy ctor. */
+		CompressedFileReader( const CompressedFileReader& pre );
+		/** Disable default assignment operator. */
+		const CompressedFileReader& operator= ( const CompressedFileReader& pre );
+
+		/** Prepares inflating the gzip file.*/
+		bool openGZip();
+
+		/** Searches the document in the central directory of the zip archive and prepares reading it.*/
+		bool openZip();
+
+		/** Reads the entire file @a entry of the zip archive into @a data. Used for the manifest.*/
+		bool readZipEntry( const ZipEntry& entry, std::string& data );
+
+		/** Positions the file at the data of @a entry and prepares reading it as the document.*/
+		bool startZipEntry( const ZipEntry& entry );
+
+		/** Recreates the inflate stream. @a windowBits is passed to inflateInit2.*/
+		bool resetZStream( int windowBits );
+
+		/** Reads the next at most @a length bytes of the document into @a buffer, ignoring the ranges.*/
+		size_t readDocument( char* buffer, size_t length );
+
+		/** Fills mInput with the next bytes of the file. Returns false, if no byte could be read.*/
+		bool fillInput();
+
+	};
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_COMPRESSEDFILEREADER_H__
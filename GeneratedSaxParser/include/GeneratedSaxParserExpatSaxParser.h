@@ -37,10 +37,14 @@ namespace GeneratedSaxParser
 		virtual ~ExpatSaxParser();
 
 		bool parseFile(const char* fileName);
+		bool parseMappedFile(const char* fileName);
 		virtual bool parseBuffer(const char* uri, const char* buffer, int length);
+		bool parseFileRanges(const char* fileName, const FileRangeList& ranges);
 
 		size_t getLineNumer()const;
 		size_t getColumnNumer()const;
+		size_t getByteOffset()const;
+		size_t getStartTagByteOffset()const;
 
 	private:
 		/** Disable default copy ctor. */
@@ -53,6 +57,12 @@ namespace GeneratedSaxParser
 
 		static void characters( void* user_data, const XML_Char* name, int length );
 
+		/** Parses the ranges @a ranges of the memory mapped document @a data.*/
+		bool parseMappedSlices(const char* data, const FileRangeList& ranges);
+
+		/** Parses the gzip file or zip archive @a fileName by passing the inflated document chunk wise to
+		the parser. If @a ranges is not 0, only these ranges of the inflated document are passed.*/
+		bool parseCompressedFile(const char* fileName, const FileRangeList* ranges);
 
 		void abortParsing();
 
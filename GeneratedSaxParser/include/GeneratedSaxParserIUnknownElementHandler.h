@@ -29,6 +29,22 @@ namespace GeneratedSaxParser
         virtual bool elementEnd(const ParserChar* elementName) = 0;
         virtual bool textData(const ParserChar* text, size_t textLength) = 0;
 
+        /** Returns true, if the next outermost unknown element should be passed as a whole to
+        elementRange(), instead of passing its start tag, its contents and its end tag to elementBegin(),
+        textData() and elementEnd(). This is only asked, if the bytes of the document are resident in
+        memory, see SaxParser::isDocumentInMemory(). */
+        virtual bool captureElementRanges() { return false; }
+
+        /** Receives an outermost unknown element as the byte range of the document it occupies, if
+        captureElementRanges() returned true at its start tag. The elements and text inside it are not
+        reported.
+        @param elementName The name of the element.
+        @param offset The offset of the '<' of its start tag in the document, see SaxParser::getByteOffset().
+        @param length The number of bytes up to and including its end tag.
+        @param bytes The @a length bytes of the element in the parsed document. They are not copied and
+        only valid during this call. Might be 0, if they are not contiguous in memory. */
+        virtual bool elementRange( const ParserChar* elementName, size_t offset, size_t length, const ParserChar* bytes ) { return true; }
+
 	private:
 		/** Disable default copy ctor. */
 		IUnknownElementHandler( const IUnknownElementHandler& pre );
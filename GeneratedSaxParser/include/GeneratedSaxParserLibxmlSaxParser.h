@@ -29,15 +29,22 @@ namespace GeneratedSaxParser
 
 		xmlParserCtxtPtr mParserContext;
 
+		/** True, while the start tag of an element is passed to the parser.*/
+		bool mInStartElement;
+
 	public:
 		LibxmlSaxParser(Parser* parser);
 		virtual ~LibxmlSaxParser();
 
 		bool parseFile(const char* fileName);
+		bool parseMappedFile(const char* fileName);
 		bool parseBuffer(const char* uri, const char* buffer, int length);
+		bool parseFileRanges(const char* fileName, const FileRangeList& ranges);
 
 		size_t getLineNumer()const;
 		size_t getColumnNumer()const;
+		size_t getByteOffset()const;
+		size_t getStartTagByteOffset()const;
 
 	private:
         /** Disable default copy ctor. */
@@ -54,6 +61,27 @@ namespace GeneratedSaxParser
 
 		void initializeParserContext();
 
+		/** Replaces the sax handler of mParserContext by ours and initializes the context.*/
+		void setupParserContext();
+
+		/** Detaches our sax handler from mParserContext and frees the context.*/
+		void releaseParserContext();
+
+		/** Reports that the document @a fileName could not be opened to the error handler.*/
+		void reportCouldNotOpenFile(const char* fileName);
+
+		/** Reports that the compressed document @a fileName could not be read or inflated completely to
+		the error handler.*/
+		void reportCouldNotReadFile(const char* fileName);
+
+		/** Parses the ranges @a ranges of the memory mapped document @a data by passing them chunk wise to 
+		the push parser.*/
+		bool parseMappedChunks(const char* fileName, const char* data, const FileRangeList& ranges);
+
+		/** Parses the gzip file or zip archive @a fileName by passing the inflated document chunk wise to
+		the push parser. If @a ranges is not 0, only these ranges of the inflated document are passed.*/
+		bool parseCompressedFile(const char* fileName, const FileRangeList* ranges);
+
 		void abortParsing();
 
 	};
@@ -0,0 +1,73 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
+#define __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+
+
+namespace GeneratedSaxParser
+{
+	/** Read only memory mapping of an entire file. The mapped pages can be passed directly to the xml
+	parsers, without reading the file into an intermediate buffer. The operating system is advised, that
+	the pages will be accessed sequentially.*/
+	class MemoryMappedFile
+	{
+	private:
+		/** Pointer to the first byte of the mapped file or 0, if no file is mapped.*/
+		const char* mData;
+
+		/** The size of the mapped file in bytes.*/
+		size_t mSize;
+
+#if defined(COLLADABU_OS_WIN)
+		/** Handle of the opened file.*/
+		void* mFileHandle;
+
+		/** Handle of the file mapping object.*/
+		void* mMappingHandle;
+#else
+		/** File descriptor of the opened file.*/
+		int mFileDescriptor;
+#endif
+
+	public:
+		MemoryMappedFile();
+
+		/** Unmaps the file, if it is still mapped.*/
+		~MemoryMappedFile();
+
+		/** Maps the file @a fileName into memory. A previously mapped file is unmapped.
+		@return True on success, false if the file could not be opened or mapped.*/
+		bool open( const char* fileName );
+
+		/** Unmaps the file and closes all handles.*/
+		void close();
+
+		/** Returns true, if a file is currently mapped.*/
+		bool isOpen() const;
+
+		/** Returns a pointer to the first byte of the mapped file. Might be 0 for empty files.*/
+		const char* getData() const { return mData; }
+
+		/** Returns the size of the mapped file in bytes.*/
+		size_t getSize() const { return mSize; }
+
+	private:
+		/** Disable default copy ctor. */
+		MemoryMappedFile( const MemoryMappedFile& pre );
+		/** Disable default assignment operator. */
+		const MemoryMappedFile& operator= ( const MemoryMappedFile& pre );
+
+	};
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_MEMORYMAPPEDFILE_H__
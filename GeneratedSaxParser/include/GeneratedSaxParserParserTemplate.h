@@ -13,6 +13,7 @@
 
 #include "GeneratedSaxParserPrerequisites.h"
 #include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserSaxParser.h"
 #include "GeneratedSaxParserStackMemoryManager.h"
 #include "GeneratedSaxParserUtils.h"
 #include "GeneratedSaxParserParserTemplateBase.h"
@@ -23,6 +24,7 @@
 
 #include <map>
 #include <stack>
+#include <vector>
 #include <string.h>
 
 
@@ -67,31 +69,9 @@ namespace GeneratedSaxParser
         typedef bool ( DerivedClass::*FreeAttributesFunctionPtr ) ( void* attributeData );
 
 
+		/** Generated methods of an element. An aggregate, to allow constant tables of it. */
 		struct FunctionStruct
 		{
-			FunctionStruct()
-				: beginFunction(0),
-				textDataFunction(0),
-				endFunction(0),
-				validateBeginFunction(0),
-				validateEndFunction(0),
-				freeAttributesFunction(0)
-			{}
-
-			FunctionStruct( ElementBeginFunctionPtr _beginFunction,
-				TextDataFunctionPtr _textDataFunction,
-				ElementEndFunctionPtr _endFunction,
-				ElementValidateBeginFunctionPtr _validateBeginFunction,
-				ElementValidateEndFunctionPtr _validateEndFunction,
-                FreeAttributesFunctionPtr _freeAttributesFunction)
-				: beginFunction(_beginFunction),
-				textDataFunction(_textDataFunction),
-				endFunction(_endFunction),
-				validateBeginFunction(_validateBeginFunction),
-				validateEndFunction(_validateEndFunction),
-                freeAttributesFunction(_freeAttributesFunction)
-			{}
-
 			ElementBeginFunctionPtr beginFunction;
 			TextDataFunctionPtr textDataFunction;
 			ElementEndFunctionPtr endFunction;
@@ -101,12 +81,129 @@ namespace GeneratedSaxParser
 		};
 
     public:
-		typedef std::map<StringHash, FunctionStruct> ElementFunctionMap;
+        /** Generated methods of an element together with the hashes of the element and its XML namespace. */
+        struct ElementFunctionEntry
+        {
+            StringHash elementHash;
+            StringHash namespaceHash;
+            FunctionStruct functions;
+        };
+
+        /** Constant table of the generated methods of all elements, created by the code generator.
+        The entries are placed using a perfect hash of the generated element hashes. The code generator
+        chooses the displacements such that the slot
+        ( ( hash ^ displacements[hash & displacementMask] ) * PERFECT_HASH_MULTIPLIER ) >> slotShift
+        is different for each element. Unused slots have element hash 0. */
+        struct ElementFunctionTable
+        {
+            /** Must be the same as used by the code generator. */
+            static const unsigned int PERFECT_HASH_MULTIPLIER = 2654435761u;
+
+            const ElementFunctionEntry* entries;
+            const unsigned int* displacements;
+            unsigned int displacementMask;
+            unsigned int slotShift;
+
+            /** Returns the number of slots in entries. */
+            size_t getSlotCount() const { return (size_t)1 << (32 - slotShift); }
+
+            /** Returns the entry of the element with given generated hash or 0 if there is none. */
+            const ElementFunctionEntry* find( StringHash elementHash ) const
+            {
+                unsigned int hash = (unsigned int)elementHash;
+                unsigned int slot = ( ( hash ^ displacements[hash & displacementMask] ) * PERFECT_HASH_MULTIPLIER ) >> slotShift;
+                const ElementFunctionEntry* entry = entries + slot;
+                if ( entry->elementHash != elementHash || elementHash == 0 )
+                    return 0;
+                return entry;
+            }
+        };
+
+        /** Elements whose generated methods are called. Contains all elements of an ElementFunctionTable
+        or a subset of them. */
+        class ElementFunctionMap
+        {
+        private:
+            /** Table of the elements. 0 if the map is empty. */
+            const ElementFunctionTable* mTable;
+            /** True if the map contains all elements of mTable. */
+            bool mComplete;
+            /** Slots of mTable contained in the map, if it is not complete. */
+            std::vector<bool> mSlots;
+            /** Number of contained slots. */
+            size_t mSlotCount;
+
+        public:
+            /** Creates an empty map. */
+            ElementFunctionMap()
+                : mTable(0), mComplete(false), mSlotCount(0) {}
+
+            /** Creates a map containing all elements of @a table. */
+            explicit ElementFunctionMap( const ElementFunctionTable& table )
+                : mTable(&table), mComplete(true), mSlotCount(0) {}
+
+            /** Creates a map containing the elements of @a table with the given generated hashes. */
+            ElementFunctionMap( const ElementFunctionTable& table, const StringHash* elementHashes, size_t elementCount )
+                : mTable(&table), mComplete(false), mSlots(table.getSlotCount(), false), mSlotCount(0)
+            {
+                for ( size_t i = 0; i < elementCount; ++i )
+                {
+                    const ElementFunctionEntry* entry = table.find( elementHashes[i] );
+                    if ( entry && !mSlots[entry - table.entries] )
+                    {
+                        mSlots[entry - table.entries] = true;
+                        ++mSlotCount;
+                    }
+                }
+            }
+
+            /** Returns true if the map contains no element. */
+            bool empty() const { return !mComplete && mSlotCount == 0; }
+
+            /** Returns the table of the elements or 0 if the map is empty. */
+            const ElementFunctionTable* getTable() const { return empty() ? 0 : mTable; }
+
+            /** Adds the elements of @a map. Both maps must use the same table. */
+            void insert( const ElementFunctionMap& map )
+            {
+                if ( mComplete || map.empty() )
+                    return;
+                mTable = map.mTable;
+                if ( map.mComplete )
+                {
+                    mComplete = true;
+                    mSlots.clear();
+                    mSlotCount = 0;
+                    return;
+                }
+                mSlots.resize( map.mSlots.size(), false );
+                for ( size_t i = 0; i < mSlots.size(); ++i )
+                {
+                    if ( map.mSlots[i] && !mSlots[i] )
+                    {
+                        mSlots[i] = true;
+                        ++mSlotCount;
+                    }
+                }
+            }
+
+            /** Returns the entry of the element with given generated hash or 0 if the map does not contain it. */
+            const ElementFunctionEntry* find( StringHash elementHash ) const
+            {
+                if ( !mTable )
+                    return 0;
+                const ElementFunctionEntry* entry = mTable->find( elementHash );
+                if ( entry && !mComplete && !mSlots[entry - mTable->entries] )
+                    return 0;
+                return entry;
+            }
+        };
+
         typedef std::map<StringHash, INamespaceHandler*> NamespaceHandlerMap;
 
 
 	protected:
-        /** Map of element hashes to generated methods. Contains pointers to all methods. */
+        /** Map of element hashes to generated methods. Contains all elements. Set by the derived class. */
 		ElementFunctionMap mElementFunctionMap;
         /** Currently used function map. To ignore elements. */
         const ElementFunctionMap* mCurrentElementFunctionMap;
@@ -122,8 +219,6 @@ namespace GeneratedSaxParser
 
         /** Stack of XML namespace declarations. */
         NamespacesStack mNamespacesStack;
-        /** Generated-Element-Hash to XML-Namespace-Hash. */
-        NamespacePrefixesMap mElementToNamespaceMap;
         /** If true, generated methods are called even when xml namespace is wrong. */
         bool mLaxNamespaceHandling;
 
@@ -134,6 +229,10 @@ namespace GeneratedSaxParser
         size_t mUnknownElements;
         /** Number of elements that have been opened and are in a different namespace. */
         size_t mNamespaceElements;
+        /** True, if the outermost of the open unknown elements is passed to mUnknownHandler as a byte range. */
+        bool mCaptureUnknownElement;
+        /** Offset of the start tag of the outermost open unknown element, if mCaptureUnknownElement is true. */
+        size_t mUnknownElementOffset;
 
 
 	public:
@@ -147,7 +246,9 @@ namespace GeneratedSaxParser
               mLaxNamespaceHandling(false),
 			  mIgnoreElements(0),
               mUnknownElements(0),
-              mNamespaceElements(0)
+              mNamespaceElements(0),
+              mCaptureUnknownElement(false),
+              mUnknownElementOffset(0)
 		  {};
 		virtual ~ParserTemplate(){};
 
@@ -736,15 +837,21 @@ namespace GeneratedSaxParser
 		    bool failed = false;
 		    while ( !failed )
 		    {
-			    lastDataBufferIndex = dataBufferPos;
-			    DataType dataValue =toData(&dataBufferPos, bufferEnd, failed);
+                // convert as many values as fit into the typed buffer at once
+                size_t maxCount = TYPED_VALUES_BUFFER_SIZE - dataBufferIndex;
+#ifdef GENERATEDSAXPARSER_VALIDATION
+                // each value needs to be validated before it is added
+                if ( itemTypeValidationFunc != 0 )
+                    maxCount = 1;
+#endif
+			    size_t valueCount = Utils::toDataList<DataType, toData>(&dataBufferPos, bufferEnd, typedBuffer + dataBufferIndex, maxCount, &lastDataBufferIndex, failed);
 			    failed = failed | (dataBufferPos == bufferEnd);
-			    if ( !failed )
+			    if ( valueCount > 0 )
 			    {
 #ifdef GENERATEDSAXPARSER_VALIDATION
                     if ( itemTypeValidationFunc != 0)
                     {
-                        ParserError::ErrorType simpleTypeValidationResult = (itemTypeValidationFunc)(dataValue);
+                        ParserError::ErrorType simpleTypeValidationResult = (itemTypeValidationFunc)(typedBuffer[dataBufferIndex]);
                         if ( simpleTypeValidationResult != ParserError::SIMPLE_TYPE_VALIDATION_OK )
                         {
                             ParserChar msg[21];
@@ -759,8 +866,7 @@ namespace GeneratedSaxParser
                         }
                     }
 #endif
-				    typedBuffer[dataBufferIndex] = dataValue;
-				    ++dataBufferIndex;
+				    dataBufferIndex += valueCount;
 				    if ( dataBufferIndex == TYPED_VALUES_BUFFER_SIZE )
 				    {
 #ifdef GENERATEDSAXPARSER_VALIDATION
@@ -1089,8 +1195,27 @@ namespace GeneratedSaxParser
 #endif
             )
     {
-        size_t bufferSize = 1 * sizeof(DataType); // TODO find a sane start buffer size and make it a constant
+        // Reserve the buffer for all items up front, to convert them without growing and copying the
+        // buffer. The items are separated by white space, i.e. there is one item per token.
+        size_t itemCount = 0;
+        for ( const ParserChar* pos = text; *pos; )
+        {
+            while ( Utils::isWhiteSpace(*pos) )
+                ++pos;
+            if ( !*pos )
+                break;
+            ++itemCount;
+            while ( *pos && !Utils::isWhiteSpace(*pos) )
+                ++pos;
+        }
+        size_t bufferSize = (itemCount > 0 ? itemCount : 1) * sizeof(DataType);
         DataType* typedBuffer = (DataType*)mStackMemoryManager.newObject(bufferSize);
+        if ( !typedBuffer )
+        {
+            list.data = 0;
+            list.size = 0;
+            return false;
+        }
 
         size_t dataBufferIndex = 0;
         const ParserChar* dataBufferPos = text;
@@ -1123,13 +1248,21 @@ namespace GeneratedSaxParser
                     }
                 }
 #endif
-                typedBuffer[dataBufferIndex] = dataValue;
-                ++dataBufferIndex;
+                // the buffer has room for the counted items, it only grows if there are more
                 if ( (dataBufferIndex * sizeof(DataType)) == bufferSize )
                 {
                     typedBuffer = (DataType*)mStackMemoryManager.growObject(bufferSize);
+                    if ( !typedBuffer )
+                    {
+                        mStackMemoryManager.deleteObject();
+                        list.data = 0;
+                        list.size = 0;
+                        return false;
+                    }
                     bufferSize *= 2;
                 }
+                typedBuffer[dataBufferIndex] = dataValue;
+                ++dataBufferIndex;
             }
         }
 
@@ -1808,7 +1941,7 @@ namespace GeneratedSaxParser
         }
         if ( mUnknownElements > 0 )
         {
-            if ( mUnknownHandler != 0 )
+            if ( (mUnknownHandler != 0) && !mCaptureUnknownElement )
             {
                 return mUnknownHandler->textData( text, textLength );
             }
@@ -1825,17 +1958,16 @@ namespace GeneratedSaxParser
         if ( mElementDataStack.empty() )
             return false;
         ElementData elementData = mElementDataStack.back();
-        typename ElementFunctionMap::const_iterator it;
 
         const ElementFunctionMap* functionMapToUse;
         if ( mCurrentElementFunctionMap )
             functionMapToUse = mCurrentElementFunctionMap;
         else
             functionMapToUse = &mElementFunctionMap;
-		it = functionMapToUse->find(elementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
+		const ElementFunctionEntry* entry = functionMapToUse->find(elementData.generatedElementHash);
+		if ( !entry )
 			return true;
-		const FunctionStruct& functions = it->second;
+		const FunctionStruct& functions = entry->functions;
 
 		if ( !functions.textDataFunction || !(static_cast<DerivedClass*>(this)->*functions.textDataFunction)(text, textLength) )
 			return false;
@@ -1864,6 +1996,15 @@ namespace GeneratedSaxParser
         if ( mUnknownElements > 0 )
         {
             mUnknownElements--;
+            if ( mCaptureUnknownElement )
+            {
+                if ( mUnknownElements > 0 )
+                    return true;
+                mCaptureUnknownElement = false;
+                SaxParser* saxParser = getSaxParser();
+                size_t length = saxParser->getByteOffset() - mUnknownElementOffset;
+                return mUnknownHandler->elementRange( elementName, mUnknownElementOffset, length, saxParser->getDocumentBytes( mUnknownElementOffset, length ) );
+            }
             if ( mUnknownHandler != 0 )
             {
                 return mUnknownHandler->elementEnd( elementName );
@@ -1889,13 +2030,13 @@ namespace GeneratedSaxParser
             functionMapToUse = mCurrentElementFunctionMap;
         else
             functionMapToUse = &mElementFunctionMap;
-        typename ElementFunctionMap::const_iterator it = functionMapToUse->find(elementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
+        const ElementFunctionEntry* entry = functionMapToUse->find(elementData.generatedElementHash);
+		if ( !entry )
         {
             mElementDataStack.pop_back();
 			return false;
         }
-		const FunctionStruct& functions = it->second;
+		const FunctionStruct& functions = entry->functions;
 
 		if ( !functions.validateEndFunction || !(static_cast<DerivedClass*>(this)->*functions.validateEndFunction)())
         {
@@ -1933,7 +2074,7 @@ namespace GeneratedSaxParser
         if ( mUnknownElements > 0 )
         {
             mUnknownElements++;
-            if ( mUnknownHandler != 0 )
+            if ( (mUnknownHandler != 0) && !mCaptureUnknownElement )
             {
                 return mUnknownHandler->elementBegin( elementName, attributes.attributes );
             }
@@ -1972,11 +2113,12 @@ namespace GeneratedSaxParser
         newElementData.validationData = 0;
         bool foundElementHash = findElementHash( newElementData );
 
+        const ElementFunctionEntry* entry = 0;
         bool correctNamespace = false;
         if ( foundElementHash )
         {
-            typename NamespacePrefixesMap::const_iterator nsFromMap = mElementToNamespaceMap.find( newElementData.generatedElementHash );
-            if ( nsFromMap != mElementToNamespaceMap.end() && nsFromMap->second == namespaceHash )
+            entry = mElementFunctionMap.find( newElementData.generatedElementHash );
+            if ( entry && entry->namespaceHash == namespaceHash )
             {
                 correctNamespace = true;
             }
@@ -1987,10 +2129,11 @@ namespace GeneratedSaxParser
             functionMapToUse = mCurrentElementFunctionMap;
         else
             functionMapToUse = &mElementFunctionMap;
-        typename ElementFunctionMap::const_iterator it = functionMapToUse->end();
-        if ( foundElementHash && (correctNamespace || mLaxNamespaceHandling) )
-            it = functionMapToUse->find(newElementData.generatedElementHash);
-		if ( it == functionMapToUse->end() )
+        if ( !correctNamespace && !mLaxNamespaceHandling )
+            entry = 0;
+        else if ( entry && functionMapToUse != &mElementFunctionMap )
+            entry = functionMapToUse->find(newElementData.generatedElementHash);
+		if ( !entry )
 		{
             INamespaceHandler* nsHandler = mNamespaceHandlers[ namespaceHash ];
             if ( nsHandler != 0 )
@@ -2005,8 +2148,7 @@ namespace GeneratedSaxParser
             }
             else
             {
-                it = mElementFunctionMap.find(newElementData.elementHash);
-                if ( it != mElementFunctionMap.end() && correctNamespace )
+                if ( mElementFunctionMap.find(newElementData.elementHash) && correctNamespace )
                 {
                     mIgnoreElements = 1;
                 }
@@ -2023,6 +2165,14 @@ namespace GeneratedSaxParser
             {
                 if ( mUnknownHandler != 0 )
                 {
+                    // The elements inside a captured element are only counted, its bytes are passed at its end
+                    SaxParser* saxParser = getSaxParser();
+                    if ( saxParser && saxParser->isDocumentInMemory() && mUnknownHandler->captureElementRanges() )
+                    {
+                        mCaptureUnknownElement = true;
+                        mUnknownElementOffset = saxParser->getStartTagByteOffset();
+                        return true;
+                    }
                     return mUnknownHandler->elementBegin( elementName, attributes.attributes );
                 }
                 else
@@ -2041,7 +2191,7 @@ namespace GeneratedSaxParser
                 }
             }
 		}
-		const FunctionStruct& functions = it->second;
+		const FunctionStruct& functions = entry->functions;
 
 		void* attributeData = 0;
 		void* validationData = 0;
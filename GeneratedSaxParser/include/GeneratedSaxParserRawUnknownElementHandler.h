@@ -15,6 +15,7 @@
 #include "GeneratedSaxParserIUnknownElementHandler.h"
 
 #include <stack>
+#include <vector>
 
 namespace GeneratedSaxParser
 {
@@ -22,6 +23,16 @@ namespace GeneratedSaxParser
 	that is reported through the IUnknownElementHandler in a string.*/
 	class RawUnknownElementHandler : public IUnknownElementHandler 
 	{
+	public:
+		/** The bytes an outermost element occupies in the parsed document.*/
+		struct ElementRange
+		{
+			size_t offset;   //!< The offset of the '<' of its start tag
+			size_t length;   //!< The number of bytes up to and including its end tag
+		};
+
+		typedef std::vector<ElementRange> ElementRangeList;
+
 	private:
 		struct OpenTag
 		{
@@ -40,6 +51,12 @@ namespace GeneratedSaxParser
 
 		OpenTagsStack mOpenTags;  //!< A stack that holds all the open tags.
 
+		/** True, if the outermost elements are captured as byte ranges of the document.*/
+		bool mCaptureElementRanges;
+
+		/** The ranges of the outermost elements captured since the last call of clearRawData().*/
+		ElementRangeList mElementRanges;
+
 	public:
 		RawUnknownElementHandler();
 		virtual ~RawUnknownElementHandler();
@@ -50,9 +67,23 @@ namespace GeneratedSaxParser
 		virtual bool elementBegin( const ParserChar* elementName, const xmlChar** attributes);
 		virtual bool elementEnd(const ParserChar* elementName);
 		virtual bool textData(const ParserChar* text, size_t textLength);
+		virtual bool captureElementRanges() { return mCaptureElementRanges; }
+		virtual bool elementRange( const ParserChar* elementName, size_t offset, size_t length, const ParserChar* bytes );
+
+		/** If @a capture is true, outermost elements are not serialized from their events, if the
+		document is resident in memory. Their bytes are appended to the raw data as they are, in one
+		piece, and their ranges are recorded. Comments, entity references and the formatting of the
+		document are preserved in this case.*/
+		void setCaptureElementRanges( bool capture ) { mCaptureElementRanges = capture; }
+
+		/** Returns true, if outermost elements are captured as byte ranges of the document.*/
+		bool getCaptureElementRanges() const { return mCaptureElementRanges; }
+
+		/** Returns the ranges of the outermost elements captured since the last call of clearRawData().*/
+		const ElementRangeList& getElementRanges() const { return mElementRanges; }
 
-		/** Clears the string containing the raw data.*/
-		void clearRawData() {mRawData.clear();}
+		/** Clears the string containing the raw data and the captured element ranges.*/
+		void clearRawData() {mRawData.clear(); mElementRanges.clear();}
 
 		/** Returns the raw data.*/
 		const String& getRawData() { return mRawData; }
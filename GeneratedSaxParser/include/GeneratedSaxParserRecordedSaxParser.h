@@ -0,0 +1,76 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_RECORDEDSAXPARSER_H__
+#define __GENERATEDSAXPARSER_RECORDEDSAXPARSER_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserTypes.h"
+#include "GeneratedSaxParserSaxParser.h"
+
+#include <vector>
+
+
+namespace GeneratedSaxParser
+{
+	class Parser;
+	class SaxEventRecorder;
+
+	/** Sax parser that does not parse any xml, but replays the events recorded by a SaxEventRecorder.
+	The parser receives exactly the same callbacks, line and column numbers and errors, it would
+	have received, if the file had been parsed directly.*/
+	class RecordedSaxParser : public SaxParser
+	{
+	private:
+		/** The recording to replay.*/
+		const SaxEventRecorder& mRecording;
+
+		/** Line number of the event currently replayed.*/
+		size_t mLineNumber;
+
+		/** Column number of the event currently replayed.*/
+		size_t mColumnNumber;
+
+		/** Zero terminated attribute array passed to Parser::elementBegin().*/
+		std::vector<const ParserChar*> mAttributes;
+
+	public:
+		RecordedSaxParser(Parser* parser, const SaxEventRecorder& recording);
+		virtual ~RecordedSaxParser();
+
+		/** Passes all recorded events to the parser. Replaying stops, as soon as the parser returns false.
+		@return The value returned by the xml parser, when the events have been recorded.*/
+		bool replay();
+
+		/** Replays the recording. @a fileName is ignored.*/
+		bool parseFile(const char* fileName);
+		/** Replays the recording. @a fileName is ignored.*/
+		bool parseMappedFile(const char* fileName);
+		/** Replays the recording. @a uri, @a buffer and @a length are ignored.*/
+		bool parseBuffer(const char* uri, const char* buffer, int length);
+		/** Replays the recording. @a fileName and @a ranges are ignored.*/
+		bool parseFileRanges(const char* fileName, const FileRangeList& ranges);
+
+		size_t getLineNumer()const;
+		size_t getColumnNumer()const;
+		/** Byte offsets are not recorded. Returns 0.*/
+		size_t getByteOffset()const;
+		size_t getStartTagByteOffset()const;
+
+	private:
+        /** Disable default copy ctor. */
+		RecordedSaxParser( const RecordedSaxParser& pre );
+        /** Disable default assignment operator. */
+		const RecordedSaxParser& operator= ( const RecordedSaxParser& pre );
+
+	};
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_RECORDEDSAXPARSER_H__
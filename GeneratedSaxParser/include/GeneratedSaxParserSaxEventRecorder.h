@@ -0,0 +1,146 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_SAXEVENTRECORDER_H__
+#define __GENERATEDSAXPARSER_SAXEVENTRECORDER_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserIErrorHandler.h"
+
+#include <vector>
+
+
+namespace GeneratedSaxParser
+{
+	class SaxParser;
+
+	/** Parses a file and records all the callbacks of the xml parser, i.e. elements, character data and
+	errors, including their line and column numbers. The recording can be replayed into any other parser
+	using a RecordedSaxParser. Different instances do not share any state, so files can be recorded on
+	different threads concurrently, as long as initializeConcurrentRecording() has been called first.*/
+	class SaxEventRecorder : public Parser, public IErrorHandler
+	{
+	public:
+		/** The different callbacks that are recorded.*/
+		enum EventType
+		{
+			ELEMENT_BEGIN,          //!< elementBegin(), the data contains the name and the attributes
+			ELEMENT_END,            //!< elementEnd(), the data contains the name
+			TEXT_DATA,              //!< textData(), the data contains the characters
+			PARSER_ERROR            //!< handleError(), the data offset is the index of the recorded error
+		};
+
+		/** A recorded callback.*/
+		struct Event
+		{
+			EventType type;
+
+			/** Line number reported by the xml parser, when the event was recorded.*/
+			size_t lineNumber;
+
+			/** Column number reported by the xml parser, when the event was recorded.*/
+			size_t columnNumber;
+
+			/** Position of the first character of the event in the data buffer.*/
+			size_t dataOffset;
+
+			/** For TEXT_DATA the number of characters, for ELEMENT_BEGIN the number of zero terminated
+			attribute names and values following the element name.*/
+			size_t dataSize;
+		};
+
+		/** A recorded error. Holds copies of all the strings of the original ParserError.*/
+		struct RecordedError
+		{
+			ParserError::Severity severity;
+			ParserError::ErrorType errorType;
+			bool hasElementName;
+			String elementName;
+			bool hasAttributeName;
+			String attributeName;
+			size_t lineNumber;
+			size_t columnNumber;
+			String additionalText;
+		};
+
+		typedef std::vector<Event> EventList;
+
+		typedef std::vector<RecordedError> RecordedErrorList;
+
+	private:
+		/** All recorded events in the order they have been reported by the xml parser.*/
+		EventList mEvents;
+
+		/** Element names, attributes and character data of all events.*/
+		std::vector<ParserChar> mData;
+
+		/** All recorded errors.*/
+		RecordedErrorList mErrors;
+
+		/** The value returned by the xml parser.*/
+		bool mSuccess;
+
+	public:
+		SaxEventRecorder();
+		virtual ~SaxEventRecorder();
+
+		/** Must be called once on the main thread, before files are recorded on other threads.*/
+		static void initializeConcurrentRecording();
+
+		/** Parses the file @a fileName and records all events. Previous recordings are discarded.
+		@param memoryMapped If true, the file is memory mapped instead of read chunk wise.
+		@return The value returned by the xml parser.*/
+		bool record( const char* fileName, bool memoryMapped );
+
+		/** Returns all recorded events.*/
+		const EventList& getEvents() const { return mEvents; }
+
+		/** Returns the characters of all events.*/
+		const ParserChar* getData() const { return mData.empty() ? 0 : &mData[0]; }
+
+		/** Returns all recorded errors.*/
+		const RecordedErrorList& getErrors() const { return mErrors; }
+
+		/** Returns the value the xml parser returned when the file was recorded.*/
+		bool getSuccess() const { return mSuccess; }
+
+		/** Releases all recorded events.*/
+		void clear();
+
+		virtual bool elementBegin( const ParserChar* elementName, const ParserAttributes& attributes );
+		virtual bool elementEnd( const ParserChar* elementName );
+		virtual bool textData( const ParserChar* text, size_t textLength );
+
+		virtual bool handleError( const ParserError& error );
+		virtual void beginReporting() {}
+		virtual void endReporting() {}
+		virtual bool hasErrors() const { return !mErrors.empty(); }
+		virtual bool hasCriticalError() const;
+
+	private:
+        /** Disable default copy ctor. */
+		SaxEventRecorder( const SaxEventRecorder& pre );
+        /** Disable default assignment operator. */
+		const SaxEventRecorder& operator= ( const SaxEventRecorder& pre );
+
+		/** Appends an event of type @a type at the current position of the xml parser.*/
+		Event& addEvent( EventType type );
+
+		/** Appends @a length characters of @a text to the data buffer.*/
+		void appendData( const ParserChar* text, size_t length );
+
+		/** Appends the zero terminated string @a text including the terminating zero to the data buffer.*/
+		void appendString( const ParserChar* text );
+
+	};
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_SAXEVENTRECORDER_H__
@@ -13,6 +13,8 @@
 
 #include "GeneratedSaxParserPrerequisites.h"
 
+#include <vector>
+
 
 namespace GeneratedSaxParser
 {
@@ -20,22 +22,76 @@ namespace GeneratedSaxParser
 
 	class SaxParser
 	{
+	public:
+		/** The bytes [begin, end) of a file.*/
+		struct FileRange
+		{
+			size_t begin;
+			size_t end;
+		};
+
+		typedef std::vector<FileRange> FileRangeList;
 
 	private:
 		Parser* mParser;
+
+		/** The memory resident bytes of the currently parsed document or 0, if it is not memory resident.*/
+		const char* mDocumentData;
+
+		/** The ranges of mDocumentData, whose concatenation is the parsed document.*/
+		FileRangeList mDocumentRanges;
+
 	public:
 		SaxParser(Parser* parser);
 		virtual ~SaxParser();
 		
+		/** Parses the file @a fileName. Gzip files and zip archives (zae) are detected by their first bytes and
+		inflated chunk wise while they are parsed, see CompressedFileReader. This applies to parseMappedFile and
+		parseFileRanges as well, the ranges then refer to the inflated document.*/
 		virtual bool parseFile(const char* fileName)=0;
+		/** Maps the file @a fileName into memory and passes the mapped pages directly to the xml parser,
+		instead of reading it chunk wise into an intermediate buffer.*/
+		virtual bool parseMappedFile(const char* fileName)=0;
 		virtual bool parseBuffer(const char* uri, const char* buffer, int length)=0;
+		/** Parses only the byte ranges @a ranges of the file @a fileName, as if their concatenation was the 
+		document. The file is memory mapped, the bytes between the ranges are not read at all. Ranges that 
+		exceed the file are cut.*/
+		virtual bool parseFileRanges(const char* fileName, const FileRangeList& ranges)=0;
 
 		virtual size_t getLineNumer()const=0;
 		virtual size_t getColumnNumer()const=0;
 
+		/** Returns the offset of the first byte behind the current event in the parsed document, i.e. behind 
+		the start tag in Parser::elementBegin(), behind the end tag in Parser::elementEnd() and behind the 
+		text in Parser::textData(). Only valid while the parser is called.*/
+		virtual size_t getByteOffset()const=0;
+
+		/** Returns the offset of the '<' of the start tag in Parser::elementBegin(), in the same document
+		as getByteOffset(). Only valid while Parser::elementBegin() is called.*/
+		virtual size_t getStartTagByteOffset()const=0;
+
+		/** Returns true, if the bytes of the parsed document are resident in memory, i.e. if it is parsed by
+		parseMappedFile(), parseFileRanges() or parseBuffer() and is not compressed. Only valid while the
+		parser is called.*/
+		bool isDocumentInMemory()const { return mDocumentData != 0; }
+
+		/** Returns the @a length bytes of the parsed document starting at @a offset, an offset as returned
+		by getByteOffset(), without copying them. Returns 0, if the document is not resident in memory or if
+		the bytes are not contiguous, because they belong to different ranges passed to parseFileRanges().
+		The bytes remain valid until parsing has finished.*/
+		const char* getDocumentBytes(size_t offset, size_t length)const;
+
 		Parser* getParser(){return mParser;}
         void setParser( Parser* parser );
 
+	protected:
+		/** Makes the concatenation of the ranges @a ranges of @a data available through getDocumentBytes(),
+		while it is parsed. Must be reset by passing 0 before @a data is released.*/
+		void setDocumentData(const char* data, const FileRangeList& ranges);
+
+		/** Makes the @a length bytes at @a data available through getDocumentBytes(), while they are parsed.*/
+		void setDocumentData(const char* data, size_t length);
+
 	private:
         /** Disable default copy ctor. */
 		SaxParser( const SaxParser& pre );
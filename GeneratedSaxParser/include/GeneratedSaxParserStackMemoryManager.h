@@ -71,7 +71,8 @@ namespace GeneratedSaxParser
 
         inline void writeNewObjectSize(size_t position, size_t size);
 
-        bool allocateMoreMemory();
+        /** Allocates a new frame, twice as large as the active one, but at least @a minimumSize bytes.*/
+        bool allocateMoreMemory(size_t minimumSize);
 
     private:
 		/** Disable default copy ctor. */
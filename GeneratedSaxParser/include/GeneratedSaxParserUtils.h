@@ -129,6 +129,34 @@ namespace GeneratedSaxParser
         static double toDouble(const ParserChar** buffer, bool& failed);
 
 
+        /** Converts a run of whitespace separated floats within a ParserChar buffer in one call. Conversion 
+		stops after @a maxCount values, at the first value that could not be converted, in which case failed is 
+		set to true, or at the first value that reaches bufferEnd, since it might be continued in the next 
+		chunk of character data. The value conversion stopped at is not written to @a values. Values are 
+		bit identical to those returned by toFloat(). The common notations are converted by a vectorized 
+		kernel, selected at runtime (AVX2, SSE2 or scalar), all others are passed to toFloat().
+		@param buffer Pointer to the first character in the buffer. Will be set to the first 
+		character after the last converted value or to bufferEnd.
+		@param bufferEnd the first character after the last in the buffer
+		@param values Array receiving the converted values. Must have space for @a maxCount values.
+		@param maxCount The maximum number of values to convert.
+		@param lastValueStart Will be set to the position the conversion of the last value started at.
+		@param failed True, if the conversion of a value failed, false otherwise.
+		@return The number of values written to @a values.*/
+		static size_t toFloatList(const ParserChar** buffer, const ParserChar* bufferEnd, float* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed);
+
+		/** @see toFloatList(). Values are bit identical to those returned by toDouble().*/
+		static size_t toDoubleList(const ParserChar** buffer, const ParserChar* bufferEnd, double* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed);
+
+		/** @see toFloatList(). Values are identical to those returned by toUint64().*/
+		static size_t toUint64List(const ParserChar** buffer, const ParserChar* bufferEnd, uint64* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed);
+
+		/** Converts a run of values using @a toData for each value, with the semantics of toFloatList(). 
+		Specialized for the types that have a bulk conversion, i.e. toFloat, toDouble and toUint64.*/
+		template<class DataType, DataType (*toData)( const ParserChar**, const ParserChar*, bool& )>
+		static size_t toDataList(const ParserChar** buffer, const ParserChar* bufferEnd, DataType* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed);
+
+
         /**
          * Extracts a string of a string list (char data).
          *
@@ -463,6 +491,44 @@ namespace GeneratedSaxParser
 
 	};
 
+    //--------------------------------------------------------------------
+    template<class DataType, DataType (*toData)( const ParserChar**, const ParserChar*, bool& )>
+    size_t Utils::toDataList( const ParserChar** buffer, const ParserChar* bufferEnd, DataType* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+    {
+        size_t count = 0;
+        failed = false;
+        while ( count < maxCount )
+        {
+            *lastValueStart = *buffer;
+            DataType value = toData(buffer, bufferEnd, failed);
+            if ( failed || (*buffer == bufferEnd) )
+                break;
+            values[count++] = value;
+        }
+        return count;
+    }
+
+    //--------------------------------------------------------------------
+    template<>
+    inline size_t Utils::toDataList<float, &Utils::toFloat>( const ParserChar** buffer, const ParserChar* bufferEnd, float* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+    {
+        return toFloatList(buffer, bufferEnd, values, maxCount, lastValueStart, failed);
+    }
+
+    //--------------------------------------------------------------------
+    template<>
+    inline size_t Utils::toDataList<double, &Utils::toDouble>( const ParserChar** buffer, const ParserChar* bufferEnd, double* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+    {
+        return toDoubleList(buffer, bufferEnd, values, maxCount, lastValueStart, failed);
+    }
+
+    //--------------------------------------------------------------------
+    template<>
+    inline size_t Utils::toDataList<uint64, &Utils::toUint64>( const ParserChar** buffer, const ParserChar* bufferEnd, uint64* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+    {
+        return toUint64List(buffer, bufferEnd, values, maxCount, lastValueStart, failed);
+    }
+
     //--------------------------------------------------------------------
     template<class EnumType, class BaseType, EnumType EnumMapCount>
 	EnumType GeneratedSaxParser::Utils::toEnum( const ParserChar* buffer, 
@@ -0,0 +1,72 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __GENERATEDSAXPARSER_XMLSCANNER_H__
+#define __GENERATEDSAXPARSER_XMLSCANNER_H__
+
+#include "GeneratedSaxParserPrerequisites.h"
+#include "GeneratedSaxParserTypes.h"
+
+
+namespace GeneratedSaxParser
+{
+	/** Scans the raw bytes of an xml document in memory for its markup, without tokenizing it. Character
+	data is skipped by searching the next '<' with memchr, attribute values, comments, processing
+	instructions, CDATA sections and document type declarations are skipped as a whole. This allows to
+	find the end of an element, e.g. a library that is not required, many times faster than an xml
+	parser reports the events inside it. The document is not validated, the scanner only relies on the
+	markup being well formed. It works on all encodings that are compatible with ASCII, e.g. UTF-8.*/
+	class XmlScanner
+	{
+	public:
+		enum MarkupType
+		{
+			MARKUP_START_TAG,          //!< The start tag of an element with content
+			MARKUP_EMPTY_ELEMENT_TAG,  //!< The tag of an empty element, i.e. <name/>
+			MARKUP_END_TAG,            //!< The end tag of an element
+			MARKUP_OTHER               //!< A comment, processing instruction, CDATA section or document type declaration
+		};
+
+		/** Returns the first '<' in [ @a pos, @a bufferEnd ) or @a bufferEnd, if there is none.*/
+		static const ParserChar* findMarkup( const ParserChar* pos, const ParserChar* bufferEnd );
+
+		/** Skips the markup that starts with the '<' at @a markup.
+		@param type Set to the type of the markup.
+		@return The first character behind the markup or 0, if the markup is not complete before
+		@a bufferEnd.*/
+		static const ParserChar* skipMarkup( const ParserChar* markup, const ParserChar* bufferEnd, MarkupType& type );
+
+		/** Skips the element whose start tag or empty element tag starts with the '<' at @a element,
+		including all nested elements.
+		@return The first character behind the end tag of the element or 0, if the element does not end
+		before @a bufferEnd.*/
+		static const ParserChar* skipElement( const ParserChar* element, const ParserChar* bufferEnd );
+
+		/** Returns the name of the element whose tag starts with the '<' at @a tag. @a nameLength is set
+		to the number of characters of the name, including a namespace prefix.*/
+		static const ParserChar* getElementName( const ParserChar* tag, const ParserChar* bufferEnd, size_t& nameLength );
+
+	private:
+		/** Returns the first character behind the first occurrence of the @a terminatorLength characters
+		@a terminator in [ @a pos, @a bufferEnd ) or 0, if there is none.*/
+		static const ParserChar* skipBehind( const ParserChar* pos, const ParserChar* bufferEnd, const char* terminator, size_t terminatorLength );
+
+		/** Skips a tag starting at @a pos, the first character behind the '<'. Quoted attribute values may
+		contain '>'. Returns the first character behind the '>' or 0.*/
+		static const ParserChar* skipTag( const ParserChar* pos, const ParserChar* bufferEnd, bool& empty );
+
+		/** Skips a document type declaration starting at @a pos, the first character behind the "<!".
+		Returns the first character behind its '>' or 0.*/
+		static const ParserChar* skipDeclaration( const ParserChar* pos, const ParserChar* bufferEnd );
+
+	};
+} // namespace GeneratedSaxParser
+
+#endif // __GENERATEDSAXPARSER_XMLSCANNER_H__
@@ -0,0 +1,31 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef ___PERFORMANCETEST_H__
+#define ___PERFORMANCETEST_H__
+
+#include <stddef.h>
+
+/** Parses @a fileName @a repetitions times through the streamed and the memory mapped input path
+and prints the throughput of both.*/
+void performanceTest( const char* fileName, int repetitions );
+
+/** Converts a synthetic list of @a valueCount floats and indices @a repetitions times, value by value
+and with the bulk list conversion, and prints the throughput of both.*/
+void listConversionPerformanceTest( size_t valueCount, int repetitions );
+
+/** Writes a document with a mesh with @a vertexCount vertices and a small visual scene and loads it
+@a repetitions times without the geometries: once with all elements reported by the xml parser, as
+the loader ignores them, once with the library_geometries skipped by scanning the raw bytes with the
+XmlScanner. Prints the throughput of both.*/
+void elementSkippingPerformanceTest( size_t vertexCount, int repetitions );
+
+
+#endif // ___PERFORMANCETEST_H__
@@ -0,0 +1,480 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserCompressedFileReader.h"
+
+#include <cstring>
+#include <cctype>
+#include <cstdlib>
+
+#include "zlib.h"
+
+
+namespace GeneratedSaxParser
+{
+	/** Size of the buffer the compressed file is read into.*/
+	static const size_t INPUT_BUFFER_SIZE = 64*1024;
+
+	/** Size of the end of central directory record of a zip archive, without the comment.*/
+	static const size_t ZIP_END_RECORD_SIZE = 22;
+
+	/** Size of the fixed part of a central directory entry of a zip archive.*/
+	static const size_t ZIP_DIRECTORY_ENTRY_SIZE = 46;
+
+	/** Size of the fixed part of a local file header of a zip archive.*/
+	static const size_t ZIP_LOCAL_HEADER_SIZE = 30;
+
+	/** Maximum length of the comment of a zip archive.*/
+	static const size_t ZIP_MAX_COMMENT_SIZE = 0xffff;
+
+	static const char ZIP_LOCAL_HEADER_SIGNATURE[4] = { 'P', 'K', 3, 4 };
+	static const char ZIP_DIRECTORY_ENTRY_SIGNATURE[4] = { 'P', 'K', 1, 2 };
+	static const char ZIP_END_RECORD_SIGNATURE[4] = { 'P', 'K', 5, 6 };
+
+	static const int ZIP_METHOD_STORED = 0;
+	static const int ZIP_METHOD_DEFLATED = 8;
+
+	/** The manifest of a zae file.*/
+	static const char ZAE_MANIFEST[] = "manifest.xml";
+
+	//--------------------------------------------------------------------
+	static size_t readUInt16( const char* data )
+	{
+		const unsigned char* bytes = (const unsigned char*)data;
+		return (size_t)bytes[0] | ((size_t)bytes[1] << 8);
+	}
+
+	//--------------------------------------------------------------------
+	static size_t readUInt32( const char* data )
+	{
+		const unsigned char* bytes = (const unsigned char*)data;
+		return (size_t)bytes[0] | ((size_t)bytes[1] << 8) | ((size_t)bytes[2] << 16) | ((size_t)bytes[3] << 24);
+	}
+
+	//--------------------------------------------------------------------
+	static bool hasDaeExtension( const std::string& name )
+	{
+		size_t length = name.length();
+		return (length > 4) && (name[length - 4] == '.')
+			&& (tolower((unsigned char)name[length - 3]) == 'd')
+			&& (tolower((unsigned char)name[length - 2]) == 'a')
+			&& (tolower((unsigned char)name[length - 1]) == 'e');
+	}
+
+	//--------------------------------------------------------------------
+	/** Returns the path in the dae_root element of the zae manifest @a manifest, relative to the root of
+	the archive, or an empty string, if there is no dae_root element.*/
+	static std::string getDaeRoot( const std::string& manifest )
+	{
+		static const char BEGIN_TAG[] = "<dae_root>";
+		size_t begin = manifest.find( BEGIN_TAG );
+		if ( begin == std::string::npos )
+			return std::string();
+		begin += sizeof(BEGIN_TAG) - 1;
+		size_t end = manifest.find( '<', begin );
+		if ( end == std::string::npos )
+			return std::string();
+
+		while ( (begin < end) && isspace((unsigned char)manifest[begin]) )
+			++begin;
+		while ( (end > begin) && isspace((unsigned char)manifest[end - 1]) )
+			--end;
+		if ( (end - begin >= 2) && (manifest[begin] == '.') && (manifest[begin + 1] == '/') )
+			begin += 2;
+
+		// the path is an uri, unescape %xx sequences
+		std::string daeRoot;
+		daeRoot.reserve( end - begin );
+		for ( size_t i = begin; i < end; ++i )
+		{
+			char c = manifest[i];
+			if ( (c == '%') && (i + 2 < end) && isxdigit((unsigned char)manifest[i + 1]) && isxdigit((unsigned char)manifest[i + 2]) )
+			{
+				char hex[3] = { manifest[i + 1], manifest[i + 2], 0 };
+				c = (char)strtol( hex, 0, 16 );
+				i += 2;
+			}
+			daeRoot.push_back( c );
+		}
+		return daeRoot;
+	}
+
+	//--------------------------------------------------------------------
+	CompressedFileReader::CompressedFileReader()
+		: mFile( 0 )
+		, mFormat( FORMAT_UNCOMPRESSED )
+		, mZStream( 0 )
+		, mStored( false )
+		, mRemainingInputSize( 0 )
+		, mOffset( 0 )
+		, mRangeIndex( 0 )
+		, mEndOfDocument( true )
+		, mFailed( false )
+	{
+	}
+
+	//--------------------------------------------------------------------
+	CompressedFileReader::~CompressedFileReader()
+	{
+		close();
+	}
+
+	//--------------------------------------------------------------------
+	CompressedFileReader::Format CompressedFileReader::getFormat( const char* data, size_t length )
+	{
+		if ( (length >= 2) && ((unsigned char)data[0] == 0x1f) && ((unsigned char)data[1] == 0x8b) )
+			return FORMAT_GZIP;
+		if ( (length >= 4) && (memcmp(data, ZIP_LOCAL_HEADER_SIGNATURE, 4) == 0) )
+			return FORMAT_ZIP;
+		return FORMAT_UNCOMPRESSED;
+	}
+
+	//--------------------------------------------------------------------
+	CompressedFileReader::Format CompressedFileReader::getFormat( const char* fileName )
+	{
+		FILE* file = fopen( fileName, "rb" );
+		if ( !file )
+			return FORMAT_UNCOMPRESSED;
+		char magic[4];
+		size_t length = fread( magic, 1, sizeof(magic), file );
+		fclose( file );
+		return getFormat( magic, length );
+	}
+
+	//--------------------------------------------------------------------
+	bool CompressedFileReader::open( const char* fileName )
+	{
+		close();
+
+		mFile = fopen( fileName, "rb" );
+		if ( !mFile )
+			return false;
+
+		char magic[4];
+		mFormat = getFormat( magic, fread(magic, 1, sizeof(magic), mFile) );
+		mInput.resize( INPUT_BUFFER_SIZE );
+		mOffset = 0;
+		mRanges.clear();
+		mRangeIndex = 0;
+		mEndOfDocument = false;
+		mFailed = false;
+
+		bool success = false;
+		if ( mFormat == FORMAT_GZIP )
+			success = openGZip();
+		else if ( mFormat == FORMAT_ZIP )
+			success = openZip();
+
+		if ( !success )
+			close();
+		return success;
+	}
+
+	//--------------------------------------------------------------------
+	void CompressedFileReader::close()
+	{
+		if ( mFile )
+		{
+			fclose( mFile );
+			mFile = 0;
+		}
+		if ( mZStream )
+		{
+			inflateEnd( mZStream );
+			delete mZStream;
+			mZStream = 0;
+		}
+		mStored = false;
+		mEndOfDocument = true;
+	}
+
+	//--------------------------------------------------------------------
+	void CompressedFileReader::setRanges( const SaxParser::FileRangeList& ranges )
+	{
+		mRanges = ranges;
+		mRangeIndex = 0;
+	}
+
+	//--------------------------------------------------------------------
+	size_t CompressedFileReader::read( char* buffer, size_t length )
+	{
+		if ( mRanges.empty() )
+		{
+			size_t readLength = readDocument( buffer, length );
+			mOffset += readLength;
+			return readLength;
+		}
+
+		while ( mRangeIndex < mRanges.size() )
+		{
+			const SaxParser::FileRange& range = mRanges[mRangeIndex];
+			if ( mOffset >= range.end )
+			{
+				++mRangeIndex;
+				continue;
+			}
+
+			if ( mOffset < range.begin )
+			{
+				// inflate the bytes in front of the range into the buffer of the caller and drop them
+				size_t skipLength = range.begin - mOffset;
+				size_t readLength = readDocument( buffer, skipLength < length ? skipLength : length );
+				if ( readLength == 0 )
+					return 0;
+				mOffset += readLength;
+				continue;
+			}
+
+			size_t rangeLength = range.end - mOffset;
+			size_t readLength = readDocument( buffer, rangeLength < length ? rangeLength : length );
+			mOffset += readLength;
+			return readLength;
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	bool CompressedFileReader::openGZip()
+	{
+		if ( fseek(mFile, 0, SEEK_SET) != 0 )
+			return false;
+		// 16 selects the gzip header and trailer
+		return resetZStream( 16 + MAX_WBITS );
+	}
+
+	//--------------------------------------------------------------------
+	bool CompressedFileReader::openZip()
+	{
+		// The end of central directory record is at the end of the archive, followed only by the comment
+		if ( fseek(mFile, 0, SEEK_END) != 0 )
+			return false;
+		long fileSize = ftell( mFile );
+		if ( fileSize < (long)ZIP_END_RECORD_SIZE )
+			return false;
+
+		size_t tailSize = (size_t)fileSize < ZIP_END_RECORD_SIZE + ZIP_MAX_COMMENT_SIZE ? (size_t)fileSize : ZIP_END_RECORD_SIZE + ZIP_MAX_COMMENT_SIZE;
+		std::vector<char> tail( tailSize );
+		if ( (fseek(mFile, fileSize - (long)tailSize, SEEK_SET) != 0) || (fread(&tail[0], 1, tailSize, mFile) != tailSize) )
+			return false;
+
+		const char* endRecord = 0;
+		for ( size_t i = tailSize - ZIP_END_RECORD_SIZE + 1; i-- > 0; )
+		{
+			if ( memcmp(&tail[i], ZIP_END_RECORD_SIGNATURE, 4) == 0 )
+			{
+				endRecord = &tail[i];
+				break;
+			}
+		}
+		if ( !endRecord )
+			return false;
+
+		size_t entryCount = readUInt16( endRecord + 10 );
+		size_t directorySize = readUInt32( endRecord + 12 );
+		size_t directoryOffset = readUInt32( endRecord + 16 );
+		// zip64 archives are not supported
+		if ( (directoryOffset == 0xffffffff) || (directorySize == 0) )
+			return false;
+
+		std::vector<char> directory( directorySize );
+		if ( (fseek(mFile, (long)directoryOffset, SEEK_SET) != 0) || (fread(&directory[0], 1, directorySize, mFile) != directorySize) )
+			return false;
+
+		const ZipEntry* manifestEntry = 0;
+		std::vector<ZipEntry> entries;
+		entries.reserve( entryCount );
+		size_t position = 0;
+		for ( size_t i = 0; i < entryCount; ++i )
+		{
+			if ( (position + ZIP_DIRECTORY_ENTRY_SIZE > directorySize) || (memcmp(&directory[position], ZIP_DIRECTORY_ENTRY_SIGNATURE, 4) != 0) )
+				return false;
+
+			const char* header = &directory[position];
+			size_t flags = readUInt16( header + 8 );
+			size_t nameLength = readUInt16( header + 28 );
+			size_t entrySize = ZIP_DIRECTORY_ENTRY_SIZE + nameLength + readUInt16( header + 30 ) + readUInt16( header + 32 );
+			if ( position + entrySize > directorySize )
+				return false;
+			position += entrySize;
+
+			int method = (int)readUInt16( header + 10 );
+			bool encrypted = (flags & 1) != 0;
+			if ( encrypted || ((method != ZIP_METHOD_STORED) && (method != ZIP_METHOD_DEFLATED)) )
+				continue;
+
+			ZipEntry entry;
+			entry.name.assign( header + ZIP_DIRECTORY_ENTRY_SIZE, nameLength );
+			entry.method = method;
+			entry.compressedSize = readUInt32( header + 20 );
+			entry.localHeaderOffset = readUInt32( header + 42 );
+			entries.push_back( entry );
+		}
+
+		for ( size_t i = 0; i < entries.size(); ++i )
+		{
+			if ( entries[i].name == ZAE_MANIFEST )
+			{
+				manifestEntry = &entries[i];
+				break;
+			}
+		}
+
+		const ZipEntry* documentEntry = 0;
+		if ( manifestEntry )
+		{
+			std::string manifest;
+			if ( !readZipEntry(*manifestEntry, manifest) )
+				return false;
+			std::string daeRoot = getDaeRoot( manifest );
+			for ( size_t i = 0; (i < entries.size()) && !documentEntry; ++i )
+			{
+				if ( entries[i].name == daeRoot )
+					documentEntry = &entries[i];
+			}
+		}
+
+		for ( size_t i = 0; (i < entries.size()) && !documentEntry; ++i )
+		{
+			if ( hasDaeExtension(entries[i].name) )
+				documentEntry = &entries[i];
+		}
+
+		return documentEntry && startZipEntry( *documentEntry );
+	}
+
+	//--------------------------------------------------------------------
+	bool CompressedFileReader::readZipEntry( const ZipEntry& entry, std::string& data )
+	{
+		if ( !startZipEntry(entry) )
+			return false;
+
+		char buffer[4096];
+		size_t length = 0;
+		while ( (length = readDocument(buffer, sizeof(buffer))) > 0 )
+		{
+			data.append( buffer, length );
+		}
+		return !mFailed;
+	}
+
+	//--------------------------------------------------------------------
+	bool CompressedFileReader::startZipEntry( const ZipEntry& entry )
+	{
+		char localHeader[ZIP_LOCAL_HEADER_SIZE];
+		if ( (fseek(mFile, (long)entry.localHeaderOffset, SEEK_SET) != 0)
+			|| (fread(localHeader, 1, ZIP_LOCAL_HEADER_SIZE, mFile) != ZIP_LOCAL_HEADER_SIZE)
+			|| (memcmp(localHeader, ZIP_LOCAL_HEADER_SIGNATURE, 4) != 0) )
+		{
+			return false;
+		}
+
+		// the extra field of the local header may differ from the one in the central directory
+		long dataOffset = (long)(readUInt16( localHeader + 26 ) + readUInt16( localHeader + 28 ));
+		if ( fseek(mFile, dataOffset, SEEK_CUR) != 0 )
+			return false;
+
+		mStored = (entry.method == ZIP_METHOD_STORED);
+		mRemainingInputSize = entry.compressedSize;
+		mEndOfDocument = mStored && (entry.compressedSize == 0);
+		mFailed = false;
+
+		// negative window bits for raw deflate data
+		return mStored || resetZStream( -MAX_WBITS );
+	}
+
+	//--------------------------------------------------------------------
+	bool CompressedFileReader::resetZStream( int windowBits )
+	{
+		// inflateReset2 is not available in the bundled zlib
+		if ( mZStream )
+		{
+			inflateEnd( mZStream );
+		}
+		else
+		{
+			mZStream = new z_stream_s;
+		}
+		memset( mZStream, 0, sizeof(z_stream_s) );
+		if ( inflateInit2(mZStream, windowBits) != Z_OK )
+		{
+			delete mZStream;
+			mZStream = 0;
+			return false;
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	size_t CompressedFileReader::readDocument( char* buffer, size_t length )
+	{
+		if ( mEndOfDocument || mFailed || (length == 0) )
+			return 0;
+
+		if ( mStored )
+		{
+			size_t readLength = length < mRemainingInputSize ? length : mRemainingInputSize;
+			size_t bytesRead = fread( buffer, 1, readLength, mFile );
+			mRemainingInputSize -= bytesRead;
+			mFailed = (bytesRead != readLength);
+			mEndOfDocument = (mRemainingInputSize == 0);
+			return bytesRead;
+		}
+
+		mZStream->next_out = (Bytef*)buffer;
+		mZStream->avail_out = (uInt)length;
+		while ( (mZStream->avail_out > 0) && !mEndOfDocument )
+		{
+			if ( (mZStream->avail_in == 0) && !fillInput() )
+			{
+				// the compressed data ends before the end of the deflate stream
+				mFailed = true;
+				break;
+			}
+
+			int result = inflate( mZStream, Z_NO_FLUSH );
+			if ( result == Z_STREAM_END )
+			{
+				// a gzip file might consist of several members, which are concatenated
+				if ( (mFormat == FORMAT_GZIP) && ((mZStream->avail_in > 0) || fillInput()) )
+				{
+					mFailed = (inflateReset(mZStream) != Z_OK);
+					if ( mFailed )
+						break;
+				}
+				else
+				{
+					mEndOfDocument = true;
+				}
+			}
+			else if ( result != Z_OK )
+			{
+				mFailed = true;
+				break;
+			}
+		}
+		return length - mZStream->avail_out;
+	}
+
+	//--------------------------------------------------------------------
+	bool CompressedFileReader::fillInput()
+	{
+		size_t readLength = mInput.size();
+		if ( (mFormat == FORMAT_ZIP) && (mRemainingInputSize < readLength) )
+			readLength = mRemainingInputSize;
+		size_t bytesRead = readLength > 0 ? fread( &mInput[0], 1, readLength, mFile ) : 0;
+		if ( mFormat == FORMAT_ZIP )
+			mRemainingInputSize -= bytesRead;
+
+		mZStream->next_in = (Bytef*)&mInput[0];
+		mZStream->avail_in = (uInt)bytesRead;
+		return bytesRead > 0;
+	}
+
+} // namespace GeneratedSaxParser
@@ -18,6 +18,9 @@
 #include <stdio.h>
 #include <iostream>
 #include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserCompressedFileReader.h"
+#include <limits.h>
 
 
 namespace GeneratedSaxParser
@@ -51,7 +54,9 @@ namespace GeneratedSaxParser
 
 		XML_Status status = XML_STATUS_OK;
 		bool isFinal = true;
+		setDocumentData(buffer, (size_t)length);
 		XML_Parse(mParser, buffer, (int)length, isFinal);
+		setDocumentData(0, 0);
 
 		XML_ParserFree(mParser);
 
@@ -59,6 +64,9 @@ namespace GeneratedSaxParser
 	}
 	bool ExpatSaxParser::parseFile( const char* fileName )
 	{
+		if ( CompressedFileReader::getFormat(fileName) != CompressedFileReader::FORMAT_UNCOMPRESSED )
+			return parseCompressedFile(fileName, 0);
+
 		FILE *fd;
 		fd = fopen(fileName, "rb");
 		if (!fd)
@@ -90,6 +98,118 @@ namespace GeneratedSaxParser
 		return status != XML_STATUS_ERROR;
 	}
 
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::parseMappedFile( const char* fileName )
+	{
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName) )
+			return false;
+
+		if ( CompressedFileReader::getFormat(mappedFile.getData(), mappedFile.getSize()) != CompressedFileReader::FORMAT_UNCOMPRESSED )
+		{
+			mappedFile.close();
+			return parseCompressedFile(fileName, 0);
+		}
+
+		FileRangeList ranges(1);
+		ranges[0].begin = 0;
+		ranges[0].end = mappedFile.getSize();
+		return parseMappedSlices(mappedFile.getData(), ranges);
+	}
+
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::parseFileRanges( const char* fileName, const FileRangeList& ranges )
+	{
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName) )
+			return false;
+
+		// The ranges of compressed files refer to the inflated document
+		if ( CompressedFileReader::getFormat(mappedFile.getData(), mappedFile.getSize()) != CompressedFileReader::FORMAT_UNCOMPRESSED )
+		{
+			mappedFile.close();
+			return parseCompressedFile(fileName, &ranges);
+		}
+
+		FileRangeList fileRanges(ranges);
+		size_t fileSize = mappedFile.getSize();
+		for ( size_t i = 0; i < fileRanges.size(); ++i )
+		{
+			FileRange& range = fileRanges[i];
+			range.end = range.end < fileSize ? range.end : fileSize;
+			range.begin = range.begin < range.end ? range.begin : range.end;
+		}
+		return parseMappedSlices(mappedFile.getData(), fileRanges);
+	}
+
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::parseMappedSlices( const char* data, const FileRangeList& ranges )
+	{
+		mParser = XML_ParserCreate(0);
+
+		XML_SetUserData(mParser, this);
+		XML_SetElementHandler(mParser, startElement, endElement);
+		XML_SetCharacterDataHandler(mParser, characters);
+
+		// XML_Parse takes an int length, so very large files are passed in several slices of the mapping
+		const size_t maxSliceLength = (size_t)INT_MAX;
+		setDocumentData(data, ranges);
+
+		XML_Status status = XML_STATUS_OK;
+		for ( size_t i = 0; (i < ranges.size()) && (status != XML_STATUS_ERROR); ++i )
+		{
+			const char* slice = data + ranges[i].begin;
+			size_t remainingLength = ranges[i].end - ranges[i].begin;
+			bool lastRange = (i + 1 == ranges.size());
+			do
+			{
+				size_t length = remainingLength < maxSliceLength ? remainingLength : maxSliceLength;
+				remainingLength -= length;
+				status = XML_Parse(mParser, slice, (int)length, lastRange && (remainingLength == 0));
+				slice += length;
+			}
+			while ( (remainingLength > 0) && (status != XML_STATUS_ERROR) );
+		}
+
+		setDocumentData(0, 0);
+		XML_ParserFree(mParser);
+
+		return status != XML_STATUS_ERROR;
+	}
+
+	//--------------------------------------------------------------------
+	bool ExpatSaxParser::parseCompressedFile( const char* fileName, const FileRangeList* ranges )
+	{
+		CompressedFileReader reader;
+		if ( !reader.open(fileName) )
+			return false;
+		if ( ranges )
+			reader.setRanges(*ranges);
+
+		mParser = XML_ParserCreate(0);
+
+		XML_SetUserData(mParser, this);
+		XML_SetElementHandler(mParser, startElement, endElement);
+		XML_SetCharacterDataHandler(mParser, characters);
+
+		char * buffer;
+		buffer = (char*) malloc (sizeof(char)*mBufferSize);
+
+		XML_Status status = XML_STATUS_OK;
+		size_t length = 0;
+		while ( (status != XML_STATUS_ERROR) && ((length = reader.read(buffer, mBufferSize)) > 0) )
+		{
+			status = XML_Parse(mParser, buffer, (int)length, false);
+		}
+		if ( status != XML_STATUS_ERROR )
+			status = XML_Parse(mParser, buffer, 0, true);
+
+		free (buffer);
+		XML_ParserFree(mParser);
+
+		return (status != XML_STATUS_ERROR) && !reader.hasFailed();
+	}
+
 	//--------------------------------------------------------------------
 	void ExpatSaxParser::startElement( void* user_data, const XML_Char* name, const XML_Char** attrs )
 	{
@@ -132,6 +252,18 @@ namespace GeneratedSaxParser
 		return (size_t) XML_GetCurrentColumnNumber(mParser);
 	}
 
+	//--------------------------------------------------------------------
+	size_t ExpatSaxParser::getByteOffset() const
+	{
+		return (size_t)(XML_GetCurrentByteIndex(mParser) + XML_GetCurrentByteCount(mParser));
+	}
+
+	//--------------------------------------------------------------------
+	size_t ExpatSaxParser::getStartTagByteOffset() const
+	{
+		return (size_t)XML_GetCurrentByteIndex(mParser);
+	}
+
 	//--------------------------------------------------------------------
 	void ExpatSaxParser::abortParsing()
 	{
@@ -14,6 +14,8 @@
 #include "GeneratedSaxParserLibxmlSaxParser.h"
 #include "GeneratedSaxParserParser.h"
 #include "GeneratedSaxParserIErrorHandler.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserCompressedFileReader.h"
 
 #include <libxml/parserInternals.h> // for xmlCreateFileParserCtxt
 
@@ -54,7 +56,8 @@ namespace GeneratedSaxParser
 	//--------------------------------------------------------------------
 	LibxmlSaxParser::LibxmlSaxParser(Parser* parser)
 		: SaxParser(parser),
-		mParserContext(0)
+		mParserContext(0),
+		mInStartElement(false)
 	{
 	}
 
@@ -69,49 +72,20 @@ namespace GeneratedSaxParser
 
 	bool LibxmlSaxParser::parseFile( const char* fileName )
 	{
+			if ( CompressedFileReader::getFormat(fileName) != CompressedFileReader::FORMAT_UNCOMPRESSED )
+				return parseCompressedFile(fileName, 0);
+
 			mParserContext = xmlCreateFileParserCtxt(fileName);
 			
 			if ( !mParserContext )
 			{
-				ParserError error(ParserError::SEVERITY_CRITICAL,
-									ParserError::ERROR_COULD_NOT_OPEN_FILE,
-									0,
-									0,
-									0,
-									0,
-									fileName);
-				IErrorHandler* errorHandler = getParser()->getErrorHandler();
-				if ( errorHandler )
-				{
-					errorHandler->handleError(error);
-				}
+				reportCouldNotOpenFile(fileName);
 				return false;
 			}
 
-			// We let libxml replace the entities
-			mParserContext->replaceEntities = 1;
-
-			if (mParserContext->sax != (xmlSAXHandlerPtr) &xmlDefaultSAXHandler)
-			{
-				xmlFree(mParserContext->sax);
-			}
-
-			mParserContext->sax = &SAXHANDLER;
-			mParserContext->userData = (void*)this;
-
-			initializeParserContext();
+			setupParserContext();
 			xmlParseDocument(mParserContext);
-
-			mParserContext->sax = 0;
-
-			if ( mParserContext->myDoc )
-			{
-				xmlFreeDoc(mParserContext->myDoc);
-				mParserContext->myDoc = 0;
-			}
-
-			xmlFreeParserCtxt(mParserContext);
-			mParserContext = 0;
+			releaseParserContext();
 
 			return true;
 	}
@@ -122,49 +96,213 @@ namespace GeneratedSaxParser
         
         if ( !mParserContext )
         {
-            ParserError error(ParserError::SEVERITY_CRITICAL,
-                              ParserError::ERROR_COULD_NOT_OPEN_FILE,
-                              0,
-                              0,
-                              0,
-                              0,
-                              uri);
-            IErrorHandler* errorHandler = getParser()->getErrorHandler();
-            if ( errorHandler )
-            {
-                errorHandler->handleError(error);
-            }
+            reportCouldNotOpenFile(uri);
             return false;
         }
         
-        // We let libxml replace the entities
-        mParserContext->replaceEntities = 1;
-
-        if (mParserContext->sax != (xmlSAXHandlerPtr) &xmlDefaultSAXHandler)
-        {
-            xmlFree(mParserContext->sax);
-        }
-        
-        mParserContext->sax = &SAXHANDLER;
-        mParserContext->userData = (void*)this;
-        
-        initializeParserContext();
+        setupParserContext();
+        setDocumentData(buffer, (size_t)length);
         xmlParseDocument(mParserContext);
-        
-        mParserContext->sax = 0;
-        
-        if ( mParserContext->myDoc )
-        {
-            xmlFreeDoc(mParserContext->myDoc);
-            mParserContext->myDoc = 0;
-        }
-        
-        xmlFreeParserCtxt(mParserContext);
-        mParserContext = 0;
+        setDocumentData(0, 0);
+        releaseParserContext();
         
         return true;
 	}
 
+	bool LibxmlSaxParser::parseMappedFile( const char* fileName )
+	{
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName) )
+		{
+			reportCouldNotOpenFile(fileName);
+			return false;
+		}
+
+		if ( CompressedFileReader::getFormat(mappedFile.getData(), mappedFile.getSize()) != CompressedFileReader::FORMAT_UNCOMPRESSED )
+		{
+			mappedFile.close();
+			return parseCompressedFile(fileName, 0);
+		}
+
+		// The mapped pages are fed to the push parser. It copies only the chunk it currently works on,
+		// instead of the entire document like xmlCreateMemoryParserCtxt does
+		FileRangeList ranges(1);
+		ranges[0].begin = 0;
+		ranges[0].end = mappedFile.getSize();
+		return parseMappedChunks(fileName, mappedFile.getData(), ranges);
+	}
+
+	bool LibxmlSaxParser::parseFileRanges( const char* fileName, const FileRangeList& ranges )
+	{
+		MemoryMappedFile mappedFile;
+		if ( !mappedFile.open(fileName) )
+		{
+			reportCouldNotOpenFile(fileName);
+			return false;
+		}
+
+		// The ranges of compressed files refer to the inflated document
+		if ( CompressedFileReader::getFormat(mappedFile.getData(), mappedFile.getSize()) != CompressedFileReader::FORMAT_UNCOMPRESSED )
+		{
+			mappedFile.close();
+			return parseCompressedFile(fileName, &ranges);
+		}
+
+		FileRangeList fileRanges(ranges);
+		size_t fileSize = mappedFile.getSize();
+		for ( size_t i = 0; i < fileRanges.size(); ++i )
+		{
+			FileRange& range = fileRanges[i];
+			range.end = range.end < fileSize ? range.end : fileSize;
+			range.begin = range.begin < range.end ? range.begin : range.end;
+		}
+		return parseMappedChunks(fileName, mappedFile.getData(), fileRanges);
+	}
+
+	bool LibxmlSaxParser::parseMappedChunks( const char* fileName, const char* data, const FileRangeList& ranges )
+	{
+		mParserContext = xmlCreatePushParserCtxt(0, 0, 0, 0, fileName);
+
+		if ( !mParserContext )
+		{
+			reportCouldNotOpenFile(fileName);
+			return false;
+		}
+
+		setupParserContext();
+		setDocumentData(data, ranges);
+
+		// Small chunks keep the input buffer of the push parser small and in cache
+		const size_t maxChunkLength = 1024*1024;
+		bool stopped = false;
+		for ( size_t i = 0; (i < ranges.size()) && !stopped; ++i )
+		{
+			const char* chunk = data + ranges[i].begin;
+			size_t remainingLength = ranges[i].end - ranges[i].begin;
+			bool lastRange = (i + 1 == ranges.size());
+			do
+			{
+				size_t chunkLength = remainingLength < maxChunkLength ? remainingLength : maxChunkLength;
+				remainingLength -= chunkLength;
+				stopped = xmlParseChunk(mParserContext, chunk, (int)chunkLength, lastRange && (remainingLength == 0)) != 0;
+				chunk += chunkLength;
+			}
+			while ( (remainingLength > 0) && !stopped );
+		}
+
+		setDocumentData(0, 0);
+		releaseParserContext();
+
+		return true;
+	}
+
+	bool LibxmlSaxParser::parseCompressedFile( const char* fileName, const FileRangeList* ranges )
+	{
+		CompressedFileReader reader;
+		if ( !reader.open(fileName) )
+		{
+			reportCouldNotOpenFile(fileName);
+			return false;
+		}
+		if ( ranges )
+			reader.setRanges(*ranges);
+
+		mParserContext = xmlCreatePushParserCtxt(0, 0, 0, 0, fileName);
+
+		if ( !mParserContext )
+		{
+			reportCouldNotOpenFile(fileName);
+			return false;
+		}
+
+		setupParserContext();
+
+		// Each chunk is passed to the push parser as soon as it has been inflated
+		const size_t chunkLength = 256*1024;
+		std::vector<char> chunk(chunkLength);
+		bool stopped = false;
+		size_t length = 0;
+		while ( !stopped && ((length = reader.read(&chunk[0], chunkLength)) > 0) )
+		{
+			stopped = xmlParseChunk(mParserContext, &chunk[0], (int)length, 0) != 0;
+		}
+		if ( !stopped )
+			stopped = xmlParseChunk(mParserContext, 0, 0, 1) != 0;
+
+		releaseParserContext();
+
+		// A document that could not be inflated completely has not been parsed
+		if ( reader.hasFailed() )
+		{
+			reportCouldNotReadFile(fileName);
+			return false;
+		}
+
+		return !stopped;
+	}
+
+	void LibxmlSaxParser::setupParserContext()
+	{
+		// We let libxml replace the entities
+		mParserContext->replaceEntities = 1;
+
+		if (mParserContext->sax != (xmlSAXHandlerPtr) &xmlDefaultSAXHandler)
+		{
+			xmlFree(mParserContext->sax);
+		}
+
+		mParserContext->sax = &SAXHANDLER;
+		mParserContext->userData = (void*)this;
+
+		initializeParserContext();
+	}
+
+	void LibxmlSaxParser::releaseParserContext()
+	{
+		mParserContext->sax = 0;
+
+		if ( mParserContext->myDoc )
+		{
+			xmlFreeDoc(mParserContext->myDoc);
+			mParserContext->myDoc = 0;
+		}
+
+		xmlFreeParserCtxt(mParserContext);
+		mParserContext = 0;
+	}
+
+	void LibxmlSaxParser::reportCouldNotOpenFile( const char* fileName )
+	{
+		ParserError error(ParserError::SEVERITY_CRITICAL,
+							ParserError::ERROR_COULD_NOT_OPEN_FILE,
+							0,
+							0,
+							0,
+							0,
+							fileName);
+		IErrorHandler* errorHandler = getParser()->getErrorHandler();
+		if ( errorHandler )
+		{
+			errorHandler->handleError(error);
+		}
+	}
+
+	void LibxmlSaxParser::reportCouldNotReadFile( const char* fileName )
+	{
+		ParserError error(ParserError::SEVERITY_CRITICAL,
+							ParserError::ERROR_XML_PARSER_ERROR,
+							0,
+							0,
+							0,
+							0,
+							String("Could not read or inflate ") + fileName);
+		IErrorHandler* errorHandler = getParser()->getErrorHandler();
+		if ( errorHandler )
+		{
+			errorHandler->handleError(error);
+		}
+	}
+
 	void LibxmlSaxParser::initializeParserContext()
 	{
 		mParserContext->linenumbers = true;
@@ -176,7 +314,10 @@ namespace GeneratedSaxParser
 	{
 		LibxmlSaxParser* thisObject = (LibxmlSaxParser*)user_data;
 		Parser* parser = thisObject->getParser();
-		if ( !parser->elementBegin((const ParserChar*)name, (const ParserChar**)attrs) )
+		thisObject->mInStartElement = true;
+		bool success = parser->elementBegin((const ParserChar*)name, (const ParserChar**)attrs);
+		thisObject->mInStartElement = false;
+		if ( !success )
 			thisObject->abortParsing();
 	}
 
@@ -212,6 +353,34 @@ namespace GeneratedSaxParser
 		return (size_t)xmlSAX2GetColumnNumber(mParserContext);
 	}
 
+	size_t LibxmlSaxParser::getByteOffset() const
+	{
+		size_t offset = (size_t)xmlByteConsumed(mParserContext);
+
+		// startElement is called before libxml consumes the end of the start tag
+		if ( mInStartElement )
+		{
+			const ::xmlChar* current = mParserContext->input->cur;
+			if ( current[0] == '>' )
+				offset += 1;
+			else if ( (current[0] == '/') && (current[1] == '>') )
+				offset += 2;
+		}
+		return offset;
+	}
+
+	size_t LibxmlSaxParser::getStartTagByteOffset() const
+	{
+		// The input buffer still holds the start tag, the current position is at its end. Attribute values
+		// cannot contain a '<', the first one in front of the current position starts the tag.
+		const ::xmlChar* base = mParserContext->input->base;
+		const ::xmlChar* current = mParserContext->input->cur;
+		const ::xmlChar* tag = current;
+		while ( (tag > base) && (*tag != '<') )
+			tag--;
+		return (size_t)xmlByteConsumed(mParserContext) - (size_t)(current - tag);
+	}
+
 	void LibxmlSaxParser::errorFunction( void *userData, const char *msg, ... )
 	{
         // if msg is just one string, get it. Otherwise ignore it.
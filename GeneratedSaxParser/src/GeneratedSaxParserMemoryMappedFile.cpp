@@ -0,0 +1,162 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserMemoryMappedFile.h"
+
+#if defined(COLLADABU_OS_WIN)
+#	include <windows.h>
+#else
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#	include <sys/mman.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+
+namespace GeneratedSaxParser
+{
+
+	//--------------------------------------------------------------------
+	MemoryMappedFile::MemoryMappedFile()
+		: mData(0)
+		, mSize(0)
+#if defined(COLLADABU_OS_WIN)
+		, mFileHandle(INVALID_HANDLE_VALUE)
+		, mMappingHandle(0)
+#else
+		, mFileDescriptor(-1)
+#endif
+	{
+	}
+
+	//--------------------------------------------------------------------
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		close();
+	}
+
+#if defined(COLLADABU_OS_WIN)
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::open( const char* fileName )
+	{
+		close();
+
+		mFileHandle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+		if ( mFileHandle == INVALID_HANDLE_VALUE )
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if ( !GetFileSizeEx(mFileHandle, &fileSize) )
+		{
+			close();
+			return false;
+		}
+		mSize = (size_t)fileSize.QuadPart;
+
+		// Empty files cannot be mapped. They are represented by a null pointer and size 0
+		if ( mSize == 0 )
+			return true;
+
+		mMappingHandle = CreateFileMappingA(mFileHandle, 0, PAGE_READONLY, 0, 0, 0);
+		if ( !mMappingHandle )
+		{
+			close();
+			return false;
+		}
+
+		mData = (const char*)MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if ( !mData )
+		{
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::close()
+	{
+		if ( mData )
+			UnmapViewOfFile(mData);
+		if ( mMappingHandle )
+			CloseHandle(mMappingHandle);
+		if ( mFileHandle != INVALID_HANDLE_VALUE )
+			CloseHandle(mFileHandle);
+		mData = 0;
+		mSize = 0;
+		mMappingHandle = 0;
+		mFileHandle = INVALID_HANDLE_VALUE;
+	}
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::isOpen() const
+	{
+		return mFileHandle != INVALID_HANDLE_VALUE;
+	}
+
+#else
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::open( const char* fileName )
+	{
+		close();
+
+		mFileDescriptor = ::open(fileName, O_RDONLY);
+		if ( mFileDescriptor == -1 )
+			return false;
+
+		struct stat fileStatus;
+		if ( fstat(mFileDescriptor, &fileStatus) != 0 )
+		{
+			close();
+			return false;
+		}
+		mSize = (size_t)fileStatus.st_size;
+
+		// Empty files cannot be mapped. They are represented by a null pointer and size 0
+		if ( mSize == 0 )
+			return true;
+
+		void* data = mmap(0, mSize, PROT_READ, MAP_PRIVATE, mFileDescriptor, 0);
+		if ( data == MAP_FAILED )
+		{
+			close();
+			return false;
+		}
+		mData = (const char*)data;
+
+		// The parsers read the document front to back exactly once
+		madvise(data, mSize, MADV_SEQUENTIAL);
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	void MemoryMappedFile::close()
+	{
+		if ( mData )
+			munmap((void*)mData, mSize);
+		if ( mFileDescriptor != -1 )
+			::close(mFileDescriptor);
+		mData = 0;
+		mSize = 0;
+		mFileDescriptor = -1;
+	}
+
+	//--------------------------------------------------------------------
+	bool MemoryMappedFile::isOpen() const
+	{
+		return mFileDescriptor != -1;
+	}
+
+#endif
+
+} // namespace GeneratedSaxParser
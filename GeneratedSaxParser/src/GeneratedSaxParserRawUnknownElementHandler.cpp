@@ -16,6 +16,7 @@ namespace GeneratedSaxParser
 {
 	//--------------------------------------------------------------------
 	RawUnknownElementHandler::RawUnknownElementHandler()
+		: mCaptureElementRanges(false)
 	{
 	}
 	
@@ -110,4 +111,19 @@ namespace GeneratedSaxParser
 		return true;
 	}
 
+	//--------------------------------------------------------------------
+	bool RawUnknownElementHandler::elementRange( const ParserChar* elementName, size_t offset, size_t length, const ParserChar* bytes )
+	{
+		prepareToAddContents();
+
+		ElementRange range;
+		range.offset = offset;
+		range.length = length;
+		mElementRanges.push_back( range );
+
+		if ( bytes )
+			mRawData.append( bytes, length );
+		return true;
+	}
+
 } // namespace GeneratedSaxParser
@@ -0,0 +1,152 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserRecordedSaxParser.h"
+#include "GeneratedSaxParserSaxEventRecorder.h"
+#include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserIErrorHandler.h"
+
+#include <cstring>
+
+
+namespace GeneratedSaxParser
+{
+
+	//--------------------------------------------------------------------
+	RecordedSaxParser::RecordedSaxParser( Parser* parser, const SaxEventRecorder& recording )
+		: SaxParser(parser)
+		, mRecording(recording)
+		, mLineNumber(0)
+		, mColumnNumber(0)
+	{
+	}
+
+	//--------------------------------------------------------------------
+	RecordedSaxParser::~RecordedSaxParser()
+	{
+	}
+
+	//--------------------------------------------------------------------
+	bool RecordedSaxParser::replay()
+	{
+		const SaxEventRecorder::EventList& events = mRecording.getEvents();
+		const ParserChar* data = mRecording.getData();
+
+		for ( size_t i = 0, count = events.size(); i < count; ++i )
+		{
+			const SaxEventRecorder::Event& event = events[i];
+			mLineNumber = event.lineNumber;
+			mColumnNumber = event.columnNumber;
+
+			// The parser might replace itself while handling an event
+			Parser* parser = getParser();
+
+			bool continueParsing = true;
+			switch ( event.type )
+			{
+			case SaxEventRecorder::ELEMENT_BEGIN:
+				{
+					const ParserChar* elementName = data + event.dataOffset;
+					if ( event.dataSize == 0 )
+					{
+						continueParsing = parser->elementBegin(elementName, (const ParserChar**)0);
+						break;
+					}
+					mAttributes.clear();
+					const ParserChar* attribute = elementName + strlen(elementName) + 1;
+					for ( size_t j = 0; j < event.dataSize; ++j )
+					{
+						mAttributes.push_back(attribute);
+						attribute += strlen(attribute) + 1;
+					}
+					mAttributes.push_back(0);
+					continueParsing = parser->elementBegin(elementName, &mAttributes[0]);
+					break;
+				}
+			case SaxEventRecorder::ELEMENT_END:
+				continueParsing = parser->elementEnd(data + event.dataOffset);
+				break;
+			case SaxEventRecorder::TEXT_DATA:
+				continueParsing = parser->textData(data + event.dataOffset, event.dataSize);
+				break;
+			case SaxEventRecorder::PARSER_ERROR:
+				{
+					const SaxEventRecorder::RecordedError& recordedError = mRecording.getErrors()[event.dataOffset];
+					ParserError error(recordedError.severity,
+									  recordedError.errorType,
+									  recordedError.hasElementName ? recordedError.elementName.c_str() : 0,
+									  recordedError.hasAttributeName ? recordedError.attributeName.c_str() : 0,
+									  recordedError.lineNumber,
+									  recordedError.columnNumber,
+									  recordedError.additionalText);
+					// The xml parsers do not stop on the return value of the error handler either
+					IErrorHandler* errorHandler = parser->getErrorHandler();
+					if ( errorHandler )
+						errorHandler->handleError(error);
+					break;
+				}
+			}
+
+			if ( !continueParsing )
+				break;
+		}
+
+		return mRecording.getSuccess();
+	}
+
+	//--------------------------------------------------------------------
+	bool RecordedSaxParser::parseFile( const char* fileName )
+	{
+		return replay();
+	}
+
+	//--------------------------------------------------------------------
+	bool RecordedSaxParser::parseMappedFile( const char* fileName )
+	{
+		return replay();
+	}
+
+	//--------------------------------------------------------------------
+	bool RecordedSaxParser::parseBuffer( const char* uri, const char* buffer, int length )
+	{
+		return replay();
+	}
+
+	//--------------------------------------------------------------------
+	bool RecordedSaxParser::parseFileRanges( const char* fileName, const FileRangeList& ranges )
+	{
+		return replay();
+	}
+
+	//--------------------------------------------------------------------
+	size_t RecordedSaxParser::getLineNumer() const
+	{
+		return mLineNumber;
+	}
+
+	//--------------------------------------------------------------------
+	size_t RecordedSaxParser::getColumnNumer() const
+	{
+		return mColumnNumber;
+	}
+
+	//--------------------------------------------------------------------
+	size_t RecordedSaxParser::getByteOffset() const
+	{
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	size_t RecordedSaxParser::getStartTagByteOffset() const
+	{
+		return 0;
+	}
+
+} // namespace GeneratedSaxParser
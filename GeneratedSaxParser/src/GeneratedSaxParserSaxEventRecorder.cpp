@@ -0,0 +1,162 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserSaxEventRecorder.h"
+#include "GeneratedSaxParserSaxParser.h"
+
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+#	include "GeneratedSaxParserLibxmlSaxParser.h"
+#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+#	include "GeneratedSaxParserExpatSaxParser.h"
+#endif
+
+#include <cstring>
+
+
+namespace GeneratedSaxParser
+{
+
+	//--------------------------------------------------------------------
+	SaxEventRecorder::SaxEventRecorder()
+		: Parser(this)
+		, mSuccess(false)
+	{
+	}
+
+	//--------------------------------------------------------------------
+	SaxEventRecorder::~SaxEventRecorder()
+	{
+	}
+
+	//--------------------------------------------------------------------
+	void SaxEventRecorder::initializeConcurrentRecording()
+	{
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+		// libxml initializes its global state lazily, which is not thread safe
+		xmlInitParser();
+#endif
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxEventRecorder::record( const char* fileName, bool memoryMapped )
+	{
+		clear();
+#if defined(GENERATEDSAXPARSER_XMLPARSER_LIBXML)
+		LibxmlSaxParser saxParser( this );
+#elif defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+		ExpatSaxParser saxParser( this, 64*1024 );
+#endif
+		mSuccess = memoryMapped ? saxParser.parseMappedFile( fileName ) : saxParser.parseFile( fileName );
+		return mSuccess;
+	}
+
+	//--------------------------------------------------------------------
+	void SaxEventRecorder::clear()
+	{
+		EventList().swap(mEvents);
+		std::vector<ParserChar>().swap(mData);
+		RecordedErrorList().swap(mErrors);
+		mSuccess = false;
+	}
+
+	//--------------------------------------------------------------------
+	SaxEventRecorder::Event& SaxEventRecorder::addEvent( EventType type )
+	{
+		mEvents.push_back(Event());
+		Event& event = mEvents.back();
+		event.type = type;
+		event.lineNumber = getLineNumber();
+		event.columnNumber = getColumnNumber();
+		event.dataOffset = mData.size();
+		event.dataSize = 0;
+		return event;
+	}
+
+	//--------------------------------------------------------------------
+	void SaxEventRecorder::appendData( const ParserChar* text, size_t length )
+	{
+		mData.insert(mData.end(), text, text + length);
+	}
+
+	//--------------------------------------------------------------------
+	void SaxEventRecorder::appendString( const ParserChar* text )
+	{
+		appendData(text, strlen(text) + 1);
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxEventRecorder::elementBegin( const ParserChar* elementName, const ParserAttributes& attributes )
+	{
+		Event& event = addEvent(ELEMENT_BEGIN);
+		appendString(elementName);
+		if ( attributes.attributes )
+		{
+			for ( const ParserChar** attribute = attributes.attributes; *attribute; ++attribute )
+			{
+				appendString(*attribute);
+				event.dataSize++;
+			}
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxEventRecorder::elementEnd( const ParserChar* elementName )
+	{
+		addEvent(ELEMENT_END);
+		appendString(elementName);
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxEventRecorder::textData( const ParserChar* text, size_t textLength )
+	{
+		Event& event = addEvent(TEXT_DATA);
+		appendData(text, textLength);
+		event.dataSize = textLength;
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxEventRecorder::handleError( const ParserError& error )
+	{
+		Event& event = addEvent(PARSER_ERROR);
+		event.dataOffset = mErrors.size();
+
+		mErrors.push_back(RecordedError());
+		RecordedError& recordedError = mErrors.back();
+		recordedError.severity = error.getSeverity();
+		recordedError.errorType = error.getErrorType();
+		recordedError.hasElementName = error.getElement() != 0;
+		if ( recordedError.hasElementName )
+			recordedError.elementName = error.getElement();
+		recordedError.hasAttributeName = error.getAttribute() != 0;
+		if ( recordedError.hasAttributeName )
+			recordedError.attributeName = error.getAttribute();
+		recordedError.lineNumber = error.getLineNumber();
+		recordedError.columnNumber = error.getColumnNumber();
+		recordedError.additionalText = error.getAdditionalText();
+
+		// Whether to stop is decided by the error handler the recording is replayed to
+		return false;
+	}
+
+	//--------------------------------------------------------------------
+	bool SaxEventRecorder::hasCriticalError() const
+	{
+		for ( size_t i = 0, count = mErrors.size(); i < count; ++i )
+		{
+			if ( mErrors[i].severity == ParserError::SEVERITY_CRITICAL )
+				return true;
+		}
+		return false;
+	}
+
+} // namespace GeneratedSaxParser
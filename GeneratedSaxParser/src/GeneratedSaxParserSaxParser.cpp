@@ -16,6 +16,7 @@ namespace GeneratedSaxParser
 
 	SaxParser::SaxParser( Parser* parser )
 		: mParser(parser)
+		, mDocumentData(0)
 	{
 		if ( parser )
 			mParser->setSaxParser(this);
@@ -36,4 +37,46 @@ namespace GeneratedSaxParser
         }
     }
 
+	//--------------------------------------------------------------------
+	void SaxParser::setDocumentData( const char* data, const FileRangeList& ranges )
+	{
+		mDocumentData = data;
+		if ( data )
+			mDocumentRanges = ranges;
+		else
+			mDocumentRanges.clear();
+	}
+
+	//--------------------------------------------------------------------
+	void SaxParser::setDocumentData( const char* data, size_t length )
+	{
+		FileRangeList ranges(1);
+		ranges[0].begin = 0;
+		ranges[0].end = length;
+		setDocumentData(data, ranges);
+	}
+
+	//--------------------------------------------------------------------
+	const char* SaxParser::getDocumentBytes( size_t offset, size_t length ) const
+	{
+		if ( !mDocumentData )
+			return 0;
+
+		// The offsets of the document count the bytes of the ranges, the gaps between them are not parsed
+		size_t rangeOffset = 0;
+		for ( size_t i = 0; i < mDocumentRanges.size(); ++i )
+		{
+			const FileRange& range = mDocumentRanges[i];
+			size_t rangeLength = range.end - range.begin;
+			if ( offset < rangeOffset + rangeLength )
+			{
+				if ( offset + length > rangeOffset + rangeLength )
+					return 0;
+				return mDocumentData + range.begin + (offset - rangeOffset);
+			}
+			rangeOffset += rangeLength;
+		}
+		return 0;
+	}
+
 } // namespace COLLADAPARSER
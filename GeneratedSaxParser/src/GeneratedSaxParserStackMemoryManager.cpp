@@ -39,7 +39,7 @@ namespace GeneratedSaxParser
         size_t newCurrentPos = newDataSizePos + sizeof(objectSize);
 		while ( newCurrentPos > mFrames[ mActiveFrame ].mMaxMemoryBlob )
 		{
-            if (!allocateMoreMemory())
+            if (!allocateMoreMemory(objectSize + sizeof(objectSize)))
                 return 0;
 
             newDataPos = mFrames[ mActiveFrame ].mCurrentPosition;
@@ -91,7 +91,7 @@ namespace GeneratedSaxParser
             size_t numOfAllocs = 0;
             while ( newCurrentPos > mFrames[ mActiveFrame ].mMaxMemoryBlob )
             {
-                if (!allocateMoreMemory())
+                if (!allocateMoreMemory(newSize + sizeof(newSize)))
                     return 0;
                 newDataSizePos = mFrames[ mActiveFrame ].mCurrentPosition + newSize;
                 newCurrentPos = newDataSizePos + sizeof(newSize);
@@ -116,11 +116,14 @@ namespace GeneratedSaxParser
     }
 
     //-----------------------------------------------------------------
-    bool StackMemoryManager::allocateMoreMemory()
+    bool StackMemoryManager::allocateMoreMemory( size_t minimumSize )
     {
         if ( mActiveFrame == MAX_NUM_OF_FRAMES-1 )
             return false;
         size_t sizeOfNewBlob = mFrames[ mActiveFrame ].mMaxMemoryBlob * SIZE_OF_NEW_FRAME_FACTOR;
+        // one frame has to hold the whole object, otherwise it would be moved to each new frame
+        if ( sizeOfNewBlob < minimumSize )
+            sizeOfNewBlob = minimumSize;
         char* newMem = new char[sizeOfNewBlob];
         if (!newMem)
             return false;
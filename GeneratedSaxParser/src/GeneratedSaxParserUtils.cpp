@@ -15,6 +15,18 @@
 #include <limits>
 #include <algorithm>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#	define GENERATEDSAXPARSER_SIMD_SSE2
+#	include <emmintrin.h>
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	endif
+#	if !defined(GENERATEDSAXPARSER_NO_AVX2) && (defined(_MSC_VER) || defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))))
+#		define GENERATEDSAXPARSER_SIMD_AVX2
+#		include <immintrin.h>
+#	endif
+#endif
+
 namespace GeneratedSaxParser
 {
 
@@ -1597,4 +1609,399 @@ namespace GeneratedSaxParser
         return isNaN<double>( value );
     }
 
+    //--------------------------------------------------------------------
+    // Bulk conversion of whitespace separated lists of numbers
+    //--------------------------------------------------------------------
+    namespace
+    {
+        /** Range of decimal exponents, for which the powers of ten are tabulated.*/
+        const int POWER_OF_TEN_TABLE_MIN = -128;
+        const int POWER_OF_TEN_TABLE_MAX = 128;
+
+        /** Maximum number of mantissa digits, for which the accumulation in a double in toFloatingPoint()
+        is exact. Longer mantissas are converted by toFloatingPoint().*/
+        const size_t MAX_EXACT_MANTISSA_DIGITS = 15;
+
+        /** Maximum number of digits of an uint64, that cannot overflow.*/
+        const size_t MAX_EXACT_UINT64_DIGITS = 19;
+
+        /** Maximum number of exponent digits handled by the fast path.*/
+        const size_t MAX_EXPONENT_DIGITS = 3;
+
+        /** Powers of ten, calculated exactly as in toFloatingPoint(). This makes the values
+        of the bulk conversion bit identical to those of toFloatingPoint().*/
+        template<class FloatingPointType>
+        struct PowersOfTen
+        {
+            FloatingPointType values[POWER_OF_TEN_TABLE_MAX - POWER_OF_TEN_TABLE_MIN + 1];
+
+            PowersOfTen()
+            {
+                for ( int power = POWER_OF_TEN_TABLE_MIN; power <= POWER_OF_TEN_TABLE_MAX; ++power )
+                    values[power - POWER_OF_TEN_TABLE_MIN] = pow((FloatingPointType)10, (FloatingPointType)power);
+            }
+        };
+
+        const PowersOfTen<float> floatPowersOfTen;
+        const PowersOfTen<double> doublePowersOfTen;
+
+        template<class FloatingPointType> const FloatingPointType* getPowersOfTen();
+        template<> const float* getPowersOfTen<float>() { return floatPowersOfTen.values; }
+        template<> const double* getPowersOfTen<double>() { return doublePowersOfTen.values; }
+
+        const uint64 UINT64_POWERS_OF_TEN[MAX_EXACT_MANTISSA_DIGITS + 1] =
+        {
+            1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+            1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+            100000000000000ULL, 1000000000000000ULL
+        };
+
+#if defined(GENERATEDSAXPARSER_SIMD_SSE2)
+
+        //--------------------------------------------------------------------
+        inline unsigned int countTrailingZeros( unsigned int mask )
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return (unsigned int)index;
+#else
+            return (unsigned int)__builtin_ctz(mask);
+#endif
+        }
+
+        /** Returns a mask with a bit set for each of the 16 characters at @a s that is not a digit.*/
+        inline unsigned int nonDigitMaskSSE2( const ParserChar* s )
+        {
+            __m128i chunk = _mm_loadu_si128((const __m128i*)s);
+            __m128i nonDigits = _mm_or_si128(_mm_cmplt_epi8(chunk, _mm_set1_epi8('0')), _mm_cmpgt_epi8(chunk, _mm_set1_epi8('9')));
+            return (unsigned int)_mm_movemask_epi8(nonDigits);
+        }
+
+        /** Returns the number of consecutive digits starting at @a s, that are not followed by bufferEnd.*/
+        typedef size_t (*DigitRunFunction)( const ParserChar* s, const ParserChar* bufferEnd );
+
+        //--------------------------------------------------------------------
+        size_t countDigitRunSSE2( const ParserChar* s, const ParserChar* bufferEnd )
+        {
+            const ParserChar* p = s;
+            while ( bufferEnd - p >= 16 )
+            {
+                unsigned int mask = nonDigitMaskSSE2(p);
+                if ( mask != 0 )
+                    return (p - s) + countTrailingZeros(mask);
+                p += 16;
+            }
+            while ( (p != bufferEnd) && Utils::isdigit(*p) )
+                ++p;
+            return p - s;
+        }
+
+#if defined(GENERATEDSAXPARSER_SIMD_AVX2)
+
+        //--------------------------------------------------------------------
+#if defined(__GNUC__) || defined(__clang__)
+        __attribute__((target("avx2")))
+#endif
+        size_t countDigitRunAVX2( const ParserChar* s, const ParserChar* bufferEnd )
+        {
+            const ParserChar* p = s;
+            while ( bufferEnd - p >= 32 )
+            {
+                __m256i chunk = _mm256_loadu_si256((const __m256i*)p);
+                __m256i nonDigits = _mm256_or_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8('0'), chunk), _mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('9')));
+                unsigned int mask = (unsigned int)_mm256_movemask_epi8(nonDigits);
+                if ( mask != 0 )
+                    return (p - s) + countTrailingZeros(mask);
+                p += 32;
+            }
+            return (p - s) + countDigitRunSSE2(p, bufferEnd);
+        }
+
+        //--------------------------------------------------------------------
+        bool isAVX2Supported()
+        {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            if ( info[0] < 7 )
+                return false;
+            __cpuid(info, 1);
+            // the os has to save the ymm registers (OSXSAVE and AVX)
+            if ( ((info[2] & (1 << 27)) == 0) || ((info[2] & (1 << 28)) == 0) )
+                return false;
+            if ( (_xgetbv(0) & 6) != 6 )
+                return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+#endif
+        }
+#endif
+
+        //--------------------------------------------------------------------
+        DigitRunFunction selectDigitRunFunction()
+        {
+#if defined(GENERATEDSAXPARSER_SIMD_AVX2)
+            if ( isAVX2Supported() )
+                return &countDigitRunAVX2;
+#endif
+            return &countDigitRunSSE2;
+        }
+
+        /** Used for digit runs longer than 16 characters, selected at runtime.*/
+        const DigitRunFunction countDigitRun = selectDigitRunFunction();
+
+        /** Converts the first @a digitCount (1 to 8) digits of the eight characters at @a s into their
+        value, without a branch per digit. Requires little endian byte order.*/
+        inline uint32 shortDigitsToUint32( const ParserChar* s, size_t digitCount )
+        {
+            uint64 value;
+            memcpy(&value, s, sizeof(value));
+            // shift out the characters after the digits. The low bytes are filled with zeros, which are
+            // treated as leading '0's below
+            value <<= (8 - digitCount) * 8;
+            value = ((value & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+            value = ((value & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+            return (uint32)(((value & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+        }
+
+#endif // GENERATEDSAXPARSER_SIMD_SSE2
+
+        //--------------------------------------------------------------------
+        /** Returns the number of consecutive digits starting at @a s.*/
+        inline size_t countDigits( const ParserChar* s, const ParserChar* bufferEnd )
+        {
+#if defined(GENERATEDSAXPARSER_SIMD_SSE2)
+            if ( bufferEnd - s >= 16 )
+            {
+                unsigned int mask = nonDigitMaskSSE2(s);
+                if ( mask != 0 )
+                    return countTrailingZeros(mask);
+                return 16 + countDigitRun(s + 16, bufferEnd);
+            }
+#endif
+            const ParserChar* p = s;
+            while ( (p != bufferEnd) && Utils::isdigit(*p) )
+                ++p;
+            return p - s;
+        }
+
+        //--------------------------------------------------------------------
+        /** Returns the value of the @a digitCount digits at @a s. The caller has to ensure, that the value
+        fits in an uint64.*/
+        inline uint64 digitsToUint64( const ParserChar* s, size_t digitCount, const ParserChar* bufferEnd )
+        {
+            uint64 value = 0;
+#if defined(GENERATEDSAXPARSER_SIMD_SSE2)
+            if ( (digitCount > 0) && (bufferEnd - s >= 8) )
+            {
+                // the leading digits are converted in a group of one to eight digits, such that all
+                // following groups contain exactly eight digits
+                size_t leadingDigitCount = ((digitCount - 1) % 8) + 1;
+                value = shortDigitsToUint32(s, leadingDigitCount);
+                s += leadingDigitCount;
+                digitCount -= leadingDigitCount;
+                while ( digitCount > 0 )
+                {
+                    value = value * 100000000 + shortDigitsToUint32(s, 8);
+                    s += 8;
+                    digitCount -= 8;
+                }
+                return value;
+            }
+#endif
+            while ( digitCount-- )
+                value = value * 10 + (*s++ - '0');
+            return value;
+        }
+
+        /** Reason, why a run of the fast conversion stopped.*/
+        enum ConversionRunResult
+        {
+            RUN_MAX_COUNT_REACHED,      ///< The maximum number of values has been converted
+            RUN_END_OF_DATA,            ///< Only white spaces are left in the buffer
+            RUN_INCOMPLETE_VALUE,       ///< The last value reaches the end of the buffer and might be continued in the next chunk
+            RUN_COMPLEX_VALUE           ///< The value starting at valueStart has to be converted by the single value conversion
+        };
+
+        //--------------------------------------------------------------------
+        /** Converts values as long as they are in one of the common notations [+-]digits[.digits][(e|E)[+-]digits],
+        that can be converted exactly. NaN, INF, long mantissas and invalid values stop the run. This loop
+        does not contain any calls, which keeps all its state in registers.*/
+        template<class FloatingPointType>
+        ConversionRunResult convertSimpleFloatingPoints( const ParserChar*& buffer, const ParserChar* bufferEnd, FloatingPointType* values, size_t maxCount, size_t& count, const ParserChar*& valueStart )
+        {
+            const FloatingPointType* powersOfTen = getPowersOfTen<FloatingPointType>();
+            const ParserChar* s = buffer;
+            size_t valueCount = count;
+            ConversionRunResult result = RUN_MAX_COUNT_REACHED;
+            while ( valueCount < maxCount )
+            {
+                valueStart = s;
+                while ( (s != bufferEnd) && Utils::isWhiteSpace(*s) )
+                    ++s;
+                if ( s == bufferEnd )
+                {
+                    result = RUN_END_OF_DATA;
+                    break;
+                }
+
+                // without branches, since the signs of the values are usually random
+                bool negative = (*s == '-');
+                FloatingPointType sign = negative ? (FloatingPointType)-1.0 : (FloatingPointType)1.0;
+                s += (negative || (*s == '+')) ? 1 : 0;
+
+                const ParserChar* integerStart = s;
+                size_t integerDigits = countDigits(s, bufferEnd);
+                s += integerDigits;
+
+                const ParserChar* fractionStart = s;
+                size_t fractionDigits = 0;
+                if ( (s != bufferEnd) && (*s == '.') )
+                {
+                    ++s;
+                    fractionStart = s;
+                    fractionDigits = countDigits(s, bufferEnd);
+                    s += fractionDigits;
+                }
+
+                int power = -(int)fractionDigits;
+                size_t exponentDigits = 1;
+                if ( (s != bufferEnd) && ((*s == 'e') || (*s == 'E')) )
+                {
+                    ++s;
+                    int exponentSign = 1;
+                    if ( (s != bufferEnd) && ((*s == '-') || (*s == '+')) )
+                    {
+                        exponentSign = (*s == '-') ? -1 : 1;
+                        ++s;
+                    }
+                    int exponent = 0;
+                    exponentDigits = 0;
+                    while ( (s != bufferEnd) && Utils::isdigit(*s) && (exponentDigits <= MAX_EXPONENT_DIGITS) )
+                    {
+                        exponent = exponent * 10 + (*s - '0');
+                        ++exponentDigits;
+                        ++s;
+                    }
+                    power += exponentSign * exponent;
+                }
+
+                if ( s == bufferEnd )
+                {
+                    result = RUN_INCOMPLETE_VALUE;
+                    break;
+                }
+
+                size_t mantissaDigits = integerDigits + fractionDigits;
+                if ( (mantissaDigits == 0) || (mantissaDigits > MAX_EXACT_MANTISSA_DIGITS)
+                    || (exponentDigits == 0) || (exponentDigits > MAX_EXPONENT_DIGITS)
+                    || (power < POWER_OF_TEN_TABLE_MIN) || (power > POWER_OF_TEN_TABLE_MAX) || !Utils::isWhiteSpace(*s) )
+                {
+                    result = RUN_COMPLEX_VALUE;
+                    break;
+                }
+
+                uint64 mantissa = digitsToUint64(integerStart, integerDigits, bufferEnd) * UINT64_POWERS_OF_TEN[fractionDigits]
+                                  + digitsToUint64(fractionStart, fractionDigits, bufferEnd);
+                values[valueCount++] = (FloatingPointType)(double)mantissa * powersOfTen[power - POWER_OF_TEN_TABLE_MIN] * sign;
+            }
+            buffer = s;
+            count = valueCount;
+            return result;
+        }
+
+        //--------------------------------------------------------------------
+        /** Converts values as long as they consist of up to MAX_EXACT_UINT64_DIGITS digits. Other values
+        stop the run.*/
+        ConversionRunResult convertSimpleUint64s( const ParserChar*& buffer, const ParserChar* bufferEnd, uint64* values, size_t maxCount, size_t& count, const ParserChar*& valueStart )
+        {
+            const ParserChar* s = buffer;
+            size_t valueCount = count;
+            ConversionRunResult result = RUN_MAX_COUNT_REACHED;
+            while ( valueCount < maxCount )
+            {
+                valueStart = s;
+                while ( (s != bufferEnd) && Utils::isWhiteSpace(*s) )
+                    ++s;
+                if ( s == bufferEnd )
+                {
+                    result = RUN_END_OF_DATA;
+                    break;
+                }
+
+                size_t digitCount = countDigits(s, bufferEnd);
+                if ( (size_t)(bufferEnd - s) == digitCount )
+                {
+                    s = bufferEnd;
+                    result = RUN_INCOMPLETE_VALUE;
+                    break;
+                }
+
+                if ( (digitCount == 0) || (digitCount > MAX_EXACT_UINT64_DIGITS) || !Utils::isWhiteSpace(s[digitCount]) )
+                {
+                    result = RUN_COMPLEX_VALUE;
+                    break;
+                }
+
+                values[valueCount++] = digitsToUint64(s, digitCount, bufferEnd);
+                s += digitCount;
+            }
+            buffer = s;
+            count = valueCount;
+            return result;
+        }
+
+        //--------------------------------------------------------------------
+        /** Converts a list, using @a convertSimpleValues for runs of common values and @a toData for
+        all others.*/
+        template<class DataType, 
+                 ConversionRunResult (*convertSimpleValues)( const ParserChar*&, const ParserChar*, DataType*, size_t, size_t&, const ParserChar*& ),
+                 DataType (*toData)( const ParserChar**, const ParserChar*, bool& )>
+        size_t toList( const ParserChar** buffer, const ParserChar* bufferEnd, DataType* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+        {
+            const ParserChar* s = *buffer;
+            size_t count = 0;
+            failed = false;
+            while ( true )
+            {
+                ConversionRunResult result = convertSimpleValues(s, bufferEnd, values, maxCount, count, *lastValueStart);
+                if ( result != RUN_COMPLEX_VALUE )
+                {
+                    failed = (result == RUN_END_OF_DATA);
+                    break;
+                }
+
+                s = *lastValueStart;
+                DataType value = toData(&s, bufferEnd, failed);
+                if ( failed || (s == bufferEnd) )
+                    break;
+                values[count++] = value;
+            }
+            *buffer = s;
+            return count;
+        }
+    }
+
+    //--------------------------------------------------------------------
+    size_t Utils::toFloatList( const ParserChar** buffer, const ParserChar* bufferEnd, float* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+    {
+        return toList<float, &convertSimpleFloatingPoints<float>, &Utils::toFloat>(buffer, bufferEnd, values, maxCount, lastValueStart, failed);
+    }
+
+    //--------------------------------------------------------------------
+    size_t Utils::toDoubleList( const ParserChar** buffer, const ParserChar* bufferEnd, double* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+    {
+        return toList<double, &convertSimpleFloatingPoints<double>, &Utils::toDouble>(buffer, bufferEnd, values, maxCount, lastValueStart, failed);
+    }
+
+    //--------------------------------------------------------------------
+    size_t Utils::toUint64List( const ParserChar** buffer, const ParserChar* bufferEnd, uint64* values, size_t maxCount, const ParserChar** lastValueStart, bool& failed )
+    {
+        return toList<uint64, &convertSimpleUint64s, &Utils::toUint64>(buffer, bufferEnd, values, maxCount, lastValueStart, failed);
+    }
+
 } // namespace GeneratedSaxParser
@@ -0,0 +1,177 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "GeneratedSaxParserXmlScanner.h"
+#include "GeneratedSaxParserUtils.h"
+
+#include <string.h>
+
+
+namespace GeneratedSaxParser
+{
+
+	//--------------------------------------------------------------------
+	const ParserChar* XmlScanner::findMarkup( const ParserChar* pos, const ParserChar* bufferEnd )
+	{
+		if ( pos >= bufferEnd )
+			return bufferEnd;
+		// memchr is vectorized by the c runtimes, character data is skipped at memory bandwidth
+		const ParserChar* markup = (const ParserChar*)memchr( pos, '<', bufferEnd - pos );
+		return markup ? markup : bufferEnd;
+	}
+
+	//--------------------------------------------------------------------
+	const ParserChar* XmlScanner::skipMarkup( const ParserChar* markup, const ParserChar* bufferEnd, MarkupType& type )
+	{
+		const ParserChar* pos = markup + 1;
+		if ( pos >= bufferEnd )
+			return 0;
+
+		bool empty = false;
+		switch ( *pos )
+		{
+		case '/':
+			type = MARKUP_END_TAG;
+			return skipTag( pos + 1, bufferEnd, empty );
+		case '?':
+			type = MARKUP_OTHER;
+			return skipBehind( pos + 1, bufferEnd, "?>", 2 );
+		case '!':
+			type = MARKUP_OTHER;
+			if ( (bufferEnd - pos >= 3) && (pos[1] == '-') && (pos[2] == '-') )
+				return skipBehind( pos + 3, bufferEnd, "-->", 3 );
+			if ( (bufferEnd - pos >= 8) && (memcmp(pos + 1, "[CDATA[", 7) == 0) )
+				return skipBehind( pos + 8, bufferEnd, "]]>", 3 );
+			return skipDeclaration( pos + 1, bufferEnd );
+		default:
+			pos = skipTag( pos, bufferEnd, empty );
+			type = empty ? MARKUP_EMPTY_ELEMENT_TAG : MARKUP_START_TAG;
+			return pos;
+		}
+	}
+
+	//--------------------------------------------------------------------
+	const ParserChar* XmlScanner::skipElement( const ParserChar* element, const ParserChar* bufferEnd )
+	{
+		MarkupType type;
+		const ParserChar* pos = skipMarkup( element, bufferEnd, type );
+		if ( !pos || (type == MARKUP_EMPTY_ELEMENT_TAG) )
+			return pos;
+		if ( type != MARKUP_START_TAG )
+			return 0;
+
+		// Only the tags are looked at, the nesting depth is sufficient to find the matching end tag
+		size_t depth = 1;
+		while ( depth > 0 )
+		{
+			pos = findMarkup( pos, bufferEnd );
+			if ( pos == bufferEnd )
+				return 0;
+			pos = skipMarkup( pos, bufferEnd, type );
+			if ( !pos )
+				return 0;
+			if ( type == MARKUP_START_TAG )
+				depth++;
+			else if ( type == MARKUP_END_TAG )
+				depth--;
+		}
+		return pos;
+	}
+
+	//--------------------------------------------------------------------
+	const ParserChar* XmlScanner::getElementName( const ParserChar* tag, const ParserChar* bufferEnd, size_t& nameLength )
+	{
+		const ParserChar* name = tag + 1;
+		if ( (name < bufferEnd) && (*name == '/') )
+			name++;
+		const ParserChar* nameEnd = name;
+		while ( (nameEnd < bufferEnd) && !Utils::isWhiteSpace(*nameEnd) && (*nameEnd != '/') && (*nameEnd != '>') )
+			nameEnd++;
+		nameLength = nameEnd - name;
+		return name;
+	}
+
+	//--------------------------------------------------------------------
+	const ParserChar* XmlScanner::skipBehind( const ParserChar* pos, const ParserChar* bufferEnd, const char* terminator, size_t terminatorLength )
+	{
+		while ( (size_t)(bufferEnd - pos) >= terminatorLength )
+		{
+			const ParserChar* candidate = (const ParserChar*)memchr( pos, terminator[0], bufferEnd - pos - terminatorLength + 1 );
+			if ( !candidate )
+				return 0;
+			if ( memcmp(candidate, terminator, terminatorLength) == 0 )
+				return candidate + terminatorLength;
+			pos = candidate + 1;
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	const ParserChar* XmlScanner::skipTag( const ParserChar* pos, const ParserChar* bufferEnd, bool& empty )
+	{
+		while ( pos < bufferEnd )
+		{
+			ParserChar c = *pos;
+			if ( c == '>' )
+			{
+				empty = (pos[-1] == '/');
+				return pos + 1;
+			}
+			if ( (c == '"') || (c == '\'') )
+			{
+				pos = (const ParserChar*)memchr( pos + 1, c, bufferEnd - pos - 1 );
+				if ( !pos )
+					return 0;
+			}
+			pos++;
+		}
+		return 0;
+	}
+
+	//--------------------------------------------------------------------
+	const ParserChar* XmlScanner::skipDeclaration( const ParserChar* pos, const ParserChar* bufferEnd )
+	{
+		// The internal subset of a document type declaration is enclosed in brackets and may contain
+		// markup declarations and comments
+		size_t bracketDepth = 0;
+		while ( pos < bufferEnd )
+		{
+			ParserChar c = *pos;
+			if ( (c == '>') && (bracketDepth == 0) )
+			{
+				return pos + 1;
+			}
+			else if ( (c == '"') || (c == '\'') )
+			{
+				pos = (const ParserChar*)memchr( pos + 1, c, bufferEnd - pos - 1 );
+				if ( !pos )
+					return 0;
+			}
+			else if ( c == '[' )
+			{
+				bracketDepth++;
+			}
+			else if ( (c == ']') && (bracketDepth > 0) )
+			{
+				bracketDepth--;
+			}
+			else if ( (c == '<') && (bufferEnd - pos >= 4) && (memcmp(pos, "<!--", 4) == 0) )
+			{
+				pos = skipBehind( pos + 4, bufferEnd, "-->", 3 );
+				if ( !pos )
+					return 0;
+				continue;
+			}
+			pos++;
+		}
+		return 0;
+	}
+
+} // namespace GeneratedSaxParser
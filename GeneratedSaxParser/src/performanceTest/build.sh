@@ -0,0 +1,21 @@
+
+OPTIONS="-std=c++11 -O3 -Wall -DGENERATEDSAXPARSER_XMLPARSER_LIBXML -DPCRE_STATIC"
+
+INCLUDES="-I../../include -I../../include/performanceTest -I../../../COLLADABaseUtils/include -I../../../COLLADABaseUtils/include/Math -I../../../Externals/pcre/include -I../../../Externals/UTF/include -I../../../Externals/zlib/include -I/usr/include/libxml2"
+
+FILES="main.cpp performanceTest.cpp ../GeneratedSaxParserParser.cpp ../GeneratedSaxParserSaxParser.cpp ../GeneratedSaxParserLibxmlSaxParser.cpp ../GeneratedSaxParserMemoryMappedFile.cpp ../GeneratedSaxParserParserError.cpp ../GeneratedSaxParserUtils.cpp ../GeneratedSaxParserXmlScanner.cpp ../GeneratedSaxParserCompressedFileReader.cpp"
+
+# GeneratedSaxParserUtils depends on COLLADABU::URI
+BASEUTILSFILES="../../../COLLADABaseUtils/src/COLLADABUURI.cpp ../../../COLLADABaseUtils/src/COLLADABUUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUStringUtils.cpp ../../../COLLADABaseUtils/src/COLLADABUPcreCompiledPattern.cpp ../../../COLLADABaseUtils/src/COLLADABUNativeString.cpp ../../../COLLADABaseUtils/src/COLLADABUHashFunctions.cpp"
+
+CFILES="../../../Externals/UTF/src/ConvertUTF.c ../../../Externals/pcre/src/*.c"
+
+LIBS="-lxml2 -lz"
+
+OUTPUTFILE="-o performanceTest"
+
+
+
+gcc -c -O3 -DPCRE_STATIC -I../../../Externals/pcre/include -I../../../Externals/UTF/include $CFILES
+g++ $OPTIONS $INCLUDES $FILES $BASEUTILSFILES *.o $LIBS $OUTPUTFILE
+rm -f *.o
@@ -0,0 +1,31 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+int main( int argc, char** argv )
+{
+	if ( argc < 2 )
+	{
+		printf("usage: performanceTest <file.dae> [repetitions]\n");
+		return 1;
+	}
+
+	int repetitions = (argc > 2) ? atoi(argv[2]) : 5;
+	performanceTest( argv[1], repetitions );
+	listConversionPerformanceTest( 10000000, repetitions );
+	elementSkippingPerformanceTest( 5000000, repetitions );
+
+	return 0;
+}
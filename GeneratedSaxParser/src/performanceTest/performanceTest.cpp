@@ -0,0 +1,321 @@
+/*
+    Copyright (c) 2008-2009 NetAllied Systems GmbH
+
+    This file is part of GeneratedSaxParser.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "performanceTest.h"
+
+#include "GeneratedSaxParserParser.h"
+#include "GeneratedSaxParserMemoryMappedFile.h"
+#include "GeneratedSaxParserUtils.h"
+#include "GeneratedSaxParserXmlScanner.h"
+#if defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+#	include "GeneratedSaxParserExpatSaxParser.h"
+#else
+#	include "GeneratedSaxParserLibxmlSaxParser.h"
+#endif
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/types.h>
+#include <sys/timeb.h>
+
+
+namespace
+{
+	/** Parser that only touches the character data, to measure the cost of the input layer.*/
+	class CountingParser : public GeneratedSaxParser::Parser
+	{
+	public:
+		size_t mElementCount;
+		size_t mCharacterCount;
+
+		CountingParser() : GeneratedSaxParser::Parser(0), mElementCount(0), mCharacterCount(0) {}
+
+		virtual bool elementBegin( const GeneratedSaxParser::ParserChar* elementName, const GeneratedSaxParser::ParserAttributes& attributes )
+		{
+			++mElementCount;
+			return true;
+		}
+
+		virtual bool elementEnd( const GeneratedSaxParser::ParserChar* elementName )
+		{
+			return true;
+		}
+
+		virtual bool textData( const GeneratedSaxParser::ParserChar* text, size_t textLength )
+		{
+			mCharacterCount += textLength;
+			return true;
+		}
+	};
+
+	double getTime()
+	{
+#ifdef WIN32
+#pragma warning(disable: 4996)
+		_timeb timeBuffer;
+		_ftime( &timeBuffer );
+#pragma warning(default: 4996)
+#else
+		timeb timeBuffer;
+		ftime( &timeBuffer );
+#endif
+		return (double)timeBuffer.time + (double)timeBuffer.millitm / 1000;
+	}
+
+	double parse( const char* fileName, int repetitions, bool memoryMapped )
+	{
+		CountingParser parser;
+#if defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+		GeneratedSaxParser::ExpatSaxParser saxParser( &parser, 64*1024 );
+#else
+		GeneratedSaxParser::LibxmlSaxParser saxParser( &parser );
+#endif
+
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			if ( memoryMapped )
+				saxParser.parseMappedFile( fileName );
+			else
+				saxParser.parseFile( fileName );
+		}
+		return getTime() - startTime;
+	}
+
+	/** Converts @a text value by value, as the parser did before the bulk conversion was added.*/
+	template<class DataType, DataType (*toData)( const GeneratedSaxParser::ParserChar**, const GeneratedSaxParser::ParserChar*, bool& )>
+	double convertSingleValues( const std::string& text, int repetitions, DataType& checkSum )
+	{
+		const GeneratedSaxParser::ParserChar* bufferEnd = text.c_str() + text.size();
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			const GeneratedSaxParser::ParserChar* pos = text.c_str();
+			bool failed = false;
+			while ( !failed )
+			{
+				DataType value = toData(&pos, bufferEnd, failed);
+				if ( !failed )
+					checkSum += value;
+			}
+		}
+		return getTime() - startTime;
+	}
+
+	template<class DataType, DataType (*toData)( const GeneratedSaxParser::ParserChar**, const GeneratedSaxParser::ParserChar*, bool& )>
+	double convertList( const std::string& text, int repetitions, DataType& checkSum )
+	{
+		const size_t BUFFER_SIZE = 1000;
+		DataType values[BUFFER_SIZE];
+		const GeneratedSaxParser::ParserChar* bufferEnd = text.c_str() + text.size();
+		double startTime = getTime();
+		for ( int i = 0; i < repetitions; ++i )
+		{
+			const GeneratedSaxParser::ParserChar* pos = text.c_str();
+			const GeneratedSaxParser::ParserChar* lastValueStart = pos;
+			bool failed = false;
+			while ( !failed )
+			{
+				size_t count = GeneratedSaxParser::Utils::toDataList<DataType, toData>(&pos, bufferEnd, values, BUFFER_SIZE, &lastValueStart, failed);
+				for ( size_t j = 0; j < count; ++j )
+					checkSum += values[j];
+			}
+		}
+		return getTime() - startTime;
+	}
+
+	template<class DataType, DataType (*toData)( const GeneratedSaxParser::ParserChar**, const GeneratedSaxParser::ParserChar*, bool& )>
+	void compareConversions( const char* name, const std::string& text, size_t valueCount, int repetitions )
+	{
+		DataType singleCheckSum = 0;
+		DataType listCheckSum = 0;
+		double singleTime = convertSingleValues<DataType, toData>( text, repetitions, singleCheckSum );
+		double listTime = convertList<DataType, toData>( text, repetitions, listCheckSum );
+		double totalValues = (double)valueCount * repetitions / 1000000;
+
+		std::cout << name << " single values: " << singleTime << " s, " << totalValues / singleTime << " M values/s" << std::endl;
+		std::cout << name << " list:          " << listTime << " s, " << totalValues / listTime << " M values/s" << std::endl;
+		if ( singleCheckSum != listCheckSum )
+			std::cout << name << " results differ" << std::endl;
+	}
+
+	/** Writes a document with one mesh with @a vertexCount vertices and triangles and a small visual scene
+	to @a fileName.*/
+	void writeMeshDocument( const char* fileName, size_t vertexCount )
+	{
+		std::ofstream file( fileName, std::ios::binary );
+		file << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+			 << "<COLLADA xmlns=\"http://www.collada.org/2005/11/COLLADASchema\" version=\"1.4.1\">\n"
+			 << "  <asset><unit meter=\"1\" name=\"meter\"/><up_axis>Y_UP</up_axis></asset>\n"
+			 << "  <library_geometries>\n"
+			 << "    <geometry id=\"mesh\"><mesh>\n"
+			 << "      <source id=\"positions\"><float_array id=\"positions-array\" count=\"" << 3 * vertexCount << "\">";
+		file.precision(7);
+		for ( size_t i = 0; i < 3 * vertexCount; ++i )
+			file << ((double)rand() / RAND_MAX - 0.5) * 200 << ( (i % 3 == 2) ? "\n" : " " );
+		file << "</float_array>\n"
+			 << "        <technique_common><accessor source=\"#positions-array\" count=\"" << vertexCount << "\" stride=\"3\">"
+			 << "<param name=\"X\" type=\"float\"/><param name=\"Y\" type=\"float\"/><param name=\"Z\" type=\"float\"/></accessor></technique_common>\n"
+			 << "      </source>\n"
+			 << "      <vertices id=\"vertices\"><input semantic=\"POSITION\" source=\"#positions\"/></vertices>\n"
+			 << "      <!-- <triangles> of a comment are not counted -->\n"
+			 << "      <triangles count=\"" << vertexCount << "\"><input semantic=\"VERTEX\" source=\"#vertices\" offset=\"0\"/><p>";
+		for ( size_t i = 0; i < 3 * vertexCount; ++i )
+			file << rand() % vertexCount << " ";
+		file << "</p></triangles>\n"
+			 << "    </mesh></geometry>\n"
+			 << "  </library_geometries>\n"
+			 << "  <library_visual_scenes><visual_scene id=\"scene\">\n";
+		for ( size_t i = 0; i < 100; ++i )
+			file << "    <node id=\"node" << i << "\"><translate>1 2 3</translate><instance_geometry url=\"#mesh\"/></node>\n";
+		file << "  </visual_scene></library_visual_scenes>\n"
+			 << "  <scene><instance_visual_scene url=\"#scene\"/></scene>\n"
+			 << "</COLLADA>\n";
+	}
+
+	/** Fills @a ranges with the byte ranges of the document at @a data without the elements below the root
+	element named @a skippedElementName, found by scanning the raw bytes.*/
+	bool scanRanges( const char* data, size_t length, const char* skippedElementName, GeneratedSaxParser::SaxParser::FileRangeList& ranges )
+	{
+		typedef GeneratedSaxParser::XmlScanner XmlScanner;
+		const char* dataEnd = data + length;
+		size_t skippedNameLength = strlen( skippedElementName );
+
+		ranges.clear();
+		const char* pos = data;
+		XmlScanner::MarkupType type = XmlScanner::MARKUP_OTHER;
+		while ( type == XmlScanner::MARKUP_OTHER )
+		{
+			pos = XmlScanner::findMarkup( pos, dataEnd );
+			if ( (pos == dataEnd) || !(pos = XmlScanner::skipMarkup(pos, dataEnd, type)) )
+				return false;
+		}
+
+		GeneratedSaxParser::SaxParser::FileRange range = { 0, (size_t)(pos - data) };
+		while ( (pos = XmlScanner::findMarkup(pos, dataEnd)) != dataEnd )
+		{
+			const char* markup = pos;
+			pos = XmlScanner::skipMarkup( markup, dataEnd, type );
+			if ( pos && (type == XmlScanner::MARKUP_START_TAG) )
+				pos = XmlScanner::skipElement( markup, dataEnd );
+			if ( !pos )
+				return false;
+			if ( (type != XmlScanner::MARKUP_START_TAG) && (type != XmlScanner::MARKUP_EMPTY_ELEMENT_TAG) )
+				continue;
+
+			size_t nameLength = 0;
+			const char* name = XmlScanner::getElementName( markup, dataEnd, nameLength );
+			if ( (nameLength == skippedNameLength) && (memcmp(name, skippedElementName, nameLength) == 0) )
+			{
+				range.end = markup - data;
+				ranges.push_back( range );
+				range.begin = pos - data;
+			}
+		}
+		range.end = length;
+		ranges.push_back( range );
+		return true;
+	}
+}
+
+
+void performanceTest( const char* fileName, int repetitions )
+{
+	GeneratedSaxParser::MemoryMappedFile file;
+	if ( !file.open(fileName) )
+	{
+		std::cout << "could not open " << fileName << std::endl;
+		return;
+	}
+	double totalBytes = (double)file.getSize() * repetitions;
+	file.close();
+
+	double streamedTime = parse( fileName, repetitions, false );
+	double mappedTime = parse( fileName, repetitions, true );
+
+	std::cout << "streamed:      " << streamedTime << " s, " << totalBytes / streamedTime / (1024*1024) << " MB/s" << std::endl;
+	std::cout << "memory mapped: " << mappedTime << " s, " << totalBytes / mappedTime / (1024*1024) << " MB/s" << std::endl;
+}
+
+
+void listConversionPerformanceTest( size_t valueCount, int repetitions )
+{
+	// the text ends with a white space, so the last value is not treated as incomplete fragment
+	std::ostringstream floatStream;
+	std::ostringstream indexStream;
+	floatStream.precision(7);
+	for ( size_t i = 0; i < valueCount; ++i )
+	{
+		floatStream << ((double)rand() / RAND_MAX - 0.5) * 200 << ( (i % 3 == 2) ? "\n" : " " );
+		indexStream << rand() % 100000 << " ";
+	}
+
+	compareConversions<float, &GeneratedSaxParser::Utils::toFloat>( "float ", floatStream.str(), valueCount, repetitions );
+	compareConversions<double, &GeneratedSaxParser::Utils::toDouble>( "double", floatStream.str(), valueCount, repetitions );
+	compareConversions<GeneratedSaxParser::uint64, &GeneratedSaxParser::Utils::toUint64>( "uint64", indexStream.str(), valueCount, repetitions );
+}
+
+
+void elementSkippingPerformanceTest( size_t vertexCount, int repetitions )
+{
+	const char* fileName = "elementSkippingPerformanceTest.dae";
+	writeMeshDocument( fileName, vertexCount );
+
+	GeneratedSaxParser::MemoryMappedFile file;
+	if ( !file.open(fileName) )
+	{
+		std::cout << "could not open " << fileName << std::endl;
+		return;
+	}
+	double totalBytes = (double)file.getSize() * repetitions;
+
+	CountingParser fullParser;
+	CountingParser skippingParser;
+#if defined(GENERATEDSAXPARSER_XMLPARSER_EXPAT)
+	GeneratedSaxParser::ExpatSaxParser fullSaxParser( &fullParser, 64*1024 );
+	GeneratedSaxParser::ExpatSaxParser skippingSaxParser( &skippingParser, 64*1024 );
+#else
+	GeneratedSaxParser::LibxmlSaxParser fullSaxParser( &fullParser );
+	GeneratedSaxParser::LibxmlSaxParser skippingSaxParser( &skippingParser );
+#endif
+
+	// the parser reports every element of the library, which the loader then ignores
+	double startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+		fullSaxParser.parseMappedFile( fileName );
+	double fullTime = getTime() - startTime;
+
+	GeneratedSaxParser::SaxParser::FileRangeList ranges;
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+		scanRanges( file.getData(), file.getSize(), "library_geometries", ranges );
+	double scanTime = getTime() - startTime;
+
+	startTime = getTime();
+	for ( int i = 0; i < repetitions; ++i )
+	{
+		scanRanges( file.getData(), file.getSize(), "library_geometries", ranges );
+		skippingSaxParser.parseFileRanges( fileName, ranges );
+	}
+	double skippingTime = getTime() - startTime;
+
+	file.close();
+	remove( fileName );
+
+	std::cout << "geometries parsed and ignored:  " << fullTime << " s, " << totalBytes / fullTime / (1024*1024) << " MB/s, " << fullParser.mElementCount / repetitions << " elements" << std::endl;
+	std::cout << "geometries skipped by scanning: " << skippingTime << " s, " << totalBytes / skippingTime / (1024*1024) << " MB/s, " << skippingParser.mElementCount / repetitions << " elements" << std::endl;
+	std::cout << "scanning only:                  " << scanTime << " s, " << totalBytes / scanTime / (1024*1024) << " MB/s" << std::endl;
+}
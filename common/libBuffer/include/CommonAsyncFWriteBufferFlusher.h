@@ -0,0 +1,119 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COMMON_ASYNCFWRITEBUFFERFLUSHER_H__
+#define __COMMON_ASYNCFWRITEBUFFERFLUSHER_H__
+
+#include "CommonIBufferFlusher.h"
+#include "CommonFWriteBufferFlusher.h"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace Common
+{
+	/** Writes the received data to a file on a background thread, such that the data can be produced
+	while the previously received data is written. The received data is copied into one of a fixed
+	number of blocks, which are passed to the writer thread in order. receiveData only waits, if all
+	blocks are waiting to be written. The marks are handled by an FWriteBufferFlusher, after all
+	previously received data has been written.*/
+	class AsyncFWriteBufferFlusher : public IBufferFlusher
+	{
+	private:
+		typedef std::vector<char> Block;
+
+	public:
+		static const size_t DEFAULT_BLOCK_COUNT = 4;
+
+	private:
+		/** Writes the data to the file on the writer thread.*/
+		FWriteBufferFlusher mFlusher;
+
+		/** All blocks, they are owned by the flusher.*/
+		std::vector<Block*> mBlocks;
+
+		/** Blocks that are not in use.*/
+		std::vector<Block*> mFreeBlocks;
+
+		/** Blocks waiting to be written, in the order they have been received.*/
+		std::deque<Block*> mPendingBlocks;
+
+		/** True, while the writer thread writes a block.*/
+		bool mWriting;
+
+		/** True, if writing a block has failed.*/
+		bool mWriteFailed;
+
+		/** True, if the writer thread should terminate.*/
+		bool mStopping;
+
+		/** Guards all the members above, except mFlusher, which is only used by the writer thread
+		or while no block is pending.*/
+		std::mutex mMutex;
+
+		/** Notified, when a block has been received or the writer thread should terminate.*/
+		std::condition_variable mBlockReceived;
+
+		/** Notified, when the writer thread has written a block.*/
+		std::condition_variable mBlockWritten;
+
+		/** The writer thread.*/
+		std::thread mThread;
+
+	public:
+		/** Constructor. Opens the file @a fileName and starts the writer thread.
+		@param bufferSize The buffer size of the stream used by the writer thread.
+		@param blockCount The maximum number of blocks waiting to be written.*/
+		AsyncFWriteBufferFlusher( const char* fileName,
+								  size_t bufferSize = FWriteBufferFlusher::DEFAUL_BUFFER_SIZE,
+								  size_t blockCount = DEFAULT_BLOCK_COUNT,
+								  const char* mode="wb" );
+
+		/** Destructor. Writes all pending blocks and waits for the writer thread to terminate.*/
+		virtual ~AsyncFWriteBufferFlusher();
+
+		/** The error code of fopen_s.*/
+		int getError() const { return mFlusher.getError(); }
+
+		/** Copies @a length bytes starting at @a buffer into a block, that will be written by the
+		writer thread.
+		@return False, if writing a previous block has failed, true otherwise.*/
+		virtual bool receiveData( const char* buffer, size_t length);
+
+		/** Waits until all the data previously received by receiveData has been written and flushes it.*/
+		virtual bool flush();
+
+		void startMark();
+
+		IBufferFlusher::MarkId endMark();
+
+		bool jumpToMark(IBufferFlusher::MarkId markId, bool keepMarkId = false);
+
+	private:
+        /** Disable default copy ctor. */
+		AsyncFWriteBufferFlusher( const AsyncFWriteBufferFlusher& pre );
+        /** Disable default assignment operator. */
+		const AsyncFWriteBufferFlusher& operator= ( const AsyncFWriteBufferFlusher& pre );
+
+		/** Waits until all received blocks have been written.
+		@return False, if writing a block has failed, true otherwise.*/
+		bool waitUntilWritten();
+
+		/** Executed by the writer thread. Writes the pending blocks until mStopping is set.*/
+		void run();
+
+	};
+} // namespace COMMON
+
+#endif // __COMMON_ASYNCFWRITEBUFFERFLUSHER_H__
@@ -58,13 +58,29 @@ namespace Common
 		void setFalseString( const char* falseString);
 
 
-		/** Copies a string representation @a f  into the buffer.*/
+		/** Copies the shortest string representation of @a f into the buffer, that is parsed back to the
+		same float.*/
 		bool copyToBufferAsChar( float f);
 
 		/** Copies a string representation @a d into the buffer. Uses double precision representation 
-		( 16 digits ) if @a doublePrecision is true, otherwise single precision as the float version.*/
+		( 16 digits ) if @a doublePrecision is true, otherwise 6 significant digits.*/
 		bool copyToBufferAsChar( double d, bool doublePrecision = false);
 
+		/** Copies the shortest string representations of the @a count floats in @a values into the buffer,
+		that are parsed back to the same floats, each one followed by @a separator. Values whose absolute value 
+		is less than @a zeroTolerance are written as 0. The buffer space is reserved for blocks of values, 
+		instead of for each value.*/
+		bool copyToBufferAsChar( const float* values, size_t count, char separator, float zeroTolerance = 0);
+
+		/** Copies the string representations of the @a count doubles in @a values into the buffer, each 
+		one followed by @a separator. Values whose absolute value is less than @a zeroTolerance are written as 0. 
+		Uses double precision representation if @a doublePrecision is true, otherwise single precision.*/
+		bool copyToBufferAsChar( const double* values, size_t count, char separator, bool doublePrecision = false, double zeroTolerance = 0);
+
+		/** Copies the decimal string representations of the @a count ints in @a values into the buffer, each 
+		one followed by @a separator. The buffer space is reserved for blocks of values, instead of for each value.*/
+		bool copyToBufferAsChar( const int* values, size_t count, char separator);
+
 		/** Copies a string representation @a i into the buffer.*/
 		bool copyToBufferAsChar( char i);
 		bool copyToBufferAsChar( unsigned char i);
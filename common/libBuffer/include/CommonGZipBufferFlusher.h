@@ -0,0 +1,196 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#ifndef __COMMON_GZIPBUFFERFLUSHER_H__
+#define __COMMON_GZIPBUFFERFLUSHER_H__
+
+#include "CommonIBufferFlusher.h"
+
+#include <cstdio>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+struct z_stream_s;
+
+
+namespace Common
+{
+	/** Writes the received data deflate compressed to a gzip file. The data is compressed in blocks,
+	which are either compressed by the thread that passes the data or by a pool of worker threads.
+	Each block uses the end of the previous block as dictionary, such that the compression ratio is
+	close to the one of a single deflate stream. The blocks are written in order, the result is one
+	gzip member that can be read by any gzip decoder.
+	Since the compressed stream can not be rewritten, marks are not supported.*/
+	class GZipBufferFlusher : public IBufferFlusher
+	{
+	private:
+		/** A block of received data, and its compressed representation.*/
+		struct Block
+		{
+			/** The data preceding the block, at most the deflate window size.*/
+			std::vector<char> dictionary;
+
+			/** The received data.*/
+			std::vector<char> input;
+
+			/** The compressed data.*/
+			std::vector<char> output;
+
+			/** CRC-32 of the received data.*/
+			unsigned long crc;
+
+			/** True, if this is the last block of the stream.*/
+			bool last;
+
+			/** True, if the block has been compressed.*/
+			bool compressed;
+
+			/** True, if the compression has failed.*/
+			bool failed;
+		};
+
+	public:
+		static const size_t DEFAULT_BLOCK_SIZE = 128*1024;
+
+		/** The zlib default compression level.*/
+		static const int DEFAULT_LEVEL = -1;
+
+	private:
+		/** The stream to write the data to.*/
+		FILE* mStream;
+
+		/** The error code of fopen_s.*/
+		int mError;
+
+		/** The compression level, 0 to 9 or DEFAULT_LEVEL.*/
+		int mLevel;
+
+		/** The size of the blocks the data is compressed in.*/
+		size_t mBlockSize;
+
+		/** The block the received data is copied to.*/
+		Block* mCurrentBlock;
+
+		/** The end of the last data passed to a block, used as dictionary of the next block.*/
+		std::vector<char> mWindow;
+
+		/** The compression stream of the thread that passes the data, if there are no worker threads.*/
+		z_stream_s* mZStream;
+
+		/** CRC-32 of all data written so far.*/
+		unsigned long mCrc;
+
+		/** Number of uncompressed bytes written so far.*/
+		unsigned long mSize;
+
+		/** True, if writing or compressing has failed.*/
+		bool mFailed;
+
+		/** True, if the last block has been written.*/
+		bool mFinished;
+
+		/** Blocks passed to the workers, in stream order. Only used by the thread that passes the data.*/
+		std::deque<Block*> mQueuedBlocks;
+
+		/** Blocks that can be reused.*/
+		std::vector<Block*> mFreeBlocks;
+
+		/** Blocks not yet taken by a worker thread.*/
+		std::deque<Block*> mPendingBlocks;
+
+		/** True, if the worker threads should terminate.*/
+		bool mStopping;
+
+		/** Guards mPendingBlocks, mStopping and the compressed flags of the queued blocks.*/
+		std::mutex mMutex;
+
+		/** Notified, when a block has been queued or the worker threads should terminate.*/
+		std::condition_variable mBlockQueued;
+
+		/** Notified, when a worker thread has compressed a block.*/
+		std::condition_variable mBlockCompressed;
+
+		/** The worker threads.*/
+		std::vector<std::thread> mThreads;
+
+	public:
+		/** Constructor. Creates the file @a fileName and writes the gzip header.
+		@param level The compression level, 0 (no compression) to 9 (best compression).
+		@param threadCount The number of worker threads that compress the blocks. If zero, the
+		blocks are compressed by the thread that passes the data.
+		@param blockSize The size of the blocks the data is compressed in.*/
+		GZipBufferFlusher( const char* fileName,
+						   int level = DEFAULT_LEVEL,
+						   size_t threadCount = 0,
+						   size_t blockSize = DEFAULT_BLOCK_SIZE );
+
+		/** Destructor. Compresses and writes all received data, writes the gzip trailer and closes
+		the file.*/
+		virtual ~GZipBufferFlusher();
+
+		/** The error code of fopen_s.*/
+		int getError() const { return mError; }
+
+		/** Receives and handles @a length bytes starting at @a buffer.
+		@return False, if compressing or writing has failed, true otherwise.*/
+		virtual bool receiveData( const char* buffer, size_t length);
+
+		/** Compresses and writes all the data previously received by receiveData.*/
+		virtual bool flush();
+
+		/** Marks are not supported.*/
+		void startMark();
+
+		/** Marks are not supported. Returns INVALID_ID.*/
+		IBufferFlusher::MarkId endMark();
+
+		/** Marks are not supported. Succeeds only for END_OF_STREAM, since all data is appended to
+		the end of the stream.*/
+		bool jumpToMark(IBufferFlusher::MarkId markId, bool keepMarkId = false);
+
+	private:
+        /** Disable default copy ctor. */
+		GZipBufferFlusher( const GZipBufferFlusher& pre );
+        /** Disable default assignment operator. */
+		const GZipBufferFlusher& operator= ( const GZipBufferFlusher& pre );
+
+		/** Returns a new or reused block.*/
+		Block* createBlock();
+
+		/** Passes the current block to compression. If @a last is true, the deflate stream is
+		finished with the block.*/
+		bool submitCurrentBlock( bool last );
+
+		/** Writes the compressed queued blocks in order. If @a wait is true, waits until all
+		queued blocks have been compressed and written.*/
+		bool writeQueuedBlocks( bool wait );
+
+		/** Writes the compressed @a block and marks it as free.*/
+		bool writeBlock( Block* block );
+
+		/** Creates a raw deflate stream. Returns 0 on failure.*/
+		z_stream_s* createZStream() const;
+
+		/** Deletes a stream created by createZStream.*/
+		static void deleteZStream( z_stream_s* zStream );
+
+		/** Compresses @a block using @a zStream. Sets the failed flag of @a block on failure.*/
+		static void compressBlock( Block* block, z_stream_s* zStream );
+
+		/** Executed by the worker threads. Compresses pending blocks until mStopping is set.*/
+		void run();
+
+	};
+} // namespace COMMON
+
+#endif // __COMMON_GZIPBUFFERFLUSHER_H__
@@ -13,5 +13,13 @@
 
 void performanceTest();
 
+/** Compares the time required to write a large file through a CharacterBuffer to an FWriteBufferFlusher 
+and to an AsyncFWriteBufferFlusher.*/
+void asyncFlusherPerformanceTest();
+
+/** Compares the time required to write a large file uncompressed and gzip compressed with several 
+compression levels and worker thread counts.*/
+void gzipFlusherPerformanceTest();
+
 
 #endif // ___PERFORMANCETEST_H__
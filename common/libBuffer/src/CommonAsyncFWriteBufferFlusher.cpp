@@ -0,0 +1,182 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "CommonAsyncFWriteBufferFlusher.h"
+
+
+namespace Common
+{
+	//--------------------------------------------------------------------
+	AsyncFWriteBufferFlusher::AsyncFWriteBufferFlusher( const char* fileName,
+														size_t bufferSize /*= FWriteBufferFlusher::DEFAUL_BUFFER_SIZE*/,
+														size_t blockCount /*= DEFAULT_BLOCK_COUNT*/,
+														const char* mode/*="wb"*/ )
+		: mFlusher( fileName, bufferSize, mode )
+		, mWriting( false )
+		, mWriteFailed( false )
+		, mStopping( false )
+	{
+		if ( blockCount == 0 )
+		{
+			blockCount = 1;
+		}
+		mBlocks.reserve( blockCount );
+		for ( size_t i = 0; i < blockCount; ++i )
+		{
+			mBlocks.push_back( new Block() );
+		}
+		mFreeBlocks = mBlocks;
+
+		if ( mFlusher.getError() == 0 )
+		{
+			mThread = std::thread( &AsyncFWriteBufferFlusher::run, this );
+		}
+	}
+
+	//--------------------------------------------------------------------
+	AsyncFWriteBufferFlusher::~AsyncFWriteBufferFlusher()
+	{
+		if ( mThread.joinable() )
+		{
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mStopping = true;
+			}
+			mBlockReceived.notify_all();
+			mThread.join();
+		}
+
+		for ( size_t i = 0; i < mBlocks.size(); ++i )
+		{
+			delete mBlocks[i];
+		}
+	}
+
+	//--------------------------------------------------------------------
+	bool AsyncFWriteBufferFlusher::receiveData( const char* buffer, size_t length )
+	{
+		if ( !mThread.joinable() )
+		{
+			return false;
+		}
+
+		Block* block = 0;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			while ( mFreeBlocks.empty() && !mWriteFailed )
+			{
+				mBlockWritten.wait(lock);
+			}
+			if ( mWriteFailed )
+			{
+				return false;
+			}
+			block = mFreeBlocks.back();
+			mFreeBlocks.pop_back();
+		}
+
+		// Copy outside of the lock, the block is owned by this thread until it is pending
+		block->assign( buffer, buffer + length );
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mPendingBlocks.push_back( block );
+		}
+		mBlockReceived.notify_one();
+
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool AsyncFWriteBufferFlusher::flush()
+	{
+		if ( !waitUntilWritten() )
+		{
+			return false;
+		}
+		return mFlusher.flush();
+	}
+
+	//------------------------------
+	void AsyncFWriteBufferFlusher::startMark()
+	{
+		// The file position has to include all data received before
+		waitUntilWritten();
+		mFlusher.startMark();
+	}
+
+	//------------------------------
+	IBufferFlusher::MarkId AsyncFWriteBufferFlusher::endMark()
+	{
+		return mFlusher.endMark();
+	}
+
+	//------------------------------
+	bool AsyncFWriteBufferFlusher::jumpToMark( IBufferFlusher::MarkId markId, bool keepMarkId /*= false*/ )
+	{
+		// The data received before has to be written at the old position
+		if ( !waitUntilWritten() )
+		{
+			return false;
+		}
+		return mFlusher.jumpToMark( markId, keepMarkId );
+	}
+
+	//------------------------------
+	bool AsyncFWriteBufferFlusher::waitUntilWritten()
+	{
+		if ( !mThread.joinable() )
+		{
+			return false;
+		}
+
+		std::unique_lock<std::mutex> lock(mMutex);
+		while ( (!mPendingBlocks.empty() || mWriting) && !mWriteFailed )
+		{
+			mBlockWritten.wait(lock);
+		}
+		return !mWriteFailed;
+	}
+
+	//------------------------------
+	void AsyncFWriteBufferFlusher::run()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		for ( ;; )
+		{
+			while ( mPendingBlocks.empty() && !mStopping )
+			{
+				mBlockReceived.wait(lock);
+			}
+			if ( mPendingBlocks.empty() )
+			{
+				// stopping, and all blocks have been written
+				return;
+			}
+
+			Block* block = mPendingBlocks.front();
+			mPendingBlocks.pop_front();
+			mWriting = true;
+			lock.unlock();
+
+			bool success = block->empty() || mFlusher.receiveData( &(*block)[0], block->size() );
+
+			lock.lock();
+			mWriting = false;
+			mFreeBlocks.push_back( block );
+			if ( !success )
+			{
+				mWriteFailed = true;
+			}
+			mBlockWritten.notify_all();
+		}
+	}
+
+} // namespace Common
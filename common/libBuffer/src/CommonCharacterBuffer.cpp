@@ -66,7 +66,7 @@ namespace Common
 			return false;
 		}
 
-		size_t bytesWritten = ftoa( f, getCurrentPosition() );
+		size_t bytesWritten = ftoaShortest( f, getCurrentPosition() );
 
 		increaseCurrentPosition( bytesWritten );
 
@@ -97,6 +97,116 @@ namespace Common
 		return true;
 	}
 
+	//--------------------------------------------------------------------
+	bool CharacterBuffer::copyToBufferAsChar( const float* values, size_t count, char separator, float zeroTolerance /*= 0*/ )
+	{
+		const size_t maxValueLength = FTOA_BUFFERSIZE + 1;
+		size_t i = 0;
+		while ( i < count )
+		{
+			size_t blockSize = getBytesAvailable() / maxValueLength;
+			if ( blockSize == 0 )
+			{
+				//Not even one float might fit into the buffer. We need to flush first.
+				flushBuffer();
+				blockSize = getBytesAvailable() / maxValueLength;
+				if ( blockSize == 0 )
+				{
+					//No chance to convert the floats with this buffer
+					return false;
+				}
+			}
+
+			size_t blockEnd = std::min( count, i + blockSize );
+			char* start = getCurrentPosition();
+			char* p = start;
+			for ( ; i < blockEnd; ++i )
+			{
+				float f = values[i];
+				if ( f < zeroTolerance && f > -zeroTolerance )
+					*p++ = '0';
+				else
+					p += ftoaShortest( f, p );
+				*p++ = separator;
+			}
+			increaseCurrentPosition( p - start );
+		}
+
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool CharacterBuffer::copyToBufferAsChar( const double* values, size_t count, char separator, bool doublePrecision /*= false*/, double zeroTolerance /*= 0*/ )
+	{
+		const size_t maxValueLength = DTOA_BUFFERSIZE + 1;
+		size_t i = 0;
+		while ( i < count )
+		{
+			size_t blockSize = getBytesAvailable() / maxValueLength;
+			if ( blockSize == 0 )
+			{
+				//Not even one double might fit into the buffer. We need to flush first.
+				flushBuffer();
+				blockSize = getBytesAvailable() / maxValueLength;
+				if ( blockSize == 0 )
+				{
+					//No chance to convert the doubles with this buffer
+					return false;
+				}
+			}
+
+			size_t blockEnd = std::min( count, i + blockSize );
+			char* start = getCurrentPosition();
+			char* p = start;
+			for ( ; i < blockEnd; ++i )
+			{
+				double d = values[i];
+				if ( d < zeroTolerance && d > -zeroTolerance )
+					*p++ = '0';
+				else
+					p += dtoa( d, p, doublePrecision );
+				*p++ = separator;
+			}
+			increaseCurrentPosition( p - start );
+		}
+
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool CharacterBuffer::copyToBufferAsChar( const int* values, size_t count, char separator )
+	{
+		const size_t maxValueLength = Itoa<int>::MINIMUM_BUFFERSIZE_10 + 1;
+		size_t i = 0;
+		while ( i < count )
+		{
+			size_t blockSize = getBytesAvailable() / maxValueLength;
+			if ( blockSize == 0 )
+			{
+				//Not even one int might fit into the buffer. We need to flush first.
+				flushBuffer();
+				blockSize = getBytesAvailable() / maxValueLength;
+				if ( blockSize == 0 )
+				{
+					//No chance to convert the ints with this buffer
+					return false;
+				}
+			}
+
+			size_t blockEnd = std::min( count, i + blockSize );
+			char* start = getCurrentPosition();
+			char* p = start;
+			for ( ; i < blockEnd; ++i )
+			{
+				p += itoa( values[i], p, 10 );
+				*p++ = separator;
+			}
+			increaseCurrentPosition( p - start );
+		}
+
+		return true;
+	}
+
 	//--------------------------------------------------------------------
 	bool CharacterBuffer::copyToBufferAsChar( bool v )
 	{
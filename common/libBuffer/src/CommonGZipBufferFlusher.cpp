@@ -0,0 +1,407 @@
+/*
+    Copyright (c) 2009 NetAllied Systems GmbH
+
+    This file is part of Common libBuffer.
+
+    Licensed under the MIT Open Source License,
+    for details please see LICENSE file or the website
+    http://www.opensource.org/licenses/mit-license.php
+*/
+
+#include "CommonGZipBufferFlusher.h"
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+#include "zlib.h"
+
+
+namespace Common
+{
+	/** The size of the deflate window, i.e. the maximum size of a dictionary.*/
+	static const size_t WINDOW_SIZE = 32*1024;
+
+	/** Magic number, deflate compression method, no flags, no time stamp, no extra flags, unknown OS*/
+	static const unsigned char GZIP_HEADER[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+
+	//--------------------------------------------------------------------
+	GZipBufferFlusher::GZipBufferFlusher( const char* fileName,
+										  int level /*= DEFAULT_LEVEL*/,
+										  size_t threadCount /*= 0*/,
+										  size_t blockSize /*= DEFAULT_BLOCK_SIZE*/ )
+#if defined(_WIN32) && !defined(__GNUC__)
+		: mError( (int)fopen_s( &mStream, fileName, "wb" ) )
+#else
+		: mStream( fopen( fileName, "wb" ) )
+		, mError( mStream ? 0 : errno )
+#endif
+		, mLevel( level )
+		, mBlockSize( blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE )
+		, mCurrentBlock( 0 )
+		, mZStream( 0 )
+		, mCrc( 0 )
+		, mSize( 0 )
+		, mFailed( false )
+		, mFinished( false )
+		, mStopping( false )
+	{
+		if ( mError != 0 )
+		{
+			mStream = 0;
+			return;
+		}
+
+		if ( fwrite( GZIP_HEADER, 1, sizeof(GZIP_HEADER), mStream ) != sizeof(GZIP_HEADER) )
+		{
+			mFailed = true;
+		}
+
+		mCurrentBlock = createBlock();
+
+		if ( threadCount == 0 )
+		{
+			mZStream = createZStream();
+			if ( !mZStream )
+			{
+				mFailed = true;
+			}
+		}
+		else
+		{
+			mThreads.reserve( threadCount );
+			for ( size_t i = 0; i < threadCount; ++i )
+			{
+				mThreads.push_back( std::thread( &GZipBufferFlusher::run, this ) );
+			}
+		}
+	}
+
+	//--------------------------------------------------------------------
+	GZipBufferFlusher::~GZipBufferFlusher()
+	{
+		if ( mStream )
+		{
+			if ( !mFailed && submitCurrentBlock( true ) && writeQueuedBlocks( true ) && mFinished )
+			{
+				unsigned char trailer[8];
+				for ( int i = 0; i < 4; ++i )
+				{
+					trailer[i] = (unsigned char)(mCrc >> (8 * i));
+					trailer[4 + i] = (unsigned char)(mSize >> (8 * i));
+				}
+				fwrite( trailer, 1, sizeof(trailer), mStream );
+			}
+			fclose( mStream );
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStopping = true;
+		}
+		mBlockQueued.notify_all();
+		for ( size_t i = 0; i < mThreads.size(); ++i )
+		{
+			mThreads[i].join();
+		}
+
+		delete mCurrentBlock;
+		for ( size_t i = 0; i < mQueuedBlocks.size(); ++i )
+		{
+			delete mQueuedBlocks[i];
+		}
+		for ( size_t i = 0; i < mFreeBlocks.size(); ++i )
+		{
+			delete mFreeBlocks[i];
+		}
+		deleteZStream( mZStream );
+	}
+
+	//--------------------------------------------------------------------
+	bool GZipBufferFlusher::receiveData( const char* buffer, size_t length )
+	{
+		if ( !mStream || mFailed || mFinished )
+		{
+			return false;
+		}
+
+		while ( length > 0 )
+		{
+			std::vector<char>& input = mCurrentBlock->input;
+			size_t bytesToCopy = std::min( length, mBlockSize - input.size() );
+			input.insert( input.end(), buffer, buffer + bytesToCopy );
+			buffer += bytesToCopy;
+			length -= bytesToCopy;
+
+			if ( input.size() == mBlockSize && !submitCurrentBlock( false ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool GZipBufferFlusher::flush()
+	{
+		if ( !mStream || mFailed )
+		{
+			return false;
+		}
+
+		if ( !mFinished )
+		{
+			if ( !mCurrentBlock->input.empty() && !submitCurrentBlock( false ) )
+			{
+				return false;
+			}
+			if ( !writeQueuedBlocks( true ) )
+			{
+				return false;
+			}
+		}
+		return fflush( mStream ) == 0;
+	}
+
+	//------------------------------
+	void GZipBufferFlusher::startMark()
+	{
+	}
+
+	//------------------------------
+	IBufferFlusher::MarkId GZipBufferFlusher::endMark()
+	{
+		return INVALID_ID;
+	}
+
+	//------------------------------
+	bool GZipBufferFlusher::jumpToMark( IBufferFlusher::MarkId markId, bool keepMarkId /*= false*/ )
+	{
+		return markId == END_OF_STREAM;
+	}
+
+	//------------------------------
+	GZipBufferFlusher::Block* GZipBufferFlusher::createBlock()
+	{
+		Block* block = 0;
+		if ( mFreeBlocks.empty() )
+		{
+			block = new Block();
+			block->input.reserve( mBlockSize );
+		}
+		else
+		{
+			block = mFreeBlocks.back();
+			mFreeBlocks.pop_back();
+		}
+		block->crc = 0;
+		block->last = false;
+		block->compressed = false;
+		block->failed = false;
+		return block;
+	}
+
+	//------------------------------
+	bool GZipBufferFlusher::submitCurrentBlock( bool last )
+	{
+		Block* block = mCurrentBlock;
+		block->last = last;
+		block->dictionary.assign( mWindow.begin(), mWindow.end() );
+
+		// the end of this block is the dictionary of the next one
+		const std::vector<char>& input = block->input;
+		if ( input.size() >= WINDOW_SIZE )
+		{
+			mWindow.assign( input.end() - WINDOW_SIZE, input.end() );
+		}
+		else
+		{
+			mWindow.insert( mWindow.end(), input.begin(), input.end() );
+			if ( mWindow.size() > WINDOW_SIZE )
+			{
+				mWindow.erase( mWindow.begin(), mWindow.end() - WINDOW_SIZE );
+			}
+		}
+
+		mCurrentBlock = last ? 0 : createBlock();
+
+		if ( mThreads.empty() )
+		{
+			compressBlock( block, mZStream );
+			return writeBlock( block );
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mQueuedBlocks.push_back( block );
+			mPendingBlocks.push_back( block );
+		}
+		mBlockQueued.notify_one();
+
+		return writeQueuedBlocks( last );
+	}
+
+	//------------------------------
+	bool GZipBufferFlusher::writeQueuedBlocks( bool wait )
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		while ( !mQueuedBlocks.empty() )
+		{
+			Block* block = mQueuedBlocks.front();
+			if ( !block->compressed )
+			{
+				// Two blocks per thread keep the threads busy, while the oldest one is written
+				if ( !wait && mQueuedBlocks.size() <= 2 * mThreads.size() )
+				{
+					break;
+				}
+				mBlockCompressed.wait(lock);
+				continue;
+			}
+
+			mQueuedBlocks.pop_front();
+			lock.unlock();
+			bool success = writeBlock( block );
+			lock.lock();
+			if ( !success )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//------------------------------
+	bool GZipBufferFlusher::writeBlock( Block* block )
+	{
+		const std::vector<char>& output = block->output;
+		bool success = !block->failed
+			&& ( output.empty() || fwrite( &output[0], 1, output.size(), mStream ) == output.size() );
+
+		if ( success )
+		{
+			mCrc = (mSize == 0) ? block->crc : crc32_combine( mCrc, block->crc, (z_off_t)block->input.size() );
+			mSize += (unsigned long)block->input.size();
+			mFinished = block->last;
+		}
+		else
+		{
+			mFailed = true;
+		}
+
+		block->input.clear();
+		block->output.clear();
+		mFreeBlocks.push_back( block );
+		return success;
+	}
+
+	//------------------------------
+	z_stream_s* GZipBufferFlusher::createZStream() const
+	{
+		z_stream_s* zStream = new z_stream_s;
+		memset( zStream, 0, sizeof(z_stream_s) );
+		// negative window bits for a raw deflate stream, the gzip header and trailer are written by the flusher
+		if ( deflateInit2( zStream, mLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY ) != Z_OK )
+		{
+			delete zStream;
+			return 0;
+		}
+		return zStream;
+	}
+
+	//------------------------------
+	void GZipBufferFlusher::deleteZStream( z_stream_s* zStream )
+	{
+		if ( zStream )
+		{
+			deflateEnd( zStream );
+			delete zStream;
+		}
+	}
+
+	//------------------------------
+	void GZipBufferFlusher::compressBlock( Block* block, z_stream_s* zStream )
+	{
+		std::vector<char>& input = block->input;
+		std::vector<char>& output = block->output;
+
+		block->crc = crc32( 0L, Z_NULL, 0 );
+		if ( !input.empty() )
+		{
+			block->crc = crc32( block->crc, (const Bytef*)&input[0], (uInt)input.size() );
+		}
+
+		if ( !zStream || deflateReset( zStream ) != Z_OK )
+		{
+			block->failed = true;
+			return;
+		}
+
+		const std::vector<char>& dictionary = block->dictionary;
+		if ( !dictionary.empty() && deflateSetDictionary( zStream, (const Bytef*)&dictionary[0], (uInt)dictionary.size() ) != Z_OK )
+		{
+			block->failed = true;
+			return;
+		}
+
+		// sync flush marker and final block
+		output.resize( deflateBound( zStream, (uLong)input.size() ) + 16 );
+		zStream->next_in = input.empty() ? Z_NULL : (Bytef*)&input[0];
+		zStream->avail_in = (uInt)input.size();
+		zStream->next_out = (Bytef*)&output[0];
+		zStream->avail_out = (uInt)output.size();
+
+		// all blocks but the last one end on a byte boundary, such that they can be concatenated
+		int flush = block->last ? Z_FINISH : Z_SYNC_FLUSH;
+		for ( ;; )
+		{
+			if ( deflate( zStream, flush ) == Z_STREAM_ERROR )
+			{
+				block->failed = true;
+				return;
+			}
+			if ( zStream->avail_out != 0 )
+			{
+				break;
+			}
+			size_t outputSize = output.size();
+			output.resize( 2 * outputSize );
+			zStream->next_out = (Bytef*)&output[outputSize];
+			zStream->avail_out = (uInt)outputSize;
+		}
+		output.resize( output.size() - zStream->avail_out );
+	}
+
+	//------------------------------
+	void GZipBufferFlusher::run()
+	{
+		z_stream_s* zStream = createZStream();
+
+		std::unique_lock<std::mutex> lock(mMutex);
+		for ( ;; )
+		{
+			while ( mPendingBlocks.empty() && !mStopping )
+			{
+				mBlockQueued.wait(lock);
+			}
+			if ( mPendingBlocks.empty() )
+			{
+				break;
+			}
+
+			Block* block = mPendingBlocks.front();
+			mPendingBlocks.pop_front();
+			lock.unlock();
+
+			compressBlock( block, zStream );
+
+			lock.lock();
+			block->compressed = true;
+			mBlockCompressed.notify_all();
+		}
+		lock.unlock();
+
+		deleteZStream( zStream );
+	}
+
+} // namespace Common
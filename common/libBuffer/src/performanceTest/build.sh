@@ -1,16 +1,18 @@
 
-OPTIONS="-O3 -Wall"
+OPTIONS="-O3 -Wall -pthread"
 
-INCLUDES="-I../../include -I../../include/performanceTest -I../../../libftoa/include"
+INCLUDES="-I../../include -I../../include/performanceTest -I../../../libftoa/include -I../../../../Externals/UTF/include -I../../../../Externals/zlib/include"
 
-BUFFERFILES="main.cpp performanceTest.cpp ../CommonBuffer.cpp ../CommonFWriteBufferFlusher.cpp ../CommonCharacterBuffer.cpp ../CommonStreamBufferFlusher.cpp "
+BUFFERFILES="main.cpp performanceTest.cpp ../CommonBuffer.cpp ../CommonFWriteBufferFlusher.cpp ../CommonCharacterBuffer.cpp ../CommonStreamBufferFlusher.cpp ../CommonAsyncFWriteBufferFlusher.cpp ../CommonGZipBufferFlusher.cpp "
 
-FTOAFILES="../../../libftoa/src/Commondtoa.cpp ../../../libftoa/src/Commonftoa.cpp"
+FTOAFILES="../../../libftoa/src/Commondtoa.cpp ../../../libftoa/src/Commonftoa.cpp ../../../libftoa/src/Commonitoa.cpp"
 
-FILES=$BUFFERFILES$FTOAFILES
+UTFFILES=" ../../../../Externals/UTF/src/ConvertUTF.c"
+
+FILES=$BUFFERFILES$FTOAFILES$UTFFILES
 
 OUTPUTFILE="-o performanceTest"
 
 
 
-g++ $OPTIONS $INCLUDES $FILES $OUTPUTFILE
\ No newline at end of file
+g++ $OPTIONS $INCLUDES $FILES $OUTPUTFILE -lz
\ No newline at end of file
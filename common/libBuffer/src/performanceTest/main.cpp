@@ -17,6 +17,8 @@ int main()
 {
 	unsigned int i = 0xFFFFFFFF;
 	performanceTest();
+	asyncFlusherPerformanceTest();
+	gzipFlusherPerformanceTest();
 
 	return 0;
 }
@@ -12,15 +12,23 @@
 
 #include "CommonCharacterBuffer.h"
 #include "CommonFWriteBufferFlusher.h"
+#include "CommonAsyncFWriteBufferFlusher.h"
+#include "CommonGZipBufferFlusher.h"
 #include "CommonStreamBufferFlusher.h"
 #include "math.h"
 
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
  #include <errno.h>
 
 #include <sys/types.h>
 #include <sys/timeb.h> 
 
+#include "zlib.h"
+
 
 #ifdef WIN32
 #   define FPRINTF fprintf_s
@@ -132,3 +140,137 @@ void performanceTest()
 	std::cout << std::endl << "time elapsed: " << endTime - startTime << std::endl;
 
 };
+
+
+/** Returns the current time in seconds.*/
+static double currentTime()
+{
+#ifdef WIN32
+#pragma warning(disable: 4996)
+	_timeb timeBuffer;
+	_ftime( &timeBuffer );
+#pragma warning(default: 4996)
+#else
+	timeb timeBuffer;
+	ftime( &timeBuffer );
+#endif
+	return (double)timeBuffer.time + (double)timeBuffer.millitm / 1000;
+}
+
+/** Writes @a valueCount floats through a CharacterBuffer to @a flusher and returns the time elapsed, 
+including the time required to write the remaining data and close the file.*/
+static double writeFloats( Common::IBufferFlusher* flusher, size_t valueCount )
+{
+	// more values than fit into the deflate window
+	const size_t blockSize = 64 * 1024;
+	std::vector<float> values( blockSize );
+	srand( 1 );
+	for ( size_t i = 0; i < blockSize; ++i )
+	{
+		values[i] = (float)sin( (double)i ) * 100 + (float)rand() / RAND_MAX;
+	}
+
+	double startTime = currentTime();
+	{
+		Common::CharacterBuffer buffer(64*1024, flusher);
+		for ( size_t i = 0; i < valueCount; i += blockSize )
+		{
+			buffer.copyToBufferAsChar( &values[0], blockSize, ' ' );
+		}
+	}
+	delete flusher;
+	return currentTime() - startTime;
+}
+
+/** Returns the content of the file @a fileName.*/
+static std::string readFile( const char* fileName )
+{
+	std::ifstream file( fileName, std::ios::binary );
+	std::ostringstream content;
+	content << file.rdbuf();
+	return content.str();
+}
+
+void asyncFlusherPerformanceTest()
+{
+#ifdef WIN32
+	char fileNameFwrite[] = "c:\\temp\\testFwrite.txt";
+	char fileNameAsync[] = "c:\\temp\\testAsyncFwrite.txt";
+#else
+	char fileNameFwrite[] = "/tmp/testFwrite.txt";
+	char fileNameAsync[] = "/tmp/testAsyncFwrite.txt";
+#endif
+
+	std::string mLocale = setlocale(LC_NUMERIC, 0);
+	setlocale(LC_NUMERIC, "C");
+
+	const size_t valueCount = 30000000;
+	double fwriteTime = writeFloats( new Common::FWriteBufferFlusher(fileNameFwrite), valueCount );
+	double asyncTime = writeFloats( new Common::AsyncFWriteBufferFlusher(fileNameAsync), valueCount );
+
+	setlocale(LC_NUMERIC, mLocale.c_str());
+
+	std::cout << "fwrite flusher: time elapsed: " << fwriteTime << std::endl;
+	std::cout << "asynchronous fwrite flusher: time elapsed: " << asyncTime << std::endl;
+	std::cout << "files are " << (readFile( fileNameFwrite ) == readFile( fileNameAsync ) ? "equal" : "different") << std::endl;
+
+	remove( fileNameFwrite );
+	remove( fileNameAsync );
+}
+
+/** Returns the decompressed content of the gzip file @a fileName.*/
+static std::string readGZipFile( const char* fileName )
+{
+	std::string content;
+	gzFile file = gzopen( fileName, "rb" );
+	if ( !file )
+	{
+		return content;
+	}
+	char buffer[64*1024];
+	int bytesRead = 0;
+	while ( (bytesRead = gzread( file, buffer, sizeof(buffer) )) > 0 )
+	{
+		content.append( buffer, bytesRead );
+	}
+	gzclose( file );
+	return content;
+}
+
+void gzipFlusherPerformanceTest()
+{
+#ifdef WIN32
+	char fileNameFwrite[] = "c:\\temp\\testFwrite.txt";
+	char fileNameGZip[] = "c:\\temp\\testGZip.txt.gz";
+#else
+	char fileNameFwrite[] = "/tmp/testFwrite.txt";
+	char fileNameGZip[] = "/tmp/testGZip.txt.gz";
+#endif
+
+	std::string mLocale = setlocale(LC_NUMERIC, 0);
+	setlocale(LC_NUMERIC, "C");
+
+	const size_t valueCount = 30000000;
+	double fwriteTime = writeFloats( new Common::FWriteBufferFlusher(fileNameFwrite), valueCount );
+	std::string uncompressed = readFile( fileNameFwrite );
+	std::cout << "fwrite flusher: time elapsed: " << fwriteTime << " size: " << uncompressed.size() << std::endl;
+
+	size_t threadCount = std::thread::hardware_concurrency();
+	const int levels[] = { 1, 6 };
+	for ( size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); ++i )
+	{
+		for ( size_t threads = 0; threads <= threadCount; threads += (threadCount > 0 ? threadCount : 1) )
+		{
+			double gzipTime = writeFloats( new Common::GZipBufferFlusher(fileNameGZip, levels[i], threads), valueCount );
+			size_t compressedSize = readFile( fileNameGZip ).size();
+			std::cout << "gzip flusher, level " << levels[i] << ", " << threads << " threads: time elapsed: " << gzipTime 
+				<< " size: " << compressedSize 
+				<< " decompressed file is " << (readGZipFile( fileNameGZip ) == uncompressed ? "equal" : "different") << std::endl;
+		}
+	}
+
+	setlocale(LC_NUMERIC, mLocale.c_str());
+
+	remove( fileNameFwrite );
+	remove( fileNameGZip );
+}
@@ -25,6 +25,12 @@ namespace Common
 	least FTOA_BUFFERSIZE.*/
 	int ftoa(float f, char* buffer);
 
+	/** Writes the shortest string representation of @a f that is parsed back to exactly @a f, in the 
+	same notation as ftoa. Returns the number of bytes written in to the buffer.
+	@param buffer The buffer the string representation of the number will be written to. Its size must be at 
+	least FTOA_BUFFERSIZE.*/
+	int ftoaShortest(float f, char* buffer);
+
 }
 
 #endif // __COMMON_FTOA_H__
@@ -11,12 +11,15 @@
 #include "Commonftoa.h"
 #include "Commonitoa.h"
 #include <float.h>
+#include <string.h>
 
 #include <math.h>
 
 // no int32_t in MSVC
 #ifdef _MSC_VER
 typedef __int32 int32_t;
+typedef unsigned __int32 uint32_t;
+typedef unsigned __int64 uint64_t;
 #else
 #include <stdint.h>
 #endif
@@ -260,4 +263,315 @@ namespace Common
 	}
 
 
+	// Shortest representation, see Ulf Adams: "Ryu: fast float-to-string conversion", PLDI 2018.
+
+	static const int FLOAT_MANTISSA_BITS = 23;
+	static const int FLOAT_BIAS = 127;
+
+	static const int FLOAT_POW5_INV_BITCOUNT = 59;
+	static const int FLOAT_POW5_BITCOUNT = 61;
+
+	/** floor(2^(ceil(log2(5^i)) - 1 + FLOAT_POW5_INV_BITCOUNT) / 5^i) + 1*/
+	static const uint64_t FLOAT_POW5_INV_SPLIT[31] = {
+		0x0800000000000001ull, 0x0666666666666667ull, 0x051EB851EB851EB9ull,
+		0x04189374BC6A7EFAull, 0x068DB8BAC710CB2Aull, 0x053E2D6238DA3C22ull,
+		0x0431BDE82D7B634Eull, 0x06B5FCA6AF2BD216ull, 0x055E63B88C230E78ull,
+		0x044B82FA09B5A52Dull, 0x06DF37F675EF6EAEull, 0x057F5FF85E592558ull,
+		0x0465E6604B7A8447ull, 0x0709709A125DA071ull, 0x05A126E1A84AE6C1ull,
+		0x0480EBE7B9D58567ull, 0x0734ACA5F6226F0Bull, 0x05C3BD5191B525A3ull,
+		0x049C97747490EAE9ull, 0x0760F253EDB4AB0Eull, 0x05E72843249088D8ull,
+		0x04B8ED0283A6D3E0ull, 0x078E480405D7B966ull, 0x060B6CD004AC9452ull,
+		0x04D5F0A66A23A9DBull, 0x07BCB43D769F762Bull, 0x063090312BB2C4EFull,
+		0x04F3A68DBC8F03F3ull, 0x07EC3DAF94180651ull, 0x065697BFA9ACD1DAull,
+		0x051212FFBAF0A7E2ull,
+	};
+
+	/** 5^i, shifted to FLOAT_POW5_BITCOUNT significant bits*/
+	static const uint64_t FLOAT_POW5_SPLIT[47] = {
+		0x1000000000000000ull, 0x1400000000000000ull, 0x1900000000000000ull,
+		0x1F40000000000000ull, 0x1388000000000000ull, 0x186A000000000000ull,
+		0x1E84800000000000ull, 0x1312D00000000000ull, 0x17D7840000000000ull,
+		0x1DCD650000000000ull, 0x12A05F2000000000ull, 0x174876E800000000ull,
+		0x1D1A94A200000000ull, 0x12309CE540000000ull, 0x16BCC41E90000000ull,
+		0x1C6BF52634000000ull, 0x11C37937E0800000ull, 0x16345785D8A00000ull,
+		0x1BC16D674EC80000ull, 0x1158E460913D0000ull, 0x15AF1D78B58C4000ull,
+		0x1B1AE4D6E2EF5000ull, 0x10F0CF064DD59200ull, 0x152D02C7E14AF680ull,
+		0x1A784379D99DB420ull, 0x108B2A2C28029094ull, 0x14ADF4B7320334B9ull,
+		0x19D971E4FE8401E7ull, 0x1027E72F1F128130ull, 0x1431E0FAE6D7217Cull,
+		0x193E5939A08CE9DBull, 0x1F8DEF8808B02452ull, 0x13B8B5B5056E16B3ull,
+		0x18A6E32246C99C60ull, 0x1ED09BEAD87C0378ull, 0x13426172C74D822Bull,
+		0x1812F9CF7920E2B6ull, 0x1E17B84357691B64ull, 0x12CED32A16A1B11Eull,
+		0x178287F49C4A1D66ull, 0x1D6329F1C35CA4BFull, 0x125DFA371A19E6F7ull,
+		0x16F578C4E0A060B5ull, 0x1CB2D6F618C878E3ull, 0x11EFC659CF7D4B8Dull,
+		0x166BB7F0435C9E71ull, 0x1C06A5EC5433C60Dull,
+	};
+
+	/** Returns the number of bits of 5^e for e > 0, 1 for e = 0.*/
+	inline int32_t pow5bits(int32_t e)
+	{
+		return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+	}
+
+	/** Returns floor(log10(2^e)).*/
+	inline uint32_t log10Pow2(int32_t e)
+	{
+		return ((uint32_t)e * 78913) >> 18;
+	}
+
+	/** Returns floor(log10(5^e)).*/
+	inline uint32_t log10Pow5(int32_t e)
+	{
+		return ((uint32_t)e * 732923) >> 20;
+	}
+
+	inline bool multipleOfPowerOf5(uint32_t value, uint32_t p)
+	{
+		uint32_t count = 0;
+		while ( (value % 5) == 0 )
+		{
+			value /= 5;
+			++count;
+		}
+		return count >= p;
+	}
+
+	inline bool multipleOfPowerOf2(uint32_t value, uint32_t p)
+	{
+		return (value & ((1u << p) - 1)) == 0;
+	}
+
+	/** Returns (m * factor) >> shift, with shift > 32.*/
+	inline uint32_t mulShift(uint32_t m, uint64_t factor, int32_t shift)
+	{
+		uint64_t bits0 = (uint64_t)m * (uint32_t)factor;
+		uint64_t bits1 = (uint64_t)m * (uint32_t)(factor >> 32);
+		uint64_t sum = (bits0 >> 32) + bits1;
+		return (uint32_t)(sum >> (shift - 32));
+	}
+
+	/** Calculates the decimal mantissa with the fewest digits and its exponent, such that 
+	@a mantissa * 10^@a exponent is parsed back to the float with the passed ieee bits.*/
+	void shortestDecimal(uint32_t ieeeMantissa, uint32_t ieeeExponent, uint32_t& mantissa, int32_t& exponent)
+	{
+		int32_t e2;
+		uint32_t m2;
+		if ( ieeeExponent == 0 )
+		{
+			e2 = 1 - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+			m2 = ieeeMantissa;
+		}
+		else
+		{
+			e2 = (int32_t)ieeeExponent - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+			m2 = (1u << FLOAT_MANTISSA_BITS) | ieeeMantissa;
+		}
+		bool acceptBounds = (m2 & 1) == 0;
+
+		// the interval of the real numbers rounded to the float, scaled by four
+		uint32_t mv = 4 * m2;
+		uint32_t mp = 4 * m2 + 2;
+		uint32_t mmShift = (ieeeMantissa != 0 || ieeeExponent <= 1) ? 1 : 0;
+		uint32_t mm = 4 * m2 - 1 - mmShift;
+
+		// convert the interval to decimal
+		uint32_t vr, vp, vm;
+		int32_t e10;
+		bool vmIsTrailingZeros = false;
+		bool vrIsTrailingZeros = false;
+		uint32_t lastRemovedDigit = 0;
+		if ( e2 >= 0 )
+		{
+			uint32_t q = log10Pow2(e2);
+			e10 = (int32_t)q;
+			int32_t k = FLOAT_POW5_INV_BITCOUNT + pow5bits((int32_t)q) - 1;
+			int32_t i = -e2 + (int32_t)q + k;
+			vr = mulShift(mv, FLOAT_POW5_INV_SPLIT[q], i);
+			vp = mulShift(mp, FLOAT_POW5_INV_SPLIT[q], i);
+			vm = mulShift(mm, FLOAT_POW5_INV_SPLIT[q], i);
+			if ( q != 0 && (vp - 1) / 10 <= vm / 10 )
+			{
+				int32_t l = FLOAT_POW5_INV_BITCOUNT + pow5bits((int32_t)(q - 1)) - 1;
+				lastRemovedDigit = mulShift(mv, FLOAT_POW5_INV_SPLIT[q - 1], -e2 + (int32_t)q - 1 + l) % 10;
+			}
+			if ( q <= 9 )
+			{
+				// only one of mp, mv and mm can be a multiple of 5
+				if ( (mv % 5) == 0 )
+					vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+				else if ( acceptBounds )
+					vmIsTrailingZeros = multipleOfPowerOf5(mm, q);
+				else
+					vp -= multipleOfPowerOf5(mp, q) ? 1 : 0;
+			}
+		}
+		else
+		{
+			uint32_t q = log10Pow5(-e2);
+			e10 = (int32_t)q + e2;
+			int32_t i = -e2 - (int32_t)q;
+			int32_t k = pow5bits(i) - FLOAT_POW5_BITCOUNT;
+			int32_t j = (int32_t)q - k;
+			vr = mulShift(mv, FLOAT_POW5_SPLIT[i], j);
+			vp = mulShift(mp, FLOAT_POW5_SPLIT[i], j);
+			vm = mulShift(mm, FLOAT_POW5_SPLIT[i], j);
+			if ( q != 0 && (vp - 1) / 10 <= vm / 10 )
+			{
+				j = (int32_t)q - 1 - (pow5bits(i + 1) - FLOAT_POW5_BITCOUNT);
+				lastRemovedDigit = mulShift(mv, FLOAT_POW5_SPLIT[i + 1], j) % 10;
+			}
+			if ( q <= 1 )
+			{
+				// mv has at least two trailing zero bits
+				vrIsTrailingZeros = true;
+				if ( acceptBounds )
+					vmIsTrailingZeros = (mmShift == 1);
+				else
+					--vp;
+			}
+			else if ( q < 31 )
+			{
+				vrIsTrailingZeros = multipleOfPowerOf2(mv, q - 1);
+			}
+		}
+
+		// remove the digits, as long as the result stays within the interval
+		int32_t removed = 0;
+		if ( vmIsTrailingZeros || vrIsTrailingZeros )
+		{
+			while ( vp / 10 > vm / 10 )
+			{
+				vmIsTrailingZeros &= (vm % 10) == 0;
+				vrIsTrailingZeros &= lastRemovedDigit == 0;
+				lastRemovedDigit = vr % 10;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				++removed;
+			}
+			if ( vmIsTrailingZeros )
+			{
+				while ( (vm % 10) == 0 )
+				{
+					vrIsTrailingZeros &= lastRemovedDigit == 0;
+					lastRemovedDigit = vr % 10;
+					vr /= 10;
+					vp /= 10;
+					vm /= 10;
+					++removed;
+				}
+			}
+			// round to even, if the exact number is .....50..0
+			if ( vrIsTrailingZeros && lastRemovedDigit == 5 && (vr % 2) == 0 )
+				lastRemovedDigit = 4;
+			mantissa = vr + (((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5) ? 1 : 0);
+		}
+		else
+		{
+			while ( vp / 10 > vm / 10 )
+			{
+				lastRemovedDigit = vr % 10;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				++removed;
+			}
+			mantissa = vr + ((vr == vm || lastRemovedDigit >= 5) ? 1 : 0);
+		}
+		exponent = e10 + removed;
+	}
+
+	/** The two digit decimal representations of the numbers 0 to 99.*/
+	static const char DIGIT_PAIRS[] = 
+		"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+		"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+
+	/** Writes the decimal digits of @a value in front of @a end and returns the first digit.*/
+	inline char* writeDigits(uint32_t value, char* end)
+	{
+		while ( value >= 100 )
+		{
+			uint32_t pair = value % 100;
+			value /= 100;
+			end -= 2;
+			memcpy(end, DIGIT_PAIRS + 2 * pair, 2);
+		}
+		if ( value >= 10 )
+		{
+			end -= 2;
+			memcpy(end, DIGIT_PAIRS + 2 * value, 2);
+		}
+		else
+		{
+			*--end = (char)('0' + value);
+		}
+		return end;
+	}
+
+	int ftoaShortest(float f, char* buffer)
+	{
+		if ( f == 0.0 || isNaN(f) || isPositiveInfinity(f) || isNegativeInfinity(f) )
+			return ftoa(f, buffer);
+
+		LF_t x;
+		x.F = f;
+		uint32_t bits = (uint32_t)x.L;
+		uint32_t mantissa;
+		int32_t exponent;
+		shortestDecimal(bits & ((1u << FLOAT_MANTISSA_BITS) - 1), (bits >> FLOAT_MANTISSA_BITS) & 0xFF, mantissa, exponent);
+
+		char* p = buffer;
+		if ( x.L < 0 )
+			*p++ = '-';
+
+		char digits[10];
+		const char* firstDigit = writeDigits(mantissa, digits + 10);
+		int length = (int)(digits + 10 - firstDigit);
+		int pointPos = length + exponent;
+
+		// the same notation as ftoa: exponential representation outside [0.001, 999999]
+		float fAbs = fabs(f);
+		if ( fAbs < 0.001f || fAbs > 999999 )
+		{
+			*p++ = firstDigit[0];
+			if ( length > 1 )
+			{
+				*p++ = '.';
+				memcpy(p, firstDigit + 1, length - 1);
+				p += length - 1;
+			}
+			*p++ = 'e';
+			p += itoa( pointPos - 1, p, 10 );
+		}
+		else if ( pointPos <= 0 )
+		{
+			*p++ = '0';
+			*p++ = '.';
+			for ( int i = pointPos; i < 0; ++i )
+				*p++ = '0';
+			memcpy(p, firstDigit, length);
+			p += length;
+		}
+		else if ( pointPos >= length )
+		{
+			memcpy(p, firstDigit, length);
+			p += length;
+			for ( int i = length; i < pointPos; ++i )
+				*p++ = '0';
+		}
+		else
+		{
+			memcpy(p, firstDigit, pointPos);
+			p += pointPos;
+			*p++ = '.';
+			memcpy(p, firstDigit + pointPos, length - pointPos);
+			p += length - pointPos;
+		}
+
+		*p = 0;
+
+		return (int)(p - buffer);
+	}
+
+
 }
@@ -15,58 +15,70 @@
 #include "math.h"
 
 #include <iostream>
+#include <vector>
+#include <string>
+#include <stdlib.h>
+#include <locale.h>
+#include <time.h>
 
-#include <sys/types.h>
-#include <sys/timeb.h> 
 
-
-void performanceTest()
+/** Converts all @a values with @a convert and prints the time elapsed, the number of bytes written and the 
+number of values that are parsed back to the same float.*/
+static void measure( const char* name, int (*convert)(float, char*), const std::vector<float>& values, size_t repetitions )
 {
-
-	std::string mLocale = setlocale(LC_NUMERIC, 0);
-	setlocale(LC_NUMERIC, "C");
-
-	char testString[] = "01234";
-
-	float testFloat = 0;
-	double testDouble = 1.23456;
-
-#pragma warning(disable: 4996)
-	_timeb startTimeBuffer;
-	_ftime( &startTimeBuffer );
-	double startTime = (double)startTimeBuffer.time + (double)startTimeBuffer.millitm / 1000;
-
-
 	char ftoaBuffer[Common::FTOA_BUFFERSIZE];
-	static float sum = 0 ;
-	static int sumi = 0;
+	size_t bytes = 0;
 
-	for ( size_t i= 0; i < 10000000 ; ++i)
+	clock_t startTime = clock();
+	for ( size_t r = 0; r < repetitions; ++r )
 	{
+		for ( size_t i = 0; i < values.size(); ++i )
+		{
+			bytes += convert( values[i], ftoaBuffer );
+		}
+	}
+	double timeElapsed = (double)(clock() - startTime) / CLOCKS_PER_SEC;
 
+	size_t roundTrips = 0;
+	for ( size_t i = 0; i < values.size(); ++i )
+	{
+		convert( values[i], ftoaBuffer );
+		if ( (float)strtod( ftoaBuffer, 0 ) == values[i] )
+			++roundTrips;
+	}
 
-		int bytesWritten;
-
-//		bytesWritten=sprintf(ftoaBuffer, "%g", testFloat);
-
-//		bytesWritten=sprintf(ftoaBuffer, "%.16f", testDouble);
+	std::cout << name << ": time elapsed: " << timeElapsed 
+		<< " bytes per value: " << (double)bytes / (values.size() * repetitions)
+		<< " parsed back exactly: " << roundTrips << " of " << values.size() << std::endl;
+}
 
-//		bytesWritten = Common::ftoa(testFloat, ftoaBuffer);
+static int dtoaSinglePrecision( float f, char* buffer )
+{
+	return Common::dtoa( f, buffer );
+}
 
-		bytesWritten = Common::dtoa(testDouble, ftoaBuffer);
+void performanceTest()
+{
 
-		sumi += bytesWritten;
+	std::string mLocale = setlocale(LC_NUMERIC, 0);
+	setlocale(LC_NUMERIC, "C");
 
+	// vertex positions and normals, as they are exported from a mesh
+	const size_t valueCount = 1000000;
+	std::vector<float> values( valueCount );
+	srand( 1 );
+	for ( size_t i = 0; i < valueCount; i += 2 )
+	{
+		float position = ((float)rand() / RAND_MAX - 0.5f) * 200.0f;
+		values[i] = position;
+		values[i+1] = (float)sin( position );
 	}
 
+	const size_t repetitions = 10;
+	measure( "ftoa", Common::ftoa, values, repetitions );
+	measure( "ftoaShortest", Common::ftoaShortest, values, repetitions );
+	measure( "dtoa", dtoaSinglePrecision, values, repetitions );
 
 	setlocale(LC_NUMERIC, mLocale.c_str());
-	_timeb endTimeBuffer;
-	_ftime(&endTimeBuffer);
-#pragma warning(default: 4996)
-
-	double endTime = (double)endTimeBuffer.time + (double)endTimeBuffer.millitm / 1000;
-
-	std::cout << std::endl << "time elapsed: " << endTime - startTime << std::endl;
 
-};
\ No newline at end of file
+}
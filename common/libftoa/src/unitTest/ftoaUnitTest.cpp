@@ -38,6 +38,23 @@ static bool testFloat(float f, char* expectedString)
 	}
 }
 
+static bool testFloatShortest(float f, char* expectedString)
+{
+	int bytesWritten = Common::ftoaShortest(f, ftoaBuffer);
+
+	if ( strcmp( ftoaBuffer, expectedString) == 0 && (int)strlen( ftoaBuffer ) == bytesWritten )
+	{
+		std::cout << "match shortest        " << f << ":           " << ftoaBuffer << std::endl;
+		return true;
+	}
+	else
+	{
+		std::cout << "      don't match     " << f << ":           " << ftoaBuffer << " and " <<  expectedString << std::endl;
+		errroCount++;
+		return false;
+	}
+}
+
 bool ftoaUnitTest()
 {
 	std::cout << "ftoaUnitTest()" << std::endl;
@@ -108,5 +125,30 @@ bool ftoaUnitTest()
 	std::cout << std::endl;
 	std::cout << std::endl;
 
+	testFloatShortest(std::numeric_limits<float>::infinity(),"INF");
+	testFloatShortest(std::numeric_limits<float>::quiet_NaN(),"NaN");
+	testFloatShortest(0,                   "0");
+	testFloatShortest(1,                   "1");
+	testFloatShortest(-1.5f,               "-1.5");
+	testFloatShortest(0.001f,              "0.001");
+	testFloatShortest(0.01f,               "0.01");
+	testFloatShortest(0.3f,                "0.3");
+	testFloatShortest(0.0025f,             "0.0025");
+	testFloatShortest(1.00001f,            "1.00001");
+	testFloatShortest(123456,              "123456");
+	testFloatShortest(123456.789f,         "123456.79");
+	testFloatShortest(999999,              "999999");
+	testFloatShortest(1000000,             "1e6");
+	testFloatShortest(1234567,             "1.234567e6");
+	testFloatShortest(16777216,            "1.6777216e7");
+	testFloatShortest(0.0001f,             "1e-4");
+	testFloatShortest(-0.000098f,          "-9.8e-5");
+	testFloatShortest(1e-45f,              "1e-45");
+	testFloatShortest(std::numeric_limits<float>::min(), "1.1754944e-38");
+	testFloatShortest(std::numeric_limits<float>::max(), "3.4028235e38");
+
+	std::cout << std::endl;
+	std::cout << std::endl;
+
 	return errroCount == 0;
 }
\ No newline at end of file
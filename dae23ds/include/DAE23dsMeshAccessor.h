@@ -75,6 +75,9 @@ namespace DAE23ds
 
 		TriangleType getNextTriangle() const;
 
+		/** Returns the number of triangles of @a meshPrimitive.*/
+		static size_t calculateMeshPrimitiveTriangleCount(const COLLADAFW::MeshPrimitive* meshPrimitive);
+
 	private:
 
         /** Disable default copy ctor. */
@@ -84,8 +87,6 @@ namespace DAE23ds
 		const MeshAccessor& operator= ( const MeshAccessor& pre );
 
 		size_t calculateTrianglesCount() const;
-
-		size_t calculateMeshPrimitiveTriangleCount(const COLLADAFW::MeshPrimitive* meshPrimitive) const;
 	};
 
 } // namespace DAE23ds
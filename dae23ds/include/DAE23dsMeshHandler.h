@@ -22,6 +22,9 @@ namespace DAE23ds
 	{
 	private:
 		const COLLADAFW::Mesh* mMesh;
+
+		/** Number of triangles of the mesh primitives handled so far.*/
+		size_t mTrianglesCount;
 	
 	public:
 
@@ -33,6 +36,13 @@ namespace DAE23ds
 
 		bool handle(); 
 
+		/** Adds the triangles of @a meshPrimitive, a mesh primitive or a block of a streamed mesh
+		primitive, to the triangle count of the mesh.*/
+		bool handleMeshPrimitive( const COLLADAFW::MeshPrimitive* meshPrimitive );
+
+		/** Adds the mesh data of the mesh, once all its mesh primitives have been handled.*/
+		bool finish();
+
 	private:
 
         /** Disable default copy ctor. */
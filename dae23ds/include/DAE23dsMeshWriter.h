@@ -16,6 +16,10 @@
 
 #include "DAE23dsChunkIDs.h"
 
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+
 namespace Common
 {
 	class Buffer;
@@ -27,6 +31,43 @@ namespace DAE23ds
 
 	class MeshWriter : public MeshBase
 	{
+	private:
+		/** An object, i.e. an EDIT_OBJECT chunk, created for an instance of the mesh. The objects are 
+		collected, and their object ids and chunk lengths calculated, before any of them is written. 
+		Therefore they can be written in any order and by multiple threads.*/
+		struct ObjectData
+		{
+			/** The instance the object is created for.*/
+			Writer::InstanceGeometryInfo instanceGeometryInfo;
+
+			/** The id used to create the name of the object.*/
+			Writer::ObjectId objectId;
+
+			/** True, if the object contains the entire mesh, false if it contains the triangles 
+			described by blockData.*/
+			bool entireMesh;
+
+			/** The triangles of the object, if it does not contain the entire mesh.*/
+			ObjectBlockData blockData;
+
+			/** The chunk lengths of the object.*/
+			WriteMeshIntoOneObject lengths;
+
+			/** The serialized EDIT_OBJECT chunk, if written by a thread.*/
+			std::vector<char> chunk;
+
+			/** True, if the object has been written into chunk.*/
+			bool written;
+
+			ObjectData( const Writer::InstanceGeometryInfo& _instanceGeometryInfo )
+				: instanceGeometryInfo(_instanceGeometryInfo)
+				, objectId(0)
+				, entireMesh(true)
+				, written(false) {}
+		};
+
+		typedef std::vector<ObjectData> ObjectDataList;
+
 	private:
 
 		const COLLADAFW::Mesh* mMesh;
@@ -43,6 +84,27 @@ namespace DAE23ds
 		const COLLADAFW::MeshVertexData& mMeshUVCoordinates;
 		const COLLADAFW::MeshVertexData& mMeshColors;
 
+		/** The objects to write, in the order they appear in the file.*/
+		ObjectDataList mObjects;
+
+		/** Index of the next object in mObjects to be written by a thread.*/
+		size_t mNextObjectIndex;
+
+		/** Number of objects in mObjects that have been appended to mBuffer.*/
+		size_t mAppendedObjectsCount;
+
+		/** Maximum number of objects that are written by threads, but not yet appended to mBuffer.*/
+		size_t mMaxPendingObjectsCount;
+
+		/** Guards mNextObjectIndex, mAppendedObjectsCount and the written flags of the objects.*/
+		std::mutex mMutex;
+
+		/** Notified, when a thread has written an object.*/
+		std::condition_variable mObjectWritten;
+
+		/** Notified, when an object has been appended to mBuffer.*/
+		std::condition_variable mObjectAppended;
+
 
 	public:
 
@@ -52,39 +114,49 @@ namespace DAE23ds
         /** Destructor. */
 		virtual ~MeshWriter();
 
-		/** Writes the mesh using @a materialBindings to assign materials.*/
+		/** Collects the object for the mesh using @a materialBindings to assign materials.*/
 		bool writeMeshIntoOneObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoOneObject& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
 
-		/** Writes the mesh using @a materialBindings to assign materials.*/
+		/** Collects the objects the mesh is split into using @a materialBindings to assign materials.*/
 		bool writeMeshIntoMultipleObjects( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const WriteMeshIntoMultipleObjectsData& data, const COLLADAFW::InstanceGeometry* alreadyUsingInstance);
 
 		/** Writes the mesh using @a materialBindings to assign materials.*/
 		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo);
 
-		/** Writes the mesh using @a materialBindings to assign materials and data provided in @a blockData.*/
+		/** Collects the object for the triangles of the mesh provided in @a blockData.*/
 		bool writeMeshIntoObject( const Writer::InstanceGeometryInfo& instanceGeometryInfo, const ObjectBlockData& blockData);
 
+		/** Writes all objects collected by handle() into the buffer of the writer. If @a threadCount is at least 
+		two, the objects are transformed and serialized by @a threadCount threads, each object into a chunk 
+		buffer of its own. The chunks are appended in the order of the objects, as soon as they are complete.*/
+		bool writeObjects( size_t threadCount );
+
+		/** Writes the EDIT_OBJECT chunk of @a object into @a buffer. @a meshAccessor and @a materialIds are 
+		used to write the triangles of objects that do not contain the entire mesh.*/
+		bool writeObject( const ObjectData& object, Common::Buffer& buffer, MeshAccessor& meshAccessor, COLLADAFW::MaterialId* materialIds );
+
 		/** Writes the vertices/position as floats into @a buffer.*/
-		bool writeVertices(const COLLADABU::Math::Matrix4& worldMatrix);
+		bool writeVertices(Common::Buffer& buffer, const COLLADABU::Math::Matrix4& worldMatrix);
 
-		/** Writes the positions for @a trianglesCount triangles, starting at @a firstTriangleIndex.*/
-		bool writeVerticesForMultipleObjects(size_t firstTriangleIndex, CountType trianglesCount, const COLLADABU::Math::Matrix4& worldMatrix);
+		/** Writes the positions for @a trianglesCount triangles, starting at @a firstTriangleIndex, into @a buffer 
+		and their material ids into @a materialIds.*/
+		bool writeVerticesForMultipleObjects(Common::Buffer& buffer, MeshAccessor& meshAccessor, COLLADAFW::MaterialId* materialIds, size_t firstTriangleIndex, CountType trianglesCount, const COLLADABU::Math::Matrix4& worldMatrix);
 
 		/** Writes all the triangles/fans/strips into @a buffer.*/
-		bool writeTriangles();
+		bool writeTriangles(Common::Buffer& buffer);
 
 
 		/** Writes the numbers 0...@a trianglesCount into @a buffer.*/
-		bool writeTrianglesForMultipleObjects(CountType trianglesCount);
+		bool writeTrianglesForMultipleObjects(Common::Buffer& buffer, CountType trianglesCount);
 
 		/** writes the faces materials.*/
-		bool writeFaceMaterials(const COLLADAFW::MaterialBindingArray& materialBindings);
+		bool writeFaceMaterials(Common::Buffer& buffer, const COLLADAFW::MaterialBindingArray& materialBindings);
 
 		/** */
-		bool writeFaceMaterialsForMultipleObjects(const COLLADAFW::MaterialBindingArray& materialBindings, const ObjectBlockData& blockData);
+		bool writeFaceMaterialsForMultipleObjects(Common::Buffer& buffer, const COLLADAFW::MaterialId* materialIds, const COLLADAFW::MaterialBindingArray& materialBindings, const ObjectBlockData& blockData);
 
 		/** Writes the mesh matrix of the tri object.*/
-		bool writeMeshMatrix(const COLLADABU::Math::Matrix4& worldMatrix);
+		bool writeMeshMatrix(Common::Buffer& buffer, const COLLADABU::Math::Matrix4& worldMatrix);
 
 		/** Calculates the number of triangles in the @a  meshPrimitiveIndex'th meshPrimitive.*/
 		IndexType calculateMeshPrimitivesTriangleCount(size_t meshPrimitiveIndex);
@@ -98,12 +170,15 @@ namespace DAE23ds
 		const MeshWriter& operator= ( const MeshWriter& pre );
 
 		bool splitMeshInChunks();
+
+		/** Executed by the threads. Writes objects into their chunks, until all objects have been written.*/
+		void writeObjectChunks();
 		
 		template<class T> 
-		void transformAndWriteVertex( const T& vertex, float wm[3][4], size_t index);
+		void transformAndWriteVertex( Common::Buffer& buffer, const T& vertex, float wm[3][4], size_t index);
 		
 		template<class T> 
-		void transformAndWriteVertex( const T& vertex, const COLLADABU::Math::Matrix4& worldMatrix, size_t index);
+		void transformAndWriteVertex( Common::Buffer& buffer, const T& vertex, const COLLADABU::Math::Matrix4& worldMatrix, size_t index);
 	};
 
 } // namespace DAE23ds
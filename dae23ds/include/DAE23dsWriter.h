@@ -14,7 +14,7 @@
 #include "DAE23dsPrerequisites.h"
 #include "DAE23dsChunkIDs.h"
 
-#include "COLLADAFWIWriter.h"
+#include "COLLADAFWIStreamingWriter.h"
 #include "COLLADAFWUniqueId.h"
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWLibraryNodes.h"
@@ -38,6 +38,8 @@ namespace Common
 
 namespace DAE23ds
 {
+	class MeshHandler;
+
 
 	typedef unsigned int ChunkLength;
 	typedef unsigned short CountType;
@@ -104,7 +106,7 @@ namespace DAE23ds
 
 
 
-	class Writer : public COLLADAFW::IWriter
+	class Writer : public COLLADAFW::IStreamingWriter
 	{
 	public:
 		enum Runs
@@ -258,6 +260,13 @@ namespace DAE23ds
 		/** The Material number of the next material that will be exported.*/
 		MaterialNumber mNextMaterialNumber;
 
+		/** The handler of the mesh that is currently streamed, 0 if no mesh is streamed.*/
+		MeshHandler* mStreamedMeshHandler;
+
+		/** Number of threads that transform and serialize the objects of a mesh in parallel. If less than
+		two, all objects are written sequentially.*/
+		size_t mMeshWritingThreadCount;
+
 	public:
 		Writer( const COLLADABU::URI& inputFile, const COLLADABU::URI& outputFile, bool applyTransformationsToMeshes );
 		virtual ~Writer();
@@ -269,6 +278,16 @@ namespace DAE23ds
 
 		bool write();
 
+		/** Sets the number of threads that transform, split and serialize the objects created for the 
+		instances of a mesh. Each object is written into a chunk buffer of its own, the chunks are appended 
+		to the output in the same order as in sequential writing, such that the written file does not depend 
+		on the number of threads. Values less than two disable parallel writing, which is the default.
+		@param threadCount The number of threads.*/
+		void setMeshWritingThreadCount( size_t threadCount ) { mMeshWritingThreadCount = threadCount; }
+
+		/** Returns the number of threads used to write the objects of a mesh.*/
+		size_t getMeshWritingThreadCount() const { return mMeshWritingThreadCount; }
+
 		/** Deletes the entire scene.
 		@param errorMessage A message containing informations about the error that occurred.
 		*/
@@ -344,6 +363,19 @@ namespace DAE23ds
 		/** When this method is called, the writer must write the kinematics scene. 
 		@return The writer should return true, if writing succeeded, false otherwise.*/
 		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ){ return true;}
+
+		/** Starts to handle a mesh in blocks. Only the scene graph run, that counts the triangles of the
+		meshes, is streamed. The geometry run needs random access to all triangles of a mesh.
+		@return True, if the mesh should be streamed, false otherwise.*/
+		virtual bool startMesh( const COLLADAFW::Mesh* mesh );
+
+		/** Handles the next block of a mesh primitive of the streamed mesh.
+		@return True on succeeded, false otherwise.*/
+		virtual bool writeMeshPrimitive( const COLLADAFW::Mesh* mesh, const COLLADAFW::MeshPrimitive* meshPrimitive );
+
+		/** Finishes handling the streamed mesh.
+		@return True on succeeded, false otherwise.*/
+		virtual bool finishMesh( const COLLADAFW::Mesh* mesh );
 	public:
 		/** Compares two GeometryMaterialBinding if the geometries look the same, i.e. mesh and material binding are equal.*/
 		static bool compare(const GeometryMaterialBinding& lhs, const GeometryMaterialBinding& rhs);
@@ -353,12 +385,20 @@ namespace DAE23ds
 		*/
 		static const char* calculateObjectNameFromObjectId( const ObjectId& objectId);
 
+		/** Writes the string representation of ObjectId @a objectId into @a buffer, that must be able to hold 
+		getObjectNameLength() plus one characters, for a terminating zero. Can be used in threads.*/
+		static void calculateObjectNameFromObjectId( const ObjectId& objectId, char* buffer);
+
 		/** Returns the string representation of MaterialNumber @a materialNumber. This representation is used as 
 		the name of the material.
 		Do not use in threads!!!!
 		*/
 		static const char* calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber);
 
+		/** Writes the string representation of MaterialNumber @a materialNumber into @a buffer, that must be 
+		able to hold getMaterialNameLength() plus one characters, for a terminating zero. Can be used in threads.*/
+		static void calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber, char* buffer);
+
 		/** Returns the length of an object name including null termination. This length is equal for all objects.*/
 		static ChunkLength getObjectNameLength();
 
@@ -452,6 +492,9 @@ namespace DAE23ds
 
 		template<class NumberType, char prefix>
 		static const char* calculateNameFromNumber( const NumberType& number);
+
+		template<class NumberType, char prefix>
+		static void calculateNameFromNumber( const NumberType& number, char* buffer);
 	};
 
 } // namespace DAE23ds
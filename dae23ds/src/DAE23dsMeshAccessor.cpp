@@ -52,7 +52,7 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	size_t MeshAccessor::calculateMeshPrimitiveTriangleCount(const COLLADAFW::MeshPrimitive* meshPrimitive) const
+	size_t MeshAccessor::calculateMeshPrimitiveTriangleCount(const COLLADAFW::MeshPrimitive* meshPrimitive)
 	{
 		size_t trianglesCount = 0;
 
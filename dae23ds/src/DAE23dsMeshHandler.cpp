@@ -19,6 +19,7 @@ namespace DAE23ds
 	MeshHandler::MeshHandler( Writer* writer3ds, const COLLADAFW::Mesh* mesh )
 		: BaseWriter(writer3ds)
 		, mMesh(mesh)
+		, mTrianglesCount(0)
 	{
 	}
 	
@@ -31,9 +32,23 @@ namespace DAE23ds
 	bool MeshHandler::handle()
 	{
 		MeshAccessor meshAccessor( mMesh );
+		mTrianglesCount = meshAccessor.getTrianglesCount();
+		return finish();
+	}
+
+	//------------------------------
+	bool MeshHandler::handleMeshPrimitive( const COLLADAFW::MeshPrimitive* meshPrimitive )
+	{
+		mTrianglesCount += MeshAccessor::calculateMeshPrimitiveTriangleCount( meshPrimitive );
+		return true;
+	}
+
+	//------------------------------
+	bool MeshHandler::finish()
+	{
 		Writer::MeshData meshData;
 		meshData.meshUniqueId = mMesh->getUniqueId();
-		meshData.trianglesCount = meshAccessor.getTrianglesCount();
+		meshData.trianglesCount = mTrianglesCount;
 		meshData.positionsCount = mMesh->getPositions().getValuesCount();
 		meshData.name = mMesh->getName();
 		addMeshData( meshData );
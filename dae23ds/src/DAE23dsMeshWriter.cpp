@@ -17,6 +17,8 @@
 #include "DAE23dsMeshSpliter.h"
 #include "DAE23dsMeshSpliterDumper.h"
 
+#include <thread>
+
 namespace DAE23ds
 {
 
@@ -24,6 +26,45 @@ namespace DAE23ds
 
 	bool multiplyMeshes = true;
 
+	/** The size of the buffer used to write an object into its chunk.*/
+	static const size_t CHUNK_BUFFER_SIZE = 64*1024;
+
+	/** Number of objects each thread may write ahead of the object that is appended next.*/
+	static const size_t PENDING_OBJECTS_PER_THREAD = 2;
+
+	/** Collects the received data in a chunk, that is appended to the output later on.*/
+	class ChunkBufferFlusher : public Common::IBufferFlusher
+	{
+	private:
+		std::vector<char>& mChunk;
+
+	public:
+		ChunkBufferFlusher( std::vector<char>& chunk ) : mChunk(chunk) {}
+
+		virtual bool receiveData( const char* buffer, size_t length)
+		{
+			mChunk.insert( mChunk.end(), buffer, buffer + length );
+			return true;
+		}
+
+		virtual bool flush() { return true; }
+
+		virtual void startMark() {}
+
+		virtual MarkId endMark() { return INVALID_ID; }
+
+		virtual bool jumpToMark(MarkId markId, bool keepMarkId = false) { return markId == END_OF_STREAM; }
+
+		virtual int getError() const { return 0; }
+
+	private:
+        /** Disable default copy ctor. */
+		ChunkBufferFlusher( const ChunkBufferFlusher& pre );
+        /** Disable default assignment operator. */
+		const ChunkBufferFlusher& operator= ( const ChunkBufferFlusher& pre );
+	};
+
+
 	//------------------------------
 	MeshWriter::MeshWriter( Writer* writer3ds, const COLLADAFW::Mesh* mesh )
 		: MeshBase(writer3ds)
@@ -34,6 +75,9 @@ namespace DAE23ds
 		, mMeshNormals( mesh->getNormals() )
 		, mMeshUVCoordinates( mesh->getUVCoords() )
 		, mMeshColors( mesh->getColors() )
+		, mNextObjectIndex(0)
+		, mAppendedObjectsCount(0)
+		, mMaxPendingObjectsCount(0)
 	{
 		Writer::MeshData meshData;
 		meshData.meshUniqueId = mesh->getUniqueId();
@@ -108,34 +152,19 @@ namespace DAE23ds
 
 		ChunkLength editObjectLength = calculateObjectLength(triangularMeshLength);
 
-		// object chunk
-		mBuffer.copyToBuffer(EDIT_OBJECT);
-		mBuffer.copyToBuffer(editObjectLength);
-
-		Writer::ObjectId objectId = getAndIncreaseNextObjectId();
-		const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
-		mBuffer.copyToBuffer(meshName3ds, Writer::getObjectNameLength());
-		addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
-
-		// triangular mesh
-		mBuffer.copyToBuffer(OBJ_TRIMESH);
-		mBuffer.copyToBuffer(triangularMeshLength);
-
-		// vertices list mesh
-		mBuffer.copyToBuffer(TRI_VERTEXL);
-		mBuffer.copyToBuffer(verticesLength);
-		mBuffer.copyToBuffer((CountType)(blockData.trianglesCount*3));
-		writeVerticesForMultipleObjects(blockData.firstTriangleIndex, blockData.trianglesCount,instanceGeometryInfo.worldMatrix);
+		ObjectData object( instanceGeometryInfo );
+		object.entireMesh = false;
+		object.blockData = blockData;
+		object.lengths.editObjectLength = editObjectLength;
+		object.lengths.triangularMeshLength = triangularMeshLength;
+		object.lengths.verticesLength = verticesLength;
+		object.lengths.facesDescriptionLength = facesDescriptionLength;
+		object.lengths.trianglesCount = blockData.trianglesCount;
 
-		// faces description
-		mBuffer.copyToBuffer(TRI_FACEL1);
-		mBuffer.copyToBuffer(facesDescriptionLength);
-		mBuffer.copyToBuffer((CountType)(blockData.trianglesCount));
-		writeTrianglesForMultipleObjects(blockData.trianglesCount);
-
-		writeFaceMaterialsForMultipleObjects(materialBindings, blockData);
+		object.objectId = getAndIncreaseNextObjectId();
+		addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), object.objectId);
 
-		writeMeshMatrix(instanceGeometryInfo.worldMatrix);
+		mObjects.push_back( object );
 		return true;
 	}
 
@@ -157,45 +186,178 @@ namespace DAE23ds
 		}
 		else
 		{
-			const COLLADAFW::MaterialBindingArray& materialBindings = instanceGeometry->getMaterialBindings();
-
 //			writeMaterialBlocks(materialBindings);
 
-			// object chunk
-			mBuffer.copyToBuffer(EDIT_OBJECT);
-			mBuffer.copyToBuffer(data.editObjectLength);
-
-			Writer::ObjectId objectId = getAndIncreaseNextObjectId();
-			const char* meshName3ds = Writer::calculateObjectNameFromObjectId( objectId );
-			mBuffer.copyToBuffer(meshName3ds, Writer::getObjectNameLength());
-			addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), objectId);
-
-			// triangular mesh
-			mBuffer.copyToBuffer(OBJ_TRIMESH);
-			mBuffer.copyToBuffer(data.triangularMeshLength);
-
-			// vertices list mesh
-			mBuffer.copyToBuffer(TRI_VERTEXL);
-			mBuffer.copyToBuffer(data.verticesLength);
-			mBuffer.copyToBuffer((CountType)(mMeshPositions.getValuesCount()/3));
-			writeVertices(instanceGeometryInfo.worldMatrix);
-
-			// faces description
-			mBuffer.copyToBuffer(TRI_FACEL1);
-			mBuffer.copyToBuffer(data.facesDescriptionLength);
-			mBuffer.copyToBuffer(data.trianglesCount);
-			writeTriangles();
-
-			writeFaceMaterials(materialBindings);
-			writeMeshMatrix(instanceGeometryInfo.worldMatrix);
+			ObjectData object( instanceGeometryInfo );
+			object.entireMesh = true;
+			object.lengths = data;
+
+			object.objectId = getAndIncreaseNextObjectId();
+			addInstanceGeometryObjectId(Writer::InstanceGeometryIdentifier(instanceGeometryInfo.fwInstanceGeometry, instanceGeometryInfo.instanceNumber), object.objectId);
+
+			mObjects.push_back( object );
+		}
+
+		return true;
+	}
+
+	//------------------------------
+	bool MeshWriter::writeObjects( size_t threadCount )
+	{
+		size_t objectsCount = mObjects.size();
+		if ( threadCount < 2 || objectsCount < 2 )
+		{
+			// write directly into the buffer of the writer
+			bool success = true;
+			for ( size_t i = 0; i < objectsCount; ++i )
+			{
+				success &= writeObject( mObjects[i], mBuffer, mMeshAccessor, mMaterialIds );
+			}
+			mObjects.clear();
+			return success;
+		}
+
+		threadCount = min( threadCount, objectsCount );
+		mNextObjectIndex = 0;
+		mAppendedObjectsCount = 0;
+		mMaxPendingObjectsCount = PENDING_OBJECTS_PER_THREAD * threadCount;
+
+		std::vector<std::thread> threads;
+		threads.reserve( threadCount );
+		for ( size_t i = 0; i < threadCount; ++i )
+		{
+			threads.push_back( std::thread( &MeshWriter::writeObjectChunks, this ) );
+		}
+
+		// append the chunks in the order of the objects, such that the file does not depend on the threads
+		bool success = true;
+		for ( size_t i = 0; i < objectsCount; ++i )
+		{
+			ObjectData& object = mObjects[i];
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				while ( !object.written )
+				{
+					mObjectWritten.wait(lock);
+				}
+			}
+
+			// the chunk lengths have been calculated in advance, the chunk must match them
+			assert( object.chunk.size() == object.lengths.editObjectLength );
+			if ( !object.chunk.empty() )
+			{
+				success &= mBuffer.copyToBuffer( &object.chunk[0], object.chunk.size() );
+			}
+			std::vector<char>().swap( object.chunk );
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mAppendedObjectsCount = i + 1;
+			}
+			mObjectAppended.notify_all();
+		}
+
+		for ( size_t i = 0; i < threads.size(); ++i )
+		{
+			threads[i].join();
+		}
+		mObjects.clear();
+		return success;
+	}
+
+	//------------------------------
+	void MeshWriter::writeObjectChunks()
+	{
+		// each thread iterates the triangles of the mesh on its own
+		MeshAccessor meshAccessor( mMesh );
+		std::vector<COLLADAFW::MaterialId> materialIds( MAX_TRIANGLES_PER_BLOCK );
+
+		std::unique_lock<std::mutex> lock(mMutex);
+		for ( ;; )
+		{
+			// do not write too far ahead of the object appended next, to limit the memory held by the chunks
+			while ( mNextObjectIndex < mObjects.size() && mNextObjectIndex >= mAppendedObjectsCount + mMaxPendingObjectsCount )
+			{
+				mObjectAppended.wait(lock);
+			}
+			if ( mNextObjectIndex >= mObjects.size() )
+			{
+				break;
+			}
+
+			ObjectData& object = mObjects[mNextObjectIndex++];
+			lock.unlock();
+
+			object.chunk.reserve( object.lengths.editObjectLength );
+			{
+				ChunkBufferFlusher flusher( object.chunk );
+				Common::Buffer buffer( CHUNK_BUFFER_SIZE, &flusher );
+				writeObject( object, buffer, meshAccessor, &materialIds[0] );
+				buffer.flushBuffer();
+			}
+
+			lock.lock();
+			object.written = true;
+			mObjectWritten.notify_all();
+		}
+	}
+
+	//------------------------------
+	bool MeshWriter::writeObject( const ObjectData& object, Common::Buffer& buffer, MeshAccessor& meshAccessor, COLLADAFW::MaterialId* materialIds )
+	{
+		const Writer::InstanceGeometryInfo& instanceGeometryInfo = object.instanceGeometryInfo;
+		const COLLADAFW::MaterialBindingArray& materialBindings = instanceGeometryInfo.fwInstanceGeometry->getMaterialBindings();
+		const WriteMeshIntoOneObject& data = object.lengths;
+
+		// object chunk
+		buffer.copyToBuffer(EDIT_OBJECT);
+		buffer.copyToBuffer(data.editObjectLength);
+
+		char meshName3ds[OBJECT_NAME_LENGTH + 1];
+		Writer::calculateObjectNameFromObjectId( object.objectId, meshName3ds );
+		buffer.copyToBuffer(meshName3ds, Writer::getObjectNameLength());
+
+		// triangular mesh
+		buffer.copyToBuffer(OBJ_TRIMESH);
+		buffer.copyToBuffer(data.triangularMeshLength);
+
+		// vertices list mesh
+		buffer.copyToBuffer(TRI_VERTEXL);
+		buffer.copyToBuffer(data.verticesLength);
+		if ( object.entireMesh )
+		{
+			buffer.copyToBuffer((CountType)(mMeshPositions.getValuesCount()/3));
+			writeVertices(buffer, instanceGeometryInfo.worldMatrix);
+		}
+		else
+		{
+			const ObjectBlockData& blockData = object.blockData;
+			buffer.copyToBuffer((CountType)(blockData.trianglesCount*3));
+			writeVerticesForMultipleObjects(buffer, meshAccessor, materialIds, blockData.firstTriangleIndex, blockData.trianglesCount,instanceGeometryInfo.worldMatrix);
+		}
+
+		// faces description
+		buffer.copyToBuffer(TRI_FACEL1);
+		buffer.copyToBuffer(data.facesDescriptionLength);
+		buffer.copyToBuffer(data.trianglesCount);
+		if ( object.entireMesh )
+		{
+			writeTriangles(buffer);
+			writeFaceMaterials(buffer, materialBindings);
+		}
+		else
+		{
+			writeTrianglesForMultipleObjects(buffer, data.trianglesCount);
+			writeFaceMaterialsForMultipleObjects(buffer, materialIds, materialBindings, object.blockData);
 		}
 
+		writeMeshMatrix(buffer, instanceGeometryInfo.worldMatrix);
 		return true;
 	}
 
 	//------------------------------
 	template<class T>
-	void MeshWriter::transformAndWriteVertex( const T& vertex, float wm[3][4], size_t index)
+	void MeshWriter::transformAndWriteVertex( Common::Buffer& buffer, const T& vertex, float wm[3][4], size_t index)
 	{
 		float x = vertex[index];
 		float y = vertex[index + 1];
@@ -204,15 +366,15 @@ namespace DAE23ds
 		float ty = wm[1][0] * x + wm[1][1] * y + wm[1][2] * z + wm[1][3];
 		float tz = wm[2][0] * x + wm[2][1] * y + wm[2][2] * z + wm[2][3];
 
-		mBuffer.copyToBuffer(tx);
-		mBuffer.copyToBuffer(ty);
-		mBuffer.copyToBuffer(tz);
+		buffer.copyToBuffer(tx);
+		buffer.copyToBuffer(ty);
+		buffer.copyToBuffer(tz);
 	}
 
 
 	//------------------------------
 	template<class T>
-	void MeshWriter::transformAndWriteVertex( const T& vertex, const COLLADABU::Math::Matrix4& worldMatrix, size_t index)
+	void MeshWriter::transformAndWriteVertex( Common::Buffer& buffer, const T& vertex, const COLLADABU::Math::Matrix4& worldMatrix, size_t index)
 	{
 		float x = (float)vertex[index];
 		float y = (float)vertex[index + 1];
@@ -222,14 +384,14 @@ namespace DAE23ds
 		float ty = (float)(wm.getElement(1,0) * x + wm.getElement(1,1) * y + wm.getElement(1,2) * z + wm.getElement(1,3));
 		float tz = (float)(wm.getElement(2,0) * x + wm.getElement(2,1) * y + wm.getElement(2,2) * z + wm.getElement(2,3));
 
-		mBuffer.copyToBuffer(tx);
-		mBuffer.copyToBuffer(ty);
-		mBuffer.copyToBuffer(tz);
+		buffer.copyToBuffer(tx);
+		buffer.copyToBuffer(ty);
+		buffer.copyToBuffer(tz);
 	}
 
 
 	//------------------------------
-	bool MeshWriter::writeVertices(const COLLADABU::Math::Matrix4& worldMatrix)
+	bool MeshWriter::writeVertices(Common::Buffer& buffer, const COLLADABU::Math::Matrix4& worldMatrix)
 	{
 
 		if ( mMeshPositions.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT )
@@ -254,14 +416,14 @@ namespace DAE23ds
 				
 				for ( size_t i = 0, count = floatArray->getCount()/3; i < count; ++i)
 				{
-					transformAndWriteVertex( *floatArray, wm, 3*i);
+					transformAndWriteVertex( buffer, *floatArray, wm, 3*i);
 				}
 			}
 			else
 			{
 				// write vertices without any modifications
-				// we can write the vertices directly to the mBuffer
-				mBuffer.copyToBuffer(floatArray->getData(), floatArray->getCount());
+				// we can write the vertices directly to the buffer
+				buffer.copyToBuffer(floatArray->getData(), floatArray->getCount());
 			}
 		}
 		else if ( mMeshPositions.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_DOUBLE )
@@ -272,7 +434,7 @@ namespace DAE23ds
 				// apply the world matrix to the vertices
 				for ( size_t i = 0, count = doubleArray->getCount()/3; i < count; ++i)
 				{
-					transformAndWriteVertex( *doubleArray, worldMatrix, 3*i);
+					transformAndWriteVertex( buffer, *doubleArray, worldMatrix, 3*i);
 				}
 			}
 			else
@@ -281,7 +443,7 @@ namespace DAE23ds
 				// we need to cast the values from double to float
 				for ( size_t i = 0, count = doubleArray->getCount(); i < count; ++i)
 				{
-					mBuffer.copyToBuffer((float)((*doubleArray)[i]));
+					buffer.copyToBuffer((float)((*doubleArray)[i]));
 				}
 			}
 
@@ -297,11 +459,11 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool MeshWriter::writeVerticesForMultipleObjects(size_t firstTriangleIndex, CountType trianglesCount, const COLLADABU::Math::Matrix4& worldMatrix)
+	bool MeshWriter::writeVerticesForMultipleObjects(Common::Buffer& buffer, MeshAccessor& meshAccessor, COLLADAFW::MaterialId* materialIds, size_t firstTriangleIndex, CountType trianglesCount, const COLLADABU::Math::Matrix4& worldMatrix)
 	{
 		if ( mMeshPositions.getType() == COLLADAFW::FloatOrDoubleArray::DATA_TYPE_FLOAT )
 		{
-			MeshAccessor::TriangleType triangle = mMeshAccessor.getTriangle(firstTriangleIndex);
+			MeshAccessor::TriangleType triangle = meshAccessor.getTriangle(firstTriangleIndex);
 			const COLLADAFW::FloatArray* floatArray = mMeshPositions.getFloatValues();
 			if ( getApplyTransformationsToMeshes() && multiplyMeshes )
 			{
@@ -323,28 +485,28 @@ namespace DAE23ds
 				for ( IndexType i = 0; ; ++i)
 				{
 					// apply transformation
-					transformAndWriteVertex( *floatArray, wm, 3*triangle.indices[0]);
-					transformAndWriteVertex( *floatArray, wm, 3*triangle.indices[1]);
-					transformAndWriteVertex( *floatArray, wm, 3*triangle.indices[2]);
+					transformAndWriteVertex( buffer, *floatArray, wm, 3*triangle.indices[0]);
+					transformAndWriteVertex( buffer, *floatArray, wm, 3*triangle.indices[1]);
+					transformAndWriteVertex( buffer, *floatArray, wm, 3*triangle.indices[2]);
 
-					mMaterialIds[i] = triangle.materialId;
+					materialIds[i] = triangle.materialId;
 					if ( i >= trianglesCount - 1)
 						break;
-					triangle = mMeshAccessor.getNextTriangle();
+					triangle = meshAccessor.getNextTriangle();
 				}
 			}
 			else
 			{
 				for ( IndexType i = 0; ; ++i)
 				{
-					// we can write the vertices directly to the mBuffer
-					mBuffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[0], 3);
-					mBuffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[1], 3);
-					mBuffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[2], 3);
-					mMaterialIds[i] = triangle.materialId;
+					// we can write the vertices directly to the buffer
+					buffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[0], 3);
+					buffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[1], 3);
+					buffer.copyToBuffer(floatArray->getData() + 3*triangle.indices[2], 3);
+					materialIds[i] = triangle.materialId;
 					if ( i >= trianglesCount - 1)
 						break;
-					triangle = mMeshAccessor.getNextTriangle();
+					triangle = meshAccessor.getNextTriangle();
 				}
 			}
 		}
@@ -353,22 +515,22 @@ namespace DAE23ds
 			// we need to cast the values from double to float
 			const COLLADAFW::DoubleArray* doubleArray = mMeshPositions.getDoubleValues();
 
-			MeshAccessor::TriangleType triangle = mMeshAccessor.getTriangle(firstTriangleIndex);
+			MeshAccessor::TriangleType triangle = meshAccessor.getTriangle(firstTriangleIndex);
 
 			if ( getApplyTransformationsToMeshes() && multiplyMeshes )
 			{
 				for ( IndexType i = 0; ; ++i)
 				{
 					// apply transformation
-					transformAndWriteVertex( *doubleArray, worldMatrix, 3*triangle.indices[0]);
-					transformAndWriteVertex( *doubleArray, worldMatrix, 3*triangle.indices[1]);
-					transformAndWriteVertex( *doubleArray, worldMatrix, 3*triangle.indices[2]);
+					transformAndWriteVertex( buffer, *doubleArray, worldMatrix, 3*triangle.indices[0]);
+					transformAndWriteVertex( buffer, *doubleArray, worldMatrix, 3*triangle.indices[1]);
+					transformAndWriteVertex( buffer, *doubleArray, worldMatrix, 3*triangle.indices[2]);
 
-					mMaterialIds[i] = triangle.materialId;
+					materialIds[i] = triangle.materialId;
 					if ( i < trianglesCount - 1)
 						break;
 
-					triangle = mMeshAccessor.getNextTriangle();
+					triangle = meshAccessor.getNextTriangle();
 				}
 			}
 			else
@@ -377,24 +539,24 @@ namespace DAE23ds
 				{
 					// we need to cast the values from double to float
 					IndexType index = 3*triangle.indices[0];
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
 
 					index = 3*triangle.indices[1];
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
 
 					index = 3*triangle.indices[2];
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mBuffer.copyToBuffer((float)((*doubleArray)[index++]));
-					mMaterialIds[i] = triangle.materialId;
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
+					buffer.copyToBuffer((float)((*doubleArray)[index++]));
+					materialIds[i] = triangle.materialId;
 					if ( i < trianglesCount - 1)
 						break;
 
-					triangle = mMeshAccessor.getNextTriangle();
+					triangle = meshAccessor.getNextTriangle();
 				}
 			}
 		}
@@ -409,7 +571,7 @@ namespace DAE23ds
 
 
 	//------------------------------
-	bool MeshWriter::writeFaceMaterials(const COLLADAFW::MaterialBindingArray& materialBindings)
+	bool MeshWriter::writeFaceMaterials(Common::Buffer& buffer, const COLLADAFW::MaterialBindingArray& materialBindings)
 	{
 		for ( size_t i = 0, count = materialBindings.getCount(); i < count; ++i)
 		{
@@ -439,7 +601,8 @@ namespace DAE23ds
 			}
 
 			MaterialNumber materialNumber = getMaterialNumberByUniqueId(materialUniqueId );
-			const char* materialName = Writer::calculateMaterialNameFromMaterialNumer(materialNumber);
+			char materialName[OBJECT_NAME_LENGTH + 1];
+			Writer::calculateMaterialNameFromMaterialNumer(materialNumber, materialName);
 
 
 			// calculate size of the chunk
@@ -456,10 +619,10 @@ namespace DAE23ds
 			chunkLength	+= (ChunkLength)sizeof(CountType);
 
 			// write faces material
-			mBuffer.copyToBuffer(TRI_FACES_MAT);
-			mBuffer.copyToBuffer(chunkLength);
-			mBuffer.copyToBuffer(materialName, Writer::getMaterialNameLength());
-			mBuffer.copyToBuffer(faceCount);
+			buffer.copyToBuffer(TRI_FACES_MAT);
+			buffer.copyToBuffer(chunkLength);
+			buffer.copyToBuffer(materialName, Writer::getMaterialNameLength());
+			buffer.copyToBuffer(faceCount);
 
 			// we need to iterate over the primitives again to fill the facenuum array
 			IndexType faceIndex = 0;
@@ -479,7 +642,7 @@ namespace DAE23ds
 				{
 					for ( size_t j = 0; j < trianglesCount; ++j)
 					{
-						mBuffer.copyToBuffer(faceIndex++);
+						buffer.copyToBuffer(faceIndex++);
 					}
 				}
 			}
@@ -488,7 +651,7 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool MeshWriter::writeFaceMaterialsForMultipleObjects(const COLLADAFW::MaterialBindingArray& materialBindings, const ObjectBlockData& blockData)
+	bool MeshWriter::writeFaceMaterialsForMultipleObjects(Common::Buffer& buffer, const COLLADAFW::MaterialId* materialIds, const COLLADAFW::MaterialBindingArray& materialBindings, const ObjectBlockData& blockData)
 	{
 		for ( size_t i = 0, count = materialBindings.getCount(); i < count; ++i)
 		{
@@ -502,7 +665,7 @@ namespace DAE23ds
 
 			for ( size_t j = 0; j < blockData.trianglesCount; ++j)
 			{
-				COLLADAFW::MaterialId triangleMaterialId = mMaterialIds[j];
+				COLLADAFW::MaterialId triangleMaterialId = materialIds[j];
 				if ( triangleMaterialId != materialId)
 				{
 					// we are not interested in that primitive right now
@@ -512,7 +675,8 @@ namespace DAE23ds
 			}
 
 			MaterialNumber materialNumber = getMaterialNumberByUniqueId(materialUniqueId );
-			const char* materialName = Writer::calculateMaterialNameFromMaterialNumer(materialNumber);
+			char materialName[OBJECT_NAME_LENGTH + 1];
+			Writer::calculateMaterialNameFromMaterialNumer(materialNumber, materialName);
 
 			// calculate size of the chunk
 			// empty chunk 
@@ -528,20 +692,20 @@ namespace DAE23ds
 			chunkLength	+= (ChunkLength)sizeof(CountType);
 
 			// write faces material
-			mBuffer.copyToBuffer(TRI_FACES_MAT);
-			mBuffer.copyToBuffer(chunkLength);
-			mBuffer.copyToBuffer(materialName, Writer::getMaterialNameLength());
-			mBuffer.copyToBuffer(faceCount);
+			buffer.copyToBuffer(TRI_FACES_MAT);
+			buffer.copyToBuffer(chunkLength);
+			buffer.copyToBuffer(materialName, Writer::getMaterialNameLength());
+			buffer.copyToBuffer(faceCount);
 
 			// we need to iterate over the primitives again to fill the facenuum array
 			IndexType faceIndex = 0;
 			for ( size_t j = 0; j < blockData.trianglesCount; ++j)
 			{
 				
-				COLLADAFW::MaterialId triangleMaterialId = mMaterialIds[j];
+				COLLADAFW::MaterialId triangleMaterialId = materialIds[j];
 				if ( triangleMaterialId == materialId)
 				{
-					mBuffer.copyToBuffer((IndexType)j);
+					buffer.copyToBuffer((IndexType)j);
 				}
 			}
 		}
@@ -549,7 +713,7 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool MeshWriter::writeTriangles()
+	bool MeshWriter::writeTriangles(Common::Buffer& buffer)
 	{
 
 		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mMesh->getMeshPrimitives();
@@ -569,10 +733,10 @@ namespace DAE23ds
 					size_t trianglesCount = positionsIndicesCount/3;
 					for ( size_t j = 0, index = 0; j < trianglesCount; ++j)
 					{
-						mBuffer.copyToBuffer( (CountType)(positionsIndices[index++]) );
-						mBuffer.copyToBuffer( (CountType)(positionsIndices[index++]) );
-						mBuffer.copyToBuffer( (CountType)(positionsIndices[index++]) );
-						mBuffer.copyToBuffer( FACES_FLAGS );
+						buffer.copyToBuffer( (CountType)(positionsIndices[index++]) );
+						buffer.copyToBuffer( (CountType)(positionsIndices[index++]) );
+						buffer.copyToBuffer( (CountType)(positionsIndices[index++]) );
+						buffer.copyToBuffer( FACES_FLAGS );
 					}
 					break;
 				}
@@ -589,19 +753,19 @@ namespace DAE23ds
 						{
 							if ( switchOrientation )
 							{
-								mBuffer.copyToBuffer( (IndexType)positionsIndices[j - 1] );
-								mBuffer.copyToBuffer( (IndexType)positionsIndices[j - 2] );
-								mBuffer.copyToBuffer( (IndexType)positionsIndices[j - 0] );
+								buffer.copyToBuffer( (IndexType)positionsIndices[j - 1] );
+								buffer.copyToBuffer( (IndexType)positionsIndices[j - 2] );
+								buffer.copyToBuffer( (IndexType)positionsIndices[j - 0] );
 								switchOrientation = false;
 							}
 							else
 							{
-								mBuffer.copyToBuffer( (IndexType)positionsIndices[j - 2] );
-								mBuffer.copyToBuffer( (IndexType)positionsIndices[j - 1] );
-								mBuffer.copyToBuffer( (IndexType)positionsIndices[j - 0] );
+								buffer.copyToBuffer( (IndexType)positionsIndices[j - 2] );
+								buffer.copyToBuffer( (IndexType)positionsIndices[j - 1] );
+								buffer.copyToBuffer( (IndexType)positionsIndices[j - 0] );
 								switchOrientation = true;
 							}
-							mBuffer.copyToBuffer( FACES_FLAGS );
+							buffer.copyToBuffer( FACES_FLAGS );
 						}
 						nextTristripStartIndex += faceVertexCount;
 					}
@@ -626,10 +790,10 @@ namespace DAE23ds
 						for ( size_t j = nextTrifanStartIndex + 2, lastVertex = nextTrifanStartIndex +  faceVertexCount; j < lastVertex; ++j )
 						{
 							CountType newVertex = (CountType)(positionsIndices[j]);
-							mBuffer.copyToBuffer( commonVertexIndex );
-							mBuffer.copyToBuffer( lastVertexIndex );
-							mBuffer.copyToBuffer( newVertex );
-							mBuffer.copyToBuffer( FACES_FLAGS );
+							buffer.copyToBuffer( commonVertexIndex );
+							buffer.copyToBuffer( lastVertexIndex );
+							buffer.copyToBuffer( newVertex );
+							buffer.copyToBuffer( FACES_FLAGS );
 							lastVertexIndex = newVertex;
 						}
 						nextTrifanStartIndex += faceVertexCount;
@@ -644,25 +808,25 @@ namespace DAE23ds
 	}
 
 	//------------------------------
-	bool MeshWriter::writeTrianglesForMultipleObjects(CountType trianglesCount)
+	bool MeshWriter::writeTrianglesForMultipleObjects(Common::Buffer& buffer, CountType trianglesCount)
 	{
 		// we simply need to write the numbers 0...trianglesCount
 		for ( IndexType i = 0, index = 0; i < trianglesCount; ++i)
 		{
-			mBuffer.copyToBuffer(index++);
-			mBuffer.copyToBuffer(index++);
-			mBuffer.copyToBuffer(index++);
-			mBuffer.copyToBuffer( FACES_FLAGS );
+			buffer.copyToBuffer(index++);
+			buffer.copyToBuffer(index++);
+			buffer.copyToBuffer(index++);
+			buffer.copyToBuffer( FACES_FLAGS );
 		}
 		return true;
 	}
 
 	//------------------------------
-	bool MeshWriter::writeMeshMatrix( const COLLADABU::Math::Matrix4& worldMatrix )
+	bool MeshWriter::writeMeshMatrix( Common::Buffer& buffer, const COLLADABU::Math::Matrix4& worldMatrix )
 	{
 		// write local matrix
-		mBuffer.copyToBuffer(TRI_LOCAL);
-		mBuffer.copyToBuffer(TRI_LOCAL_LENGTH);
+		buffer.copyToBuffer(TRI_LOCAL);
+		buffer.copyToBuffer(TRI_LOCAL_LENGTH);
 
 		const COLLADABU::Math::Matrix4& matrix = (getApplyTransformationsToMeshes()&& !multiplyMeshes) ? worldMatrix : COLLADABU::Math::Matrix4::IDENTITY;
 
@@ -670,7 +834,7 @@ namespace DAE23ds
 // 		{
 // 			for ( int i = 0; i < 3; ++i)
 // 			{
-// 				mBuffer.copyToBuffer((float)matrix.getElement(i,j));
+// 				buffer.copyToBuffer((float)matrix.getElement(i,j));
 // 			}
 // 		}
 
@@ -678,13 +842,13 @@ namespace DAE23ds
 		{
 			for ( int j = 0; j < 3; ++j)
 			{
-				mBuffer.copyToBuffer((float)matrix.getElement(i,j));
+				buffer.copyToBuffer((float)matrix.getElement(i,j));
 			}
 		}
 
-		mBuffer.copyToBuffer((float)matrix.getElement(0,3));
-		mBuffer.copyToBuffer((float)matrix.getElement(1,3));
-		mBuffer.copyToBuffer((float)matrix.getElement(2,3));
+		buffer.copyToBuffer((float)matrix.getElement(0,3));
+		buffer.copyToBuffer((float)matrix.getElement(1,3));
+		buffer.copyToBuffer((float)matrix.getElement(2,3));
 
 		return true;
 	}
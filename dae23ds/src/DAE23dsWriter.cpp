@@ -79,6 +79,8 @@ namespace DAE23ds
 		, mObjectAndMaterialBlockLength(0)
 		, mNextObjectId( RESERVED_OBJECTIDS_COUNT )
 		, mNextMaterialNumber( RESERVED_MATERIALNUMBERS_COUNT )
+		, mStreamedMeshHandler(0)
+		, mMeshWritingThreadCount(0)
 	{
 	}
 
@@ -86,6 +88,7 @@ namespace DAE23ds
 	Writer::~Writer()
 	{
 		delete mVisualScene;
+		delete mStreamedMeshHandler;
 	}
 
 	//--------------------------------------------------------------------
@@ -120,6 +123,9 @@ namespace DAE23ds
 
 		mBuffer = &buffer;
 
+		// Record the byte ranges of the libraries, to skip all but the geometries in the second run
+		loader.setSectionIndexing(true);
+
 		// Load scene graph 
 		loader.setObjectFlags(   COLLADASaxFWL::Loader::ASSET_FLAG 
 							   | COLLADASaxFWL::Loader::EFFECT_FLAG
@@ -144,6 +150,7 @@ namespace DAE23ds
 
 		// load and write geometries
 		mCurrentRun = GEOMETRY_RUN;
+		loader.setObjectFlags( COLLADASaxFWL::Loader::GEOMETRY_FLAG );
 		if ( !root.loadDocument(mInputFile.toNativePath()) )
 			return false;
 
@@ -267,7 +274,9 @@ namespace DAE23ds
 		case GEOMETRY_RUN:
 			{
 				MeshWriter meshWriter( this, (COLLADAFW::Mesh*)geometry );
-				return meshWriter.handle();
+				if ( !meshWriter.handle() )
+					return false;
+				return meshWriter.writeObjects( mMeshWritingThreadCount );
 				break;
 			}
 		default:
@@ -275,6 +284,36 @@ namespace DAE23ds
 		}
 	}
 
+	//--------------------------------------------------------------------
+	bool Writer::startMesh( const COLLADAFW::Mesh* mesh )
+	{
+		if ( mCurrentRun != SCENEGRAPH_RUN )
+			return false;
+
+		delete mStreamedMeshHandler;
+		mStreamedMeshHandler = new MeshHandler( this, mesh );
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool Writer::writeMeshPrimitive( const COLLADAFW::Mesh* mesh, const COLLADAFW::MeshPrimitive* meshPrimitive )
+	{
+		if ( !mStreamedMeshHandler )
+			return true;
+		return mStreamedMeshHandler->handleMeshPrimitive( meshPrimitive );
+	}
+
+	//--------------------------------------------------------------------
+	bool Writer::finishMesh( const COLLADAFW::Mesh* mesh )
+	{
+		if ( !mStreamedMeshHandler )
+			return true;
+		bool success = mStreamedMeshHandler->finish();
+		delete mStreamedMeshHandler;
+		mStreamedMeshHandler = 0;
+		return success;
+	}
+
 	//--------------------------------------------------------------------
 	bool Writer::writeMaterial( const COLLADAFW::Material* material )
 	{
@@ -465,10 +504,18 @@ namespace DAE23ds
 	//--------------------------------------------------------------------
 	template<class NumberType, char prefix>
 	const char* Writer::calculateNameFromNumber( const NumberType& number)
+	{
+		static char buffer[OBJECT_NAME_LENGTH + 1];
+		calculateNameFromNumber<NumberType, prefix>( number, buffer );
+		return buffer;
+	}
+
+	//--------------------------------------------------------------------
+	template<class NumberType, char prefix>
+	void Writer::calculateNameFromNumber( const NumberType& number, char* buffer)
 	{
 		// we do not support to big meshes here
 		assert(number < 100000);
-		static char buffer[OBJECT_NAME_LENGTH];
 		char* p = buffer;
 		*(p++) = prefix;
 		if ( number < 1000000) *(p++) = '0';
@@ -477,8 +524,6 @@ namespace DAE23ds
 		if ( number < 100) *(p++) = '0';
 		if ( number < 10) *(p++) = '0';
 		p += Common::itoa( number, p, 10);
-		return buffer;
-
 	}
 
 
@@ -488,10 +533,22 @@ namespace DAE23ds
 		return calculateNameFromNumber<MaterialNumber, 'M'>(materialNumber);
 	}
 
+	//--------------------------------------------------------------------
+	void Writer::calculateMaterialNameFromMaterialNumer( const MaterialNumber& materialNumber, char* buffer)
+	{
+		calculateNameFromNumber<MaterialNumber, 'M'>(materialNumber, buffer);
+	}
+
 	//--------------------------------------------------------------------
 	const char* Writer::calculateObjectNameFromObjectId( const ObjectId& objectId)
 	{
 		return calculateNameFromNumber<ObjectId, 'G'>(objectId);
 	}
+
+	//--------------------------------------------------------------------
+	void Writer::calculateObjectNameFromObjectId( const ObjectId& objectId, char* buffer)
+	{
+		calculateNameFromNumber<ObjectId, 'G'>(objectId, buffer);
+	}
 		
 } // namespace DAE23ds
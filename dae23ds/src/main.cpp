@@ -17,6 +17,7 @@
 #include "COLLADABUURI.h"
 
 #include <iostream>
+#include <thread>
 #include <sys/types.h>
 #include <sys/timeb.h>
 
@@ -37,6 +38,7 @@ int main(int argc, char* argv[])
 
 //		DAE23ds::Writer writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile), false);
 		DAE23ds::Writer writer( COLLADABU::URI::nativePathToUri(inputFile), COLLADABU::URI::nativePathToUri(outputFile), true);
+		writer.setMeshWritingThreadCount( std::thread::hardware_concurrency() );
 		writer.write();
 
 
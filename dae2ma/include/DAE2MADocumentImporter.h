@@ -31,6 +31,7 @@
 #include "COLLADASaxFWLLoader.h"
 
 #include "MayaDMMesh.h"
+#include "MayaDMOutputBuffer.h"
 
 #include "COLLADABUIDList.h"
 
@@ -108,6 +109,9 @@ namespace DAE2MA
         /** The Buffersize for the document to write. */
         static const int BUFFERSIZE;
 
+        /** The size of the output buffer for the large setAttr arrays. */
+        static const size_t OUTPUT_BUFFERSIZE;
+
         /**
          * An enum for the steps to do. See main documentation.
          */
@@ -169,6 +173,13 @@ namespace DAE2MA
         /** The current maya ascii file to import the data. */
         FILE* mFile;
 
+        /** Flushes the output buffer into the current maya ascii file. */
+        MayaDM::FileBufferFlusher* mOutputBufferFlusher;
+
+        /** The buffer to format large setAttr arrays, like vertices, edges and faces, 
+        without fprintf. Flushed into the current maya ascii file. */
+        Common::CharacterBuffer* mOutputBuffer;
+
         /** The LC_NUMERIC locale that was set before the Streamwriter was instantiated. */
         String mLocale;			
 
@@ -272,6 +283,10 @@ namespace DAE2MA
         /** The current maya ascii file to import the data. */
         FILE* getFile () const { return mFile; }
 
+        /** The buffer to write large setAttr arrays into the current maya ascii file. 
+        The buffered setters of the maya data model nodes flush it, before they return. */
+        Common::CharacterBuffer* getOutputBuffer () const { return mOutputBuffer; }
+
         /** Returns the tolerance value for double value comparison. */
         const double getTolerance () const { return mDigitTolerance; }
 
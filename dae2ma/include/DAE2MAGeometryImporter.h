@@ -23,6 +23,7 @@
 
 #include "COLLADAFWMesh.h"
 #include "COLLADAFWController.h"
+#include "COLLADAFWEdgeBuilder.h"
 
 #include "Math/COLLADABUMathVector3.h"
 
@@ -32,12 +33,6 @@
 
 #include <vector>
 
-#ifdef __GNUC__
-#include <ext/hash_map>
-#else
-#include <hash_map>
-#endif
-
 
 namespace DAE2MA
 {
@@ -54,13 +49,6 @@ namespace DAE2MA
         /** The list for the edge indices. */
         typedef std::vector<COLLADAFW::Edge> EdgeList;
 
-        /** The map for searching edge indices. */
-#ifndef __GNUC__
-        typedef stdext::hash_map<COLLADAFW::Edge,size_t> EdgeMap;
-#else        
-        typedef __gnu_cxx::hash_map<COLLADAFW::Edge,size_t> EdgeMap;
-#endif
-        
     public:
 
         /**
@@ -273,6 +261,12 @@ namespace DAE2MA
 
 		size_t mCount2013Workarounds;
 
+        /**
+         * Determines the unique edges of the current mesh and the edge indices of its faces.
+         * Keeps its memory for the next mesh.
+         */
+        COLLADAFW::EdgeBuilder mEdgeBuilder;
+
     public:
 
         /** Constructor. */
@@ -495,20 +489,13 @@ namespace DAE2MA
             MayaDM::Mesh &meshNode, 
             const COLLADAFW::UniqueId& transformNodeId );
 
-        /**
-         * Iterates over the mesh primitives and reads the edge indices.
-         */
-        void getEdgeIndices ( 
-            const COLLADAFW::Mesh* mesh, 
-            EdgeList& edgeIndices, 
-            EdgeMap& edgeIndicesMap );
-
         /*
          *	Write the face informations into the maya file.
+         *  The edge builder holds the edge indices of the faces of all primitive elements.
          */
         void writeFaces ( 
             const COLLADAFW::Mesh* mesh, 
-            EdgeMap& edgeIndicesMap, 
+            const COLLADAFW::EdgeBuilder& edgeBuilder, 
             MayaDM::Mesh &meshNode );
 
         /*
@@ -517,7 +504,7 @@ namespace DAE2MA
         void appendPolygonPolyFaces ( 
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            EdgeMap& edgeIndicesMap, 
+            const int* faceEdgeIndices, 
             MayaDM::Mesh &meshNode,
             const size_t blockSize, 
             const size_t numGlobalFaces, 
@@ -530,7 +517,7 @@ namespace DAE2MA
         void appendTrifansPolyFaces (
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const int* faceEdgeIndices, 
             MayaDM::Mesh &meshNode,
             const size_t blockSize, 
             const size_t numGlobalFaces, 
@@ -543,7 +530,7 @@ namespace DAE2MA
         void appendTristripsPolyFaces (
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const int* faceEdgeIndices, 
             MayaDM::Mesh &meshNode,
             const size_t blockSize, 
             const size_t numGlobalFaces, 
@@ -552,11 +539,12 @@ namespace DAE2MA
 
         /**
          * Set the face infos into the maya poly face element.
+         * The face edge indices point to the signed edge indices of the current face.
          */
         void setPolygonFaceInfos ( 
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const int* faceEdgeIndices, 
             MayaDM::polyFaces &polyFace, 
             int &numEdges, 
             size_t &positionIndex, 
@@ -565,7 +553,7 @@ namespace DAE2MA
         void setPolygonHoleInfos ( 
             const COLLADAFW::Mesh* mesh, 
             const COLLADAFW::MeshPrimitive* primitiveElement, 
-            const EdgeMap& edgeIndicesMap, 
+            const int* faceEdgeIndices, 
             MayaDM::polyFaces &polyFace, 
             int &numEdges, 
             size_t &positionIndex, 
@@ -656,89 +644,12 @@ namespace DAE2MA
         COLLADABU::Math::Vector3* getVertexPosition ( 
             const COLLADAFW::Mesh* mesh, const size_t vertexIndex );
 
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for triangle elements, polygons or polylist. Trifans and tristrips are a little 
-        * bit special.
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendEdgeIndices ( 
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for triangle elements, polygons or polylist. 
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendPolygonEdgeIndices ( 
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for trifans.
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendTrifansEdgeIndices (
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Determine the edge indices (unique edges, also for multiple primitive elements)
-        * and write it into the lists (the indices referes on the position indices).
-        * Does it for tristrips.
-        * @param edgeIndices 
-        *           A vector of edge indices. We use it to write the list of edges into the maya 
-        *           file. The vector is already sorted.
-        * @param edgeIndicesMap 
-        *           We store the edge indices also in a sorted map. The dublicate data holding 
-        *           is reasonable, because we need the index of a given edge. The search of  
-        *           values in a map is much faster than in a vector!
-        */
-        void appendTristripsEdgeIndices (
-            const COLLADAFW::MeshPrimitive* primitiveElement,
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
-        /*
-        * Appends the data of an edge, if it is not already in the list.
-        */
-        void appendEdge( 
-            const COLLADAFW::Edge& edge, 
-            EdgeList& edgeIndices,
-            EdgeMap& edgeIndicesMap );
-
         /*
          *	Write the edges into the maya file.
          */
         void writeEdges ( 
             const COLLADAFW::Mesh* mesh, 
-            const EdgeList& edgeIndices, 
+            const EdgeList& edges, 
             MayaDM::Mesh &meshNode );
 
         /*
@@ -778,15 +689,6 @@ namespace DAE2MA
             const COLLADAFW::Mesh* mesh, 
             MayaDM::Mesh &meshNode );
 
-        /*
-         * Gets the index value of the current edge. 
-         * Returns false, if the search for the index value of the edge was not sucessful.
-         */
-        bool getEdgeIndex ( 
-            const COLLADAFW::Edge& edge, 
-            const EdgeMap& edgeIndicesMap, 
-            int& edgeIndex );
-
         /**
         * Fills the ShadingEnginePrimitivesMap. Used to create the connections between the 
         * shading engines and the geometries.
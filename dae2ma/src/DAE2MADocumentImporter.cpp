@@ -93,6 +93,7 @@ namespace DAE2MA
 
     /** The Buffersize for the document to write. */
     const int DocumentImporter::BUFFERSIZE = 2097152;
+    const size_t DocumentImporter::OUTPUT_BUFFERSIZE = 65536;
 
 
     //---------------------------------
@@ -111,6 +112,8 @@ namespace DAE2MA
         , mEffectsList (0)
         , mAnimationListsList (0)
         , mFile ( 0 )
+        , mOutputBufferFlusher ( 0 )
+        , mOutputBuffer ( 0 )
         , mNodeImporter (0)
         , mVisualSceneImporter (0)
         , mGeometryImporter (0)
@@ -292,6 +295,10 @@ namespace DAE2MA
             return false;
         }
 
+        // Format the large arrays into a buffer, that is flushed into the same file.
+        mOutputBufferFlusher = new MayaDM::FileBufferFlusher ( mFile );
+        mOutputBuffer = new Common::CharacterBuffer ( OUTPUT_BUFFERSIZE, mOutputBufferFlusher );
+
         return true;
     }
 
@@ -300,6 +307,12 @@ namespace DAE2MA
     {
         if ( mFile ) 
         {
+            // The buffer flushes its remaining data on destruction.
+            delete mOutputBuffer;
+            mOutputBuffer = 0;
+            delete mOutputBufferFlusher;
+            mOutputBufferFlusher = 0;
+
             fclose ( mFile );
             mFile = 0;
 
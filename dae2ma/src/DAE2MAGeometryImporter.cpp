@@ -31,6 +31,8 @@
 #include "COLLADAFWEdge.h"
 #include "COLLADAFWMorphController.h"
 
+#include <thread>
+
 
 namespace DAE2MA
 {
@@ -42,7 +44,10 @@ namespace DAE2MA
     GeometryImporter::GeometryImporter( DocumentImporter* documentImporter ) 
     : BaseImporter ( documentImporter )
 	, mCount2013Workarounds( 0 )
-    {}
+    {
+        // The face edges of the primitives of a mesh are collected in parallel.
+        mEdgeBuilder.setThreadCount ( std::thread::hardware_concurrency () );
+    }
 
     // --------------------------------------------
     GeometryImporter::~GeometryImporter ()
@@ -587,28 +592,15 @@ namespace DAE2MA
         // Write the uv corrdinates.
         writeColorSets ( mesh, meshNode );
 
-        // The vector of edge indices. We use it to write the list of edges into 
-        // the maya file. The vector is already sorted.
-        EdgeList edgeIndices;
-
-        // We store the edge indices also in a sorted map. The dublicate data holding 
-        // is reasonable, because we need the index of a given edge. The search of  
-        // values in a map is much faster than in a vector!
-        EdgeMap edgeIndicesMap;
-
-        // We need also a list where we store the information about the vertices of an edge 
-        // and the index position of the vertex in the mesh's primitive lists. Because the indices
-        // in the primitive's vertex indices list are always the same like the indices in the 
-        // primitive's uv or color indices lists. 
-
-        // Iterates over the mesh primitives and reads the edge indices.
-        getEdgeIndices ( mesh, edgeIndices, edgeIndicesMap );
+        // Determine the unique edges of all primitive elements and the edge indices of 
+        // their faces. The edges are numbered in the order of their first appearance.
+        mEdgeBuilder.build ( mesh );
 
         // Write the edge indices of all primitive elements into the maya file.
-        writeEdges ( mesh, edgeIndices, meshNode );
+        writeEdges ( mesh, mEdgeBuilder.getEdges (), meshNode );
 
         // Write the face informations of all primitive elements into the maya file.
-        writeFaces ( mesh, edgeIndicesMap, meshNode );
+        writeFaces ( mesh, mEdgeBuilder, meshNode );
 
         // Write the face vertex normals. 
 //         if ( ImportOptions::importNormals () )
@@ -659,6 +651,9 @@ namespace DAE2MA
         const COLLADAFW::MeshVertexData& normals = mesh->getNormals ();
         size_t stride = 3; // x, y, z
 
+        // The normals are formatted into the output buffer.
+        Common::CharacterBuffer& buffer = *getDocumentImporter ()->getOutputBuffer ();
+
         // We have to go through every mesh primitive and append every element. 
         const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mesh->getMeshPrimitives ();
         size_t count = meshPrimitives.getCount ();
@@ -711,7 +706,7 @@ namespace DAE2MA
                                 {
                                     endPosition = index+blockSize-1;
                                     if ( endPosition > numNormals-1 ) endPosition = numNormals-1;
-                                    meshNode.startNormals ( index, endPosition ); 
+                                    meshNode.startNormals ( index, endPosition, buffer ); 
                                 }
 
                                 // Get the position in the values list to read.
@@ -724,17 +719,17 @@ namespace DAE2MA
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT:
                                     {
                                         const COLLADAFW::ArrayPrimitiveType<float>* values = normals.getFloatValues ();
-                                        meshNode.appendNormals ( (*values)[pos] );
-                                        meshNode.appendNormals ( (*values)[pos+1] );
-                                        meshNode.appendNormals ( (*values)[pos+2] );
+                                        meshNode.appendNormals ( (*values)[pos], buffer );
+                                        meshNode.appendNormals ( (*values)[pos+1], buffer );
+                                        meshNode.appendNormals ( (*values)[pos+2], buffer );
                                     }
                                     break;
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE:
                                     {
                                         const COLLADAFW::ArrayPrimitiveType<double>* values = normals.getDoubleValues ();
-                                        meshNode.appendNormals ( (float)(*values)[pos] );
-                                        meshNode.appendNormals ( (float)(*values)[pos+1] );
-                                        meshNode.appendNormals ( (float)(*values)[pos+2] );
+                                        meshNode.appendNormals ( (float)(*values)[pos], buffer );
+                                        meshNode.appendNormals ( (float)(*values)[pos+1], buffer );
+                                        meshNode.appendNormals ( (float)(*values)[pos+2], buffer );
                                     }
                                     break;
                                 default:
@@ -744,7 +739,7 @@ namespace DAE2MA
 
                                 // End the block if necessary.
                                 if ( index == endPosition ) 
-                                    meshNode.endNormals (); 
+                                    meshNode.endNormals ( buffer ); 
                             }                        
                         }
 
@@ -800,7 +795,7 @@ namespace DAE2MA
                                 {
                                     endPosition = index+blockSize-1;
                                     if ( endPosition > numNormals-1 ) endPosition = numNormals-1;
-                                    meshNode.startNormals ( index, endPosition ); 
+                                    meshNode.startNormals ( index, endPosition, buffer ); 
                                 }
 
                                 // Get the position in the values list to read.
@@ -813,17 +808,17 @@ namespace DAE2MA
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT:
                                     {
                                         const COLLADAFW::ArrayPrimitiveType<float>* values = normals.getFloatValues ();
-                                        meshNode.appendNormals ( (*values)[pos] );
-                                        meshNode.appendNormals ( (*values)[pos+1] );
-                                        meshNode.appendNormals ( (*values)[pos+2] );
+                                        meshNode.appendNormals ( (*values)[pos], buffer );
+                                        meshNode.appendNormals ( (*values)[pos+1], buffer );
+                                        meshNode.appendNormals ( (*values)[pos+2], buffer );
                                     }
                                     break;
                                 case COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE:
                                     {
                                         const COLLADAFW::ArrayPrimitiveType<double>* values = normals.getDoubleValues ();
-                                        meshNode.appendNormals ( (float)(*values)[pos] );
-                                        meshNode.appendNormals ( (float)(*values)[pos+1] );
-                                        meshNode.appendNormals ( (float)(*values)[pos+2] );
+                                        meshNode.appendNormals ( (float)(*values)[pos], buffer );
+                                        meshNode.appendNormals ( (float)(*values)[pos+1], buffer );
+                                        meshNode.appendNormals ( (float)(*values)[pos+2], buffer );
                                     }
                                     break;
                                 default:
@@ -832,7 +827,7 @@ namespace DAE2MA
 
                                 // End the block if necessary.
                                 if ( index == endPosition ) 
-                                    meshNode.endNormals (); 
+                                    meshNode.endNormals ( buffer ); 
                             }                        
                         }
 
@@ -860,7 +855,7 @@ namespace DAE2MA
                         {
                             endPosition = index+blockSize-1;
                             if ( endPosition > numNormals-1 ) endPosition = numNormals-1;
-                            meshNode.startNormals ( index, endPosition ); 
+                            meshNode.startNormals ( index, endPosition, buffer ); 
                         }
 
                         // Write the normal values on the index values.
@@ -870,17 +865,17 @@ namespace DAE2MA
                         case COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT:
                             {
                                 const COLLADAFW::ArrayPrimitiveType<float>* values = normals.getFloatValues ();
-                                meshNode.appendNormals ( (*values)[pos] );
-                                meshNode.appendNormals ( (*values)[pos+1] );
-                                meshNode.appendNormals ( (*values)[pos+2] );
+                                meshNode.appendNormals ( (*values)[pos], buffer );
+                                meshNode.appendNormals ( (*values)[pos+1], buffer );
+                                meshNode.appendNormals ( (*values)[pos+2], buffer );
                             }
                             break;
                         case COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE:
                             {
                                 const COLLADAFW::ArrayPrimitiveType<double>* values = normals.getDoubleValues ();
-                                meshNode.appendNormals ( (float)(*values)[pos] );
-                                meshNode.appendNormals ( (float)(*values)[pos+1] );
-                                meshNode.appendNormals ( (float)(*values)[pos+2] );
+                                meshNode.appendNormals ( (float)(*values)[pos], buffer );
+                                meshNode.appendNormals ( (float)(*values)[pos+1], buffer );
+                                meshNode.appendNormals ( (float)(*values)[pos+2], buffer );
                             }
                             break;
                         default:
@@ -890,7 +885,7 @@ namespace DAE2MA
 
                         // End the block if necessary.
                         if ( index == endPosition ) 
-                            meshNode.endNormals (); 
+                            meshNode.endNormals ( buffer ); 
                     }
                 }
                 break;
@@ -1288,7 +1283,12 @@ namespace DAE2MA
 
         // Write blocks with 4000KB for maya.
         size_t blockSize = MAYA_BLOCK_SIZE / ( 3* sizeof ( double ) );
-        size_t endPosition;
+        size_t startPosition, endPosition;
+
+        // The converted values of the current block, written at once into the output buffer.
+        Common::CharacterBuffer& buffer = *getDocumentImporter ()->getOutputBuffer ();
+        std::vector<float> blockValues;
+        blockValues.reserve ( stride * std::min ( blockSize, numVertices+1 ) );
 
         COLLADABU::Math::Vector3 converted;
 
@@ -1297,9 +1297,10 @@ namespace DAE2MA
             // Start the block if necessary.
             if ( index % blockSize == 0 )
             {
+                startPosition = index;
                 endPosition = index+blockSize-1;
                 if ( endPosition > numVertices ) endPosition = numVertices;
-                meshNode.startVrts ( index, endPosition ); 
+                blockValues.clear ();
             }
 
             const COLLADAFW::MeshVertexData::DataType type = positions.getType ();
@@ -1322,13 +1323,13 @@ namespace DAE2MA
                 continue;
             }
 
-            meshNode.appendVrts ( (float)converted[0] );
-            meshNode.appendVrts ( (float)converted[1] );
-            meshNode.appendVrts ( (float)converted[2] );
+            blockValues.push_back ( (float)converted[0] );
+            blockValues.push_back ( (float)converted[1] );
+            blockValues.push_back ( (float)converted[2] );
 
-            // End the block if necessary.
+            // Write the block if necessary.
             if ( index == endPosition ) 
-                meshNode.endVrts (); 
+                meshNode.setVrts ( startPosition, endPosition, &blockValues[0], buffer ); 
         }
     }
 
@@ -1353,6 +1354,10 @@ namespace DAE2MA
         // Initialise the initial index.
         size_t initialIndex = 0;
 
+        // The values of the current block, written at once into the output buffer.
+        Common::CharacterBuffer& buffer = *getDocumentImporter ()->getOutputBuffer ();
+        std::vector<float> blockValues;
+
         // Go through the uv sets.
         for ( size_t i=0; i<numUVSets; ++i )
         {
@@ -1374,16 +1379,18 @@ namespace DAE2MA
 
                 size_t indicesCount = uvCoords.getLength ( i );
                 size_t numUvSetPoints = (indicesCount/stride)-1;
-                size_t endPosition = 0, index=0; 
+                size_t startPosition = 0, endPosition = 0, index=0; 
+                blockValues.reserve ( 2 * std::min ( blockSize, numUvSetPoints+1 ) );
 
                 for ( size_t j=0; j<indicesCount; j+=stride, ++index )
                 {
                     // Start the block if necessary
                     if ( index % blockSize == 0 )
                     {
+                        startPosition = index;
                         endPosition = index+blockSize-1;
                         if ( endPosition > numUvSetPoints ) endPosition = numUvSetPoints;
-                        meshNode.startUvSetPoints ( i, index, endPosition ); 
+                        blockValues.clear ();
                     }
 
                     // Write the values 
@@ -1393,15 +1400,15 @@ namespace DAE2MA
                     case COLLADAFW::MeshVertexData::DATA_TYPE_FLOAT:
                         {
                             const COLLADAFW::ArrayPrimitiveType<float>* values = uvCoords.getFloatValues ();
-                            meshNode.appendUvSetPoints ( toLinearUnit ((*values)[initialIndex+j]) );
-                            meshNode.appendUvSetPoints ( toLinearUnit ((*values)[initialIndex+j+1]) );
+                            blockValues.push_back ( toLinearUnit ((*values)[initialIndex+j]) );
+                            blockValues.push_back ( toLinearUnit ((*values)[initialIndex+j+1]) );
                         }
                         break;
                     case COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE:
                         {
                             const COLLADAFW::ArrayPrimitiveType<double>* values = uvCoords.getDoubleValues ();
-                            meshNode.appendUvSetPoints ( (float) toLinearUnit ((*values)[initialIndex+j]) );
-                            meshNode.appendUvSetPoints ( (float) toLinearUnit ((*values)[initialIndex+j+1]) );
+                            blockValues.push_back ( (float) toLinearUnit ((*values)[initialIndex+j]) );
+                            blockValues.push_back ( (float) toLinearUnit ((*values)[initialIndex+j+1]) );
                         }
                         break;
                     default:
@@ -1409,9 +1416,9 @@ namespace DAE2MA
                         continue;
                     }
 
-                    // End the block if necessary.
+                    // Write the block if necessary.
                     if ( index == endPosition ) 
-                        meshNode.endUvSetPoints (); 
+                        meshNode.setUvSetPoints ( i, startPosition, endPosition, &blockValues[0], buffer ); 
                 }
 
                 initialIndex += indicesCount;
@@ -1508,10 +1515,10 @@ namespace DAE2MA
     // --------------------------------------------
     void GeometryImporter::writeEdges (  
         const COLLADAFW::Mesh* mesh, 
-        const EdgeList &edgeIndices, 
+        const EdgeList &edges, 
         MayaDM::Mesh &meshNode )
     {
-        size_t numEdges = edgeIndices.size ();
+        size_t numEdges = edges.size ();
         if ( numEdges > 0 )
         {
             // Without normals, we need to use soft edges (1).
@@ -1524,7 +1531,12 @@ namespace DAE2MA
 
             // Write blocks with 4000KB for maya
             size_t blockSize = MAYA_BLOCK_SIZE / ( 3* sizeof ( double ) );
-            size_t endPosition = 0, index=0; 
+            size_t startPosition = 0, endPosition = 0; 
+
+            // The values of the current block, written at once into the output buffer.
+            Common::CharacterBuffer& buffer = *getDocumentImporter ()->getOutputBuffer ();
+            std::vector<int> blockValues;
+            blockValues.reserve ( 3 * std::min ( blockSize, numEdges ) );
             
             // Go through the edges and write them.
             for ( size_t index=0; index<numEdges; ++index )
@@ -1532,19 +1544,20 @@ namespace DAE2MA
                 // Start the block if necessary
                 if ( index % blockSize == 0 )
                 {
+                    startPosition = index;
                     endPosition = index+blockSize-1;
                     if ( endPosition > numEdges-1 ) endPosition = numEdges-1;
-                    meshNode.startEdge ( index, endPosition ); 
+                    blockValues.clear ();
                 }
                 
-                const COLLADAFW::Edge& edge = edgeIndices [index];
-                meshNode.appendEdge ( edge[0] );
-                meshNode.appendEdge ( edge[1] );
-                meshNode.appendEdge ( edgh );
+                const COLLADAFW::Edge& edge = edges [index];
+                blockValues.push_back ( edge[0] );
+                blockValues.push_back ( edge[1] );
+                blockValues.push_back ( edgh );
                 
-                // End the block if necessary.
+                // Write the block if necessary.
                 if ( index == endPosition ) 
-                    meshNode.endEdge (); 
+                    meshNode.setEdge ( startPosition, endPosition, &blockValues[0], buffer ); 
             }
         }
     }
@@ -1552,7 +1565,7 @@ namespace DAE2MA
     // --------------------------------------------
     void GeometryImporter::writeFaces ( 
         const COLLADAFW::Mesh* mesh, 
-        EdgeMap& edgeIndicesMap, 
+        const COLLADAFW::EdgeBuilder& edgeBuilder, 
         MayaDM::Mesh &meshNode )
     {
         // Get the number of faces in the current mesh.
@@ -1574,20 +1587,23 @@ namespace DAE2MA
             // Get the primitive element.
             COLLADAFW::MeshPrimitive* primitiveElement = primitiveElementsArray [ primitiveIndex ];
 
+            // The signed edge indices of the primitive's faces.
+            const int* faceEdgeIndices = edgeBuilder.getFaceEdgeIndices ( primitiveIndex );
+
             // Write the face informations into the maya file.
             COLLADAFW::MeshPrimitive::PrimitiveType primitiveType = primitiveElement->getPrimitiveType ();
             switch ( primitiveType )
             {
             case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
-                appendTrifansPolyFaces ( mesh, primitiveElement, edgeIndicesMap, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
+                appendTrifansPolyFaces ( mesh, primitiveElement, faceEdgeIndices, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
                 break;
             case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
-                appendTristripsPolyFaces ( mesh, primitiveElement, edgeIndicesMap, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
+                appendTristripsPolyFaces ( mesh, primitiveElement, faceEdgeIndices, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
                 break;
             case COLLADAFW::MeshPrimitive::POLYGONS:
             case COLLADAFW::MeshPrimitive::POLYLIST:
             case COLLADAFW::MeshPrimitive::TRIANGLES:
-                appendPolygonPolyFaces ( mesh, primitiveElement, edgeIndicesMap, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
+                appendPolygonPolyFaces ( mesh, primitiveElement, faceEdgeIndices, meshNode, blockSize, numGlobalFaces, globalFaceIndex, endPosition );
                 break;
             default:
                 std::cerr << "Primitive type not implemented!" << std::endl;
@@ -1600,13 +1616,16 @@ namespace DAE2MA
     void GeometryImporter::appendPolygonPolyFaces ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        EdgeMap& edgeIndicesMap, 
+        const int* faceEdgeIndices, 
         MayaDM::Mesh &meshNode,
         const size_t blockSize, 
         const size_t numGlobalFaces, 
         size_t& globalFaceIndex, 
         size_t& endPosition )
     {
+        // The faces are formatted into the output buffer.
+        Common::CharacterBuffer& buffer = *getDocumentImporter ()->getOutputBuffer ();
+
         size_t positionIndex=0;
         size_t uvSetIndicesIndex = 0;
         size_t colorIndicesIndex = 0;
@@ -1637,9 +1656,12 @@ namespace DAE2MA
             // Handle the face infos.
             bool isHole = (numEdges<0);
             if ( !isHole )
-                setPolygonFaceInfos ( mesh, primitiveElement, edgeIndicesMap, polyFace, numEdges, positionIndex, polygonPoints );
+                setPolygonFaceInfos ( mesh, primitiveElement, faceEdgeIndices, polyFace, numEdges, positionIndex, polygonPoints );
             else
-                setPolygonHoleInfos ( mesh, primitiveElement, edgeIndicesMap, polyFace, numEdges, positionIndex, polygonPoints );
+                setPolygonHoleInfos ( mesh, primitiveElement, faceEdgeIndices, polyFace, numEdges, positionIndex, polygonPoints );
+
+            // The edge indices of the next face (the number of edges is positive now).
+            faceEdgeIndices += numEdges;
 
             // Handle the uv set infos.
             setPolygonUVSetInfos ( mesh, primitiveElement, polyFace, uvSetIndicesIndex, numEdges );
@@ -1674,16 +1696,16 @@ namespace DAE2MA
 					}
 					//---------------------------------------------------------
 
-                    meshNode.startFace ( globalFaceIndex, endPosition ); 
+                    meshNode.startFace ( globalFaceIndex, endPosition, buffer ); 
                 }
             }
 
             // Write the polyFace data in the maya file.
-            meshNode.appendFace ( polyFace );
+            meshNode.appendFace ( polyFace, buffer );
 
 			//--- @Workaround for maya 2013 with single face geometries
 			if( duplicateSingleFaceWorkaround )
-				meshNode.appendFace ( polyFace );
+				meshNode.appendFace ( polyFace, buffer );
 			//---------------------------------------------------------
 
             // Check if the next element is a hole.
@@ -1696,7 +1718,7 @@ namespace DAE2MA
 
             // End the block if necessary (if the next element is a hole, don't close).
             if ( duplicateSingleFaceWorkaround || (globalFaceIndex == endPosition && !nextElementIsHole) ) 
-                meshNode.endFace (); 
+                meshNode.endFace ( buffer ); 
 
             // Increment the face index (if it is not a hole, this will not be counted).
             if ( !nextElementIsHole )
@@ -1714,28 +1736,19 @@ namespace DAE2MA
     void GeometryImporter::appendTrifansPolyFaces ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const int* faceEdgeIndices, 
         MayaDM::Mesh &meshNode,
         const size_t blockSize, 
         const size_t numGlobalFaces, 
         size_t& globalFaceIndex, 
         size_t& endPosition )
     {
-        // Get the position and the normal indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t initialPositionIndex=0;
-        size_t positionIndex=0;
+        // The faces are formatted into the output buffer.
+        Common::CharacterBuffer& buffer = *getDocumentImporter ()->getOutputBuffer ();
 
         size_t uvSetIndicesIndex = 0;
         size_t colorIndicesIndex = 0;
 
-        COLLADAFW::Edge edge;
-
         // Iterate over the grouped vertices and get the edges for every group.
         COLLADAFW::Trifans* trifans = (COLLADAFW::Trifans*) primitiveElement;
         COLLADAFW::Trifans::VertexCountArray& vertexCountArray = trifans->getGroupedVerticesVertexCountArray ();
@@ -1776,33 +1789,14 @@ namespace DAE2MA
                 // Increment the current triangle edge counter, so we know if we have the full triangle.
                 ++triangleEdgeCounter;
 
-                // Get the start edge index
-                if ( triangleEdgeCounter > 1 )
-                    edgeStartVertexIdx = positionIndices[positionIndex];
-                else edgeStartVertexIdx = positionIndices[initialPositionIndex];
-
-                // With the third edge of a triangle, we have to go back to the trifans root.
-                if ( triangleEdgeCounter < 3 )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[initialPositionIndex];
-
-                // Set the edge vertex index values into an edge object.
-                edge.setVertexIndices ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Variable for the current edge index.
-                int edgeIndexValue = 0;
-
-                // Get the edge index value from the edge list.
-                getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
-
-                // Set the edge list index into the poly face
-                polyFace->f.edgeIdValue [triangleEdgeCounter-1] = edgeIndexValue;
+                // Set the edge list index into the poly face (the edges of a triangle go 
+                // from the trifans root to the next two vertices and back to the root).
+                polyFace->f.edgeIdValue [triangleEdgeCounter-1] = *faceEdgeIndices++;
 
                 // Reset the edge counter, if we have all three edges of a triangle.
                 if ( triangleEdgeCounter == 3 ) 
                 {
                     triangleEdgeCounter = 0;
-                    --positionIndex;
 
                     // Handle the uv set infos.
                     setTrifansUVSetInfos ( mesh, primitiveElement, *polyFace, initialUVSetIndicesIndex, uvSetIndicesIndex );
@@ -1832,20 +1826,20 @@ namespace DAE2MA
 						}
 						//---------------------------------------------------------
 
-                        meshNode.startFace ( globalFaceIndex, endPosition ); 
+                        meshNode.startFace ( globalFaceIndex, endPosition, buffer ); 
                     }
 
                     // Write the polyFace data in the maya file.
-                    meshNode.appendFace ( *polyFace );
+                    meshNode.appendFace ( *polyFace, buffer );
 
 					//--- @Workaround for maya 2013 with single face geometries
 					if( duplicateSingleFaceWorkaround )
-						meshNode.appendFace ( *polyFace );
+						meshNode.appendFace ( *polyFace, buffer );
 					//---------------------------------------------------------
 
                     // End the block if necessary.
                     if ( duplicateSingleFaceWorkaround || globalFaceIndex == endPosition ) 
-                        meshNode.endFace (); 
+                        meshNode.endFace ( buffer ); 
 
                     // Increment the face index.
                     ++globalFaceIndex;
@@ -1855,10 +1849,6 @@ namespace DAE2MA
                 }
             }
 
-            // Increment the initial trifan position index for the next trifan object.
-            positionIndex += 2;
-            initialPositionIndex += vertexCount;
-
             // Get the next tristrips <p> element.
             uvSetIndicesIndex += 2;
             colorIndicesIndex += 2;
@@ -1869,28 +1859,19 @@ namespace DAE2MA
     void GeometryImporter::appendTristripsPolyFaces ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const int* faceEdgeIndices, 
         MayaDM::Mesh &meshNode,
         const size_t blockSize, 
         const size_t numGlobalFaces, 
         size_t& globalFaceIndex, 
         size_t& endPosition )
     {
-        // Get the position indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t initialPositionIndex=0;
-        size_t positionIndex=0;
+        // The faces are formatted into the output buffer.
+        Common::CharacterBuffer& buffer = *getDocumentImporter ()->getOutputBuffer ();
 
         size_t uvSetIndicesIndex = 0;
         size_t colorIndicesIndex = 0;
 
-        COLLADAFW::Edge edge;
-
         // Iterate over the grouped vertices and get the edges for every group.
         COLLADAFW::Tristrips* tristrips = (COLLADAFW::Tristrips*) primitiveElement;
         COLLADAFW::Tristrips::VertexCountArray& vertexCountArray = tristrips->getGroupedVerticesVertexCountArray ();
@@ -1934,22 +1915,8 @@ namespace DAE2MA
                 // Increment the current triangle edge counter, so we know if we have the full triangle.
                 ++triangleEdgeCounter;
 
-                // Get the start edge index
-                edgeStartVertexIdx = positionIndices[positionIndex];
-
-                // With the third edge of a triangle, we have to go back to the trifans root.
-                if ( triangleEdgeCounter < 3 )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[initialPositionIndex];
-
-                // Set the edge vertex index values into an edge object.
-                edge.setVertexIndices ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Variable for the current edge index.
-                int edgeIndexValue;
-
-                // Get the edge index value from the edge list.
-                getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
+                // The edge index of the current edge of the triangle.
+                int edgeIndexValue = *faceEdgeIndices++;
 
                 // Set the edge list index into the poly face
                 if ( changeDirection )
@@ -1972,8 +1939,6 @@ namespace DAE2MA
                 if ( triangleEdgeCounter == 3 ) 
                 {
                     triangleEdgeCounter = 0;
-                    --positionIndex;
-                    initialPositionIndex = positionIndex;
 
                     // Handle the uv set infos.
                     setTristripsUVSetInfos ( mesh, primitiveElement, *polyFace, uvSetIndicesIndex, changeDirection );
@@ -2003,20 +1968,20 @@ namespace DAE2MA
 						}
 						//---------------------------------------------------------
 
-                        meshNode.startFace ( globalFaceIndex, endPosition ); 
+                        meshNode.startFace ( globalFaceIndex, endPosition, buffer ); 
                     }
 
                     // Write the polyFace data in the maya file.
-                    meshNode.appendFace ( *polyFace );
+                    meshNode.appendFace ( *polyFace, buffer );
 
 					//--- @Workaround for maya 2013 with single face geometries
 					if( duplicateSingleFaceWorkaround )
-						meshNode.appendFace ( *polyFace );
+						meshNode.appendFace ( *polyFace, buffer );
 					//---------------------------------------------------------
 
                     // End the block if necessary.
                     if ( duplicateSingleFaceWorkaround || globalFaceIndex == endPosition ) 
-                        meshNode.endFace (); 
+                        meshNode.endFace ( buffer ); 
 
                     // Increment the face index.
                     ++globalFaceIndex;
@@ -2026,10 +1991,6 @@ namespace DAE2MA
                 }
             }
 
-            // Increment the initial tristrip position index for the next tristrip object.
-            positionIndex += 2;
-            initialPositionIndex = positionIndex;
-
             // Get the next tristrips <p> element.
             uvSetIndicesIndex += 2;
             colorIndicesIndex += 2;
@@ -2040,7 +2001,7 @@ namespace DAE2MA
     void GeometryImporter::setPolygonFaceInfos ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const int* faceEdgeIndices, 
         MayaDM::polyFaces &polyFace, 
         int& numEdges, 
         size_t& positionIndex, 
@@ -2053,23 +2014,12 @@ namespace DAE2MA
         // Get the position indices
         const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
 
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        COLLADAFW::Edge edge;
-
         // Go through the edges and determine the face values.
         for ( int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
         {
-            // Set the edge vertex index values into an edge object.
-            edgeStartVertexIdx = positionIndices[positionIndex];
-            edgeEndVertexIdx = 0;
-
-            if ( edgeIndex<(numEdges-1) )
-                edgeEndVertexIdx = positionIndices[++positionIndex];
-            else edgeEndVertexIdx = positionIndices[positionIndex-numEdges+1];
-
-            // Create the edge.
-            edge.setVertexIndices ( edgeStartVertexIdx, edgeEndVertexIdx );
+            // The start vertex of the current edge.
+            int edgeStartVertexIdx = positionIndices[positionIndex];
+            if ( edgeIndex<(numEdges-1) ) ++positionIndex;
 
             // Polygons with holes: Get the first three polygon vertices to determine 
             // the polygon's orientation.
@@ -2089,14 +2039,8 @@ namespace DAE2MA
                 polygonPoints.push_back ( getVertexPosition ( mesh, edgeStartVertexIdx ) );
             }
 
-            // Variable for the current edge index.
-            int edgeIndexValue;
-
-            // Get the edge index value from the edge list.
-            getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
-
             // Set the edge list index into the poly face
-            polyFace.f.edgeIdValue[edgeIndex] = edgeIndexValue;
+            polyFace.f.edgeIdValue[edgeIndex] = faceEdgeIndices[edgeIndex];
         }
 
         // Increment the positions index for the next face
@@ -2107,7 +2051,7 @@ namespace DAE2MA
     void GeometryImporter::setPolygonHoleInfos ( 
         const COLLADAFW::Mesh* mesh, 
         const COLLADAFW::MeshPrimitive* primitiveElement, 
-        const EdgeMap& edgeIndicesMap, 
+        const int* faceEdgeIndices, 
         MayaDM::polyFaces &polyFace, 
         int &numEdges, 
         size_t &positionIndex, 
@@ -2115,13 +2059,10 @@ namespace DAE2MA
     {
         // Get the position indices
         const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
 
         // Handle a hole element.
         numEdges *= -1;
 
-        COLLADAFW::Edge edge;
-
         // The orientation of a hole has always to be the opposite direction of his
         // parenting polygon. About this, we have to determine the hole's orientation.
         // We just need the first three vectors to determine the polygon's orientation.
@@ -2133,15 +2074,9 @@ namespace DAE2MA
         // Go through the edges and determine the face values.
         for ( int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
         {
-            // Set the edge vertex index values into an edge object.
-            edgeStartVertexIdx = positionIndices[positionIndex];
-            edgeEndVertexIdx = 0;
-            if ( edgeIndex<(numEdges-1) )
-                edgeEndVertexIdx = positionIndices[++positionIndex];
-            else edgeEndVertexIdx = positionIndices[positionIndex-numEdges+1];
-
-            // Create the edge.
-            edge.setVertexIndices ( edgeStartVertexIdx, edgeEndVertexIdx );
+            // The start vertex of the current edge.
+            int edgeStartVertexIdx = positionIndices[positionIndex];
+            if ( edgeIndex<(numEdges-1) ) ++positionIndex;
 
             // Polygons with holes: Get the first three polygon vertices to determine 
             // the polygon's orientation.
@@ -2151,14 +2086,8 @@ namespace DAE2MA
                 holePoints.push_back ( getVertexPosition ( mesh, edgeStartVertexIdx ) );
             }
 
-            // The current edge index.
-            int edgeIndexValue;
-
-            // Get the edge index value from the edge list.
-            getEdgeIndex ( edge, edgeIndicesMap, edgeIndexValue );
-
             // Set the edge list index into the poly face
-            polyFace.h.edgeIdValue[edgeIndex] = edgeIndexValue;
+            polyFace.h.edgeIdValue[edgeIndex] = faceEdgeIndices[edgeIndex];
         }
 
         // Check if we have to change the orientation of the current hole.
@@ -2612,298 +2541,6 @@ namespace DAE2MA
         }
     }
 
-    // --------------------------------------------
-    bool GeometryImporter::getEdgeIndex ( 
-        const COLLADAFW::Edge& edge, 
-        const EdgeMap& edgeIndicesMap, 
-        int& edgeIndex )
-    {
-        // Find the index of the edge in the map of edges to get the index in the list.
-        EdgeMap::const_iterator it = edgeIndicesMap.find ( edge );
-        if ( it == edgeIndicesMap.end() ) 
-        {
-            // The edge has to be in the map!
-            std::cerr << "Edge not found: " << edge[0] << ", " << edge[1] << std::endl;
-            return false;
-        }
-        edgeIndex = (int)it->second; 
-
-        // Revert it, if the order is different.
-        if ( edge.isReverse () ) 
-            edgeIndex = -( edgeIndex + 1 );
-
-        return true;
-    }
-
-    // --------------------------------------------
-    void GeometryImporter::getEdgeIndices ( 
-        const COLLADAFW::Mesh* mesh, 
-        EdgeList& edgeIndices, 
-        EdgeMap& edgeIndicesMap )
-    {
-        // Implementation for multiple primitive elements.
-        const COLLADAFW::MeshPrimitiveArray& primitiveElementsArray = mesh->getMeshPrimitives ();
-        size_t count = primitiveElementsArray.getCount ();
-        for ( size_t i=0; i<count; ++i )
-        {
-            const COLLADAFW::MeshPrimitive* primitiveElement = primitiveElementsArray [ i ];
-
-            // Determine the edge indices (unique edges, also for multiple primitive elements).
-            appendEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-        }
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        COLLADAFW::MeshPrimitive::PrimitiveType primitiveType = primitiveElement->getPrimitiveType ();
-        switch ( primitiveType )
-        {
-        case COLLADAFW::MeshPrimitive::TRIANGLE_FANS:
-            appendTrifansEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-            break;
-        case COLLADAFW::MeshPrimitive::TRIANGLE_STRIPS:
-            appendTristripsEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-            break;
-        case COLLADAFW::MeshPrimitive::POLYGONS:
-        case COLLADAFW::MeshPrimitive::POLYLIST:
-        case COLLADAFW::MeshPrimitive::TRIANGLES:
-            appendPolygonEdgeIndices ( primitiveElement, edgeIndices, edgeIndicesMap );
-            break;
-        default:
-            std::cerr << "Primitive type not implemented!" << std::endl;
-            COLLADABU_ASSERT ( "Primitive type not implemented!");
-        }
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendPolygonEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Get the number of grouped vertex elements (faces, holes, tristrips or trifans).
-        const size_t groupedVertexElementsCount = primitiveElement->getGroupedVertexElementsCount ();
-
-        // Get the position indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t positionIndex=0;
-
-        // TODO Possibility to be faster, if we preallocate the memory of the vector...
-//         // Iterate over the faces and count the edges of the current primitive element.
-//         int numPrimitiveEdges = 0;
-//         for ( size_t i=0; i<groupedVertexElementsCount; ++i )
-//         {
-//             // The number of edges is always the same
-//             // than the number of vertices in the current face.
-//             numPrimitiveEdges += primitiveElement->getGroupedVerticesVertexCount ( i );
-//         }
-// 
-//         // Get the current number of already written edges.
-//         size_t edgeIndicesIndex = 0;
-//         if ( edgeIndices.size () > 0 ) 
-//             edgeIndicesIndex = edgeIndices.size () - 1;
-// 
-//         // Preallocate the memory in the vector
-//         edgeIndices.reserve ( edgeIndices.size () + numPrimitiveEdges );
-
-        // The new generated edge.
-        COLLADAFW::Edge edge;
-
-        // Iterate over the faces and get the edges.
-        for ( size_t faceIndex=0; faceIndex<groupedVertexElementsCount; ++faceIndex )
-        {
-            // The number of edges is always the same
-            // than the number of vertices in the current face.
-            int numEdges = primitiveElement->getGroupedVerticesVertexCount ( faceIndex );
-
-            // Reverse for holes.
-            if ( numEdges < 0 ) numEdges *= -1;
-
-            // Go through the edges of the current face and determine the edge values.
-            for ( int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
-            {
-                // Set the edge vertex index values into an edge object.
-                edgeStartVertexIdx = positionIndices[positionIndex];
-
-                if ( edgeIndex<(numEdges-1) )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[positionIndex-numEdges+1];
-
-                // The order in an edge will be changed, if the endIndex is greater then the start index.
-                edge.setVertexIndices ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Appends the data of an edge to the edgeIndices list,
-                // if it is not already in the list.
-                appendEdge ( edge, edgeIndices, edgeIndicesMap );
-            }
-
-            // Increment the positions index for the next face, if it is a triangle or polygon.
-            // A trifan has the first edge of the next face always at the position of the last edge.
-            ++positionIndex;
-        }
-
-//         // Just reserve the really used memory.
-//         edgeIndices.reserve ( edgeIndices.size () );
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendEdge (
-        const COLLADAFW::Edge& edge,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Check if the current edge already exists in the map of edges.
-        EdgeMap::iterator it = edgeIndicesMap.find ( edge );
-        if ( it != edgeIndicesMap.end () ) return;
-
-        // Push the new edge into the map with it's index value.
-        edgeIndicesMap[edge] = edgeIndices.size ();
-
-        // Push the new edge into the vector of edge indices.
-        // We use it to write the list of edges into
-        // the maya file. The vector is already sorted.
-        edgeIndices.push_back ( edge );
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendTrifansEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Get the position indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t initialPositionIndex=0;
-        size_t positionIndex=0;
-
-        // Iterate over the grouped vertices and get the edges for every group.
-        COLLADAFW::Trifans* trifans = (COLLADAFW::Trifans*) primitiveElement;
-        COLLADAFW::Trifans::VertexCountArray& vertexCountArray = trifans->getGroupedVerticesVertexCountArray ();
-        size_t groupedVertexElementsCount = vertexCountArray.getCount ();
-        for ( size_t groupedVerticesIndex=0; groupedVerticesIndex<groupedVertexElementsCount; ++groupedVerticesIndex )
-        {
-            // A trifan has always triangles, which have 3 edges
-            size_t triangleEdgeCounter = 0;
-
-            // The number of vertices in the current vertex group.
-            unsigned int vertexCount = vertexCountArray [groupedVerticesIndex];
-
-            // Determine the number of edges and iterate over it.
-            unsigned int numEdges = ( vertexCount - 3 ) * 3 + 3;
-            for ( unsigned int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
-            {
-                // Increment the current triangle edge counter, so we know if we have the full triangle.
-                ++triangleEdgeCounter;
-
-                // Get the start edge index
-                if ( triangleEdgeCounter > 1 )
-                    edgeStartVertexIdx = positionIndices[positionIndex];
-                else edgeStartVertexIdx = positionIndices[initialPositionIndex];
-
-                // With the third edge of a triangle, we have to go back to the trifans root.
-                if ( triangleEdgeCounter < 3 )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[initialPositionIndex];
-
-                COLLADAFW::Edge edge ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Appends the data of an edge to the edgeIndices list,
-                // if it is not already in the list.
-                appendEdge ( edge, edgeIndices, edgeIndicesMap );
-
-                // Reset the edge counter, if we have all three edges of a triangle.
-                if ( triangleEdgeCounter == 3 )
-                {
-                    triangleEdgeCounter = 0;
-                    --positionIndex;
-                }
-            }
-
-            // Increment the initial trifan position index for the next trifan object.
-            initialPositionIndex += vertexCount;
-            positionIndex += 2;
-        }
-    }
-
-    //-----------------------------
-    void GeometryImporter::appendTristripsEdgeIndices (
-        const COLLADAFW::MeshPrimitive* primitiveElement,
-        EdgeList& edgeIndices,
-        EdgeMap& edgeIndicesMap )
-    {
-        // Get the position indices.
-        const COLLADAFW::UIntValuesArray& positionIndices = primitiveElement->getPositionIndices ();
-
-        // The points of an edge
-        int edgeStartVertexIdx=0, edgeEndVertexIdx=0;
-
-        // The current index in the positions list.
-        size_t initialPositionIndex=0;
-        size_t positionIndex=0;
-
-        // Iterate over the grouped vertices and get the edges for every group.
-        COLLADAFW::Tristrips* trifans = (COLLADAFW::Tristrips*) primitiveElement;
-        COLLADAFW::Tristrips::VertexCountArray& vertexCountArray =
-            trifans->getGroupedVerticesVertexCountArray ();
-        size_t groupedVertexElementsCount = vertexCountArray.getCount ();
-        for ( size_t groupedVerticesIndex=0; groupedVerticesIndex<groupedVertexElementsCount; ++groupedVerticesIndex )
-        {
-            // A trifan has always triangles, which have 3 edges
-            size_t triangleEdgeCounter = 0;
-
-            // The number of vertices in the current vertex group.
-            unsigned int vertexCount = vertexCountArray [groupedVerticesIndex];
-
-            // Determine the number of edges and iterate over it.
-            unsigned int numEdges = ( vertexCount - 3 ) * 3 + 3;
-            for ( unsigned int edgeIndex=0; edgeIndex<numEdges; ++edgeIndex )
-            {
-                // Increment the current triangle edge counter, so we know if we have the full triangle.
-                ++triangleEdgeCounter;
-
-                // Get the start edge index
-                edgeStartVertexIdx = positionIndices[positionIndex];
-
-                // With the third edge of a triangle, we have to go back to the trifans root.
-                if ( triangleEdgeCounter < 3 )
-                    edgeEndVertexIdx = positionIndices[++positionIndex];
-                else edgeEndVertexIdx = positionIndices[initialPositionIndex];
-
-                COLLADAFW::Edge edge ( edgeStartVertexIdx, edgeEndVertexIdx );
-
-                // Appends the data of an edge to the edgeIndices list,
-                // if it is not already in the list.
-                appendEdge ( edge, edgeIndices, edgeIndicesMap );
-
-                // Reset the edge counter, if we have all three edges of a triangle.
-                if ( triangleEdgeCounter == 3 )
-                {
-                    triangleEdgeCounter = 0;
-                    --positionIndex;
-                    initialPositionIndex = positionIndex;
-                }
-            }
-
-            // Increment the initial tristrip position index for the next tristrip object.
-            positionIndex += 2;
-            initialPositionIndex = positionIndex;
-        }
-    }
-
     // --------------------------------------------
     const std::vector<GeometryImporter::GeometryShadingEngine>* GeometryImporter::findGeomtryShadingEngines ( 
         const COLLADAFW::UniqueId& geometryId )
@@ -20,8 +20,10 @@ http://www.opensource.org/licenses/mit-license.php
 #include "COLLADAFWMeshPrimitive.h"
 #include "COLLADAFWArrayPrimitiveType.h"
 #include "COLLADAFWMeshVertexData.h"
+#include "COLLADAFWUniqueId.h"
+#include "COLLADAFWVertexWelder.h"
 
-#include <map>
+#include <vector>
 
 namespace COLLADAFW
 {
@@ -42,20 +44,26 @@ namespace DAE2Ogre
 			unsigned int normalIndex;
 			unsigned int textureIndex;
 			unsigned int colorIndex;
-			bool operator<(const Tuple& rhs) const;
 		};
 
+		/** The number of indices of a tuple.*/
+		static const size_t TUPLE_INDEX_COUNT = 4;
+
+		/** The number of indices of a streamed mesh primitive, after which its current sub mesh is written.
+		Limits the memory used for the indices and welded vertices of huge mesh primitives.*/
+		static const size_t STREAMED_SUB_MESH_INDEX_COUNT = 3 * 1024 * 1024;
+
 		typedef COLLADAFW::ArrayPrimitiveType<float> FloatList;
 		typedef COLLADAFW::ArrayPrimitiveType<double> DoubleList;
 		typedef COLLADAFW::ArrayPrimitiveType<int> IntList;
 		typedef COLLADAFW::ArrayPrimitiveType<unsigned int> UIntList;
-		typedef std::map<Tuple, int> TupleIndexMap;
 		typedef std::vector<String> StringList;
 
 	private:
 		const COLLADAFW::Mesh* mMesh;
-		TupleIndexMap mTupleMap;
-		int mNextTupleIndex;
+		/** Merges equal tuples of the current sub mesh. The vertices of the welder are the tuples, in the
+		order of their ogre vertex index.*/
+		COLLADAFW::VertexWelder mVertexWelder;
 		size_t mMeshSize;
 		size_t mSubmeshCount;
 		size_t mSubmeshNameTableSize;
@@ -86,6 +94,17 @@ namespace DAE2Ogre
 	
 		StringList mSubMeshNames;
 
+		/** Position of the mesh chunk header, overwritten with the mesh size when writing is finished.*/
+		fpos_t mMeshChunkPos;
+
+		/** Unique id and type of the mesh primitive that is currently streamed.*/
+		COLLADAFW::UniqueId mStreamedMeshPrimitiveId;
+		COLLADAFW::MeshPrimitive::PrimitiveType mStreamedPrimitiveType;
+
+		/** True, if blocks have been added to the current sub mesh of the streamed mesh primitive since
+		it has been written.*/
+		bool mHasStreamedSubMesh;
+
 	public:
 
         /** Constructor. */
@@ -96,6 +115,20 @@ namespace DAE2Ogre
 
 		bool write();
 
+		/** Opens the output file and writes the file header. Used instead of write(), if the mesh is
+		streamed.*/
+		bool startWriting();
+
+		/** Adds the faces of one block of a streamed mesh primitive. The sub meshes of a mesh primitive are
+		written, when the first block of the next mesh primitive or the end of the mesh is reached, or when
+		they contain STREAMED_SUB_MESH_INDEX_COUNT indices. Huge mesh primitives are therefore split into
+		several sub meshes.*/
+		bool writeMeshPrimitiveBlock( const COLLADAFW::MeshPrimitive* meshPrimitive );
+
+		/** Writes the sub meshes of the last streamed mesh primitive and the mesh information and closes
+		the output file.*/
+		bool finishWriting();
+
 	private:
 
         /** Disable default copy ctor. */
@@ -104,9 +137,19 @@ namespace DAE2Ogre
         /** Disable default assignment operator. */
 		const MeshWriter& operator= ( const MeshWriter& pre );
 	
-		void writeSubMesh(COLLADAFW::MeshPrimitive* meshPrimitive, const COLLADABU::Math::Matrix4& matrix);
+		/** Adds the indices of @a meshPrimitive to the current sub mesh, merging equal vertices.*/
+		void addSubMeshIndices( const COLLADAFW::MeshPrimitive* meshPrimitive );
+
+		/** Writes the current sub mesh, transformed by @a matrix.*/
+		void writeSubMesh( COLLADAFW::MeshPrimitive::PrimitiveType primitiveType, const COLLADABU::Math::Matrix4& matrix );
+
+		/** Removes all indices and vertices from the current sub mesh.*/
+		void clearSubMesh();
+
+		/** Writes the current sub mesh once for each instance of the mesh.*/
+		void writeSubMeshInstances( COLLADAFW::MeshPrimitive::PrimitiveType primitiveType );
 
-		void addTupleIndex( const Tuple& tuple);
+		void addTupleVertex( const Tuple& tuple );
 
 		void writeGeometry( );
 		size_t getVertexSizeInByte() const;
@@ -13,7 +13,7 @@ http://www.opensource.org/licenses/mit-license.php
 
 #include "DAE2OgrePrerequisites.h"
 
-#include "COLLADAFWIWriter.h"
+#include "COLLADAFWIStreamingWriter.h"
 #include "COLLADAFWUniqueId.h"
 #include "COLLADAFWVisualScene.h"
 #include "COLLADAFWLibraryNodes.h"
@@ -32,8 +32,9 @@ namespace DAE2Ogre
 {
 
 	class BaseWriter;
+	class MeshWriter;
 
-	class OgreWriter : public COLLADAFW::IWriter
+	class OgreWriter : public COLLADAFW::IStreamingWriter
 	{
 	public:
 		enum Runs
@@ -84,6 +85,9 @@ namespace DAE2Ogre
 		UniqueIdFWMaterialMap mUniqueIdFWMaterialMap;
 		UniqueIdFWImageMap mUniqueIdFWImageMap;
 		UniqueIdFWEffectMap mUniqueIdFWEffectMap;
+
+		/** The writer of the mesh that is currently streamed, 0 if no mesh is streamed.*/
+		MeshWriter* mStreamedMeshWriter;
 	
 	public:
 		OgreWriter( const COLLADABU::URI& inputFile, const COLLADABU::URI& outputFile );
@@ -172,6 +176,18 @@ namespace DAE2Ogre
 		@return The writer should return true, if writing succeeded, false otherwise.*/
 		virtual bool writeKinematicsScene( const COLLADAFW::KinematicsScene* kinematicsScene ){return true;};
 
+		/** Starts to write a mesh in blocks, during the geometry run.
+		@return True, if the mesh should be streamed, false otherwise.*/
+		virtual bool startMesh( const COLLADAFW::Mesh* mesh );
+
+		/** Writes the next block of a mesh primitive of the streamed mesh.
+		@return True on succeeded, false otherwise.*/
+		virtual bool writeMeshPrimitive( const COLLADAFW::Mesh* mesh, const COLLADAFW::MeshPrimitive* meshPrimitive );
+
+		/** Finishes writing the streamed mesh.
+		@return True on succeeded, false otherwise.*/
+		virtual bool finishMesh( const COLLADAFW::Mesh* mesh );
+
 
 	
 	protected:
@@ -35,7 +35,7 @@ namespace DAE2Ogre
 	MeshWriter::MeshWriter( OgreWriter* ogreWriter, const COLLADAFW::Mesh* mesh )
 		: BaseWriter(ogreWriter)
 		, mMesh(mesh)
-		, mNextTupleIndex(0)
+		, mVertexWelder(TUPLE_INDEX_COUNT)
 		, mMeshSize(0)
 		, mSubmeshCount(0)
 		, mSubmeshNameTableSize(STREAM_OVERHEAD_SIZE)
@@ -51,6 +51,8 @@ namespace DAE2Ogre
 	    , mOgreUVCoordinates(FloatList::RELEASE_MEMORY)
 	    , mOgreColors(FloatList::RELEASE_MEMORY)
 	    , mOgreIndices(IntList::RELEASE_MEMORY)
+		, mStreamedPrimitiveType( COLLADAFW::MeshPrimitive::UNDEFINED_PRIMITIVE_TYPE )
+		, mHasStreamedSubMesh( false )
 	{
 		 mVersion = "[MeshSerializer_v1.30]";
 		 calcMeshSize();
@@ -68,38 +70,37 @@ namespace DAE2Ogre
 	}
 
 	//------------------------------
-	bool MeshWriter::Tuple::operator<( const Tuple& rhs ) const
+	bool MeshWriter::write()
 	{
-		if ( positionIndex < rhs.positionIndex )
-			return true;
-
-		if ( positionIndex > rhs.positionIndex )
+		if ( !startWriting() )
 			return false;
 
-		if ( normalIndex < rhs.normalIndex )
-			return true;
-
-		if ( normalIndex > rhs.normalIndex )
-			return false;
+		const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mMesh->getMeshPrimitives();
 
-		if ( textureIndex < rhs.textureIndex )
-			return true;
-
-		if ( textureIndex > rhs.textureIndex )
-			return false;
+		const COLLADAFW::UniqueId& meshUniqueId = mMesh->getUniqueId();
+		const OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap& instanceGeometryMap = getGeometryUniqueIdInstanceGeometryInfoMap();
+		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator lowerBound = instanceGeometryMap.lower_bound(meshUniqueId);
+		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator upperBound = instanceGeometryMap.upper_bound(meshUniqueId);
 
-		if ( colorIndex < rhs.colorIndex )
-			return true;
+		for ( OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator it = lowerBound; it != upperBound; ++it)
+		{
+			const OgreWriter::InstanceGeometryInfo& instanceGeometryInfo = it->second;
+			const COLLADABU::Math::Matrix4& worldMatrix = instanceGeometryInfo.worldMatrix;
 
-		if ( colorIndex > rhs.colorIndex )
-			return false;
+			for ( size_t i = 0, count = meshPrimitives.getCount(); i < count; ++i )
+			{
+				COLLADAFW::MeshPrimitive* meshPrimitive = meshPrimitives[i];
+				addSubMeshIndices(meshPrimitive);
+				writeSubMesh(meshPrimitive->getPrimitiveType(), worldMatrix);
+				clearSubMesh();
+			}
+		}
 
-		return false;
+		return finishWriting();
 	}
 
-
 	//------------------------------
-	bool MeshWriter::write()
+	bool MeshWriter::startWriting()
 	{
 		determineEndianness( ENDIAN_NATIVE );
 
@@ -117,7 +118,7 @@ namespace DAE2Ogre
 
 		// Since we do not know the mesh size at this point, we write 0 and overwirte the size in the file 
 		// later
-		fpos_t filePos = getPos();
+		mMeshChunkPos = getPos();
 		writeChunkHeader( Ogre::M_MESH, 0 );
 
 		// bool skeletallyAnimated
@@ -126,28 +127,50 @@ namespace DAE2Ogre
 		writeBools( &skelAnim, 1 );
 		// Decide on endian mode
 
-		const COLLADAFW::UniqueId& meshUniqueId = mMesh->getUniqueId();
-		const OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap& instanceGeometryMap = getGeometryUniqueIdInstanceGeometryInfoMap();
-		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator lowerBound = instanceGeometryMap.lower_bound(meshUniqueId);
-		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator upperBound = instanceGeometryMap.upper_bound(meshUniqueId);
+		return true;
+	}
 
-		for ( OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator it = lowerBound; it != upperBound; ++it)
+	//------------------------------
+	bool MeshWriter::writeMeshPrimitiveBlock( const COLLADAFW::MeshPrimitive* meshPrimitive )
+	{
+		if ( meshPrimitive->getUniqueId() != mStreamedMeshPrimitiveId )
 		{
-			const OgreWriter::InstanceGeometryInfo& instanceGeometryInfo = it->second;
-			const COLLADABU::Math::Matrix4& worldMatrix = instanceGeometryInfo.worldMatrix;
-			const COLLADAFW::MeshPrimitiveArray& meshPrimitives = mMesh->getMeshPrimitives();
-			const COLLADAFW::InstanceGeometry* instanceGeometry = instanceGeometryInfo.fwInstanceGeometry;
-
-			worldMatrix.extract3x3Matrix(mCurrentRotationMatrix );
-			mCurrentTranslationVector.set(worldMatrix[0][3], worldMatrix[1][3], worldMatrix[2][3]);
-			
-			for ( size_t i = 0, count = meshPrimitives.getCount(); i < count; ++i )
+			if ( mHasStreamedSubMesh )
 			{
-				COLLADAFW::MeshPrimitive* meshPrimitive = meshPrimitives[i];
-				writeSubMesh(meshPrimitive, worldMatrix);
+				writeSubMeshInstances( mStreamedPrimitiveType );
+				clearSubMesh();
 			}
+			mStreamedMeshPrimitiveId = meshPrimitive->getUniqueId();
+			mStreamedPrimitiveType = meshPrimitive->getPrimitiveType();
 		}
 
+		// Indices are only collected for meshes that are instantiated
+		const OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap& instanceGeometryMap = getGeometryUniqueIdInstanceGeometryInfoMap();
+		if ( instanceGeometryMap.find(mMesh->getUniqueId()) != instanceGeometryMap.end() )
+		{
+			addSubMeshIndices(meshPrimitive);
+		}
+		mHasStreamedSubMesh = true;
+
+		// A block contains complete faces only, i.e. the sub mesh can be written between two blocks
+		if ( mOgreIndices.getCount() >= STREAMED_SUB_MESH_INDEX_COUNT )
+		{
+			writeSubMeshInstances( mStreamedPrimitiveType );
+			clearSubMesh();
+		}
+		return true;
+	}
+
+	//------------------------------
+	bool MeshWriter::finishWriting()
+	{
+		if ( mHasStreamedSubMesh )
+		{
+			writeSubMeshInstances( mStreamedPrimitiveType );
+			clearSubMesh();
+		}
+		mStreamedMeshPrimitiveId = COLLADAFW::UniqueId::INVALID;
+
 		// Write bounds information
 		writeBoundsInfo( );
 
@@ -157,13 +180,27 @@ namespace DAE2Ogre
 		mMeshSize += mSubmeshNameTableSize;
 
 
-		setPos( filePos );
+		setPos( mMeshChunkPos );
 		writeChunkHeader( Ogre::M_MESH, mMeshSize );
 		
 		fclose( mpfFile );
 		return true;
 	}
 
+	//------------------------------
+	void MeshWriter::writeSubMeshInstances( COLLADAFW::MeshPrimitive::PrimitiveType primitiveType )
+	{
+		const COLLADAFW::UniqueId& meshUniqueId = mMesh->getUniqueId();
+		const OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap& instanceGeometryMap = getGeometryUniqueIdInstanceGeometryInfoMap();
+		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator lowerBound = instanceGeometryMap.lower_bound(meshUniqueId);
+		OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator upperBound = instanceGeometryMap.upper_bound(meshUniqueId);
+
+		for ( OgreWriter::GeometryUniqueIdInstanceGeometryInfoMap::const_iterator it = lowerBound; it != upperBound; ++it)
+		{
+			writeSubMesh(primitiveType, it->second.worldMatrix);
+		}
+	}
+
 	//-----------------------------------------------------------------------
 	void MeshWriter::writeSubMeshNameTable( )
 	{
@@ -225,94 +262,77 @@ namespace DAE2Ogre
 	}
 
 	//------------------------------
-	void MeshWriter::addTupleIndex( const Tuple& tuple )
+	void MeshWriter::addTupleVertex( const Tuple& tuple )
 	{
-		TupleIndexMap::const_iterator it = mTupleMap.find(tuple);
-		if ( it == mTupleMap.end() )
+		if ( mMeshPositions.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
+		{
+			const double* positionsArray = mMeshPositions.getDoubleValues()->getData();
+			positionsArray += 3*tuple.positionIndex;
+			COLLADABU::Math::Vector3 position(positionsArray[0], positionsArray[1], positionsArray[2]);
+			position = mCurrentRotationMatrix * position + mCurrentTranslationVector;
+			mOgrPositions.append((float)position.x);
+			mOgrPositions.append((float)position.y);
+			mOgrPositions.append((float)position.z);
+		}
+		else
 		{
-			mOgreIndices.append( mTupleMap[tuple] = mNextTupleIndex++ );
+			const float* positionsArray = mMeshPositions.getFloatValues()->getData();
+			positionsArray += 3*tuple.positionIndex;
+			COLLADABU::Math::Vector3 position(positionsArray[0], positionsArray[1], positionsArray[2]);
+			position = mCurrentRotationMatrix * position + mCurrentTranslationVector;
+			mOgrPositions.append((float)position.x);
+			mOgrPositions.append((float)position.y);
+			mOgrPositions.append((float)position.z);
+		}
 
-			if ( mMeshPositions.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
+		if ( mHasNormals )
+		{
+			if ( mMeshNormals.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
 			{
-				const double* positionsArray = mMeshPositions.getDoubleValues()->getData();
-				positionsArray += 3*tuple.positionIndex;
-				COLLADABU::Math::Vector3 position(positionsArray[0], positionsArray[1], positionsArray[2]);
-				position = mCurrentRotationMatrix * position + mCurrentTranslationVector;
-				mOgrPositions.append((float)position.x);
-				mOgrPositions.append((float)position.y);
-				mOgrPositions.append((float)position.z);
+				const double* normalsArray = mMeshNormals.getDoubleValues()->getData();
+				normalsArray += 3*tuple.normalIndex;
+				COLLADABU::Math::Vector3 normal(normalsArray[0], normalsArray[1], normalsArray[2]);
+				normal = mCurrentRotationMatrix * normal;
+				normal.normalise();
+				mOgreNormals.append((float)normal.x);
+				mOgreNormals.append((float)normal.y);
+				mOgreNormals.append((float)normal.z);
 			}
 			else
 			{
-				const float* positionsArray = mMeshPositions.getFloatValues()->getData();
-				positionsArray += 3*tuple.positionIndex;
-				COLLADABU::Math::Vector3 position(positionsArray[0], positionsArray[1], positionsArray[2]);
-				position = mCurrentRotationMatrix * position + mCurrentTranslationVector;
-				mOgrPositions.append((float)position.x);
-				mOgrPositions.append((float)position.y);
-				mOgrPositions.append((float)position.z);
+				const float* normalsArray = mMeshNormals.getFloatValues()->getData();
+				normalsArray += 3*tuple.normalIndex;
+				COLLADABU::Math::Vector3 normal(normalsArray[0], normalsArray[1], normalsArray[2]);
+				normal = mCurrentRotationMatrix * normal;
+				normal.normalise();
+				mOgreNormals.append((float)normal.x);
+				mOgreNormals.append((float)normal.y);
+				mOgreNormals.append((float)normal.z);
 			}
+		}
 
-			if ( mHasNormals )
+		if ( mHasUVCoords )
+		{
+			if ( mMeshUVCoordinates.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
 			{
-				if ( mMeshNormals.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
-				{
-					const double* normalsArray = mMeshNormals.getDoubleValues()->getData();
-					normalsArray += 3*tuple.normalIndex;
-					COLLADABU::Math::Vector3 normal(normalsArray[0], normalsArray[1], normalsArray[2]);
-					normal = mCurrentRotationMatrix * normal;
-					normal.normalise();
-					mOgreNormals.append((float)normal.x);
-					mOgreNormals.append((float)normal.y);
-					mOgreNormals.append((float)normal.z);
-				}
-				else
-				{
-					const float* normalsArray = mMeshNormals.getFloatValues()->getData();
-					normalsArray += 3*tuple.normalIndex;
-					COLLADABU::Math::Vector3 normal(normalsArray[0], normalsArray[1], normalsArray[2]);
-					normal = mCurrentRotationMatrix * normal;
-					normal.normalise();
-					mOgreNormals.append((float)normal.x);
-					mOgreNormals.append((float)normal.y);
-					mOgreNormals.append((float)normal.z);
-				}
+				const double* uVCoordinateArray = mMeshUVCoordinates.getDoubleValues()->getData();
+				uVCoordinateArray += mMeshUVCoordinates.getStride(0)*tuple.textureIndex;
+				mOgreUVCoordinates.append((float)uVCoordinateArray[0]);
+				mOgreUVCoordinates.append((float)uVCoordinateArray[1]);
 			}
-
-			if ( mHasUVCoords )
+			else
 			{
-				if ( mMeshUVCoordinates.getType() == COLLADAFW::MeshVertexData::DATA_TYPE_DOUBLE )
-				{
-					const double* uVCoordinateArray = mMeshUVCoordinates.getDoubleValues()->getData();
-					uVCoordinateArray += mMeshUVCoordinates.getStride(0)*tuple.textureIndex;
-					mOgreUVCoordinates.append((float)uVCoordinateArray[0]);
-					mOgreUVCoordinates.append((float)uVCoordinateArray[1]);
-				}
-				else
-				{
-					const float* uVCoordinateArray = mMeshUVCoordinates.getFloatValues()->getData();
-					uVCoordinateArray += mMeshUVCoordinates.getStride(0)*tuple.textureIndex;
-					mOgreUVCoordinates.append((float)uVCoordinateArray[0]);
-					mOgreUVCoordinates.append((float)uVCoordinateArray[1]);
-				}
+				const float* uVCoordinateArray = mMeshUVCoordinates.getFloatValues()->getData();
+				uVCoordinateArray += mMeshUVCoordinates.getStride(0)*tuple.textureIndex;
+				mOgreUVCoordinates.append((float)uVCoordinateArray[0]);
+				mOgreUVCoordinates.append((float)uVCoordinateArray[1]);
 			}
-
-		}
-		else
-		{
-			mOgreIndices.append(it->second);
 		}
 	}
 
 	//------------------------------
-	void MeshWriter::writeSubMesh( COLLADAFW::MeshPrimitive* meshPrimitive, const COLLADABU::Math::Matrix4& matrix )
+	void MeshWriter::addSubMeshIndices( const COLLADAFW::MeshPrimitive* meshPrimitive )
 	{
-		mSubmeshCount++;
-		String subMeshName = "subMesh" + COLLADABU::Utils::toString(mSubmeshCount);
-		mSubMeshNames.push_back( subMeshName );		
-
-		int numIndices = 0;
-
 		const COLLADAFW::UIntValuesArray& positionIndices =  meshPrimitive->getPositionIndices();
 		size_t positionIndicesCount  = positionIndices.getCount();
 
@@ -343,29 +363,43 @@ namespace DAE2Ogre
 		{
 		case COLLADAFW::MeshPrimitive::TRIANGLES:
 			{
-				const COLLADAFW::Triangles* triangles = (const COLLADAFW::Triangles*) meshPrimitive;
-				numIndices = (int)positionIndicesCount;
-
-				for ( int j = 0; j < numIndices; ++j )
+				// the index lists in the order of the tuple members, missing lists are zero
+				const unsigned int* indexLists[TUPLE_INDEX_COUNT] =
 				{
-					unsigned int positionIndex = positionIndices[j];
-
-					unsigned int normalIndex = 0;
-					if ( mHasNormals )
-						normalIndex = normalIndices[j];
-
-					unsigned int uvIndex = 0;
-					if ( mHasUVCoords )
-						uvIndex = (*uvIndices)[j];
-
-					Tuple tuple( positionIndex, normalIndex, uvIndex, 0);
-					addTupleIndex(tuple);
-				}
+					positionIndices.getData(),
+					mHasNormals ? normalIndices.getData() : 0,
+					mHasUVCoords ? uvIndices->getData() : 0,
+					0
+				};
+
+				size_t indexCount = mOgreIndices.getCount();
+				mOgreIndices.reallocMemory( indexCount + positionIndicesCount );
+				mVertexWelder.addVertices( indexLists, positionIndicesCount, mOgreIndices.getData() + indexCount );
+				mOgreIndices.setCount( indexCount + positionIndicesCount );
 			}
 			break;
 		default:
 			break;
 		}
+	}
+
+	//------------------------------
+	void MeshWriter::writeSubMesh( COLLADAFW::MeshPrimitive::PrimitiveType primitiveType, const COLLADABU::Math::Matrix4& matrix )
+	{
+		matrix.extract3x3Matrix(mCurrentRotationMatrix );
+		mCurrentTranslationVector.set(matrix[0][3], matrix[1][3], matrix[2][3]);
+
+		for ( size_t i = 0, count = mVertexWelder.getVertexCount(); i < count; ++i )
+		{
+			const unsigned int* indices = mVertexWelder.getVertexIndices(i);
+			addTupleVertex( Tuple(indices[0], indices[1], indices[2], indices[3]) );
+		}
+
+		mSubmeshCount++;
+		String subMeshName = "subMesh" + COLLADABU::Utils::toString(mSubmeshCount);
+		mSubMeshNames.push_back( subMeshName );		
+
+		int numIndices = (int)mOgreIndices.getCount();
 
 		// Header
 		size_t subMeshSize = calcSubMeshSize( numIndices, subMeshName );
@@ -393,22 +427,25 @@ namespace DAE2Ogre
 		const uint32* pIdx32 = mOgreIndices.getData();
 		writeInts( pIdx32, numIndices );
 
-		int& vertexCount = mNextTupleIndex;
-
 		// M_GEOMETRY stream (Optional: present only if useSharedVertices = false)
 		writeGeometry( );
 
-		writeSubMeshOperation( meshPrimitive->getPrimitiveType() );
+		writeSubMeshOperation( primitiveType );
 
 		calculateMeshBounds();
 
-		mNextTupleIndex = 0;
 		mOgrPositions.clear();
 		mOgreNormals.clear();
 		mOgreUVCoordinates.clear();
 		mOgreColors.clear();
+	}
+
+	//------------------------------
+	void MeshWriter::clearSubMesh()
+	{
 		mOgreIndices.clear();
-		mTupleMap.clear();
+		mVertexWelder.clear();
+		mHasStreamedSubMesh = false;
 	}
 
 	//-----------------------------------------------------------------------
@@ -427,7 +464,7 @@ namespace DAE2Ogre
 	//-----------------------------------------------------------------------
 	void MeshWriter::writeGeometry( )
 	{
-		int vertexCount = mNextTupleIndex;
+		int vertexCount = (int)mVertexWelder.getVertexCount();
 		// calc size
 
 		// base
@@ -571,7 +608,7 @@ namespace DAE2Ogre
 		// no support for color yet
 		const double * colors = 0;
 		const double * uvcoordinates = mOgreUVCoordinates.getData();
-		size_t vertexCount = (size_t)mNextTupleIndex;
+		size_t vertexCount = mVertexWelder.getVertexCount();
 
 		for ( size_t v = 0; v < vertexCount; ++v )
 		{
@@ -608,7 +645,7 @@ namespace DAE2Ogre
 	//-----------------------------------------------------------------------
 	size_t MeshWriter::calcSubMeshSize( int numIndices, const String& submeshName )
 	{
-		int vertexCount = mNextTupleIndex;
+		int vertexCount = (int)mVertexWelder.getVertexCount();
 
 		size_t size = STREAM_OVERHEAD_SIZE;
 
@@ -35,6 +35,7 @@ namespace DAE2Ogre
 		, mOutputFile(outputFile)
 		, mCurrentRun(SCENEGRAPH_RUN)
 	, mVisualScene(0)
+		, mStreamedMeshWriter(0)
 	{
 	}
 
@@ -42,6 +43,7 @@ namespace DAE2Ogre
 	OgreWriter::~OgreWriter()
 	{
 		delete mVisualScene;
+		delete mStreamedMeshWriter;
 	}
 
 	//--------------------------------------------------------------------
@@ -71,6 +73,9 @@ namespace DAE2Ogre
 		COLLADASaxFWL::Loader loader;
 		COLLADAFW::Root root(&loader, this);
 
+		// Record the byte ranges of the libraries, to skip all but the geometries in the second run
+		loader.setSectionIndexing(true);
+
 		// Load scene graph 
 		if ( !root.loadDocument(mInputFile.toNativePath()) )
 			return false;
@@ -84,6 +89,7 @@ namespace DAE2Ogre
 
 		// load and write geometries
 		mCurrentRun = GEOMETRY_RUN;
+		loader.setObjectFlags( COLLADASaxFWL::Loader::GEOMETRY_FLAG );
 		if ( !root.loadDocument(mInputFile.toNativePath()) )
 			return false;
 
@@ -154,6 +160,43 @@ namespace DAE2Ogre
 		return meshWriter.write();
 	}
 
+	//--------------------------------------------------------------------
+	bool OgreWriter::startMesh( const COLLADAFW::Mesh* mesh )
+	{
+		if ( mCurrentRun != GEOMETRY_RUN )
+			return false;
+
+		delete mStreamedMeshWriter;
+		mStreamedMeshWriter = new MeshWriter( this, mesh );
+		if ( !mStreamedMeshWriter->startWriting() )
+		{
+			// the mesh is passed to writeGeometry, which reports the failure
+			delete mStreamedMeshWriter;
+			mStreamedMeshWriter = 0;
+			return false;
+		}
+		return true;
+	}
+
+	//--------------------------------------------------------------------
+	bool OgreWriter::writeMeshPrimitive( const COLLADAFW::Mesh* mesh, const COLLADAFW::MeshPrimitive* meshPrimitive )
+	{
+		if ( !mStreamedMeshWriter )
+			return true;
+		return mStreamedMeshWriter->writeMeshPrimitiveBlock( meshPrimitive );
+	}
+
+	//--------------------------------------------------------------------
+	bool OgreWriter::finishMesh( const COLLADAFW::Mesh* mesh )
+	{
+		if ( !mStreamedMeshWriter )
+			return true;
+		bool success = mStreamedMeshWriter->finishWriting();
+		delete mStreamedMeshWriter;
+		mStreamedMeshWriter = 0;
+		return success;
+	}
+
 	//--------------------------------------------------------------------
 	bool OgreWriter::writeMaterial( const COLLADAFW::Material* material )
 	{
@@ -17,6 +17,12 @@ public class Constants {
 
     public static final String DEFAULT_XSD_TYPE = "string";
 
+    public static final String ELEMENT_FUNCTION_DISPLACEMENTS_CPP_CONSTANT = "ELEMENT_FUNCTION_DISPLACEMENTS";
+
+    public static final String ELEMENT_FUNCTION_ENTRIES_CPP_CONSTANT = "ELEMENT_FUNCTION_ENTRIES";
+
+    public static final String ELEMENT_FUNCTION_TABLE_CPP_CONSTANT = "ELEMENT_FUNCTION_TABLE";
+
     public static final String ENUM_CPP_BASE_TYPE_FOR_STRINGS = "StringHash";
 
     public static final String STATE_MACHINE_END_CPP_CONSTANT = "STATE_MACHINE_END";
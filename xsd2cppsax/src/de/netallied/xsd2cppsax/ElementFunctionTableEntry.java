@@ -0,0 +1,28 @@
+/**
+ *   Copyright &copy; 2008-2012 NetAllied Systems GmbH, Ravensburg, Germany. 
+ *       
+ *   Licensed under the MIT Open Source License, 
+ *   for details please see LICENSE file or the website
+ *   http://www.opensource.org/licenses/mit-license.php
+*/
+package de.netallied.xsd2cppsax;
+
+/**
+ * Data of an entry in the generated C++ element function table.
+ * 
+ */
+public class ElementFunctionTableEntry {
+
+    public String cppElementName;
+
+    public String hashID;
+
+    public String namespaceHashID;
+
+    public ElementFunctionTableEntry(String hashID, String namespaceHashID, String cppElementName) {
+        super();
+        this.hashID = hashID;
+        this.namespaceHashID = namespaceHashID;
+        this.cppElementName = cppElementName;
+    }
+}
@@ -124,6 +124,13 @@ public class FunctionMapFactoryPrinter extends AbstractStackBasedTraverser {
         return "const " + createMapType() + "&";
     }
 
+    /**
+     * @return C++ name of variable containing element hashes of function map.
+     */
+    protected String createHashesVariableName() {
+        return "elementHashes";
+    }
+
     /**
      * @return C++ name of function map variable.
      */
@@ -182,26 +189,35 @@ public class FunctionMapFactoryPrinter extends AbstractStackBasedTraverser {
         sourceFile.print(createMapTypeForMethodDecl() + " ");
         sourceFile.print(config.getClassNameFunctionMapFactory() + "::");
         sourceFile.println(createFunctionName() + "() {");
-        sourceFile.println("static " + createMapType() + " " + createMapVariableName() + ";");
-        sourceFile.println("static bool mapFilled = false;");
-        sourceFile.println("if ( !mapFilled )");
-        sourceFile.println("{");
+        sourceFile.println("static const StringHash " + createHashesVariableName() + "[] = {");
 
         printMapEntriesForAncestors(element);
 
         handledChildren.add(element);
-        Util.printFunctionMapEntry(createMapVariableName(), Util.createElementNameHashIdentifier(startElementCppName),
-                startElementCppName, sourceFile, config, true);
+        printMapEntry(startElementCppName);
 
         printMapEntriesForChildren(element, 1);
 
-        sourceFile.println("mapFilled = true;");
-        sourceFile.println("}");
+        sourceFile.println("};");
+        String hashes = createHashesVariableName();
+        sourceFile.println("static const " + createMapType() + " " + createMapVariableName() + "("
+                + config.getClassNamePrivate() + "::" + Constants.ELEMENT_FUNCTION_TABLE_CPP_CONSTANT + ", " + hashes
+                + ", sizeof(" + hashes + ") / sizeof(" + hashes + "[0]));");
         sourceFile.println("return " + createMapVariableName() + ";");
         sourceFile.println("}");
         sourceFile.println();
     }
 
+    /**
+     * Prints element hash of function map entry.
+     * 
+     * @param cppName
+     *            C++ element name.
+     */
+    protected void printMapEntry(String cppName) {
+        sourceFile.println(Util.createElementNameHashIdentifier(cppName) + ",");
+    }
+
     /**
      * Prints map entries for ancestors of given element.
      * 
@@ -213,9 +229,7 @@ public class FunctionMapFactoryPrinter extends AbstractStackBasedTraverser {
 
         for (XSElementDeclaration ancestor : sortedAncestors) {
             handledChildren.add(ancestor);
-            String cppName = elementNameMapping.get(ancestor).cppElementName;
-            Util.printFunctionMapEntry(createMapVariableName(), Util.createElementNameHashIdentifier(cppName), cppName,
-                    sourceFile, config, true);
+            printMapEntry(elementNameMapping.get(ancestor).cppElementName);
         }
     }
 
@@ -235,9 +249,7 @@ public class FunctionMapFactoryPrinter extends AbstractStackBasedTraverser {
         if (children != null) {
             for (XSElementDeclaration child : children) {
                 if (!handledChildren.contains(child)) {
-                    String cppName = elementNameMapping.get(child).cppElementName;
-                    Util.printFunctionMapEntry(createMapVariableName(), Util.createElementNameHashIdentifier(cppName),
-                            cppName, sourceFile, config, true);
+                    printMapEntry(elementNameMapping.get(child).cppElementName);
                 }
             }
             if (maxDepth == -1 || depth < maxDepth) {
@@ -13,6 +13,7 @@ import java.util.ArrayList;
 import java.util.Collections;
 import java.util.HashMap;
 import java.util.HashSet;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Set;
@@ -109,6 +110,16 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
     /** Generated C++ source file containing function map. */
     private PrintStream functionMapFile;
 
+    /**
+     * Entries of C++ element function table. Key: value of element hash
+     * constant. Elements with equal hash values replace each other, like in a
+     * map.
+     */
+    private Map<Long, ElementFunctionTableEntry> functionTableEntries = new LinkedHashMap<Long, ElementFunctionTableEntry>();
+
+    /** C++ hash constant names to their value or to the name of a constant with same value. */
+    private SortedMap<String, String> hashConstants;
+
     /** Generated C++ source file containing name map. */
     private PrintStream nameMapFile;
 
@@ -241,6 +252,7 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
     protected String createDataConvenienceParameterList(XSTypeDefinition type) {
         XSSimpleTypeDefinition simpleType = Util.findSimpleTypeDefinition(type);
         Variety variety = Util.findVariety(simpleType);
+        boolean isHexBinaryList = Util.isHexBinaryListType(simpleType, config);
         if (variety == Variety.LIST) {
             simpleType = Util.findListItemType(simpleType);
         }
@@ -249,7 +261,9 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
         String cppType = null;
         switch (variety) {
         case LIST:
-            if (Util.findVariety(simpleType) == Variety.UNION) {
+            if (isHexBinaryList) {
+                cppType = config.getTypeMapping().get(Constants.DEFAULT_XSD_TYPE).getDataAtomicType();
+            } else if (Util.findVariety(simpleType) == Variety.UNION) {
                 cppType = config.getTemplateUnionDataListType();
                 cppType = TemplateEngine.fillInUnionTemplate(cppType, simpleType, this);
             } else if (Util.hasFacetEnum(simpleType)) {
@@ -282,13 +296,6 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
         return paraList;
     }
 
-    /**
-     * @return Name of C++ ElementToNamespace map member.
-     */
-    protected String createElementToNamespaceMapMembername() {
-        return "mElementToNamespaceMap";
-    }
-
     /**
      * Creates parameter list of convenience begin method.
      * 
@@ -518,6 +525,7 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
             System.out.println("Creating C++ element and attribute constants...");
             CppConstantsCreator constantsCreator = new CppConstantsCreator(config, this);
             constantsCreator.startWithRootElement(model, config.getRootElementName());
+            hashConstants = constantsCreator.getHashNameValueMap();
 
             // //////////////////////////////////////////////////////////////////
             // for debugging
@@ -726,6 +734,21 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
         return cppEnumOrUnionNameCreator;
     }
 
+    /**
+     * Resolves value of C++ hash constant.
+     * 
+     * @param hashConstantName
+     *            Name of hash constant.
+     * @return Hash value.
+     */
+    protected long getHashConstantValue(String hashConstantName) {
+        String value = hashConstants.get(hashConstantName);
+        while (hashConstants.containsKey(value)) {
+            value = hashConstants.get(value);
+        }
+        return Long.parseLong(value);
+    }
+
     /**
      * {@inheritDoc}
      * 
@@ -887,10 +910,8 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
                 printFreeAttributesImpl(cppName, element, attributeUses);
 
                 String elementHashID = Util.createElementNameHashIdentifier(cppName);
-                Util.printFunctionMapEntry(createFunctionMapMembername(), elementHashID, cppName, functionMapFile,
-                        config, false);
-                Util.printElementToNamespaceMapEntry(createElementToNamespaceMapMembername(), elementHashID, element,
-                        functionMapFile, config);
+                functionTableEntries.put(getHashConstantValue(elementHashID), new ElementFunctionTableEntry(
+                        elementHashID, Util.createElementNamespaceHashConstantName(element, config), cppName));
 
                 handleEnumsAndUnions();
 
@@ -2020,6 +2041,11 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
                 }
                 break;
             case LIST:
+                if (Util.isHexBinaryListType(simpleType, config)) {
+                    template = config.getTypeMapping().get(Constants.DEFAULT_XSD_TYPE).getDataAtomicDataMethodImpl();
+                    template = TemplateEngine.fillInTypeMappingTemplate(template, cppName, null, this);
+                    break;
+                }
                 if (Util.hasStreamingFacets(simpleType)) {
                     simpleTypeValiTmpl = config.getTemplateSimpleValidationNumericListData();
                     simpleTypeValiTmpl = TemplateEngine.prepareSimpleTypeValidationTemplate(simpleTypeValiTmpl,
@@ -2132,6 +2158,65 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
         stream.println();
     }
 
+    /**
+     * Prints constant C++ element function table, which uses a perfect hash
+     * of the element hashes.
+     */
+    protected void printElementFunctionTable() {
+        String className = config.getClassNamePrivate();
+        List<Long> hashes = new ArrayList<Long>(functionTableEntries.keySet());
+        PerfectHashCreator perfectHash = new PerfectHashCreator(hashes);
+
+        functionMapFile.println(config.getOutputSourceFileMethodDelimiter());
+        functionMapFile.println("const " + className + "::ElementFunctionEntry " + className + "::"
+                + Constants.ELEMENT_FUNCTION_ENTRIES_CPP_CONSTANT + "[] = {");
+        for (int slot : perfectHash.getSlots()) {
+            if (slot == -1) {
+                Util.printEmptyFunctionTableEntry(functionMapFile);
+            } else {
+                Util.printFunctionTableEntry(functionTableEntries.get(hashes.get(slot)), functionMapFile, config);
+            }
+        }
+        functionMapFile.println("};");
+        functionMapFile.println();
+
+        functionMapFile.println(config.getOutputSourceFileMethodDelimiter());
+        functionMapFile.println("const unsigned int " + className + "::"
+                + Constants.ELEMENT_FUNCTION_DISPLACEMENTS_CPP_CONSTANT + "[] = {");
+        int[] displacements = perfectHash.getDisplacements();
+        for (int i = 0; i < displacements.length; i++) {
+            functionMapFile.print(displacements[i] + ",");
+            if (i % 16 == 15 || i == displacements.length - 1) {
+                functionMapFile.println();
+            } else {
+                functionMapFile.print(" ");
+            }
+        }
+        functionMapFile.println("};");
+        functionMapFile.println();
+
+        functionMapFile.println(config.getOutputSourceFileMethodDelimiter());
+        functionMapFile.println("const " + className + "::ElementFunctionTable " + className + "::"
+                + Constants.ELEMENT_FUNCTION_TABLE_CPP_CONSTANT + " = {");
+        functionMapFile.println(Constants.ELEMENT_FUNCTION_ENTRIES_CPP_CONSTANT + ", "
+                + Constants.ELEMENT_FUNCTION_DISPLACEMENTS_CPP_CONSTANT + ", " + perfectHash.getDisplacementMask()
+                + ", " + perfectHash.getSlotShift());
+        functionMapFile.println("};");
+        functionMapFile.println();
+    }
+
+    /**
+     * Prints header declarations of constant element function table.
+     */
+    protected void printElementFunctionTableHeaderDecl() {
+        privateImplHeaderFile.println("static const ElementFunctionEntry "
+                + Constants.ELEMENT_FUNCTION_ENTRIES_CPP_CONSTANT + "[];");
+        privateImplHeaderFile.println("static const unsigned int "
+                + Constants.ELEMENT_FUNCTION_DISPLACEMENTS_CPP_CONSTANT + "[];");
+        privateImplHeaderFile.println("static const ElementFunctionTable "
+                + Constants.ELEMENT_FUNCTION_TABLE_CPP_CONSTANT + ";");
+    }
+
     /**
      * Prints a new line character.
      * 
@@ -2712,13 +2797,16 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
         PrinterUtils.printNamespaceOpen(functionMapFile, config.getNamespace());
         functionMapFile.println();
         functionMapFile.println();
-        printInitFunctionMapImplStart();
     }
 
     /**
      * Prints end of generated C++ function map file.
      */
     protected void printFunctionMapFileEnd() {
+        printElementFunctionTable();
+        printInitFunctionMapImplStart();
+        functionMapFile.println(createFunctionMapMembername() + " = ElementFunctionMap("
+                + Constants.ELEMENT_FUNCTION_TABLE_CPP_CONSTANT + ");");
         printInitFunctionMapImplEnd();
         functionMapFile.println();
         PrinterUtils.printNamespaceClose(functionMapFile, config);
@@ -3051,7 +3139,10 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
             String simpleTypeValiTmpl = null;
             switch (variety) {
             case LIST:
-                if (Util.hasFacetEnum(simpleType)) {
+                if (Util.isHexBinaryListType(listType, config)) {
+                    // character data has been passed through, there is no list to finish
+                    cppValidateEnd = null;
+                } else if (Util.hasFacetEnum(simpleType)) {
                     String cppEnumTypeName = cppEnumOrUnionNameCreator
                             .createEnumTypeName(simpleType, getElementStack());
                     enumsToBeHandled.add(new EnumNameTypePair(cppEnumTypeName, simpleType));
@@ -3199,6 +3290,8 @@ public class Generator extends AbstractStackBasedTraverser implements DOMErrorHa
         printInitFunctionMapHeaderDecl();
         printInitNameMapHeaderDecl();
         privateImplHeaderFile.println();
+        printElementFunctionTableHeaderDecl();
+        privateImplHeaderFile.println();
 
         privateImplHeaderFile.println("protected:");
         printFindElementHashHeaderDecl();
@@ -0,0 +1,168 @@
+/**
+ *   Copyright &copy; 2008-2012 NetAllied Systems GmbH, Ravensburg, Germany. 
+ *       
+ *   Licensed under the MIT Open Source License, 
+ *   for details please see LICENSE file or the website
+ *   http://www.opensource.org/licenses/mit-license.php
+*/
+package de.netallied.xsd2cppsax;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.List;
+
+/**
+ * Creates a perfect hash for a set of 32 bit keys (hash-and-displace). Keys
+ * are distributed to buckets by their lowest bits. Each bucket gets a
+ * displacement which moves all keys of the bucket to free slots. The slot of a
+ * key is
+ * <code>((key ^ displacements[key & displacementMask]) * MULTIPLIER) >>> slotShift</code>
+ * in unsigned 32 bit arithmetic. This must match
+ * GeneratedSaxParser::ParserTemplate::ElementFunctionTable::find().
+ * 
+ */
+public class PerfectHashCreator {
+
+    /** Multiplier of hash function. */
+    public static final int MULTIPLIER = 0x9E3779B1;
+
+    /** Displacements tried for a bucket before number of buckets is increased. */
+    protected static final int MAX_DISPLACEMENT = 1 << 16;
+
+    /**
+     * Calculates slot of given key.
+     */
+    public static int calculateSlot(long key, int displacement, int slotShift) {
+        return (((int) key ^ displacement) * MULTIPLIER) >>> slotShift;
+    }
+
+    /** Displacement of each bucket. */
+    private int[] displacements;
+
+    /** Keys to create perfect hash for. */
+    private List<Long> keys;
+
+    /** Index of key in each slot. -1 for unused slots. */
+    private int[] slots;
+
+    /** Number of bits of slot index. */
+    private int slotBits;
+
+    /**
+     * Constructor.
+     * 
+     * @param keys
+     *            Distinct keys. Must fit into 32 bits.
+     */
+    public PerfectHashCreator(List<Long> keys) {
+        this.keys = keys;
+        int keyCount = keys.size();
+        slotBits = 1;
+        while ((1 << slotBits) < keyCount + keyCount / 4) {
+            slotBits++;
+        }
+        int displacementBits = 0;
+        while ((1 << displacementBits) < Math.max(1, keyCount / 4)) {
+            displacementBits++;
+        }
+        while (!create(displacementBits)) {
+            displacementBits++;
+        }
+    }
+
+    /**
+     * Tries to find displacements for given number of buckets.
+     * 
+     * @return False if a bucket could not be placed.
+     */
+    protected boolean create(int displacementBits) {
+        int bucketCount = 1 << displacementBits;
+        final List<List<Integer>> buckets = new ArrayList<List<Integer>>();
+        for (int i = 0; i < bucketCount; i++) {
+            buckets.add(new ArrayList<Integer>());
+        }
+        for (int i = 0; i < keys.size(); i++) {
+            buckets.get((int) (keys.get(i) & (bucketCount - 1))).add(i);
+        }
+
+        // place big buckets first
+        List<Integer> bucketOrder = new ArrayList<Integer>();
+        for (int i = 0; i < bucketCount; i++) {
+            bucketOrder.add(i);
+        }
+        Collections.sort(bucketOrder, new Comparator<Integer>() {
+            public int compare(Integer b1, Integer b2) {
+                int sizeDiff = buckets.get(b2).size() - buckets.get(b1).size();
+                return sizeDiff != 0 ? sizeDiff : b1 - b2;
+            }
+        });
+
+        displacements = new int[bucketCount];
+        slots = new int[1 << slotBits];
+        Arrays.fill(slots, -1);
+        int slotShift = getSlotShift();
+        int[] bucketSlots = new int[keys.size()];
+        for (int bucket : bucketOrder) {
+            List<Integer> bucketKeys = buckets.get(bucket);
+            if (bucketKeys.isEmpty()) {
+                continue;
+            }
+            boolean placed = false;
+            for (int displacement = 0; displacement < MAX_DISPLACEMENT && !placed; displacement++) {
+                placed = true;
+                for (int i = 0; i < bucketKeys.size() && placed; i++) {
+                    int slot = calculateSlot(keys.get(bucketKeys.get(i)), displacement, slotShift);
+                    if (slots[slot] != -1) {
+                        placed = false;
+                    }
+                    for (int j = 0; j < i && placed; j++) {
+                        if (bucketSlots[j] == slot) {
+                            placed = false;
+                        }
+                    }
+                    bucketSlots[i] = slot;
+                }
+                if (placed) {
+                    displacements[bucket] = displacement;
+                    for (int i = 0; i < bucketKeys.size(); i++) {
+                        slots[bucketSlots[i]] = bucketKeys.get(i);
+                    }
+                }
+            }
+            if (!placed) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @return Mask to get bucket of a key.
+     */
+    public int getDisplacementMask() {
+        return displacements.length - 1;
+    }
+
+    /**
+     * @return Displacement of each bucket.
+     */
+    public int[] getDisplacements() {
+        return displacements;
+    }
+
+    /**
+     * @return Shift to get slot from multiplied key.
+     */
+    public int getSlotShift() {
+        return 32 - slotBits;
+    }
+
+    /**
+     * @return Index of key in each slot. -1 for unused slots.
+     */
+    public int[] getSlots() {
+        return slots;
+    }
+}
@@ -675,6 +675,8 @@ public abstract class TypeMapFactoryNumeric implements ITypeMapFactory {
     }
 
     public TypeMap createDefaultTypeMapHexBinary() {
+        // used for attributes, character data of hexBinary lists is passed
+        // through as string, see Util.isHexBinaryListType()
         TypeMap typeMap = createAbstractUINT8();
         typeMap.setXsdType("hexBinary");
         return typeMap;
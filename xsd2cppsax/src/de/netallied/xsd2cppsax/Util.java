@@ -917,6 +917,22 @@ public class Util {
         return type == null ? false : type.getNumeric();
     }
 
+    /**
+     * Finds out if given type is a list of hexBinary. Character data of such
+     * lists is not converted, but passed through like a string, so it can be
+     * decoded when it is used.
+     * 
+     * @param type
+     *            Type to check
+     * @return True if type is a list of hexBinary.
+     */
+    public static boolean isHexBinaryListType(XSSimpleTypeDefinition type, Config config) {
+        if (findVariety(type) != Variety.LIST) {
+            return false;
+        }
+        return findXSDSimpleTypeString(findListItemType(type), config).equals("hexBinary");
+    }
+
     /**
      * Special stream end validation is required for list types with facets
      * length or minLength.
@@ -1070,48 +1086,38 @@ public class Util {
     }
 
     /**
-     * Prints an entry of map containing element hash to namespace hash.
+     * Creates C++ hash constant name for the xml namespace of an element.
      * 
-     * @param mapVariableName
-     *            Name of C++ map.
-     * @param elementHash
-     *            Hash constant or hash itself of element.
      * @param element
      *            Element, needed to find out namespace.
-     * @param stream
-     *            Stream to print map entry to.
      * @param config
      *            Config.
+     * @return C++ name or "0" if element has no namespace.
      */
-    public static void printElementToNamespaceMapEntry(String mapVariableName, String elementHash,
-            XSElementDeclaration element, PrintStream stream, Config config) {
-        stream.print(mapVariableName + "[" + elementHash + "] = ");
+    public static String createElementNamespaceHashConstantName(XSElementDeclaration element, Config config) {
         String namespace = element.getNamespace();
-        String namespaceHash = null;
         if (namespace != null) {
-            namespaceHash = createNamespaceHashConstantName(namespace, config);
-        } else {
-            namespaceHash = "0";
+            return createNamespaceHashConstantName(namespace, config);
         }
+        return "0";
+    }
 
-        stream.println(namespaceHash + ";");
+    /**
+     * Prints empty entry of element function table.
+     */
+    public static void printEmptyFunctionTableEntry(PrintStream stream) {
+        stream.println("{0, 0, {0, 0, 0, 0, 0, 0}},");
     }
 
     /**
-     * Prints entry in function map for element.
+     * Prints entry of element function table.
      * 
-     * @param hashID
-     *            C++ constant for hash.
-     * @param cppElementName
-     *            C++ element name.
+     * @param entry
+     *            Hash constants and C++ name of element.
      */
-    public static void printFunctionMapEntry(String mapVariableName, String hashID, String cppElementName,
-            PrintStream stream, Config config, boolean printFunctionStructNamespace) {
-        stream.print(mapVariableName + "[" + hashID + "] = ");
-        if (printFunctionStructNamespace) {
-            stream.print(config.getClassNamePrivate() + "::");
-        }
-        stream.print("FunctionStruct" + "(");
+    public static void printFunctionTableEntry(ElementFunctionTableEntry entry, PrintStream stream, Config config) {
+        String cppElementName = entry.cppElementName;
+        stream.print("{" + entry.hashID + ", " + entry.namespaceHashID + ", {");
 
         printFunctionMapEntryAddressStart(stream, config);
         stream.print(createBeginInternalMethodName(cppElementName, config) + ", ");
@@ -1126,7 +1132,7 @@ public class Util {
         printFunctionMapEntryAddressStart(stream, config);
         stream.print(createFreeAttributesMethodName(cppElementName));
 
-        stream.println(");");
+        stream.println("}},");
     }
 
     /**